@@ -41,6 +41,7 @@ extern ADC_HandleTypeDef hadc1;
 void MX_ADC1_Init(void);
 
 /* USER CODE BEGIN Prototypes */
+HAL_StatusTypeDef ADC_Audio_Start(uint16_t *buffer, uint32_t len, uint32_t sample_rate);
 
 /* USER CODE END Prototypes */
 
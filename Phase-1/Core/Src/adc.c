@@ -21,7 +21,8 @@
 #include "adc.h"
 
 /* USER CODE BEGIN 0 */
-
+// Sample clock for ADC_Audio_Start()
+static TIM_HandleTypeDef htim2;
 /* USER CODE END 0 */
 
 ADC_HandleTypeDef hadc1;
@@ -139,4 +140,77 @@ void HAL_ADC_MspDeInit(ADC_HandleTypeDef* adcHandle)
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief  Switch ADC1 from the temperature sensor to microphone audio:
+  *         PA5 (ADC12_IN5) converted on every TIM2 update, streamed by
+  *         DMA2_Stream0 into a circular buffer of 12-bit codes. The HAL
+  *         half/full complete callbacks fire as each half fills.
+  * @param  buffer: Circular buffer, len samples
+  * @param  len: Samples, even
+  * @param  sample_rate: Hz
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ADC_Audio_Start(uint16_t *buffer, uint32_t len, uint32_t sample_rate)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+  ADC_ChannelConfTypeDef sConfig = {0};
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+  uint32_t tim_clk;
+
+  MX_ADC1_Init();
+
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  GPIO_InitStruct.Pin = GPIO_PIN_5;
+  GPIO_InitStruct.Mode = GPIO_MODE_ANALOG;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+  // TIM2 is on APB1; its clock is twice PCLK1 when APB1 is divided
+  tim_clk = HAL_RCC_GetPCLK1Freq();
+  if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_HCLK_DIV1)
+  {
+    tim_clk *= 2U;
+  }
+
+  __HAL_RCC_TIM2_CLK_ENABLE();
+  htim2.Instance = TIM2;
+  htim2.Init.Prescaler = 0;
+  htim2.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim2.Init.Period = tim_clk / sample_rate - 1U;
+  htim2.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim2.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+  if (HAL_TIM_Base_Init(&htim2) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_UPDATE;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim2, &sMasterConfig) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  // One conversion per trigger instead of free running
+  hadc1.Init.ContinuousConvMode = DISABLE;
+  hadc1.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
+  hadc1.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T2_TRGO;
+  if (HAL_ADC_Init(&hadc1) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  sConfig.Channel = ADC_CHANNEL_5;
+  sConfig.Rank = 1;
+  sConfig.SamplingTime = ADC_SAMPLETIME_56CYCLES;
+  if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_ADC_Start_DMA(&hadc1, (uint32_t *)buffer, len) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  return HAL_TIM_Base_Start(&htim2);
+}
+
 /* USER CODE END 1 */
@@ -29,6 +29,10 @@
 #include "usart.h"
 #include <stdio.h>
 #include "ili9341.h"
+#include "adc.h"
+#include "bh_kws.h"
+#include "kws_model.h"   // Models/, regenerate with "make kws-model"
+#include "kws_plan.h"    // Models/, planned by Host/tools/nn_planner.c
 
 extern ADC_HandleTypeDef hadc1;
 
@@ -41,6 +45,13 @@ extern ADC_HandleTypeDef hadc1;
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+// Keyword spotter: one DMA half-buffer per inference stride (100 ms), so an
+// inference that keeps to its budget is always done before the DMA wraps
+#define KWS_BLOCK           (KWS_STRIDE * KWS_HOP_LEN)
+#define KWS_BUDGET_PERCENT  50U             // Of the stride, per inference
+#define KWS_HALF_READY      (1UL << 0)      // KwsTask notification bits
+#define KWS_FULL_READY      (1UL << 1)
+#define KWS_STATS_MS        10000U
 
 /* USER CODE END PD */
 
@@ -66,6 +77,15 @@ SemaphoreHandle_t ButtonSemaphore;
 
 
 osThreadId EventTaskHandle;
+osThreadId KwsTaskHandle;
+osThreadId WakeTaskHandle;
+
+static uint16_t kws_dma[2U * KWS_BLOCK];
+static uint8_t kws_mem[KWS_ARENA_BYTES + BH_KWS_FRONT_END_BYTES(KWS_FFT_LEN, KWS_WIN_LEN, KWS_NUM_MELS,
+                                                                KWS_NUM_DCT, KWS_NUM_ROWS)]
+    __attribute__((aligned(16)));
+static bh_arena_t kws_arena;
+static bh_kws_t kws;
 /* USER CODE END Variables */
 osThreadId defaultTaskHandle;
 
@@ -73,6 +93,8 @@ osThreadId defaultTaskHandle;
 /* USER CODE BEGIN FunctionPrototypes */
 void EventTask(void const * argument);
 void LcdTask(void const * argument);
+void KwsTask(void const * argument);
+void WakeTask(void const * argument);
 /* USER CODE END FunctionPrototypes */
 
 void StartDefaultTask(void const * argument);
@@ -192,7 +214,11 @@ void MX_FREERTOS_Init(void) {
 
   /* USER CODE BEGIN RTOS_THREADS */
   /* add threads, ... */
+  osThreadDef(wake, WakeTask, osPriorityNormal, 0, 256);
+  WakeTaskHandle = osThreadCreate(osThread(wake), NULL);
 
+  osThreadDef(kws, KwsTask, osPriorityAboveNormal, 0, 1024);
+  KwsTaskHandle = osThreadCreate(osThread(kws), NULL);
 
 
   /* USER CODE END RTOS_THREADS */
@@ -264,4 +290,102 @@ void LcdTask(void const *argument)
         vTaskDelay(pdMS_TO_TICKS(1000));
     }
 }
+
+/* ============================================
+   Keyword Spotter
+   ============================================ */
+
+// ADC DMA: wake the spotter with the half that just filled
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (hadc->Instance == ADC1 && KwsTaskHandle != NULL) {
+        xTaskNotifyFromISR(KwsTaskHandle, KWS_HALF_READY, eSetBits, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (hadc->Instance == ADC1 && KwsTaskHandle != NULL) {
+        xTaskNotifyFromISR(KwsTaskHandle, KWS_FULL_READY, eSetBits, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+// Detection callback, runs in KwsTask: hand the label and score to WakeTask
+static void KwsDetected(void *ctx, uint32_t label, uint8_t score)
+{
+    (void)ctx;
+    xTaskNotify(WakeTaskHandle, label | ((uint32_t)score << 8), eSetValueWithOverwrite);
+}
+
+void KwsTask(void const *argument)
+{
+    bh_kws_config_t cfg = {
+        .sample_rate = KWS_SAMPLE_RATE, .fft_len = KWS_FFT_LEN, .win_len = KWS_WIN_LEN,
+        .hop_len = KWS_HOP_LEN, .num_mels = KWS_NUM_MELS, .num_dct = KWS_NUM_DCT, .num_rows = KWS_NUM_ROWS,
+        .model = kws_model, .model_size = KWS_MODEL_BYTES, .plan = &kws_plan,
+        .input_scale = KWS_INPUT_SCALE, .input_zp = KWS_INPUT_ZP,
+        .stride = KWS_STRIDE, .smooth = KWS_SMOOTH, .first_keyword = KWS_FIRST_KEYWORD,
+        .threshold = KWS_THRESHOLD, .refractory = KWS_REFRACTORY,
+        .notify = KwsDetected, .ctx = NULL,
+    };
+    uint32_t stride_ms = KWS_STRIDE * KWS_HOP_LEN * 1000U / KWS_SAMPLE_RATE;
+    uint32_t bits, last = HAL_GetTick();
+
+    (void)argument;
+
+    // Fixed CPU budget: a share of the stride in core cycles
+    cfg.budget_cycles = HAL_RCC_GetSysClockFreq() / 1000U * stride_ms * KWS_BUDGET_PERCENT / 100U;
+
+    bh_arena_init(&kws_arena, kws_mem, sizeof(kws_mem));
+    if (bh_kws_init(&kws, &kws_arena, &cfg) != ARM_MATH_SUCCESS
+        || ADC_Audio_Start(kws_dma, 2U * KWS_BLOCK, KWS_SAMPLE_RATE) != HAL_OK) {
+        printf("KWS init failed\r\n");
+        HAL_GPIO_WritePin(LED_PORT, LED_RED_PIN, GPIO_PIN_SET);
+        vTaskDelete(NULL);
+    }
+    printf("KWS: %lu ms stride, budget %lu cycles, arena %lu of %lu bytes\r\n", stride_ms,
+           cfg.budget_cycles, (uint32_t)(sizeof(kws_mem) - bh_arena_remaining(&kws_arena)),
+           (uint32_t)sizeof(kws_mem));
+
+    for (;;) {
+        xTaskNotifyWait(0, KWS_HALF_READY | KWS_FULL_READY, &bits, portMAX_DELAY);
+
+        // Both bits: the task fell a half behind and the older half is
+        // already being overwritten; the front end copes with the gap
+        if (bits & KWS_HALF_READY) {
+            bh_kws_process_adc(&kws, kws_dma, KWS_BLOCK);
+        }
+        if (bits & KWS_FULL_READY) {
+            bh_kws_process_adc(&kws, kws_dma + KWS_BLOCK, KWS_BLOCK);
+        }
+
+        if (HAL_GetTick() - last >= KWS_STATS_MS) {
+            last = HAL_GetTick();
+            printf("KWS: front end %lu cycles/block, inference %lu cycles (max %lu), %lu runs, "
+                   "%lu over budget, %lu skipped, %lu detections\r\n",
+                   kws.fe_cycles_last, kws.cycles_last, kws.cycles_max, kws.inferences,
+                   kws.over_budget, kws.skipped, kws.detections);
+        }
+    }
+}
+
+void WakeTask(void const *argument)
+{
+    uint32_t value;
+
+    (void)argument;
+
+    for (;;) {
+        xTaskNotifyWait(0, 0xFFFFFFFFUL, &value, portMAX_DELAY);
+
+        HAL_GPIO_TogglePin(LED_PORT, LED_GREEN_PIN);
+        printf("[%lu] Keyword %lu, score %lu/255\r\n", HAL_GetTick(), value & 0xFFU, value >> 8);
+    }
+}
 /* USER CODE END Application */
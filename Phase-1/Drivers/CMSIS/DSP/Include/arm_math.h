@@ -145,6 +145,17 @@
    * With Helium or Neon, disable the use of vectorized code with C intrinsics
    * and use pure C instead. The vectorization is then done by the compiler.
    *
+   * - ARM_MATH_X86:
+   *
+   * On x86-64 hosts (GCC or Clang), let the hottest f32 kernels select an
+   * SSE2 or AVX2+FMA implementation at run time from CPUID. See \ref groupX86.
+   *
+   * - ARM_MATH_PTHREAD:
+   *
+   * On Linux hosts, let the kernels that take a thread count (radix sort and
+   * argsort, distance matrix, k-NN, GEMM) split large inputs across a pool
+   * of POSIX threads.
+   *
    * <hr>
    * \section pack CMSIS-DSP in ARM::CMSIS Pack
    *
@@ -205,6 +216,7 @@
 #include "dsp/transform_functions.h"
 #include "dsp/filtering_functions.h"
 #include "dsp/quaternion_math_functions.h"
+#include "dsp/x86_functions.h"
 
 
 
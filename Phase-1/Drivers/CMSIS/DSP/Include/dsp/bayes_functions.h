@@ -81,6 +81,37 @@ uint32_t arm_gaussian_naive_bayes_predict_f32(const arm_gaussian_naive_bayes_ins
    float32_t *pOutputProbabilities,
    float32_t *pBufferB);
 
+/**
+ * @brief Input vectors scored together by the batched estimator
+ */
+#define ARM_GAUSSIAN_NAIVE_BAYES_BATCH_BLOCK 32U
+
+/**
+ * @brief Scratch length, in float32_t, of arm_gaussian_naive_bayes_predict_batch_f32()
+ */
+#define ARM_GAUSSIAN_NAIVE_BAYES_BATCH_SCRATCH_SIZE(vectorDimension, numberOfClasses) \
+  ((numberOfClasses) * (2U * (vectorDimension) + 1U) + (vectorDimension) + \
+   ARM_GAUSSIAN_NAIVE_BAYES_BATCH_BLOCK * (2U * (vectorDimension) + (numberOfClasses)))
+
+/**
+ * @brief Naive Gaussian Bayesian Estimator for a batch of vectors
+ *
+ * @param[in]  S                        points to a naive bayes instance structure
+ * @param[in]  pIn                      points to numVectors input vectors, one after the other
+ * @param[in]  numVectors               number of input vectors
+ * @param[out] pOutputProbabilities     points to numVectors x numberOfClasses log probabilities, or NULL
+ * @param[in]  pScratch                 points to a working buffer of
+ *                                      ARM_GAUSSIAN_NAIVE_BAYES_BATCH_SCRATCH_SIZE(vectorDimension, numberOfClasses) values
+ * @param[out] pResult                  points to the predicted class of each vector
+ *
+ */
+void arm_gaussian_naive_bayes_predict_batch_f32(const arm_gaussian_naive_bayes_instance_f32 *S,
+   const float32_t * pIn,
+   uint32_t numVectors,
+   float32_t *pOutputProbabilities,
+   float32_t *pScratch,
+   uint32_t *pResult);
+
 
 #ifdef   __cplusplus
 }
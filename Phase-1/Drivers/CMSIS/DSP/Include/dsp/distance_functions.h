@@ -332,6 +332,140 @@ float32_t arm_sokalsneath_distance(const uint32_t *pA, const uint32_t *pB, uint3
 
 float32_t arm_yule_distance(const uint32_t *pA, const uint32_t *pB, uint32_t numberOfBools);
 
+/**
+ * @brief Metrics supported by the distance matrix and k-NN functions
+ */
+typedef enum
+{
+  ARM_DISTANCE_EUCLIDEAN   = 0,   /**< sqrt(sum (a - b)^2), from the norms and a.b about the mean of B */
+  ARM_DISTANCE_SQEUCLIDEAN = 1,   /**< sum (a - b)^2, from the norms and a.b about the mean of B */
+  ARM_DISTANCE_COSINE      = 2,   /**< 1 - a.b / (|a| |b|) */
+  ARM_DISTANCE_CITYBLOCK   = 3,   /**< sum |a - b| */
+  ARM_DISTANCE_CHEBYSHEV   = 4    /**< max |a - b| */
+} arm_distance_metric;
+
+/**
+ * @brief Queries handled together by arm_knn_f32
+ */
+#define ARM_KNN_QUERY_BLOCK 16U
+
+/**
+ * @brief Size of the arm_distance_matrix_f32 working buffer, in float32_t
+ */
+#define ARM_DISTANCE_NORMS_SIZE(numA, numB, dim) ((numA) + (numB) + (dim))
+
+/**
+ * @brief Size of the arm_knn_f32 reference norm buffer, in float32_t
+ */
+#define ARM_KNN_NORMS_SIZE(numVectors, dim) ((numVectors) + (dim))
+
+/**
+ * @brief Size of the arm_knn_f32 distance buffer, in float32_t
+ */
+#define ARM_KNN_DIST_SIZE(numVectors) (ARM_KNN_QUERY_BLOCK * (numVectors))
+
+/**
+ * @brief Instance structure for the floating-point distance matrix.
+ */
+typedef struct
+{
+  arm_distance_metric metric;   /**< Distance metric */
+  uint32_t numThreads;          /**< Threads for large matrices, 0 for all CPUs (ARM_MATH_PTHREAD builds) */
+  float32_t *pNorms;            /**< Working buffer of ARM_DISTANCE_NORMS_SIZE(numA, numB, dim) values */
+} arm_distance_matrix_instance_f32;
+
+/**
+ * @brief Instance structure for the floating-point k-nearest-neighbour search.
+ */
+typedef struct
+{
+  arm_distance_metric metric;   /**< Distance metric */
+  uint32_t numThreads;          /**< Threads for the distance computation */
+  uint32_t numVectors;          /**< Number of reference vectors */
+  uint32_t dim;                 /**< Vector length */
+  uint32_t maxK;                /**< Largest k a query may ask for */
+  const float32_t *pData;       /**< Reference vectors, numVectors rows of dim values */
+  float32_t *pNorms;            /**< Norms of the reference vectors, then their mean: ARM_KNN_NORMS_SIZE values */
+  float32_t *pDist;             /**< Distance buffer, ARM_KNN_DIST_SIZE(numVectors) values */
+  uint64_t *pHeap;              /**< Selection buffer, maxK words */
+} arm_knn_instance_f32;
+
+/**
+ * @brief        Initialization function for the distance matrix
+ * @param[out]   S           Instance
+ * @param[in]    metric      Distance metric
+ * @param[in]    numThreads  Threads for large matrices, 0 for all CPUs, 1 for none
+ * @param[in]    pNorms      Working buffer of ARM_DISTANCE_NORMS_SIZE(numA, numB, dim) values (largest call)
+ *
+ */
+void arm_distance_matrix_init_f32(arm_distance_matrix_instance_f32 *S,
+  arm_distance_metric metric,
+  uint32_t numThreads,
+  float32_t *pNorms);
+
+/**
+ * @brief        Distances between all rows of A and all rows of B
+ * @param[in]    S          Instance
+ * @param[in]    pA         numA vectors of dim values, one per row
+ * @param[in]    numA       Number of vectors in A
+ * @param[in]    pB         numB vectors of dim values, or pA for the distances within A
+ * @param[in]    numB       Number of vectors in B
+ * @param[in]    dim        Vector length
+ * @param[out]   pDst       numA x numB distances, row-major
+ *
+ */
+void arm_distance_matrix_f32(const arm_distance_matrix_instance_f32 *S,
+  const float32_t *pA,
+  uint32_t numA,
+  const float32_t *pB,
+  uint32_t numB,
+  uint32_t dim,
+  float32_t *pDst);
+
+/**
+ * @brief        Initialization function for the k-nearest-neighbour search
+ * @param[out]   S           Instance
+ * @param[in]    metric      Distance metric
+ * @param[in]    pData       Reference vectors, numVectors rows of dim values
+ * @param[in]    numVectors  Number of reference vectors
+ * @param[in]    dim         Vector length
+ * @param[in]    maxK        Largest k a query may ask for
+ * @param[in]    numThreads  Threads for large searches, 0 for all CPUs, 1 for none
+ * @param[in]    pNorms      Buffer for the reference norms and mean, ARM_KNN_NORMS_SIZE(numVectors, dim) values
+ * @param[in]    pDist       Distance buffer, ARM_KNN_DIST_SIZE(numVectors) values
+ * @param[in]    pHeap       Selection buffer, maxK words
+ * @return       ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+ *
+ */
+arm_status arm_knn_init_f32(arm_knn_instance_f32 *S,
+  arm_distance_metric metric,
+  const float32_t *pData,
+  uint32_t numVectors,
+  uint32_t dim,
+  uint32_t maxK,
+  uint32_t numThreads,
+  float32_t *pNorms,
+  float32_t *pDist,
+  uint64_t *pHeap);
+
+/**
+ * @brief        k nearest reference vectors of each query
+ * @param[in]    S           Instance
+ * @param[in]    pQuery      numQueries vectors of dim values
+ * @param[in]    numQueries  Number of queries
+ * @param[in]    k           Neighbours per query, at most maxK
+ * @param[out]   pDist       numQueries x k distances, nearest first, or NULL
+ * @param[out]   pIndex      numQueries x k reference indices, nearest first
+ * @return       ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+ *
+ */
+arm_status arm_knn_f32(const arm_knn_instance_f32 *S,
+  const float32_t *pQuery,
+  uint32_t numQueries,
+  uint32_t k,
+  float32_t *pDist,
+  uint32_t *pIndex);
+
 
 
 #ifdef   __cplusplus
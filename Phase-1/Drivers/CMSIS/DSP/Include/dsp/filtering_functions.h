@@ -35,6 +35,7 @@
 
 #include "dsp/support_functions.h"
 #include "dsp/fast_math_functions.h"
+#include "dsp/transform_functions.h"
 
 #ifdef   __cplusplus
 extern "C"
@@ -264,6 +265,119 @@ extern "C"
         float32_t * pState,
         uint32_t blockSize);
 
+/**
+ * @brief Number of partitions of a partitioned FFT FIR filter.
+ */
+#define ARM_FIR_FFT_NUM_PARTS(numTaps, partLen) (((uint32_t)(numTaps) + (partLen) - 1U) / (partLen))
+
+/**
+ * @brief Length in float32_t of the filter spectra of a partitioned FFT FIR filter.
+ */
+#define ARM_FIR_FFT_COEFFS_SIZE(numTaps, partLen) (2U * (partLen) * ARM_FIR_FFT_NUM_PARTS(numTaps, partLen))
+
+/**
+ * @brief Length in float32_t of the state buffer of a partitioned FFT FIR filter.
+ */
+#define ARM_FIR_FFT_STATE_SIZE(numTaps, partLen) (2U * (partLen) * (ARM_FIR_FFT_NUM_PARTS(numTaps, partLen) + 3U))
+
+  /**
+   * @brief Instance structure for the floating-point partitioned FFT FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;                 /**< number of filter coefficients in the filter. */
+          uint16_t partLen;                 /**< partition length, samples per FFT block. */
+          uint16_t numParts;                /**< number of partitions of the impulse response. */
+          uint16_t fdlIndex;                /**< slot of the next spectrum in the delay line. */
+          float32_t *pState;                /**< points to the state buffer, of length ARM_FIR_FFT_STATE_SIZE. */
+    const float32_t *pCoeffsFreq;           /**< points to the filter spectra, of length ARM_FIR_FFT_COEFFS_SIZE. */
+          arm_rfft_fast_instance_f32 rfft;  /**< real FFT of 2*partLen points. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point partitioned FFT FIR filter.
+   * @param[in,out] S          points to an instance of the filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, a multiple of partLen.
+   * @return        execution status
+   */
+  arm_status arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned FFT FIR filter.
+   * @param[in,out] S            points to an instance of the filter structure.
+   * @param[in]     numTaps      number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients, time reversed as for arm_fir_init_f32.
+   * @param[in]     partLen      partition length, a power of 2 from 16 to 2048.
+   * @param[out]    pCoeffsFreq  points to the filter spectra buffer.
+   * @param[in]     pState       points to the state buffer.
+   * @return        execution status
+   */
+  arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        uint16_t partLen,
+        float32_t * pCoeffsFreq,
+        float32_t * pState);
+
+  /**
+   * @brief Instance structure for the floating-point FIR filter with automatic choice of algorithm.
+   */
+  typedef struct
+  {
+          uint16_t partLen;               /**< partition length of the FFT form, 0 for the direct form. */
+          arm_fir_instance_f32 fir;       /**< direct form filter. */
+          arm_fir_fft_instance_f32 fft;   /**< partitioned FFT filter. */
+  } arm_fir_auto_instance_f32;
+
+  /**
+   * @brief Partition length the automatic FIR filter uses, 0 for the direct form.
+   * @param[in] numTaps    number of filter coefficients in the filter.
+   * @param[in] blockSize  number of samples processed per call.
+   * @return    partition length or 0
+   */
+  uint16_t arm_fir_auto_part_len_f32(
+  uint16_t numTaps,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with automatic choice of algorithm.
+   * @param[in,out] S            points to an instance of the filter structure.
+   * @param[in]     numTaps      number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients, time reversed as for arm_fir_init_f32.
+   * @param[out]    pCoeffsFreq  points to the filter spectra buffer (FFT form only).
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of samples processed per call.
+   * @return        execution status
+   */
+  arm_status arm_fir_auto_init_f32(
+        arm_fir_auto_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffsFreq,
+        float32_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point FIR filter with automatic choice of algorithm.
+   * @param[in,out] S          points to an instance of the filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        execution status
+   */
+  arm_status arm_fir_auto_f32(
+        arm_fir_auto_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
   /**
    * @brief  Initialization function for the floating-point FIR filter.
    * @param[in,out] S          points to an instance of the floating-point FIR filter structure.
@@ -301,6 +415,18 @@ extern "C"
           uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
   } arm_biquad_casd_df1_inst_q31;
 
+  /**
+   * @brief Instance structure for the N-channel Q31 Biquad cascade filter.
+   */
+  typedef struct
+  {
+          uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChannels;    /**< number of interleaved channels. */
+          q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    const q31_t *pCoeffs;          /**< Points to the array of coefficients, transposed by the init function.  The array is of length 5*numStages*numChannels. */
+          uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_multich_df1_instance_q31;
+
   /**
    * @brief Instance structure for the floating-point Biquad cascade filter.
    */
@@ -403,6 +529,40 @@ extern "C"
         q31_t * pState,
         int8_t postShift);
 
+  /**
+   * @brief Processing function for the N-channel Q31 Biquad cascade filter
+   * @param[in]  S          points to an instance of the Q31 Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of input data, channels interleaved.
+   * @param[out] pDst       points to the block of output data, channels interleaved.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_multich_df1_q31(
+  const arm_biquad_cascade_multich_df1_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the N-channel Q31 Biquad cascade filter.
+   * @param[in,out] S                 points to an instance of the Q31 Biquad cascade structure.
+   * @param[in]     numStages         number of 2nd order stages in the filter.
+   * @param[in]     numChannels       number of interleaved channels.
+   * @param[in]     pCoeffs           points to the filter coefficients, shared or one set per channel.
+   * @param[in]     perChannelCoeffs  1 if pCoeffs has one set of coefficients per channel.
+   * @param[out]    pCoeffsLanes      points to the 5*numStages*numChannels coefficients used by the filter.
+   * @param[in]     pState            points to the state buffer.
+   * @param[in]     postShift         Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_multich_df1_init_q31(
+        arm_biquad_cascade_multich_df1_instance_q31 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const q31_t * pCoeffs,
+        uint8_t perChannelCoeffs,
+        q31_t * pCoeffsLanes,
+        q31_t * pState,
+        int8_t postShift);
+
   /**
    * @brief Processing function for the floating-point Biquad cascade filter.
    * @param[in]  S          points to an instance of the floating-point Biquad cascade structure.
@@ -1096,6 +1256,278 @@ arm_status arm_fir_decimate_init_f32(
         float32_t * pState,
         uint32_t blockSize);
 
+  /**
+   * @brief Quality setting of the sample rate converters.
+   *
+   * The value is the number of taps per output sample when upsampling;
+   * downsampling by a factor D costs ceil(D) times as many.
+   */
+  typedef enum
+  {
+    ARM_RESAMPLE_FAST     = 8,    /**< about 55 dB stopband, 80 % of the band kept. */
+    ARM_RESAMPLE_BALANCED = 16,   /**< about 80 dB stopband, 88 % of the band kept. */
+    ARM_RESAMPLE_BEST     = 32    /**< about 100 dB stopband, 92 % of the band kept. */
+  } arm_resample_quality;
+
+/**
+ * @brief Taps per phase of a sample rate converter.
+ */
+#define ARM_RESAMPLE_PHASE_LEN(inRate, outRate, quality) \
+  ((uint32_t)(quality) * (((uint32_t)(inRate) + (outRate) - 1U) / (outRate)))
+
+/**
+ * @brief Length of the state buffer of a sample rate converter.
+ */
+#define ARM_RESAMPLE_STATE_SIZE(inRate, outRate, quality, blockSize) \
+  (ARM_RESAMPLE_PHASE_LEN(inRate, outRate, quality) + (blockSize) - 1U)
+
+/**
+ * @brief Largest number of output samples a sample rate converter produces from blockSize input samples.
+ */
+#define ARM_RESAMPLE_MAX_OUTPUT(inRate, outRate, blockSize) \
+  ((uint32_t)(((uint64_t)(blockSize) * (outRate) + (inRate) - 1U) / (inRate)) + 1U)
+
+/**
+ * @brief Length of the phase table of a rational resampler.
+ */
+#define ARM_RESAMPLE_POLY_COEFFS_SIZE(L, M, quality) \
+  ((uint32_t)(L) * ARM_RESAMPLE_PHASE_LEN(M, L, quality))
+
+/**
+ * @brief Number of phases in the table of a fractional resampler.
+ */
+#define ARM_RESAMPLE_FRAC_PHASES(quality) (4U * (uint32_t)(quality))
+
+/**
+ * @brief Length of the phase table of a fractional resampler.
+ */
+#define ARM_RESAMPLE_FRAC_COEFFS_SIZE(inRate, outRate, quality) \
+  ((ARM_RESAMPLE_FRAC_PHASES(quality) + 1U) * ARM_RESAMPLE_PHASE_LEN(inRate, outRate, quality))
+
+  /**
+   * @brief Instance structure for the floating-point rational resampler.
+   */
+  typedef struct
+  {
+          uint16_t L;                /**< upsample factor. */
+          uint16_t M;                /**< downsample factor. */
+          uint16_t phaseLength;      /**< taps per phase. */
+          uint16_t phase;            /**< phase of the next output sample, 0 to L-1. */
+          uint32_t inIndex;          /**< input sample of the next output, relative to the next block. */
+          float32_t *pState;         /**< points to the state buffer, of length phaseLength+blockSize-1. */
+    const float32_t *pCoeffs;        /**< points to the phase table, of length L*phaseLength. */
+  } arm_resample_poly_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 rational resampler.
+   */
+  typedef struct
+  {
+          uint16_t L;                /**< upsample factor. */
+          uint16_t M;                /**< downsample factor. */
+          uint16_t phaseLength;      /**< taps per phase. */
+          uint16_t phase;            /**< phase of the next output sample, 0 to L-1. */
+          uint32_t inIndex;          /**< input sample of the next output, relative to the next block. */
+          q15_t *pState;             /**< points to the state buffer, of length phaseLength+blockSize-1. */
+    const q15_t *pCoeffs;            /**< points to the phase table, of length L*phaseLength. */
+  } arm_resample_poly_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point fractional resampler.
+   */
+  typedef struct
+  {
+          uint16_t phaseLength;      /**< taps per phase. */
+          uint16_t phaseShift;       /**< log2 of the number of phases in the table. */
+          uint32_t inIndex;          /**< input sample of the next output, relative to the next block. */
+          uint32_t frac;             /**< fractional position of the next output, Q32. */
+          uint32_t stepInt;          /**< integer part of inRate/outRate. */
+          uint32_t stepFrac;         /**< fractional part of inRate/outRate, Q32, rounded down. */
+          uint32_t stepRem;          /**< what stepFrac drops, in 1/outRate of its LSB. */
+          uint32_t outRate;          /**< output sample rate. */
+          uint32_t fracRem;          /**< accumulated stepRem, 0 to outRate-1. */
+          float32_t *pState;         /**< points to the state buffer, of length phaseLength+blockSize-1. */
+    const float32_t *pCoeffs;        /**< points to the phase table, of length (phases+1)*phaseLength. */
+  } arm_resample_frac_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 fractional resampler.
+   */
+  typedef struct
+  {
+          uint16_t phaseLength;      /**< taps per phase. */
+          uint16_t phaseShift;       /**< log2 of the number of phases in the table. */
+          uint32_t inIndex;          /**< input sample of the next output, relative to the next block. */
+          uint32_t frac;             /**< fractional position of the next output, Q32. */
+          uint32_t stepInt;          /**< integer part of inRate/outRate. */
+          uint32_t stepFrac;         /**< fractional part of inRate/outRate, Q32, rounded down. */
+          uint32_t stepRem;          /**< what stepFrac drops, in 1/outRate of its LSB. */
+          uint32_t outRate;          /**< output sample rate. */
+          uint32_t fracRem;          /**< accumulated stepRem, 0 to outRate-1. */
+          q15_t *pState;             /**< points to the state buffer, of length phaseLength+blockSize-1. */
+    const q15_t *pCoeffs;            /**< points to the phase table, of length (phases+1)*phaseLength. */
+  } arm_resample_frac_instance_q15;
+
+  /**
+   * @brief Processing function for the floating-point rational resampler.
+   * @param[in,out] S          points to an instance of the resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of length ARM_RESAMPLE_MAX_OUTPUT.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_resample_poly_f32(
+        arm_resample_poly_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point rational resampler.
+   * @param[in,out] S          points to an instance of the resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     quality    filter quality.
+   * @param[out]    pCoeffs    points to the phase table, of length ARM_RESAMPLE_POLY_COEFFS_SIZE.
+   * @param[in]     pState     points to the state buffer, of length ARM_RESAMPLE_STATE_SIZE.
+   * @param[in]     blockSize  largest number of input samples processed per call.
+   * @return        execution status
+   */
+  arm_status arm_resample_poly_init_f32(
+        arm_resample_poly_instance_f32 * S,
+        uint16_t L,
+        uint16_t M,
+        arm_resample_quality quality,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 rational resampler.
+   * @param[in,out] S          points to an instance of the resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of length ARM_RESAMPLE_MAX_OUTPUT.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_resample_poly_q15(
+        arm_resample_poly_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 rational resampler.
+   * @param[in,out] S          points to an instance of the resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     quality    filter quality.
+   * @param[out]    pCoeffs    points to the phase table, of length ARM_RESAMPLE_POLY_COEFFS_SIZE.
+   * @param[in]     pState     points to the state buffer, of length ARM_RESAMPLE_STATE_SIZE.
+   * @param[in]     blockSize  largest number of input samples processed per call.
+   * @return        execution status
+   */
+  arm_status arm_resample_poly_init_q15(
+        arm_resample_poly_instance_q15 * S,
+        uint16_t L,
+        uint16_t M,
+        arm_resample_quality quality,
+        q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point fractional resampler.
+   * @param[in,out] S          points to an instance of the resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of length ARM_RESAMPLE_MAX_OUTPUT.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_resample_frac_f32(
+        arm_resample_frac_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point fractional resampler.
+   * @param[in,out] S          points to an instance of the resampler structure.
+   * @param[in]     inRate     input sample rate.
+   * @param[in]     outRate    output sample rate.
+   * @param[in]     quality    filter quality.
+   * @param[out]    pCoeffs    points to the phase table, of length ARM_RESAMPLE_FRAC_COEFFS_SIZE.
+   * @param[in]     pState     points to the state buffer, of length ARM_RESAMPLE_STATE_SIZE.
+   * @param[in]     blockSize  largest number of input samples processed per call.
+   * @return        execution status
+   */
+  arm_status arm_resample_frac_init_f32(
+        arm_resample_frac_instance_f32 * S,
+        uint32_t inRate,
+        uint32_t outRate,
+        arm_resample_quality quality,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Changes the conversion ratio of a floating-point fractional resampler.
+   * @param[in,out] S        points to an instance of the resampler structure.
+   * @param[in]     inRate   input sample rate.
+   * @param[in]     outRate  output sample rate.
+   * @return        execution status
+   */
+  arm_status arm_resample_frac_set_rates_f32(
+        arm_resample_frac_instance_f32 * S,
+        uint32_t inRate,
+        uint32_t outRate);
+
+  /**
+   * @brief Processing function for the Q15 fractional resampler.
+   * @param[in,out] S          points to an instance of the resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of length ARM_RESAMPLE_MAX_OUTPUT.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_resample_frac_q15(
+        arm_resample_frac_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 fractional resampler.
+   * @param[in,out] S          points to an instance of the resampler structure.
+   * @param[in]     inRate     input sample rate.
+   * @param[in]     outRate    output sample rate.
+   * @param[in]     quality    filter quality.
+   * @param[out]    pCoeffs    points to the phase table, of length ARM_RESAMPLE_FRAC_COEFFS_SIZE.
+   * @param[in]     pState     points to the state buffer, of length ARM_RESAMPLE_STATE_SIZE.
+   * @param[in]     blockSize  largest number of input samples processed per call.
+   * @return        execution status
+   */
+  arm_status arm_resample_frac_init_q15(
+        arm_resample_frac_instance_q15 * S,
+        uint32_t inRate,
+        uint32_t outRate,
+        arm_resample_quality quality,
+        q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Changes the conversion ratio of a Q15 fractional resampler.
+   * @param[in,out] S        points to an instance of the resampler structure.
+   * @param[in]     inRate   input sample rate.
+   * @param[in]     outRate  output sample rate.
+   * @return        execution status
+   */
+  arm_status arm_resample_frac_set_rates_q15(
+        arm_resample_frac_instance_q15 * S,
+        uint32_t inRate,
+        uint32_t outRate);
+
 
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
@@ -1157,6 +1589,17 @@ arm_status arm_fir_decimate_init_f32(
     const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
   } arm_biquad_cascade_stereo_df2T_instance_f32;
 
+  /**
+   * @brief Instance structure for the N-channel floating-point transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChannels;      /**< number of interleaved channels. */
+          float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    const float32_t *pCoeffs;        /**< points to the array of coefficients, transposed by the init function.  The array is of length 5*numStages*numChannels. */
+  } arm_biquad_cascade_multich_df2T_instance_f32;
+
   /**
    * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
    */
@@ -1251,6 +1694,40 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         float32_t * pState);
 
 
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data, channels interleaved.
+   * @param[out] pDst       points to the block of output data, channels interleaved.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_multich_df2T_f32(
+  const arm_biquad_cascade_multich_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the N-channel floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S                 points to an instance of the filter data structure.
+   * @param[in]     numStages         number of 2nd order stages in the filter.
+   * @param[in]     numChannels       number of interleaved channels.
+   * @param[in]     pCoeffs           points to the filter coefficients, shared or one set per channel.
+   * @param[in]     perChannelCoeffs  1 if pCoeffs has one set of coefficients per channel.
+   * @param[out]    pCoeffsLanes      points to the 5*numStages*numChannels coefficients used by the filter.
+   * @param[in]     pState            points to the state buffer.
+   */
+  void arm_biquad_cascade_multich_df2T_init_f32(
+        arm_biquad_cascade_multich_df2T_instance_f32 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const float32_t * pCoeffs,
+        uint8_t perChannelCoeffs,
+        float32_t * pCoeffsLanes,
+        float32_t * pState);
+
+
   /**
    * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in,out] S          points to an instance of the filter data structure.
@@ -1709,6 +2186,207 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         float32_t mu,
         uint32_t blockSize);
 
+/**
+ * @brief Number of partitions of an echo canceller.
+ */
+#define ARM_AEC_NUM_PARTS(numTaps, partLen) (((uint32_t)(numTaps) + (partLen) - 1U) / (partLen))
+
+/**
+ * @brief Length in float32_t of the state buffer of an echo canceller.
+ */
+#define ARM_AEC_STATE_SIZE(numTaps, partLen) \
+  (4U * (partLen) * ARM_AEC_NUM_PARTS(numTaps, partLen) + 8U * (partLen) + 1U)
+
+  /**
+   * @brief Instance structure for the floating-point PBFDAF acoustic echo canceller.
+   */
+  typedef struct
+  {
+          uint16_t partLen;           /**< partition length, samples per processing step. */
+          uint16_t numParts;          /**< number of partitions of the echo path model. */
+          uint16_t fdlIndex;          /**< slot of the newest far-end spectrum. */
+          uint16_t constrainIndex;    /**< partition constrained at the next step. */
+          float32_t mu;               /**< step size, 0 to 1. */
+          float32_t dtThreshold;      /**< double-talk is declared below this fraction of the echo-only correlation. */
+          float32_t farThreshold;     /**< far-end power per sample below which adaptation stops. */
+          uint16_t dtHangover;        /**< steps adaptation stays frozen after double-talk. */
+          uint16_t dtHold;            /**< steps left in the current freeze. */
+          uint32_t dtMaxSteps;        /**< steps of continuous double-talk taken as an echo path change. */
+          uint32_t dtCount;           /**< steps of continuous double-talk so far. */
+          uint8_t converged;          /**< set once the echo estimate is good enough for the detector. */
+          uint8_t doubleTalk;         /**< double-talk detected in the last step. */
+          float32_t smooth;           /**< smoothing factor of the detector statistics. */
+          float32_t sdd;              /**< smoothed mic power. */
+          float32_t sdy;              /**< smoothed mic / echo estimate cross-power. */
+          float32_t see;              /**< smoothed output power. */
+          float32_t smoothRef;        /**< smoothing factor of the echo-only correlation. */
+          float32_t nccRef;           /**< echo-only level of the mic / echo estimate correlation. */
+          float32_t delta;            /**< regularization of the step normalization. */
+          float32_t *pState;          /**< points to the state buffer, of length ARM_AEC_STATE_SIZE. */
+          arm_rfft_fast_instance_f32 rfft;  /**< real FFT of 2*partLen points. */
+  } arm_aec_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point PBFDAF acoustic echo canceller.
+   * @param[in,out] S          points to an instance of the echo canceller structure.
+   * @param[in]     pRef       points to the block of far-end (loudspeaker) samples.
+   * @param[in]     pMic       points to the block of microphone samples.
+   * @param[out]    pOut       points to the block of echo-cancelled samples.
+   * @param[in]     blockSize  number of samples to process, a multiple of partLen.
+   * @return        execution status
+   */
+  arm_status arm_aec_f32(
+        arm_aec_instance_f32 * S,
+  const float32_t * pRef,
+  const float32_t * pMic,
+        float32_t * pOut,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point PBFDAF acoustic echo canceller.
+   * @param[in,out] S        points to an instance of the echo canceller structure.
+   * @param[in]     numTaps  length of the echo tail in samples.
+   * @param[in]     partLen  partition length, a power of 2 from 16 to 2048.
+   * @param[in]     mu       step size, 0 to 1.
+   * @param[in]     pState   points to the state buffer.
+   * @return        execution status
+   */
+  arm_status arm_aec_init_f32(
+        arm_aec_instance_f32 * S,
+        uint32_t numTaps,
+        uint16_t partLen,
+        float32_t mu,
+        float32_t * pState);
+
+
+/**
+ * @brief FFT length of a noise suppressor: the smallest power of 2 holding two hops.
+ */
+#define ARM_NS_FFT_LEN(hopLen) \
+  ((2U * (hopLen)) <= 32U ? 32U : (2U * (hopLen)) <= 64U ? 64U : \
+   (2U * (hopLen)) <= 128U ? 128U : (2U * (hopLen)) <= 256U ? 256U : \
+   (2U * (hopLen)) <= 512U ? 512U : (2U * (hopLen)) <= 1024U ? 1024U : \
+   (2U * (hopLen)) <= 2048U ? 2048U : 4096U)
+
+/**
+ * @brief Number of frequency bins of a noise suppressor.
+ */
+#define ARM_NS_NUM_BINS(hopLen) (ARM_NS_FFT_LEN(hopLen) / 2U + 1U)
+
+/**
+ * @brief Length in float32_t of the state buffer of a floating-point noise suppressor.
+ */
+#define ARM_NS_STATE_SIZE_F32(hopLen) \
+  (4U * (hopLen) + 6U * ARM_NS_NUM_BINS(hopLen) + 2U * ARM_NS_FFT_LEN(hopLen))
+
+/**
+ * @brief Length in q31_t of the state buffer of a Q15 noise suppressor.
+ */
+#define ARM_NS_STATE_SIZE_Q15(hopLen) \
+  (2U * (hopLen) + 5U * ARM_NS_NUM_BINS(hopLen) + 3U * ARM_NS_FFT_LEN(hopLen))
+
+  /**
+   * @brief Instance structure for the floating-point spectral noise suppressor.
+   */
+  typedef struct
+  {
+          uint16_t hopLen;            /**< samples per frame, half the analysis window. */
+          uint16_t fftLen;            /**< FFT length, ARM_NS_FFT_LEN(hopLen). */
+          uint16_t initFrames;        /**< frames averaged into the first noise estimate. */
+          uint16_t frameCount;        /**< frames processed, saturates at initFrames. */
+          float32_t smooth;           /**< smoothing factor of the magnitude fed to the noise tracker. */
+          float32_t noiseUp;          /**< per-frame growth factor of the noise estimate. */
+          float32_t noiseDown;        /**< smoothing factor of the noise estimate when it falls. */
+          float32_t noiseBias;        /**< ratio of the noise magnitude to its tracked minimum. */
+          float32_t ddAlpha;          /**< weight of the previous frame in the a-priori SNR. */
+          float32_t gainMin;          /**< gain floor, the largest attenuation. */
+          float32_t attack;           /**< smoothing factor of a rising gain. */
+          float32_t release;          /**< smoothing factor of a falling gain. */
+          float32_t meanGain;         /**< mean gain of the last frame. */
+          float32_t *pState;          /**< points to the state buffer, of length ARM_NS_STATE_SIZE_F32. */
+          arm_rfft_fast_instance_f32 rfft;  /**< real FFT of fftLen points. */
+  } arm_noise_suppress_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 spectral noise suppressor.
+   */
+  typedef struct
+  {
+          uint16_t hopLen;            /**< samples per frame, half the analysis window. */
+          uint16_t fftLen;            /**< FFT length, ARM_NS_FFT_LEN(hopLen). */
+          uint16_t initFrames;        /**< frames averaged into the first noise estimate. */
+          uint16_t frameCount;        /**< frames processed, saturates at initFrames. */
+          uint8_t log2FftLen;         /**< log2 of fftLen. */
+          q15_t smooth;               /**< smoothing factor of the magnitude fed to the noise tracker. */
+          q15_t noiseUp;              /**< per-frame growth of the noise estimate, minus one. */
+          q15_t noiseDown;            /**< smoothing factor of the noise estimate when it falls. */
+          q15_t noiseBias;            /**< ratio of the noise magnitude to its tracked minimum, minus one. */
+          q15_t ddAlpha;              /**< weight of the previous frame in the a-priori SNR. */
+          q15_t gainMin;              /**< gain floor, the largest attenuation. */
+          q15_t attack;               /**< smoothing factor of a rising gain. */
+          q15_t release;              /**< smoothing factor of a falling gain. */
+          q15_t meanGain;             /**< mean gain of the last frame. */
+          q31_t *pState;              /**< points to the state buffer, of length ARM_NS_STATE_SIZE_Q15. */
+          arm_rfft_instance_q31 rfft;   /**< real FFT of fftLen points. */
+          arm_rfft_instance_q31 rifft;  /**< real inverse FFT of fftLen points. */
+  } arm_noise_suppress_instance_q15;
+
+  /**
+   * @brief Processing function for the floating-point spectral noise suppressor.
+   * @param[in,out] S          points to an instance of the noise suppressor structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of output samples.
+   * @param[in]     blockSize  number of samples to process, a multiple of hopLen.
+   * @return        execution status
+   */
+  arm_status arm_noise_suppress_f32(
+        arm_noise_suppress_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point spectral noise suppressor.
+   * @param[in,out] S           points to an instance of the noise suppressor structure.
+   * @param[in]     hopLen      samples per frame, 16 to 2048.
+   * @param[in]     sampleRate  sample rate in Hz, sets the time constants.
+   * @param[in]     pState      points to the state buffer.
+   * @return        execution status
+   */
+  arm_status arm_noise_suppress_init_f32(
+        arm_noise_suppress_instance_f32 * S,
+        uint16_t hopLen,
+        uint32_t sampleRate,
+        float32_t * pState);
+
+  /**
+   * @brief Processing function for the Q15 spectral noise suppressor.
+   * @param[in,out] S          points to an instance of the noise suppressor structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of output samples.
+   * @param[in]     blockSize  number of samples to process, a multiple of hopLen.
+   * @return        execution status
+   */
+  arm_status arm_noise_suppress_q15(
+        arm_noise_suppress_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 spectral noise suppressor.
+   * @param[in,out] S           points to an instance of the noise suppressor structure.
+   * @param[in]     hopLen      samples per frame, 16 to 2048.
+   * @param[in]     sampleRate  sample rate in Hz, sets the time constants.
+   * @param[in]     pState      points to the state buffer.
+   * @return        execution status
+   */
+  arm_status arm_noise_suppress_init_q15(
+        arm_noise_suppress_instance_q15 * S,
+        uint16_t hopLen,
+        uint32_t sampleRate,
+        q31_t * pState);
+
 
   /**
    * @brief Instance structure for the Q31 normalized LMS filter.
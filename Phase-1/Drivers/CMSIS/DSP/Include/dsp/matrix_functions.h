@@ -159,6 +159,35 @@ extern "C"
     q31_t *pData;         /**< points to the data of the matrix. */
   } arm_matrix_instance_q31;
 
+  /**
+   * @brief How a general matrix multiplication reads one of its operands.
+   */
+  typedef enum
+  {
+    ARM_MAT_NOTRANS = 0,  /**< use the matrix as stored. */
+    ARM_MAT_TRANS   = 1   /**< use its transpose, without copying it. */
+  } arm_mat_op;
+
+  /**
+   * @brief Instance structure for the floating-point general matrix multiplication.
+   */
+  typedef struct
+  {
+    arm_mat_op opA;       /**< operation applied to the first operand. */
+    arm_mat_op opB;       /**< operation applied to the second operand. */
+    uint32_t numThreads;  /**< thread count for large products, 0 for all CPUs. */
+  } arm_mat_gemm_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 general matrix multiplication.
+   */
+  typedef struct
+  {
+    arm_mat_op opA;       /**< operation applied to the first operand. */
+    arm_mat_op opB;       /**< operation applied to the second operand. */
+    uint32_t numThreads;  /**< thread count for large products, 0 for all CPUs. */
+  } arm_mat_gemm_instance_q31;
+
   /**
    * @brief Floating-point matrix addition.
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -483,6 +512,62 @@ arm_status arm_mat_mult_fast_q31(
   const arm_matrix_instance_q31 * pSrcB,
         arm_matrix_instance_q31 * pDst);
 
+  /**
+   * @brief Initialization function for the floating-point general matrix multiplication
+   * @param[out] S           points to an instance of the GEMM structure
+   * @param[in]  opA         operation applied to the first operand
+   * @param[in]  opB         operation applied to the second operand
+   * @param[in]  numThreads  thread count for large products, 0 for all CPUs
+   */
+void arm_mat_gemm_init_f32(
+  arm_mat_gemm_instance_f32 * S,
+  arm_mat_op opA,
+  arm_mat_op opB,
+  uint32_t numThreads);
+
+  /**
+   * @brief Floating-point general matrix multiplication, pDst = op(pSrcA) * op(pSrcB)
+   * @param[in]  S      points to an instance of the GEMM structure
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_gemm_f32(
+  const arm_mat_gemm_instance_f32 * S,
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Initialization function for the Q31 general matrix multiplication
+   * @param[out] S           points to an instance of the GEMM structure
+   * @param[in]  opA         operation applied to the first operand
+   * @param[in]  opB         operation applied to the second operand
+   * @param[in]  numThreads  thread count for large products, 0 for all CPUs
+   */
+void arm_mat_gemm_init_q31(
+  arm_mat_gemm_instance_q31 * S,
+  arm_mat_op opA,
+  arm_mat_op opB,
+  uint32_t numThreads);
+
+  /**
+   * @brief Q31 general matrix multiplication, pDst = op(pSrcA) * op(pSrcB)
+   * @param[in]  S      points to an instance of the GEMM structure
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_gemm_q31(
+  const arm_mat_gemm_instance_q31 * S,
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+        arm_matrix_instance_q31 * pDst);
+
   /**
    * @brief Floating-point matrix subtraction
    * @param[in]  pSrcA  points to the first input matrix structure
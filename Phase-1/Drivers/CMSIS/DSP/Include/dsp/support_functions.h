@@ -282,7 +282,217 @@ extern "C"
     arm_sort_dir dir,
     float32_t * buffer);
 
- 
+/**
+ * @brief Scratch words (uint64_t) needed by the radix sort of blockSize elements
+ */
+#define ARM_RADIX_SORT_SCRATCH_SIZE(blockSize) (blockSize)
+
+/**
+ * @brief Scratch words (uint64_t) needed by the radix argsort of blockSize elements
+ */
+#define ARM_RADIX_ARGSORT_SCRATCH_SIZE(blockSize) (2U * (blockSize))
+
+/**
+ * @brief Scratch words (uint64_t) needed by a top-k selection
+ */
+#define ARM_TOPK_SCRATCH_SIZE(k) (k)
+
+  /**
+   * @brief Instance structure for the floating-point radix sort, argsort and top-k.
+   */
+  typedef struct
+  {
+    arm_sort_dir dir;        /**< Sorting order (direction) */
+    uint32_t numThreads;     /**< Threads for large arrays, 0 for all CPUs (ARM_MATH_PTHREAD builds) */
+    uint64_t * pScratch;     /**< Working buffer */
+  } arm_radix_sort_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 radix sort, argsort and top-k.
+   */
+  typedef struct
+  {
+    arm_sort_dir dir;        /**< Sorting order (direction) */
+    uint32_t numThreads;     /**< Threads for large arrays, 0 for all CPUs (ARM_MATH_PTHREAD builds) */
+    uint64_t * pScratch;     /**< Working buffer */
+  } arm_radix_sort_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 radix sort, argsort and top-k.
+   */
+  typedef struct
+  {
+    arm_sort_dir dir;        /**< Sorting order (direction) */
+    uint32_t numThreads;     /**< Threads for large arrays, 0 for all CPUs (ARM_MATH_PTHREAD builds) */
+    uint64_t * pScratch;     /**< Working buffer */
+  } arm_radix_sort_instance_q15;
+
+  /**
+   * @param[in,out]  S            points to an instance of the sorting structure.
+   * @param[in]      dir          Sorting order.
+   * @param[in]      numThreads   Threads for large arrays, 0 for all CPUs, 1 for none.
+   * @param[in]      pScratch     Working buffer, see ARM_RADIX_SORT_SCRATCH_SIZE.
+   */
+  void arm_radix_sort_init_f32(
+    arm_radix_sort_instance_f32 * S,
+    arm_sort_dir dir,
+    uint32_t numThreads,
+    uint64_t * pScratch);
+
+  /**
+   * @param[in,out]  S            points to an instance of the sorting structure.
+   * @param[in]      dir          Sorting order.
+   * @param[in]      numThreads   Threads for large arrays, 0 for all CPUs, 1 for none.
+   * @param[in]      pScratch     Working buffer, see ARM_RADIX_SORT_SCRATCH_SIZE.
+   */
+  void arm_radix_sort_init_q31(
+    arm_radix_sort_instance_q31 * S,
+    arm_sort_dir dir,
+    uint32_t numThreads,
+    uint64_t * pScratch);
+
+  /**
+   * @param[in,out]  S            points to an instance of the sorting structure.
+   * @param[in]      dir          Sorting order.
+   * @param[in]      numThreads   Threads for large arrays, 0 for all CPUs, 1 for none.
+   * @param[in]      pScratch     Working buffer, see ARM_RADIX_SORT_SCRATCH_SIZE.
+   */
+  void arm_radix_sort_init_q15(
+    arm_radix_sort_instance_q15 * S,
+    arm_sort_dir dir,
+    uint32_t numThreads,
+    uint64_t * pScratch);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_sort_f32(
+    const arm_radix_sort_instance_f32 * S,
+    const float32_t * pSrc,
+          float32_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_sort_q31(
+    const arm_radix_sort_instance_q31 * S,
+    const q31_t * pSrc,
+          q31_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_sort_q15(
+    const arm_radix_sort_instance_q15 * S,
+    const q15_t * pSrc,
+          q15_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the sorted data, or NULL for indices only.
+   * @param[out] pIndex     points to the indices of the sorted data in pSrc.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_argsort_f32(
+    const arm_radix_sort_instance_f32 * S,
+    const float32_t * pSrc,
+          float32_t * pDst,
+          uint32_t * pIndex,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the sorted data, or NULL for indices only.
+   * @param[out] pIndex     points to the indices of the sorted data in pSrc.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_argsort_q31(
+    const arm_radix_sort_instance_q31 * S,
+    const q31_t * pSrc,
+          q31_t * pDst,
+          uint32_t * pIndex,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the sorted data, or NULL for indices only.
+   * @param[out] pIndex     points to the indices of the sorted data in pSrc.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_argsort_q15(
+    const arm_radix_sort_instance_q15 * S,
+    const q15_t * pSrc,
+          q15_t * pDst,
+          uint32_t * pIndex,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  blockSize  number of samples in pSrc.
+   * @param[in]  k          number of elements to select.
+   * @param[out] pDst       points to the selected values, or NULL.
+   * @param[out] pIndex     points to their indices in pSrc, or NULL.
+   * @return     number of elements written, min(k, blockSize).
+   */
+  uint32_t arm_topk_f32(
+    const arm_radix_sort_instance_f32 * S,
+    const float32_t * pSrc,
+          uint32_t blockSize,
+          uint32_t k,
+          float32_t * pDst,
+          uint32_t * pIndex);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  blockSize  number of samples in pSrc.
+   * @param[in]  k          number of elements to select.
+   * @param[out] pDst       points to the selected values, or NULL.
+   * @param[out] pIndex     points to their indices in pSrc, or NULL.
+   * @return     number of elements written, min(k, blockSize).
+   */
+  uint32_t arm_topk_q31(
+    const arm_radix_sort_instance_q31 * S,
+    const q31_t * pSrc,
+          uint32_t blockSize,
+          uint32_t k,
+          q31_t * pDst,
+          uint32_t * pIndex);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  blockSize  number of samples in pSrc.
+   * @param[in]  k          number of elements to select.
+   * @param[out] pDst       points to the selected values, or NULL.
+   * @param[out] pIndex     points to their indices in pSrc, or NULL.
+   * @return     number of elements written, min(k, blockSize).
+   */
+  uint32_t arm_topk_q15(
+    const arm_radix_sort_instance_q15 * S,
+    const q15_t * pSrc,
+          uint32_t blockSize,
+          uint32_t k,
+          q15_t * pDst,
+          uint32_t * pIndex);
+
+
  
   /**
    * @brief  Copies the elements of a floating-point vector.
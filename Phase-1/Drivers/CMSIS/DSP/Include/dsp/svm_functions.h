@@ -41,6 +41,23 @@ extern "C"
 
 #define STEP(x) (x) <= 0 ? 0 : 1
 
+/**
+ * @brief Input vectors scored together by the batched predictions
+ */
+#define ARM_SVM_BATCH_BLOCK 16U
+
+/**
+ * @brief Scratch length, in float32_t, of arm_svm_linear_predict_batch_f32()
+ */
+#define ARM_SVM_LINEAR_BATCH_SCRATCH_SIZE(vectorDimension) (vectorDimension)
+
+/**
+ * @brief Scratch length, in float32_t, of arm_svm_rbf_predict_batch_f32()
+ */
+#define ARM_SVM_RBF_BATCH_SCRATCH_SIZE(nbOfSupportVectors, vectorDimension) \
+  ((ARM_SVM_BATCH_BLOCK + 1U) * (nbOfSupportVectors) + ARM_SVM_BATCH_BLOCK + \
+   ((nbOfSupportVectors) + ARM_SVM_BATCH_BLOCK + 1U) * (vectorDimension))
+
 /**
  * @defgroup groupSVM SVM Functions
  * This set of functions is implementing SVM classification on 2 classes.
@@ -172,6 +189,22 @@ void arm_svm_linear_predict_f32(const arm_svm_linear_instance_f32 *S,
    const float32_t * in, 
    int32_t * pResult);
 
+/**
+ * @brief SVM linear prediction of a batch of vectors
+ * @param[in]    S           Pointer to an instance of the linear SVM structure.
+ * @param[in]    pIn         Pointer to numVectors input vectors, one after the other
+ * @param[in]    numVectors  Number of input vectors
+ * @param[in]    pScratch    Working buffer of ARM_SVM_LINEAR_BATCH_SCRATCH_SIZE(vectorDimension) values
+ * @param[out]   pResult     Decision value of each vector
+ * @return none.
+ *
+ */
+void arm_svm_linear_predict_batch_f32(const arm_svm_linear_instance_f32 *S,
+   const float32_t * pIn,
+   uint32_t numVectors,
+   float32_t * pScratch,
+   int32_t * pResult);
+
 
 /**
  * @brief        SVM polynomial instance init function
@@ -251,6 +284,22 @@ void arm_svm_rbf_predict_f32(const arm_svm_rbf_instance_f32 *S,
    const float32_t * in, 
    int32_t * pResult);
 
+/**
+ * @brief SVM rbf prediction of a batch of vectors
+ * @param[in]    S           Pointer to an instance of the rbf SVM structure.
+ * @param[in]    pIn         Pointer to numVectors input vectors, one after the other
+ * @param[in]    numVectors  Number of input vectors
+ * @param[in]    pScratch    Working buffer of ARM_SVM_RBF_BATCH_SCRATCH_SIZE(nbOfSupportVectors, vectorDimension) values
+ * @param[out]   pResult     Decision value of each vector
+ * @return none.
+ *
+ */
+void arm_svm_rbf_predict_batch_f32(const arm_svm_rbf_instance_f32 *S,
+   const float32_t * pIn,
+   uint32_t numVectors,
+   float32_t * pScratch,
+   int32_t * pResult);
+
 /**
  * @brief        SVM sigmoid instance init function
  * @param[in]    S                      points to an instance of the rbf SVM structure.
@@ -446,6 +446,113 @@ arm_status arm_rfft_fast_init_f32 (
         float32_t * p, float32_t * pOut,
         uint8_t ifftFlag);
 
+/**
+ * @brief Target size in bytes of the group of frames a batched FFT
+ * transforms together. Size it to the data cache of the core.
+ */
+#ifndef ARM_FFT_BATCH_TILE_BYTES
+#define ARM_FFT_BATCH_TILE_BYTES 32768U
+#endif
+
+/**
+ * @brief Minimum number of frames a batched FFT transforms together.
+ */
+#ifndef ARM_FFT_BATCH_MIN_FRAMES
+#define ARM_FFT_BATCH_MIN_FRAMES 8U
+#endif
+
+  /**
+   * @brief Memory layout of the frames of a batched FFT.
+   */
+  typedef enum
+  {
+    ARM_FFT_BATCH_CONTIGUOUS = 0,   /**< each frame contiguous, frames a stride apart */
+    ARM_FFT_BATCH_INTERLEAVED = 1   /**< value n of frame f at n * numFrames + f */
+  } arm_fft_batch_layout;
+
+  /**
+   * @brief Processing function for the batched floating-point complex FFT.
+   * @param[in]     S            points to an instance of the floating-point CFFT structure
+   * @param[in,out] p            points to the frames. Processing occurs in-place
+   * @param[in]     numFrames    number of frames
+   * @param[in]     frameStride  distance in float32_t between frames (contiguous layout)
+   * @param[in]     layout       memory layout of the frames
+   * @param[in]     ifftFlag     flag that selects transform direction
+   * @return        execution status
+   */
+  arm_status arm_cfft_batch_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p,
+        uint32_t numFrames,
+        uint32_t frameStride,
+        arm_fft_batch_layout layout,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Processing function for the batched floating-point real FFT.
+   * @param[in]     S          points to an arm_rfft_fast_instance_f32 structure
+   * @param[in,out] pSrc       points to the input frames (modified by this function)
+   * @param[out]    pDst       points to the output frames
+   * @param[in]     numFrames  number of frames
+   * @param[in]     srcStride  distance in float32_t between input frames (contiguous layout)
+   * @param[in]     dstStride  distance in float32_t between output frames (contiguous layout)
+   * @param[in]     layout     memory layout of the frames
+   * @param[in]     ifftFlag   0 for RFFT, 1 for RIFFT
+   * @return        execution status
+   */
+  arm_status arm_rfft_fast_batch_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numFrames,
+        uint32_t srcStride,
+        uint32_t dstStride,
+        arm_fft_batch_layout layout,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point STFT.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 rfft;  /**< real FFT of fftLen points. */
+    const float32_t *pWindow;         /**< window of winLen coefficients, NULL for rectangular. */
+    uint16_t fftLen;                  /**< length of the FFT. */
+    uint16_t winLen;                  /**< samples per frame, zero-padded to fftLen. */
+    uint16_t hopLen;                  /**< samples between frame starts. */
+  } arm_stft_instance_f32;
+
+  /**
+   * @brief Initialization function for the floating-point STFT.
+   * @param[out] S        points to an arm_stft_instance_f32 structure
+   * @param[in]  fftLen   length of the real FFT
+   * @param[in]  winLen   samples per frame, at most fftLen
+   * @param[in]  hopLen   samples between the starts of consecutive frames
+   * @param[in]  pWindow  window coefficients, or NULL
+   * @return     execution status
+   */
+  arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t winLen,
+  uint16_t hopLen,
+  const float32_t * pWindow);
+
+  /**
+   * @brief Processing function for the floating-point STFT.
+   * @param[in]  S          points to an arm_stft_instance_f32 structure
+   * @param[in]  pSrc       points to the signal
+   * @param[in]  numFrames  number of frames
+   * @param[out] pDst       points to numFrames packed spectra of fftLen values
+   * @param[in]  pScratch   points to fftLen * ARM_FFT_BATCH_MIN_FRAMES values of scratch
+   */
+  void arm_stft_f32(
+  const arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t numFrames,
+        float32_t * pDst,
+        float32_t * pScratch);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -727,6 +834,96 @@ arm_status arm_mfcc_init_q15(
   q31_t *pTmp
   );
 
+/**
+ * @brief Length in q31_t of the state buffer of a streaming Q15 log-mel extractor.
+ */
+#define ARM_LOGMEL_STREAM_STATE_SIZE_Q15(fftLen, winLen, nbMelFilters) \
+  ((3U * (fftLen) + (winLen) + (nbMelFilters) + 1U) / 2U + (nbMelFilters))
+
+  /**
+   * @brief Instance structure for the streaming Q15 log-mel extractor.
+   */
+  typedef struct
+  {
+     const q15_t *dctCoefs;           /**< DCT coefficients, NULL for log-mel rows. */
+     const q15_t *filterCoefs;        /**< Mel filter coefficients. */
+     const q15_t *windowCoefs;        /**< window of winLen coefficients. */
+     const uint32_t *filterPos;       /**< first FFT bin of each Mel filter. */
+     const uint32_t *filterLengths;   /**< number of bins of each Mel filter. */
+     uint16_t fftLen;                 /**< FFT length. */
+     uint16_t winLen;                 /**< samples per frame, zero-padded to fftLen. */
+     uint16_t hopLen;                 /**< samples between frame starts. */
+     uint16_t fill;                   /**< samples in the frame buffer. */
+     uint16_t nbMelFilters;           /**< number of Mel filters. */
+     uint16_t rowLen;                 /**< values per feature row: nbDctOutputs, or nbMelFilters without DCT. */
+     uint16_t numRows;                /**< rows of the feature matrix. */
+     uint8_t adcBits;                 /**< resolution of the samples read by arm_logmel_stream_adc_q15. */
+     q15_t dcCoef;                    /**< pole of the DC blocker of arm_logmel_stream_adc_q15. */
+     q31_t dcIn;                      /**< DC blocker: previous input. */
+     q31_t dcOut;                     /**< DC blocker: previous output, Q15 with 12 more fractional bits. */
+     q15_t *pFeatures;                /**< feature matrix, numRows x rowLen, oldest row first. */
+     q31_t *pState;                   /**< state buffer, of length ARM_LOGMEL_STREAM_STATE_SIZE_Q15. */
+     arm_rfft_instance_q15 rfft;      /**< real FFT of fftLen points. */
+  } arm_logmel_stream_instance_q15;
+
+  /**
+   * @brief Initialization function for the streaming Q15 log-mel extractor.
+   * @param[out] S              points to the extractor instance
+   * @param[in]  fftLen         FFT length
+   * @param[in]  winLen         samples per frame, at most fftLen
+   * @param[in]  hopLen         samples between frame starts, at most winLen
+   * @param[in]  nbMelFilters   number of Mel filters
+   * @param[in]  nbDctOutputs   number of DCT outputs, ignored without DCT
+   * @param[in]  dctCoefs       DCT coefficients, or NULL for log-mel rows
+   * @param[in]  filterPos      first FFT bin of each Mel filter
+   * @param[in]  filterLengths  number of bins of each Mel filter
+   * @param[in]  filterCoefs    Mel filter coefficients
+   * @param[in]  windowCoefs    window of winLen coefficients
+   * @param[in]  pFeatures      feature matrix of numRows x rowLen values
+   * @param[in]  numRows        rows of the feature matrix
+   * @param[in]  pState         state buffer
+   * @return     execution status
+   */
+  arm_status arm_logmel_stream_init_q15(
+  arm_logmel_stream_instance_q15 * S,
+  uint32_t fftLen,
+  uint32_t winLen,
+  uint32_t hopLen,
+  uint32_t nbMelFilters,
+  uint32_t nbDctOutputs,
+  const q15_t *dctCoefs,
+  const uint32_t *filterPos,
+  const uint32_t *filterLengths,
+  const q15_t *filterCoefs,
+  const q15_t *windowCoefs,
+  q15_t *pFeatures,
+  uint32_t numRows,
+  q31_t *pState);
+
+  /**
+   * @brief Streaming Q15 log-mel extractor, signed Q15 samples.
+   * @param[in,out] S          points to the extractor instance
+   * @param[in]     pSrc       points to the block of samples
+   * @param[in]     blockSize  number of samples, any length
+   * @return        number of feature rows added to the matrix
+   */
+  uint32_t arm_logmel_stream_q15(
+  arm_logmel_stream_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief Streaming Q15 log-mel extractor, unsigned right-aligned ADC samples.
+   * @param[in,out] S          points to the extractor instance
+   * @param[in]     pSrc       points to the block of ADC samples of adcBits bits
+   * @param[in]     blockSize  number of samples, any length
+   * @return        number of feature rows added to the matrix
+   */
+  uint32_t arm_logmel_stream_adc_q15(
+  arm_logmel_stream_instance_q15 * S,
+  const uint16_t * pSrc,
+  uint32_t blockSize);
+
 
 #ifdef   __cplusplus
 }
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * @file     x86_functions.h
+ * @brief    Public header file for the x86 SIMD backend of CMSIS DSP Library
+ *
+ * Target Processor: x86-64 hosts
+ ******************************************************************************/
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _X86_FUNCTIONS_H_
+#define _X86_FUNCTIONS_H_
+
+#include "arm_math_types.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+#if defined(ARM_MATH_X86)
+
+/**
+ * @defgroup groupX86 x86 SIMD Backend
+ *
+ * When the library is built with ARM_MATH_X86, the hottest f32 kernels
+ * (arm_fir_f32, arm_biquad_cascade_df2T_f32, arm_cfft_f32, arm_dot_prod_f32,
+ * arm_mat_mult_f32 and arm_cmplx_mag_f32) select an SSE2 or AVX2+FMA
+ * implementation at run time. The public API is unchanged.
+ *
+ * The level is detected from CPUID on first use. It can be lowered with the
+ * environment variable ARM_MATH_X86_LEVEL (scalar, sse2 or avx2) or with
+ * arm_x86_set_level(), which is how the SIMD paths are compared against the
+ * portable C reference.
+ */
+
+/**
+ * @brief x86 code path levels, in increasing order of capability.
+ */
+typedef enum
+{
+  ARM_X86_LEVEL_SCALAR = 0,   /**< Portable C reference implementation */
+  ARM_X86_LEVEL_SSE2   = 1,   /**< SSE2 (baseline for x86-64) */
+  ARM_X86_LEVEL_AVX2   = 2    /**< AVX2 + FMA */
+} arm_x86_level;
+
+/**
+ * @brief  Code path level in use.
+ * @return level selected by CPU detection, the environment or arm_x86_set_level()
+ */
+arm_x86_level arm_x86_get_level(void);
+
+/**
+ * @brief  Force a code path level.
+ * @param[in] level  requested level. It is clamped to what the CPU supports.
+ * @return level actually selected
+ */
+arm_x86_level arm_x86_set_level(arm_x86_level level);
+
+#endif /* defined(ARM_MATH_X86) */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ifndef _X86_FUNCTIONS_H_ */
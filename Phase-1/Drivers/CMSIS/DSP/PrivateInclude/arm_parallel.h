@@ -0,0 +1,108 @@
+/******************************************************************************
+ * @file     arm_parallel.h
+ * @brief    Private header file for the multithreaded kernels of CMSIS DSP Library
+ *
+ * Target Processor: Linux hosts (POSIX threads)
+ ******************************************************************************/
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_PARALLEL_H_
+#define _ARM_PARALLEL_H_
+
+#include "arm_math.h"
+
+#if defined(ARM_MATH_PTHREAD)
+#include <pthread.h>
+#endif
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Without ARM_MATH_PTHREAD everything below still compiles: a team always
+ * has one part, run by the caller, and synchronisation is a no-op. Kernels
+ * are written once against this interface.
+ */
+
+/**
+ * @brief Largest team size
+ */
+#define ARM_PARALLEL_MAX_THREADS 32U
+
+/**
+ * @brief Parts of one parallel region
+ */
+typedef struct
+{
+  uint32_t numParts;             /**< Parts running the region, caller included */
+#if defined(ARM_MATH_PTHREAD)
+  pthread_barrier_t barrier;     /**< Used by arm_parallel_sync() */
+#endif
+} arm_parallel_team;
+
+/**
+ * @brief Body of a parallel region
+ * @param[in]     arg   user data shared by all parts
+ * @param[in]     team  team running the region
+ * @param[in]     part  index of this part, 0 to team->numParts - 1
+ */
+typedef void (*arm_parallel_fn)(void * arg, arm_parallel_team * team, uint32_t part);
+
+/**
+ * @brief  Number of parts worth using for a job
+ * @param[in]  requested  thread count asked for, 0 for all online CPUs
+ * @param[in]  work       amount of work (elements, rows, ...)
+ * @param[in]  minWork    least work that pays for one more thread
+ * @return     team size, 1 when built without ARM_MATH_PTHREAD
+ */
+uint32_t arm_parallel_threads(
+  uint32_t requested,
+  uint32_t work,
+  uint32_t minWork);
+
+/**
+ * @brief  Run a region on numParts parts and wait for all of them
+ * @param[in]  fn        region body
+ * @param[in]  arg       user data passed to every part
+ * @param[in]  numParts  requested team size
+ *
+ * The caller runs part 0, the other parts run on a pool of worker threads
+ * created on first use and kept for later regions. The team can be smaller
+ * than requested: if workers cannot be created, or the pool is already
+ * running a region (concurrent or nested calls), the region runs on fewer
+ * parts, down to a team of one. The body must read team->numParts rather
+ * than assume the requested size.
+ */
+void arm_parallel_run(
+  arm_parallel_fn fn,
+  void * arg,
+  uint32_t numParts);
+
+/**
+ * @brief  Wait until every part of the team has reached this point
+ * @param[in]  team  team running the region
+ */
+void arm_parallel_sync(
+  arm_parallel_team * team);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_PARALLEL_H_ */
@@ -104,6 +104,57 @@ extern "C"
           float32_t * pDst,
           uint32_t blockSize);
 
+  /**
+   * @brief Element type handled by the radix sort and top-k core
+   */
+  typedef enum
+  {
+    ARM_SORT_KEY_F32 = 0,
+    ARM_SORT_KEY_Q31 = 1,
+    ARM_SORT_KEY_Q15 = 2
+  } arm_sort_key_type;
+
+  /**
+   * @param[in]  type        element type of pSrc and pDst.
+   * @param[in]  dir         sorting order.
+   * @param[in]  numThreads  thread count for large arrays, 0 for all CPUs.
+   * @param[in]  pSrc        points to the block of input data.
+   * @param[out] pDst        points to the sorted data, may be NULL when pIndex is not.
+   * @param[out] pIndex      points to the sorted indices, NULL for a plain sort.
+   * @param[in]  pScratch    working buffer, blockSize words (2 * blockSize with pIndex).
+   * @param[in]  blockSize   number of samples to process.
+   */
+  void arm_radix_sort_core(
+    arm_sort_key_type type,
+    arm_sort_dir dir,
+    uint32_t numThreads,
+    const void * pSrc,
+          void * pDst,
+          uint32_t * pIndex,
+          uint64_t * pScratch,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]  type        element type of pSrc and pDst.
+   * @param[in]  dir         order of the selection, descending for the k largest.
+   * @param[in]  pSrc        points to the block of input data.
+   * @param[in]  blockSize   number of samples in pSrc.
+   * @param[in]  k           number of elements to select.
+   * @param[out] pDst        points to the k selected values, may be NULL.
+   * @param[out] pIndex      points to their k indices, may be NULL.
+   * @param[in]  pHeap       working buffer of k words.
+   * @return     number of elements written, min(k, blockSize).
+   */
+  uint32_t arm_topk_core(
+    arm_sort_key_type type,
+    arm_sort_dir dir,
+    const void * pSrc,
+          uint32_t blockSize,
+          uint32_t k,
+          void * pDst,
+          uint32_t * pIndex,
+          uint64_t * pHeap);
+
 #if defined(ARM_MATH_NEON)
 
 #define vtrn256_128q(a, b)                   \
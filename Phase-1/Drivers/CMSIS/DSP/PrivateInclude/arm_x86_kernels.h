@@ -0,0 +1,127 @@
+/******************************************************************************
+ * @file     arm_x86_kernels.h
+ * @brief    Private header file for the x86 SIMD backend of CMSIS DSP Library
+ *
+ * Target Processor: x86-64 hosts
+ ******************************************************************************/
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_X86_KERNELS_H_
+#define _ARM_X86_KERNELS_H_
+
+#include "arm_math.h"
+
+#if defined(ARM_MATH_X86)
+
+#include <immintrin.h>
+
+/*
+ * The library is compiled for the x86-64 baseline (SSE2). AVX2 kernels are
+ * compiled per function with a target attribute and only called after
+ * arm_x86_get_level() has confirmed the CPU supports them.
+ */
+#define ARM_X86_TARGET_AVX2 __attribute__((target("avx2,fma")))
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+  void arm_fir_f32_sse2(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  void arm_fir_f32_avx2(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  void arm_biquad_cascade_df2T_f32_avx2(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  void arm_cfft_f32_avx2(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag);
+
+  void arm_dot_prod_f32_sse2(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result);
+
+  void arm_dot_prod_f32_avx2(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result);
+
+  void arm_mat_mult_f32_sse2(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  void arm_mat_mult_f32_avx2(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  void arm_mat_gemm_kernel_f32_avx2(
+  uint32_t kc,
+  const float32_t * pA,
+        uint32_t rsA,
+        uint32_t csA,
+  const float32_t * pPanel,
+        float32_t * pC,
+        uint32_t ldc,
+        uint32_t mr,
+        uint32_t nr,
+        uint32_t accumulate);
+
+  void arm_cmplx_mag_f32_sse2(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numSamples);
+
+  void arm_cmplx_mag_f32_avx2(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numSamples);
+
+  void arm_vexp_f32_sse2(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  void arm_vexp_f32_avx2(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* defined(ARM_MATH_X86) */
+
+#endif /* _ARM_X86_KERNELS_H_ */
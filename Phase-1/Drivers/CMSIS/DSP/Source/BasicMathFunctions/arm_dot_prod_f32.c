@@ -28,6 +28,10 @@
 
 #include "dsp/basic_math_functions.h"
 
+#if defined(ARM_MATH_X86)
+#include "arm_x86_kernels.h"
+#endif
+
 /**
   @ingroup groupMath
  */
@@ -128,6 +132,19 @@ void arm_dot_prod_f32(
         uint32_t blkCnt;                               /* Loop counter */
         float32_t sum = 0.0f;                          /* Temporary return variable */
 
+#if defined(ARM_MATH_X86)
+  if (arm_x86_get_level() >= ARM_X86_LEVEL_AVX2)
+  {
+    arm_dot_prod_f32_avx2(pSrcA, pSrcB, blockSize, result);
+    return;
+  }
+  if (arm_x86_get_level() >= ARM_X86_LEVEL_SSE2)
+  {
+    arm_dot_prod_f32_sse2(pSrcA, pSrcB, blockSize, result);
+    return;
+  }
+#endif
+
 #if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
     f32x4_t vec1;
     f32x4_t vec2;
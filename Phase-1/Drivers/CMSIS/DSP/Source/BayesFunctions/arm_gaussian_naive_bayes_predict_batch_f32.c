@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_predict_batch_f32.c
+ * Description:  Naive Gaussian Bayesian Estimator, batch of vectors
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/bayes_functions.h"
+#include "dsp/matrix_functions.h"
+#include "dsp/statistics_functions.h"
+#include <math.h>
+
+#define BATCH_DPI_F (2.0f*3.1415926535897932384626433832795f)
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Naive Gaussian Bayesian Estimator for a batch of vectors
+ *
+ * @param[in]   *S                      points to a naive bayes instance structure
+ * @param[in]   *pIn                    points to numVectors input vectors, one after the other
+ * @param[in]   numVectors              number of input vectors
+ * @param[out]  *pOutputProbabilities   points to numVectors x numberOfClasses estimated log probabilities, or NULL
+ * @param[in]   *pScratch               points to a working buffer of
+ *                                      ARM_GAUSSIAN_NAIVE_BAYES_BATCH_SCRATCH_SIZE(vectorDimension, numberOfClasses) values
+ * @param[out]  *pResult                points to the predicted class of each vector
+ * @return none
+ *
+ * The inputs are first shifted by a reference ref, the mean of the class
+ * means, so that with u = x - ref and delta = theta - ref the expanded
+ * square of the Gaussian log likelihood,
+ * <pre>
+ *     -0.5 sum_d (u - delta)^2 / sigma = sum_d u^2 (-0.5 / sigma) + sum_d u (delta / sigma) - 0.5 sum_d delta^2 / sigma
+ * </pre>
+ * does not cancel when the features have a large mean. The class scores
+ * of a vector are the product of [u^2 | u] with a numberOfClasses x
+ * (2 vectorDimension) weight matrix, plus a per class constant. Weights,
+ * constants and the logf() calls are computed once per call, then
+ * ARM_GAUSSIAN_NAIVE_BAYES_BATCH_BLOCK vectors at a time are scored with
+ * one arm_mat_gemm_f32().
+ *
+ * Results match arm_gaussian_naive_bayes_predict_f32() up to rounding:
+ * classes whose scores are within a few ulp of each other can swap.
+ */
+void arm_gaussian_naive_bayes_predict_batch_f32(const arm_gaussian_naive_bayes_instance_f32 *S,
+   const float32_t * pIn,
+   uint32_t numVectors,
+   float32_t *pOutputProbabilities,
+   float32_t *pScratch,
+   uint32_t *pResult)
+{
+    uint32_t dim = S->vectorDimension;
+    uint32_t numClasses = S->numberOfClasses;
+    float32_t *pWeights = pScratch;
+    float32_t *pConst = pWeights + numClasses * 2U * dim;
+    float32_t *pRef = pConst + numClasses;
+    float32_t *pFeatures = pRef + dim;
+    float32_t *pScores = pFeatures + ARM_GAUSSIAN_NAIVE_BAYES_BATCH_BLOCK * 2U * dim;
+    arm_mat_gemm_instance_f32 gemm;
+    arm_matrix_instance_f32 matW, matZ, matScores;
+    const float32_t *pTheta = S->theta;
+    const float32_t *pSigma = S->sigma;
+    float32_t *pW = pWeights;
+    float32_t *pBlockScores;
+    float32_t sigma, delta, acc, result;
+    uint32_t nbClass, nbDim, done, nb, r, index;
+
+    /* ref is the mean of the class means */
+    for (nbDim = 0; nbDim < dim; nbDim++)
+    {
+        acc = 0.0f;
+        for (nbClass = 0; nbClass < numClasses; nbClass++)
+        {
+            acc += pTheta[nbClass * dim + nbDim];
+        }
+        pRef[nbDim] = acc / (float32_t) numClasses;
+    }
+
+    /* Row c of W is [-0.5 / sigma | (theta - ref) / sigma] */
+    for (nbClass = 0; nbClass < numClasses; nbClass++)
+    {
+        acc = 0.0f;
+        for (nbDim = 0; nbDim < dim; nbDim++)
+        {
+           sigma = *pSigma++ + S->epsilon;
+           delta = *pTheta++ - pRef[nbDim];
+           pW[nbDim] = -0.5f / sigma;
+           pW[dim + nbDim] = delta / sigma;
+           acc += logf(BATCH_DPI_F * sigma) + delta * delta / sigma;
+        }
+        pConst[nbClass] = logf(S->classPriors[nbClass]) - 0.5f * acc;
+        pW += 2U * dim;
+    }
+
+    arm_mat_gemm_init_f32(&gemm, ARM_MAT_NOTRANS, ARM_MAT_TRANS, 1U);
+    arm_mat_init_f32(&matW, (uint16_t) numClasses, (uint16_t) (2U * dim), pWeights);
+
+    for (done = 0; done < numVectors; done += nb)
+    {
+        nb = numVectors - done;
+        if (nb > ARM_GAUSSIAN_NAIVE_BAYES_BATCH_BLOCK)
+        {
+            nb = ARM_GAUSSIAN_NAIVE_BAYES_BATCH_BLOCK;
+        }
+
+        /* Row r of Z is [u^2 | u], u = x - ref */
+        for (r = 0; r < nb; r++)
+        {
+            float32_t *pZ = pFeatures + r * 2U * dim;
+
+            for (nbDim = 0; nbDim < dim; nbDim++)
+            {
+                delta = pIn[nbDim] - pRef[nbDim];
+                pZ[nbDim] = delta * delta;
+                pZ[dim + nbDim] = delta;
+            }
+            pIn += dim;
+        }
+
+        pBlockScores = (pOutputProbabilities != NULL) ?
+                       pOutputProbabilities + done * numClasses : pScores;
+
+        arm_mat_init_f32(&matZ, (uint16_t) nb, (uint16_t) (2U * dim), pFeatures);
+        arm_mat_init_f32(&matScores, (uint16_t) nb, (uint16_t) numClasses, pBlockScores);
+        (void) arm_mat_gemm_f32(&gemm, &matZ, &matW, &matScores);
+
+        for (r = 0; r < nb; r++)
+        {
+            float32_t *pRow = pBlockScores + r * numClasses;
+
+            for (nbClass = 0; nbClass < numClasses; nbClass++)
+            {
+                pRow[nbClass] += pConst[nbClass];
+            }
+            arm_max_f32(pRow, numClasses, &result, &index);
+            pResult[done + r] = index;
+        }
+    }
+}
+
+/**
+ * @} end of groupBayes group
+ */
@@ -28,6 +28,10 @@
 
 #include "dsp/complex_math_functions.h"
 
+#if defined(ARM_MATH_X86)
+#include "arm_x86_kernels.h"
+#endif
+
 /**
   @ingroup groupCmplxMath
  */
@@ -161,6 +165,19 @@ void arm_cmplx_mag_f32(
   uint32_t blkCnt;                               /* loop counter */
   float32_t real, imag;                      /* Temporary variables to hold input values */
 
+#if defined(ARM_MATH_X86)
+  if (arm_x86_get_level() >= ARM_X86_LEVEL_AVX2)
+  {
+    arm_cmplx_mag_f32_avx2(pSrc, pDst, numSamples);
+    return;
+  }
+  if (arm_x86_get_level() >= ARM_X86_LEVEL_SSE2)
+  {
+    arm_cmplx_mag_f32_sse2(pSrc, pDst, numSamples);
+    return;
+  }
+#endif
+
 #if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
 
   float32x4x2_t vecA;
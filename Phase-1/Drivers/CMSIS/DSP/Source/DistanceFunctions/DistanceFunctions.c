@@ -37,11 +37,15 @@
 #include "arm_cosine_distance_f32.c"
 #include "arm_cosine_distance_f64.c"
 #include "arm_dice_distance.c"
+#include "arm_distance_matrix_f32.c"
+#include "arm_distance_matrix_init_f32.c"
 #include "arm_euclidean_distance_f32.c"
 #include "arm_euclidean_distance_f64.c"
 #include "arm_hamming_distance.c"
 #include "arm_jaccard_distance.c"
 #include "arm_jensenshannon_distance_f32.c"
+#include "arm_knn_f32.c"
+#include "arm_knn_init_f32.c"
 #include "arm_kulsinski_distance.c"
 #include "arm_minkowski_distance_f32.c"
 #include "arm_rogerstanimoto_distance.c"
@@ -0,0 +1,429 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_distance_matrix_f32.c
+ * Description:  Tiled distance matrix between two sets of floating-point vectors
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/distance_functions.h"
+#include "arm_parallel.h"
+#include <math.h>
+
+/**
+  @ingroup groupDistance
+ */
+
+/**
+  @defgroup DistanceMatrix Distance matrix
+
+  Distances between every vector of a set A and every vector of a set B,
+  for template matching, clustering and nearest-neighbour search.
+
+  The output is computed in tiles of ARM_DISTANCE_TILE x ARM_DISTANCE_TILE
+  pairs, so the B rows of a tile stay in cache while all A rows of the tile
+  go past them, and each tile is swept four A rows by four B rows at a
+  time, so every loaded value is used four times.
+
+  The Euclidean, squared Euclidean and cosine distances are computed from
+  the dot products a.b and the norms of the vectors, which are computed
+  once per call:
+  <pre>
+      |a - b|^2 = |a|^2 + |b|^2 - 2 a.b
+  </pre>
+  This is a matrix product and costs one multiply-accumulate per element
+  instead of a subtraction and a multiply-accumulate. The squares cancel
+  when the vectors lie far from the origin compared to their spread (a
+  feature with a large mean), so both sets are first shifted by the mean
+  of B, which leaves the distances unchanged: the shift is folded into the
+  norms and into the loads of the 4 x 4 blocks, one subtraction per loaded
+  value. Rounding can still leave a slightly negative square for
+  near-identical vectors; it is clamped to zero. The city block and
+  Chebyshev distances have no such form and are computed directly on the
+  same tiles. The cosine distance is not shift invariant and is computed
+  on the vectors as given.
+
+  When pB is pA (and numB is numA) only the upper triangle is computed and
+  mirrored, and the diagonal is exactly zero.
+
+  The cosine distance of a zero vector is 1.
+
+  With ARM_MATH_PTHREAD, large matrices are shared tile by tile between
+  S->numThreads threads.
+ */
+
+/**
+  @addtogroup DistanceMatrix
+  @{
+ */
+
+/* Pairs per tile side */
+#define ARM_DISTANCE_TILE         64U
+
+/* Multiply-accumulates per thread before splitting the work */
+#define ARM_DISTANCE_MT_MIN       (1U << 20)
+
+typedef struct
+{
+  arm_distance_metric metric;
+  const float32_t *pMean;
+  const float32_t *pA;
+  const float32_t *pNormA;
+  uint32_t numA;
+  const float32_t *pB;
+  const float32_t *pNormB;
+  uint32_t numB;
+  uint32_t dim;
+  float32_t *pDst;
+  uint32_t ldDst;
+  uint32_t symmetric;
+  uint32_t tilesA;
+  uint32_t tilesB;
+} arm_distance_job;
+
+/*
+ * Mean of num vectors, the shift applied before the Euclidean distances.
+ * Any point near the data would do; its accuracy does not matter.
+ */
+void arm_distance_mean_f32(
+  const float32_t *pSrc,
+  uint32_t num,
+  uint32_t dim,
+  float32_t *pMean)
+{
+  float32_t scale = 1.0f / (float32_t) num;
+  uint32_t i, k;
+
+  for (k = 0U; k < dim; k++)
+  {
+    pMean[k] = 0.0f;
+  }
+  for (i = 0U; i < num; i++)
+  {
+    for (k = 0U; k < dim; k++)
+    {
+      pMean[k] += pSrc[k];
+    }
+    pSrc += dim;
+  }
+  for (k = 0U; k < dim; k++)
+  {
+    pMean[k] *= scale;
+  }
+}
+
+/*
+ * Norm terms of num vectors: |v - mean|^2 for the Euclidean distances,
+ * 1 / |v| for the cosine distance (0 for a zero vector). Nothing for the
+ * others.
+ */
+void arm_distance_norms_f32(
+  arm_distance_metric metric,
+  const float32_t *pMean,
+  const float32_t *pSrc,
+  uint32_t num,
+  uint32_t dim,
+  float32_t *pNorms)
+{
+  float32_t sum, v;
+  uint32_t i, k;
+
+  if (metric > ARM_DISTANCE_COSINE)
+  {
+    return;
+  }
+
+  for (i = 0U; i < num; i++)
+  {
+    if (metric == ARM_DISTANCE_COSINE)
+    {
+      arm_dot_prod_f32(pSrc, pSrc, dim, &sum);
+      sum = (sum > 0.0f) ? 1.0f / sqrtf(sum) : 0.0f;
+    }
+    else
+    {
+      sum = 0.0f;
+      for (k = 0U; k < dim; k++)
+      {
+        v = pSrc[k] - pMean[k];
+        sum += v * v;
+      }
+    }
+    pNorms[i] = sum;
+    pSrc += dim;
+  }
+}
+
+/*
+ * 4 x 4 block of dot products, sums of |a - b| or maxima of |a - b|, with
+ * CENTRE subtracted from every loaded value. The sixteen accumulators are
+ * spelled out so they stay in registers.
+ */
+#define ARM_DISTANCE_BLOCK(OP, CENTRE)                                    \
+  for (k = 0U; k < dim; k++)                                              \
+  {                                                                       \
+    float32_t m = CENTRE;                                                 \
+    float32_t a0 = pA0[k] - m, a1 = pA1[k] - m;                           \
+    float32_t a2 = pA2[k] - m, a3 = pA3[k] - m;                           \
+    float32_t b0 = pB0[k] - m, b1 = pB1[k] - m;                           \
+    float32_t b2 = pB2[k] - m, b3 = pB3[k] - m;                           \
+    OP(s00, a0, b0); OP(s01, a0, b1); OP(s02, a0, b2); OP(s03, a0, b3);   \
+    OP(s10, a1, b0); OP(s11, a1, b1); OP(s12, a1, b2); OP(s13, a1, b3);   \
+    OP(s20, a2, b0); OP(s21, a2, b1); OP(s22, a2, b2); OP(s23, a2, b3);   \
+    OP(s30, a3, b0); OP(s31, a3, b1); OP(s32, a3, b2); OP(s33, a3, b3);   \
+  }
+
+#define ARM_DISTANCE_MAC(s, a, b)  s += (a) * (b)
+#define ARM_DISTANCE_L1(s, a, b)   s += fabsf((a) - (b))
+#define ARM_DISTANCE_MAX(s, a, b)  do { float32_t t = fabsf((a) - (b)); s = (t > s) ? t : s; } while (0)
+
+static void arm_distance_block_f32(
+  arm_distance_metric metric,
+  const float32_t *pMean,
+  const float32_t *pA[4],
+  const float32_t *pB[4],
+  uint32_t dim,
+  float32_t acc[4][4])
+{
+  const float32_t *pA0 = pA[0], *pA1 = pA[1], *pA2 = pA[2], *pA3 = pA[3];
+  const float32_t *pB0 = pB[0], *pB1 = pB[1], *pB2 = pB[2], *pB3 = pB[3];
+  float32_t s00 = 0.0f, s01 = 0.0f, s02 = 0.0f, s03 = 0.0f;
+  float32_t s10 = 0.0f, s11 = 0.0f, s12 = 0.0f, s13 = 0.0f;
+  float32_t s20 = 0.0f, s21 = 0.0f, s22 = 0.0f, s23 = 0.0f;
+  float32_t s30 = 0.0f, s31 = 0.0f, s32 = 0.0f, s33 = 0.0f;
+  uint32_t k;
+
+  switch (metric)
+  {
+    case ARM_DISTANCE_CITYBLOCK:
+      ARM_DISTANCE_BLOCK(ARM_DISTANCE_L1, 0.0f)
+      break;
+    case ARM_DISTANCE_CHEBYSHEV:
+      ARM_DISTANCE_BLOCK(ARM_DISTANCE_MAX, 0.0f)
+      break;
+    case ARM_DISTANCE_COSINE:
+      ARM_DISTANCE_BLOCK(ARM_DISTANCE_MAC, 0.0f)
+      break;
+    default:
+      ARM_DISTANCE_BLOCK(ARM_DISTANCE_MAC, pMean[k])
+      break;
+  }
+
+  acc[0][0] = s00; acc[0][1] = s01; acc[0][2] = s02; acc[0][3] = s03;
+  acc[1][0] = s10; acc[1][1] = s11; acc[1][2] = s12; acc[1][3] = s13;
+  acc[2][0] = s20; acc[2][1] = s21; acc[2][2] = s22; acc[2][3] = s23;
+  acc[3][0] = s30; acc[3][1] = s31; acc[3][2] = s32; acc[3][3] = s33;
+}
+
+__STATIC_FORCEINLINE float32_t arm_distance_finish_f32(
+  arm_distance_metric metric,
+  float32_t acc,
+  float32_t normA,
+  float32_t normB)
+{
+  float32_t d;
+
+  switch (metric)
+  {
+    case ARM_DISTANCE_EUCLIDEAN:
+      d = normA + normB - 2.0f * acc;
+      return (d > 0.0f) ? sqrtf(d) : 0.0f;
+    case ARM_DISTANCE_SQEUCLIDEAN:
+      d = normA + normB - 2.0f * acc;
+      return (d > 0.0f) ? d : 0.0f;
+    case ARM_DISTANCE_COSINE:
+      return 1.0f - acc * normA * normB;
+    default:
+      return acc;
+  }
+}
+
+static void arm_distance_tile_f32(const arm_distance_job *J, uint32_t ta, uint32_t tb)
+{
+  uint32_t i0 = ta * ARM_DISTANCE_TILE;
+  uint32_t j0 = tb * ARM_DISTANCE_TILE;
+  uint32_t i1 = (i0 + ARM_DISTANCE_TILE < J->numA) ? i0 + ARM_DISTANCE_TILE : J->numA;
+  uint32_t j1 = (j0 + ARM_DISTANCE_TILE < J->numB) ? j0 + ARM_DISTANCE_TILE : J->numB;
+  uint32_t norms = (J->metric <= ARM_DISTANCE_COSINE) ? 1U : 0U;
+  const float32_t *pA[4], *pB[4];
+  float32_t acc[4][4], d;
+  uint32_t i, j, r, c, nr, nc;
+
+  for (i = i0; i < i1; i += 4U)
+  {
+    nr = (i1 - i < 4U) ? i1 - i : 4U;
+    for (r = 0U; r < 4U; r++)
+    {
+      /* Missing rows repeat the last one; their results are dropped */
+      pA[r] = J->pA + (i + ((r < nr) ? r : nr - 1U)) * J->dim;
+    }
+
+    for (j = j0; j < j1; j += 4U)
+    {
+      nc = (j1 - j < 4U) ? j1 - j : 4U;
+      for (c = 0U; c < 4U; c++)
+      {
+        pB[c] = J->pB + (j + ((c < nc) ? c : nc - 1U)) * J->dim;
+      }
+
+      arm_distance_block_f32(J->metric, J->pMean, pA, pB, J->dim, acc);
+
+      for (r = 0U; r < nr; r++)
+      {
+        for (c = 0U; c < nc; c++)
+        {
+          d = arm_distance_finish_f32(J->metric, acc[r][c],
+                                      norms ? J->pNormA[i + r] : 0.0f,
+                                      norms ? J->pNormB[j + c] : 0.0f);
+          if (J->symmetric)
+          {
+            if (i + r == j + c)
+            {
+              d = ((J->metric == ARM_DISTANCE_COSINE) && (J->pNormA[i + r] == 0.0f)) ? 1.0f : 0.0f;
+            }
+            J->pDst[(j + c) * J->ldDst + i + r] = d;
+          }
+          J->pDst[(i + r) * J->ldDst + j + c] = d;
+        }
+      }
+    }
+  }
+}
+
+static void arm_distance_part_f32(void *arg, arm_parallel_team *team, uint32_t part)
+{
+  const arm_distance_job *J = (const arm_distance_job *) arg;
+  uint32_t ta, tb, t = 0U;
+
+  /* Round-robin over the tiles, the lower triangle skipped when symmetric */
+  for (ta = 0U; ta < J->tilesA; ta++)
+  {
+    for (tb = J->symmetric ? ta : 0U; tb < J->tilesB; tb++, t++)
+    {
+      if (t % team->numParts == part)
+      {
+        arm_distance_tile_f32(J, ta, tb);
+      }
+    }
+  }
+}
+
+/*
+ * Distance matrix from precomputed norm terms (see arm_distance_norms_f32)
+ * and, for the Euclidean distances, the mean they were taken about, with a
+ * row stride of ldDst in pDst.
+ */
+void arm_distance_matrix_core_f32(
+  arm_distance_metric metric,
+  uint32_t numThreads,
+  const float32_t *pMean,
+  const float32_t *pA,
+  const float32_t *pNormA,
+  uint32_t numA,
+  const float32_t *pB,
+  const float32_t *pNormB,
+  uint32_t numB,
+  uint32_t dim,
+  float32_t *pDst,
+  uint32_t ldDst,
+  uint32_t symmetric)
+{
+  arm_distance_job job;
+  uint64_t work = (uint64_t) numA * numB * dim;
+
+  if ((numA == 0U) || (numB == 0U))
+  {
+    return;
+  }
+
+  job.metric = metric;
+  job.pMean = pMean;
+  job.pA = pA;
+  job.pNormA = pNormA;
+  job.numA = numA;
+  job.pB = pB;
+  job.pNormB = pNormB;
+  job.numB = numB;
+  job.dim = dim;
+  job.pDst = pDst;
+  job.ldDst = ldDst;
+  job.symmetric = symmetric;
+  job.tilesA = (numA + ARM_DISTANCE_TILE - 1U) / ARM_DISTANCE_TILE;
+  job.tilesB = (numB + ARM_DISTANCE_TILE - 1U) / ARM_DISTANCE_TILE;
+
+  if (symmetric)
+  {
+    work /= 2U;
+  }
+
+  arm_parallel_run(arm_distance_part_f32, &job,
+                   arm_parallel_threads(numThreads,
+                                        (work > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t) work,
+                                        ARM_DISTANCE_MT_MIN));
+}
+
+/**
+ * @brief        Distances between all rows of A and all rows of B
+ * @param[in]    S          Instance
+ * @param[in]    pA         numA vectors of dim values, one per row
+ * @param[in]    numA       Number of vectors in A
+ * @param[in]    pB         numB vectors of dim values, or pA for the distances within A
+ * @param[in]    numB       Number of vectors in B
+ * @param[in]    dim        Vector length
+ * @param[out]   pDst       numA x numB distances, row-major
+ *
+ * @par          S->pNorms must hold ARM_DISTANCE_NORMS_SIZE(numA, numB, dim)
+ *               values. The norms of A are reused for B when pB is pA.
+ */
+void arm_distance_matrix_f32(const arm_distance_matrix_instance_f32 *S,
+  const float32_t *pA,
+  uint32_t numA,
+  const float32_t *pB,
+  uint32_t numB,
+  uint32_t dim,
+  float32_t *pDst)
+{
+  uint32_t symmetric = ((pA == pB) && (numA == numB)) ? 1U : 0U;
+  float32_t *pMean = S->pNorms;
+  float32_t *pNormA = S->pNorms + dim;
+  float32_t *pNormB = symmetric ? pNormA : pNormA + numA;
+
+  if ((numA == 0U) || (numB == 0U))
+  {
+    return;
+  }
+
+  if (S->metric <= ARM_DISTANCE_SQEUCLIDEAN)
+  {
+    arm_distance_mean_f32(pB, numB, dim, pMean);
+  }
+
+  arm_distance_norms_f32(S->metric, pMean, pA, numA, dim, pNormA);
+  if (!symmetric)
+  {
+    arm_distance_norms_f32(S->metric, pMean, pB, numB, dim, pNormB);
+  }
+
+  arm_distance_matrix_core_f32(S->metric, S->numThreads, pMean, pA, pNormA, numA,
+                               pB, pNormB, numB, dim, pDst, numB, symmetric);
+}
+
+/**
+  @} end of DistanceMatrix group
+ */
@@ -0,0 +1,56 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_distance_matrix_init_f32.c
+ * Description:  Initialization function for the floating-point distance matrix
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/distance_functions.h"
+
+/**
+  @ingroup groupDistance
+ */
+
+/**
+  @addtogroup DistanceMatrix
+  @{
+ */
+
+/**
+ * @brief        Initialization function for the distance matrix
+ * @param[out]   S           Instance
+ * @param[in]    metric      Distance metric
+ * @param[in]    numThreads  Threads for large matrices, 0 for all CPUs, 1 for none
+ * @param[in]    pNorms      Working buffer of ARM_DISTANCE_NORMS_SIZE(numA, numB, dim) values (largest call)
+ *
+ */
+void arm_distance_matrix_init_f32(arm_distance_matrix_instance_f32 *S,
+  arm_distance_metric metric,
+  uint32_t numThreads,
+  float32_t *pNorms)
+{
+  S->metric = metric;
+  S->numThreads = numThreads;
+  S->pNorms = pNorms;
+}
+
+/**
+  @} end of DistanceMatrix group
+ */
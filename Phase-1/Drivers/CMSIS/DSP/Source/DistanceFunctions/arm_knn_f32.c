@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_knn_f32.c
+ * Description:  Floating-point k-nearest-neighbour search
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/distance_functions.h"
+#include "dsp/support_functions.h"
+
+extern void arm_distance_norms_f32(
+  arm_distance_metric metric,
+  const float32_t *pMean,
+  const float32_t *pSrc,
+  uint32_t num,
+  uint32_t dim,
+  float32_t *pNorms);
+
+extern void arm_distance_matrix_core_f32(
+  arm_distance_metric metric,
+  uint32_t numThreads,
+  const float32_t *pMean,
+  const float32_t *pA,
+  const float32_t *pNormA,
+  uint32_t numA,
+  const float32_t *pB,
+  const float32_t *pNormB,
+  uint32_t numB,
+  uint32_t dim,
+  float32_t *pDst,
+  uint32_t ldDst,
+  uint32_t symmetric);
+
+/**
+  @ingroup groupDistance
+ */
+
+/**
+  @defgroup KNN k-nearest neighbours
+
+  Finds the k reference vectors closest to each query vector, for speaker
+  identification or template matching against a fixed set of references.
+
+  Queries are taken ARM_KNN_QUERY_BLOCK at a time: the block's distances to
+  all references are computed with the distance matrix engine (see \ref
+  DistanceMatrix), using the reference norms and mean computed once by
+  arm_knn_init_f32(), and the k smallest of each row are selected with
+  arm_topk_f32(). Neighbours come out nearest first; equal distances keep
+  the reference order.
+ */
+
+/**
+  @addtogroup KNN
+  @{
+ */
+
+/**
+ * @brief        k nearest reference vectors of each query
+ * @param[in]    S           Instance
+ * @param[in]    pQuery      numQueries vectors of dim values
+ * @param[in]    numQueries  Number of queries
+ * @param[in]    k           Neighbours per query, at most maxK
+ * @param[out]   pDist       numQueries x k distances, nearest first, or NULL
+ * @param[out]   pIndex      numQueries x k reference indices, nearest first
+ * @return       ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+ *
+ */
+arm_status arm_knn_f32(const arm_knn_instance_f32 *S,
+  const float32_t *pQuery,
+  uint32_t numQueries,
+  uint32_t k,
+  float32_t *pDist,
+  uint32_t *pIndex)
+{
+  float32_t normQ[ARM_KNN_QUERY_BLOCK];
+  const float32_t *pMean = S->pNorms + S->numVectors;
+  arm_radix_sort_instance_f32 select;
+  uint32_t q, r, nq;
+
+  if ((k == 0U) || (k > S->maxK))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  arm_radix_sort_init_f32(&select, ARM_SORT_ASCENDING, 1U, S->pHeap);
+
+  for (q = 0U; q < numQueries; q += nq)
+  {
+    nq = (numQueries - q < ARM_KNN_QUERY_BLOCK) ? numQueries - q : ARM_KNN_QUERY_BLOCK;
+
+    arm_distance_norms_f32(S->metric, pMean, pQuery, nq, S->dim, normQ);
+    arm_distance_matrix_core_f32(S->metric, S->numThreads, pMean, pQuery, normQ, nq,
+                                 S->pData, S->pNorms, S->numVectors, S->dim,
+                                 S->pDist, S->numVectors, 0U);
+
+    for (r = 0U; r < nq; r++)
+    {
+      arm_topk_f32(&select, S->pDist + r * S->numVectors, S->numVectors, k,
+                   (pDist != NULL) ? pDist + (q + r) * k : NULL,
+                   pIndex + (q + r) * k);
+    }
+
+    pQuery += nq * S->dim;
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of KNN group
+ */
@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_knn_init_f32.c
+ * Description:  Initialization function for the floating-point k-nearest-neighbour search
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/distance_functions.h"
+
+extern void arm_distance_mean_f32(
+  const float32_t *pSrc,
+  uint32_t num,
+  uint32_t dim,
+  float32_t *pMean);
+
+extern void arm_distance_norms_f32(
+  arm_distance_metric metric,
+  const float32_t *pMean,
+  const float32_t *pSrc,
+  uint32_t num,
+  uint32_t dim,
+  float32_t *pNorms);
+
+/**
+  @ingroup groupDistance
+ */
+
+/**
+  @addtogroup KNN
+  @{
+ */
+
+/**
+ * @brief        Initialization function for the k-nearest-neighbour search
+ * @param[out]   S           Instance
+ * @param[in]    metric      Distance metric
+ * @param[in]    pData       Reference vectors, numVectors rows of dim values
+ * @param[in]    numVectors  Number of reference vectors
+ * @param[in]    dim         Vector length
+ * @param[in]    maxK        Largest k a query may ask for
+ * @param[in]    numThreads  Threads for large searches, 0 for all CPUs, 1 for none
+ * @param[in]    pNorms      Buffer for the reference norms and mean, ARM_KNN_NORMS_SIZE(numVectors, dim) values
+ * @param[in]    pDist       Distance buffer, ARM_KNN_DIST_SIZE(numVectors) values
+ * @param[in]    pHeap       Selection buffer, maxK words
+ * @return       ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+ *
+ * @par          The reference norms and mean are computed here, once. pData must not
+ *               change while the instance is in use.
+ */
+arm_status arm_knn_init_f32(arm_knn_instance_f32 *S,
+  arm_distance_metric metric,
+  const float32_t *pData,
+  uint32_t numVectors,
+  uint32_t dim,
+  uint32_t maxK,
+  uint32_t numThreads,
+  float32_t *pNorms,
+  float32_t *pDist,
+  uint64_t *pHeap)
+{
+  if ((numVectors == 0U) || (dim == 0U) || (maxK == 0U) || (maxK > numVectors) ||
+      (metric > ARM_DISTANCE_CHEBYSHEV))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->metric = metric;
+  S->numThreads = numThreads;
+  S->numVectors = numVectors;
+  S->dim = dim;
+  S->maxK = maxK;
+  S->pData = pData;
+  S->pNorms = pNorms;
+  S->pDist = pDist;
+  S->pHeap = pHeap;
+
+  if (metric <= ARM_DISTANCE_SQEUCLIDEAN)
+  {
+    arm_distance_mean_f32(pData, numVectors, dim, pNorms + numVectors);
+  }
+  arm_distance_norms_f32(metric, pNorms + numVectors, pData, numVectors, dim, pNorms);
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of KNN group
+ */
@@ -1,7 +1,7 @@
 /* ----------------------------------------------------------------------
  * Project:      CMSIS DSP Library
- * Title:        arm_vlog_f32.c
- * Description:  Fast vectorized log
+ * Title:        arm_vexp_f32.c
+ * Description:  Fast vectorized exp
  *
  * $Date:        23 April 2021
  * $Revision:    V1.9.0
@@ -33,6 +33,29 @@
 #include "arm_vec_math.h"
 #endif
 
+#if defined(ARM_MATH_X86)
+#include "arm_x86_kernels.h"
+#endif
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vexp Vector Exponential
+
+  Compute the exponential values of a vector of samples.
+
+  The Helium, Neon and x86 SIMD versions evaluate a polynomial after range
+  reduction instead of calling expf() and can differ from it by a couple
+  of ulp.
+ */
+
+/**
+  @addtogroup vexp
+  @{
+ */
+
 void arm_vexp_f32(
   const float32_t * pSrc,
         float32_t * pDst,
@@ -80,18 +103,34 @@ void arm_vexp_f32(
 
    blkCnt = blockSize & 3;
 #else
+#if defined(ARM_MATH_X86)
+   if (arm_x86_get_level() >= ARM_X86_LEVEL_AVX2)
+   {
+      arm_vexp_f32_avx2(pSrc, pDst, blockSize);
+      return;
+   }
+   if (arm_x86_get_level() >= ARM_X86_LEVEL_SSE2)
+   {
+      arm_vexp_f32_sse2(pSrc, pDst, blockSize);
+      return;
+   }
+#endif
    blkCnt = blockSize;
 #endif
 #endif
 
    while (blkCnt > 0U)
    {
-      /* C = log(A) */
+      /* C = exp(A) */
   
-      /* Calculate log and store result in destination buffer. */
+      /* Calculate exp and store result in destination buffer. */
       *pDst++ = expf(*pSrc++);
   
       /* Decrement loop counter */
       blkCnt--;
    }
 }
+
+/**
+  @} end of vexp group
+ */
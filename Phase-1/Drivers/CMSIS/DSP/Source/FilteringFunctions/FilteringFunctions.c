@@ -42,6 +42,10 @@
 #include "arm_biquad_cascade_df2T_init_f64.c"
 #include "arm_biquad_cascade_stereo_df2T_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_init_f32.c"
+#include "arm_biquad_cascade_multich_df2T_f32.c"
+#include "arm_biquad_cascade_multich_df2T_init_f32.c"
+#include "arm_biquad_cascade_multich_df1_q31.c"
+#include "arm_biquad_cascade_multich_df1_init_q31.c"
 #include "arm_conv_f32.c"
 #include "arm_conv_fast_opt_q15.c"
 #include "arm_conv_fast_q15.c"
@@ -83,6 +87,10 @@
 #include "arm_fir_fast_q15.c"
 #include "arm_fir_fast_q31.c"
 #include "arm_fir_init_f32.c"
+#include "arm_fir_fft_f32.c"
+#include "arm_fir_fft_init_f32.c"
+#include "arm_fir_auto_f32.c"
+#include "arm_fir_auto_init_f32.c"
 #include "arm_fir_init_f64.c"
 #include "arm_fir_init_q15.c"
 #include "arm_fir_init_q31.c"
@@ -93,6 +101,14 @@
 #include "arm_fir_interpolate_init_q31.c"
 #include "arm_fir_interpolate_q15.c"
 #include "arm_fir_interpolate_q31.c"
+#include "arm_resample_poly_f32.c"
+#include "arm_resample_poly_init_f32.c"
+#include "arm_resample_poly_q15.c"
+#include "arm_resample_poly_init_q15.c"
+#include "arm_resample_frac_f32.c"
+#include "arm_resample_frac_init_f32.c"
+#include "arm_resample_frac_q15.c"
+#include "arm_resample_frac_init_q15.c"
 #include "arm_fir_lattice_f32.c"
 #include "arm_fir_lattice_init_f32.c"
 #include "arm_fir_lattice_init_q15.c"
@@ -122,6 +138,12 @@
 #include "arm_lms_init_q31.c"
 #include "arm_lms_norm_f32.c"
 #include "arm_lms_norm_init_f32.c"
+#include "arm_aec_f32.c"
+#include "arm_aec_init_f32.c"
+#include "arm_noise_suppress_f32.c"
+#include "arm_noise_suppress_init_f32.c"
+#include "arm_noise_suppress_q15.c"
+#include "arm_noise_suppress_init_q15.c"
 #if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_FAST_ALLOW_TABLES)
 #if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FAST_TABLES) || defined(ARM_TABLE_RECIP_Q15)
 #include "arm_lms_norm_init_q15.c"
@@ -0,0 +1,310 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_aec_f32.c
+ * Description:  Floating-point partitioned-block frequency-domain adaptive echo canceller
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup AEC PBFDAF Acoustic Echo Canceller
+
+  Echo canceller for hands-free calls. The far-end signal sent to the
+  loudspeaker comes back into the microphone through the room; an adaptive
+  filter models that echo path and its output is subtracted from the
+  microphone signal.
+
+  Speakerphone echo tails are 128 to 256 ms, 2048 to 4096 taps at 16 kHz,
+  far too long for the time-domain \ref arm_lms_norm_f32, which spends
+  <code>2*numTaps</code> multiply-accumulates per sample. This is a
+  partitioned-block frequency-domain adaptive filter (PBFDAF, also known as
+  MDF): the echo path is split into partitions of <code>partLen</code>
+  taps, filtered by overlap-save like \ref arm_fir_fft_f32, and adapted in
+  the frequency domain with a step normalized per frequency bin by the
+  far-end power. The gradient constraint (the inverse FFT, truncation and
+  FFT that keeps each partition a linear convolution) is applied to one
+  partition per step in turn, which keeps the cost at three FFTs of
+  <code>2*partLen</code> points per step plus two for the constraint.
+
+  Adaptation stops when the far-end is silent and while the double-talk
+  detector fires. The detector is the normalized cross-correlation between
+  the microphone signal and the echo estimate, <code>E[d*y] / E[d*d]</code>:
+  with echo only, the estimate explains the microphone power up to the
+  residual echo; near-end speech adds power the estimate does not explain.
+  Double-talk is declared when the correlation drops below
+  <code>dtThreshold</code> times its recent echo-only level. The detector
+  only runs once the filter has converged enough (10 dB) for the estimate
+  to be trusted, and continuous double-talk for longer than
+  <code>dtMaxSteps</code> steps of far-end activity is treated as a change
+  of the echo path.
+
+  The canceller has no added delay: the output of a block is the
+  microphone block minus the echo estimate for the same samples. It does
+  no residual echo suppression or comfort noise; those belong to the
+  stage after it.
+ */
+
+/**
+  @addtogroup AEC
+  @{
+ */
+
+/*
+ * pAcc (+)= pX * pW on spectra in the packed format of arm_rfft_fast_f32:
+ * the first pair holds the real DC and Nyquist bins, then complex bins.
+ */
+__STATIC_FORCEINLINE void arm_aec_cmac_f32(
+  const float32_t * pX,
+  const float32_t * pW,
+        float32_t * pAcc,
+        uint32_t fftLen,
+        uint32_t accumulate)
+{
+  uint32_t k;
+
+  if (accumulate == 0U)
+  {
+    pAcc[0] = pX[0] * pW[0];
+    pAcc[1] = pX[1] * pW[1];
+    for (k = 2U; k < fftLen; k += 2U)
+    {
+      pAcc[k]      = pX[k] * pW[k]      - pX[k + 1U] * pW[k + 1U];
+      pAcc[k + 1U] = pX[k] * pW[k + 1U] + pX[k + 1U] * pW[k];
+    }
+  }
+  else
+  {
+    pAcc[0] += pX[0] * pW[0];
+    pAcc[1] += pX[1] * pW[1];
+    for (k = 2U; k < fftLen; k += 2U)
+    {
+      pAcc[k]      += pX[k] * pW[k]      - pX[k + 1U] * pW[k + 1U];
+      pAcc[k + 1U] += pX[k] * pW[k + 1U] + pX[k + 1U] * pW[k];
+    }
+  }
+}
+
+/* pW += conj(pX) * pG, same packed format */
+__STATIC_FORCEINLINE void arm_aec_update_f32(
+  const float32_t * pX,
+  const float32_t * pG,
+        float32_t * pW,
+        uint32_t fftLen)
+{
+  uint32_t k;
+
+  pW[0] += pX[0] * pG[0];
+  pW[1] += pX[1] * pG[1];
+  for (k = 2U; k < fftLen; k += 2U)
+  {
+    pW[k]      += pX[k] * pG[k]      + pX[k + 1U] * pG[k + 1U];
+    pW[k + 1U] += pX[k] * pG[k + 1U] - pX[k + 1U] * pG[k];
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point PBFDAF acoustic echo canceller.
+  @param[in,out] S          points to an instance of the echo canceller structure
+  @param[in]     pRef       points to the block of far-end samples, as sent to the loudspeaker
+  @param[in]     pMic       points to the block of microphone samples
+  @param[out]    pOut       points to the block of echo-cancelled samples
+  @param[in]     blockSize  number of samples to process, a multiple of <code>partLen</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS      : Operation successful
+                   - \ref ARM_MATH_LENGTH_ERROR : <code>blockSize</code> is not a multiple of <code>partLen</code>
+
+  @par           Details
+                   <code>pRef</code> and <code>pMic</code> must be time-aligned up to the
+                   bulk delay the model covers: the echo of far-end sample <code>n</code>
+                   must reach the microphone between sample <code>n</code> and
+                   <code>n + numTaps</code>. <code>pOut</code> may be the same buffer as
+                   <code>pMic</code>. <code>S->doubleTalk</code> reports the detector
+                   decision for the last step.
+ */
+arm_status arm_aec_f32(
+        arm_aec_instance_f32 * S,
+  const float32_t * pRef,
+  const float32_t * pMic,
+        float32_t * pOut,
+        uint32_t blockSize)
+{
+  uint32_t B = S->partLen;                     /* Samples per step */
+  uint32_t N = 2U * B;                         /* FFT length */
+  uint32_t P = S->numParts;                    /* Number of partitions */
+  float32_t *pFdl = S->pState;                 /* Far-end spectra, P x N */
+  float32_t *pW = pFdl + P * N;                /* Echo path spectra, P x N */
+  float32_t *pY = pW + P * N;                  /* Echo estimate spectrum / error spectrum */
+  float32_t *pTmp = pY + N;                    /* Time-domain work buffer */
+  float32_t *pMag = pTmp + N;                  /* |X|^2 of one far-end block */
+  float32_t *pPow = pMag + N;                  /* Far-end power per bin, B + 1 */
+  float32_t *pHist = pPow + B + 1U;            /* Previous far-end block */
+  float32_t a = S->smooth;                     /* Detector smoothing */
+  uint32_t blk, p, k, slot;
+  float32_t *pX, *pG;
+
+  if (blockSize % B != 0U)
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  for (blk = 0U; blk < blockSize; blk += B)
+  {
+    const float32_t *x = pRef + blk;
+    const float32_t *d = pMic + blk;
+    float32_t *e = pOut + blk;
+    float32_t exx = 0.0f, edd = 0.0f, edy = 0.0f, eee = 0.0f, mu;
+
+    /* Spectrum of the last two far-end blocks into the newest slot of the delay line */
+    slot = (S->fdlIndex == 0U) ? P - 1U : S->fdlIndex - 1U;
+    S->fdlIndex = (uint16_t) slot;
+    memcpy(pTmp, pHist, B * sizeof(float32_t));
+    memcpy(pTmp + B, x, B * sizeof(float32_t));
+    memcpy(pHist, x, B * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->rfft, pTmp, pFdl + slot * N, 0U);
+
+    /* Echo estimate: partition p of the model filters the block p steps old */
+    for (p = 0U; p < P; p++)
+    {
+      pX = pFdl + ((slot + p) % P) * N;
+      arm_aec_cmac_f32(pX, pW + p * N, pY, N, p);
+    }
+    arm_rfft_fast_f32(&S->rfft, pY, pTmp, 1U);
+
+    /* Overlap-save: the last B samples are the linear convolution */
+    for (k = 0U; k < B; k++)
+    {
+      float32_t y = pTmp[B + k];
+      float32_t err = d[k] - y;
+
+      exx += x[k] * x[k];
+      edd += d[k] * d[k];
+      edy += d[k] * y;
+      eee += err * err;
+      pTmp[k] = 0.0f;
+      pTmp[B + k] = err;
+      e[k] = err;
+    }
+
+    S->sdd = a * S->sdd + (1.0f - a) * edd;
+    S->sdy = a * S->sdy + (1.0f - a) * edy;
+    S->see = a * S->see + (1.0f - a) * eee;
+
+    /* Adaptation control */
+    mu = S->mu;
+    S->doubleTalk = 0U;
+    if (exx < S->farThreshold * (float32_t) B)
+    {
+      /* Nothing to learn from; pauses do not end a double-talk period */
+      mu = 0.0f;
+    }
+    else
+    {
+      float32_t ncc = S->sdy / S->sdd;
+
+      if (S->converged == 0U && S->see * 10.0f < S->sdd)
+      {
+        /* 10 dB of echo return loss enhancement: the estimate can be trusted */
+        S->converged = 1U;
+        S->nccRef = ncc;
+      }
+
+      if (S->converged != 0U && ncc < S->dtThreshold * S->nccRef)
+      {
+        S->doubleTalk = 1U;
+        S->dtHold = S->dtHangover;
+        if (++S->dtCount > S->dtMaxSteps)
+        {
+          /* Too long for a conversation: the echo path has changed */
+          S->converged = 0U;
+          S->dtCount = 0U;
+          S->dtHold = 0U;
+        }
+      }
+      else
+      {
+        S->dtCount = 0U;
+        if (S->dtHold == 0U)
+        {
+          /* Echo-only level of the correlation, which rises as the model converges */
+          S->nccRef = S->smoothRef * S->nccRef + (1.0f - S->smoothRef) * ncc;
+        }
+      }
+
+      if (S->dtHold > 0U)
+      {
+        S->dtHold--;
+        mu = 0.0f;
+      }
+    }
+
+    if (mu == 0.0f)
+    {
+      continue;
+    }
+
+    /* Far-end power per bin over the whole delay line: the energy of the
+       regressor each bin of the model sees, as in time-domain NLMS */
+    memset(pPow, 0, (B + 1U) * sizeof(float32_t));
+    for (p = 0U; p < P; p++)
+    {
+      pX = pFdl + p * N;
+      arm_cmplx_mag_squared_f32(pX + 2, pMag, B - 1U);
+      arm_add_f32(pPow + 1, pMag, pPow + 1, B - 1U);
+      pPow[0] += pX[0] * pX[0];
+      pPow[B] += pX[1] * pX[1];
+    }
+
+    /* Normalized error spectrum G = mu * E / (power + delta) */
+    pG = pY;
+    arm_rfft_fast_f32(&S->rfft, pTmp, pG, 0U);
+    pG[0] *= mu / (pPow[0] + S->delta);
+    pG[1] *= mu / (pPow[B] + S->delta);
+    for (k = 1U; k < B; k++)
+    {
+      float32_t g = mu / (pPow[k] + S->delta);
+
+      pG[2U * k] *= g;
+      pG[2U * k + 1U] *= g;
+    }
+
+    for (p = 0U; p < P; p++)
+    {
+      arm_aec_update_f32(pFdl + ((slot + p) % P) * N, pG, pW + p * N, N);
+    }
+
+    /* Gradient constraint on one partition: back to time, drop the circular half */
+    p = S->constrainIndex;
+    arm_rfft_fast_f32(&S->rfft, pW + p * N, pTmp, 1U);
+    memset(pTmp + B, 0, B * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->rfft, pTmp, pW + p * N, 0U);
+    S->constrainIndex = (uint16_t) ((p + 1U == P) ? 0U : p + 1U);
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of AEC group
+ */
@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_aec_init_f32.c
+ * Description:  Initialization function for the floating-point PBFDAF echo canceller
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup AEC
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point PBFDAF acoustic echo canceller.
+  @param[in,out] S        points to an instance of the echo canceller structure
+  @param[in]     numTaps  length of the echo tail to model, in samples
+  @param[in]     partLen  partition length: samples per processing step, 16 to 2048, a power of 2
+  @param[in]     mu       step size, 0 to 1. 0.5 is a good start
+  @param[in]     pState   points to the state buffer,
+                          of length <code>ARM_AEC_STATE_SIZE(numTaps, partLen)</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>partLen</code> not supported or no taps
+
+  @par           Details
+                   The echo path model starts at zero. The double-talk detector and
+                   the adaptation control get defaults that suit speech at 16 kHz;
+                   they are plain fields of the instance and can be changed after
+                   this call:
+                   - <code>dtThreshold</code> = 0.95: the detector fires when the
+                     normalized correlation between the microphone and the echo
+                     estimate falls below this fraction of its echo-only level
+                   - <code>dtHangover</code>: adaptation stays frozen for 100 ms after
+                     the detector last fired
+                   - <code>dtMaxSteps</code>: 2 s of continuous double-talk is taken as
+                     an echo path change and adaptation resumes
+                   - <code>farThreshold</code> = 1e-6: no adaptation while the far-end
+                     power is under -60 dBFS
+ */
+arm_status arm_aec_init_f32(
+        arm_aec_instance_f32 * S,
+        uint32_t numTaps,
+        uint16_t partLen,
+        float32_t mu,
+        float32_t * pState)
+{
+  uint32_t fftLen = 2U * (uint32_t) partLen;
+  uint32_t numParts;
+  arm_status status;
+
+  if (numTaps == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  status = arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  numParts = ARM_AEC_NUM_PARTS(numTaps, partLen);
+  if (numParts > 0xFFFFU)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->partLen = partLen;
+  S->numParts = (uint16_t) numParts;
+  S->fdlIndex = 0U;
+  S->constrainIndex = 0U;
+  S->mu = mu;
+  S->pState = pState;
+
+  S->dtThreshold = 0.95f;
+  S->farThreshold = 1.0e-6f;
+  S->dtHangover = (uint16_t) ((1600U + partLen - 1U) / partLen);
+  S->dtMaxSteps = (32000U + partLen - 1U) / partLen;
+  S->dtHold = 0U;
+  S->dtCount = 0U;
+  S->converged = 0U;
+  S->doubleTalk = 0U;
+
+  /* Detector statistics average over about 512 samples */
+  S->smooth = expf(-(float32_t) partLen / 512.0f);
+  S->sdd = 0.0f;
+  S->sdy = 0.0f;
+  S->see = 0.0f;
+
+  /* and the echo-only reference over about 0.5 s */
+  S->smoothRef = expf(-(float32_t) partLen / 8000.0f);
+  S->nccRef = 1.0f;
+
+  /* Spectra of a -60 dBFS white far-end, summed over the partitions */
+  S->delta = 1.0e-6f * (float32_t) (fftLen * numParts);
+
+  memset(pState, 0, ARM_AEC_STATE_SIZE(numTaps, partLen) * sizeof(float32_t));
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of AEC group
+ */
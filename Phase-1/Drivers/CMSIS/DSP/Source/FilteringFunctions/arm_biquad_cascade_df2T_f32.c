@@ -28,6 +28,10 @@
 
 #include "dsp/filtering_functions.h"
 
+#if defined(ARM_MATH_X86)
+#include "arm_x86_kernels.h"
+#endif
+
 /**
   @ingroup groupFilters
 */
@@ -360,6 +364,15 @@ void arm_biquad_cascade_df2T_f32(
         float32_t d1, d2;                              /* State variables */
         uint32_t sample, stage = S->numStages;         /* Loop counters */
 
+#if defined(ARM_MATH_X86)
+  /* Sections run in parallel lanes, so a single section gains nothing */
+  if ((S->numStages > 1U) && (arm_x86_get_level() >= ARM_X86_LEVEL_AVX2))
+  {
+    arm_biquad_cascade_df2T_f32_avx2(S, pSrc, pDst, blockSize);
+    return;
+  }
+#endif
+
   do
   {
      /* Reading the coefficients */
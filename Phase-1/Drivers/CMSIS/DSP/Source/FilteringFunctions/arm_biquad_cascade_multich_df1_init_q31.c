@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multich_df1_init_q31.c
+ * Description:  Initialization function for the N-channel Q31 Biquad cascade filter
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF1
+  @{
+ */
+
+/**
+  @brief         Initialization function for the N-channel Q31 Biquad cascade filter.
+  @param[in,out] S                 points to an instance of the Q31 Biquad cascade structure.
+  @param[in]     numStages         number of 2nd order stages in the filter.
+  @param[in]     numChannels       number of interleaved channels.
+  @param[in]     pCoeffs           points to the filter coefficients.
+  @param[in]     perChannelCoeffs  0 if all the channels share <code>pCoeffs</code>,
+                                   1 if it holds one set of coefficients per channel.
+  @param[out]    pCoeffsLanes      points to the coefficient buffer used by the filter.
+  @param[in]     pState            points to the state buffer.
+  @param[in]     postShift         Shift to be applied after the accumulator.  Varies according to the coefficients format
+  @return        none
+
+  @par           Coefficient and State Ordering
+                   Each set of coefficients is in the order of \ref arm_biquad_cascade_df1_init_q31:
+  <pre>
+      {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+  </pre>
+  @par
+                   <code>pCoeffs</code> holds <code>5*numStages</code> values when shared,
+                   or <code>numChannels</code> such sets one after the other. They are
+                   transposed into <code>pCoeffsLanes</code>, of <code>5*numStages*numChannels</code>
+                   values, as for \ref arm_biquad_cascade_multich_df2T_init_f32.
+  @par
+                   The state array has <code>4*numStages*numChannels</code> values:
+                   for each stage, <code>x[n-1]</code>, <code>x[n-2]</code>, <code>y[n-1]</code>
+                   and <code>y[n-2]</code>, each for all the channels.
+ */
+void arm_biquad_cascade_multich_df1_init_q31(
+        arm_biquad_cascade_multich_df1_instance_q31 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const q31_t * pCoeffs,
+        uint8_t perChannelCoeffs,
+        q31_t * pCoeffsLanes,
+        q31_t * pState,
+        int8_t postShift)
+{
+  uint32_t stage, k, ch;
+
+  /* Transpose the coefficients to one row per coefficient, one column per channel */
+  for (stage = 0U; stage < numStages; stage++)
+  {
+    for (k = 0U; k < 5U; k++)
+    {
+      q31_t *pRow = pCoeffsLanes + (5U * stage + k) * numChannels;
+
+      for (ch = 0U; ch < numChannels; ch++)
+      {
+        pRow[ch] = perChannelCoeffs ? pCoeffs[(5U * numStages * ch) + 5U * stage + k]
+                                    : pCoeffs[5U * stage + k];
+      }
+    }
+  }
+
+  /* Assign filter stages and channels */
+  S->numStages = numStages;
+  S->numChannels = numChannels;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffsLanes;
+
+  /* Assign postShift to be applied to the output */
+  S->postShift = postShift;
+
+  /* Clear state buffer and size is always 4 * numStages * numChannels */
+  memset(pState, 0, (4U * (uint32_t) numStages * numChannels) * sizeof(q31_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,206 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multich_df1_q31.c
+ * Description:  Q31 Biquad cascade filter, N interleaved channels
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF1
+  @{
+ */
+
+/*
+ * One stage on two adjacent channels, coefficients and state held in
+ * locals for the whole block. Two lanes, not four: each carries a 64-bit
+ * accumulator and nine live values, and two of them already fill the
+ * core registers of a Cortex-M.
+ */
+__STATIC_FORCEINLINE void arm_biquad_multich_df1_x2_q31(
+  const q31_t * pIn,
+        q31_t * pOut,
+        uint32_t numChannels,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize,
+        uint32_t lShift)
+{
+  const q31_t *pB1 = pCoeffs + numChannels, *pB2 = pB1 + numChannels;
+  const q31_t *pA1 = pB2 + numChannels, *pA2 = pA1 + numChannels;
+  q31_t b0a = pCoeffs[0], b0b = pCoeffs[1];
+  q31_t b1a = pB1[0], b1b = pB1[1];
+  q31_t b2a = pB2[0], b2b = pB2[1];
+  q31_t a1a = pA1[0], a1b = pA1[1];
+  q31_t a2a = pA2[0], a2b = pA2[1];
+  q31_t *pXn2 = pState + numChannels, *pYn1 = pXn2 + numChannels, *pYn2 = pYn1 + numChannels;
+  q31_t Xn1a = pState[0], Xn1b = pState[1];
+  q31_t Xn2a = pXn2[0], Xn2b = pXn2[1];
+  q31_t Yn1a = pYn1[0], Yn1b = pYn1[1];
+  q31_t Yn2a = pYn2[0], Yn2b = pYn2[1];
+  q31_t Xna, Xnb;                                    /* Temporary input */
+  q63_t acca, accb;                                  /* Accumulator */
+  uint32_t sample = blockSize;
+
+  while (sample > 0U)
+  {
+    Xna = pIn[0];
+    Xnb = pIn[1];
+
+    /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+    acca = ((q63_t) b0a * Xna) + ((q63_t) b1a * Xn1a) + ((q63_t) b2a * Xn2a) + ((q63_t) a1a * Yn1a) + ((q63_t) a2a * Yn2a);
+    accb = ((q63_t) b0b * Xnb) + ((q63_t) b1b * Xn1b) + ((q63_t) b2b * Xn2b) + ((q63_t) a1b * Yn1b) + ((q63_t) a2b * Yn2b);
+
+    /* Every time after the output is computed state should be updated. */
+    Xn2a = Xn1a;
+    Xn2b = Xn1b;
+    Xn1a = Xna;
+    Xn1b = Xnb;
+    Yn2a = Yn1a;
+    Yn2b = Yn1b;
+
+    /* The result is converted to 1.31 */
+    Yn1a = (q31_t) (acca >> lShift);
+    Yn1b = (q31_t) (accb >> lShift);
+
+    pOut[0] = Yn1a;
+    pOut[1] = Yn1b;
+
+    pIn += numChannels;
+    pOut += numChannels;
+    sample--;
+  }
+
+  pState[0] = Xn1a;
+  pState[1] = Xn1b;
+  pXn2[0] = Xn2a;
+  pXn2[1] = Xn2b;
+  pYn1[0] = Yn1a;
+  pYn1[1] = Yn1b;
+  pYn2[0] = Yn2a;
+  pYn2[1] = Yn2b;
+}
+
+/* One stage on a single channel, for an odd channel count */
+__STATIC_FORCEINLINE void arm_biquad_multich_df1_x1_q31(
+  const q31_t * pIn,
+        q31_t * pOut,
+        uint32_t numChannels,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize,
+        uint32_t lShift)
+{
+  q31_t b0 = pCoeffs[0];
+  q31_t b1 = pCoeffs[numChannels];
+  q31_t b2 = pCoeffs[2U * numChannels];
+  q31_t a1 = pCoeffs[3U * numChannels];
+  q31_t a2 = pCoeffs[4U * numChannels];
+  q31_t Xn1 = pState[0], Xn2 = pState[numChannels];
+  q31_t Yn1 = pState[2U * numChannels], Yn2 = pState[3U * numChannels];
+  q31_t Xn;
+  q63_t acc;
+  uint32_t sample = blockSize;
+
+  while (sample > 0U)
+  {
+    Xn = *pIn;
+
+    /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+    acc = ((q63_t) b0 * Xn) + ((q63_t) b1 * Xn1) + ((q63_t) b2 * Xn2) + ((q63_t) a1 * Yn1) + ((q63_t) a2 * Yn2);
+
+    Xn2 = Xn1;
+    Xn1 = Xn;
+    Yn2 = Yn1;
+    Yn1 = (q31_t) (acc >> lShift);
+
+    *pOut = Yn1;
+
+    pIn += numChannels;
+    pOut += numChannels;
+    sample--;
+  }
+
+  pState[0] = Xn1;
+  pState[numChannels] = Xn2;
+  pState[2U * numChannels] = Yn1;
+  pState[3U * numChannels] = Yn2;
+}
+
+/**
+  @brief         Processing function for the N-channel Q31 Biquad cascade filter.
+  @param[in]     S         points to an instance of the Q31 Biquad cascade structure
+  @param[in]     pSrc      points to the block of input data, channels interleaved
+  @param[out]    pDst      points to the block of output data, channels interleaved
+  @param[in]     blockSize number of samples to process per channel
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   Same as \ref arm_biquad_cascade_df1_q31, and the output of each channel
+                   is bit-exact with it: 64-bit accumulator in 2.62 format, shifted by
+                   <code>postShift</code> and truncated to 1.31.
+                   <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+void arm_biquad_cascade_multich_df1_q31(
+  const arm_biquad_cascade_multich_df1_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  const q31_t *pIn = pSrc;                             /* Source pointer */
+        q31_t *pState = S->pState;                     /* pState pointer */
+  const q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        uint32_t numChannels = S->numChannels;
+        uint32_t lShift = 31U - (uint32_t) S->postShift;  /* Shift to be applied to the output */
+        uint32_t stage = S->numStages, ch;             /* Loop counters */
+
+  do
+  {
+    for (ch = 0U; ch + 2U <= numChannels; ch += 2U)
+    {
+      arm_biquad_multich_df1_x2_q31(pIn + ch, pDst + ch, numChannels,
+                                    pCoeffs + ch, pState + ch, blockSize, lShift);
+    }
+    if (ch < numChannels)
+    {
+      arm_biquad_multich_df1_x1_q31(pIn + ch, pDst + ch, numChannels,
+                                    pCoeffs + ch, pState + ch, blockSize, lShift);
+    }
+
+    pCoeffs += 5U * numChannels;
+    pState += 4U * numChannels;
+
+    /* The current stage output is given as the input to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+  @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,196 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multich_df2T_f32.c
+ * Description:  Floating-point transposed direct form II Biquad cascade filter, N interleaved channels
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/*
+ * One stage on four adjacent channels. Coefficients and state stay in
+ * registers for the whole block, and the four recurrences are independent,
+ * which hides the latency of each one and maps onto SIMD lanes.
+ */
+__STATIC_FORCEINLINE void arm_biquad_multich_df2T_x4_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint32_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  const float32_t *pB1 = pCoeffs + numChannels, *pB2 = pB1 + numChannels;
+  const float32_t *pA1 = pB2 + numChannels, *pA2 = pA1 + numChannels;
+  float32_t b0a = pCoeffs[0], b0b = pCoeffs[1], b0c = pCoeffs[2], b0d = pCoeffs[3];
+  float32_t b1a = pB1[0], b1b = pB1[1], b1c = pB1[2], b1d = pB1[3];
+  float32_t b2a = pB2[0], b2b = pB2[1], b2c = pB2[2], b2d = pB2[3];
+  float32_t a1a = pA1[0], a1b = pA1[1], a1c = pA1[2], a1d = pA1[3];
+  float32_t a2a = pA2[0], a2b = pA2[1], a2c = pA2[2], a2d = pA2[3];
+  float32_t d1a = pState[0], d1b = pState[1], d1c = pState[2], d1d = pState[3];
+  float32_t *pD2 = pState + numChannels;
+  float32_t d2a = pD2[0], d2b = pD2[1], d2c = pD2[2], d2d = pD2[3];
+  float32_t Xn1a, Xn1b, Xn1c, Xn1d;                  /* Temporary input */
+  float32_t acc1a, acc1b, acc1c, acc1d;              /* Accumulator */
+  uint32_t sample = blockSize;
+
+  while (sample > 0U)
+  {
+    /* y[n] = b0 * x[n] + d1 */
+    /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+    /* d2 = b2 * x[n] + a2 * y[n] */
+    Xn1a = pIn[0];
+    Xn1b = pIn[1];
+    Xn1c = pIn[2];
+    Xn1d = pIn[3];
+
+    acc1a = (b0a * Xn1a) + d1a;
+    acc1b = (b0b * Xn1b) + d1b;
+    acc1c = (b0c * Xn1c) + d1c;
+    acc1d = (b0d * Xn1d) + d1d;
+
+    pOut[0] = acc1a;
+    pOut[1] = acc1b;
+    pOut[2] = acc1c;
+    pOut[3] = acc1d;
+
+    d1a = ((b1a * Xn1a) + (a1a * acc1a)) + d2a;
+    d1b = ((b1b * Xn1b) + (a1b * acc1b)) + d2b;
+    d1c = ((b1c * Xn1c) + (a1c * acc1c)) + d2c;
+    d1d = ((b1d * Xn1d) + (a1d * acc1d)) + d2d;
+
+    d2a = (b2a * Xn1a) + (a2a * acc1a);
+    d2b = (b2b * Xn1b) + (a2b * acc1b);
+    d2c = (b2c * Xn1c) + (a2c * acc1c);
+    d2d = (b2d * Xn1d) + (a2d * acc1d);
+
+    pIn += numChannels;
+    pOut += numChannels;
+    sample--;
+  }
+
+  pState[0] = d1a;
+  pState[1] = d1b;
+  pState[2] = d1c;
+  pState[3] = d1d;
+  pD2[0] = d2a;
+  pD2[1] = d2b;
+  pD2[2] = d2c;
+  pD2[3] = d2d;
+}
+
+/* One stage on a single channel, for the channels left after the groups of four */
+__STATIC_FORCEINLINE void arm_biquad_multich_df2T_x1_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint32_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  float32_t b0 = pCoeffs[0];
+  float32_t b1 = pCoeffs[numChannels];
+  float32_t b2 = pCoeffs[2U * numChannels];
+  float32_t a1 = pCoeffs[3U * numChannels];
+  float32_t a2 = pCoeffs[4U * numChannels];
+  float32_t d1 = pState[0], d2 = pState[numChannels];
+  float32_t Xn1, acc1;
+  uint32_t sample = blockSize;
+
+  while (sample > 0U)
+  {
+    Xn1 = *pIn;
+    acc1 = (b0 * Xn1) + d1;
+    *pOut = acc1;
+    d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+    d2 = (b2 * Xn1) + (a2 * acc1);
+
+    pIn += numChannels;
+    pOut += numChannels;
+    sample--;
+  }
+
+  pState[0] = d1;
+  pState[numChannels] = d2;
+}
+
+/**
+  @brief         Processing function for the N-channel floating-point transposed direct form II Biquad cascade filter.
+  @param[in]     S         points to an instance of the filter data structure
+  @param[in]     pSrc      points to the block of input data, channels interleaved
+  @param[out]    pDst      points to the block of output data, channels interleaved
+  @param[in]     blockSize number of samples to process per channel
+  @return        none
+
+  @par           Description
+                   Same result per channel as \ref arm_biquad_cascade_df2T_f32 on the
+                   deinterleaved signal, in one call for all the channels. Channels are
+                   filtered four at a time, then the remaining ones individually.
+                   <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+void arm_biquad_cascade_multich_df2T_f32(
+  const arm_biquad_cascade_multich_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        uint32_t numChannels = S->numChannels;
+        uint32_t stage = S->numStages, ch;             /* Loop counters */
+
+  do
+  {
+    for (ch = 0U; ch + 4U <= numChannels; ch += 4U)
+    {
+      arm_biquad_multich_df2T_x4_f32(pIn + ch, pDst + ch, numChannels,
+                                     pCoeffs + ch, pState + ch, blockSize);
+    }
+    for (; ch < numChannels; ch++)
+    {
+      arm_biquad_multich_df2T_x1_f32(pIn + ch, pDst + ch, numChannels,
+                                     pCoeffs + ch, pState + ch, blockSize);
+    }
+
+    pCoeffs += 5U * numChannels;
+    pState += 2U * numChannels;
+
+    /* The current stage output is given as the input to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
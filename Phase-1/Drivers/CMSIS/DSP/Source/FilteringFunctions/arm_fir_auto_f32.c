@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_auto_f32.c
+ * Description:  Floating-point FIR filter, direct or partitioned FFT
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point FIR filter with automatic choice of algorithm.
+  @param[in,out] S          points to an instance of the filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process, at most the block size given at init
+                            and, for the FFT form, a multiple of the partition length
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS      : Operation successful
+                   - \ref ARM_MATH_LENGTH_ERROR : block not a multiple of the partition length
+ */
+arm_status arm_fir_auto_f32(
+        arm_fir_auto_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  if (S->partLen != 0U)
+  {
+    return arm_fir_fft_f32(&S->fft, pSrc, pDst, blockSize);
+  }
+
+  arm_fir_f32(&S->fir, pSrc, pDst, blockSize);
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIR_FFT group
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_auto_init_f32.c
+ * Description:  Initialization function for the floating-point FIR filter with automatic choice of algorithm
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#if defined(ARM_MATH_X86)
+#include "dsp/x86_functions.h"
+#endif
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/*
+ * Cost model, per output sample and in units of one tap of arm_fir_f32:
+ *   direct form      numTaps
+ *   partitioned FFT  ARM_FIR_AUTO_FFT_COST * log2(2 * partLen)
+ *                  + ARM_FIR_AUTO_PART_COST * numParts
+ * Fitted to the fir_long cases of the host dsp_bench. The defaults are
+ * the portable C build; on x86 the direct form is vectorized and the
+ * ratio depends on the level the run-time dispatch picked. Re-measure
+ * with dsp_bench on a new target and override the two macros.
+ */
+#if defined(ARM_FIR_AUTO_FFT_COST) && defined(ARM_FIR_AUTO_PART_COST)
+  #define ARM_FIR_AUTO_COSTS_OVERRIDDEN
+#else
+  #define ARM_FIR_AUTO_FFT_COST  3.3f
+  #define ARM_FIR_AUTO_PART_COST 1.9f
+#endif
+
+#if defined(ARM_MATH_X86) && !defined(ARM_FIR_AUTO_COSTS_OVERRIDDEN)
+/* {FFT cost, partition cost} for the scalar, SSE2 and AVX2 levels */
+static const float32_t arm_fir_auto_costs_x86[3][2] = {
+  { 3.3f,  1.9f },
+  { 26.0f, 14.0f },
+  { 42.0f, 37.0f }
+};
+#endif
+
+/**
+  @brief         Partition length the automatic FIR filter uses for a filter.
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     blockSize  number of samples processed per call
+  @return        partition length for \ref arm_fir_fft_init_f32, or 0 when the
+                 direct form is cheaper
+
+  @par           Details
+                   Candidates are the powers of 2 from 16 to 2048 that divide
+                   <code>blockSize</code>. The return value sizes the buffers of
+                   \ref arm_fir_auto_init_f32: <code>ARM_FIR_FFT_STATE_SIZE</code> and
+                   <code>ARM_FIR_FFT_COEFFS_SIZE</code> for a partition length,
+                   <code>numTaps+blockSize-1</code> state samples for the direct form.
+ */
+uint16_t arm_fir_auto_part_len_f32(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  float32_t fftCost = ARM_FIR_AUTO_FFT_COST, partCost = ARM_FIR_AUTO_PART_COST;
+  float32_t best = (float32_t) numTaps, cost;
+  uint32_t partLen, log2Fft, bestLen = 0U;
+
+#if defined(ARM_MATH_X86) && !defined(ARM_FIR_AUTO_COSTS_OVERRIDDEN)
+  fftCost = arm_fir_auto_costs_x86[arm_x86_get_level()][0];
+  partCost = arm_fir_auto_costs_x86[arm_x86_get_level()][1];
+#endif
+
+  for (partLen = 16U, log2Fft = 5U; partLen <= 2048U; partLen <<= 1U, log2Fft++)
+  {
+    if ((blockSize % partLen) != 0U)
+    {
+      break;
+    }
+
+    cost = fftCost * (float32_t) log2Fft
+         + partCost * (float32_t) ARM_FIR_FFT_NUM_PARTS(numTaps, partLen);
+    if (cost < best)
+    {
+      best = cost;
+      bestLen = partLen;
+    }
+  }
+
+  return (uint16_t) bestLen;
+}
+
+/**
+  @brief         Initialization function for the floating-point FIR filter with automatic choice of algorithm.
+  @param[in,out] S            points to an instance of the filter structure
+  @param[in]     numTaps      number of filter coefficients in the filter
+  @param[in]     pCoeffs      points to the filter coefficients, in the order of \ref arm_fir_init_f32
+  @param[out]    pCoeffsFreq  points to the buffer for the filter spectra, unused by the direct form
+  @param[in]     pState       points to the state buffer
+  @param[in]     blockSize    number of samples processed per call
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : no taps
+
+  @par           Details
+                   Uses the partitioned FFT filter when \ref arm_fir_auto_part_len_f32
+                   returns a partition length, \ref arm_fir_f32 otherwise; that function
+                   also gives the sizes of the buffers. The direct form keeps
+                   <code>pCoeffs</code>, the FFT form only needs it during this call.
+ */
+arm_status arm_fir_auto_init_f32(
+        arm_fir_auto_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffsFreq,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  uint16_t partLen = arm_fir_auto_part_len_f32(numTaps, blockSize);
+
+  if (numTaps == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->partLen = partLen;
+  if (partLen != 0U)
+  {
+    return arm_fir_fft_init_f32(&S->fft, numTaps, pCoeffs, partLen, pCoeffsFreq, pState);
+  }
+
+  arm_fir_init_f32(&S->fir, numTaps, pCoeffs, pState, blockSize);
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIR_FFT group
+ */
@@ -28,6 +28,10 @@
 
 #include "dsp/filtering_functions.h"
 
+#if defined(ARM_MATH_X86)
+#include "arm_x86_kernels.h"
+#endif
+
 /**
   @ingroup groupFilters
  */
@@ -927,6 +931,19 @@ void arm_fir_f32(
         float32_t c0;                                           /* Temporary variable to hold coefficient value */
 #endif
 
+#if defined(ARM_MATH_X86)
+  if (arm_x86_get_level() >= ARM_X86_LEVEL_AVX2)
+  {
+    arm_fir_f32_avx2(S, pSrc, pDst, blockSize);
+    return;
+  }
+  if (arm_x86_get_level() >= ARM_X86_LEVEL_SSE2)
+  {
+    arm_fir_f32_sse2(S, pSrc, pDst, blockSize);
+    return;
+  }
+#endif
+
   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1U)]);
@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_f32.c
+ * Description:  Floating-point FIR filter, uniformly partitioned overlap-save convolution
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_FFT Partitioned FFT FIR Filter
+
+  FIR filter computed by fast convolution, for long filters (reverberation,
+  room correction, 1000 taps and more) where the direct form of
+  \ref arm_fir_f32 costs <code>numTaps</code> multiply-accumulates per sample.
+
+  The implementation is uniformly partitioned overlap-save. The impulse
+  response is split into partitions of <code>partLen</code> taps, each
+  transformed once at init by a real FFT of <code>2*partLen</code> points.
+  Every block of <code>partLen</code> input samples is transformed once and
+  pushed into a frequency-domain delay line; the output block is the inverse
+  FFT of the sum of the last <code>numParts</code> input spectra, each
+  multiplied by the spectrum of its partition. The cost per sample is two
+  FFTs of <code>2*partLen</code> points divided by <code>partLen</code>,
+  plus about <code>4*numTaps/partLen</code> multiply-accumulates.
+
+  The output is the same as \ref arm_fir_f32 with the same coefficients,
+  to within floating-point rounding, with no added delay: the only latency
+  is that samples are processed a partition at a time. Smaller partitions
+  lower that latency at the cost of more spectral work per sample.
+
+  \ref arm_fir_auto_init_f32 picks between this and the direct form from
+  the filter length and the block size.
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/*
+ * pAcc (+)= pX * pH on spectra in the packed format of arm_rfft_fast_f32:
+ * the first pair holds the real DC and Nyquist bins, then complex bins.
+ */
+__STATIC_FORCEINLINE void arm_fir_fft_cmac_f32(
+  const float32_t * pX,
+  const float32_t * pH,
+        float32_t * pAcc,
+        uint32_t fftLen,
+        uint32_t accumulate)
+{
+  uint32_t k;
+
+  if (accumulate)
+  {
+    pAcc[0] += pX[0] * pH[0];
+    pAcc[1] += pX[1] * pH[1];
+    for (k = 2U; k < fftLen; k += 2U)
+    {
+      float32_t xr = pX[k], xi = pX[k + 1U], hr = pH[k], hi = pH[k + 1U];
+
+      pAcc[k]      += xr * hr - xi * hi;
+      pAcc[k + 1U] += xr * hi + xi * hr;
+    }
+  }
+  else
+  {
+    pAcc[0] = pX[0] * pH[0];
+    pAcc[1] = pX[1] * pH[1];
+    for (k = 2U; k < fftLen; k += 2U)
+    {
+      float32_t xr = pX[k], xi = pX[k + 1U], hr = pH[k], hi = pH[k + 1U];
+
+      pAcc[k]      = xr * hr - xi * hi;
+      pAcc[k + 1U] = xr * hi + xi * hr;
+    }
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point partitioned FFT FIR filter.
+  @param[in]     S          points to an instance of the filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process, a multiple of <code>partLen</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS     : Operation successful
+                   - \ref ARM_MATH_LENGTH_ERROR : <code>blockSize</code> not a multiple of <code>partLen</code>
+ */
+arm_status arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t partLen = S->partLen, fftLen = 2U * partLen;
+  uint32_t numParts = S->numParts;
+  float32_t *pHist = S->pState;                        /* last fftLen input samples */
+  float32_t *pFdl = pHist + fftLen;                    /* numParts input spectra */
+  float32_t *pAcc = pFdl + numParts * fftLen;          /* output spectrum */
+  float32_t *pTmp = pAcc + fftLen;                     /* FFT work buffer */
+  uint32_t blkCnt, part, slot;
+
+  if ((blockSize % partLen) != 0U)
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  for (blkCnt = blockSize / partLen; blkCnt > 0U; blkCnt--)
+  {
+    /* Slide the input window by one partition */
+    memcpy(pHist, pHist + partLen, partLen * sizeof(float32_t));
+    memcpy(pHist + partLen, pSrc, partLen * sizeof(float32_t));
+
+    /* Newest spectrum replaces the oldest one in the delay line */
+    slot = S->fdlIndex;
+    memcpy(pTmp, pHist, fftLen * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->rfft, pTmp, pFdl + slot * fftLen, 0U);
+
+    /* Y = sum over partitions p of X(block - p) * H(p) */
+    for (part = 0U; part < numParts; part++)
+    {
+      arm_fir_fft_cmac_f32(pFdl + slot * fftLen, S->pCoeffsFreq + part * fftLen,
+                           pAcc, fftLen, part);
+      slot = (slot == 0U) ? numParts - 1U : slot - 1U;
+    }
+
+    /* Circular wrap-around is in the first half, the second half is the output */
+    arm_rfft_fast_f32(&S->rfft, pAcc, pTmp, 1U);
+    memcpy(pDst, pTmp + partLen, partLen * sizeof(float32_t));
+
+    S->fdlIndex = (S->fdlIndex + 1U == numParts) ? 0U : S->fdlIndex + 1U;
+    pSrc += partLen;
+    pDst += partLen;
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIR_FFT group
+ */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_init_f32.c
+ * Description:  Initialization function for the floating-point partitioned FFT FIR filter
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point partitioned FFT FIR filter.
+  @param[in,out] S            points to an instance of the filter structure
+  @param[in]     numTaps      number of filter coefficients in the filter
+  @param[in]     pCoeffs      points to the filter coefficients, in the order of \ref arm_fir_init_f32
+  @param[in]     partLen      partition length: samples per processing step, 16 to 2048, a power of 2
+  @param[out]    pCoeffsFreq  points to the buffer receiving the filter spectra,
+                              of length <code>ARM_FIR_FFT_COEFFS_SIZE(numTaps, partLen)</code>
+  @param[in]     pState       points to the state buffer,
+                              of length <code>ARM_FIR_FFT_STATE_SIZE(numTaps, partLen)</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>partLen</code> not supported or no taps
+
+  @par           Details
+                   The filter is split into <code>numParts = ceil(numTaps / partLen)</code>
+                   partitions of <code>partLen</code> taps. Their spectra, each a real FFT of
+                   <code>2*partLen</code> points, are computed once here. <code>pCoeffs</code>
+                   is not used after this call.
+  @par
+                   The state buffer holds the last <code>2*partLen</code> input samples, the
+                   frequency-domain delay line (the spectra of the last <code>numParts</code>
+                   input blocks) and two FFT work buffers.
+ */
+arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        uint16_t partLen,
+        float32_t * pCoeffsFreq,
+        float32_t * pState)
+{
+  uint32_t fftLen = 2U * (uint32_t) partLen;
+  uint32_t numParts, part, n, tap;
+  float32_t *pTmp;
+  arm_status status;
+
+  if (numTaps == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  status = arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  numParts = ((uint32_t) numTaps + partLen - 1U) / partLen;
+
+  S->numTaps = numTaps;
+  S->partLen = partLen;
+  S->numParts = (uint16_t) numParts;
+  S->fdlIndex = 0U;
+  S->pCoeffsFreq = pCoeffsFreq;
+  S->pState = pState;
+
+  /* Clear input history and delay line, the work buffers need no clearing */
+  memset(pState, 0, (numParts + 1U) * fftLen * sizeof(float32_t));
+
+  /* Spectrum of each partition of the impulse response, zero-padded to fftLen */
+  pTmp = pState + (numParts + 1U) * fftLen;
+  for (part = 0U; part < numParts; part++)
+  {
+    for (n = 0U; n < fftLen; n++)
+    {
+      /* Impulse response h[k] = pCoeffs[numTaps - 1 - k] */
+      tap = part * partLen + n;
+      pTmp[n] = (n < partLen && tap < numTaps) ? pCoeffs[numTaps - 1U - tap] : 0.0f;
+    }
+    arm_rfft_fast_f32(&S->rfft, pTmp, pCoeffsFreq + part * fftLen, 0U);
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIR_FFT group
+ */
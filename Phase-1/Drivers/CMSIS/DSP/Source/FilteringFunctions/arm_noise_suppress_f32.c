@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_noise_suppress_f32.c
+ * Description:  Floating-point STFT-domain noise suppressor
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup NoiseSuppression Spectral Noise Suppression
+
+  Single-microphone suppression of stationary background noise (fans,
+  road and room noise, hum), for the capture path of calls and speech
+  recognition.
+
+  The input is cut in frames of <code>hopLen</code> samples (10 ms is the
+  usual choice); each frame and the previous one are windowed by a
+  square-root Hann window and transformed by \ref arm_rfft_fast_f32. For
+  every frequency bin:
+  - the magnitude (\ref arm_cmplx_mag_f32) is smoothed over about 20 ms
+    and the noise floor follows its minimum: it drops towards the
+    smoothed magnitude as soon as it is above it and otherwise rises by at
+    most <code>noiseUp</code> per frame, slowly enough that it does not
+    follow speech but does follow a change of the noise level;
+  - the a-priori SNR is estimated by the decision-directed rule of
+    Ephraim and Malah from the current frame and the clean estimate of
+    the previous one, and turned into a Wiener gain <code>xi/(1+xi)</code>
+    floored at <code>gainMin</code>;
+  - the gain is smoothed across neighbouring bins and in time, with a fast
+    attack and a slower release, which removes most of the isolated
+    spectral peaks heard as musical noise.
+
+  The weighted spectrum is transformed back and overlap-added with the
+  same window. With no attenuation the output is the input delayed by
+  <code>hopLen</code> samples. Memory is fixed at initialization and the
+  cost per frame does not depend on the signal: two FFTs of
+  <code>fftLen</code> points and a few operations per bin.
+
+  The Q15 version has samples, windows and gains in Q15 and keeps the
+  spectra in Q31: the scaling of the Q15 FFT would cost about 7 bits of
+  precision over the round trip at 512 points.
+ */
+
+/**
+  @addtogroup NoiseSuppression
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point spectral noise suppressor.
+  @param[in,out] S          points to an instance of the noise suppressor structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the block of output samples
+  @param[in]     blockSize  number of samples to process, a multiple of <code>hopLen</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS      : Operation successful
+                   - \ref ARM_MATH_LENGTH_ERROR : <code>blockSize</code> is not a multiple of <code>hopLen</code>
+
+  @par           Details
+                   The output is delayed by <code>hopLen</code> samples.
+                   <code>pSrc</code> and <code>pDst</code> can be the same buffer.
+                   <code>meanGain</code> holds the mean gain of the last frame,
+                   close to <code>gainMin</code> in noise and to 1 in speech.
+ */
+arm_status arm_noise_suppress_f32(
+        arm_noise_suppress_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const uint32_t H = S->hopLen;                /* Hop length */
+  const uint32_t N = S->fftLen;                /* FFT length */
+  const uint32_t K = N / 2U + 1U;              /* Number of bins */
+  float32_t *pWindow  = S->pState;             /* Analysis and synthesis window, 2*H */
+  float32_t *pInput   = pWindow + 2U * H;      /* Previous input hop */
+  float32_t *pOverlap = pInput + H;            /* Overlap-add tail */
+  float32_t *pSmooth  = pOverlap + H;          /* Smoothed magnitude */
+  float32_t *pNoise   = pSmooth + K;           /* Noise magnitude floor */
+  float32_t *pClean   = pNoise + K;            /* Clean magnitude of the previous frame */
+  float32_t *pGain    = pClean + K;            /* Smoothed gain */
+  float32_t *pMag     = pGain + K;             /* Magnitude of the frame */
+  float32_t *pRaw     = pMag + K;              /* Gain of the frame before smoothing */
+  float32_t *pFrame   = pRaw + K;              /* Windowed frame, N */
+  float32_t *pSpec    = pFrame + N;            /* Spectrum, N */
+  float32_t smooth = S->smooth, noiseUp = S->noiseUp, noiseDown = S->noiseDown;
+  float32_t bias2 = S->noiseBias * S->noiseBias;
+  float32_t alpha = S->ddAlpha, gainMin = S->gainMin;
+  float32_t attack = S->attack, release = S->release;
+  float32_t mag, lambda, snrPost, snrPrio, g, prev, cur;
+  uint32_t k, blk, initializing;
+
+  if (blockSize % H != 0U)
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  for (blk = 0U; blk < blockSize; blk += H)
+  {
+    /* Window the previous and the new hop, zero-pad to N */
+    arm_mult_f32(pInput, pWindow, pFrame, H);
+    arm_mult_f32(pSrc + blk, pWindow + H, pFrame + H, H);
+    memset(pFrame + 2U * H, 0, (N - 2U * H) * sizeof(float32_t));
+    memcpy(pInput, pSrc + blk, H * sizeof(float32_t));
+
+    arm_rfft_fast_f32(&S->rfft, pFrame, pSpec, 0U);
+
+    /* Magnitudes; DC and Nyquist are packed in the first pair */
+    pMag[0] = fabsf(pSpec[0]);
+    pMag[K - 1U] = fabsf(pSpec[1]);
+    arm_cmplx_mag_f32(pSpec + 2, pMag + 1, K - 2U);
+
+    /* Noise floor */
+    initializing = (S->frameCount < S->initFrames);
+    if (initializing)
+    {
+      /* Running mean of the first frames, taken as noise */
+      float32_t w = 1.0f / (float32_t) (S->frameCount + 1U);
+
+      for (k = 0U; k < K; k++)
+      {
+        pSmooth[k] += w * (pMag[k] - pSmooth[k]);
+        pNoise[k] = pSmooth[k];
+      }
+      S->frameCount++;
+    }
+    else
+    {
+      for (k = 0U; k < K; k++)
+      {
+        cur = smooth * pSmooth[k] + (1.0f - smooth) * pMag[k];
+        pSmooth[k] = cur;
+        if (cur < pNoise[k])
+        {
+          pNoise[k] = noiseDown * pNoise[k] + (1.0f - noiseDown) * cur;
+        }
+        else
+        {
+          pNoise[k] *= noiseUp;
+        }
+      }
+    }
+
+    /* Decision-directed a-priori SNR and Wiener gain */
+    for (k = 0U; k < K; k++)
+    {
+      mag = pMag[k];
+      lambda = pNoise[k] * pNoise[k] * (initializing ? 1.0f : bias2) + 1.0e-20f;
+      snrPost = mag * mag / lambda;
+      snrPrio = alpha * pClean[k] * pClean[k] / lambda;
+      if (snrPost > 1.0f)
+      {
+        snrPrio += (1.0f - alpha) * (snrPost - 1.0f);
+      }
+      g = snrPrio / (1.0f + snrPrio);
+      pClean[k] = g * mag;
+      pRaw[k] = (g > gainMin) ? g : gainMin;
+    }
+
+    /* Smooth the gain across bins [1/4 1/2 1/4], then in time */
+    prev = pRaw[0];
+    for (k = 0U; k < K; k++)
+    {
+      cur = pRaw[k];
+      g = 0.5f * cur + 0.25f * (prev + ((k + 1U < K) ? pRaw[k + 1U] : cur));
+      prev = cur;
+      cur = pGain[k];
+      pGain[k] = (g > cur) ? attack * cur + (1.0f - attack) * g
+                           : release * cur + (1.0f - release) * g;
+    }
+    arm_mean_f32(pGain, K, &S->meanGain);
+
+    /* Apply: complex bins scaled by real gains, DC and Nyquist apart */
+    pSpec[0] *= pGain[0];
+    pSpec[1] *= pGain[K - 1U];
+    arm_cmplx_mult_real_f32(pSpec + 2, pGain + 1, pSpec + 2, K - 2U);
+
+    arm_rfft_fast_f32(&S->rfft, pSpec, pFrame, 1U);
+
+    /* Synthesis window and overlap-add */
+    arm_mult_f32(pFrame, pWindow, pFrame, 2U * H);
+    arm_add_f32(pFrame, pOverlap, pDst + blk, H);
+    memcpy(pOverlap, pFrame + H, H * sizeof(float32_t));
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of NoiseSuppression group
+ */
@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_noise_suppress_init_f32.c
+ * Description:  Initialization function for the floating-point spectral noise suppressor
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup NoiseSuppression
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point spectral noise suppressor.
+  @param[in,out] S           points to an instance of the noise suppressor structure
+  @param[in]     hopLen      samples per frame, 16 to 2048. 160 is 10 ms at 16 kHz
+  @param[in]     sampleRate  sample rate in Hz, sets the time constants below
+  @param[in]     pState      points to the state buffer,
+                             of length <code>ARM_NS_STATE_SIZE_F32(hopLen)</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>hopLen</code> or <code>sampleRate</code> not supported
+
+  @par           Details
+                   The analysis and synthesis windows are square-root Hann of
+                   <code>2*hopLen</code> points. The tuning gets defaults for
+                   speech; they are plain fields of the instance and can be
+                   changed after this call:
+                   - <code>initFrames</code>: the first 100 ms are taken as noise
+                   - <code>noiseUp</code>: the noise estimate rises by at most 5 dB/s
+                   - <code>gainMin</code> = 0.125: at most 18 dB of attenuation
+                   - <code>attack</code>, <code>release</code>: the gain rises with a
+                     5 ms time constant and falls with a 40 ms one
+ */
+arm_status arm_noise_suppress_init_f32(
+        arm_noise_suppress_instance_f32 * S,
+        uint16_t hopLen,
+        uint32_t sampleRate,
+        float32_t * pState)
+{
+  uint32_t winLen = 2U * (uint32_t) hopLen;
+  uint32_t fftLen;
+  float32_t hopSec;
+  arm_status status;
+  uint32_t n;
+
+  if (hopLen < 16U || hopLen > 2048U || sampleRate == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  fftLen = ARM_NS_FFT_LEN(hopLen);
+  status = arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  S->hopLen = hopLen;
+  S->fftLen = (uint16_t) fftLen;
+  S->pState = pState;
+  hopSec = (float32_t) hopLen / (float32_t) sampleRate;
+
+  S->initFrames = (uint16_t) ceilf(0.1f / hopSec);
+  if (S->initFrames == 0U)
+  {
+    S->initFrames = 1U;
+  }
+  S->frameCount = 0U;
+
+  S->smooth = expf(-hopSec / 0.02f);
+  S->noiseUp = powf(10.0f, 5.0f / 20.0f * hopSec);
+  S->noiseDown = expf(-hopSec / 0.03f);
+  S->noiseBias = 1.2f;
+  S->ddAlpha = 0.98f;
+  S->gainMin = 0.125f;
+  S->attack = expf(-hopSec / 0.005f);
+  S->release = expf(-hopSec / 0.04f);
+  S->meanGain = 1.0f;
+
+  memset(pState, 0, ARM_NS_STATE_SIZE_F32(hopLen) * sizeof(float32_t));
+
+  /* Square-root periodic Hann: w[n]^2 + w[n + hopLen]^2 = 1 */
+  for (n = 0U; n < winLen; n++)
+  {
+    pState[n] = sinf(PI * ((float32_t) n + 0.5f) / (float32_t) winLen);
+  }
+
+  /* Gains start at unity */
+  arm_fill_f32(1.0f, pState + 4U * hopLen + 3U * (fftLen / 2U + 1U), fftLen / 2U + 1U);
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of NoiseSuppression group
+ */
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_noise_suppress_init_q15.c
+ * Description:  Initialization function for the Q15 spectral noise suppressor
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup NoiseSuppression
+  @{
+ */
+
+__STATIC_FORCEINLINE q15_t arm_ns_to_q15(float32_t x)
+{
+  return (q15_t) __SSAT((q31_t) roundf(x * 32768.0f), 16);
+}
+
+/**
+  @brief         Initialization function for the Q15 spectral noise suppressor.
+  @param[in,out] S           points to an instance of the noise suppressor structure
+  @param[in]     hopLen      samples per frame, 16 to 2048. 160 is 10 ms at 16 kHz
+  @param[in]     sampleRate  sample rate in Hz, sets the time constants
+  @param[in]     pState      points to the state buffer,
+                             of length <code>ARM_NS_STATE_SIZE_Q15(hopLen)</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>hopLen</code> or <code>sampleRate</code> not supported
+
+  @par           Details
+                   Same defaults as \ref arm_noise_suppress_init_f32, rounded to Q15.
+                   <code>noiseUp</code> and <code>noiseBias</code> hold the factor minus one.
+                   The window and the factors are computed once here in floating-point.
+ */
+arm_status arm_noise_suppress_init_q15(
+        arm_noise_suppress_instance_q15 * S,
+        uint16_t hopLen,
+        uint32_t sampleRate,
+        q31_t * pState)
+{
+  uint32_t winLen = 2U * (uint32_t) hopLen;
+  uint32_t fftLen, numBins;
+  float32_t hopSec;
+  q15_t *pGain, *pWindow;
+  arm_status status;
+  uint32_t n;
+
+  if (hopLen < 16U || hopLen > 2048U || sampleRate == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  fftLen = ARM_NS_FFT_LEN(hopLen);
+  numBins = fftLen / 2U + 1U;
+  status = arm_rfft_init_q31(&S->rfft, fftLen, 0U, 1U);
+  if (status == ARM_MATH_SUCCESS)
+  {
+    status = arm_rfft_init_q31(&S->rifft, fftLen, 1U, 1U);
+  }
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  S->hopLen = hopLen;
+  S->fftLen = (uint16_t) fftLen;
+  S->log2FftLen = (uint8_t) (31U - __CLZ(fftLen));
+  S->pState = pState;
+  hopSec = (float32_t) hopLen / (float32_t) sampleRate;
+
+  S->initFrames = (uint16_t) ceilf(0.1f / hopSec);
+  if (S->initFrames == 0U)
+  {
+    S->initFrames = 1U;
+  }
+  S->frameCount = 0U;
+
+  S->smooth = arm_ns_to_q15(expf(-hopSec / 0.02f));
+  S->noiseUp = arm_ns_to_q15(powf(10.0f, 5.0f / 20.0f * hopSec) - 1.0f);
+  S->noiseDown = arm_ns_to_q15(expf(-hopSec / 0.03f));
+  S->noiseBias = arm_ns_to_q15(0.2f);
+  S->ddAlpha = arm_ns_to_q15(0.98f);
+  S->gainMin = arm_ns_to_q15(0.125f);
+  S->attack = arm_ns_to_q15(expf(-hopSec / 0.005f));
+  S->release = arm_ns_to_q15(expf(-hopSec / 0.04f));
+  S->meanGain = 0x7FFF;
+
+  memset(pState, 0, ARM_NS_STATE_SIZE_Q15(hopLen) * sizeof(q31_t));
+
+  /* Q15 part after the Q31 one: gain, raw gain, window, ... */
+  pGain = (q15_t *) (pState + 4U * numBins + 3U * fftLen);
+  pWindow = pGain + 2U * numBins;
+
+  for (n = 0U; n < numBins; n++)
+  {
+    pGain[n] = 0x7FFF;
+  }
+
+  for (n = 0U; n < winLen; n++)
+  {
+    pWindow[n] = arm_ns_to_q15(sinf(PI * ((float32_t) n + 0.5f) / (float32_t) winLen));
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of NoiseSuppression group
+ */
@@ -0,0 +1,216 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_noise_suppress_q15.c
+ * Description:  Q15 STFT-domain noise suppressor
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup NoiseSuppression
+  @{
+ */
+
+/* a + (b - a) * c, c in Q15 */
+__STATIC_FORCEINLINE q31_t arm_ns_lerp_q31(q31_t a, q31_t b, q15_t c)
+{
+  return a + (q31_t) (((q63_t) (b - a) * c) >> 15);
+}
+
+/* Amplitude ratio num / den in Q8, saturated to 0xFFFF (48 dB) */
+__STATIC_FORCEINLINE uint32_t arm_ns_ratio_q8(q31_t num, q31_t den)
+{
+  uint64_t r = ((uint64_t) (uint32_t) num << 8) / ((uint64_t) (uint32_t) den + 1U);
+
+  return (r > 0xFFFFU) ? 0xFFFFU : (uint32_t) r;
+}
+
+/**
+  @brief         Processing function for the Q15 spectral noise suppressor.
+  @param[in,out] S          points to an instance of the noise suppressor structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the block of output samples
+  @param[in]     blockSize  number of samples to process, a multiple of <code>hopLen</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS      : Operation successful
+                   - \ref ARM_MATH_LENGTH_ERROR : <code>blockSize</code> is not a multiple of <code>hopLen</code>
+
+  @par           Scaling and Overflow Behavior
+                   Frames are windowed into Q31 and transformed by \ref arm_rfft_q31,
+                   which scales the spectrum down by <code>fftLen</code>; the
+                   inverse scales down by <code>fftLen</code> again and the output
+                   is shifted back. Magnitudes are in 2.30 format and SNRs in
+                   unsigned Q16, with the amplitude ratios saturated at 48 dB.
+                   The overlap-add saturates.
+
+  @par           Details
+                   Same algorithm and delay as \ref arm_noise_suppress_f32.
+                   <code>pSrc</code> and <code>pDst</code> can be the same buffer.
+ */
+arm_status arm_noise_suppress_q15(
+        arm_noise_suppress_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  const uint32_t H = S->hopLen;                /* Hop length */
+  const uint32_t N = S->fftLen;                /* FFT length */
+  const uint32_t K = N / 2U + 1U;              /* Number of bins */
+  const uint32_t outShift = 31U - S->log2FftLen;   /* Window product and inverse FFT scaling */
+  q31_t *pSmooth  = S->pState;                 /* Smoothed magnitude */
+  q31_t *pNoise   = pSmooth + K;               /* Noise magnitude floor */
+  q31_t *pClean   = pNoise + K;                /* Clean magnitude of the previous frame */
+  q31_t *pMag     = pClean + K;                /* Magnitude of the frame */
+  q31_t *pFrame   = pMag + K;                  /* Windowed frame, N */
+  q31_t *pSpec    = pFrame + N;                /* Spectrum, 2*N */
+  q15_t *pGain    = (q15_t *) (pSpec + 2U * N);    /* Smoothed gain */
+  q15_t *pRaw     = pGain + K;                 /* Gain of the frame before smoothing */
+  q15_t *pWindow  = pRaw + K;                  /* Analysis and synthesis window, 2*H */
+  q15_t *pInput   = pWindow + 2U * H;          /* Previous input hop */
+  q15_t *pOverlap = pInput + H;                /* Overlap-add tail */
+  q15_t smooth = S->smooth, noiseUp = S->noiseUp, noiseDown = S->noiseDown;
+  q15_t bias = S->noiseBias, alpha = S->ddAlpha, gainMin = S->gainMin;
+  q15_t attack = S->attack, release = S->release;
+  q31_t mag, cur, noise;
+  q15_t g, prev, sm;
+  uint32_t snrPost, r;
+  uint64_t snrPrio;
+  uint32_t k, n, blk, initializing;
+
+  if (blockSize % H != 0U)
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  for (blk = 0U; blk < blockSize; blk += H)
+  {
+    /* Window the previous and the new hop into Q31, zero-pad to N */
+    for (n = 0U; n < H; n++)
+    {
+      pFrame[n]     = ((q31_t) pInput[n] * pWindow[n]) << 1;
+      pFrame[n + H] = ((q31_t) pSrc[blk + n] * pWindow[n + H]) << 1;
+    }
+    memset(pFrame + 2U * H, 0, (N - 2U * H) * sizeof(q31_t));
+    memcpy(pInput, pSrc + blk, H * sizeof(q15_t));
+
+    /* Bin k at pSpec[2k], pSpec[2k + 1], DC and Nyquist included */
+    arm_rfft_q31(&S->rfft, pFrame, pSpec);
+    arm_cmplx_mag_q31(pSpec, pMag, K);
+
+    /* Noise floor */
+    initializing = (S->frameCount < S->initFrames);
+    if (initializing)
+    {
+      for (k = 0U; k < K; k++)
+      {
+        pSmooth[k] += (pMag[k] - pSmooth[k]) / (q31_t) (S->frameCount + 1U);
+        pNoise[k] = pSmooth[k];
+      }
+      S->frameCount++;
+    }
+    else
+    {
+      for (k = 0U; k < K; k++)
+      {
+        cur = arm_ns_lerp_q31(pMag[k], pSmooth[k], smooth);
+        pSmooth[k] = cur;
+        noise = pNoise[k];
+        if (cur < noise)
+        {
+          noise = arm_ns_lerp_q31(cur, noise, noiseDown);
+        }
+        else
+        {
+          noise += (q31_t) (((q63_t) noise * noiseUp) >> 15) + 1;
+        }
+        pNoise[k] = (noise > 0x3FFFFFFF) ? 0x3FFFFFFF : noise;
+      }
+    }
+
+    /* Decision-directed a-priori SNR and Wiener gain */
+    for (k = 0U; k < K; k++)
+    {
+      mag = pMag[k];
+      noise = pNoise[k];
+      if (!initializing)
+      {
+        noise += (q31_t) (((q63_t) noise * bias) >> 15);
+      }
+
+      r = arm_ns_ratio_q8(mag, noise);
+      snrPost = r * r;
+      r = arm_ns_ratio_q8(pClean[k], noise);
+      snrPrio = ((uint64_t) (r * r) * (uint32_t) alpha) >> 15;
+      if (snrPost > 0x10000U)
+      {
+        snrPrio += ((uint64_t) (snrPost - 0x10000U) * (uint32_t) (0x8000 - alpha)) >> 15;
+      }
+
+      g = (q15_t) ((snrPrio << 15) / (snrPrio + 0x10000U));
+      pClean[k] = (q31_t) (((q63_t) mag * g) >> 15);
+      pRaw[k] = (g > gainMin) ? g : gainMin;
+    }
+
+    /* Smooth the gain across bins [1/4 1/2 1/4], then in time */
+    prev = pRaw[0];
+    for (k = 0U; k < K; k++)
+    {
+      q31_t c = pRaw[k];
+      q31_t next = (k + 1U < K) ? pRaw[k + 1U] : c;
+
+      g = (q15_t) ((2 * c + prev + next + 2) >> 2);
+      prev = (q15_t) c;
+      sm = pGain[k];
+      pGain[k] = (q15_t) arm_ns_lerp_q31(g, sm, (g > sm) ? attack : release);
+    }
+    arm_mean_q15(pGain, K, &S->meanGain);
+
+    /* Apply, DC and Nyquist have a zero imaginary part */
+    for (k = 0U; k < K; k++)
+    {
+      pSpec[2U * k]      = (q31_t) (((q63_t) pSpec[2U * k] * pGain[k]) >> 15);
+      pSpec[2U * k + 1U] = (q31_t) (((q63_t) pSpec[2U * k + 1U] * pGain[k]) >> 15);
+    }
+
+    /* The inverse gives the Q31 frame / N, so y * w is x * w^2 in Q15 shifted up by 31 - log2(N) */
+    arm_rfft_q31(&S->rifft, pSpec, pFrame);
+
+    for (n = 0U; n < H; n++)
+    {
+      q63_t y0 = ((q63_t) pFrame[n] * pWindow[n]) >> outShift;
+      q63_t y1 = ((q63_t) pFrame[n + H] * pWindow[n + H]) >> outShift;
+
+      pDst[blk + n] = (q15_t) __SSAT((q31_t) y0 + pOverlap[n], 16);
+      pOverlap[n] = (q15_t) __SSAT((q31_t) y1, 16);
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of NoiseSuppression group
+ */
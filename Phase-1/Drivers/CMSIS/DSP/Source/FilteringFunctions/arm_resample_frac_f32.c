@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_frac_f32.c
+ * Description:  Floating-point fractional resampler with a precomputed phase table
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point fractional resampler.
+  @param[in,out] S          points to an instance of the resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data,
+                            of length <code>ARM_RESAMPLE_MAX_OUTPUT(inRate, outRate, blockSize)</code>
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written
+
+  @par           Details
+                   Each output sample is computed with the two phases of the table that
+                   surround its position and interpolated linearly, for twice the
+                   multiply-accumulates of \ref arm_resample_poly_f32 at the same quality.
+ */
+uint32_t arm_resample_frac_f32(
+        arm_resample_frac_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Phase table pointer */
+        uint32_t phaseLen = S->phaseLength;            /* Taps per phase */
+        uint32_t shift = S->phaseShift;                /* log2 of the number of phases */
+        uint32_t stepInt = S->stepInt;                 /* Input samples per output, integer part */
+        uint32_t stepFrac = S->stepFrac;               /* and fractional part */
+        uint32_t stepRem = S->stepRem;                 /* What stepFrac drops, in 1/outRate */
+        uint32_t outRate = S->outRate;
+        uint32_t fracRem = S->fracRem;
+        uint32_t n = S->inIndex;                       /* Newest input of the next output */
+        uint32_t frac = S->frac;                       /* Position of the next output after it */
+        uint32_t outCnt = 0U;                          /* Output samples written */
+        uint32_t carry;                                /* Whole input sample crossed by frac */
+        uint32_t i, k;                                 /* Loop counters */
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    pState[phaseLen - 1U + i] = pSrc[i];
+  }
+
+  while (n < blockSize)
+  {
+    const float32_t *pX = pState + n;
+    const float32_t *pC0 = pCoeffs + (frac >> (32U - shift)) * phaseLen;
+    const float32_t *pC1 = pC0 + phaseLen;
+    float32_t acc0a = 0.0f, acc0b = 0.0f, acc1a = 0.0f, acc1b = 0.0f;
+    float32_t acc0, acc1, mu;
+
+    /* Weight of the upper phase, from the bits below the phase index */
+    mu = (float32_t) ((frac << shift) >> 8U) * (1.0f / 16777216.0f);
+
+    for (k = 0U; k + 1U < phaseLen; k += 2U)
+    {
+      acc0a += pX[k] * pC0[k];
+      acc1a += pX[k] * pC1[k];
+      acc0b += pX[k + 1U] * pC0[k + 1U];
+      acc1b += pX[k + 1U] * pC1[k + 1U];
+    }
+    if (k < phaseLen)
+    {
+      acc0a += pX[k] * pC0[k];
+      acc1a += pX[k] * pC1[k];
+    }
+
+    acc0 = acc0a + acc0b;
+    acc1 = acc1a + acc1b;
+    pDst[outCnt++] = acc0 + mu * (acc1 - acc0);
+
+    /* Advance by the step; the dropped remainder adds one LSB each time it reaches 1 */
+    frac += stepFrac;
+    carry = (frac < stepFrac) ? 1U : 0U;
+    fracRem += stepRem;
+    if (fracRem >= outRate)
+    {
+      fracRem -= outRate;
+      frac++;
+      carry |= (frac == 0U) ? 1U : 0U;
+    }
+    n += stepInt + carry;
+  }
+
+  S->inIndex = n - blockSize;
+  S->frac = frac;
+  S->fracRem = fracRem;
+
+  for (i = 0U; i < phaseLen - 1U; i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+
+  return outCnt;
+}
+
+/**
+  @} end of Resample group
+ */
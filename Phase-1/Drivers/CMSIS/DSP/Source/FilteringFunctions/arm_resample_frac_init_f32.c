@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_frac_init_f32.c
+ * Description:  Initialization functions for the floating-point fractional resampler
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+extern float32_t arm_resample_kernel_f32(
+  arm_resample_quality quality,
+  uint32_t phaseLength,
+  float32_t bandwidth,
+  float32_t u);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief         Changes the conversion ratio of a floating-point fractional resampler.
+  @param[in,out] S        points to an instance of the resampler structure
+  @param[in]     inRate   input sample rate
+  @param[in]     outRate  output sample rate
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a rate is zero
+
+  @par           Details
+                   Takes effect from the next output sample, without a discontinuity.
+                   The filter is not redesigned: meant for tracking a clock drift of
+                   a few hundred ppm, not for large changes of the ratio.
+ */
+arm_status arm_resample_frac_set_rates_f32(
+        arm_resample_frac_instance_f32 * S,
+        uint32_t inRate,
+        uint32_t outRate)
+{
+  if (inRate == 0U || outRate == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->stepInt = inRate / outRate;
+  S->stepFrac = (uint32_t) ((((uint64_t) (inRate % outRate)) << 32) / outRate);
+  S->stepRem = (uint32_t) ((((uint64_t) (inRate % outRate)) << 32) % outRate);
+  S->outRate = outRate;
+  if (S->fracRem >= outRate)
+  {
+    S->fracRem = 0U;
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Initialization function for the floating-point fractional resampler.
+  @param[in,out] S          points to an instance of the resampler structure
+  @param[in]     inRate     input sample rate
+  @param[in]     outRate    output sample rate
+  @param[in]     quality    filter quality, \ref ARM_RESAMPLE_FAST to \ref ARM_RESAMPLE_BEST
+  @param[out]    pCoeffs    points to the buffer receiving the phase table,
+                            of length <code>ARM_RESAMPLE_FRAC_COEFFS_SIZE(inRate, outRate, quality)</code>
+  @param[in]     pState     points to the state buffer,
+                            of length <code>ARM_RESAMPLE_STATE_SIZE(inRate, outRate, quality, blockSize)</code>
+  @param[in]     blockSize  largest number of input samples processed per call
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a rate is zero or the table is too long
+
+  @par           Details
+                   The table samples the interpolation kernel at
+                   <code>ARM_RESAMPLE_FRAC_PHASES(quality)</code> fractional positions per
+                   input sample, plus one for the end of the interval; output samples
+                   between two phases are interpolated linearly. The position is kept
+                   in Q32, and what the Q32 step drops is carried in units of
+                   1/outRate, so the ratio needs no reduction and the long-run
+                   ratio is exact: one second of 44100 Hz gives exactly 48000
+                   samples at 48000 Hz, however the input is split into blocks.
+ */
+arm_status arm_resample_frac_init_f32(
+        arm_resample_frac_instance_f32 * S,
+        uint32_t inRate,
+        uint32_t outRate,
+        arm_resample_quality quality,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  uint32_t phaseLen, numPhases, shift, p, j;
+  float32_t bandwidth;
+
+  if (inRate == 0U || outRate == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  phaseLen = ARM_RESAMPLE_PHASE_LEN(inRate, outRate, quality);
+  if (phaseLen == 0U || phaseLen > 0xFFFFU)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  numPhases = ARM_RESAMPLE_FRAC_PHASES(quality);
+  shift = 0U;
+  while ((1U << shift) < numPhases)
+  {
+    shift++;
+  }
+
+  bandwidth = (outRate < inRate) ? (float32_t) outRate / (float32_t) inRate : 1.0f;
+
+  /* Taps oldest first, as for arm_resample_poly_init_f32 */
+  for (p = 0U; p <= numPhases; p++)
+  {
+    for (j = 0U; j < phaseLen; j++)
+    {
+      pCoeffs[p * phaseLen + j] = arm_resample_kernel_f32(quality, phaseLen, bandwidth,
+                                    (float32_t) p / (float32_t) numPhases + (float32_t) (phaseLen - 1U - j));
+    }
+  }
+
+  S->phaseLength = (uint16_t) phaseLen;
+  S->phaseShift = (uint16_t) shift;
+  S->inIndex = 0U;
+  S->frac = 0U;
+  S->fracRem = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  arm_resample_frac_set_rates_f32(S, inRate, outRate);
+
+  memset(pState, 0, (phaseLen + blockSize - 1U) * sizeof(float32_t));
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Resample group
+ */
@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_frac_q15.c
+ * Description:  Q15 fractional resampler with a precomputed phase table
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 fractional resampler.
+  @param[in,out] S          points to an instance of the resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data,
+                            of length <code>ARM_RESAMPLE_MAX_OUTPUT(inRate, outRate, blockSize)</code>
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written
+
+  @par           Scaling and Overflow Behavior
+                   Both phases are accumulated in 64-bit accumulators in 2.30 format.
+                   They are interpolated with a Q15 weight, then the result is shifted
+                   right by 15 bits and saturated to 1.15 format.
+ */
+uint32_t arm_resample_frac_q15(
+        arm_resample_frac_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Phase table pointer */
+        uint32_t phaseLen = S->phaseLength;            /* Taps per phase */
+        uint32_t shift = S->phaseShift;                /* log2 of the number of phases */
+        uint32_t stepInt = S->stepInt;                 /* Input samples per output, integer part */
+        uint32_t stepFrac = S->stepFrac;               /* and fractional part */
+        uint32_t stepRem = S->stepRem;                 /* What stepFrac drops, in 1/outRate */
+        uint32_t outRate = S->outRate;
+        uint32_t fracRem = S->fracRem;
+        uint32_t n = S->inIndex;                       /* Newest input of the next output */
+        uint32_t frac = S->frac;                       /* Position of the next output after it */
+        uint32_t outCnt = 0U;                          /* Output samples written */
+        uint32_t carry;                                /* Whole input sample crossed by frac */
+        uint32_t i, blkCnt;                            /* Loop counters */
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    pState[phaseLen - 1U + i] = pSrc[i];
+  }
+
+  while (n < blockSize)
+  {
+    const q15_t *pX = pState + n;
+    const q15_t *pC0 = pCoeffs + (frac >> (32U - shift)) * phaseLen;
+    const q15_t *pC1 = pC0 + phaseLen;
+    q63_t acc0 = 0, acc1 = 0;
+    q31_t mu;
+
+    /* Weight of the upper phase in Q15 */
+    mu = (q31_t) ((frac << shift) >> 17U);
+
+#if defined (ARM_MATH_DSP)
+    blkCnt = phaseLen >> 1U;
+    while (blkCnt > 0U)
+    {
+      q31_t x = read_q15x2_ia(&pX);
+
+      acc0 = __SMLALD(x, read_q15x2_ia(&pC0), acc0);
+      acc1 = __SMLALD(x, read_q15x2_ia(&pC1), acc1);
+      blkCnt--;
+    }
+#else
+    blkCnt = phaseLen >> 1U;
+    while (blkCnt > 0U)
+    {
+      acc0 += (q31_t) pX[0] * pC0[0] + (q63_t) ((q31_t) pX[1] * pC0[1]);
+      acc1 += (q31_t) pX[0] * pC1[0] + (q63_t) ((q31_t) pX[1] * pC1[1]);
+      pX += 2;
+      pC0 += 2;
+      pC1 += 2;
+      blkCnt--;
+    }
+#endif
+    blkCnt = phaseLen & 1U;
+
+    while (blkCnt > 0U)
+    {
+      acc0 += (q31_t) *pX * *pC0++;
+      acc1 += (q31_t) *pX++ * *pC1++;
+      blkCnt--;
+    }
+
+    acc0 += ((acc1 - acc0) * mu) >> 15;
+    pDst[outCnt++] = (q15_t) __SSAT((acc0 >> 15), 16);
+
+    /* Advance by the step; the dropped remainder adds one LSB each time it reaches 1 */
+    frac += stepFrac;
+    carry = (frac < stepFrac) ? 1U : 0U;
+    fracRem += stepRem;
+    if (fracRem >= outRate)
+    {
+      fracRem -= outRate;
+      frac++;
+      carry |= (frac == 0U) ? 1U : 0U;
+    }
+    n += stepInt + carry;
+  }
+
+  S->inIndex = n - blockSize;
+  S->frac = frac;
+  S->fracRem = fracRem;
+
+  for (i = 0U; i < phaseLen - 1U; i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+
+  return outCnt;
+}
+
+/**
+  @} end of Resample group
+ */
@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_poly_f32.c
+ * Description:  Floating-point rational (L/M) polyphase resampler
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup Resample Sample Rate Conversion
+
+  Conversion between arbitrary sample rates, for example 44.1 kHz audio to
+  the 48 kHz of a codec, or 48 kHz to the 16 kHz of a speech front end.
+
+  Chaining \ref arm_fir_interpolate_f32 and \ref arm_fir_decimate_f32 does
+  this only for small factors: 44.1 kHz to 48 kHz is an interpolation by 160
+  followed by a decimation by 147, and the interpolator computes 159 of every
+  160 intermediate samples only for the decimator to drop 146 of every 147.
+  The converters here compute each output sample directly, as the dot product
+  of the last <code>phaseLength</code> input samples with the phase of the
+  interpolation filter that matches the output instant. The cost is
+  <code>phaseLength</code> multiply-accumulates per output sample, whatever
+  the ratio.
+
+  Two converters are provided:
+  - the rational resampler \ref arm_resample_poly_f32 converts by exactly
+    <code>L/M</code>, with a table of all <code>L</code> phases;
+  - the fractional resampler \ref arm_resample_frac_f32 keeps the output
+    position in Q32 and interpolates linearly between two of a fixed number
+    of phases. Its table does not grow with <code>L</code>, and its ratio
+    can be changed while running with \ref arm_resample_frac_set_rates_f32,
+    for example to follow the clock drift between two audio devices.
+
+  The \ref arm_resample_quality setting trades filter quality for CPU: it is
+  the number of taps per phase (8, 16 or 32) when upsampling. When
+  downsampling by <code>D</code>, the filter is <code>ceil(D)</code> times
+  longer to keep the same transition band relative to the output rate.
+
+  The converters are streaming: the number of input samples per call is
+  free (up to the <code>blockSize</code> given at init), each call returns
+  the number of output samples it wrote, at most
+  <code>ARM_RESAMPLE_MAX_OUTPUT(inRate, outRate, blockSize)</code>, and the
+  output is the same whatever the split of the input into blocks. The delay
+  is <code>phaseLength/2</code> input samples.
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+__STATIC_FORCEINLINE float32_t arm_resample_dot_f32(
+  const float32_t * pX,
+  const float32_t * pC,
+        uint32_t len)
+{
+  float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+  uint32_t blkCnt = len >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    acc0 += pX[0] * pC[0];
+    acc1 += pX[1] * pC[1];
+    acc2 += pX[2] * pC[2];
+    acc3 += pX[3] * pC[3];
+    pX += 4;
+    pC += 4;
+    blkCnt--;
+  }
+
+  blkCnt = len & 3U;
+  while (blkCnt > 0U)
+  {
+    acc0 += *pX++ * *pC++;
+    blkCnt--;
+  }
+
+  return (acc0 + acc1) + (acc2 + acc3);
+}
+
+/**
+  @brief         Processing function for the floating-point rational resampler.
+  @param[in,out] S          points to an instance of the resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data,
+                            of length <code>ARM_RESAMPLE_MAX_OUTPUT(M, L, blockSize)</code>
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written
+ */
+uint32_t arm_resample_poly_f32(
+        arm_resample_poly_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Phase table pointer */
+        uint32_t phaseLen = S->phaseLength;            /* Taps per phase */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t stepInt = S->M / L;                   /* Input samples per output, integer part */
+        uint32_t stepPhase = S->M % L;                 /* and remainder in phases */
+        uint32_t n = S->inIndex;                       /* Newest input of the next output */
+        uint32_t phase = S->phase;                     /* Phase of the next output */
+        uint32_t outCnt = 0U;                          /* Output samples written */
+        uint32_t i;                                    /* Loop counter */
+
+  /* Input sample k of the block is pState[phaseLen - 1 + k], after phaseLen - 1
+     samples of history */
+  for (i = 0U; i < blockSize; i++)
+  {
+    pState[phaseLen - 1U + i] = pSrc[i];
+  }
+
+  while (n < blockSize)
+  {
+    pDst[outCnt++] = arm_resample_dot_f32(pState + n, pCoeffs + phase * phaseLen, phaseLen);
+
+    n += stepInt;
+    phase += stepPhase;
+    if (phase >= L)
+    {
+      phase -= L;
+      n++;
+    }
+  }
+
+  S->inIndex = n - blockSize;
+  S->phase = (uint16_t) phase;
+
+  /* Keep the last phaseLen - 1 samples for the next call */
+  for (i = 0U; i < phaseLen - 1U; i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+
+  return outCnt;
+}
+
+/**
+  @} end of Resample group
+ */
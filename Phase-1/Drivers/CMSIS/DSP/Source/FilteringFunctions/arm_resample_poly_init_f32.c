@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_poly_init_f32.c
+ * Description:  Initialization function for the floating-point rational resampler
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/* Zeroth order modified Bessel function of the first kind, by its series */
+static float32_t arm_resample_bessel_i0_f32(float32_t x)
+{
+  float32_t sum = 1.0f, term = 1.0f, q = 0.25f * x * x;
+  uint32_t k;
+
+  for (k = 1U; k < 64U; k++)
+  {
+    term *= q / (float32_t)(k * k);
+    sum += term;
+    if (term < 1.0e-8f * sum)
+    {
+      break;
+    }
+  }
+  return sum;
+}
+
+/**
+  @brief         Value of the interpolation kernel of the sample rate converters.
+  @param[in]     quality      filter quality
+  @param[in]     phaseLength  taps per phase, the length of the kernel in input samples
+  @param[in]     bandwidth    min(1, outRate/inRate)
+  @param[in]     u            distance in input samples between the output instant and the tap
+  @return        kernel value
+
+  @par           Details
+                   Kaiser-windowed sinc centered on <code>phaseLength/2</code>, with unity
+                   gain at DC. The quality selects the window and how close to the
+                   Nyquist frequency of the slower rate the cutoff is.
+ */
+float32_t arm_resample_kernel_f32(
+  arm_resample_quality quality,
+  uint32_t phaseLength,
+  float32_t bandwidth,
+  float32_t u)
+{
+  float32_t beta, keep, fc, c, t, x, h;
+
+  switch (quality)
+  {
+  case ARM_RESAMPLE_FAST:
+    beta = 5.0f;
+    keep = 0.80f;
+    break;
+  case ARM_RESAMPLE_BEST:
+    beta = 9.0f;
+    keep = 0.92f;
+    break;
+  default:
+    beta = 7.0f;
+    keep = 0.88f;
+    break;
+  }
+
+  /* Cutoff in cycles per input sample, halfway into the transition band */
+  fc = 0.5f * bandwidth * (1.0f + keep) * 0.5f;
+  c = 0.5f * (float32_t) phaseLength;
+  t = u - c;
+  x = t / c;
+  if (x <= -1.0f || x >= 1.0f)
+  {
+    return 0.0f;
+  }
+
+  h = 2.0f * fc;
+  if (t != 0.0f)
+  {
+    h = sinf(2.0f * PI * fc * t) / (PI * t);
+  }
+
+  return h * arm_resample_bessel_i0_f32(beta * sqrtf(1.0f - x * x)) / arm_resample_bessel_i0_f32(beta);
+}
+
+/**
+  @brief         Initialization function for the floating-point rational resampler.
+  @param[in,out] S          points to an instance of the resampler structure
+  @param[in]     L          upsample factor
+  @param[in]     M          downsample factor
+  @param[in]     quality    filter quality, \ref ARM_RESAMPLE_FAST to \ref ARM_RESAMPLE_BEST
+  @param[out]    pCoeffs    points to the buffer receiving the phase table,
+                            of length <code>ARM_RESAMPLE_POLY_COEFFS_SIZE(L, M, quality)</code>
+  @param[in]     pState     points to the state buffer,
+                            of length <code>ARM_RESAMPLE_STATE_SIZE(M, L, quality, blockSize)</code>
+  @param[in]     blockSize  largest number of input samples processed per call
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>L</code> or <code>M</code> is zero,
+                                                    or the phase table is too long
+
+  @par           Details
+                   The output rate is <code>L/M</code> times the input rate. The ratio
+                   should be reduced (44.1 kHz to 48 kHz is <code>L = 160, M = 147</code>):
+                   the table holds <code>L</code> phases. The prototype low-pass filter is
+                   designed here and <code>pCoeffs</code> must stay valid while the
+                   instance is used.
+ */
+arm_status arm_resample_poly_init_f32(
+        arm_resample_poly_instance_f32 * S,
+        uint16_t L,
+        uint16_t M,
+        arm_resample_quality quality,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  uint32_t phaseLen, p, j;
+  float32_t bandwidth;
+
+  if (L == 0U || M == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  phaseLen = ARM_RESAMPLE_PHASE_LEN(M, L, quality);
+  if (phaseLen == 0U || phaseLen > 0xFFFFU)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  bandwidth = (L < M) ? (float32_t) L / (float32_t) M : 1.0f;
+
+  /* Phase p is the output instant p/L after the newest input sample. Taps are
+     stored oldest first, so tap j weighs the sample phaseLen-1-j in the past */
+  for (p = 0U; p < L; p++)
+  {
+    for (j = 0U; j < phaseLen; j++)
+    {
+      pCoeffs[p * phaseLen + j] = arm_resample_kernel_f32(quality, phaseLen, bandwidth,
+                                    (float32_t) p / (float32_t) L + (float32_t) (phaseLen - 1U - j));
+    }
+  }
+
+  S->L = L;
+  S->M = M;
+  S->phaseLength = (uint16_t) phaseLen;
+  S->phase = 0U;
+  S->inIndex = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  memset(pState, 0, (phaseLen + blockSize - 1U) * sizeof(float32_t));
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Resample group
+ */
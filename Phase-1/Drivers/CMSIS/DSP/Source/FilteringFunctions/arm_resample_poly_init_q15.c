@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_poly_init_q15.c
+ * Description:  Initialization function for the Q15 rational resampler
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+extern float32_t arm_resample_kernel_f32(
+  arm_resample_quality quality,
+  uint32_t phaseLength,
+  float32_t bandwidth,
+  float32_t u);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 rational resampler.
+  @param[in,out] S          points to an instance of the resampler structure
+  @param[in]     L          upsample factor
+  @param[in]     M          downsample factor
+  @param[in]     quality    filter quality, \ref ARM_RESAMPLE_FAST to \ref ARM_RESAMPLE_BEST
+  @param[out]    pCoeffs    points to the buffer receiving the phase table,
+                            of length <code>ARM_RESAMPLE_POLY_COEFFS_SIZE(L, M, quality)</code>
+  @param[in]     pState     points to the state buffer,
+                            of length <code>ARM_RESAMPLE_STATE_SIZE(M, L, quality, blockSize)</code>
+  @param[in]     blockSize  largest number of input samples processed per call
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>L</code> or <code>M</code> is zero,
+                                                    or the phase table is too long
+
+  @par           Details
+                   Same table as \ref arm_resample_poly_init_f32, rounded to Q15.
+ */
+arm_status arm_resample_poly_init_q15(
+        arm_resample_poly_instance_q15 * S,
+        uint16_t L,
+        uint16_t M,
+        arm_resample_quality quality,
+        q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize)
+{
+  uint32_t phaseLen, p, j;
+  float32_t bandwidth, h;
+
+  if (L == 0U || M == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  phaseLen = ARM_RESAMPLE_PHASE_LEN(M, L, quality);
+  if (phaseLen == 0U || phaseLen > 0xFFFFU)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  bandwidth = (L < M) ? (float32_t) L / (float32_t) M : 1.0f;
+
+  for (p = 0U; p < L; p++)
+  {
+    for (j = 0U; j < phaseLen; j++)
+    {
+      h = arm_resample_kernel_f32(quality, phaseLen, bandwidth,
+                                  (float32_t) p / (float32_t) L + (float32_t) (phaseLen - 1U - j));
+      pCoeffs[p * phaseLen + j] = (q15_t) __SSAT((q31_t) roundf(h * 32768.0f), 16);
+    }
+  }
+
+  S->L = L;
+  S->M = M;
+  S->phaseLength = (uint16_t) phaseLen;
+  S->phase = 0U;
+  S->inIndex = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  memset(pState, 0, (phaseLen + blockSize - 1U) * sizeof(q15_t));
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Resample group
+ */
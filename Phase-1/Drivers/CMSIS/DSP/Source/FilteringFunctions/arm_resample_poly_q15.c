@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_poly_q15.c
+ * Description:  Q15 rational (L/M) polyphase resampler
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+__STATIC_FORCEINLINE q63_t arm_resample_dot_q15(
+  const q15_t * pX,
+  const q15_t * pC,
+        uint32_t len)
+{
+  q63_t acc = 0;
+  uint32_t blkCnt = len >> 2U;
+
+#if defined (ARM_MATH_DSP)
+  while (blkCnt > 0U)
+  {
+    acc = __SMLALD(read_q15x2_ia(&pX), read_q15x2_ia(&pC), acc);
+    acc = __SMLALD(read_q15x2_ia(&pX), read_q15x2_ia(&pC), acc);
+    blkCnt--;
+  }
+#else
+  q63_t acc1 = 0;
+
+  /* Two independent accumulators, as the 64-bit adds are the critical path */
+  while (blkCnt > 0U)
+  {
+    acc  += (q31_t) pX[0] * pC[0] + (q63_t) ((q31_t) pX[1] * pC[1]);
+    acc1 += (q31_t) pX[2] * pC[2] + (q63_t) ((q31_t) pX[3] * pC[3]);
+    pX += 4;
+    pC += 4;
+    blkCnt--;
+  }
+  acc += acc1;
+#endif
+
+  blkCnt = len & 3U;
+  while (blkCnt > 0U)
+  {
+    acc += (q31_t) *pX++ * *pC++;
+    blkCnt--;
+  }
+
+  return acc;
+}
+
+/**
+  @brief         Processing function for the Q15 rational resampler.
+  @param[in,out] S          points to an instance of the resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data,
+                            of length <code>ARM_RESAMPLE_MAX_OUTPUT(M, L, blockSize)</code>
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written
+
+  @par           Scaling and Overflow Behavior
+                   Products are accumulated in a 64-bit accumulator in 2.30 format,
+                   as in \ref arm_fir_q15, then shifted right by 15 bits and saturated
+                   to 1.15 format.
+ */
+uint32_t arm_resample_poly_q15(
+        arm_resample_poly_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Phase table pointer */
+        uint32_t phaseLen = S->phaseLength;            /* Taps per phase */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t stepInt = S->M / L;                   /* Input samples per output, integer part */
+        uint32_t stepPhase = S->M % L;                 /* and remainder in phases */
+        uint32_t n = S->inIndex;                       /* Newest input of the next output */
+        uint32_t phase = S->phase;                     /* Phase of the next output */
+        uint32_t outCnt = 0U;                          /* Output samples written */
+        uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    pState[phaseLen - 1U + i] = pSrc[i];
+  }
+
+  while (n < blockSize)
+  {
+    q63_t acc = arm_resample_dot_q15(pState + n, pCoeffs + phase * phaseLen, phaseLen);
+
+    pDst[outCnt++] = (q15_t) __SSAT((acc >> 15), 16);
+
+    n += stepInt;
+    phase += stepPhase;
+    if (phase >= L)
+    {
+      phase -= L;
+      n++;
+    }
+  }
+
+  S->inIndex = n - blockSize;
+  S->phase = (uint16_t) phase;
+
+  for (i = 0U; i < phaseLen - 1U; i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+
+  return outCnt;
+}
+
+/**
+  @} end of Resample group
+ */
@@ -72,3 +72,7 @@
 #include "arm_mat_solve_lower_triangular_f64.c"
 #include "arm_mat_ldlt_f32.c"
 #include "arm_mat_ldlt_f64.c"
+#include "arm_mat_gemm_f32.c"
+#include "arm_mat_gemm_init_f32.c"
+#include "arm_mat_gemm_q31.c"
+#include "arm_mat_gemm_init_q31.c"
@@ -0,0 +1,383 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_gemm_f32.c
+ * Description:  Cache-blocked floating-point general matrix multiplication
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/matrix_functions.h"
+#include "arm_parallel.h"
+
+#if defined(ARM_MATH_X86)
+#include "arm_x86_kernels.h"
+#endif
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixGemm General Matrix Multiplication
+
+  Computes <code>pDst = op(pSrcA) * op(pSrcB)</code>, where op() is either the
+  matrix as stored or its transpose, chosen once in the instance. Products
+  such as A * B<sup>T</sup> (correlations, distance and kernel matrices) or
+  A<sup>T</sup> * B (normal equations) need no arm_mat_trans_f32() copy.
+
+  op(pSrcA) is <code>M x K</code>, op(pSrcB) is <code>K x N</code> and pDst must be
+  <code>M x N</code>. pDst must not overlap the inputs.
+
+  The product is computed in blocks that stay in cache:
+  - K is cut in slices of ARM_MAT_GEMM_KC;
+  - for a slice, ARM_MAT_GEMM_MC rows of op(pSrcA) are swept against every
+    16 column panel of op(pSrcB). The panel (KC x 16 values) is first
+    copied to a contiguous buffer on the stack, which also absorbs the
+    transpose of pSrcB;
+  - a micro-kernel keeps a 4 x 16 block of the result in registers across
+    the whole slice, so each value of A is used 16 times and each value of
+    the panel 4 times per load.
+
+  On x86 hosts (ARM_MATH_X86) the micro-kernel uses AVX2 when available.
+  With ARM_MATH_PTHREAD, large products are split by rows (or by columns
+  when the result is wider than tall) between S->numThreads threads.
+
+  On host builds (ARM_MATH_X86 or ARM_MATH_PTHREAD), arm_mat_mult_f32()
+  and arm_mat_mult_q31() hand large products to this path on one thread.
+  The q31 version is bit-exact with arm_mat_mult_q31().
+ */
+
+/**
+  @addtogroup MatrixGemm
+  @{
+ */
+
+/* Rows and columns of the micro-kernel */
+#define ARM_MAT_GEMM_MR           4U
+#define ARM_MAT_GEMM_NR           16U
+
+/* Depth of a slice (sets the size of the packed panel on the stack) and rows per block.
+   Targets keep the panel at 4 KB of stack. */
+#if defined(ARM_MATH_X86) || defined(ARM_MATH_PTHREAD)
+#define ARM_MAT_GEMM_KC           256U
+#else
+#define ARM_MAT_GEMM_KC           64U
+#endif
+#define ARM_MAT_GEMM_MC           256U
+
+/* Multiply-accumulates per thread before splitting the work */
+#define ARM_MAT_GEMM_MT_MIN       (1U << 21)
+
+typedef struct
+{
+  const float32_t *pA;
+  const float32_t *pB;
+        float32_t *pC;
+  uint32_t M, N, K;
+  uint32_t rsA, csA;             /* op(A)[i][k] = pA[i * rsA + k * csA] */
+  arm_mat_op opB;
+  uint32_t splitRows;            /* parts share rows, else columns */
+} arm_mat_gemm_job_f32;
+
+/* Copy op(B)[k0 .. k0+kc)[j0 .. j0+nr) to a kc x 16 panel, zero padded */
+static void arm_mat_gemm_pack_f32(
+  const arm_mat_gemm_job_f32 *J,
+  uint32_t k0, uint32_t kc,
+  uint32_t j0, uint32_t nr,
+  float32_t *pPanel)
+{
+  uint32_t k, j;
+
+  if (J->opB == ARM_MAT_NOTRANS)
+  {
+    const float32_t *pB = &J->pB[k0 * J->N + j0];
+
+    for (k = 0U; k < kc; k++)
+    {
+      for (j = 0U; j < nr; j++)
+      {
+        pPanel[j] = pB[j];
+      }
+      for (; j < ARM_MAT_GEMM_NR; j++)
+      {
+        pPanel[j] = 0.0f;
+      }
+      pB += J->N;
+      pPanel += ARM_MAT_GEMM_NR;
+    }
+  }
+  else
+  {
+    /* op(B)[k][j] = B[j][k]: read rows of B, scatter to panel columns */
+    for (j = 0U; j < nr; j++)
+    {
+      const float32_t *pB = &J->pB[(j0 + j) * J->K + k0];
+
+      for (k = 0U; k < kc; k++)
+      {
+        pPanel[k * ARM_MAT_GEMM_NR + j] = pB[k];
+      }
+    }
+    for (; j < ARM_MAT_GEMM_NR; j++)
+    {
+      for (k = 0U; k < kc; k++)
+      {
+        pPanel[k * ARM_MAT_GEMM_NR + j] = 0.0f;
+      }
+    }
+  }
+}
+
+typedef void (*arm_mat_gemm_kernel_f32_fn)(
+  uint32_t kc,
+  const float32_t *pA, uint32_t rsA, uint32_t csA,
+  const float32_t *pPanel,
+  float32_t *pC, uint32_t ldc,
+  uint32_t mr, uint32_t nr,
+  uint32_t accumulate);
+
+/*
+ * C[0 .. mr)[0 .. nr) (+)= op(A) rows times the panel, over kc. Rows past mr
+ * read the last valid row and are dropped, so the loop has no edge cases.
+ */
+static void arm_mat_gemm_kernel_f32(
+  uint32_t kc,
+  const float32_t *pA, uint32_t rsA, uint32_t csA,
+  const float32_t *pPanel,
+  float32_t *pC, uint32_t ldc,
+  uint32_t mr, uint32_t nr,
+  uint32_t accumulate)
+{
+  float32_t acc[ARM_MAT_GEMM_MR][ARM_MAT_GEMM_NR];
+  const float32_t *a0 = pA;
+  const float32_t *a1 = (mr > 1U) ? pA + rsA : a0;
+  const float32_t *a2 = (mr > 2U) ? pA + 2U * rsA : a1;
+  const float32_t *a3 = (mr > 3U) ? pA + 3U * rsA : a2;
+  uint32_t i, j, k;
+
+  for (i = 0U; i < ARM_MAT_GEMM_MR; i++)
+  {
+    for (j = 0U; j < ARM_MAT_GEMM_NR; j++)
+    {
+      acc[i][j] = 0.0f;
+    }
+  }
+
+  for (k = 0U; k < kc; k++)
+  {
+    float32_t v0 = *a0, v1 = *a1, v2 = *a2, v3 = *a3;
+
+    for (j = 0U; j < ARM_MAT_GEMM_NR; j++)
+    {
+      float32_t b = pPanel[j];
+      acc[0][j] += v0 * b;
+      acc[1][j] += v1 * b;
+      acc[2][j] += v2 * b;
+      acc[3][j] += v3 * b;
+    }
+
+    a0 += csA;
+    a1 += csA;
+    a2 += csA;
+    a3 += csA;
+    pPanel += ARM_MAT_GEMM_NR;
+  }
+
+  for (i = 0U; i < mr; i++)
+  {
+    float32_t *c = &pC[i * ldc];
+
+    if (accumulate)
+    {
+      for (j = 0U; j < nr; j++)
+      {
+        c[j] += acc[i][j];
+      }
+    }
+    else
+    {
+      for (j = 0U; j < nr; j++)
+      {
+        c[j] = acc[i][j];
+      }
+    }
+  }
+}
+
+/* Rows [m0, m1) by columns [n0, n1) of the result */
+static void arm_mat_gemm_block_f32(
+  const arm_mat_gemm_job_f32 *J,
+  uint32_t m0, uint32_t m1,
+  uint32_t n0, uint32_t n1)
+{
+  float32_t panel[ARM_MAT_GEMM_KC * ARM_MAT_GEMM_NR] __ALIGNED(32);
+  arm_mat_gemm_kernel_f32_fn kernel = arm_mat_gemm_kernel_f32;
+  uint32_t k0, i0, i, j;
+
+#if defined(ARM_MATH_X86)
+  if (arm_x86_get_level() >= ARM_X86_LEVEL_AVX2)
+  {
+    kernel = arm_mat_gemm_kernel_f32_avx2;
+  }
+#endif
+
+  for (k0 = 0U; k0 < J->K; k0 += ARM_MAT_GEMM_KC)
+  {
+    uint32_t kc = (J->K - k0 < ARM_MAT_GEMM_KC) ? J->K - k0 : ARM_MAT_GEMM_KC;
+
+    for (i0 = m0; i0 < m1; i0 += ARM_MAT_GEMM_MC)
+    {
+      uint32_t i1 = (m1 - i0 < ARM_MAT_GEMM_MC) ? m1 : i0 + ARM_MAT_GEMM_MC;
+
+      for (j = n0; j < n1; j += ARM_MAT_GEMM_NR)
+      {
+        uint32_t nr = (n1 - j < ARM_MAT_GEMM_NR) ? n1 - j : ARM_MAT_GEMM_NR;
+
+        arm_mat_gemm_pack_f32(J, k0, kc, j, nr, panel);
+
+        for (i = i0; i < i1; i += ARM_MAT_GEMM_MR)
+        {
+          uint32_t mr = (i1 - i < ARM_MAT_GEMM_MR) ? i1 - i : ARM_MAT_GEMM_MR;
+          const float32_t *pA = &J->pA[i * J->rsA + k0 * J->csA];
+          float32_t *pC = &J->pC[i * J->N + j];
+
+          kernel(kc, pA, J->rsA, J->csA, panel, pC, J->N, mr, nr, k0 > 0U);
+        }
+      }
+    }
+  }
+}
+
+static void arm_mat_gemm_part_f32(void *arg, arm_parallel_team *team, uint32_t part)
+{
+  const arm_mat_gemm_job_f32 *J = (const arm_mat_gemm_job_f32 *) arg;
+  uint32_t parts = team->numParts;
+
+  if (J->splitRows)
+  {
+    /* Whole micro-kernel rows per part */
+    uint32_t units = (J->M + ARM_MAT_GEMM_MR - 1U) / ARM_MAT_GEMM_MR;
+    uint32_t u0 = (units * part) / parts, u1 = (units * (part + 1U)) / parts;
+    uint32_t m0 = u0 * ARM_MAT_GEMM_MR;
+    uint32_t m1 = (u1 * ARM_MAT_GEMM_MR < J->M) ? u1 * ARM_MAT_GEMM_MR : J->M;
+
+    if (m0 < m1)
+    {
+      arm_mat_gemm_block_f32(J, m0, m1, 0U, J->N);
+    }
+  }
+  else
+  {
+    /* Whole panels per part */
+    uint32_t units = (J->N + ARM_MAT_GEMM_NR - 1U) / ARM_MAT_GEMM_NR;
+    uint32_t u0 = (units * part) / parts, u1 = (units * (part + 1U)) / parts;
+    uint32_t n0 = u0 * ARM_MAT_GEMM_NR;
+    uint32_t n1 = (u1 * ARM_MAT_GEMM_NR < J->N) ? u1 * ARM_MAT_GEMM_NR : J->N;
+
+    if (n0 < n1)
+    {
+      arm_mat_gemm_block_f32(J, 0U, J->M, n0, n1);
+    }
+  }
+}
+
+/**
+  @brief         Floating-point general matrix multiplication.
+  @param[in]     S      points to an instance of the GEMM structure
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @param[out]    pDst   points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+arm_status arm_mat_gemm_f32(
+  const arm_mat_gemm_instance_f32 * S,
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  arm_mat_gemm_job_f32 job;
+  uint32_t kB;
+  uint64_t work;
+
+  if (S->opA == ARM_MAT_NOTRANS)
+  {
+    job.M = pSrcA->numRows;
+    job.K = pSrcA->numCols;
+    job.rsA = job.K;
+    job.csA = 1U;
+  }
+  else
+  {
+    job.M = pSrcA->numCols;
+    job.K = pSrcA->numRows;
+    job.rsA = 1U;
+    job.csA = job.M;
+  }
+  job.N = (S->opB == ARM_MAT_NOTRANS) ? pSrcB->numCols : pSrcB->numRows;
+  kB = (S->opB == ARM_MAT_NOTRANS) ? pSrcB->numRows : pSrcB->numCols;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((job.K != kB) ||
+      (pDst->numRows != job.M) ||
+      (pDst->numCols != job.N))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#else
+  (void) kB;
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if (job.K == 0U)
+  {
+    uint32_t n = job.M * job.N;
+
+    while (n > 0U)
+    {
+      pDst->pData[--n] = 0.0f;
+    }
+    return (ARM_MATH_SUCCESS);
+  }
+
+  job.pA = pSrcA->pData;
+  job.pB = pSrcB->pData;
+  job.pC = pDst->pData;
+  job.opB = S->opB;
+  job.splitRows = (job.M >= job.N) ? 1U : 0U;
+
+  work = ((uint64_t) job.M * job.N * job.K) / ARM_MAT_GEMM_MT_MIN;
+  if (work > ARM_PARALLEL_MAX_THREADS)
+  {
+    work = ARM_PARALLEL_MAX_THREADS;
+  }
+
+  arm_parallel_run(arm_mat_gemm_part_f32, &job,
+                   arm_parallel_threads(S->numThreads, (uint32_t) work, 1U));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MatrixGemm group
+ */
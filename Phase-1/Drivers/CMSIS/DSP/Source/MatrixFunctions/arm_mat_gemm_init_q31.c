@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_gemm_init_q31.c
+ * Description:  Initialization function for the Q31 general matrix multiplication
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixGemm
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 general matrix multiplication.
+  @param[out]    S           points to an instance of the GEMM structure
+  @param[in]     opA         operation applied to the first operand
+  @param[in]     opB         operation applied to the second operand
+  @param[in]     numThreads  thread count for large products, 0 for all CPUs
+  @return        none
+ */
+void arm_mat_gemm_init_q31(
+  arm_mat_gemm_instance_q31 * S,
+  arm_mat_op opA,
+  arm_mat_op opB,
+  uint32_t numThreads)
+{
+  S->opA = opA;
+  S->opB = opB;
+  S->numThreads = numThreads;
+}
+
+/**
+  @} end of MatrixGemm group
+ */
@@ -0,0 +1,265 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_gemm_q31.c
+ * Description:  Cache-blocked Q31 general matrix multiplication
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/matrix_functions.h"
+#include "arm_parallel.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixGemm
+  @{
+ */
+
+/* Rows and columns of the register tile */
+#define ARM_MAT_GEMM_Q31_MR       2U
+#define ARM_MAT_GEMM_Q31_NR       4U
+
+/* Columns of op(B) swept against every row of op(A) before moving on */
+#define ARM_MAT_GEMM_Q31_NC       64U
+
+/* Multiply-accumulates per thread before splitting the work */
+#define ARM_MAT_GEMM_Q31_MT_MIN   (1U << 20)
+
+typedef struct
+{
+  const q31_t *pA;
+  const q31_t *pB;
+        q31_t *pC;
+  uint32_t M, N, K;
+  uint32_t rsA, csA;             /* op(A)[i][k] = pA[i * rsA + k * csA] */
+  uint32_t rsB, csB;             /* op(B)[k][j] = pB[k * rsB + j * csB] */
+  uint32_t splitRows;            /* parts share rows, else columns */
+} arm_mat_gemm_job_q31;
+
+/*
+ * 2 x 4 block of the result over the whole depth, in 2.62 accumulators.
+ * Rows and columns past mr and nr read the last valid one and are dropped.
+ */
+static void arm_mat_gemm_tile_q31(
+  const arm_mat_gemm_job_q31 *J,
+  uint32_t i, uint32_t j,
+  uint32_t mr, uint32_t nr)
+{
+  const q31_t *a0 = &J->pA[i * J->rsA];
+  const q31_t *a1 = (mr > 1U) ? a0 + J->rsA : a0;
+  const q31_t *b0 = &J->pB[j * J->csB];
+  const q31_t *b1 = (nr > 1U) ? b0 + J->csB : b0;
+  const q31_t *b2 = (nr > 2U) ? b1 + J->csB : b1;
+  const q31_t *b3 = (nr > 3U) ? b2 + J->csB : b2;
+  q63_t s00 = 0, s01 = 0, s02 = 0, s03 = 0;
+  q63_t s10 = 0, s11 = 0, s12 = 0, s13 = 0;
+  q31_t *c = &J->pC[i * J->N + j];
+  uint32_t k;
+
+  for (k = 0U; k < J->K; k++)
+  {
+    q63_t x0 = *a0, x1 = *a1;
+    q31_t y0 = *b0, y1 = *b1, y2 = *b2, y3 = *b3;
+
+    s00 += x0 * y0;
+    s01 += x0 * y1;
+    s02 += x0 * y2;
+    s03 += x0 * y3;
+    s10 += x1 * y0;
+    s11 += x1 * y1;
+    s12 += x1 * y2;
+    s13 += x1 * y3;
+
+    a0 += J->csA;
+    a1 += J->csA;
+    b0 += J->rsB;
+    b1 += J->rsB;
+    b2 += J->rsB;
+    b3 += J->rsB;
+  }
+
+  /* Convert from 2.62 to 1.31 as arm_mat_mult_q31() does */
+  c[0] = (q31_t) (s00 >> 31);
+  if (nr > 1U) c[1] = (q31_t) (s01 >> 31);
+  if (nr > 2U) c[2] = (q31_t) (s02 >> 31);
+  if (nr > 3U) c[3] = (q31_t) (s03 >> 31);
+  if (mr > 1U)
+  {
+    c += J->N;
+    c[0] = (q31_t) (s10 >> 31);
+    if (nr > 1U) c[1] = (q31_t) (s11 >> 31);
+    if (nr > 2U) c[2] = (q31_t) (s12 >> 31);
+    if (nr > 3U) c[3] = (q31_t) (s13 >> 31);
+  }
+}
+
+/* Rows [m0, m1) by columns [n0, n1) of the result */
+static void arm_mat_gemm_block_q31(
+  const arm_mat_gemm_job_q31 *J,
+  uint32_t m0, uint32_t m1,
+  uint32_t n0, uint32_t n1)
+{
+  uint32_t j0, i, j;
+
+  for (j0 = n0; j0 < n1; j0 += ARM_MAT_GEMM_Q31_NC)
+  {
+    uint32_t j1 = (n1 - j0 < ARM_MAT_GEMM_Q31_NC) ? n1 : j0 + ARM_MAT_GEMM_Q31_NC;
+
+    for (i = m0; i < m1; i += ARM_MAT_GEMM_Q31_MR)
+    {
+      uint32_t mr = (m1 - i < ARM_MAT_GEMM_Q31_MR) ? m1 - i : ARM_MAT_GEMM_Q31_MR;
+
+      for (j = j0; j < j1; j += ARM_MAT_GEMM_Q31_NR)
+      {
+        uint32_t nr = (j1 - j < ARM_MAT_GEMM_Q31_NR) ? j1 - j : ARM_MAT_GEMM_Q31_NR;
+
+        arm_mat_gemm_tile_q31(J, i, j, mr, nr);
+      }
+    }
+  }
+}
+
+static void arm_mat_gemm_part_q31(void *arg, arm_parallel_team *team, uint32_t part)
+{
+  const arm_mat_gemm_job_q31 *J = (const arm_mat_gemm_job_q31 *) arg;
+  uint32_t parts = team->numParts;
+
+  if (J->splitRows)
+  {
+    uint32_t units = (J->M + ARM_MAT_GEMM_Q31_MR - 1U) / ARM_MAT_GEMM_Q31_MR;
+    uint32_t u0 = (units * part) / parts, u1 = (units * (part + 1U)) / parts;
+    uint32_t m0 = u0 * ARM_MAT_GEMM_Q31_MR;
+    uint32_t m1 = (u1 * ARM_MAT_GEMM_Q31_MR < J->M) ? u1 * ARM_MAT_GEMM_Q31_MR : J->M;
+
+    if (m0 < m1)
+    {
+      arm_mat_gemm_block_q31(J, m0, m1, 0U, J->N);
+    }
+  }
+  else
+  {
+    uint32_t units = (J->N + ARM_MAT_GEMM_Q31_NR - 1U) / ARM_MAT_GEMM_Q31_NR;
+    uint32_t u0 = (units * part) / parts, u1 = (units * (part + 1U)) / parts;
+    uint32_t n0 = u0 * ARM_MAT_GEMM_Q31_NR;
+    uint32_t n1 = (u1 * ARM_MAT_GEMM_Q31_NR < J->N) ? u1 * ARM_MAT_GEMM_Q31_NR : J->N;
+
+    if (n0 < n1)
+    {
+      arm_mat_gemm_block_q31(J, 0U, J->M, n0, n1);
+    }
+  }
+}
+
+/**
+  @brief         Q31 general matrix multiplication.
+  @param[in]     S      points to an instance of the GEMM structure
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @param[out]    pDst   points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Scaling and Overflow Behavior
+                   Same as arm_mat_mult_q31(): products are summed exactly in
+                   a 64-bit 2.62 accumulator and the result is truncated to
+                   1.31 without saturation, so the output is bit-exact with
+                   arm_mat_mult_q31() on the same (transposed) operands. The
+                   inputs should be scaled down by log2(K) bits to avoid
+                   wrap-around.
+  @par
+                   The depth is not blocked, each output is a single sum;
+                   blocking is over rows and columns only, in 2 x 4 register
+                   tiles and ARM_MAT_GEMM_Q31_NC column strips.
+ */
+arm_status arm_mat_gemm_q31(
+  const arm_mat_gemm_instance_q31 * S,
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+        arm_matrix_instance_q31 * pDst)
+{
+  arm_mat_gemm_job_q31 job;
+  uint32_t kB;
+  uint64_t work;
+
+  if (S->opA == ARM_MAT_NOTRANS)
+  {
+    job.M = pSrcA->numRows;
+    job.K = pSrcA->numCols;
+    job.rsA = job.K;
+    job.csA = 1U;
+  }
+  else
+  {
+    job.M = pSrcA->numCols;
+    job.K = pSrcA->numRows;
+    job.rsA = 1U;
+    job.csA = job.M;
+  }
+  if (S->opB == ARM_MAT_NOTRANS)
+  {
+    job.N = pSrcB->numCols;
+    kB = pSrcB->numRows;
+    job.rsB = job.N;
+    job.csB = 1U;
+  }
+  else
+  {
+    job.N = pSrcB->numRows;
+    kB = pSrcB->numCols;
+    job.rsB = 1U;
+    job.csB = kB;
+  }
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((job.K != kB) ||
+      (pDst->numRows != job.M) ||
+      (pDst->numCols != job.N))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  job.pA = pSrcA->pData;
+  job.pB = pSrcB->pData;
+  job.pC = pDst->pData;
+  job.splitRows = (job.M >= job.N) ? 1U : 0U;
+
+  work = ((uint64_t) job.M * job.N * job.K) / ARM_MAT_GEMM_Q31_MT_MIN;
+  if (work > ARM_PARALLEL_MAX_THREADS)
+  {
+    work = ARM_PARALLEL_MAX_THREADS;
+  }
+
+  arm_parallel_run(arm_mat_gemm_part_q31, &job,
+                   arm_parallel_threads(S->numThreads, (uint32_t) work, 1U));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MatrixGemm group
+ */
@@ -28,10 +28,19 @@
 
 #include "dsp/matrix_functions.h"
 
+#if defined(ARM_MATH_X86)
+#include "arm_x86_kernels.h"
+#endif
+
 #if defined(ARM_MATH_NEON)
 #define GROUPOFROWS 8
 #endif
 
+#if defined(ARM_MATH_X86) || defined(ARM_MATH_PTHREAD)
+/* Host builds: products above this many multiply-accumulates use arm_mat_gemm_f32() */
+#define ARM_MAT_MULT_F32_GEMM_MIN (1U << 21)
+#endif
+
 /**
  * @ingroup groupMatrix
  */
@@ -894,6 +903,29 @@ arm_status arm_mat_mult_f32(
 #endif /* #ifdef ARM_MATH_MATRIX_CHECK */
 
   {
+#if defined(ARM_MATH_X86) || defined(ARM_MATH_PTHREAD)
+    if ((uint64_t) numRowsA * numColsA * numColsB > ARM_MAT_MULT_F32_GEMM_MIN)
+    {
+      arm_mat_gemm_instance_f32 gemm;
+
+      arm_mat_gemm_init_f32(&gemm, ARM_MAT_NOTRANS, ARM_MAT_NOTRANS, 1U);
+      return (arm_mat_gemm_f32(&gemm, pSrcA, pSrcB, pDst));
+    }
+#endif
+
+#if defined(ARM_MATH_X86)
+    if (arm_x86_get_level() >= ARM_X86_LEVEL_AVX2)
+    {
+      arm_mat_mult_f32_avx2(pSrcA, pSrcB, pDst);
+      return (ARM_MATH_SUCCESS);
+    }
+    if (arm_x86_get_level() >= ARM_X86_LEVEL_SSE2)
+    {
+      arm_mat_mult_f32_sse2(pSrcA, pSrcB, pDst);
+      return (ARM_MATH_SUCCESS);
+    }
+#endif
+
     /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
     /* row loop */
     do
@@ -28,6 +28,11 @@
 
 #include "dsp/matrix_functions.h"
 
+#if defined(ARM_MATH_X86) || defined(ARM_MATH_PTHREAD)
+/* Host builds: products above this many multiply-accumulates use arm_mat_gemm_q31() */
+#define ARM_MAT_MULT_Q31_GEMM_MIN (1U << 12)
+#endif
+
 /**
   @ingroup groupMatrix
  */
@@ -656,6 +661,17 @@ arm_status arm_mat_mult_q31(
 #endif /* #ifdef ARM_MATH_MATRIX_CHECK */
 
   {
+#if defined(ARM_MATH_X86) || defined(ARM_MATH_PTHREAD)
+    /* Same 2.62 sums, so the result is bit-exact */
+    if ((uint64_t) numRowsA * numColsA * numColsB > ARM_MAT_MULT_Q31_GEMM_MIN)
+    {
+      arm_mat_gemm_instance_q31 gemm;
+
+      arm_mat_gemm_init_q31(&gemm, ARM_MAT_NOTRANS, ARM_MAT_NOTRANS, 1U);
+      return (arm_mat_gemm_q31(&gemm, pSrcA, pSrcB, pDst));
+    }
+#endif
+
     /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
     /* row loop */
     do
@@ -34,3 +34,5 @@
 #include "arm_svm_rbf_predict_f32.c"
 #include "arm_svm_sigmoid_init_f32.c"
 #include "arm_svm_sigmoid_predict_f32.c"
+#include "arm_svm_linear_predict_batch_f32.c"
+#include "arm_svm_rbf_predict_batch_f32.c"
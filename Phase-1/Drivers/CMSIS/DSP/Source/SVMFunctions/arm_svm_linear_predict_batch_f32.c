@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_linear_predict_batch_f32.c
+ * Description:  SVM Linear Classifier, batch of vectors
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/svm_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/statistics_functions.h"
+
+/**
+ * @addtogroup linearsvm
+ * @{
+ */
+
+
+/**
+ * @brief SVM linear prediction of a batch of vectors
+ * @param[in]    S           Pointer to an instance of the linear SVM structure.
+ * @param[in]    pIn         Pointer to numVectors input vectors, one after the other
+ * @param[in]    numVectors  Number of input vectors
+ * @param[in]    pScratch    Working buffer of ARM_SVM_LINEAR_BATCH_SCRATCH_SIZE(vectorDimension) values
+ * @param[out]   pResult     Decision value of each vector
+ * @return none.
+ *
+ * The decision function is linear in the input,
+ * <pre>
+ *     intercept + sum_i alpha_i <x, sv_i> = intercept + <x, w>,  w = sum_i alpha_i sv_i
+ * </pre>
+ * so the support vectors are folded once per call into w (the product of
+ * the dual coefficients with the support vector matrix) and each input
+ * vector costs one dot product of length vectorDimension instead of
+ * nbOfSupportVectors of them. Rounding differs from
+ * arm_svm_linear_predict_f32(), which only matters for decision values
+ * within a few ulp of zero.
+ */
+void arm_svm_linear_predict_batch_f32(
+    const arm_svm_linear_instance_f32 *S,
+    const float32_t * pIn,
+    uint32_t numVectors,
+    float32_t * pScratch,
+    int32_t * pResult)
+{
+    const float32_t *pSupport = S->supportVectors;
+    float32_t *pWeights = pScratch;
+    float32_t sum;
+    uint32_t i, j;
+
+    /* w = sum_i alpha_i sv_i */
+    for (j = 0; j < S->vectorDimension; j++)
+    {
+        pWeights[j] = 0.0f;
+    }
+    for (i = 0; i < S->nbOfSupportVectors; i++)
+    {
+        float32_t alpha = S->dualCoefficients[i];
+
+        for (j = 0; j < S->vectorDimension; j++)
+        {
+            pWeights[j] += alpha * pSupport[j];
+        }
+        pSupport += S->vectorDimension;
+    }
+
+    for (i = 0; i < numVectors; i++)
+    {
+        arm_dot_prod_f32(pIn, pWeights, S->vectorDimension, &sum);
+        sum += S->intercept;
+        pResult[i] = S->classes[STEP(sum)];
+        pIn += S->vectorDimension;
+    }
+}
+
+/**
+ * @} end of linearsvm group
+ */
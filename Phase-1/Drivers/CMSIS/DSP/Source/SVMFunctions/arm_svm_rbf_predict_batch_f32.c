@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_rbf_predict_batch_f32.c
+ * Description:  SVM Radial Basis Function Classifier, batch of vectors
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/svm_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/matrix_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+ * @addtogroup rbfsvm
+ * @{
+ */
+
+
+/**
+ * @brief SVM rbf prediction of a batch of vectors
+ * @param[in]    S           Pointer to an instance of the rbf SVM structure.
+ * @param[in]    pIn         Pointer to numVectors input vectors, one after the other
+ * @param[in]    numVectors  Number of input vectors
+ * @param[in]    pScratch    Working buffer of ARM_SVM_RBF_BATCH_SCRATCH_SIZE(nbOfSupportVectors, vectorDimension) values
+ * @param[out]   pResult     Decision value of each vector
+ * @return none.
+ *
+ * Input vectors are scored ARM_SVM_BATCH_BLOCK at a time. The squared
+ * distances between the block and all the support vectors are expanded as
+ * <pre>
+ *     |x - sv|^2 = |x - m|^2 + |sv - m|^2 - 2 <x - m, sv - m>
+ * </pre>
+ * so the dot products are one matrix product of the block with the
+ * transposed support vector matrix (arm_mat_gemm_f32()), and the support
+ * vector norms are computed once per call. Both sides are shifted by m,
+ * the mean of the support vectors, so the expansion does not cancel when
+ * the features have a large mean. The kernel values of a row then go
+ * through one arm_vexp_f32() and a dot product with the dual coefficients.
+ *
+ * Rounding differs from arm_svm_rbf_predict_f32(): the expansion loses
+ * about eps * |x - m|^2 on the squared distance, and on SIMD builds the
+ * exponential is a polynomial. Only decision values within a few ulp of
+ * zero can change class.
+ */
+void arm_svm_rbf_predict_batch_f32(
+    const arm_svm_rbf_instance_f32 *S,
+    const float32_t * pIn,
+    uint32_t numVectors,
+    float32_t * pScratch,
+    int32_t * pResult)
+{
+    uint32_t numSV = S->nbOfSupportVectors;
+    uint32_t dim = S->vectorDimension;
+    float32_t *pNormSV = pScratch;
+    float32_t *pNormIn = pNormSV + numSV;
+    float32_t *pKernel = pNormIn + ARM_SVM_BATCH_BLOCK;
+    float32_t *pMean = pKernel + ARM_SVM_BATCH_BLOCK * numSV;
+    float32_t *pSupport = pMean + dim;
+    float32_t *pBlock = pSupport + numSV * dim;
+    arm_mat_gemm_instance_f32 gemm;
+    arm_matrix_instance_f32 matIn, matSV, matKernel;
+    float32_t sum, d;
+    uint32_t done, nb, r, i;
+
+    /* Support vectors shifted by their mean, and their norms */
+    arm_fill_f32(0.0f, pMean, dim);
+    for (i = 0; i < numSV; i++)
+    {
+        arm_add_f32(pMean, S->supportVectors + i * dim, pMean, dim);
+    }
+    arm_scale_f32(pMean, 1.0f / (float32_t) numSV, pMean, dim);
+
+    for (i = 0; i < numSV; i++)
+    {
+        arm_sub_f32(S->supportVectors + i * dim, pMean, pSupport + i * dim, dim);
+        arm_dot_prod_f32(pSupport + i * dim, pSupport + i * dim, dim, &pNormSV[i]);
+    }
+
+    arm_mat_gemm_init_f32(&gemm, ARM_MAT_NOTRANS, ARM_MAT_TRANS, 1U);
+    arm_mat_init_f32(&matSV, (uint16_t) numSV, (uint16_t) dim, pSupport);
+
+    for (done = 0; done < numVectors; done += nb)
+    {
+        nb = numVectors - done;
+        if (nb > ARM_SVM_BATCH_BLOCK)
+        {
+            nb = ARM_SVM_BATCH_BLOCK;
+        }
+
+        for (r = 0; r < nb; r++)
+        {
+            arm_sub_f32(pIn + r * dim, pMean, pBlock + r * dim, dim);
+            arm_dot_prod_f32(pBlock + r * dim, pBlock + r * dim, dim, &pNormIn[r]);
+        }
+
+        /* <x - m, sv - m> for the whole block */
+        arm_mat_init_f32(&matIn, (uint16_t) nb, (uint16_t) dim, pBlock);
+        arm_mat_init_f32(&matKernel, (uint16_t) nb, (uint16_t) numSV, pKernel);
+        (void) arm_mat_gemm_f32(&gemm, &matIn, &matSV, &matKernel);
+
+        for (r = 0; r < nb; r++)
+        {
+            float32_t *pRow = pKernel + r * numSV;
+
+            /* exp(-gamma |x - sv|^2) for every support vector */
+            for (i = 0; i < numSV; i++)
+            {
+                d = pNormIn[r] + pNormSV[i] - 2.0f * pRow[i];
+                pRow[i] = (d > 0.0f) ? -S->gamma * d : 0.0f;
+            }
+            arm_vexp_f32(pRow, pRow, numSV);
+            arm_dot_prod_f32(pRow, S->dualCoefficients, numSV, &sum);
+
+            sum += S->intercept;
+            pResult[done + r] = S->classes[STEP(sum)];
+        }
+
+        pIn += nb * dim;
+    }
+}
+
+/**
+ * @} end of rbfsvm group
+ */
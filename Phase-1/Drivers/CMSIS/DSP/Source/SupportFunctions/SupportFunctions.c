@@ -43,10 +43,24 @@
 #include "arm_insertion_sort_f32.c"
 #include "arm_merge_sort_f32.c"
 #include "arm_merge_sort_init_f32.c"
+#include "arm_parallel_run.c"
 #include "arm_quick_sort_f32.c"
+#include "arm_radix_argsort_f32.c"
+#include "arm_radix_argsort_q15.c"
+#include "arm_radix_argsort_q31.c"
+#include "arm_radix_sort_core.c"
+#include "arm_radix_sort_f32.c"
+#include "arm_radix_sort_init_f32.c"
+#include "arm_radix_sort_init_q15.c"
+#include "arm_radix_sort_init_q31.c"
+#include "arm_radix_sort_q15.c"
+#include "arm_radix_sort_q31.c"
 #include "arm_selection_sort_f32.c"
 #include "arm_sort_f32.c"
 #include "arm_sort_init_f32.c"
+#include "arm_topk_f32.c"
+#include "arm_topk_q15.c"
+#include "arm_topk_q31.c"
 #include "arm_weighted_sum_f32.c"
 
 #include "arm_float_to_q15.c"
@@ -0,0 +1,227 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_parallel_run.c
+ * Description:  Persistent POSIX thread pool for the multithreaded kernels
+ *
+ * Target Processor: Linux hosts (ARM_MATH_PTHREAD)
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_parallel.h"
+
+#if defined(ARM_MATH_PTHREAD)
+#include <unistd.h>
+#endif
+
+#if defined(ARM_MATH_PTHREAD)
+
+/*
+ * Workers are created on first use and then kept, parked on a condition
+ * variable between regions, so starting a region costs a wake-up rather
+ * than one pthread_create() per part. One region owns the pool at a time;
+ * a caller that finds it busy (another thread, or a region started from
+ * inside a region) runs its region on a team of one instead of waiting.
+ */
+
+typedef struct
+{
+  uint32_t part;
+  uint32_t seen;                 /* last region this worker looked at */
+} arm_parallel_slot;
+
+static pthread_mutex_t arm_parallel_owner = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t arm_parallel_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t arm_parallel_start = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t arm_parallel_done = PTHREAD_COND_INITIALIZER;
+
+static arm_parallel_slot arm_parallel_slots[ARM_PARALLEL_MAX_THREADS];
+static uint32_t arm_parallel_workers;        /* created so far, part 0 excluded */
+static uint32_t arm_parallel_region;         /* bumped for every region */
+static uint32_t arm_parallel_pending;        /* workers still inside the region */
+static arm_parallel_fn arm_parallel_job_fn;
+static void * arm_parallel_job_arg;
+static arm_parallel_team * arm_parallel_job_team;
+static uint32_t arm_parallel_job_parts;      /* copied, the team may be gone */
+
+static void * arm_parallel_entry(void * p)
+{
+  arm_parallel_slot * slot = (arm_parallel_slot *) p;
+
+  pthread_mutex_lock(&arm_parallel_lock);
+  for (;;)
+  {
+    while (slot->seen == arm_parallel_region)
+    {
+      pthread_cond_wait(&arm_parallel_start, &arm_parallel_lock);
+    }
+    slot->seen = arm_parallel_region;
+
+    if (slot->part < arm_parallel_job_parts)
+    {
+      arm_parallel_fn fn = arm_parallel_job_fn;
+      void * arg = arm_parallel_job_arg;
+      arm_parallel_team * team = arm_parallel_job_team;
+
+      pthread_mutex_unlock(&arm_parallel_lock);
+      fn(arg, team, slot->part);
+      pthread_mutex_lock(&arm_parallel_lock);
+
+      arm_parallel_pending--;
+      if (arm_parallel_pending == 0U)
+      {
+        pthread_cond_signal(&arm_parallel_done);
+      }
+    }
+  }
+  return NULL;
+}
+
+/* Grow the pool to n workers, returns how many there are */
+static uint32_t arm_parallel_grow(uint32_t n)
+{
+  pthread_attr_t attr;
+
+  if (arm_parallel_workers >= n)
+  {
+    return arm_parallel_workers;
+  }
+
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+  while (arm_parallel_workers < n)
+  {
+    arm_parallel_slot * slot = &arm_parallel_slots[arm_parallel_workers];
+    pthread_t thread;
+
+    /* Only the owner bumps the region count, so this cannot race */
+    slot->part = arm_parallel_workers + 1U;
+    slot->seen = arm_parallel_region;
+    if (pthread_create(&thread, &attr, arm_parallel_entry, slot) != 0)
+    {
+      break;
+    }
+    arm_parallel_workers++;
+  }
+  pthread_attr_destroy(&attr);
+
+  return arm_parallel_workers;
+}
+
+#endif /* defined(ARM_MATH_PTHREAD) */
+
+uint32_t arm_parallel_threads(
+  uint32_t requested,
+  uint32_t work,
+  uint32_t minWork)
+{
+#if defined(ARM_MATH_PTHREAD)
+  uint32_t n = requested;
+
+  if (n == 0U)
+  {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    n = (cpus > 0) ? (uint32_t) cpus : 1U;
+  }
+  if ((minWork > 0U) && (n > work / minWork))
+  {
+    n = work / minWork;
+  }
+  if (n > ARM_PARALLEL_MAX_THREADS)
+  {
+    n = ARM_PARALLEL_MAX_THREADS;
+  }
+  return (n > 0U) ? n : 1U;
+#else
+  (void) requested;
+  (void) work;
+  (void) minWork;
+  return 1U;
+#endif
+}
+
+void arm_parallel_run(
+  arm_parallel_fn fn,
+  void * arg,
+  uint32_t numParts)
+{
+  arm_parallel_team team;
+
+#if defined(ARM_MATH_PTHREAD)
+  if (numParts > ARM_PARALLEL_MAX_THREADS)
+  {
+    numParts = ARM_PARALLEL_MAX_THREADS;
+  }
+
+  if ((numParts > 1U) && (pthread_mutex_trylock(&arm_parallel_owner) == 0))
+  {
+    uint32_t workers = arm_parallel_grow(numParts - 1U);
+
+    if (workers > 0U)
+    {
+      team.numParts = (workers + 1U < numParts) ? workers + 1U : numParts;
+      pthread_barrier_init(&team.barrier, NULL, team.numParts);
+
+      pthread_mutex_lock(&arm_parallel_lock);
+      arm_parallel_job_fn = fn;
+      arm_parallel_job_arg = arg;
+      arm_parallel_job_team = &team;
+      arm_parallel_job_parts = team.numParts;
+      arm_parallel_pending = team.numParts - 1U;
+      arm_parallel_region++;
+      pthread_cond_broadcast(&arm_parallel_start);
+      pthread_mutex_unlock(&arm_parallel_lock);
+
+      fn(arg, &team, 0U);
+
+      pthread_mutex_lock(&arm_parallel_lock);
+      while (arm_parallel_pending > 0U)
+      {
+        pthread_cond_wait(&arm_parallel_done, &arm_parallel_lock);
+      }
+      pthread_mutex_unlock(&arm_parallel_lock);
+
+      pthread_barrier_destroy(&team.barrier);
+      pthread_mutex_unlock(&arm_parallel_owner);
+      return;
+    }
+
+    pthread_mutex_unlock(&arm_parallel_owner);
+  }
+
+  /* Single part, pool busy, or no worker could be started */
+  team.numParts = 1U;
+  fn(arg, &team, 0U);
+#else
+  (void) numParts;
+  team.numParts = 1U;
+  fn(arg, &team, 0U);
+#endif
+}
+
+void arm_parallel_sync(
+  arm_parallel_team * team)
+{
+#if defined(ARM_MATH_PTHREAD)
+  if (team->numParts > 1U)
+  {
+    pthread_barrier_wait(&team->barrier);
+  }
+#else
+  (void) team;
+#endif
+}
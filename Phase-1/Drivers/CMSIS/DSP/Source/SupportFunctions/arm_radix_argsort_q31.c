@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_radix_argsort_q31.c
+ * Description:  Q31 radix sort returning the sorted indices
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_sorting.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the sorted data, or NULL for indices only.
+   * @param[out] pIndex     points to the indices of the sorted data in pSrc.
+   * @param[in]  blockSize  number of samples to process.
+   *
+   * @par        Algorithm
+   *               Same as arm_radix_sort_q31(), on (value, index) pairs. Equal
+   *               values keep their input order, so pIndex is the stable
+   *               argsort of pSrc.
+   *
+   * @par          A work array of ARM_RADIX_ARGSORT_SCRATCH_SIZE(blockSize)
+   *               words must be linked to the instance.
+   */
+void arm_radix_argsort_q31(
+  const arm_radix_sort_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t * pIndex,
+        uint32_t blockSize)
+{
+    arm_radix_sort_core(ARM_SORT_KEY_Q31, S->dir, S->numThreads, pSrc, pDst, pIndex, S->pScratch, blockSize);
+}
+/**
+  @} end of Sorting group
+ */
@@ -0,0 +1,584 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_radix_sort_core.c
+ * Description:  Radix/merge sort and heap top-k core shared by the f32, q31 and q15 variants
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_sorting.h"
+#include "arm_parallel.h"
+#include <string.h>
+
+/*
+ * Values are mapped to unsigned 32-bit keys whose integer order is the
+ * requested order: sign bit flipped for q31 and q15, sign-magnitude to
+ * offset binary for f32, and all bits inverted for a descending sort. The
+ * argsort and top-k paths sort 64-bit (key << 32 | index) composites, so
+ * equal values come out in input order and the index travels with its key.
+ *
+ * Sorting is LSD radix, 8 bits per pass, skipping the byte positions where
+ * all keys agree (q15 keys need two passes at most). The four digit
+ * histograms are counted while the keys are built (4 KB of stack), so each
+ * pass is a single scatter. Short arrays use an
+ * insertion sort instead. With several threads each one radix-sorts a
+ * contiguous chunk, then the chunks are merged pairwise; every merge round
+ * is split evenly over the team by co-ranking the output positions.
+ */
+
+/* Below this, an insertion sort beats the 256-bucket histogram passes */
+#define ARM_RADIX_SORT_SMALL      80U
+
+/* Least elements per thread before splitting a sort across cores */
+#define ARM_RADIX_SORT_MT_MIN     32768U
+
+typedef struct
+{
+  arm_sort_key_type type;
+  uint32_t flip;
+  const void * pSrc;
+  void * pDst;
+  uint32_t * pIndex;
+  uint32_t * pBuf32[2];
+  uint64_t * pBuf64[2];
+  uint32_t blockSize;
+  uint32_t orBits[ARM_PARALLEL_MAX_THREADS];
+  uint32_t andBits[ARM_PARALLEL_MAX_THREADS];
+} arm_radix_sort_job;
+
+#define ARM_RADIX_COUNT(count, key)      \
+  do {                                   \
+    count[0][(key) & 0xFFU]++;           \
+    count[1][((key) >> 8) & 0xFFU]++;    \
+    count[2][((key) >> 16) & 0xFFU]++;   \
+    count[3][(key) >> 24]++;             \
+  } while (0)
+
+__STATIC_FORCEINLINE uint32_t arm_radix_key_f32(float32_t v)
+{
+  uint32_t u;
+
+  memcpy(&u, &v, sizeof(u));
+  return (u & 0x80000000U) ? ~u : (u | 0x80000000U);
+}
+
+__STATIC_FORCEINLINE uint32_t arm_radix_key(
+  arm_sort_key_type type,
+  const void * pSrc,
+  uint32_t i)
+{
+  switch (type)
+  {
+    case ARM_SORT_KEY_F32:
+      return arm_radix_key_f32(((const float32_t *) pSrc)[i]);
+    case ARM_SORT_KEY_Q31:
+      return (uint32_t) ((const q31_t *) pSrc)[i] ^ 0x80000000U;
+    default:
+      return (uint32_t) (uint16_t) ((const q15_t *) pSrc)[i] ^ 0x8000U;
+  }
+}
+
+__STATIC_FORCEINLINE void arm_radix_unkey(
+  arm_sort_key_type type,
+  void * pDst,
+  uint32_t i,
+  uint32_t key)
+{
+  switch (type)
+  {
+    case ARM_SORT_KEY_F32:
+    {
+      uint32_t u = (key & 0x80000000U) ? (key ^ 0x80000000U) : ~key;
+      memcpy(&((float32_t *) pDst)[i], &u, sizeof(u));
+      break;
+    }
+    case ARM_SORT_KEY_Q31:
+      ((q31_t *) pDst)[i] = (q31_t) (key ^ 0x80000000U);
+      break;
+    default:
+      ((q15_t *) pDst)[i] = (q15_t) (uint16_t) (key ^ 0x8000U);
+      break;
+  }
+}
+
+static uint32_t arm_radix_bound(uint32_t part, uint32_t numParts, uint32_t n)
+{
+  return (uint32_t) (((uint64_t) n * part) / numParts);
+}
+
+/* Keys for pSrc[lo:hi], their digit histograms, and the OR and AND of all keys */
+static void arm_radix_make_keys(
+  arm_radix_sort_job * J,
+  uint32_t part,
+  uint32_t lo,
+  uint32_t hi,
+  uint32_t count[4][256])
+{
+  uint32_t orBits = 0U, andBits = 0xFFFFFFFFU;
+  uint32_t i, key;
+
+  memset(count, 0, 4U * 256U * sizeof(uint32_t));
+
+  if (J->pIndex == NULL)
+  {
+    uint32_t * pKeys = J->pBuf32[0];
+
+    switch (J->type)
+    {
+      case ARM_SORT_KEY_F32:
+        for (i = lo; i < hi; i++)
+        {
+          key = arm_radix_key_f32(((const float32_t *) J->pSrc)[i]) ^ J->flip;
+          orBits |= key; andBits &= key;
+          ARM_RADIX_COUNT(count, key);
+          pKeys[i] = key;
+        }
+        break;
+      case ARM_SORT_KEY_Q31:
+        for (i = lo; i < hi; i++)
+        {
+          key = ((uint32_t) ((const q31_t *) J->pSrc)[i] ^ 0x80000000U) ^ J->flip;
+          orBits |= key; andBits &= key;
+          ARM_RADIX_COUNT(count, key);
+          pKeys[i] = key;
+        }
+        break;
+      default:
+        for (i = lo; i < hi; i++)
+        {
+          key = ((uint32_t) (uint16_t) ((const q15_t *) J->pSrc)[i] ^ 0x8000U) ^ J->flip;
+          orBits |= key; andBits &= key;
+          ARM_RADIX_COUNT(count, key);
+          pKeys[i] = key;
+        }
+        break;
+    }
+  }
+  else
+  {
+    uint64_t * pKeys = J->pBuf64[0];
+
+    for (i = lo; i < hi; i++)
+    {
+      key = arm_radix_key(J->type, J->pSrc, i) ^ J->flip;
+      orBits |= key; andBits &= key;
+      ARM_RADIX_COUNT(count, key);
+      pKeys[i] = ((uint64_t) key << 32) | i;
+    }
+  }
+
+  J->orBits[part] = orBits;
+  J->andBits[part] = andBits;
+}
+
+/* One scatter pass; count holds the histogram of the digit at shift */
+static void arm_radix_pass_u32(
+  const uint32_t * pSrc,
+        uint32_t * pDst,
+        uint32_t n,
+        uint32_t shift,
+        uint32_t * count)
+{
+  uint32_t i, sum, c;
+
+  for (i = 0U, sum = 0U; i < 256U; i++)
+  {
+    c = count[i];
+    count[i] = sum;
+    sum += c;
+  }
+  for (i = 0U; i < n; i++)
+  {
+    pDst[count[(pSrc[i] >> shift) & 0xFFU]++] = pSrc[i];
+  }
+}
+
+/* One scatter pass; count holds the histogram of the digit at shift */
+static void arm_radix_pass_u64(
+  const uint64_t * pSrc,
+        uint64_t * pDst,
+        uint32_t n,
+        uint32_t shift,
+        uint32_t * count)
+{
+  uint32_t i, sum, c;
+
+  shift += 32U;
+  for (i = 0U, sum = 0U; i < 256U; i++)
+  {
+    c = count[i];
+    count[i] = sum;
+    sum += c;
+  }
+  for (i = 0U; i < n; i++)
+  {
+    pDst[count[(pSrc[i] >> shift) & 0xFFU]++] = pSrc[i];
+  }
+}
+
+static void arm_radix_insertion_u32(uint32_t * p, uint32_t n)
+{
+  uint32_t i, j, x;
+
+  for (i = 1U; i < n; i++)
+  {
+    x = p[i];
+    for (j = i; (j > 0U) && (p[j - 1U] > x); j--)
+    {
+      p[j] = p[j - 1U];
+    }
+    p[j] = x;
+  }
+}
+
+static void arm_radix_insertion_u64(uint64_t * p, uint32_t n)
+{
+  uint32_t i, j;
+  uint64_t x;
+
+  for (i = 1U; i < n; i++)
+  {
+    x = p[i];
+    for (j = i; (j > 0U) && (p[j - 1U] > x); j--)
+    {
+      p[j] = p[j - 1U];
+    }
+    p[j] = x;
+  }
+}
+
+/*
+ * Elements of A (la) and B (lb) that make up the first d outputs of their
+ * stable merge: returns how many come from A.
+ */
+static uint32_t arm_radix_corank_u32(const uint32_t * pA, uint32_t la, const uint32_t * pB, uint32_t lb, uint32_t d)
+{
+  uint32_t lo = (d > lb) ? d - lb : 0U;
+  uint32_t hi = (d < la) ? d : la;
+  uint32_t i;
+
+  while (lo < hi)
+  {
+    i = (lo + hi) >> 1;
+    if (pA[i] <= pB[d - i - 1U])
+    {
+      lo = i + 1U;
+    }
+    else
+    {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+static uint32_t arm_radix_corank_u64(const uint64_t * pA, uint32_t la, const uint64_t * pB, uint32_t lb, uint32_t d)
+{
+  uint32_t lo = (d > lb) ? d - lb : 0U;
+  uint32_t hi = (d < la) ? d : la;
+  uint32_t i;
+
+  while (lo < hi)
+  {
+    i = (lo + hi) >> 1;
+    if (pA[i] <= pB[d - i - 1U])
+    {
+      lo = i + 1U;
+    }
+    else
+    {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/* Outputs d0 to d1 - 1 of the stable merge of A and B */
+static void arm_radix_merge_u32(
+  const uint32_t * pA, uint32_t la,
+  const uint32_t * pB, uint32_t lb,
+  uint32_t d0, uint32_t d1,
+  uint32_t * pOut)
+{
+  uint32_t i = arm_radix_corank_u32(pA, la, pB, lb, d0);
+  uint32_t j = d0 - i;
+  uint32_t iEnd = arm_radix_corank_u32(pA, la, pB, lb, d1);
+  uint32_t jEnd = d1 - iEnd;
+
+  while ((i < iEnd) && (j < jEnd))
+  {
+    *pOut++ = (pA[i] <= pB[j]) ? pA[i++] : pB[j++];
+  }
+  while (i < iEnd)
+  {
+    *pOut++ = pA[i++];
+  }
+  while (j < jEnd)
+  {
+    *pOut++ = pB[j++];
+  }
+}
+
+static void arm_radix_merge_u64(
+  const uint64_t * pA, uint32_t la,
+  const uint64_t * pB, uint32_t lb,
+  uint32_t d0, uint32_t d1,
+  uint64_t * pOut)
+{
+  uint32_t i = arm_radix_corank_u64(pA, la, pB, lb, d0);
+  uint32_t j = d0 - i;
+  uint32_t iEnd = arm_radix_corank_u64(pA, la, pB, lb, d1);
+  uint32_t jEnd = d1 - iEnd;
+
+  while ((i < iEnd) && (j < jEnd))
+  {
+    *pOut++ = (pA[i] <= pB[j]) ? pA[i++] : pB[j++];
+  }
+  while (i < iEnd)
+  {
+    *pOut++ = pA[i++];
+  }
+  while (j < jEnd)
+  {
+    *pOut++ = pB[j++];
+  }
+}
+
+static void arm_radix_sort_part(void * arg, arm_parallel_team * team, uint32_t part)
+{
+  arm_radix_sort_job * J = (arm_radix_sort_job *) arg;
+  uint32_t T = team->numParts;
+  uint32_t n = J->blockSize;
+  uint32_t lo = arm_radix_bound(part, T, n);
+  uint32_t hi = arm_radix_bound(part + 1U, T, n);
+  uint32_t orBits = 0U, andBits = 0xFFFFFFFFU, mask;
+  uint32_t cur = 0U, shift, w, g, q, i;
+  uint32_t count[4][256];
+
+  arm_radix_make_keys(J, part, lo, hi, count);
+  arm_parallel_sync(team);
+
+  for (q = 0U; q < T; q++)
+  {
+    orBits |= J->orBits[q];
+    andBits &= J->andBits[q];
+  }
+  mask = orBits ^ andBits;
+
+  /* Sort the chunk; every part makes the same number of passes */
+  if (n <= ARM_RADIX_SORT_SMALL)
+  {
+    if (J->pIndex == NULL)
+      arm_radix_insertion_u32(J->pBuf32[0], n);
+    else
+      arm_radix_insertion_u64(J->pBuf64[0], n);
+  }
+  else
+  {
+    for (shift = 0U; shift < 32U; shift += 8U)
+    {
+      if (((mask >> shift) & 0xFFU) == 0U)
+      {
+        continue;
+      }
+      if (J->pIndex == NULL)
+        arm_radix_pass_u32(J->pBuf32[cur] + lo, J->pBuf32[cur ^ 1U] + lo, hi - lo, shift, count[shift >> 3]);
+      else
+        arm_radix_pass_u64(J->pBuf64[cur] + lo, J->pBuf64[cur ^ 1U] + lo, hi - lo, shift, count[shift >> 3]);
+      cur ^= 1U;
+    }
+  }
+
+  /* Merge runs of w chunks pairwise; this part writes outputs lo to hi - 1 */
+  for (w = 1U; w < T; w <<= 1)
+  {
+    arm_parallel_sync(team);
+
+    for (g = 0U; g < T; g += 2U * w)
+    {
+      uint32_t s = arm_radix_bound(g, T, n);
+      uint32_t m = arm_radix_bound((g + w < T) ? g + w : T, T, n);
+      uint32_t e = arm_radix_bound((g + 2U * w < T) ? g + 2U * w : T, T, n);
+      uint32_t d0, d1;
+
+      if ((e <= lo) || (s >= hi))
+      {
+        continue;
+      }
+      d0 = ((lo > s) ? lo : s) - s;
+      d1 = ((hi < e) ? hi : e) - s;
+
+      if (J->pIndex == NULL)
+        arm_radix_merge_u32(J->pBuf32[cur] + s, m - s, J->pBuf32[cur] + m, e - m,
+                            d0, d1, J->pBuf32[cur ^ 1U] + s + d0);
+      else
+        arm_radix_merge_u64(J->pBuf64[cur] + s, m - s, J->pBuf64[cur] + m, e - m,
+                            d0, d1, J->pBuf64[cur ^ 1U] + s + d0);
+    }
+    cur ^= 1U;
+  }
+
+  /* Keys back to values */
+  if (J->pIndex == NULL)
+  {
+    const uint32_t * pKeys = J->pBuf32[cur];
+
+    for (i = lo; i < hi; i++)
+    {
+      arm_radix_unkey(J->type, J->pDst, i, pKeys[i] ^ J->flip);
+    }
+  }
+  else
+  {
+    const uint64_t * pKeys = J->pBuf64[cur];
+
+    for (i = lo; i < hi; i++)
+    {
+      J->pIndex[i] = (uint32_t) pKeys[i];
+      if (J->pDst != NULL)
+      {
+        arm_radix_unkey(J->type, J->pDst, i, (uint32_t) (pKeys[i] >> 32) ^ J->flip);
+      }
+    }
+  }
+}
+
+void arm_radix_sort_core(
+  arm_sort_key_type type,
+  arm_sort_dir dir,
+  uint32_t numThreads,
+  const void * pSrc,
+        void * pDst,
+        uint32_t * pIndex,
+        uint64_t * pScratch,
+        uint32_t blockSize)
+{
+  arm_radix_sort_job job;
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  job.type = type;
+  job.flip = (dir == ARM_SORT_ASCENDING) ? 0U : 0xFFFFFFFFU;
+  job.pSrc = pSrc;
+  job.pDst = pDst;
+  job.pIndex = pIndex;
+  job.pBuf32[0] = (uint32_t *) pScratch;
+  job.pBuf32[1] = (uint32_t *) pScratch + blockSize;
+  job.pBuf64[0] = pScratch;
+  job.pBuf64[1] = pScratch + blockSize;
+  job.blockSize = blockSize;
+
+  arm_parallel_run(arm_radix_sort_part, &job,
+                   arm_parallel_threads(numThreads, blockSize, ARM_RADIX_SORT_MT_MIN));
+}
+
+static void arm_topk_sift_down(uint64_t * pHeap, uint32_t i, uint32_t n)
+{
+  uint64_t x = pHeap[i];
+  uint32_t c;
+
+  while ((c = 2U * i + 1U) < n)
+  {
+    if ((c + 1U < n) && (pHeap[c + 1U] > pHeap[c]))
+    {
+      c++;
+    }
+    if (pHeap[c] <= x)
+    {
+      break;
+    }
+    pHeap[i] = pHeap[c];
+    i = c;
+  }
+  pHeap[i] = x;
+}
+
+uint32_t arm_topk_core(
+  arm_sort_key_type type,
+  arm_sort_dir dir,
+  const void * pSrc,
+        uint32_t blockSize,
+        uint32_t k,
+        void * pDst,
+        uint32_t * pIndex,
+        uint64_t * pHeap)
+{
+  uint32_t flip = (dir == ARM_SORT_ASCENDING) ? 0U : 0xFFFFFFFFU;
+  uint32_t i, key, worst;
+
+  if (k > blockSize)
+  {
+    k = blockSize;
+  }
+  if (k == 0U)
+  {
+    return 0U;
+  }
+
+  /*
+   * Max-heap of the k best composites so far. A later element carries a
+   * larger index than everything in the heap, so it only gets in with a
+   * strictly better key than the root.
+   */
+  for (i = 0U; i < k; i++)
+  {
+    pHeap[i] = ((uint64_t) (arm_radix_key(type, pSrc, i) ^ flip) << 32) | i;
+  }
+  for (i = k / 2U; i > 0U; i--)
+  {
+    arm_topk_sift_down(pHeap, i - 1U, k);
+  }
+
+  worst = (uint32_t) (pHeap[0] >> 32);
+  for (i = k; i < blockSize; i++)
+  {
+    key = arm_radix_key(type, pSrc, i) ^ flip;
+    if (key < worst)
+    {
+      pHeap[0] = ((uint64_t) key << 32) | i;
+      arm_topk_sift_down(pHeap, 0U, k);
+      worst = (uint32_t) (pHeap[0] >> 32);
+    }
+  }
+
+  /* Heap sort in place, best first */
+  for (i = k - 1U; i > 0U; i--)
+  {
+    uint64_t t = pHeap[0];
+    pHeap[0] = pHeap[i];
+    pHeap[i] = t;
+    arm_topk_sift_down(pHeap, 0U, i);
+  }
+
+  for (i = 0U; i < k; i++)
+  {
+    if (pIndex != NULL)
+    {
+      pIndex[i] = (uint32_t) pHeap[i];
+    }
+    if (pDst != NULL)
+    {
+      arm_radix_unkey(type, pDst, i, (uint32_t) (pHeap[i] >> 32) ^ flip);
+    }
+  }
+  return k;
+}
@@ -0,0 +1,51 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_radix_sort_init_f32.c
+ * Description:  Floating point radix sort initialization function
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+
+  /**
+   * @param[in,out]  S            points to an instance of the sorting structure.
+   * @param[in]      dir          Sorting order.
+   * @param[in]      numThreads   Threads for large arrays, 0 for all CPUs, 1 for none.
+   * @param[in]      pScratch     Working buffer, see ARM_RADIX_SORT_SCRATCH_SIZE.
+   */
+void arm_radix_sort_init_f32(arm_radix_sort_instance_f32 * S, arm_sort_dir dir, uint32_t numThreads, uint64_t * pScratch)
+{
+    S->dir        = dir;
+    S->numThreads = numThreads;
+    S->pScratch   = pScratch;
+}
+/**
+  @} end of Sorting group
+ */
@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_radix_sort_q31.c
+ * Description:  Q31 radix sort
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_sorting.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   *
+   * @par        Algorithm
+   *               Least significant digit radix sort on 8-bit digits, with
+   *               the digits that are equal across the whole input skipped.
+   *               Short inputs use an insertion sort. The sort is stable and
+   *               runs in linear time. The digit histograms take 4 KB of
+   *               stack.
+   *
+   * @par          Multithreading
+   *               When the library is built with ARM_MATH_PTHREAD, large
+   *               inputs are split over S->numThreads threads: each sorts a
+   *               chunk, then the chunks are merged pairwise, every merge
+   *               round shared by all threads.
+   *
+   * @par          A work array of ARM_RADIX_SORT_SCRATCH_SIZE(blockSize) words
+   *               must be linked to the instance. pSrc is not modified and may
+   *               be the same buffer as pDst.
+   */
+void arm_radix_sort_q31(
+  const arm_radix_sort_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+    arm_radix_sort_core(ARM_SORT_KEY_Q31, S->dir, S->numThreads, pSrc, pDst, NULL, S->pScratch, blockSize);
+}
+/**
+  @} end of Sorting group
+ */
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_topk_f32.c
+ * Description:  Floating point partial sort of the k first elements
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_sorting.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  blockSize  number of samples in pSrc.
+   * @param[in]  k          number of elements to select.
+   * @param[out] pDst       points to the selected values, or NULL.
+   * @param[out] pIndex     points to their indices in pSrc, or NULL.
+   * @return     number of elements written, min(k, blockSize).
+   *
+   * @par        Algorithm
+   *               Writes the first k elements of the stable sort of pSrc in
+   *               the S->dir order, i.e. the k largest values in descending
+   *               order for ARM_SORT_DESCENDING, without sorting the rest. A
+   *               heap of the k best elements seen so far is kept; most
+   *               elements are rejected with a single compare, so the cost
+   *               is close to one pass over the input for small k.
+   *
+   * @par          A work array of ARM_TOPK_SCRATCH_SIZE(k) words must be
+   *               linked to the instance. The selection is single-threaded.
+   */
+uint32_t arm_topk_f32(
+  const arm_radix_sort_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        uint32_t k,
+        float32_t * pDst,
+        uint32_t * pIndex)
+{
+    return arm_topk_core(ARM_SORT_KEY_F32, S->dir, pSrc, blockSize, k, pDst, pIndex, S->pScratch);
+}
+/**
+  @} end of Sorting group
+ */
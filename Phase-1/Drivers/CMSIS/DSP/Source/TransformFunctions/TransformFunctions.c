@@ -48,6 +48,11 @@
 #include "arm_rfft_fast_init_f32.c"
 #include "arm_rfft_fast_init_f64.c"
 
+#include "arm_cfft_batch_f32.c"
+#include "arm_rfft_fast_batch_f32.c"
+#include "arm_stft_f32.c"
+#include "arm_stft_init_f32.c"
+
 #include "arm_mfcc_init_f32.c"
 #include "arm_mfcc_f32.c"
 
@@ -57,6 +62,9 @@
 #include "arm_mfcc_init_q15.c"
 #include "arm_mfcc_q15.c"
 
+#include "arm_logmel_stream_init_q15.c"
+#include "arm_logmel_stream_q15.c"
+
 /* Deprecated */
 
 #include "arm_dct4_f32.c"
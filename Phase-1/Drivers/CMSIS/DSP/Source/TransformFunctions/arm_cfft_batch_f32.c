@@ -0,0 +1,431 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_batch_f32.c
+ * Description:  Floating-point complex FFT of several frames in one call
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup BatchFFT Batched FFT Functions
+
+  Transforms of many frames of the same length in one call, for
+  spectrograms, STFT and filter banks.
+
+  A loop over \ref arm_cfft_f32 re-reads the twiddle table and recomputes
+  the bit reversal for every frame. The batched functions run each
+  butterfly stage over all the frames of a tile before moving to the next
+  stage: every twiddle is loaded once per tile and the innermost loop runs
+  over frames, with a constant stride. In the interleaved layout that
+  stride is unit, which is the shape vectorizers and SIMD backends want.
+
+  Two memory layouts are supported (\ref arm_fft_batch_layout):
+  - <code>ARM_FFT_BATCH_CONTIGUOUS</code>: each frame is a contiguous
+    buffer in the usual single-frame format, frame <code>f</code> starting
+    <code>frameStride</code> values after frame <code>f-1</code>.
+  - <code>ARM_FFT_BATCH_INTERLEAVED</code>: value <code>n</code> of frame
+    <code>f</code> is stored at <code>n * numFrames + f</code> (complex
+    values for the CFFT, real values for the RFFT).
+
+  Frames are processed in tiles of about \ref ARM_FFT_BATCH_TILE_BYTES so
+  the working set stays in cache on cores that have one. Long transforms
+  run their first stages over the whole tile and finish each independent
+  sub-transform in turn once it fits.
+
+  Results match the single-frame functions with <code>bitReverseFlag</code>
+  set (natural order) to within floating-point rounding; the arithmetic
+  is radix-4 with a radix-2 stage for odd powers of two, not the radix-8
+  kernel of \ref arm_cfft_f32. The instance structures and their
+  twiddle tables are the single-frame ones.
+ */
+
+/**
+  @addtogroup BatchFFT
+  @{
+ */
+
+/*
+ * All the stage loops address value k of frame f of the tile as
+ *   re: p[k * vs + f * fs]    im: re + io
+ * They are forced inline into arm_cfft_batch_core_f32 with the frame
+ * stride known at compile time for the interleaved cases (fs = 1 or 2).
+ */
+
+__STATIC_FORCEINLINE void arm_cfft_batch_radix2_f32(
+        float32_t * p,
+  const float32_t * pTw,
+        uint32_t L,
+        uint32_t vs,
+        uint32_t fs,
+        int32_t io,
+        uint32_t numFrames)
+{
+  uint32_t half = L >> 1U, j, f;
+
+  for (j = 0U; j < half; j++)
+  {
+    const float32_t wr = pTw[2U * j];
+    const float32_t wi = pTw[2U * j + 1U];
+    float32_t *pA = p + j * vs;
+    float32_t *pB = pA + half * vs;
+
+    for (f = 0U; f < numFrames; f++)
+    {
+      float32_t *a = pA + f * fs;
+      float32_t *b = pB + f * fs;
+      float32_t ar = a[0], ai = a[io], br = b[0], bi = b[io];
+      float32_t tr = ar - br, ti = ai - bi;
+
+      a[0]  = ar + br;
+      a[io] = ai + bi;
+      /* (a - b) * conj(w) */
+      b[0]  = tr * wr + ti * wi;
+      b[io] = ti * wr - tr * wi;
+    }
+  }
+}
+
+__STATIC_FORCEINLINE void arm_cfft_batch_radix4_f32(
+        float32_t * p,
+  const float32_t * pTw,
+        uint32_t step,
+        uint32_t len,
+        uint32_t span,
+        uint32_t vs,
+        uint32_t fs,
+        int32_t io,
+        uint32_t numFrames)
+{
+  uint32_t q = len >> 2U;
+  uint32_t j, base, f;
+
+  for (j = 0U; j < q; j++)
+  {
+    const float32_t w1r = pTw[2U * j * step],      w1i = pTw[2U * j * step + 1U];
+    const float32_t w2r = pTw[4U * j * step],      w2i = pTw[4U * j * step + 1U];
+    const float32_t w3r = pTw[6U * j * step],      w3i = pTw[6U * j * step + 1U];
+
+    for (base = 0U; base < span; base += len)
+    {
+      float32_t *pA = p + (base + j) * vs;
+      float32_t *pB = pA + q * vs;
+      float32_t *pC = pB + q * vs;
+      float32_t *pD = pC + q * vs;
+
+      for (f = 0U; f < numFrames; f++)
+      {
+        float32_t *a = pA + f * fs, *b = pB + f * fs, *c = pC + f * fs, *d = pD + f * fs;
+        float32_t t0r = a[0] + c[0],  t0i = a[io] + c[io];
+        float32_t t1r = a[0] - c[0],  t1i = a[io] - c[io];
+        float32_t t2r = b[0] + d[0],  t2i = b[io] + d[io];
+        float32_t t3r = b[0] - d[0],  t3i = b[io] - d[io];
+        float32_t yr, yi;
+
+        /* Outputs k = 0, 2, 1, 3 (mod 4): the final order is binary bit-reversed */
+        a[0]  = t0r + t2r;
+        a[io] = t0i + t2i;
+
+        yr = t0r - t2r;
+        yi = t0i - t2i;
+        b[0]  = yr * w2r + yi * w2i;
+        b[io] = yi * w2r - yr * w2i;
+
+        /* t1 - j*t3 */
+        yr = t1r + t3i;
+        yi = t1i - t3r;
+        c[0]  = yr * w1r + yi * w1i;
+        c[io] = yi * w1r - yr * w1i;
+
+        /* t1 + j*t3 */
+        yr = t1r - t3i;
+        yi = t1i + t3r;
+        d[0]  = yr * w3r + yi * w3i;
+        d[io] = yi * w3r - yr * w3i;
+      }
+    }
+  }
+}
+
+/*
+ * Last stage: one radix-4 butterfly without twiddles per group of 4 values.
+ * Also applies the 1/fftLen scaling of the inverse, which saves a pass.
+ */
+__STATIC_FORCEINLINE void arm_cfft_batch_radix4_last_f32(
+        float32_t * p,
+        uint32_t span,
+        uint32_t vs,
+        uint32_t fs,
+        int32_t io,
+        uint32_t numFrames,
+        float32_t scale)
+{
+  uint32_t g, f;
+
+  for (g = 0U; g < span; g += 4U)
+  {
+    float32_t *pA = p + g * vs;
+    float32_t *pB = pA + vs;
+    float32_t *pC = pB + vs;
+    float32_t *pD = pC + vs;
+
+    for (f = 0U; f < numFrames; f++)
+    {
+      float32_t *a = pA + f * fs, *b = pB + f * fs, *c = pC + f * fs, *d = pD + f * fs;
+      float32_t t0r = a[0] + c[0],  t0i = a[io] + c[io];
+      float32_t t1r = a[0] - c[0],  t1i = a[io] - c[io];
+      float32_t t2r = b[0] + d[0],  t2i = b[io] + d[io];
+      float32_t t3r = b[0] - d[0],  t3i = b[io] - d[io];
+
+      a[0]  = (t0r + t2r) * scale;
+      a[io] = (t0i + t2i) * scale;
+      b[0]  = (t0r - t2r) * scale;
+      b[io] = (t0i - t2i) * scale;
+      c[0]  = (t1r + t3i) * scale;
+      c[io] = (t1i - t3r) * scale;
+      d[0]  = (t1r - t3i) * scale;
+      d[io] = (t1i + t3r) * scale;
+    }
+  }
+}
+
+/* Binary bit reversal, the index sequence is computed once for all frames */
+__STATIC_FORCEINLINE void arm_cfft_batch_bitreversal_f32(
+        float32_t * p,
+        uint32_t L,
+        uint32_t vs,
+        uint32_t fs,
+        int32_t io,
+        uint32_t numFrames)
+{
+  uint32_t i, j = 0U, f;
+
+  for (i = 0U; i < L; i++)
+  {
+    uint32_t bit = L >> 1U;
+
+    if (i < j)
+    {
+      float32_t *pA = p + i * vs;
+      float32_t *pB = p + j * vs;
+
+      for (f = 0U; f < numFrames; f++)
+      {
+        float32_t *a = pA + f * fs, *b = pB + f * fs;
+        float32_t tr = a[0], ti = a[io];
+
+        a[0]  = b[0];
+        a[io] = b[io];
+        b[0]  = tr;
+        b[io] = ti;
+      }
+    }
+
+    /* Reversed increment of j */
+    while (j & bit)
+    {
+      j ^= bit;
+      bit >>= 1U;
+    }
+    j |= bit;
+  }
+}
+
+__STATIC_FORCEINLINE void arm_cfft_batch_tile_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p,
+        uint32_t vs,
+        uint32_t fs,
+        int32_t io,
+        uint32_t numFrames,
+        float32_t scale)
+{
+  const float32_t *pTw = S->pTwiddle;
+  uint32_t L = S->fftLen, len = L, blk, b;
+
+  if ((31U - __CLZ(L)) & 1U)
+  {
+    arm_cfft_batch_radix2_f32(p, pTw, L, vs, fs, io, numFrames);
+    len = L >> 1U;
+  }
+
+  /* Stage by stage while the sub-transforms of the tile exceed the tile size */
+  while (len >= 16U && len * numFrames * 2U * sizeof(float32_t) > ARM_FFT_BATCH_TILE_BYTES)
+  {
+    arm_cfft_batch_radix4_f32(p, pTw, L / len, len, L, vs, fs, io, numFrames);
+    len >>= 2U;
+  }
+
+  /* Then each independent sub-transform of len values to the end, in cache */
+  blk = len;
+  for (b = 0U; b < L; b += blk)
+  {
+    float32_t *pB = p + b * vs;
+
+    for (len = blk; len >= 16U; len >>= 2U)
+    {
+      arm_cfft_batch_radix4_f32(pB, pTw, L / len, len, blk, vs, fs, io, numFrames);
+    }
+    arm_cfft_batch_radix4_last_f32(pB, blk, vs, fs, io, numFrames, scale);
+  }
+
+  arm_cfft_batch_bitreversal_f32(p, L, vs, fs, io, numFrames);
+}
+
+/**
+  @brief         Batched complex FFT on an arbitrary strided layout.
+  @param[in]     S            points to an instance of the floating-point CFFT structure
+  @param[in,out] pRe          real part of value 0 of frame 0. Processing occurs in-place
+  @param[in]     imOfs        offset from a real part to its imaginary part
+  @param[in]     valStride    offset between consecutive complex values of a frame
+  @param[in]     frameStride  offset between frames
+  @param[in]     numFrames    number of frames
+  @param[in]     ifftFlag     0 for the forward transform, 1 for the inverse
+  @return        none
+
+  @par           Description
+                   Offsets are in float32_t. This is the engine behind
+                   \ref arm_cfft_batch_f32 and \ref arm_rfft_fast_batch_f32,
+                   which only differ in the offsets they pass. The inverse
+                   transform swaps the roles of the real and imaginary parts
+                   (IFFT(x) = swap(FFT(swap(x))) / fftLen), the scaling is
+                   done by the last butterfly stage.
+ */
+void arm_cfft_batch_core_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * pRe,
+        int32_t imOfs,
+        uint32_t valStride,
+        uint32_t frameStride,
+        uint32_t numFrames,
+        uint8_t ifftFlag)
+{
+  uint32_t L = S->fftLen;
+  uint32_t tile, f0, n;
+  float32_t scale = 1.0f;
+
+  /*
+   * Frames per tile. Long transforms still get ARM_FFT_BATCH_MIN_FRAMES
+   * frames so the twiddles are shared; the tile function then splits
+   * them into sub-transforms that fit.
+   */
+  tile = ARM_FFT_BATCH_TILE_BYTES / (2U * sizeof(float32_t) * L);
+  if (tile < ARM_FFT_BATCH_MIN_FRAMES)
+  {
+    /*
+     * Long frames in the single-frame format are a whole cache way apart:
+     * running them side by side thrashes, and there is nothing left to
+     * share that the radix-8 kernel does not already beat.
+     */
+    if (valStride == 2U && imOfs == 1 && frameStride > 2U)
+    {
+      for (f0 = 0U; f0 < numFrames; f0++)
+      {
+        arm_cfft_f32(S, pRe + f0 * frameStride, ifftFlag, 1U);
+      }
+      return;
+    }
+    tile = ARM_FFT_BATCH_MIN_FRAMES;
+  }
+
+  if (ifftFlag == 1U)
+  {
+    pRe += imOfs;
+    imOfs = -imOfs;
+    scale = 1.0f / (float32_t)L;
+  }
+
+  for (f0 = 0U; f0 < numFrames; f0 += tile)
+  {
+    float32_t *p = pRe + f0 * frameStride;
+
+    n = (numFrames - f0 < tile) ? numFrames - f0 : tile;
+
+    if (frameStride == 1U)
+    {
+      arm_cfft_batch_tile_f32(S, p, valStride, 1U, imOfs, n, scale);
+    }
+    else if (frameStride == 2U)
+    {
+      arm_cfft_batch_tile_f32(S, p, valStride, 2U, imOfs, n, scale);
+    }
+    else
+    {
+      arm_cfft_batch_tile_f32(S, p, valStride, frameStride, imOfs, n, scale);
+    }
+  }
+}
+
+/**
+  @brief         Processing function for the batched floating-point complex FFT.
+  @param[in]     S            points to an instance of the floating-point CFFT structure
+  @param[in,out] p            points to the frames. Processing occurs in-place
+  @param[in]     numFrames    number of frames
+  @param[in]     frameStride  distance in float32_t between the starts of consecutive frames,
+                              at least <code>2*fftLen</code>. Only used by the contiguous layout
+  @param[in]     layout       memory layout of the frames
+  @param[in]     ifftFlag     flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : frame stride too small or unknown layout
+
+  @par           Description
+                   Same result as calling \ref arm_cfft_f32 with
+                   <code>bitReverseFlag = 1</code> on each frame.
+ */
+arm_status arm_cfft_batch_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p,
+        uint32_t numFrames,
+        uint32_t frameStride,
+        arm_fft_batch_layout layout,
+        uint8_t ifftFlag)
+{
+  uint32_t L = S->fftLen;
+
+  switch (layout)
+  {
+  case ARM_FFT_BATCH_CONTIGUOUS:
+    if (frameStride < 2U * L)
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+    arm_cfft_batch_core_f32(S, p, 1, 2U, frameStride, numFrames, ifftFlag);
+    break;
+
+  case ARM_FFT_BATCH_INTERLEAVED:
+    arm_cfft_batch_core_f32(S, p, 1, 2U * numFrames, 2U, numFrames, ifftFlag);
+    break;
+
+  default:
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of BatchFFT group
+ */
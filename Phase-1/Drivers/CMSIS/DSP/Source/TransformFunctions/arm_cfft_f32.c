@@ -29,6 +29,10 @@
 #include "dsp/transform_functions.h"
 #include "arm_common_tables.h"
 
+#if defined(ARM_MATH_X86)
+#include "arm_x86_kernels.h"
+#endif
+
 #if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
 
 #include "arm_helium_utils.h"
@@ -1138,6 +1142,14 @@ void arm_cfft_f32(
   uint32_t  L = S->fftLen, l;
   float32_t invL, * pSrc;
 
+#if defined(ARM_MATH_X86)
+  if (bitReverseFlag && (arm_x86_get_level() >= ARM_X86_LEVEL_AVX2))
+  {
+    arm_cfft_f32_avx2(S, p1, ifftFlag);
+    return;
+  }
+#endif
+
   if (ifftFlag == 1U)
   {
     /* Conjugate input data */
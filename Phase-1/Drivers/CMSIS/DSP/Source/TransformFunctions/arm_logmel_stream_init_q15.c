@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_logmel_stream_init_q15.c
+ * Description:  Initialization function for the streaming Q15 log-mel extractor
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+extern void arm_logmel_stream_frame_q15(
+  arm_logmel_stream_instance_q15 * S);
+
+/**
+  @addtogroup LogMelStream
+  @{
+ */
+
+/**
+  @brief         Initialization function for the streaming Q15 log-mel extractor.
+  @param[out]    S              points to the extractor instance
+  @param[in]     fftLen         FFT length, a length supported by \ref arm_rfft_q15
+  @param[in]     winLen         samples per frame, at most <code>fftLen</code>
+  @param[in]     hopLen         samples between frame starts, 1 to <code>winLen</code>
+  @param[in]     nbMelFilters   number of Mel filters
+  @param[in]     nbDctOutputs   number of DCT outputs, ignored when <code>dctCoefs</code> is NULL
+  @param[in]     dctCoefs       DCT coefficients in Q15, <code>nbDctOutputs x nbMelFilters</code>,
+                                or NULL for log-mel rows
+  @param[in]     filterPos      first FFT bin of each Mel filter
+  @param[in]     filterLengths  number of bins of each Mel filter
+  @param[in]     filterCoefs    Mel filter coefficients in Q15
+  @param[in]     windowCoefs    window of <code>winLen</code> coefficients in Q15
+  @param[in]     pFeatures      feature matrix of <code>numRows x rowLen</code> values
+  @param[in]     numRows        rows of the feature matrix
+  @param[in]     pState         state buffer, of length
+                                <code>ARM_LOGMEL_STREAM_STATE_SIZE_Q15(fftLen, winLen, nbMelFilters)</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a length is out of range or the FFT length is not supported
+
+  @par           Details
+                   <code>rowLen</code> is <code>nbDctOutputs</code> with a DCT and
+                   <code>nbMelFilters</code> without. The tables are used in place
+                   and must stay valid. The frame buffer starts with
+                   <code>winLen - hopLen</code> zeros, so the first row comes
+                   after <code>hopLen</code> samples, and the feature matrix is
+                   filled with the row of that silent frame.
+
+  @par
+                   <code>adcBits</code> is set to 12 and <code>dcCoef</code> to
+                   0.995 for \ref arm_logmel_stream_adc_q15; both can be changed
+                   after this call.
+ */
+arm_status arm_logmel_stream_init_q15(
+  arm_logmel_stream_instance_q15 * S,
+  uint32_t fftLen,
+  uint32_t winLen,
+  uint32_t hopLen,
+  uint32_t nbMelFilters,
+  uint32_t nbDctOutputs,
+  const q15_t *dctCoefs,
+  const uint32_t *filterPos,
+  const uint32_t *filterLengths,
+  const q15_t *filterCoefs,
+  const q15_t *windowCoefs,
+  q15_t *pFeatures,
+  uint32_t numRows,
+  q31_t *pState)
+{
+  uint32_t rowLen = (dctCoefs != NULL) ? nbDctOutputs : nbMelFilters;
+  uint32_t r;
+  arm_status status;
+
+  if (winLen == 0U || winLen > fftLen || fftLen > 0xFFFFU
+      || hopLen == 0U || hopLen > winLen
+      || nbMelFilters == 0U || nbMelFilters > 0xFFFFU
+      || rowLen == 0U || rowLen > 0xFFFFU
+      || numRows == 0U || numRows > 0xFFFFU)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  status = arm_rfft_init_q15(&S->rfft, fftLen, 0U, 1U);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  S->dctCoefs = dctCoefs;
+  S->filterCoefs = filterCoefs;
+  S->windowCoefs = windowCoefs;
+  S->filterPos = filterPos;
+  S->filterLengths = filterLengths;
+  S->fftLen = (uint16_t) fftLen;
+  S->winLen = (uint16_t) winLen;
+  S->hopLen = (uint16_t) hopLen;
+  S->fill = (uint16_t) (winLen - hopLen);
+  S->nbMelFilters = (uint16_t) nbMelFilters;
+  S->rowLen = (uint16_t) rowLen;
+  S->numRows = (uint16_t) numRows;
+  S->adcBits = 12U;
+  S->dcCoef = 0x7F5C;
+  S->dcIn = 0;
+  S->dcOut = 0;
+  S->pFeatures = pFeatures;
+  S->pState = pState;
+
+  memset(pState, 0, ARM_LOGMEL_STREAM_STATE_SIZE_Q15(fftLen, winLen, nbMelFilters) * sizeof(q31_t));
+
+  /* Row of a silent frame, last row of the matrix, copied to the others */
+  arm_logmel_stream_frame_q15(S);
+  for (r = 0U; r + 1U < numRows; r++)
+  {
+    memcpy(pFeatures + r * rowLen, pFeatures + (numRows - 1U) * rowLen, rowLen * sizeof(q15_t));
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of LogMelStream group
+ */
@@ -0,0 +1,264 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_logmel_stream_q15.c
+ * Description:  Streaming Q15 STFT and log-mel feature extraction
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+#include "dsp/statistics_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/matrix_functions.h"
+
+/* ln(2) in Q5.26 */
+#define ARM_LOGMEL_LN2_Q26 0x02C5C860
+
+/* 1e-6 in Q51, the floor added to the Mel energies as in arm_mfcc_f32 */
+#define ARM_LOGMEL_EPS_Q51 2251800
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup LogMelStream Streaming Log-Mel Features
+
+  Feature extraction for keyword spotting on the microcontroller: audio
+  goes in as it arrives from the DMA, in blocks of any length, and rows of
+  log-mel energies (or MFCCs) come out in a feature matrix that a CMSIS-NN
+  network reads in place.
+
+  The extractor keeps the last <code>winLen</code> samples. Every
+  <code>hopLen</code> new samples, the frame is windowed, transformed by
+  \ref arm_rfft_q15 and the magnitudes of the bins are summed by the Mel
+  filters. The tables have the same format as those of
+  \ref arm_mfcc_init_q15, except that the window has <code>winLen</code>
+  coefficients and is zero-padded to <code>fftLen</code> internally.
+
+  The values are those of \ref arm_mfcc_f32 on the same frame without
+  its normalization: <code>ln(sum of w[k] * |X[k]|) + 1e-6)</code>, with
+  <code>|X[k]|</code> the magnitude of the unscaled FFT of the windowed
+  Q15 samples read as values in [-1, 1). Unlike \ref arm_mfcc_q15, the
+  frame is normalized by a power of 2 before the FFT (block floating
+  point) and the shift is added back in the log domain, so the features
+  keep the absolute level of the signal and quiet frames keep the full
+  precision of the Q15 FFT. Features are in Q8.7, the format of
+  \ref arm_mfcc_q15.
+
+  The feature matrix has <code>numRows</code> rows of
+  <code>rowLen</code> values, oldest row first: each new frame shifts it
+  up by one row and writes the new row last, so the network input stays
+  at the same address and in time order. It starts filled with the row
+  of a silent frame.
+ */
+
+/**
+  @addtogroup LogMelStream
+  @{
+ */
+
+/**
+  @brief         Computes the features of the frame buffer and appends them to the feature matrix.
+  @param[in,out] S  points to the extractor instance
+  @return        none
+
+  @par           Details
+                   Used by the processing functions once <code>winLen</code> samples
+                   are buffered, and by the initialization to fill the matrix.
+ */
+void arm_logmel_stream_frame_q15(
+  arm_logmel_stream_instance_q15 * S)
+{
+  const uint32_t N = S->fftLen;                        /* FFT length */
+  const uint32_t W = S->winLen;                        /* Frame length */
+  const uint32_t M = S->nbMelFilters;                  /* Number of Mel filters */
+  const uint32_t log2N = 31U - __CLZ(N);
+  q31_t *pMel  = S->pState;                            /* Mel energies, then their log */
+  q15_t *pWork = (q15_t *) (pMel + M);                 /* Windowed frame, then magnitudes, N */
+  q15_t *pSpec = pWork + N;                            /* Spectrum, 2*N */
+  q15_t *pBuf  = pSpec + 2U * N;                       /* Frame buffer, W */
+  q15_t *pLog  = pBuf + W;                             /* Log-Mel energies in Q8.7, M */
+  q15_t *pRow  = S->pFeatures + (uint32_t) (S->numRows - 1U) * S->rowLen;
+  const q15_t *pCoefs = S->filterCoefs;
+  q15_t maxValue;
+  uint32_t index, shift, e, i;
+  q63_t acc, eps, hi;
+
+  /* Block floating point: bring the peak to [0.5, 1), before the window rounds */
+  arm_absmax_q15(pBuf, W, &maxValue, &index);
+  shift = (maxValue > 0) ? __CLZ((uint32_t) maxValue) - 17U : 0U;
+  arm_shift_q15(pBuf, (int8_t) shift, pWork, W);
+  arm_mult_q15(pWork, S->windowCoefs, pWork, W);
+  memset(pWork + W, 0, (N - W) * sizeof(q15_t));
+
+  /* |X[k]| * 2^shift / (2 * N) in Q15 */
+  arm_rfft_q15(&S->rfft, pWork, pSpec);
+  arm_cmplx_mag_q15(pSpec, pWork, N / 2U + 1U);
+
+  /* Mel energies in Q30, floored at 1e-6 in the same scale */
+  eps = ((q63_t) ARM_LOGMEL_EPS_Q51 << shift) >> (log2N + 22U);
+  for (i = 0U; i < M; i++)
+  {
+    arm_dot_prod_q15(pWork + S->filterPos[i], pCoefs, S->filterLengths[i], &acc);
+    pCoefs += S->filterLengths[i];
+    acc += eps;
+    if (acc <= 0)
+    {
+      acc = 1;
+    }
+
+    /* Mantissa in Q31 for arm_vlog_q31, exponent in e */
+    hi = acc >> 31;
+    e = (hi != 0) ? 32U - __CLZ((uint32_t) hi) : 0U;
+    pMel[i] = (q31_t) (acc >> e);
+    arm_vlog_q31(&pMel[i], &pMel[i], 1U);
+
+    /*
+     * ln(acc / 2^31) = ln(energy) - (1 + e) ln 2 and the energy is
+     * scaled by 2^shift / (2 * N): add back (e + 2 + log2N - shift) ln 2,
+     * then Q5.26 -> Q8.7
+     */
+    acc = (q63_t) pMel[i] + (q63_t) ((int32_t) (e + 2U + log2N) - (int32_t) shift) * ARM_LOGMEL_LN2_Q26;
+    pLog[i] = (q15_t) __SSAT((q31_t) ((acc + (1 << 18)) >> 19), 16);
+  }
+
+  /* Shift the matrix up by one row and append */
+  memmove(S->pFeatures, S->pFeatures + S->rowLen,
+          (uint32_t) (S->numRows - 1U) * S->rowLen * sizeof(q15_t));
+  if (S->dctCoefs != NULL)
+  {
+    arm_matrix_instance_q15 dct;
+
+    dct.numRows = S->rowLen;
+    dct.numCols = (uint16_t) M;
+    dct.pData = (q15_t *) S->dctCoefs;
+    arm_mat_vec_mult_q15(&dct, pLog, pRow);
+  }
+  else
+  {
+    memcpy(pRow, pLog, M * sizeof(q15_t));
+  }
+}
+
+/**
+  @brief         Streaming Q15 log-mel extractor, signed Q15 samples.
+  @param[in,out] S          points to the extractor instance
+  @param[in]     pSrc       points to the block of samples
+  @param[in]     blockSize  number of samples, any length
+  @return        number of feature rows added to the matrix
+
+  @par           Details
+                   For I2S / SAI / PDM-filtered PCM. The last
+                   <code>numRows</code> rows are in the feature matrix, so the
+                   return value is what a caller running the network every few
+                   rows counts.
+ */
+uint32_t arm_logmel_stream_q15(
+  arm_logmel_stream_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize)
+{
+  const uint32_t W = S->winLen;
+  q15_t *pBuf = (q15_t *) (S->pState + S->nbMelFilters) + 3U * S->fftLen;
+  uint32_t rows = 0U, n;
+
+  while (blockSize > 0U)
+  {
+    n = W - S->fill;
+    n = (n < blockSize) ? n : blockSize;
+    memcpy(pBuf + S->fill, pSrc, n * sizeof(q15_t));
+    S->fill += (uint16_t) n;
+    pSrc += n;
+    blockSize -= n;
+
+    if (S->fill == W)
+    {
+      arm_logmel_stream_frame_q15(S);
+      memmove(pBuf, pBuf + S->hopLen, (W - S->hopLen) * sizeof(q15_t));
+      S->fill = (uint16_t) (W - S->hopLen);
+      rows++;
+    }
+  }
+
+  return rows;
+}
+
+/**
+  @brief         Streaming Q15 log-mel extractor, unsigned right-aligned ADC samples.
+  @param[in,out] S          points to the extractor instance
+  @param[in]     pSrc       points to the block of ADC samples of <code>adcBits</code> bits
+  @param[in]     blockSize  number of samples, any length
+  @return        number of feature rows added to the matrix
+
+  @par           Details
+                   Reads the half-word buffer of an ADC in circular DMA mode as
+                   it is, typically half of it from the half-transfer and
+                   transfer-complete callbacks. The samples are centred on
+                   mid-scale, scaled to Q15 and go through a DC blocker
+                   <code>y[n] = x[n] - x[n-1] + dcCoef * y[n-1]</code>
+                   (13 Hz at 16 kHz with the default 0.995), since the bias of
+                   an analog microphone front end is never exactly mid-scale.
+ */
+uint32_t arm_logmel_stream_adc_q15(
+  arm_logmel_stream_instance_q15 * S,
+  const uint16_t * pSrc,
+  uint32_t blockSize)
+{
+  const uint32_t W = S->winLen;
+  const uint32_t bits = S->adcBits;
+  const q31_t mid = (q31_t) 1 << (bits - 1U);
+  const q15_t a = S->dcCoef;
+  q15_t *pBuf = (q15_t *) (S->pState + S->nbMelFilters) + 3U * S->fftLen;
+  q31_t xPrev = S->dcIn, y = S->dcOut, x;
+  uint32_t rows = 0U, n, i;
+
+  while (blockSize > 0U)
+  {
+    n = W - S->fill;
+    n = (n < blockSize) ? n : blockSize;
+    for (i = 0U; i < n; i++)
+    {
+      x = ((q31_t) pSrc[i] - mid) << (16U - bits);
+      y = ((x - xPrev) << 12) + (q31_t) (((q63_t) y * a) >> 15);
+      xPrev = x;
+      pBuf[S->fill + i] = (q15_t) __SSAT(y >> 12, 16);
+    }
+    S->fill += (uint16_t) n;
+    pSrc += n;
+    blockSize -= n;
+
+    if (S->fill == W)
+    {
+      arm_logmel_stream_frame_q15(S);
+      memmove(pBuf, pBuf + S->hopLen, (W - S->hopLen) * sizeof(q15_t));
+      S->fill = (uint16_t) (W - S->hopLen);
+      rows++;
+    }
+  }
+
+  S->dcIn = xPrev;
+  S->dcOut = y;
+
+  return rows;
+}
+
+/**
+  @} end of LogMelStream group
+ */
@@ -0,0 +1,268 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_batch_f32.c
+ * Description:  Floating-point real FFT of several frames in one call
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+extern void arm_cfft_batch_core_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * pRe,
+        int32_t imOfs,
+        uint32_t valStride,
+        uint32_t frameStride,
+        uint32_t numFrames,
+        uint8_t ifftFlag);
+
+/**
+  @addtogroup BatchFFT
+  @{
+ */
+
+/*
+ * Real value n of frame f is at p[n * ns + f * fs]; complex value k of the
+ * packed spectrum is (p[2k * ns], p[(2k + 1) * ns]). Same arithmetic as
+ * stage_rfft_f32 / merge_rfft_f32, with the twiddle loaded once for all
+ * the frames of the tile.
+ */
+
+__STATIC_FORCEINLINE void arm_rfft_batch_split_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  const float32_t * pIn,
+        uint32_t ins,
+        uint32_t ifs,
+        float32_t * pOut,
+        uint32_t ons,
+        uint32_t ofs,
+        uint32_t numFrames)
+{
+  const float32_t *pCoeff = S->pTwiddleRFFT;
+  uint32_t M = S->Sint.fftLen, k, f;
+
+  for (f = 0U; f < numFrames; f++)
+  {
+    float32_t xAR = pIn[f * ifs], xAI = pIn[f * ifs + ins];
+
+    /* Pack first and last sample of the frequency domain together */
+    pOut[f * ofs]       = xAR + xAI;
+    pOut[f * ofs + ons] = xAR - xAI;
+  }
+
+  for (k = 1U; k < M; k++)
+  {
+    const float32_t twR = pCoeff[2U * k], twI = pCoeff[2U * k + 1U];
+    const float32_t *pA = pIn + 2U * k * ins;
+    const float32_t *pB = pIn + 2U * (M - k) * ins;
+    float32_t *pO = pOut + 2U * k * ons;
+
+    for (f = 0U; f < numFrames; f++)
+    {
+      float32_t xAR = pA[f * ifs], xAI = pA[f * ifs + ins];
+      float32_t xBR = pB[f * ifs], xBI = pB[f * ifs + ins];
+      float32_t t1a = xBR - xAR;
+      float32_t t1b = xBI + xAI;
+
+      pO[f * ofs]       = 0.5f * (xAR + xBR + twR * t1a + twI * t1b);
+      pO[f * ofs + ons] = 0.5f * (xAI - xBI + twI * t1a - twR * t1b);
+    }
+  }
+}
+
+__STATIC_FORCEINLINE void arm_rfft_batch_merge_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  const float32_t * pIn,
+        uint32_t ins,
+        uint32_t ifs,
+        float32_t * pOut,
+        uint32_t ons,
+        uint32_t ofs,
+        uint32_t numFrames)
+{
+  const float32_t *pCoeff = S->pTwiddleRFFT;
+  uint32_t M = S->Sint.fftLen, k, f;
+
+  for (f = 0U; f < numFrames; f++)
+  {
+    float32_t xAR = pIn[f * ifs], xAI = pIn[f * ifs + ins];
+
+    pOut[f * ofs]       = 0.5f * (xAR + xAI);
+    pOut[f * ofs + ons] = 0.5f * (xAR - xAI);
+  }
+
+  for (k = 1U; k < M; k++)
+  {
+    const float32_t twR = pCoeff[2U * k], twI = pCoeff[2U * k + 1U];
+    const float32_t *pA = pIn + 2U * k * ins;
+    const float32_t *pB = pIn + 2U * (M - k) * ins;
+    float32_t *pO = pOut + 2U * k * ons;
+
+    for (f = 0U; f < numFrames; f++)
+    {
+      float32_t xAR = pA[f * ifs], xAI = pA[f * ifs + ins];
+      float32_t xBR = pB[f * ifs], xBI = pB[f * ifs + ins];
+      float32_t t1a = xAR - xBR;
+      float32_t t1b = xAI + xBI;
+
+      pO[f * ofs]       = 0.5f * (xAR + xBR - twR * t1a - twI * t1b);
+      pO[f * ofs + ons] = 0.5f * (xAI - xBI + twI * t1a - twR * t1b);
+    }
+  }
+}
+
+/**
+  @brief         Batched real FFT with independent source and destination layouts.
+  @param[in]     S               points to an arm_rfft_fast_instance_f32 structure
+  @param[in,out] pSrc            source frames (modified by this function)
+  @param[in]     srcValStride    offset between consecutive values of a source frame
+  @param[in]     srcFrameStride  offset between source frames
+  @param[out]    pDst            destination frames
+  @param[in]     dstValStride    offset between consecutive values of a destination frame
+  @param[in]     dstFrameStride  offset between destination frames
+  @param[in]     numFrames       number of frames
+  @param[in]     ifftFlag        0 for RFFT, 1 for RIFFT
+  @return        none
+
+  @par           Description
+                   Offsets are in float32_t. Used by \ref arm_rfft_fast_batch_f32
+                   and \ref arm_stft_f32, which windows into an interleaved
+                   scratch buffer and writes contiguous spectra.
+ */
+void arm_rfft_fast_batch_core_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * pSrc,
+        uint32_t srcValStride,
+        uint32_t srcFrameStride,
+        float32_t * pDst,
+        uint32_t dstValStride,
+        uint32_t dstFrameStride,
+        uint32_t numFrames,
+        uint8_t ifftFlag)
+{
+  const arm_cfft_instance_f32 *Sint = &(S->Sint);
+  uint32_t tile, f0, n;
+
+  tile = ARM_FFT_BATCH_TILE_BYTES / (2U * sizeof(float32_t) * Sint->fftLen);
+  if (tile < ARM_FFT_BATCH_MIN_FRAMES)
+  {
+    tile = ARM_FFT_BATCH_MIN_FRAMES;
+  }
+
+  for (f0 = 0U; f0 < numFrames; f0 += tile)
+  {
+    float32_t *pS = pSrc + f0 * srcFrameStride;
+    float32_t *pD = pDst + f0 * dstFrameStride;
+
+    n = (numFrames - f0 < tile) ? numFrames - f0 : tile;
+
+    if (ifftFlag)
+    {
+      if (srcFrameStride == 1U && dstFrameStride == 1U)
+      {
+        arm_rfft_batch_merge_f32(S, pS, srcValStride, 1U, pD, dstValStride, 1U, n);
+      }
+      else
+      {
+        arm_rfft_batch_merge_f32(S, pS, srcValStride, srcFrameStride,
+                                 pD, dstValStride, dstFrameStride, n);
+      }
+      arm_cfft_batch_core_f32(Sint, pD, (int32_t)dstValStride, 2U * dstValStride,
+                              dstFrameStride, n, 1U);
+    }
+    else
+    {
+      arm_cfft_batch_core_f32(Sint, pS, (int32_t)srcValStride, 2U * srcValStride,
+                              srcFrameStride, n, 0U);
+      if (srcFrameStride == 1U && dstFrameStride == 1U)
+      {
+        arm_rfft_batch_split_f32(S, pS, srcValStride, 1U, pD, dstValStride, 1U, n);
+      }
+      else
+      {
+        arm_rfft_batch_split_f32(S, pS, srcValStride, srcFrameStride,
+                                 pD, dstValStride, dstFrameStride, n);
+      }
+    }
+  }
+}
+
+/**
+  @brief         Processing function for the batched floating-point real FFT.
+  @param[in]     S          points to an arm_rfft_fast_instance_f32 structure
+  @param[in,out] pSrc       points to the input frames (modified by this function)
+  @param[out]    pDst       points to the output frames
+  @param[in]     numFrames  number of frames
+  @param[in]     srcStride  distance in float32_t between the starts of consecutive
+                            input frames, at least <code>fftLen</code>. Only used by the
+                            contiguous layout
+  @param[in]     dstStride  same for the output frames
+  @param[in]     layout     memory layout of both the input and the output frames
+  @param[in]     ifftFlag
+                   - value = 0: RFFT
+                   - value = 1: RIFFT
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : stride too small or unknown layout
+
+  @par           Description
+                   Same result as calling \ref arm_rfft_fast_f32 on each frame,
+                   including the packed format of the spectrum (X[0] and
+                   X[fftLen/2] share the first complex value). In the
+                   interleaved layout, value <code>n</code> of that format
+                   for frame <code>f</code> is at <code>n * numFrames + f</code>.
+ */
+arm_status arm_rfft_fast_batch_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numFrames,
+        uint32_t srcStride,
+        uint32_t dstStride,
+        arm_fft_batch_layout layout,
+        uint8_t ifftFlag)
+{
+  uint32_t N = S->fftLenRFFT;
+
+  switch (layout)
+  {
+  case ARM_FFT_BATCH_CONTIGUOUS:
+    if (srcStride < N || dstStride < N)
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+    arm_rfft_fast_batch_core_f32(S, pSrc, 1U, srcStride, pDst, 1U, dstStride,
+                                 numFrames, ifftFlag);
+    break;
+
+  case ARM_FFT_BATCH_INTERLEAVED:
+    arm_rfft_fast_batch_core_f32(S, pSrc, numFrames, 1U, pDst, numFrames, 1U,
+                                 numFrames, ifftFlag);
+    break;
+
+  default:
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of BatchFFT group
+ */
@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_f32.c
+ * Description:  Floating-point short-time Fourier transform
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+extern void arm_rfft_fast_batch_core_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * pSrc,
+        uint32_t srcValStride,
+        uint32_t srcFrameStride,
+        float32_t * pDst,
+        uint32_t dstValStride,
+        uint32_t dstFrameStride,
+        uint32_t numFrames,
+        uint8_t ifftFlag);
+
+/**
+  @addtogroup BatchFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point STFT.
+  @param[in]     S          points to an arm_stft_instance_f32 structure
+  @param[in]     pSrc       points to the signal, <code>(numFrames - 1) * hopLen + winLen</code> samples
+  @param[in]     numFrames  number of frames to transform
+  @param[out]    pDst       points to the spectra, <code>numFrames * fftLen</code> values
+  @param[in]     pScratch   points to a scratch buffer of
+                            <code>fftLen * ARM_FFT_BATCH_MIN_FRAMES</code> values
+  @return        none
+
+  @par           Description
+                   Frame <code>f</code> starts at sample <code>f * hopLen</code>;
+                   overlap is <code>winLen - hopLen</code> when positive. Each
+                   frame is windowed and zero-padded to <code>fftLen</code>,
+                   and its spectrum is written at <code>pDst + f * fftLen</code>
+                   in the packed format of \ref arm_rfft_fast_f32.
+  @par
+                   Frames are windowed ARM_FFT_BATCH_MIN_FRAMES at a time into
+                   the scratch buffer in the interleaved layout, so the
+                   window pass writes with unit stride and the batched FFT
+                   gets the layout it runs fastest on.
+ */
+void arm_stft_f32(
+  const arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t numFrames,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  const float32_t *pWin = S->pWindow;
+  uint32_t fftLen = S->fftLen, winLen = S->winLen, hopLen = S->hopLen;
+  uint32_t f0, n, k, f;
+
+  for (f0 = 0U; f0 < numFrames; f0 += n)
+  {
+    const float32_t *pIn = pSrc + f0 * hopLen;
+
+    n = numFrames - f0;
+    if (n > ARM_FFT_BATCH_MIN_FRAMES)
+    {
+      n = ARM_FFT_BATCH_MIN_FRAMES;
+    }
+
+    for (k = 0U; k < winLen; k++)
+    {
+      const float32_t w = (pWin != NULL) ? pWin[k] : 1.0f;
+      float32_t *pOut = pScratch + k * n;
+
+      for (f = 0U; f < n; f++)
+      {
+        pOut[f] = pIn[f * hopLen + k] * w;
+      }
+    }
+    for (k = winLen * n; k < fftLen * n; k++)
+    {
+      pScratch[k] = 0.0f;
+    }
+
+    arm_rfft_fast_batch_core_f32(&S->rfft, pScratch, n, 1U,
+                                 pDst + f0 * fftLen, 1U, fftLen, n, 0U);
+  }
+}
+
+/**
+  @} end of BatchFFT group
+ */
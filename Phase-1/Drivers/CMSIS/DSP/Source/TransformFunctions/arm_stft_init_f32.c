@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_init_f32.c
+ * Description:  Initialization function for the floating-point STFT
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @addtogroup BatchFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point STFT.
+  @param[out]    S        points to an arm_stft_instance_f32 structure
+  @param[in]     fftLen   length of the real FFT, a length supported by \ref arm_rfft_fast_init_f32
+  @param[in]     winLen   samples per frame, at most <code>fftLen</code>
+  @param[in]     hopLen   samples between the starts of consecutive frames
+  @param[in]     pWindow  <code>winLen</code> window coefficients, or NULL for a rectangular window
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> not supported,
+                                                    <code>winLen</code> or <code>hopLen</code> out of range
+
+  @par           Description
+                   The window is not copied and must stay valid while the
+                   instance is used. Frames shorter than the FFT are zero-padded.
+ */
+arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t winLen,
+  uint16_t hopLen,
+  const float32_t * pWindow)
+{
+  if (winLen == 0U || winLen > fftLen || hopLen == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->fftLen = fftLen;
+  S->winLen = winLen;
+  S->hopLen = hopLen;
+  S->pWindow = pWindow;
+
+  return arm_rfft_fast_init_f32(&S->rfft, fftLen);
+}
+
+/**
+  @} end of BatchFFT group
+ */
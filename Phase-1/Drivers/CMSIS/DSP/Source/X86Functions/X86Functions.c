@@ -0,0 +1,32 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        X86Functions.c
+ * Description:  Combination of all x86 backend source files.
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_x86_level.c"
+#include "arm_biquad_cascade_df2T_f32_x86.c"
+#include "arm_cfft_f32_x86.c"
+#include "arm_cmplx_mag_f32_x86.c"
+#include "arm_dot_prod_f32_x86.c"
+#include "arm_fir_f32_x86.c"
+#include "arm_mat_mult_f32_x86.c"
+#include "arm_mat_gemm_f32_x86.c"
+#include "arm_vexp_f32_x86.c"
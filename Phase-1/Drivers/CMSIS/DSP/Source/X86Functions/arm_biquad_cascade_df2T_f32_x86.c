@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_df2T_f32_x86.c
+ * Description:  AVX2 floating-point transposed direct form II biquad cascade
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_x86_kernels.h"
+
+#if defined(ARM_MATH_X86)
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/*
+ * A biquad is recursive in time, so the samples of one section cannot be
+ * computed in parallel. The sections of a cascade can: lane s of a vector
+ * runs section s on sample (t - s), and after every step the outputs are
+ * shifted up one lane to become the inputs of the next section. Up to 8
+ * sections run per pass; longer cascades take several passes over pDst.
+ *
+ * The first and last (sections - 1) steps of a pass only have some lanes
+ * holding real samples; the other lanes are masked so their state is left
+ * untouched.
+ */
+
+/**
+  @brief         AVX2 processing function for the floating-point transposed direct form II Biquad cascade filter.
+  @param[in]     S         points to an instance of the filter data structure
+  @param[in]     pSrc      points to the block of input data
+  @param[out]    pDst      points to the block of output data
+  @param[in]     blockSize number of samples to process
+  @return        none
+ */
+ARM_X86_TARGET_AVX2
+void arm_biquad_cascade_df2T_f32_avx2(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pIn = pSrc;                         /* Input of the current pass */
+        uint32_t stage = 0U;                           /* First section of the current pass */
+
+  const __m256 laneIdx = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+  const __m256i shiftUp = _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6);
+
+  while (stage < S->numStages)
+  {
+    uint32_t nb = S->numStages - stage;
+    float32_t b0[8] = {0}, b1[8] = {0}, b2[8] = {0}, a1[8] = {0}, a2[8] = {0};
+    float32_t d1[8] = {0}, d2[8] = {0};
+    uint32_t s, t, steps;
+
+    if (nb > 8U)
+    {
+      nb = 8U;
+    }
+
+    for (s = 0U; s < nb; s++)
+    {
+      b0[s] = pCoeffs[5U * (stage + s)];
+      b1[s] = pCoeffs[5U * (stage + s) + 1U];
+      b2[s] = pCoeffs[5U * (stage + s) + 2U];
+      a1[s] = pCoeffs[5U * (stage + s) + 3U];
+      a2[s] = pCoeffs[5U * (stage + s) + 4U];
+      d1[s] = pState[2U * (stage + s)];
+      d2[s] = pState[2U * (stage + s) + 1U];
+    }
+
+    {
+      const __m256 vb0 = _mm256_loadu_ps(b0), vb1 = _mm256_loadu_ps(b1), vb2 = _mm256_loadu_ps(b2);
+      const __m256 va1 = _mm256_loadu_ps(a1), va2 = _mm256_loadu_ps(a2);
+      const __m256i lastLane = _mm256_set1_epi32((int)nb - 1);
+      __m256 vd1 = _mm256_loadu_ps(d1), vd2 = _mm256_loadu_ps(d2);
+      __m256 y = _mm256_setzero_ps();
+
+      steps = blockSize + nb - 1U;
+      for (t = 0U; t < steps; t++)
+      {
+        /* Lane 0 takes the new sample, lane s the output of section s - 1 */
+        float32_t xin = (t < blockSize) ? pIn[t] : 0.0f;
+        __m256 x = _mm256_blend_ps(_mm256_permutevar8x32_ps(y, shiftUp), _mm256_set1_ps(xin), 0x01);
+        __m256 nd1, nd2;
+
+        y   = _mm256_fmadd_ps(vb0, x, vd1);
+        nd1 = _mm256_fmadd_ps(va1, y, _mm256_fmadd_ps(vb1, x, vd2));
+        nd2 = _mm256_fmadd_ps(va2, y, _mm256_mul_ps(vb2, x));
+
+        if ((t + 1U < nb) || (t >= blockSize))
+        {
+          /* Fill / drain: lane s is live while 0 <= t - s < blockSize */
+          __m256 tv = _mm256_set1_ps((float32_t)t);
+          __m256 live = _mm256_and_ps(_mm256_cmp_ps(laneIdx, tv, _CMP_LE_OQ),
+                                      _mm256_cmp_ps(laneIdx, _mm256_sub_ps(tv, _mm256_set1_ps((float32_t)blockSize)), _CMP_GT_OQ));
+          vd1 = _mm256_blendv_ps(vd1, nd1, live);
+          vd2 = _mm256_blendv_ps(vd2, nd2, live);
+        }
+        else
+        {
+          vd1 = nd1;
+          vd2 = nd2;
+        }
+
+        if (t + 1U >= nb)
+        {
+          pDst[t + 1U - nb] = _mm256_cvtss_f32(_mm256_permutevar8x32_ps(y, lastLane));
+        }
+      }
+
+      _mm256_storeu_ps(d1, vd1);
+      _mm256_storeu_ps(d2, vd2);
+    }
+
+    for (s = 0U; s < nb; s++)
+    {
+      pState[2U * (stage + s)] = d1[s];
+      pState[2U * (stage + s) + 1U] = d2[s];
+    }
+
+    /* The next pass filters the output of this one in place */
+    pIn = pDst;
+    stage += nb;
+  }
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
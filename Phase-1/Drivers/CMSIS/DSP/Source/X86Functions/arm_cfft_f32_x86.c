@@ -0,0 +1,243 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_f32_x86.c
+ * Description:  AVX2 floating-point complex FFT
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_x86_kernels.h"
+
+#if defined(ARM_MATH_X86)
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFT
+  @{
+ */
+
+/*
+ * Decimation-in-frequency radix-4 FFT (with one leading radix-2 stage when
+ * log2(fftLen) is odd) working on 4 complex values per AVX2 register.
+ * Twiddles come from the instance table, so the same arm_cfft_instance_f32
+ * serves both implementations. The result is left in binary bit-reversed
+ * order and then permuted, which is why only bitReverseFlag = 1 is handled
+ * here: the un-reversed output of the reference radix-8 code has a
+ * different order.
+ */
+
+/* a * conj(w), i.e. multiplication by the forward twiddle e^(-j*theta) */
+ARM_X86_TARGET_AVX2
+static inline __m256 arm_x86_cmul_conj(__m256 a, __m256 w)
+{
+  __m256 wr = _mm256_moveldup_ps(w);
+  __m256 wi = _mm256_movehdup_ps(w);
+  __m256 as = _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+
+  return _mm256_fmsubadd_ps(a, wr, _mm256_mul_ps(as, wi));
+}
+
+/* Twiddles for indices j .. j+3 spaced by step in the table */
+ARM_X86_TARGET_AVX2
+static inline __m256 arm_x86_load_twiddle(const float32_t *pTw, uint32_t step, uint32_t j)
+{
+  if (step == 1U)
+  {
+    return _mm256_loadu_ps(&pTw[2U * j]);
+  }
+  else
+  {
+    __m128i idx = _mm_setr_epi32((int)(j * step), (int)((j + 1U) * step),
+                                 (int)((j + 2U) * step), (int)((j + 3U) * step));
+    return _mm256_castpd_ps(_mm256_i32gather_pd((const double *)pTw, idx, 8));
+  }
+}
+
+ARM_X86_TARGET_AVX2
+static void arm_x86_cfft_radix2_stage(float32_t *p1, const float32_t *pTw, uint32_t fftLen)
+{
+  uint32_t half = fftLen >> 1U, j;
+
+  for (j = 0U; j < half; j += 4U)
+  {
+    __m256 a = _mm256_loadu_ps(&p1[2U * j]);
+    __m256 b = _mm256_loadu_ps(&p1[2U * (j + half)]);
+
+    _mm256_storeu_ps(&p1[2U * j], _mm256_add_ps(a, b));
+    _mm256_storeu_ps(&p1[2U * (j + half)],
+                     arm_x86_cmul_conj(_mm256_sub_ps(a, b), arm_x86_load_twiddle(pTw, 1U, j)));
+  }
+}
+
+ARM_X86_TARGET_AVX2
+static void arm_x86_cfft_radix4_stage(float32_t *p1, const float32_t *pTw, uint32_t fftLen, uint32_t L)
+{
+  const __m256 negOdd = _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
+  uint32_t q = L >> 2U;
+  uint32_t step = fftLen / L;
+  uint32_t j, base;
+
+  for (j = 0U; j < q; j += 4U)
+  {
+    __m256 w1 = arm_x86_load_twiddle(pTw, step, j);
+    __m256 w2 = arm_x86_load_twiddle(pTw, 2U * step, j);
+    __m256 w3 = arm_x86_load_twiddle(pTw, 3U * step, j);
+
+    for (base = 0U; base < fftLen; base += L)
+    {
+      float32_t *p0 = &p1[2U * (base + j)];
+      __m256 a = _mm256_loadu_ps(p0);
+      __m256 b = _mm256_loadu_ps(p0 + 2U * q);
+      __m256 c = _mm256_loadu_ps(p0 + 4U * q);
+      __m256 d = _mm256_loadu_ps(p0 + 6U * q);
+
+      __m256 t0 = _mm256_add_ps(a, c);
+      __m256 t1 = _mm256_sub_ps(a, c);
+      __m256 t2 = _mm256_add_ps(b, d);
+      __m256 t3 = _mm256_sub_ps(b, d);
+
+      /* -j * t3 = (t3.im, -t3.re) */
+      __m256 jt3 = _mm256_xor_ps(_mm256_permute_ps(t3, _MM_SHUFFLE(2, 3, 0, 1)), negOdd);
+
+      /* Outputs k = 0, 2, 1, 3 (mod 4) keep the final order binary bit-reversed */
+      _mm256_storeu_ps(p0,          _mm256_add_ps(t0, t2));
+      _mm256_storeu_ps(p0 + 2U * q, arm_x86_cmul_conj(_mm256_sub_ps(t0, t2), w2));
+      _mm256_storeu_ps(p0 + 4U * q, arm_x86_cmul_conj(_mm256_add_ps(t1, jt3), w1));
+      _mm256_storeu_ps(p0 + 6U * q, arm_x86_cmul_conj(_mm256_sub_ps(t1, jt3), w3));
+    }
+  }
+}
+
+/* Last stage: one radix-4 butterfly (no twiddles) per group of 4 values */
+ARM_X86_TARGET_AVX2
+static void arm_x86_cfft_radix4_last(float32_t *p1, uint32_t fftLen)
+{
+  const __m128 negHi = _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f);
+  const __m128 negMid = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+  uint32_t g;
+
+  for (g = 0U; g < fftLen; g += 4U)
+  {
+    __m128 lo = _mm_loadu_ps(&p1[2U * g]);          /* a b */
+    __m128 hi = _mm_loadu_ps(&p1[2U * g + 4U]);     /* c d */
+    __m128 s  = _mm_add_ps(lo, hi);                 /* t0 t2 */
+    __m128 df = _mm_sub_ps(lo, hi);                 /* t1 t3 */
+
+    /* (t0 + t2, t0 - t2) */
+    __m128 y02 = _mm_add_ps(_mm_movelh_ps(s, s), _mm_xor_ps(_mm_movehl_ps(s, s), negHi));
+
+    /* (t1 - j*t3, t1 + j*t3) */
+    __m128 t3 = _mm_movehl_ps(df, df);
+    __m128 y13 = _mm_add_ps(_mm_movelh_ps(df, df),
+                            _mm_xor_ps(_mm_shuffle_ps(t3, t3, _MM_SHUFFLE(0, 1, 0, 1)), negMid));
+
+    _mm_storeu_ps(&p1[2U * g], y02);
+    _mm_storeu_ps(&p1[2U * g + 4U], y13);
+  }
+}
+
+static void arm_x86_bitreversal(float32_t *p1, uint32_t fftLen)
+{
+  uint64_t *pCplx = (uint64_t *)p1;
+  uint32_t i, j = 0U;
+
+  for (i = 0U; i < fftLen; i++)
+  {
+    uint32_t bit = fftLen >> 1U;
+
+    if (i < j)
+    {
+      uint64_t tmp = pCplx[i];
+      pCplx[i] = pCplx[j];
+      pCplx[j] = tmp;
+    }
+
+    /* Reversed increment of j */
+    while (j & bit)
+    {
+      j ^= bit;
+      bit >>= 1U;
+    }
+    j |= bit;
+  }
+}
+
+/**
+  @brief         AVX2 processing function for the floating-point complex FFT.
+  @param[in]     S         points to an instance of the floating-point CFFT structure
+  @param[in,out] p1        points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag  flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+  @par           Output is always in natural order (reference bitReverseFlag = 1).
+ */
+ARM_X86_TARGET_AVX2
+void arm_cfft_f32_avx2(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag)
+{
+  const __m256 negOdd = _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
+  uint32_t L = S->fftLen, len, l;
+
+  if (ifftFlag == 1U)
+  {
+    /* Conjugate input data */
+    for (l = 0U; l < 2U * L; l += 8U)
+    {
+      _mm256_storeu_ps(&p1[l], _mm256_xor_ps(_mm256_loadu_ps(&p1[l]), negOdd));
+    }
+  }
+
+  len = L;
+  if ((31U - __builtin_clz(L)) & 1U)
+  {
+    arm_x86_cfft_radix2_stage(p1, S->pTwiddle, L);
+    len = L >> 1U;
+  }
+
+  for (; len >= 16U; len >>= 2U)
+  {
+    arm_x86_cfft_radix4_stage(p1, S->pTwiddle, L, len);
+  }
+
+  arm_x86_cfft_radix4_last(p1, L);
+  arm_x86_bitreversal(p1, L);
+
+  if (ifftFlag == 1U)
+  {
+    /* Conjugate and scale output data */
+    const __m256 invL = _mm256_set1_ps(1.0f / (float32_t)L);
+
+    for (l = 0U; l < 2U * L; l += 8U)
+    {
+      __m256 v = _mm256_xor_ps(_mm256_loadu_ps(&p1[l]), negOdd);
+      _mm256_storeu_ps(&p1[l], _mm256_mul_ps(v, invL));
+    }
+  }
+}
+
+/**
+  @} end of ComplexFFT group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_mag_f32_x86.c
+ * Description:  SSE2 and AVX2 floating-point complex magnitude
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_x86_kernels.h"
+
+#if defined(ARM_MATH_X86)
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag
+  @{
+ */
+
+/*
+ * re*re + im*im is formed with a plain multiply and add and the square
+ * root is IEEE-exact, so both versions match the reference bit for bit.
+ */
+
+/**
+  @brief         SSE2 floating-point complex magnitude.
+  @param[in]     pSrc        points to input vector
+  @param[out]    pDst        points to output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void arm_cmplx_mag_f32_sse2(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numSamples)
+{
+  uint32_t i = 0U;
+
+  for (; i + 4U <= numSamples; i += 4U)
+  {
+    __m128 v0 = _mm_loadu_ps(pSrc + 2U * i);          /* r0 i0 r1 i1 */
+    __m128 v1 = _mm_loadu_ps(pSrc + 2U * i + 4U);     /* r2 i2 r3 i3 */
+    __m128 sq0 = _mm_mul_ps(v0, v0);
+    __m128 sq1 = _mm_mul_ps(v1, v1);
+    __m128 re2 = _mm_shuffle_ps(sq0, sq1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 im2 = _mm_shuffle_ps(sq0, sq1, _MM_SHUFFLE(3, 1, 3, 1));
+
+    _mm_storeu_ps(pDst + i, _mm_sqrt_ps(_mm_add_ps(re2, im2)));
+  }
+
+  for (; i < numSamples; i++)
+  {
+    float32_t real = pSrc[2U * i];
+    float32_t imag = pSrc[2U * i + 1U];
+
+    arm_sqrt_f32((real * real) + (imag * imag), &pDst[i]);
+  }
+}
+
+/**
+  @brief         AVX2 floating-point complex magnitude.
+  @param[in]     pSrc        points to input vector
+  @param[out]    pDst        points to output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+ARM_X86_TARGET_AVX2
+void arm_cmplx_mag_f32_avx2(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numSamples)
+{
+  uint32_t i = 0U;
+
+  for (; i + 8U <= numSamples; i += 8U)
+  {
+    __m256 v0 = _mm256_loadu_ps(pSrc + 2U * i);       /* c0 c1 | c2 c3 */
+    __m256 v1 = _mm256_loadu_ps(pSrc + 2U * i + 8U);  /* c4 c5 | c6 c7 */
+    __m256 sum = _mm256_hadd_ps(_mm256_mul_ps(v0, v0), _mm256_mul_ps(v1, v1));
+
+    /* hadd leaves c0 c1 c4 c5 | c2 c3 c6 c7: restore sample order */
+    sum = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(sum), _MM_SHUFFLE(3, 1, 2, 0)));
+    _mm256_storeu_ps(pDst + i, _mm256_sqrt_ps(sum));
+  }
+
+  if (i < numSamples)
+  {
+    arm_cmplx_mag_f32_sse2(pSrc + 2U * i, pDst + i, numSamples - i);
+  }
+}
+
+/**
+  @} end of cmplx_mag group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
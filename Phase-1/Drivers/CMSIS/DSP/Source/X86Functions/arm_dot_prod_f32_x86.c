@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dot_prod_f32_x86.c
+ * Description:  SSE2 and AVX2 floating-point dot product
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_x86_kernels.h"
+
+#if defined(ARM_MATH_X86)
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief         SSE2 dot product of floating-point vectors.
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    result     output result returned here
+  @return        none
+ */
+void arm_dot_prod_f32_sse2(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result)
+{
+  __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+  __m128 acc2 = _mm_setzero_ps(), acc3 = _mm_setzero_ps();
+  float32_t sum;
+  uint32_t i = 0U;
+
+  /* Four independent accumulators hide the add latency */
+  for (; i + 16U <= blockSize; i += 16U)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(pSrcA + i),       _mm_loadu_ps(pSrcB + i)));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(pSrcA + i + 4U),  _mm_loadu_ps(pSrcB + i + 4U)));
+    acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(pSrcA + i + 8U),  _mm_loadu_ps(pSrcB + i + 8U)));
+    acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(pSrcA + i + 12U), _mm_loadu_ps(pSrcB + i + 12U)));
+  }
+  for (; i + 4U <= blockSize; i += 4U)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(pSrcA + i), _mm_loadu_ps(pSrcB + i)));
+  }
+
+  acc0 = _mm_add_ps(_mm_add_ps(acc0, acc1), _mm_add_ps(acc2, acc3));
+  acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+  acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, 0x55));
+  sum = _mm_cvtss_f32(acc0);
+
+  for (; i < blockSize; i++)
+  {
+    sum += pSrcA[i] * pSrcB[i];
+  }
+
+  *result = sum;
+}
+
+/**
+  @brief         AVX2 dot product of floating-point vectors.
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    result     output result returned here
+  @return        none
+ */
+ARM_X86_TARGET_AVX2
+void arm_dot_prod_f32_avx2(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result)
+{
+  __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+  __m256 acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+  __m128 acc;
+  float32_t sum;
+  uint32_t i = 0U;
+
+  /* Four independent accumulators hide the FMA latency */
+  for (; i + 32U <= blockSize; i += 32U)
+  {
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA + i),       _mm256_loadu_ps(pSrcB + i),       acc0);
+    acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA + i + 8U),  _mm256_loadu_ps(pSrcB + i + 8U),  acc1);
+    acc2 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA + i + 16U), _mm256_loadu_ps(pSrcB + i + 16U), acc2);
+    acc3 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA + i + 24U), _mm256_loadu_ps(pSrcB + i + 24U), acc3);
+  }
+  for (; i + 8U <= blockSize; i += 8U)
+  {
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA + i), _mm256_loadu_ps(pSrcB + i), acc0);
+  }
+
+  acc0 = _mm256_add_ps(_mm256_add_ps(acc0, acc1), _mm256_add_ps(acc2, acc3));
+  acc = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+  acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+  acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 0x55));
+  sum = _mm_cvtss_f32(acc);
+
+  for (; i < blockSize; i++)
+  {
+    sum += pSrcA[i] * pSrcB[i];
+  }
+
+  *result = sum;
+}
+
+/**
+  @} end of BasicDotProd group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
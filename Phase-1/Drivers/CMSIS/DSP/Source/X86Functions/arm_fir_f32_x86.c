@@ -0,0 +1,201 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_f32_x86.c
+ * Description:  SSE2 and AVX2 floating-point FIR filter
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_x86_kernels.h"
+
+#if defined(ARM_MATH_X86)
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/*
+ * Both versions vectorize across output samples: each coefficient is
+ * broadcast and multiplied with a sliding window of the state buffer,
+ * so y[n] = sum_k pCoeffs[k] * pState[n + k] exactly as the reference
+ * computes it. The SSE2 path accumulates in the same order with separate
+ * multiply and add and matches the reference bit for bit; the AVX2 path
+ * uses FMA and differs only by rounding.
+ */
+
+/**
+  @brief         SSE2 floating-point FIR filter.
+  @param[in]     S          points to an instance of the floating-point FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_fir_f32_sse2(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t n, k;                                 /* Loop counters */
+
+  /* New samples go after the (numTaps - 1) samples kept from the previous call */
+  memcpy(&pState[numTaps - 1U], pSrc, blockSize * sizeof(float32_t));
+
+  /* 16 outputs at a time */
+  for (n = 0U; n + 16U <= blockSize; n += 16U)
+  {
+    __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+    __m128 acc2 = _mm_setzero_ps(), acc3 = _mm_setzero_ps();
+    const float32_t *px = &pState[n];
+
+    for (k = 0U; k < numTaps; k++)
+    {
+      __m128 c = _mm_set1_ps(pCoeffs[k]);
+      acc0 = _mm_add_ps(acc0, _mm_mul_ps(c, _mm_loadu_ps(px + k)));
+      acc1 = _mm_add_ps(acc1, _mm_mul_ps(c, _mm_loadu_ps(px + k + 4U)));
+      acc2 = _mm_add_ps(acc2, _mm_mul_ps(c, _mm_loadu_ps(px + k + 8U)));
+      acc3 = _mm_add_ps(acc3, _mm_mul_ps(c, _mm_loadu_ps(px + k + 12U)));
+    }
+
+    _mm_storeu_ps(&pDst[n], acc0);
+    _mm_storeu_ps(&pDst[n + 4U], acc1);
+    _mm_storeu_ps(&pDst[n + 8U], acc2);
+    _mm_storeu_ps(&pDst[n + 12U], acc3);
+  }
+
+  /* 4 outputs at a time */
+  for (; n + 4U <= blockSize; n += 4U)
+  {
+    __m128 acc0 = _mm_setzero_ps();
+    const float32_t *px = &pState[n];
+
+    for (k = 0U; k < numTaps; k++)
+    {
+      acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_set1_ps(pCoeffs[k]), _mm_loadu_ps(px + k)));
+    }
+
+    _mm_storeu_ps(&pDst[n], acc0);
+  }
+
+  /* Remaining outputs */
+  for (; n < blockSize; n++)
+  {
+    float32_t acc0 = 0.0f;
+
+    for (k = 0U; k < numTaps; k++)
+    {
+      acc0 += pCoeffs[k] * pState[n + k];
+    }
+
+    pDst[n] = acc0;
+  }
+
+  /* Keep the last (numTaps - 1) samples for the next call */
+  memmove(pState, &pState[blockSize], (numTaps - 1U) * sizeof(float32_t));
+}
+
+/**
+  @brief         AVX2 floating-point FIR filter.
+  @param[in]     S          points to an instance of the floating-point FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+ARM_X86_TARGET_AVX2
+void arm_fir_f32_avx2(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t n, k;                                 /* Loop counters */
+
+  /* New samples go after the (numTaps - 1) samples kept from the previous call */
+  memcpy(&pState[numTaps - 1U], pSrc, blockSize * sizeof(float32_t));
+
+  /* 32 outputs at a time */
+  for (n = 0U; n + 32U <= blockSize; n += 32U)
+  {
+    __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+    __m256 acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+    const float32_t *px = &pState[n];
+
+    for (k = 0U; k < numTaps; k++)
+    {
+      __m256 c = _mm256_broadcast_ss(&pCoeffs[k]);
+      acc0 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px + k), acc0);
+      acc1 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px + k + 8U), acc1);
+      acc2 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px + k + 16U), acc2);
+      acc3 = _mm256_fmadd_ps(c, _mm256_loadu_ps(px + k + 24U), acc3);
+    }
+
+    _mm256_storeu_ps(&pDst[n], acc0);
+    _mm256_storeu_ps(&pDst[n + 8U], acc1);
+    _mm256_storeu_ps(&pDst[n + 16U], acc2);
+    _mm256_storeu_ps(&pDst[n + 24U], acc3);
+  }
+
+  /* 8 outputs at a time */
+  for (; n + 8U <= blockSize; n += 8U)
+  {
+    __m256 acc0 = _mm256_setzero_ps();
+    const float32_t *px = &pState[n];
+
+    for (k = 0U; k < numTaps; k++)
+    {
+      acc0 = _mm256_fmadd_ps(_mm256_broadcast_ss(&pCoeffs[k]), _mm256_loadu_ps(px + k), acc0);
+    }
+
+    _mm256_storeu_ps(&pDst[n], acc0);
+  }
+
+  /* Remaining outputs */
+  for (; n < blockSize; n++)
+  {
+    float32_t acc0 = 0.0f;
+
+    for (k = 0U; k < numTaps; k++)
+    {
+      acc0 += pCoeffs[k] * pState[n + k];
+    }
+
+    pDst[n] = acc0;
+  }
+
+  /* Keep the last (numTaps - 1) samples for the next call */
+  memmove(pState, &pState[blockSize], (numTaps - 1U) * sizeof(float32_t));
+}
+
+/**
+  @} end of FIR group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
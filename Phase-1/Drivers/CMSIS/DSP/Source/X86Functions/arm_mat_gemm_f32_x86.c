@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_gemm_f32_x86.c
+ * Description:  AVX2 micro-kernel of the floating-point general matrix multiplication
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_x86_kernels.h"
+
+#if defined(ARM_MATH_X86)
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixGemm
+  @{
+ */
+
+/**
+  @brief         AVX2 micro-kernel of arm_mat_gemm_f32().
+  @param[in]     kc          depth of the slice
+  @param[in]     pA          first row of op(A) in the slice
+  @param[in]     rsA         distance between rows of op(A)
+  @param[in]     csA         distance between columns of op(A)
+  @param[in]     pPanel      packed kc x 16 panel of op(B)
+  @param[in,out] pC          top left of the 4 x 16 block of the result
+  @param[in]     ldc         distance between rows of the result
+  @param[in]     mr          valid rows, 1 to 4
+  @param[in]     nr          valid columns, 1 to 16
+  @param[in]     accumulate  add to pC instead of overwriting it
+  @return        none
+
+  The 4 x 16 block lives in 8 registers across the slice: per step, two
+  loads of the panel and four broadcasts of A feed 8 FMAs.
+ */
+ARM_X86_TARGET_AVX2
+void arm_mat_gemm_kernel_f32_avx2(
+  uint32_t kc,
+  const float32_t * pA,
+        uint32_t rsA,
+        uint32_t csA,
+  const float32_t * pPanel,
+        float32_t * pC,
+        uint32_t ldc,
+        uint32_t mr,
+        uint32_t nr,
+        uint32_t accumulate)
+{
+  const float32_t *a0 = pA;
+  const float32_t *a1 = (mr > 1U) ? pA + rsA : a0;
+  const float32_t *a2 = (mr > 2U) ? pA + 2U * rsA : a1;
+  const float32_t *a3 = (mr > 3U) ? pA + 3U * rsA : a2;
+  __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+  __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+  __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+  __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+  uint32_t i, j, k;
+
+  for (k = 0U; k < kc; k++)
+  {
+    __m256 b0 = _mm256_loadu_ps(pPanel);
+    __m256 b1 = _mm256_loadu_ps(pPanel + 8);
+    __m256 av;
+
+    av = _mm256_broadcast_ss(a0);
+    c00 = _mm256_fmadd_ps(av, b0, c00);
+    c01 = _mm256_fmadd_ps(av, b1, c01);
+    av = _mm256_broadcast_ss(a1);
+    c10 = _mm256_fmadd_ps(av, b0, c10);
+    c11 = _mm256_fmadd_ps(av, b1, c11);
+    av = _mm256_broadcast_ss(a2);
+    c20 = _mm256_fmadd_ps(av, b0, c20);
+    c21 = _mm256_fmadd_ps(av, b1, c21);
+    av = _mm256_broadcast_ss(a3);
+    c30 = _mm256_fmadd_ps(av, b0, c30);
+    c31 = _mm256_fmadd_ps(av, b1, c31);
+
+    a0 += csA;
+    a1 += csA;
+    a2 += csA;
+    a3 += csA;
+    pPanel += 16;
+  }
+
+  if ((mr == 4U) && (nr == 16U))
+  {
+    if (accumulate)
+    {
+      c00 = _mm256_add_ps(c00, _mm256_loadu_ps(pC));
+      c01 = _mm256_add_ps(c01, _mm256_loadu_ps(pC + 8));
+      c10 = _mm256_add_ps(c10, _mm256_loadu_ps(pC + ldc));
+      c11 = _mm256_add_ps(c11, _mm256_loadu_ps(pC + ldc + 8));
+      c20 = _mm256_add_ps(c20, _mm256_loadu_ps(pC + 2U * ldc));
+      c21 = _mm256_add_ps(c21, _mm256_loadu_ps(pC + 2U * ldc + 8));
+      c30 = _mm256_add_ps(c30, _mm256_loadu_ps(pC + 3U * ldc));
+      c31 = _mm256_add_ps(c31, _mm256_loadu_ps(pC + 3U * ldc + 8));
+    }
+    _mm256_storeu_ps(pC, c00);
+    _mm256_storeu_ps(pC + 8, c01);
+    _mm256_storeu_ps(pC + ldc, c10);
+    _mm256_storeu_ps(pC + ldc + 8, c11);
+    _mm256_storeu_ps(pC + 2U * ldc, c20);
+    _mm256_storeu_ps(pC + 2U * ldc + 8, c21);
+    _mm256_storeu_ps(pC + 3U * ldc, c30);
+    _mm256_storeu_ps(pC + 3U * ldc + 8, c31);
+  }
+  else
+  {
+    /* Edge block: spill and copy the valid part */
+    float32_t acc[4][16];
+
+    _mm256_storeu_ps(&acc[0][0], c00);
+    _mm256_storeu_ps(&acc[0][8], c01);
+    _mm256_storeu_ps(&acc[1][0], c10);
+    _mm256_storeu_ps(&acc[1][8], c11);
+    _mm256_storeu_ps(&acc[2][0], c20);
+    _mm256_storeu_ps(&acc[2][8], c21);
+    _mm256_storeu_ps(&acc[3][0], c30);
+    _mm256_storeu_ps(&acc[3][8], c31);
+
+    for (i = 0U; i < mr; i++)
+    {
+      float32_t *c = &pC[i * ldc];
+
+      for (j = 0U; j < nr; j++)
+      {
+        c[j] = accumulate ? c[j] + acc[i][j] : acc[i][j];
+      }
+    }
+  }
+}
+
+/**
+  @} end of MatrixGemm group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
@@ -0,0 +1,244 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_f32_x86.c
+ * Description:  SSE2 and AVX2 floating-point matrix multiplication
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_x86_kernels.h"
+
+#if defined(ARM_MATH_X86)
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/*
+ * Both versions compute a block of rows of C at once as a sum of rows of
+ * B scaled by broadcast elements of A, so every load of B is reused for
+ * several rows and the inner loop is a straight run of multiply-adds.
+ * Sizes are assumed to have been checked by arm_mat_mult_f32().
+ */
+
+/**
+  @brief         SSE2 floating-point matrix multiplication.
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @param[out]    pDst   points to output matrix structure
+  @return        none
+ */
+void arm_mat_mult_f32_sse2(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pA = pSrcA->pData;
+  const float32_t *pB = pSrcB->pData;
+        float32_t *pC = pDst->pData;
+  uint32_t M = pSrcA->numRows, K = pSrcA->numCols, N = pSrcB->numCols;
+  uint32_t i, j, k;
+
+  for (i = 0U; i < M; i++)
+  {
+    const float32_t *a = &pA[i * K];
+          float32_t *c = &pC[i * N];
+
+    for (j = 0U; j + 8U <= N; j += 8U)
+    {
+      __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+
+      for (k = 0U; k < K; k++)
+      {
+        __m128 av = _mm_set1_ps(a[k]);
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(av, _mm_loadu_ps(&pB[k * N + j])));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(av, _mm_loadu_ps(&pB[k * N + j + 4U])));
+      }
+
+      _mm_storeu_ps(&c[j], acc0);
+      _mm_storeu_ps(&c[j + 4U], acc1);
+    }
+
+    for (; j + 4U <= N; j += 4U)
+    {
+      __m128 acc0 = _mm_setzero_ps();
+
+      for (k = 0U; k < K; k++)
+      {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_set1_ps(a[k]), _mm_loadu_ps(&pB[k * N + j])));
+      }
+
+      _mm_storeu_ps(&c[j], acc0);
+    }
+
+    for (; j < N; j++)
+    {
+      float32_t sum = 0.0f;
+
+      for (k = 0U; k < K; k++)
+      {
+        sum += a[k] * pB[k * N + j];
+      }
+
+      c[j] = sum;
+    }
+  }
+}
+
+/**
+  @brief         AVX2 floating-point matrix multiplication.
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @param[out]    pDst   points to output matrix structure
+  @return        none
+ */
+ARM_X86_TARGET_AVX2
+void arm_mat_mult_f32_avx2(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pA = pSrcA->pData;
+  const float32_t *pB = pSrcB->pData;
+        float32_t *pC = pDst->pData;
+  uint32_t M = pSrcA->numRows, K = pSrcA->numCols, N = pSrcB->numCols;
+  uint32_t i, j, k;
+
+  /* 4 rows x 16 columns of C per block: 8 accumulators, 2 loads of B per 8 FMAs */
+  for (i = 0U; i + 4U <= M; i += 4U)
+  {
+    const float32_t *a0 = &pA[i * K], *a1 = a0 + K, *a2 = a1 + K, *a3 = a2 + K;
+
+    for (j = 0U; j + 16U <= N; j += 16U)
+    {
+      __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+      __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+      __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+      __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+
+      for (k = 0U; k < K; k++)
+      {
+        __m256 b0 = _mm256_loadu_ps(&pB[k * N + j]);
+        __m256 b1 = _mm256_loadu_ps(&pB[k * N + j + 8U]);
+        __m256 av;
+
+        av = _mm256_broadcast_ss(&a0[k]);
+        c00 = _mm256_fmadd_ps(av, b0, c00);
+        c01 = _mm256_fmadd_ps(av, b1, c01);
+        av = _mm256_broadcast_ss(&a1[k]);
+        c10 = _mm256_fmadd_ps(av, b0, c10);
+        c11 = _mm256_fmadd_ps(av, b1, c11);
+        av = _mm256_broadcast_ss(&a2[k]);
+        c20 = _mm256_fmadd_ps(av, b0, c20);
+        c21 = _mm256_fmadd_ps(av, b1, c21);
+        av = _mm256_broadcast_ss(&a3[k]);
+        c30 = _mm256_fmadd_ps(av, b0, c30);
+        c31 = _mm256_fmadd_ps(av, b1, c31);
+      }
+
+      _mm256_storeu_ps(&pC[i * N + j], c00);
+      _mm256_storeu_ps(&pC[i * N + j + 8U], c01);
+      _mm256_storeu_ps(&pC[(i + 1U) * N + j], c10);
+      _mm256_storeu_ps(&pC[(i + 1U) * N + j + 8U], c11);
+      _mm256_storeu_ps(&pC[(i + 2U) * N + j], c20);
+      _mm256_storeu_ps(&pC[(i + 2U) * N + j + 8U], c21);
+      _mm256_storeu_ps(&pC[(i + 3U) * N + j], c30);
+      _mm256_storeu_ps(&pC[(i + 3U) * N + j + 8U], c31);
+    }
+
+    for (; j + 8U <= N; j += 8U)
+    {
+      __m256 c0 = _mm256_setzero_ps(), c1 = _mm256_setzero_ps();
+      __m256 c2 = _mm256_setzero_ps(), c3 = _mm256_setzero_ps();
+
+      for (k = 0U; k < K; k++)
+      {
+        __m256 b0 = _mm256_loadu_ps(&pB[k * N + j]);
+        c0 = _mm256_fmadd_ps(_mm256_broadcast_ss(&a0[k]), b0, c0);
+        c1 = _mm256_fmadd_ps(_mm256_broadcast_ss(&a1[k]), b0, c1);
+        c2 = _mm256_fmadd_ps(_mm256_broadcast_ss(&a2[k]), b0, c2);
+        c3 = _mm256_fmadd_ps(_mm256_broadcast_ss(&a3[k]), b0, c3);
+      }
+
+      _mm256_storeu_ps(&pC[i * N + j], c0);
+      _mm256_storeu_ps(&pC[(i + 1U) * N + j], c1);
+      _mm256_storeu_ps(&pC[(i + 2U) * N + j], c2);
+      _mm256_storeu_ps(&pC[(i + 3U) * N + j], c3);
+    }
+
+    for (; j < N; j++)
+    {
+      float32_t s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+
+      for (k = 0U; k < K; k++)
+      {
+        float32_t b = pB[k * N + j];
+        s0 += a0[k] * b;
+        s1 += a1[k] * b;
+        s2 += a2[k] * b;
+        s3 += a3[k] * b;
+      }
+
+      pC[i * N + j] = s0;
+      pC[(i + 1U) * N + j] = s1;
+      pC[(i + 2U) * N + j] = s2;
+      pC[(i + 3U) * N + j] = s3;
+    }
+  }
+
+  /* Remaining rows one at a time */
+  for (; i < M; i++)
+  {
+    const float32_t *a = &pA[i * K];
+
+    for (j = 0U; j + 8U <= N; j += 8U)
+    {
+      __m256 c0 = _mm256_setzero_ps();
+
+      for (k = 0U; k < K; k++)
+      {
+        c0 = _mm256_fmadd_ps(_mm256_broadcast_ss(&a[k]), _mm256_loadu_ps(&pB[k * N + j]), c0);
+      }
+
+      _mm256_storeu_ps(&pC[i * N + j], c0);
+    }
+
+    for (; j < N; j++)
+    {
+      float32_t sum = 0.0f;
+
+      for (k = 0U; k < K; k++)
+      {
+        sum += a[k] * pB[k * N + j];
+      }
+
+      pC[i * N + j] = sum;
+    }
+  }
+}
+
+/**
+  @} end of MatrixMult group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_f32_x86.c
+ * Description:  SSE2 and AVX2 floating-point vector exponential
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_x86_kernels.h"
+
+#if defined(ARM_MATH_X86)
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vexp
+  @{
+ */
+
+/*
+ * exp(x) = 2^n * exp(r), n = round(x / ln 2), |r| <= ln(2) / 2, with ln 2
+ * split in two constants so r is exact, and exp(r) from the Cephes degree 6
+ * polynomial. 2^n is applied as two halves so the whole float range,
+ * denormal results included, is covered without overflow in the exponent
+ * field. Results are within 1 ulp of the exact value; overflow gives +inf, NaN is
+ * passed through.
+ */
+
+#define ARM_VEXP_HI      88.72283935546875f     /* largest x with a finite result */
+#define ARM_VEXP_LO     -103.972084045410f      /* exp(x) rounds to 0 below */
+#define ARM_VEXP_LOG2E   1.44269504088896341f
+#define ARM_VEXP_C1      0.693359375f
+#define ARM_VEXP_C2     -2.12194440e-4f
+#define ARM_VEXP_P0      1.9875691500e-4f
+#define ARM_VEXP_P1      1.3981999507e-3f
+#define ARM_VEXP_P2      8.3334519073e-3f
+#define ARM_VEXP_P3      4.1665795894e-2f
+#define ARM_VEXP_P4      1.6666665459e-1f
+#define ARM_VEXP_P5      5.0000001201e-1f
+
+static __m128 arm_vexp_f32_sse2_x4(__m128 x)
+{
+  __m128 xc = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(ARM_VEXP_LO)), _mm_set1_ps(ARM_VEXP_HI));
+  __m128i n = _mm_cvtps_epi32(_mm_mul_ps(xc, _mm_set1_ps(ARM_VEXP_LOG2E)));
+  __m128 fn = _mm_cvtepi32_ps(n);
+  __m128 r = _mm_sub_ps(_mm_sub_ps(xc, _mm_mul_ps(fn, _mm_set1_ps(ARM_VEXP_C1))),
+                        _mm_mul_ps(fn, _mm_set1_ps(ARM_VEXP_C2)));
+  __m128 z = _mm_mul_ps(r, r);
+  __m128 y = _mm_set1_ps(ARM_VEXP_P0);
+  __m128i n1, n2;
+
+  y = _mm_add_ps(_mm_mul_ps(y, r), _mm_set1_ps(ARM_VEXP_P1));
+  y = _mm_add_ps(_mm_mul_ps(y, r), _mm_set1_ps(ARM_VEXP_P2));
+  y = _mm_add_ps(_mm_mul_ps(y, r), _mm_set1_ps(ARM_VEXP_P3));
+  y = _mm_add_ps(_mm_mul_ps(y, r), _mm_set1_ps(ARM_VEXP_P4));
+  y = _mm_add_ps(_mm_mul_ps(y, r), _mm_set1_ps(ARM_VEXP_P5));
+  y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, z), r), _mm_set1_ps(1.0f));
+
+  /* y * 2^n1 * 2^n2, n1 = n / 2 */
+  n1 = _mm_srai_epi32(n, 1);
+  n2 = _mm_sub_epi32(n, n1);
+  y = _mm_mul_ps(y, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(127)), 23)));
+  y = _mm_mul_ps(y, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n2, _mm_set1_epi32(127)), 23)));
+
+  /* x > HI overflows, NaN stays NaN */
+  y = _mm_or_ps(_mm_andnot_ps(_mm_cmpgt_ps(x, _mm_set1_ps(ARM_VEXP_HI)), y),
+                _mm_and_ps(_mm_cmpgt_ps(x, _mm_set1_ps(ARM_VEXP_HI)), _mm_set1_ps(INFINITY)));
+  y = _mm_or_ps(_mm_andnot_ps(_mm_cmpunord_ps(x, x), y), _mm_and_ps(_mm_cmpunord_ps(x, x), x));
+  return y;
+}
+
+ARM_X86_TARGET_AVX2
+static __m256 arm_vexp_f32_avx2_x8(__m256 x)
+{
+  __m256 xc = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(ARM_VEXP_LO)), _mm256_set1_ps(ARM_VEXP_HI));
+  __m256 fn = _mm256_round_ps(_mm256_mul_ps(xc, _mm256_set1_ps(ARM_VEXP_LOG2E)),
+                              _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  __m256i n = _mm256_cvtps_epi32(fn);
+  __m256 r = _mm256_fnmadd_ps(fn, _mm256_set1_ps(ARM_VEXP_C2),
+                              _mm256_fnmadd_ps(fn, _mm256_set1_ps(ARM_VEXP_C1), xc));
+  __m256 z = _mm256_mul_ps(r, r);
+  __m256 y = _mm256_set1_ps(ARM_VEXP_P0);
+  __m256i n1, n2;
+
+  y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(ARM_VEXP_P1));
+  y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(ARM_VEXP_P2));
+  y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(ARM_VEXP_P3));
+  y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(ARM_VEXP_P4));
+  y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(ARM_VEXP_P5));
+  y = _mm256_add_ps(_mm256_fmadd_ps(y, z, r), _mm256_set1_ps(1.0f));
+
+  n1 = _mm256_srai_epi32(n, 1);
+  n2 = _mm256_sub_epi32(n, n1);
+  y = _mm256_mul_ps(y, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n1, _mm256_set1_epi32(127)), 23)));
+  y = _mm256_mul_ps(y, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n2, _mm256_set1_epi32(127)), 23)));
+
+  y = _mm256_blendv_ps(y, _mm256_set1_ps(INFINITY), _mm256_cmp_ps(x, _mm256_set1_ps(ARM_VEXP_HI), _CMP_GT_OQ));
+  y = _mm256_blendv_ps(y, x, _mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+  return y;
+}
+
+/**
+  @brief         SSE2 floating-point vector of exponential values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+void arm_vexp_f32_sse2(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t i = 0U;
+
+  for (; i + 4U <= blockSize; i += 4U)
+  {
+    _mm_storeu_ps(pDst + i, arm_vexp_f32_sse2_x4(_mm_loadu_ps(pSrc + i)));
+  }
+
+  if (i < blockSize)
+  {
+    /* Same polynomial for the tail, so results do not depend on position */
+    float32_t tmp[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    uint32_t j;
+
+    for (j = 0U; i + j < blockSize; j++)
+    {
+      tmp[j] = pSrc[i + j];
+    }
+    _mm_storeu_ps(tmp, arm_vexp_f32_sse2_x4(_mm_loadu_ps(tmp)));
+    for (j = 0U; i + j < blockSize; j++)
+    {
+      pDst[i + j] = tmp[j];
+    }
+  }
+}
+
+/**
+  @brief         AVX2 floating-point vector of exponential values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+ARM_X86_TARGET_AVX2
+void arm_vexp_f32_avx2(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t i = 0U;
+
+  for (; i + 8U <= blockSize; i += 8U)
+  {
+    _mm256_storeu_ps(pDst + i, arm_vexp_f32_avx2_x8(_mm256_loadu_ps(pSrc + i)));
+  }
+
+  if (i < blockSize)
+  {
+    float32_t tmp[8] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    uint32_t j;
+
+    for (j = 0U; i + j < blockSize; j++)
+    {
+      tmp[j] = pSrc[i + j];
+    }
+    _mm256_storeu_ps(tmp, arm_vexp_f32_avx2_x8(_mm256_loadu_ps(tmp)));
+    for (j = 0U; i + j < blockSize; j++)
+    {
+      pDst[i + j] = tmp[j];
+    }
+  }
+}
+
+/**
+  @} end of vexp group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_x86_level.c
+ * Description:  Run-time selection of the x86 code path
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/x86_functions.h"
+
+#if defined(ARM_MATH_X86)
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+  @ingroup groupX86
+ */
+
+/**
+  @addtogroup groupX86
+  @{
+ */
+
+/* -1 until the first query */
+static int arm_x86_level_current = -1;
+
+static arm_x86_level arm_x86_detect(void)
+{
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+  {
+    return ARM_X86_LEVEL_AVX2;
+  }
+  return ARM_X86_LEVEL_SSE2;
+}
+
+/**
+  @brief         Code path level in use.
+  @return        level selected by CPU detection, ARM_MATH_X86_LEVEL or arm_x86_set_level()
+ */
+arm_x86_level arm_x86_get_level(void)
+{
+  if (arm_x86_level_current < 0)
+  {
+    arm_x86_level level = arm_x86_detect();
+    const char *env = getenv("ARM_MATH_X86_LEVEL");
+
+    if (env != NULL)
+    {
+      if (strcmp(env, "scalar") == 0)
+      {
+        level = ARM_X86_LEVEL_SCALAR;
+      }
+      else if (strcmp(env, "sse2") == 0 && level > ARM_X86_LEVEL_SSE2)
+      {
+        level = ARM_X86_LEVEL_SSE2;
+      }
+    }
+    arm_x86_level_current = (int)level;
+  }
+
+  return (arm_x86_level)arm_x86_level_current;
+}
+
+/**
+  @brief         Force a code path level.
+  @param[in]     level  requested level, clamped to what the CPU supports
+  @return        level actually selected
+ */
+arm_x86_level arm_x86_set_level(arm_x86_level level)
+{
+  arm_x86_level max = arm_x86_detect();
+
+  arm_x86_level_current = (int)((level > max) ? max : level);
+  return (arm_x86_level)arm_x86_level_current;
+}
+
+/**
+  @} end of groupX86 group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
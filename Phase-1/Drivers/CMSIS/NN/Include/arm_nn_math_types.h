@@ -83,6 +83,11 @@ extern "C" {
 #ifndef __STATIC_INLINE
 #define __STATIC_INLINE static inline
 #endif
+#ifndef __RESTRICT
+#define __RESTRICT __restrict
+#endif
+/* Plain C __CLZ, __SSAT and __USAT for the host build */
+#include "dsp/none.h"
 
 #else
 #include "cmsis_compiler.h"
@@ -127,6 +127,48 @@ typedef struct
     cmsis_nn_activation output_activation;
 } cmsis_nn_svdf_params;
 
+/** CMSIS-NN object for the state of a streaming 1xN convolution */
+typedef struct
+{
+    int8_t *buf;   /**< Ring of the last WK input columns, each stored twice.
+                        arm_convolve_1_x_n_stream_s8_get_state_size() bytes */
+    int32_t pos;   /**< Ring slot of the next input column */
+    int32_t phase; /**< Input columns until the next output column */
+} cmsis_nn_conv_stream_state;
+
+/** CMSIS-NN object for the weights of an s8 LSTM cell. Gates in the order input, forget, cell, output */
+typedef struct
+{
+    const int8_t *weights;      /**< [4 * H, I + H]: each row I input weights, then H recurrent weights */
+    const int32_t *kernel_sums; /**< [4 * H]: bias plus the input offset term, arm_rnn_kernel_sums_s8() */
+    int32_t gate_multiplier;    /**< Accumulator to gate pre-activation, s8 Q3.4 */
+    int32_t gate_shift;
+} cmsis_nn_lstm_weights;
+
+/** CMSIS-NN object for the weights of an s8 GRU cell. The reset gate applies after the recurrent product */
+typedef struct
+{
+    const int8_t *gate_weights;       /**< [2 * H, I + H]: update and reset gates, rows as in LSTM */
+    const int32_t *gate_kernel_sums;  /**< [2 * H] */
+    const int8_t *input_weights;      /**< [H, I]: candidate, input part */
+    const int32_t *input_kernel_sums; /**< [H] */
+    const int8_t *recurrent_weights;  /**< [H, H]: candidate, recurrent part */
+    const int32_t *recurrent_bias;    /**< [H], optional */
+    int32_t gate_multiplier;          /**< Accumulators to pre-activations, s8 Q3.4 */
+    int32_t gate_shift;
+    int32_t input_multiplier;
+    int32_t input_shift;
+    int32_t recurrent_multiplier;
+    int32_t recurrent_shift;
+} cmsis_nn_gru_weights;
+
+/** CMSIS-NN object for the state of an LSTM or GRU cell, cleared with arm_rnn_state_s8_reset() */
+typedef struct
+{
+    int8_t *input_hidden; /**< [I + H]: the current input, then the hidden state h (s8 Q0.7), the layer output */
+    int16_t *cell;        /**< [H]: LSTM cell state (Q4.11) or GRU hidden state at full precision (Q0.15) */
+} cmsis_nn_rnn_state;
+
 /** CMSIS-NN object for Softmax s16 layer parameters */
 typedef struct
 {
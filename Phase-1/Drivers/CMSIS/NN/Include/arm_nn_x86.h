@@ -0,0 +1,80 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_x86.h
+ * Description:  Public header file for the x86 SIMD backend of CMSIS NN Library
+ *
+ * Target Processor:  x86-64 hosts
+ * -------------------------------------------------------------------- */
+
+#ifndef _ARM_NN_X86_H_
+#define _ARM_NN_X86_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(ARM_MATH_X86)
+
+/**
+ * @defgroup groupNNX86 x86 SIMD Backend
+ *
+ * When the library is built with ARM_MATH_X86, the s8 matrix kernels
+ * (arm_nn_mat_mult_nt_t_s8, arm_nn_vec_mat_mult_t_s8, arm_nn_mat_mul_core_4x_s8)
+ * and the ch_mult == 1 depthwise convolutions select an AVX2 or AVX-512 VNNI
+ * implementation at run time, and arm_convolve_s8 switches to an s8 im2col
+ * feeding arm_nn_mat_mult_nt_t_s8. The results are bit-exact with the C
+ * reference: the accumulators hold the same int32 sums and the requantization
+ * is the vector form of arm_nn_requantize(). The public API is unchanged.
+ *
+ * The level is detected from CPUID on first use. It can be lowered with the
+ * environment variable ARM_NN_X86_LEVEL (scalar or avx2) or with
+ * arm_nn_x86_set_level(), which is how the SIMD paths are compared against
+ * the portable C reference.
+ */
+
+/**
+ * @brief x86 code path levels, in increasing order of capability.
+ */
+typedef enum
+{
+    ARM_NN_X86_LEVEL_SCALAR = 0,     /**< Portable C reference implementation */
+    ARM_NN_X86_LEVEL_AVX2 = 1,       /**< AVX2, 16-bit multiply-add */
+    ARM_NN_X86_LEVEL_AVX512_VNNI = 2 /**< AVX-512 BW + VNNI, 8-bit dot products */
+} arm_nn_x86_level;
+
+/**
+ * @brief  Code path level in use.
+ * @return level selected by CPU detection, the environment or arm_nn_x86_set_level()
+ */
+arm_nn_x86_level arm_nn_x86_get_level(void);
+
+/**
+ * @brief  Force a code path level.
+ * @param[in] level  requested level. It is clamped to what the CPU supports.
+ * @return level actually selected
+ */
+arm_nn_x86_level arm_nn_x86_set_level(arm_nn_x86_level level);
+
+#endif /* defined(ARM_MATH_X86) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ARM_NN_X86_H_ */
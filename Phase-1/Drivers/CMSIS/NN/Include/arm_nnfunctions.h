@@ -339,6 +339,180 @@ arm_status arm_convolve_s8(const cmsis_nn_context *ctx,
  */
 int32_t arm_convolve_s8_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
 
+/**
+ * @brief Columns of a packed weight row: the accumulation depth rounded up to a multiple of 4
+ *
+ * @param[in]       cols    Accumulation depth (HK * WK * C_IN of a convolution, N of a fully connected filter)
+ * @return          Padded depth
+ *
+ */
+int32_t arm_nn_packed_s8_cols(const int32_t cols);
+
+/**
+ * @brief Pack the weights of a convolution or fully connected layer for the *_packed_s8 kernels
+ *
+ * @param[in]       weights         Weights, rows x cols. Data type: int8
+ * @param[in]       bias            Optional bias, one per row. Data type: int32
+ * @param[in]       rows            Output channels (C_OUT)
+ * @param[in]       cols            Accumulation depth
+ * @param[in]       input_offset    Input offset the layer runs with (negative input zero point)
+ * @param[out]      packed_weights  rows x arm_nn_packed_s8_cols(cols) bytes. Data type: int8
+ * @param[out]      kernel_sums     One per row: bias + input_offset * sum(row). Data type: int32
+ *
+ * @details
+ *    - Meant to run offline (Host/tools/nn_pack.c) with the result stored in flash, but
+ *      it is plain C and can also run once at start-up.
+ *    - Each row is zero padded to the packed depth, so the kernels run whole 4-element
+ *      groups and never have a tail loop.
+ *    - With the input offset folded into the kernel sums, the kernels multiply the raw
+ *      int8 activations: no offset is added to an input, and none of the weights is
+ *      transformed, per inference.
+ *
+ */
+void arm_nn_pack_weights_s8(const q7_t *weights,
+                            const int32_t *bias,
+                            const int32_t rows,
+                            const int32_t cols,
+                            const int32_t input_offset,
+                            q7_t *packed_weights,
+                            int32_t *kernel_sums);
+
+/**
+ * @brief s8 convolution on packed weights (see arm_nn_pack_weights_s8())
+ *
+ * @param[in, out] ctx            Function context holding the im2col buffer, sized by
+ *                                arm_convolve_packed_s8_get_buffer_size()
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                conv_params->input_offset must be the offset the weights were packed with;
+ *                                it is only used for padding here
+ *                                Range of conv_params->input_offset  : [-127, 128]
+ *                                Range of conv_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions before packing. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]      packed_filter  Packed weights, C_OUT x arm_nn_packed_s8_cols(HK * WK * C_IN). Data type: int8
+ * @param[in]      kernel_sums    Kernel sums from arm_nn_pack_weights_s8(), one per output channel. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the im2col buffer is missing or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Output is bit-exact with arm_convolve_s8() on the unpacked weights and bias.
+ *    - DSP extension: the im2col converts the raw input to q15 in the pair order of
+ *      SXTB16 (arm_q7_to_q15_reordered_no_shift()), which is the order the weight
+ *      words come out of SXTB16 in, so neither side needs a PKHBT/PKHTB repack and
+ *      arm_nn_mat_mult_kernel_s8_s16_reordered() does the multiply.
+ *    - Other targets: s8 im2col of up to four columns through arm_nn_mat_mult_nt_t_s8()
+ *      with a zero input offset. 1x1 convolutions with unit stride, no padding and
+ *      C_IN a multiple of 4 read the input in place.
+ *
+ */
+arm_status arm_convolve_packed_s8(const cmsis_nn_context *ctx,
+                                  const cmsis_nn_conv_params *conv_params,
+                                  const cmsis_nn_per_channel_quant_params *quant_params,
+                                  const cmsis_nn_dims *input_dims,
+                                  const q7_t *input_data,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const q7_t *packed_filter,
+                                  const int32_t *kernel_sums,
+                                  const cmsis_nn_dims *output_dims,
+                                  q7_t *output_data);
+
+/**
+ * @brief Get the required buffer size for s8 convolution on packed weights
+ *
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims           Filter tensor dimensions before packing. Format: [C_OUT, HK, WK, C_IN]
+ * @return          The function returns  required buffer size(bytes)
+ *
+ */
+int32_t arm_convolve_packed_s8_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
+
+/**
+ * @brief s8 convolution with 2x2 stride 2 max pooling of its output, fused
+ *
+ * @param[in, out] ctx            Function context holding the im2col and pooling window buffer, sized by
+ *                                arm_convolve_pool_2x2_s8_get_buffer_size()
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                conv_params->activation clamps every conv output before pooling
+ *                                Range of conv_params->input_offset  : [-127, 128]
+ *                                Range of conv_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Pooled output dimensions. Format: [N, H / 2, W / 2, C_OUT], H and W
+ *                                being the conv output size, rounded down
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the buffer is missing or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Output is bit-exact with arm_convolve_s8() followed by arm_max_pool_s8() with a 2x2
+ *      filter, stride 2 and no padding; the conv tensor is never written, only the four
+ *      outputs of one pooling window at a time (4 * C_OUT bytes). The last conv row and
+ *      column are not computed when the conv output size is odd.
+ *    - The conv outputs go through the same matrix multiplication as in arm_convolve_s8():
+ *      the four s8 columns of a window in one arm_nn_mat_mult_nt_t_s8() call on MVE and on
+ *      x86 from AVX2, otherwise two q15 columns per arm_nn_mat_mult_kernel_s8_s16() call.
+ *
+ */
+arm_status arm_convolve_max_pool_2x2_s8(const cmsis_nn_context *ctx,
+                                        const cmsis_nn_conv_params *conv_params,
+                                        const cmsis_nn_per_channel_quant_params *quant_params,
+                                        const cmsis_nn_dims *input_dims,
+                                        const q7_t *input_data,
+                                        const cmsis_nn_dims *filter_dims,
+                                        const q7_t *filter_data,
+                                        const cmsis_nn_dims *bias_dims,
+                                        const int32_t *bias_data,
+                                        const cmsis_nn_dims *output_dims,
+                                        q7_t *output_data);
+
+/**
+ * @brief s8 convolution with 2x2 stride 2 average pooling of its output, fused
+ *
+ * @details Arguments as arm_convolve_max_pool_2x2_s8(). Output is bit-exact with arm_convolve_s8()
+ *          followed by arm_avgpool_s8() with a 2x2 filter, stride 2, no padding and an activation
+ *          range that contains conv_params->activation.
+ *
+ */
+arm_status arm_convolve_avg_pool_2x2_s8(const cmsis_nn_context *ctx,
+                                        const cmsis_nn_conv_params *conv_params,
+                                        const cmsis_nn_per_channel_quant_params *quant_params,
+                                        const cmsis_nn_dims *input_dims,
+                                        const q7_t *input_data,
+                                        const cmsis_nn_dims *filter_dims,
+                                        const q7_t *filter_data,
+                                        const cmsis_nn_dims *bias_dims,
+                                        const int32_t *bias_data,
+                                        const cmsis_nn_dims *output_dims,
+                                        q7_t *output_data);
+
+/**
+ * @brief Get the required buffer size for the fused convolution and 2x2 pooling
+ *
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]       output_dims           Pooled output dimensions. Format: [N, H, W, C_OUT]
+ * @return          The function returns  required buffer size(bytes)
+ *
+ */
+int32_t arm_convolve_pool_2x2_s8_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                                 const cmsis_nn_dims *filter_dims,
+                                                 const cmsis_nn_dims *output_dims);
+
 /**
  * @brief Basic s16 convolution function
  * @param[in, out] ctx            Function context that contains the additional buffer if required by the function.
@@ -818,6 +992,85 @@ arm_status arm_convolve_1_x_n_s8(const cmsis_nn_context *ctx,
  */
 int32_t arm_convolve_1_x_n_s8_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
 
+/**
+ * @brief 1xn convolution in streaming mode
+ *
+ * @param[in, out] state          Ring of the last WK input columns and the stride phase. Cleared with
+ *                                arm_convolve_1_x_n_stream_s8_reset()
+ * @param[in]      conv_params    Convolution parameters. Only stride.w is used (padding is causal: the
+ *                                history before the first column is the input zero point)
+ *                                Range of conv_params->input_offset  : [-127, 128]
+ *                                Range of conv_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims     New input columns. Format: [1, 1, W_NEW, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer, W_NEW columns oldest first. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, 1, WK, C_IN]
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [1, 1, W, C_OUT], only C_OUT is used
+ * @param[out]     output_data    Output columns, room for ceil(W_NEW / stride.w) of them. Data type: int8
+ * @param[out]     output_cols    Optional, output columns written
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_SIZE_MISMATCH</code> if argument constraints fail. or,
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *   - Incremental form of arm_convolve_1_x_n_s8 for temporal convolutions that see one new
+ *     column per hop: each new input column that completes an output column (every stride.w-th
+ *     one, starting with the first after a reset) costs one WK * C_IN by C_OUT vector-matrix
+ *     product, instead of recomputing every output column of the window.
+ *   - Once WK columns have gone in, every output column is bit-exact with the newest output
+ *     column of arm_convolve_1_x_n_s8 (valid padding) over a window ending at the same input column.
+ *   - Layers chain: the output columns of one are the input columns of the next, each with its
+ *     own state, so a stack of temporal convolutions keeps all its intermediate activations in
+ *     the rings.
+ *   - The following constrains on the arguments apply
+ *      -# input_dims->n and input_dims->h equal 1
+ *      -# filter_dims->h equals 1
+ *      -# conv_params->dilation.w equals 1
+ *
+ */
+arm_status arm_convolve_1_x_n_stream_s8(cmsis_nn_conv_stream_state *state,
+                                        const cmsis_nn_conv_params *conv_params,
+                                        const cmsis_nn_per_channel_quant_params *quant_params,
+                                        const cmsis_nn_dims *input_dims,
+                                        const q7_t *input_data,
+                                        const cmsis_nn_dims *filter_dims,
+                                        const q7_t *filter_data,
+                                        const cmsis_nn_dims *bias_dims,
+                                        const int32_t *bias_data,
+                                        const cmsis_nn_dims *output_dims,
+                                        q7_t *output_data,
+                                        int32_t *output_cols);
+
+/**
+ * @brief Get the state size for streaming 1xn convolution
+ *
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [1, 1, W, C_IN]
+ * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, 1, WK, C_IN]
+ * @return          The function returns  required size of state->buf (bytes)
+ *
+ */
+int32_t arm_convolve_1_x_n_stream_s8_get_state_size(const cmsis_nn_dims *input_dims,
+                                                    const cmsis_nn_dims *filter_dims);
+
+/**
+ * @brief Reset the state of a streaming 1xn convolution
+ *
+ * @param[in, out]  state                 State, with state->buf pointing to the ring
+ * @param[in]       conv_params           Convolution parameters (input_offset fills the history)
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [1, 1, W, C_IN]
+ * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, 1, WK, C_IN]
+ *
+ */
+void arm_convolve_1_x_n_stream_s8_reset(cmsis_nn_conv_stream_state *state,
+                                        const cmsis_nn_conv_params *conv_params,
+                                        const cmsis_nn_dims *input_dims,
+                                        const cmsis_nn_dims *filter_dims);
+
 /**
  * @brief Q7 version of convolution for RGB image
  * @param[in]       Im_in       pointer to input tensor
@@ -1380,6 +1633,51 @@ arm_status arm_fully_connected_s8(const cmsis_nn_context *ctx,
  */
 int32_t arm_fully_connected_s8_get_buffer_size(const cmsis_nn_dims *filter_dims);
 
+/**
+ * @brief s8 fully connected layer on packed weights (see arm_nn_pack_weights_s8())
+ *
+ * @param[in, out] ctx            Function context, holds a padded copy of one input batch when the
+ *                                depth is not a multiple of 4 (arm_fully_connected_packed_s8_get_buffer_size())
+ * @param[in]      fc_params      Fully Connected layer parameters. fc_params->input_offset is folded into
+ *                                the kernel sums and not used here
+ *                                fc_params->filter_offset : 0
+ *                                Range of fc_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-tensor quantization info.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter dimensions before packing. Format: [N, C], N the accumulation depth
+ * @param[in]      packed_kernel  Packed weights, C x arm_nn_packed_s8_cols(N). Data type: int8
+ * @param[in]      kernel_sums    Kernel sums from arm_nn_pack_weights_s8(), one per output. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, C_OUT]
+ * @param[in, out] output_data    Output data pointer. Data type: int8
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the padding buffer is missing or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Output is bit-exact with arm_fully_connected_s8() on the unpacked weights and bias.
+ *    - arm_fully_connected_s8() already folds the input offset into its row sums. When the depth is a
+ *      multiple of 4 both make the same arm_nn_vec_mat_mult_t_s8() call, so packing gains nothing.
+ */
+arm_status arm_fully_connected_packed_s8(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_fc_params *fc_params,
+                                         const cmsis_nn_per_tensor_quant_params *quant_params,
+                                         const cmsis_nn_dims *input_dims,
+                                         const q7_t *input_data,
+                                         const cmsis_nn_dims *filter_dims,
+                                         const q7_t *packed_kernel,
+                                         const int32_t *kernel_sums,
+                                         const cmsis_nn_dims *output_dims,
+                                         q7_t *output_data);
+
+/**
+ * @brief Get the required buffer size for the s8 fully connected layer on packed weights
+ * @param[in]      filter_dims             Filter dimensions before packing
+ * @return         The function returns    required buffer size in bytes
+ *
+ */
+int32_t arm_fully_connected_packed_s8_get_buffer_size(const cmsis_nn_dims *filter_dims);
+
 /**
  * @brief Basic s16 Fully Connected function.
  *
@@ -2525,6 +2823,173 @@ arm_status arm_svdf_state_s16_s8(const cmsis_nn_context *input_ctx,
                                  const cmsis_nn_dims *output_dims,
                                  q7_t *output_data);
 
+/**
+ * @defgroup RNN LSTM and GRU Layer Functions
+ *
+ * Recurrent cells for streaming sequence models: s8 inputs, weights and hidden state, s16 cell state.
+ * The gates of a cell are stacked into one weight matrix over the concatenated [input, hidden]
+ * vector, so a step costs one arm_nn_vec_mat_mult_t_s8() call for all of them (GRU: three calls,
+ * its candidate needs the input and recurrent products apart). The input zero point is folded
+ * into kernel sums offline. Gate pre-activations are s8 Q3.4, which index the q15 sigmoid and
+ * tanh tables directly. The hidden state h is s8 Q0.7 (scale 1/128, zero point 0).
+ */
+
+/**
+ * @brief Kernel sums of an RNN weight matrix whose rows start with the input weights
+ *
+ * @param[in]  weights      Weights [rows, row_cols], the first input_size of each row multiply the input
+ * @param[in]  bias         Optional bias [rows]
+ * @param[in]  rows         Number of rows
+ * @param[in]  input_size   Input weights per row
+ * @param[in]  row_cols     Elements per row
+ * @param[in]  input_offset Input offset (negated zero point of the input). Range: -127 to 128
+ * @param[out] kernel_sums  bias + input_offset * sum of the input weights, [rows]
+ *
+ */
+void arm_rnn_kernel_sums_s8(const q7_t *weights,
+                            const int32_t *bias,
+                            const int32_t rows,
+                            const int32_t input_size,
+                            const int32_t row_cols,
+                            const int32_t input_offset,
+                            int32_t *kernel_sums);
+
+/**
+ * @brief Clear the state of an LSTM or GRU cell (h = 0, c = 0)
+ *
+ * @param[in, out] state       State with input_size + hidden_size bytes at state->input_hidden
+ *                             and hidden_size q15 at state->cell
+ * @param[in]      input_size  Input features I
+ * @param[in]      hidden_size Hidden units H
+ *
+ */
+void arm_rnn_state_s8_reset(cmsis_nn_rnn_state *state, const int32_t input_size, const int32_t hidden_size);
+
+/**
+ * @brief s8 LSTM cell, one time step
+ *
+ * @param[in]      ctx         Scratch buffer of arm_lstm_s8_get_buffer_size() bytes
+ * @param[in]      weights     Stacked gate weights, kernel sums and gate quantization
+ * @param[in, out] state       Hidden and cell state, carried from step to step
+ * @param[in]      input_dims  Input dimensions. Format: [1, 1, 1, I]
+ * @param[in]      input_data  Input vector. Data type: int8
+ * @param[in]      output_dims Output dimensions. Format: [1, 1, 1, H]
+ * @param[out]     output_data The new hidden state h. Data type: int8, Q0.7
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if ctx->buf is NULL or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    i = sigmoid(gate 0), f = sigmoid(gate 1), g = tanh(gate 2), o = sigmoid(gate 3),
+ *    c = f * c + i * g (Q4.11, saturating at +-16), h = o * tanh(c).
+ *
+ */
+arm_status arm_lstm_step_s8(const cmsis_nn_context *ctx,
+                            const cmsis_nn_lstm_weights *weights,
+                            cmsis_nn_rnn_state *state,
+                            const cmsis_nn_dims *input_dims,
+                            const q7_t *input_data,
+                            const cmsis_nn_dims *output_dims,
+                            q7_t *output_data);
+
+/**
+ * @brief s8 LSTM layer over a sequence
+ *
+ * @param[in]      ctx         Scratch buffer of arm_lstm_s8_get_buffer_size() bytes
+ * @param[in]      weights     Stacked gate weights, kernel sums and gate quantization
+ * @param[in, out] state       Hidden and cell state, continued from the previous call
+ * @param[in]      input_dims  Input dimensions. Format: [T, 1, 1, I], oldest step first
+ * @param[in]      input_data  Input sequence. Data type: int8
+ * @param[in]      output_dims Output dimensions. Format: [T, 1, 1, H]
+ * @param[out]     output_data Hidden state after every step. Data type: int8, Q0.7
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_SIZE_MISMATCH</code> if the step counts differ,
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if ctx->buf is NULL or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ */
+arm_status arm_lstm_s8(const cmsis_nn_context *ctx,
+                       const cmsis_nn_lstm_weights *weights,
+                       cmsis_nn_rnn_state *state,
+                       const cmsis_nn_dims *input_dims,
+                       const q7_t *input_data,
+                       const cmsis_nn_dims *output_dims,
+                       q7_t *output_data);
+
+/**
+ * @brief Get the required buffer size for arm_lstm_s8() and arm_lstm_step_s8()
+ *
+ * @param[in]  output_dims Output dimensions. Format: [T, 1, 1, H]
+ * @return     The function returns required buffer size in bytes
+ *
+ */
+int32_t arm_lstm_s8_get_buffer_size(const cmsis_nn_dims *output_dims);
+
+/**
+ * @brief s8 GRU cell, one time step
+ *
+ * @param[in]      ctx         Scratch buffer of arm_gru_s8_get_buffer_size() bytes
+ * @param[in]      weights     Gate and candidate weights, kernel sums and quantization
+ * @param[in, out] state       Hidden state (s8 copy and Q0.15 in state->cell), carried from step to step
+ * @param[in]      input_dims  Input dimensions. Format: [1, 1, 1, I]
+ * @param[in]      input_data  Input vector. Data type: int8
+ * @param[in]      output_dims Output dimensions. Format: [1, 1, 1, H]
+ * @param[out]     output_data The new hidden state h. Data type: int8, Q0.7
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if ctx->buf is NULL or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    z = sigmoid(gate 0), r = sigmoid(gate 1), n = tanh(Wn x + bn + r * (Un h + bhn)),
+ *    h = n + z * (h - n). h is kept at Q0.15 so that slow updates (z close to 1) are not lost
+ *    to the s8 rounding of the output.
+ *
+ */
+arm_status arm_gru_step_s8(const cmsis_nn_context *ctx,
+                           const cmsis_nn_gru_weights *weights,
+                           cmsis_nn_rnn_state *state,
+                           const cmsis_nn_dims *input_dims,
+                           const q7_t *input_data,
+                           const cmsis_nn_dims *output_dims,
+                           q7_t *output_data);
+
+/**
+ * @brief s8 GRU layer over a sequence
+ *
+ * @param[in]      ctx         Scratch buffer of arm_gru_s8_get_buffer_size() bytes
+ * @param[in]      weights     Gate and candidate weights, kernel sums and quantization
+ * @param[in, out] state       Hidden state, continued from the previous call
+ * @param[in]      input_dims  Input dimensions. Format: [T, 1, 1, I], oldest step first
+ * @param[in]      input_data  Input sequence. Data type: int8
+ * @param[in]      output_dims Output dimensions. Format: [T, 1, 1, H]
+ * @param[out]     output_data Hidden state after every step. Data type: int8, Q0.7
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_SIZE_MISMATCH</code> if the step counts differ,
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if ctx->buf is NULL or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ */
+arm_status arm_gru_s8(const cmsis_nn_context *ctx,
+                      const cmsis_nn_gru_weights *weights,
+                      cmsis_nn_rnn_state *state,
+                      const cmsis_nn_dims *input_dims,
+                      const q7_t *input_data,
+                      const cmsis_nn_dims *output_dims,
+                      q7_t *output_data);
+
+/**
+ * @brief Get the required buffer size for arm_gru_s8() and arm_gru_step_s8()
+ *
+ * @param[in]  output_dims Output dimensions. Format: [T, 1, 1, H]
+ * @return     The function returns required buffer size in bytes
+ *
+ */
+int32_t arm_gru_s8_get_buffer_size(const cmsis_nn_dims *output_dims);
+
 #ifdef __cplusplus
 }
 #endif
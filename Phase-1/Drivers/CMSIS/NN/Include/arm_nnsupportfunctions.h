@@ -32,6 +32,7 @@
 
 #include "arm_nn_math_types.h"
 #include "arm_nn_types.h"
+#include "arm_nn_x86.h"
 
 #include <stdbool.h>
 
@@ -315,7 +316,7 @@ arm_status arm_nn_mat_mul_core_1x_s8(int32_t row_elements,
  *
  * @return     The function returns the updated output pointer or NULL if implementation is not available.
  *
- * @details Compliant to TFLM int8 specification. MVE implementation only
+ * @details Compliant to TFLM int8 specification. MVE and x86 (ARM_MATH_X86, any level) implementations only
  */
 int8_t *arm_nn_mat_mul_core_4x_s8(const int32_t row_elements,
                                   const int32_t offset,
@@ -804,6 +805,40 @@ q7_t *arm_nn_mat_mult_kernel_s8_s16(const q7_t *input_a,
                                     const int32_t *const output_bias,
                                     q7_t *out_0);
 
+/**
+ * @brief Matrix-multiplication function for convolution with per-channel requantization, weights
+ *        read with read_and_pad_reordered().
+ * @param[in]       input_a     pointer to operand A
+ * @param[in]       input_b     pointer to operand B, 2 vectors in the pair order of
+ *                              arm_q7_to_q15_reordered_no_shift()
+ * @param[in]       output_ch   number of rows of A
+ * @param[in]       out_shift  pointer to per output channel requantization shift parameter.
+ * @param[in]       out_mult   pointer to per output channel requantization multiplier parameter.
+ * @param[in]       out_offset      output tensor offset.
+ * @param[in]       activation_min   minimum value to clamp the output to. Range : int8
+ * @param[in]       activation_max   maximum value to clamp the output to. Range : int8
+ * @param[in]       num_col_a   number of columns of A, a multiple of 4
+ * @param[in]       output_bias per output channel bias, required. Range : int32
+ * @param[in,out]   out_0       pointer to output
+ * @return     The function returns one of the two
+ *              1. The incremented output pointer for a successful operation or
+ *              2. NULL if implementation is not available.
+ *
+ * @details   Same as arm_nn_mat_mult_kernel_s8_s16() without the PKHBT/PKHTB repack of the
+ *            weights. No input offset is added: fold it into output_bias (see arm_nn_pack_weights_s8()).
+ */
+q7_t *arm_nn_mat_mult_kernel_s8_s16_reordered(const q7_t *input_a,
+                                              const q15_t *input_b,
+                                              const uint16_t output_ch,
+                                              const int32_t *out_shift,
+                                              const int32_t *out_mult,
+                                              const int32_t out_offset,
+                                              const int16_t activation_min,
+                                              const int16_t activation_max,
+                                              const uint16_t num_col_a,
+                                              const int32_t *const output_bias,
+                                              q7_t *out_0);
+
 /**
  * @brief Common softmax function for s8 input and s8 or s16 output
  * @param[in]  input          Pointer to the input tensor
@@ -1179,6 +1214,111 @@ __STATIC_FORCEINLINE void arm_nn_write_q15x2_ia(q15_t **dest_q15, q31_t src_q31)
     *dest_q15 += 2;
 }
 
+#if defined(ARM_MATH_X86)
+
+/*
+ * x86 SIMD kernels, see arm_nn_x86.h. They are compiled per function with a
+ * target attribute and only called after arm_nn_x86_get_level() has confirmed
+ * the CPU supports them.
+ */
+
+/**
+ * @brief s8 matrix multiplication with the RHS transposed, AVX2 / AVX-512 VNNI
+ *
+ * Same as arm_nn_mat_mult_nt_t_s8() except that LHS rows are lhs_stride
+ * elements apart, which also covers arm_nn_mat_mul_core_4x_s8().
+ */
+void arm_nn_mat_mult_nt_t_s8_avx2(const q7_t *lhs,
+                                  const int32_t lhs_stride,
+                                  const q7_t *rhs,
+                                  const q31_t *bias,
+                                  q7_t *dst,
+                                  const int32_t *dst_multipliers,
+                                  const int32_t *dst_shifts,
+                                  const int32_t lhs_rows,
+                                  const int32_t rhs_rows,
+                                  const int32_t rhs_cols,
+                                  const int32_t lhs_offset,
+                                  const int32_t dst_offset,
+                                  const int32_t activation_min,
+                                  const int32_t activation_max);
+
+void arm_nn_mat_mult_nt_t_s8_avx512(const q7_t *lhs,
+                                    const int32_t lhs_stride,
+                                    const q7_t *rhs,
+                                    const q31_t *bias,
+                                    q7_t *dst,
+                                    const int32_t *dst_multipliers,
+                                    const int32_t *dst_shifts,
+                                    const int32_t lhs_rows,
+                                    const int32_t rhs_rows,
+                                    const int32_t rhs_cols,
+                                    const int32_t lhs_offset,
+                                    const int32_t dst_offset,
+                                    const int32_t activation_min,
+                                    const int32_t activation_max);
+
+/**
+ * @brief s8 vector by transposed matrix multiplication, AVX2 / AVX-512 VNNI
+ *
+ * Same arguments as arm_nn_vec_mat_mult_t_s8(), without the unused rhs_offset.
+ */
+void arm_nn_vec_mat_mult_t_s8_avx2(const q7_t *lhs,
+                                   const q7_t *rhs,
+                                   const q31_t *bias,
+                                   q7_t *dst,
+                                   const int32_t lhs_offset,
+                                   const int32_t dst_offset,
+                                   const int32_t dst_multiplier,
+                                   const int32_t dst_shift,
+                                   const int32_t rhs_cols,
+                                   const int32_t rhs_rows,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max,
+                                   const int32_t address_offset);
+
+void arm_nn_vec_mat_mult_t_s8_avx512(const q7_t *lhs,
+                                     const q7_t *rhs,
+                                     const q31_t *bias,
+                                     q7_t *dst,
+                                     const int32_t lhs_offset,
+                                     const int32_t dst_offset,
+                                     const int32_t dst_multiplier,
+                                     const int32_t dst_shift,
+                                     const int32_t rhs_cols,
+                                     const int32_t rhs_rows,
+                                     const int32_t activation_min,
+                                     const int32_t activation_max,
+                                     const int32_t address_offset);
+
+/**
+ * @brief s8 depthwise convolution with ch_mult == 1, AVX2 / AVX-512
+ *
+ * Any kernel size, padding, stride, dilation and batch count. Channels are
+ * processed 16 (AVX2) or 32 (AVX-512) at a time.
+ */
+void arm_depthwise_conv_s8_avx2(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                const cmsis_nn_per_channel_quant_params *quant_params,
+                                const cmsis_nn_dims *input_dims,
+                                const q7_t *input,
+                                const cmsis_nn_dims *filter_dims,
+                                const q7_t *kernel,
+                                const int32_t *bias,
+                                const cmsis_nn_dims *output_dims,
+                                q7_t *output);
+
+void arm_depthwise_conv_s8_avx512(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                  const cmsis_nn_per_channel_quant_params *quant_params,
+                                  const cmsis_nn_dims *input_dims,
+                                  const q7_t *input,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const q7_t *kernel,
+                                  const int32_t *bias,
+                                  const cmsis_nn_dims *output_dims,
+                                  q7_t *output);
+
+#endif /* defined(ARM_MATH_X86) */
+
 #ifdef __cplusplus
 }
 #endif
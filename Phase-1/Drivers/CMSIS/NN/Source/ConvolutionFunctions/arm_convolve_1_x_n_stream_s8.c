@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_1_x_n_stream_s8.c
+ * Description:  s8 1xN convolution in streaming (incremental) mode: keeps the
+ *               last WK input columns in a ring and computes only the
+ *               output columns the new input columns complete.
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * The ring holds every column twice, at slot i and slot i + WK, so the WK
+ * newest columns are always one contiguous WK * C_IN row starting at the
+ * oldest of them: an output column is a single 1-row matrix multiplication
+ * against the filter, with no im2col and no shifting of the history.
+ *
+ * Refer header file for details.
+ *
+ */
+
+int32_t arm_convolve_1_x_n_stream_s8_get_state_size(const cmsis_nn_dims *input_dims,
+                                                    const cmsis_nn_dims *filter_dims)
+{
+    return 2 * filter_dims->w * input_dims->c * (int32_t)sizeof(q7_t);
+}
+
+void arm_convolve_1_x_n_stream_s8_reset(cmsis_nn_conv_stream_state *state,
+                                        const cmsis_nn_conv_params *conv_params,
+                                        const cmsis_nn_dims *input_dims,
+                                        const cmsis_nn_dims *filter_dims)
+{
+    /* History before the first column reads as real zero, the input zero point */
+    memset(state->buf,
+           (q7_t)(-conv_params->input_offset),
+           (size_t)arm_convolve_1_x_n_stream_s8_get_state_size(input_dims, filter_dims));
+    state->pos = 0;
+    state->phase = 0;
+}
+
+arm_status arm_convolve_1_x_n_stream_s8(cmsis_nn_conv_stream_state *state,
+                                        const cmsis_nn_conv_params *conv_params,
+                                        const cmsis_nn_per_channel_quant_params *quant_params,
+                                        const cmsis_nn_dims *input_dims,
+                                        const q7_t *input_data,
+                                        const cmsis_nn_dims *filter_dims,
+                                        const q7_t *filter_data,
+                                        const cmsis_nn_dims *bias_dims,
+                                        const int32_t *bias_data,
+                                        const cmsis_nn_dims *output_dims,
+                                        q7_t *output_data,
+                                        int32_t *output_cols)
+{
+    (void)bias_dims;
+
+    const int32_t input_ch = input_dims->c;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t output_ch = output_dims->c;
+    const int32_t stride_x = conv_params->stride.w;
+    const int32_t col_size = input_ch * kernel_x;
+    int32_t written = 0;
+
+    if (input_dims->n != 1 || input_dims->h != 1 || filter_dims->h != 1 || stride_x < 1 ||
+        conv_params->dilation.w != 1)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (int32_t i_col = 0; i_col < input_dims->w; i_col++)
+    {
+        /* Append the column to both copies of its ring slot */
+        q7_t *slot = state->buf + state->pos * input_ch;
+        memcpy(slot, input_data, (size_t)input_ch);
+        memcpy(slot + col_size, input_data, (size_t)input_ch);
+        input_data += input_ch;
+
+        state->pos = (state->pos + 1 == kernel_x) ? 0 : state->pos + 1;
+
+        if (state->phase == 0)
+        {
+            /* The WK newest columns, oldest first, start at the next slot to write */
+            arm_nn_mat_mult_nt_t_s8(state->buf + state->pos * input_ch,
+                                    filter_data,
+                                    bias_data,
+                                    output_data,
+                                    quant_params->multiplier,
+                                    quant_params->shift,
+                                    1,
+                                    output_ch,
+                                    col_size,
+                                    conv_params->input_offset,
+                                    conv_params->output_offset,
+                                    conv_params->activation.min,
+                                    conv_params->activation.max);
+            output_data += output_ch;
+            written++;
+            state->phase = stride_x;
+        }
+        state->phase--;
+    }
+
+    if (output_cols != NULL)
+    {
+        *output_cols = written;
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,328 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_packed_s8.c
+ * Description:  s8 convolution on weights packed offline by
+ *               arm_nn_pack_weights_s8(): padded rows and kernel sums, no
+ *               per-inference weight or offset transform
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * One im2col column of raw int8 input: padding taps hold -input_offset,
+ * which the kernel sums turn back into zero, and the column is zero padded
+ * up to the packed depth (those weights are zero too).
+ */
+static void conv_packed_im2col_s8(const q7_t *input_data,
+                                  const cmsis_nn_dims *input_dims,
+                                  const cmsis_nn_conv_params *conv_params,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const int32_t i_out_y,
+                                  const int32_t i_out_x,
+                                  const int32_t cols,
+                                  q7_t *col)
+{
+    const int32_t input_ch = input_dims->c;
+    const int32_t base_idx_y = conv_params->stride.h * i_out_y - conv_params->padding.h;
+    const int32_t base_idx_x = conv_params->stride.w * i_out_x - conv_params->padding.w;
+    q7_t *const col_end = col + cols;
+
+    for (int32_t i_ker_y = 0; i_ker_y < filter_dims->h; i_ker_y++)
+    {
+        const int32_t k_y = base_idx_y + conv_params->dilation.h * i_ker_y;
+
+        /* A kernel row that lies inside the input is one contiguous run of pixels */
+        if (conv_params->dilation.w == 1 && k_y >= 0 && k_y < input_dims->h && base_idx_x >= 0 &&
+            base_idx_x + filter_dims->w <= input_dims->w)
+        {
+            arm_memcpy_q7(col, input_data + (k_y * input_dims->w + base_idx_x) * input_ch, filter_dims->w * input_ch);
+            col += filter_dims->w * input_ch;
+            continue;
+        }
+
+        for (int32_t i_ker_x = 0; i_ker_x < filter_dims->w; i_ker_x++)
+        {
+            const int32_t k_x = base_idx_x + conv_params->dilation.w * i_ker_x;
+
+            if (k_y < 0 || k_y >= input_dims->h || k_x < 0 || k_x >= input_dims->w)
+            {
+                memset(col, (q7_t)-conv_params->input_offset, sizeof(q7_t) * input_ch);
+            }
+            else
+            {
+                arm_memcpy_q7(col, input_data + (k_y * input_dims->w + k_x) * input_ch, input_ch);
+            }
+            col += input_ch;
+        }
+    }
+    memset(col, 0, (size_t)(col_end - col));
+}
+
+/*
+ * s8 convolution on packed weights.
+ *
+ * Refer header file for details.
+ *
+ */
+
+arm_status arm_convolve_packed_s8(const cmsis_nn_context *ctx,
+                                  const cmsis_nn_conv_params *conv_params,
+                                  const cmsis_nn_per_channel_quant_params *quant_params,
+                                  const cmsis_nn_dims *input_dims,
+                                  const q7_t *input_data,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const q7_t *packed_filter,
+                                  const int32_t *kernel_sums,
+                                  const cmsis_nn_dims *output_dims,
+                                  q7_t *output_data)
+{
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_ch = input_dims->c;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_ch = output_dims->c;
+    const int32_t cols = arm_nn_packed_s8_cols(filter_dims->h * filter_dims->w * input_ch);
+
+    const int32_t out_offset = conv_params->output_offset;
+    const int32_t out_activation_min = conv_params->activation.min;
+    const int32_t out_activation_max = conv_params->activation.max;
+    int32_t *output_mult = quant_params->multiplier;
+    int32_t *output_shift = quant_params->shift;
+
+    /* Pointwise: every input pixel already is a padded column */
+    if (filter_dims->h == 1 && filter_dims->w == 1 && conv_params->stride.w == 1 && conv_params->stride.h == 1 &&
+        conv_params->padding.w == 0 && conv_params->padding.h == 0 && (input_ch & 3) == 0)
+    {
+        return arm_nn_mat_mult_nt_t_s8(input_data,
+                                       packed_filter,
+                                       kernel_sums,
+                                       output_data,
+                                       output_mult,
+                                       output_shift,
+                                       input_batches * input_dims->h * input_dims->w,
+                                       output_ch,
+                                       input_ch,
+                                       0,
+                                       out_offset,
+                                       out_activation_min,
+                                       out_activation_max);
+    }
+
+    if (ctx->buf == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+#if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    /* Two q15 columns in SXTB16 pair order, the order read_and_pad_reordered() gives the weights in */
+    q15_t *two_column_buf = (q15_t *)ctx->buf;
+    q7_t *staging = (q7_t *)(two_column_buf + 2 * cols);
+    const q15_t pad_value = (q15_t)-conv_params->input_offset;
+
+    for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        q15_t *col = two_column_buf;
+        q7_t *out = output_data;
+
+        for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            for (int32_t i_out_x = 0; i_out_x < output_x; i_out_x++)
+            {
+                if (input_ch & 3)
+                {
+                    /* Groups of 4 straddle pixels: gather the column first */
+                    conv_packed_im2col_s8(input_data, input_dims, conv_params, filter_dims, i_out_y, i_out_x, cols,
+                                          staging);
+                    arm_q7_to_q15_reordered_no_shift(staging, col, (uint32_t)cols);
+                    col += cols;
+                }
+                else
+                {
+                    const int32_t base_idx_y = conv_params->stride.h * i_out_y - conv_params->padding.h;
+                    const int32_t base_idx_x = conv_params->stride.w * i_out_x - conv_params->padding.w;
+
+                    for (int32_t i_ker_y = 0; i_ker_y < filter_dims->h; i_ker_y++)
+                    {
+                        for (int32_t i_ker_x = 0; i_ker_x < filter_dims->w; i_ker_x++)
+                        {
+                            const int32_t k_y = base_idx_y + conv_params->dilation.h * i_ker_y;
+                            const int32_t k_x = base_idx_x + conv_params->dilation.w * i_ker_x;
+
+                            if (k_y < 0 || k_y >= input_dims->h || k_x < 0 || k_x >= input_dims->w)
+                            {
+                                for (int32_t i = 0; i < input_ch; i++)
+                                {
+                                    col[i] = pad_value;
+                                }
+                            }
+                            else
+                            {
+                                arm_q7_to_q15_reordered_no_shift(
+                                    input_data + (k_y * input_dims->w + k_x) * input_ch, col, (uint32_t)input_ch);
+                            }
+                            col += input_ch;
+                        }
+                    }
+                }
+
+                if (col == two_column_buf + 2 * cols)
+                {
+                    out = arm_nn_mat_mult_kernel_s8_s16_reordered(packed_filter,
+                                                                  two_column_buf,
+                                                                  (uint16_t)output_ch,
+                                                                  output_shift,
+                                                                  output_mult,
+                                                                  out_offset,
+                                                                  (int16_t)out_activation_min,
+                                                                  (int16_t)out_activation_max,
+                                                                  (uint16_t)cols,
+                                                                  kernel_sums,
+                                                                  out);
+                    col = two_column_buf;
+                }
+            }
+        }
+
+        /* left-over because odd number of output pixels */
+        if (col != two_column_buf)
+        {
+            const q7_t *ker_a = packed_filter;
+
+            for (int32_t i = 0; i < output_ch; i++)
+            {
+                q31_t sum = kernel_sums[i];
+                const q15_t *ip_as_col = two_column_buf;
+                int32_t col_count = cols >> 2;
+
+                while (col_count)
+                {
+                    q31_t ker_a1, ker_a2;
+                    q31_t ip_b1, ip_b2;
+
+                    ker_a = read_and_pad_reordered(ker_a, &ker_a1, &ker_a2);
+
+                    ip_b1 = arm_nn_read_q15x2_ia(&ip_as_col);
+                    sum = __SMLAD(ker_a1, ip_b1, sum);
+                    ip_b2 = arm_nn_read_q15x2_ia(&ip_as_col);
+                    sum = __SMLAD(ker_a2, ip_b2, sum);
+
+                    col_count--;
+                }
+
+                sum = arm_nn_requantize(sum, output_mult[i], output_shift[i]);
+                sum += out_offset;
+                sum = MAX(sum, out_activation_min);
+                sum = MIN(sum, out_activation_max);
+                *out++ = (q7_t)sum;
+            }
+        }
+
+        input_data += input_dims->h * input_dims->w * input_ch;
+        output_data += output_y * output_x * output_ch;
+    }
+#else
+    /* Up to four raw s8 columns per matrix multiplication */
+    q7_t *col_buf = (q7_t *)ctx->buf;
+
+    for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        q7_t *out = output_data;
+        int32_t col_count = 0;
+
+        for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            for (int32_t i_out_x = 0; i_out_x < output_x; i_out_x++)
+            {
+                conv_packed_im2col_s8(input_data, input_dims, conv_params, filter_dims, i_out_y, i_out_x, cols,
+                                      col_buf + col_count * cols);
+
+                if (++col_count == 4)
+                {
+                    arm_nn_mat_mult_nt_t_s8(col_buf,
+                                            packed_filter,
+                                            kernel_sums,
+                                            out,
+                                            output_mult,
+                                            output_shift,
+                                            4,
+                                            output_ch,
+                                            cols,
+                                            0,
+                                            out_offset,
+                                            out_activation_min,
+                                            out_activation_max);
+                    out += 4 * output_ch;
+                    col_count = 0;
+                }
+            }
+        }
+
+        /* Left-over columns */
+        if (col_count != 0)
+        {
+            arm_nn_mat_mult_nt_t_s8(col_buf,
+                                    packed_filter,
+                                    kernel_sums,
+                                    out,
+                                    output_mult,
+                                    output_shift,
+                                    col_count,
+                                    output_ch,
+                                    cols,
+                                    0,
+                                    out_offset,
+                                    out_activation_min,
+                                    out_activation_max);
+        }
+
+        input_data += input_dims->h * input_dims->w * input_ch;
+        output_data += output_y * output_x * output_ch;
+    }
+#endif
+
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_convolve_packed_s8_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims)
+{
+    const int32_t cols = arm_nn_packed_s8_cols(filter_dims->h * filter_dims->w * input_dims->c);
+#if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    /* Two q15 columns, and an s8 staging column when C_IN is not a multiple of 4 */
+    return 2 * cols * (int32_t)sizeof(q15_t) + ((input_dims->c & 3) ? cols : 0);
+#else
+    return 4 * cols * (int32_t)sizeof(q7_t);
+#endif
+}
+
+/**
+ * @} end of NNConv group
+ */
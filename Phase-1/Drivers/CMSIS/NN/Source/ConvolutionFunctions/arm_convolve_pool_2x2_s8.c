@@ -0,0 +1,426 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_pool_2x2_s8.c
+ * Description:  s8 convolution with the activation clamp and a 2x2 stride 2
+ *               max or average pooling applied in the output loop: one
+ *               pooling window of conv outputs is live at a time
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * The conv outputs of a window go through the same matrix multiplication as
+ * in arm_convolve_s8(): four s8 columns and arm_nn_mat_mult_nt_t_s8() on MVE
+ * and on x86 from AVX2, two q15 columns and arm_nn_mat_mult_kernel_s8_s16()
+ * everywhere else, including the plain C build.
+ */
+#if defined(ARM_MATH_MVEI) || defined(ARM_MATH_X86)
+#define CONV_POOL_S8_COLUMNS
+#endif
+#if !defined(ARM_MATH_MVEI)
+#define CONV_POOL_Q15_COLUMNS
+#endif
+
+#if defined(CONV_POOL_S8_COLUMNS)
+/*
+ * One s8 im2col column. Padding taps hold -input_offset so that they read as
+ * zero once the offset is added back.
+ */
+static void conv_pool_im2col_s8(const q7_t *input_data,
+                                const cmsis_nn_dims *input_dims,
+                                const cmsis_nn_conv_params *conv_params,
+                                const cmsis_nn_dims *filter_dims,
+                                const int32_t i_out_y,
+                                const int32_t i_out_x,
+                                q7_t *col)
+{
+    const int32_t input_ch = input_dims->c;
+    const int32_t base_idx_y = conv_params->stride.h * i_out_y - conv_params->padding.h;
+    const int32_t base_idx_x = conv_params->stride.w * i_out_x - conv_params->padding.w;
+
+    for (int32_t i_ker_y = 0; i_ker_y < filter_dims->h; i_ker_y++)
+    {
+        const int32_t k_y = base_idx_y + conv_params->dilation.h * i_ker_y;
+
+        /* A kernel row that lies inside the input is one contiguous run of pixels */
+        if (conv_params->dilation.w == 1 && k_y >= 0 && k_y < input_dims->h && base_idx_x >= 0 &&
+            base_idx_x + filter_dims->w <= input_dims->w)
+        {
+            arm_memcpy_q7(col, input_data + (k_y * input_dims->w + base_idx_x) * input_ch, filter_dims->w * input_ch);
+            col += filter_dims->w * input_ch;
+            continue;
+        }
+
+        for (int32_t i_ker_x = 0; i_ker_x < filter_dims->w; i_ker_x++)
+        {
+            const int32_t k_x = base_idx_x + conv_params->dilation.w * i_ker_x;
+
+            if (k_y < 0 || k_y >= input_dims->h || k_x < 0 || k_x >= input_dims->w)
+            {
+                memset(col, (q7_t)-conv_params->input_offset, sizeof(q7_t) * input_ch);
+            }
+            else
+            {
+                arm_memcpy_q7(col, input_data + (k_y * input_dims->w + k_x) * input_ch, input_ch);
+            }
+            col += input_ch;
+        }
+    }
+}
+
+/*
+ * The [4, C_OUT] window of output pixel (i_out_y, i_out_x) through one
+ * matrix multiplication of its four s8 columns.
+ */
+static void conv_pool_window_s8(const q7_t *input_data,
+                                const cmsis_nn_dims *input_dims,
+                                const cmsis_nn_conv_params *conv_params,
+                                const cmsis_nn_per_channel_quant_params *quant_params,
+                                const cmsis_nn_dims *filter_dims,
+                                const q7_t *filter_data,
+                                const int32_t *bias_data,
+                                const int32_t output_ch,
+                                const int32_t i_out_y,
+                                const int32_t i_out_x,
+                                q7_t *col_buf,
+                                q7_t *window)
+{
+    const int32_t num_elem = filter_dims->h * filter_dims->w * input_dims->c;
+
+    for (int32_t i = 0; i < 4; i++)
+    {
+        conv_pool_im2col_s8(input_data,
+                            input_dims,
+                            conv_params,
+                            filter_dims,
+                            2 * i_out_y + (i >> 1),
+                            2 * i_out_x + (i & 1),
+                            col_buf + i * num_elem);
+    }
+    arm_nn_mat_mult_nt_t_s8(col_buf,
+                            filter_data,
+                            bias_data,
+                            window,
+                            quant_params->multiplier,
+                            quant_params->shift,
+                            4,
+                            output_ch,
+                            num_elem,
+                            conv_params->input_offset,
+                            conv_params->output_offset,
+                            conv_params->activation.min,
+                            conv_params->activation.max);
+}
+#endif
+
+#if defined(CONV_POOL_Q15_COLUMNS)
+/*
+ * One q15 im2col column with the input offset added, as arm_convolve_s8()
+ * builds it.
+ */
+static void conv_pool_im2col_q15(const q7_t *input_data,
+                                 const cmsis_nn_dims *input_dims,
+                                 const cmsis_nn_conv_params *conv_params,
+                                 const cmsis_nn_dims *filter_dims,
+                                 const int32_t i_out_y,
+                                 const int32_t i_out_x,
+                                 q15_t *col)
+{
+    const int32_t input_ch = input_dims->c;
+    const int32_t base_idx_y = conv_params->stride.h * i_out_y - conv_params->padding.h;
+    const int32_t base_idx_x = conv_params->stride.w * i_out_x - conv_params->padding.w;
+
+    for (int32_t i_ker_y = 0; i_ker_y < filter_dims->h; i_ker_y++)
+    {
+        for (int32_t i_ker_x = 0; i_ker_x < filter_dims->w; i_ker_x++)
+        {
+            const int32_t k_y = base_idx_y + conv_params->dilation.h * i_ker_y;
+            const int32_t k_x = base_idx_x + conv_params->dilation.w * i_ker_x;
+
+            if (k_y < 0 || k_y >= input_dims->h || k_x < 0 || k_x >= input_dims->w)
+            {
+                memset(col, 0, sizeof(q15_t) * input_ch);
+            }
+            else
+            {
+                arm_q7_to_q15_with_offset(input_data + (k_y * input_dims->w + k_x) * input_ch,
+                                          col,
+                                          input_ch,
+                                          (q15_t)conv_params->input_offset);
+            }
+            col += input_ch;
+        }
+    }
+}
+
+/*
+ * The [4, C_OUT] window of output pixel (i_out_y, i_out_x), one conv row of
+ * two q15 columns per arm_nn_mat_mult_kernel_s8_s16() call.
+ */
+static void conv_pool_window_q15(const q7_t *input_data,
+                                 const cmsis_nn_dims *input_dims,
+                                 const cmsis_nn_conv_params *conv_params,
+                                 const cmsis_nn_per_channel_quant_params *quant_params,
+                                 const cmsis_nn_dims *filter_dims,
+                                 const q7_t *filter_data,
+                                 const int32_t *bias_data,
+                                 const int32_t output_ch,
+                                 const int32_t i_out_y,
+                                 const int32_t i_out_x,
+                                 q15_t *two_column_buf,
+                                 q7_t *window)
+{
+    const int32_t num_elem = filter_dims->h * filter_dims->w * input_dims->c;
+
+    for (int32_t row = 0; row < 2; row++)
+    {
+        conv_pool_im2col_q15(input_data,
+                             input_dims,
+                             conv_params,
+                             filter_dims,
+                             2 * i_out_y + row,
+                             2 * i_out_x,
+                             two_column_buf);
+        conv_pool_im2col_q15(input_data,
+                             input_dims,
+                             conv_params,
+                             filter_dims,
+                             2 * i_out_y + row,
+                             2 * i_out_x + 1,
+                             two_column_buf + num_elem);
+        window = arm_nn_mat_mult_kernel_s8_s16(filter_data,
+                                               two_column_buf,
+                                               (uint16_t)output_ch,
+                                               quant_params->shift,
+                                               quant_params->multiplier,
+                                               conv_params->output_offset,
+                                               (int16_t)conv_params->activation.min,
+                                               (int16_t)conv_params->activation.max,
+                                               (uint16_t)num_elem,
+                                               bias_data,
+                                               window);
+    }
+}
+#endif
+
+/*
+ * The four conv outputs of a pooling window go to a [4, C_OUT] window
+ * buffer, already requantized and clamped, and are reduced from there.
+ * Requantization and the clamp are monotonic, so the max of the window is
+ * the one arm_max_pool_s8() would find in the full tensor; the average
+ * rounds like arm_avgpool_s8().
+ */
+static arm_status conv_pool_2x2_s8(const cmsis_nn_context *ctx,
+                                   const cmsis_nn_conv_params *conv_params,
+                                   const cmsis_nn_per_channel_quant_params *quant_params,
+                                   const cmsis_nn_dims *input_dims,
+                                   const q7_t *input_data,
+                                   const cmsis_nn_dims *filter_dims,
+                                   const q7_t *filter_data,
+                                   const int32_t *bias_data,
+                                   const cmsis_nn_dims *output_dims,
+                                   q7_t *output_data,
+                                   const int32_t average)
+{
+    const int32_t input_batches = input_dims->n;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_ch = output_dims->c;
+
+    if (ctx->buf == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* Four s8 columns or two q15 ones take the same bytes; the window follows them */
+    q7_t *window = (q7_t *)ctx->buf + 4 * filter_dims->h * filter_dims->w * input_dims->c;
+#if defined(ARM_MATH_X86)
+    const int32_t s8_columns = arm_nn_x86_get_level() >= ARM_NN_X86_LEVEL_AVX2;
+#endif
+
+    for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        q7_t *out = output_data;
+
+        for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            for (int32_t i_out_x = 0; i_out_x < output_x; i_out_x++)
+            {
+#if defined(ARM_MATH_X86)
+                if (s8_columns)
+#endif
+#if defined(CONV_POOL_S8_COLUMNS)
+                {
+                    conv_pool_window_s8(input_data,
+                                        input_dims,
+                                        conv_params,
+                                        quant_params,
+                                        filter_dims,
+                                        filter_data,
+                                        bias_data,
+                                        output_ch,
+                                        i_out_y,
+                                        i_out_x,
+                                        (q7_t *)ctx->buf,
+                                        window);
+                }
+#endif
+#if defined(ARM_MATH_X86)
+                else
+#endif
+#if defined(CONV_POOL_Q15_COLUMNS)
+                {
+                    conv_pool_window_q15(input_data,
+                                         input_dims,
+                                         conv_params,
+                                         quant_params,
+                                         filter_dims,
+                                         filter_data,
+                                         bias_data,
+                                         output_ch,
+                                         i_out_y,
+                                         i_out_x,
+                                         (q15_t *)ctx->buf,
+                                         window);
+                }
+#endif
+
+                /* Pool the window, channel by channel */
+                if (average)
+                {
+                    for (int32_t i = 0; i < output_ch; i++)
+                    {
+                        int32_t sum = window[i] + window[output_ch + i] + window[2 * output_ch + i] +
+                            window[3 * output_ch + i];
+                        sum = sum > 0 ? (sum + 2) / 4 : (sum - 2) / 4;
+                        *out++ = (q7_t)sum;
+                    }
+                }
+                else
+                {
+                    for (int32_t i = 0; i < output_ch; i++)
+                    {
+                        q7_t max = MAX(window[i], window[output_ch + i]);
+                        max = MAX(max, window[2 * output_ch + i]);
+                        max = MAX(max, window[3 * output_ch + i]);
+                        *out++ = max;
+                    }
+                }
+            }
+        }
+
+        input_data += input_dims->h * input_dims->w * input_dims->c;
+        output_data += output_y * output_x * output_ch;
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/*
+ * s8 convolution followed by 2x2 max pooling.
+ *
+ * Refer header file for details.
+ *
+ */
+
+arm_status arm_convolve_max_pool_2x2_s8(const cmsis_nn_context *ctx,
+                                        const cmsis_nn_conv_params *conv_params,
+                                        const cmsis_nn_per_channel_quant_params *quant_params,
+                                        const cmsis_nn_dims *input_dims,
+                                        const q7_t *input_data,
+                                        const cmsis_nn_dims *filter_dims,
+                                        const q7_t *filter_data,
+                                        const cmsis_nn_dims *bias_dims,
+                                        const int32_t *bias_data,
+                                        const cmsis_nn_dims *output_dims,
+                                        q7_t *output_data)
+{
+    (void)bias_dims;
+    return conv_pool_2x2_s8(ctx,
+                            conv_params,
+                            quant_params,
+                            input_dims,
+                            input_data,
+                            filter_dims,
+                            filter_data,
+                            bias_data,
+                            output_dims,
+                            output_data,
+                            0);
+}
+
+/*
+ * s8 convolution followed by 2x2 average pooling.
+ *
+ * Refer header file for details.
+ *
+ */
+
+arm_status arm_convolve_avg_pool_2x2_s8(const cmsis_nn_context *ctx,
+                                        const cmsis_nn_conv_params *conv_params,
+                                        const cmsis_nn_per_channel_quant_params *quant_params,
+                                        const cmsis_nn_dims *input_dims,
+                                        const q7_t *input_data,
+                                        const cmsis_nn_dims *filter_dims,
+                                        const q7_t *filter_data,
+                                        const cmsis_nn_dims *bias_dims,
+                                        const int32_t *bias_data,
+                                        const cmsis_nn_dims *output_dims,
+                                        q7_t *output_data)
+{
+    (void)bias_dims;
+    return conv_pool_2x2_s8(ctx,
+                            conv_params,
+                            quant_params,
+                            input_dims,
+                            input_data,
+                            filter_dims,
+                            filter_data,
+                            bias_data,
+                            output_dims,
+                            output_data,
+                            1);
+}
+
+int32_t arm_convolve_pool_2x2_s8_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                                 const cmsis_nn_dims *filter_dims,
+                                                 const cmsis_nn_dims *output_dims)
+{
+    const int32_t num_elem = filter_dims->h * filter_dims->w * input_dims->c;
+
+    /* Four s8 columns or two q15 ones, and the window */
+    return 4 * num_elem * (int32_t)sizeof(q7_t) + 4 * output_dims->c;
+}
+
+/**
+ * @} end of NNConv group
+ */
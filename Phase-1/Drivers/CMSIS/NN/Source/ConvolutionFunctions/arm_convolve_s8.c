@@ -90,6 +90,91 @@ arm_status arm_convolve_s8(const cmsis_nn_context *ctx,
     int32_t *output_mult = quant_params->multiplier;
     int32_t *output_shift = quant_params->shift;
 
+#if defined(ARM_MATH_X86)
+    if (arm_nn_x86_get_level() >= ARM_NN_X86_LEVEL_AVX2)
+    {
+        /* s8 im2col instead of q15: the buffer sized for two q15 columns holds four s8 ones, which
+           arm_nn_mat_mul_core_4x_s8 multiplies against all the filters at once. Padding is stored as
+           -input_offset so that it reads as zero once the offset is added back. */
+        q7_t *im2col_buf = (q7_t *)buffer_a;
+        const int32_t num_elem = kernel_x * kernel_y * input_ch;
+        const int32_t dilation_x = conv_params->dilation.w;
+        const int32_t dilation_y = conv_params->dilation.h;
+
+        for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+        {
+            q7_t *out = output_data;
+            q7_t *col = im2col_buf;
+            int32_t col_count = 0;
+
+            for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y++)
+            {
+                for (int32_t i_out_x = 0; i_out_x < output_x; i_out_x++)
+                {
+                    const int32_t base_idx_y = stride_y * i_out_y - pad_y;
+                    const int32_t base_idx_x = stride_x * i_out_x - pad_x;
+
+                    for (int32_t i_ker_y = 0; i_ker_y < kernel_y; i_ker_y++)
+                    {
+                        for (int32_t i_ker_x = 0; i_ker_x < kernel_x; i_ker_x++)
+                        {
+                            const int32_t k_y = base_idx_y + dilation_y * i_ker_y;
+                            const int32_t k_x = base_idx_x + dilation_x * i_ker_x;
+
+                            if (k_y < 0 || k_y >= input_y || k_x < 0 || k_x >= input_x)
+                            {
+                                memset(col, (q7_t)-input_offset, sizeof(q7_t) * input_ch);
+                            }
+                            else
+                            {
+                                arm_memcpy_q7(col, input_data + (k_y * input_x + k_x) * input_ch, input_ch);
+                            }
+                            col += input_ch;
+                        }
+                    }
+
+                    if (++col_count == 4)
+                    {
+                        out = arm_nn_mat_mul_core_4x_s8(num_elem,
+                                                        num_elem,
+                                                        im2col_buf,
+                                                        filter_data,
+                                                        output_ch,
+                                                        conv_params,
+                                                        quant_params,
+                                                        bias_data,
+                                                        out);
+                        col = im2col_buf;
+                        col_count = 0;
+                    }
+                }
+            }
+
+            /* Left-over columns */
+            if (col_count != 0)
+            {
+                arm_nn_mat_mult_nt_t_s8(im2col_buf,
+                                        filter_data,
+                                        bias_data,
+                                        out,
+                                        output_mult,
+                                        output_shift,
+                                        col_count,
+                                        output_ch,
+                                        num_elem,
+                                        input_offset,
+                                        out_offset,
+                                        out_activation_min,
+                                        out_activation_max);
+            }
+
+            input_data += (input_x * input_y * input_ch);
+            output_data += (output_x * output_y * output_ch);
+        }
+        return ARM_MATH_SUCCESS;
+    }
+#endif
+
     int i_batch;
     for (i_batch = 0; i_batch < input_batches; i_batch++)
     {
@@ -92,6 +92,23 @@ arm_status arm_depthwise_conv_3x3_s8(const cmsis_nn_context *ctx,
         return ARM_MATH_ARGUMENT_ERROR;
     }
 
+#if defined(ARM_MATH_X86)
+    /* The SIMD kernels honour dilation, this function assumes 1 */
+    const int32_t x86_dilated = dw_conv_params->dilation.w != 1 || dw_conv_params->dilation.h != 1;
+    if (!x86_dilated && arm_nn_x86_get_level() >= ARM_NN_X86_LEVEL_AVX512_VNNI)
+    {
+        arm_depthwise_conv_s8_avx512(
+            dw_conv_params, quant_params, input_dims, input, filter_dims, kernel, bias, output_dims, output);
+        return ARM_MATH_SUCCESS;
+    }
+    if (!x86_dilated && arm_nn_x86_get_level() >= ARM_NN_X86_LEVEL_AVX2)
+    {
+        arm_depthwise_conv_s8_avx2(
+            dw_conv_params, quant_params, input_dims, input, filter_dims, kernel, bias, output_dims, output);
+        return ARM_MATH_SUCCESS;
+    }
+#endif
+
     for (int32_t in_h = -pad_y, out_h = 0, out_idx = 0; out_h < output_y; in_h += stride_y, ++out_h)
     {
         for (int32_t in_w = -pad_x, out_w = 0, ker_h_start = MAX(0, -in_h); out_w < output_x; in_w += stride_x, ++out_w)
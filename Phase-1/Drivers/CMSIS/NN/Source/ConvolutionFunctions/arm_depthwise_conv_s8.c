@@ -281,6 +281,23 @@ arm_status arm_depthwise_conv_s8(const cmsis_nn_context *ctx,
     (void)bias_dims;
     (void)ctx;
 
+#if defined(ARM_MATH_X86)
+    if (dw_conv_params->ch_mult == 1 && arm_nn_x86_get_level() >= ARM_NN_X86_LEVEL_AVX2)
+    {
+        if (arm_nn_x86_get_level() >= ARM_NN_X86_LEVEL_AVX512_VNNI)
+        {
+            arm_depthwise_conv_s8_avx512(
+                dw_conv_params, quant_params, input_dims, input, filter_dims, kernel, bias, output_dims, output);
+        }
+        else
+        {
+            arm_depthwise_conv_s8_avx2(
+                dw_conv_params, quant_params, input_dims, input, filter_dims, kernel, bias, output_dims, output);
+        }
+        return ARM_MATH_SUCCESS;
+    }
+#endif
+
     if (dw_conv_params->ch_mult % 4 == 0 && input_dims->n == 1 && dw_conv_params->dilation.w == 1 &&
         dw_conv_params->dilation.h == 1)
     {
@@ -0,0 +1,108 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_packed_s8.c
+ * Description:  s8 fully connected layer on weights packed offline by
+ *               arm_nn_pack_weights_s8()
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/*
+ * S8 fully connected layer on packed weights: the input offset is in the
+ * kernel sums, and every row is a whole number of 4-element groups.
+ *
+ * Refer header file for details.
+ *
+ */
+
+arm_status arm_fully_connected_packed_s8(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_fc_params *fc_params,
+                                         const cmsis_nn_per_tensor_quant_params *quant_params,
+                                         const cmsis_nn_dims *input_dims,
+                                         const q7_t *input,
+                                         const cmsis_nn_dims *filter_dims,
+                                         const q7_t *packed_kernel,
+                                         const int32_t *kernel_sums,
+                                         const cmsis_nn_dims *output_dims,
+                                         q7_t *output)
+{
+    const int32_t depth = filter_dims->n;
+    const int32_t cols = arm_nn_packed_s8_cols(depth);
+    q7_t *padded = (q7_t *)ctx->buf;
+    int32_t batch_cnt = input_dims->n;
+
+    if (cols != depth && padded == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    while (batch_cnt)
+    {
+        const q7_t *lhs = input;
+
+        if (cols != depth)
+        {
+            arm_memcpy_q7(padded, input, depth);
+            memset(padded + depth, 0, (size_t)(cols - depth));
+            lhs = padded;
+        }
+
+        arm_nn_vec_mat_mult_t_s8(lhs,
+                                 packed_kernel,
+                                 kernel_sums,
+                                 output,
+                                 0,
+                                 0,
+                                 fc_params->output_offset,
+                                 quant_params->multiplier,
+                                 quant_params->shift,
+                                 cols,
+                                 output_dims->c,
+                                 fc_params->activation.min,
+                                 fc_params->activation.max,
+                                 1L);
+        input += depth;
+        output += output_dims->c;
+        batch_cnt--;
+    }
+    return (ARM_MATH_SUCCESS);
+}
+
+int32_t arm_fully_connected_packed_s8_get_buffer_size(const cmsis_nn_dims *filter_dims)
+{
+    const int32_t cols = arm_nn_packed_s8_cols(filter_dims->n);
+    return (cols != filter_dims->n) ? cols * (int32_t)sizeof(q7_t) : 0;
+}
+
+/**
+ * @} end of FC group
+ */
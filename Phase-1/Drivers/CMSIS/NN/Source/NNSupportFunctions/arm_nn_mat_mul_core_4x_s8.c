@@ -118,6 +118,75 @@ int8_t *arm_nn_mat_mul_core_4x_s8(const int32_t row_elements,
     }
 
     return output + (3 * out_ch);
+#elif defined(ARM_MATH_X86)
+    const arm_nn_x86_level x86_level = arm_nn_x86_get_level();
+    if (x86_level >= ARM_NN_X86_LEVEL_AVX512_VNNI)
+    {
+        arm_nn_mat_mult_nt_t_s8_avx512(row_base,
+                                       offset,
+                                       col_base_ref,
+                                       bias,
+                                       output,
+                                       quant_params->multiplier,
+                                       quant_params->shift,
+                                       4,
+                                       out_ch,
+                                       row_elements,
+                                       conv_params->input_offset,
+                                       conv_params->output_offset,
+                                       conv_params->activation.min,
+                                       conv_params->activation.max);
+        return output + 4 * out_ch;
+    }
+    if (x86_level >= ARM_NN_X86_LEVEL_AVX2)
+    {
+        arm_nn_mat_mult_nt_t_s8_avx2(row_base,
+                                     offset,
+                                     col_base_ref,
+                                     bias,
+                                     output,
+                                     quant_params->multiplier,
+                                     quant_params->shift,
+                                     4,
+                                     out_ch,
+                                     row_elements,
+                                     conv_params->input_offset,
+                                     conv_params->output_offset,
+                                     conv_params->activation.min,
+                                     conv_params->activation.max);
+        return output + 4 * out_ch;
+    }
+
+    /* Reference for the scalar level, so the SIMD paths can be compared */
+    for (int32_t i = 0; i < out_ch; i++)
+    {
+        const int8_t *col_base = col_base_ref + i * row_elements;
+        int32_t sum_col = 0;
+        int32_t acc[4] = {0, 0, 0, 0};
+
+        for (int32_t j = 0; j < row_elements; j++)
+        {
+            sum_col += col_base[j];
+            for (int32_t r = 0; r < 4; r++)
+            {
+                acc[r] += row_base[r * offset + j] * col_base[j];
+            }
+        }
+        sum_col *= conv_params->input_offset;
+        if (bias)
+        {
+            sum_col += bias[i];
+        }
+        for (int32_t r = 0; r < 4; r++)
+        {
+            int32_t res = arm_nn_requantize(acc[r] + sum_col, quant_params->multiplier[i], quant_params->shift[i]);
+            res += conv_params->output_offset;
+            res = MAX(res, conv_params->activation.min);
+            res = MIN(res, conv_params->activation.max);
+            output[r * out_ch + i] = (int8_t)res;
+        }
+    }
+    return output + 4 * out_ch;
 #else
     (void)row_elements;
     (void)offset;
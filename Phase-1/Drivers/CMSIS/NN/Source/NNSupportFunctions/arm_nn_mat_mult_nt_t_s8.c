@@ -59,6 +59,45 @@ arm_status arm_nn_mat_mult_nt_t_s8(const q7_t *lhs,
                                    const int32_t activation_min,
                                    const int32_t activation_max)
 {
+#if defined(ARM_MATH_X86)
+    const arm_nn_x86_level x86_level = arm_nn_x86_get_level();
+    if (x86_level >= ARM_NN_X86_LEVEL_AVX512_VNNI)
+    {
+        arm_nn_mat_mult_nt_t_s8_avx512(lhs,
+                                       rhs_cols,
+                                       rhs,
+                                       bias,
+                                       dst,
+                                       dst_multipliers,
+                                       dst_shifts,
+                                       lhs_rows,
+                                       rhs_rows,
+                                       rhs_cols,
+                                       lhs_offset,
+                                       dst_offset,
+                                       activation_min,
+                                       activation_max);
+        return ARM_MATH_SUCCESS;
+    }
+    if (x86_level >= ARM_NN_X86_LEVEL_AVX2)
+    {
+        arm_nn_mat_mult_nt_t_s8_avx2(lhs,
+                                     rhs_cols,
+                                     rhs,
+                                     bias,
+                                     dst,
+                                     dst_multipliers,
+                                     dst_shifts,
+                                     lhs_rows,
+                                     rhs_rows,
+                                     rhs_cols,
+                                     lhs_offset,
+                                     dst_offset,
+                                     activation_min,
+                                     activation_max);
+        return ARM_MATH_SUCCESS;
+    }
+#endif
 #if defined(ARM_MATH_DSP)
     const int32_t off0 = rhs_cols - 4;
 
@@ -0,0 +1,80 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_pack_weights_s8.c
+ * Description:  Packs s8 convolution / fully connected weights for the
+ *               *_packed_s8 kernels: rows padded to a multiple of 4 and
+ *               the input offset folded into per-row kernel sums
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+int32_t arm_nn_packed_s8_cols(const int32_t cols) { return (cols + 3) & ~3; }
+
+/*
+ * sum((x + input_offset) * w) + bias = sum(x * w) + (bias + input_offset * sum(w)):
+ * the second term only depends on the weights, so it is computed here once.
+ *
+ * Refer header file for details.
+ *
+ */
+void arm_nn_pack_weights_s8(const q7_t *weights,
+                            const int32_t *bias,
+                            const int32_t rows,
+                            const int32_t cols,
+                            const int32_t input_offset,
+                            q7_t *packed_weights,
+                            int32_t *kernel_sums)
+{
+    const int32_t packed_cols = arm_nn_packed_s8_cols(cols);
+
+    for (int32_t i = 0; i < rows; i++)
+    {
+        const q7_t *row = weights + i * cols;
+        q7_t *dst = packed_weights + i * packed_cols;
+        int32_t sum = 0;
+
+        for (int32_t j = 0; j < cols; j++)
+        {
+            sum += row[j];
+        }
+        memcpy(dst, row, (size_t)cols);
+        memset(dst + cols, 0, (size_t)(packed_cols - cols));
+
+        kernel_sums[i] = (bias ? bias[i] : 0) + input_offset * sum;
+    }
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
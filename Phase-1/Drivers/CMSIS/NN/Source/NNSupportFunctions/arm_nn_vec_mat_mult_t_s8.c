@@ -61,6 +61,43 @@ arm_status arm_nn_vec_mat_mult_t_s8(const q7_t *lhs,
                                     const int32_t address_offset)
 {
     (void)rhs_offset;
+#if defined(ARM_MATH_X86)
+    const arm_nn_x86_level x86_level = arm_nn_x86_get_level();
+    if (x86_level >= ARM_NN_X86_LEVEL_AVX512_VNNI)
+    {
+        arm_nn_vec_mat_mult_t_s8_avx512(lhs,
+                                        rhs,
+                                        bias,
+                                        dst,
+                                        lhs_offset,
+                                        dst_offset,
+                                        dst_multiplier,
+                                        dst_shift,
+                                        rhs_cols,
+                                        rhs_rows,
+                                        activation_min,
+                                        activation_max,
+                                        address_offset);
+        return ARM_MATH_SUCCESS;
+    }
+    if (x86_level >= ARM_NN_X86_LEVEL_AVX2)
+    {
+        arm_nn_vec_mat_mult_t_s8_avx2(lhs,
+                                      rhs,
+                                      bias,
+                                      dst,
+                                      lhs_offset,
+                                      dst_offset,
+                                      dst_multiplier,
+                                      dst_shift,
+                                      rhs_cols,
+                                      rhs_rows,
+                                      activation_min,
+                                      activation_max,
+                                      address_offset);
+        return ARM_MATH_SUCCESS;
+    }
+#endif
 #if defined(ARM_MATH_MVEI)
     const int32_t row_loop_cnt = rhs_rows / 3;
     const uint32x4_t address_offset_array = {0, address_offset, address_offset * 2, address_offset * 3};
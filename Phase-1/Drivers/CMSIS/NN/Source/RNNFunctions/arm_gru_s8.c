@@ -0,0 +1,183 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_gru_s8.c
+ * Description:  s8 GRU cell with the hidden state kept at Q0.15: update and
+ *               reset gates from one vector by matrix product over
+ *               [input, hidden], the candidate from two more
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nn_tables.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup RNN
+ * @{
+ */
+
+/*
+ * s8 GRU cell, one step.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_gru_step_s8(const cmsis_nn_context *ctx,
+                           const cmsis_nn_gru_weights *weights,
+                           cmsis_nn_rnn_state *state,
+                           const cmsis_nn_dims *input_dims,
+                           const q7_t *input_data,
+                           const cmsis_nn_dims *output_dims,
+                           q7_t *output_data)
+{
+    const int32_t input_size = input_dims->c;
+    const int32_t hidden_size = output_dims->c;
+    q7_t *gates = (q7_t *)ctx->buf;
+    q7_t *cand_input = gates + 2 * hidden_size;
+    q7_t *cand_recurrent = cand_input + hidden_size;
+    q15_t *cand = (q15_t *)(cand_recurrent + hidden_size);
+    q7_t *hidden = state->input_hidden + input_size;
+    q15_t *hidden_q15 = state->cell;
+
+    if (gates == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* Update and reset gates over [x, h], the candidate's input and recurrent products apart */
+    arm_memcpy_q7(state->input_hidden, input_data, input_size);
+    arm_nn_vec_mat_mult_t_s8(state->input_hidden,
+                             weights->gate_weights,
+                             weights->gate_kernel_sums,
+                             gates,
+                             0,
+                             0,
+                             0,
+                             weights->gate_multiplier,
+                             weights->gate_shift,
+                             input_size + hidden_size,
+                             2 * hidden_size,
+                             NN_Q7_MIN,
+                             NN_Q7_MAX,
+                             1L);
+    arm_nn_vec_mat_mult_t_s8(state->input_hidden,
+                             weights->input_weights,
+                             weights->input_kernel_sums,
+                             cand_input,
+                             0,
+                             0,
+                             0,
+                             weights->input_multiplier,
+                             weights->input_shift,
+                             input_size,
+                             hidden_size,
+                             NN_Q7_MIN,
+                             NN_Q7_MAX,
+                             1L);
+    arm_nn_vec_mat_mult_t_s8(hidden,
+                             weights->recurrent_weights,
+                             weights->recurrent_bias,
+                             cand_recurrent,
+                             0,
+                             0,
+                             0,
+                             weights->recurrent_multiplier,
+                             weights->recurrent_shift,
+                             hidden_size,
+                             hidden_size,
+                             NN_Q7_MIN,
+                             NN_Q7_MAX,
+                             1L);
+
+    /* n = tanh(Wn x + r * Un h): Q3.4 << 8 plus Q0.15 * Q3.4 >> 7, both Q3.12 */
+    for (int32_t i = 0; i < hidden_size; i++)
+    {
+        const q31_t reset_gate = sigmoidTable_q15[(uint8_t)gates[hidden_size + i]];
+        q31_t pre = ((q31_t)cand_input[i] << 8) + ((reset_gate * cand_recurrent[i] + (1 << 6)) >> 7);
+
+        cand[i] = (q15_t)CLAMP(pre, NN_Q15_MAX, NN_Q15_MIN);
+    }
+    arm_nn_activations_direct_q15(cand, (uint16_t)hidden_size, 3, ARM_TANH);
+
+    /* h = n + z * (h - n) at Q0.15; the s8 copy (Q0.7) is the output and the next step's input */
+    for (int32_t i = 0; i < hidden_size; i++)
+    {
+        const q31_t update_gate = sigmoidTable_q15[(uint8_t)gates[i]];
+        const q31_t n = cand[i];
+        q31_t h = n + ((update_gate * (hidden_q15[i] - n) + (1 << 14)) >> 15);
+
+        h = CLAMP(h, NN_Q15_MAX, NN_Q15_MIN);
+        hidden_q15[i] = (q15_t)h;
+        h = (h + (1 << 7)) >> 8;
+        h = MIN(h, NN_Q7_MAX);
+        hidden[i] = (q7_t)h;
+        output_data[i] = (q7_t)h;
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/*
+ * s8 GRU layer over a sequence.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_gru_s8(const cmsis_nn_context *ctx,
+                      const cmsis_nn_gru_weights *weights,
+                      cmsis_nn_rnn_state *state,
+                      const cmsis_nn_dims *input_dims,
+                      const q7_t *input_data,
+                      const cmsis_nn_dims *output_dims,
+                      q7_t *output_data)
+{
+    if (input_dims->n != output_dims->n)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (int32_t t = 0; t < input_dims->n; t++)
+    {
+        const arm_status status =
+            arm_gru_step_s8(ctx, weights, state, input_dims, input_data, output_dims, output_data);
+        if (status != ARM_MATH_SUCCESS)
+        {
+            return status;
+        }
+        input_data += input_dims->c;
+        output_data += output_dims->c;
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_gru_s8_get_buffer_size(const cmsis_nn_dims *output_dims)
+{
+    /* Two gate vectors, the candidate's two products (s8) and the candidate (q15) */
+    return 4 * output_dims->c * (int32_t)sizeof(q7_t) + output_dims->c * (int32_t)sizeof(q15_t);
+}
+
+/**
+ * @} end of RNN group
+ */
@@ -0,0 +1,153 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_lstm_s8.c
+ * Description:  s8 LSTM cell with s16 (Q4.11) cell state: all four gates from one
+ *               vector by matrix product over [input, hidden]
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nn_tables.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup RNN
+ * @{
+ */
+
+/*
+ * s8 LSTM cell, one step.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_lstm_step_s8(const cmsis_nn_context *ctx,
+                            const cmsis_nn_lstm_weights *weights,
+                            cmsis_nn_rnn_state *state,
+                            const cmsis_nn_dims *input_dims,
+                            const q7_t *input_data,
+                            const cmsis_nn_dims *output_dims,
+                            q7_t *output_data)
+{
+    const int32_t input_size = input_dims->c;
+    const int32_t hidden_size = output_dims->c;
+    q7_t *gates = (q7_t *)ctx->buf;
+    q15_t *cell_tanh = (q15_t *)(gates + 4 * hidden_size);
+    q7_t *hidden = state->input_hidden + input_size;
+    q15_t *cell = state->cell;
+
+    if (gates == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* Pre-activations of all gates, s8 Q3.4 */
+    arm_memcpy_q7(state->input_hidden, input_data, input_size);
+    arm_nn_vec_mat_mult_t_s8(state->input_hidden,
+                             weights->weights,
+                             weights->kernel_sums,
+                             gates,
+                             0,
+                             0,
+                             0,
+                             weights->gate_multiplier,
+                             weights->gate_shift,
+                             input_size + hidden_size,
+                             4 * hidden_size,
+                             NN_Q7_MIN,
+                             NN_Q7_MAX,
+                             1L);
+
+    /* c = f * c + i * g at Q4.26, rounded to Q4.11. tanh takes Q3.12, where +-8 already saturates */
+    for (int32_t i = 0; i < hidden_size; i++)
+    {
+        const q31_t in_gate = sigmoidTable_q15[(uint8_t)gates[i]];
+        const q31_t forget_gate = sigmoidTable_q15[(uint8_t)gates[hidden_size + i]];
+        const q31_t cell_gate = tanhTable_q15[(uint8_t)gates[2 * hidden_size + i]];
+        q31_t c = (forget_gate * cell[i] + ((in_gate * cell_gate) >> 4) + (1 << 14)) >> 15;
+
+        c = CLAMP(c, NN_Q15_MAX, NN_Q15_MIN);
+        cell[i] = (q15_t)c;
+        c = c * 2;
+        cell_tanh[i] = (q15_t)CLAMP(c, NN_Q15_MAX, NN_Q15_MIN);
+    }
+
+    /* tanh(c) with the interpolated q15 table, then h = o * tanh(c) at Q0.30, rounded to Q0.7 */
+    arm_nn_activations_direct_q15(cell_tanh, (uint16_t)hidden_size, 3, ARM_TANH);
+    for (int32_t i = 0; i < hidden_size; i++)
+    {
+        const q31_t out_gate = sigmoidTable_q15[(uint8_t)gates[3 * hidden_size + i]];
+        q31_t h = (out_gate * cell_tanh[i] + (1 << 22)) >> 23;
+
+        h = CLAMP(h, NN_Q7_MAX, NN_Q7_MIN);
+        hidden[i] = (q7_t)h;
+        output_data[i] = (q7_t)h;
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/*
+ * s8 LSTM layer over a sequence.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_lstm_s8(const cmsis_nn_context *ctx,
+                       const cmsis_nn_lstm_weights *weights,
+                       cmsis_nn_rnn_state *state,
+                       const cmsis_nn_dims *input_dims,
+                       const q7_t *input_data,
+                       const cmsis_nn_dims *output_dims,
+                       q7_t *output_data)
+{
+    if (input_dims->n != output_dims->n)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (int32_t t = 0; t < input_dims->n; t++)
+    {
+        const arm_status status =
+            arm_lstm_step_s8(ctx, weights, state, input_dims, input_data, output_dims, output_data);
+        if (status != ARM_MATH_SUCCESS)
+        {
+            return status;
+        }
+        input_data += input_dims->c;
+        output_data += output_dims->c;
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_lstm_s8_get_buffer_size(const cmsis_nn_dims *output_dims)
+{
+    /* Four s8 gate vectors and tanh(c) */
+    return 4 * output_dims->c * (int32_t)sizeof(q7_t) + output_dims->c * (int32_t)sizeof(q15_t);
+}
+
+/**
+ * @} end of RNN group
+ */
@@ -0,0 +1,76 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_rnn_state_s8.c
+ * Description:  State reset and kernel sums shared by the s8 LSTM and GRU
+ *               cells
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup RNN
+ * @{
+ */
+
+/*
+ * Only the input part of a row sees the input offset: the hidden state has
+ * zero point 0.
+ *
+ * Refer header file for details.
+ *
+ */
+void arm_rnn_kernel_sums_s8(const q7_t *weights,
+                            const int32_t *bias,
+                            const int32_t rows,
+                            const int32_t input_size,
+                            const int32_t row_cols,
+                            const int32_t input_offset,
+                            int32_t *kernel_sums)
+{
+    for (int32_t i = 0; i < rows; i++)
+    {
+        const q7_t *row = weights + i * row_cols;
+        int32_t sum = 0;
+
+        for (int32_t j = 0; j < input_size; j++)
+        {
+            sum += row[j];
+        }
+        kernel_sums[i] = (bias ? bias[i] : 0) + input_offset * sum;
+    }
+}
+
+void arm_rnn_state_s8_reset(cmsis_nn_rnn_state *state, const int32_t input_size, const int32_t hidden_size)
+{
+    memset(state->input_hidden, 0, (size_t)(input_size + hidden_size));
+    memset(state->cell, 0, (size_t)hidden_size * sizeof(q15_t));
+}
+
+/**
+ * @} end of RNN group
+ */
@@ -0,0 +1,336 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_depthwise_conv_s8_x86.c
+ * Description:  AVX2 and AVX-512 s8 depthwise convolution, ch_mult == 1
+ *
+ * Target Processor:  x86-64 hosts
+ * -------------------------------------------------------------------- */
+
+#include "arm_nn_x86_simd.h"
+
+#if defined(ARM_MATH_X86)
+
+/**
+ * @ingroup groupNNX86
+ */
+
+/**
+ * @addtogroup groupNNX86
+ * @{
+ */
+
+/*
+ * Filter taps of one output pixel that fall inside the input, as in the
+ * generic reference (dilation included).
+ */
+static void depthwise_tap_range(const int32_t base,
+                                const int32_t dilation,
+                                const int32_t kernel,
+                                const int32_t input,
+                                int32_t *start,
+                                int32_t *end)
+{
+    if (dilation > 1)
+    {
+        *start = MAX(0, (-base + dilation - 1) / dilation);
+        *end = MIN(kernel, (input - base + dilation - 1) / dilation);
+    }
+    else
+    {
+        *start = MAX(0, -base);
+        *end = MIN(kernel, input - base);
+    }
+}
+
+/*
+ * Plain C for the channels left over from the vector blocks.
+ */
+static void depthwise_channel_tail(const q7_t *input,
+                                   const q7_t *kernel,
+                                   const int32_t *bias,
+                                   q7_t *output,
+                                   const int32_t *output_mult,
+                                   const int32_t *output_shift,
+                                   const int32_t first_ch,
+                                   const int32_t channels,
+                                   const int32_t input_x,
+                                   const int32_t kernel_x,
+                                   const int32_t base_x,
+                                   const int32_t base_y,
+                                   const int32_t dilation_x,
+                                   const int32_t dilation_y,
+                                   const int32_t ker_x_start,
+                                   const int32_t ker_x_end,
+                                   const int32_t ker_y_start,
+                                   const int32_t ker_y_end,
+                                   const cmsis_nn_dw_conv_params *dw_conv_params)
+{
+    for (int32_t ch = first_ch; ch < channels; ch++)
+    {
+        int32_t acc = bias ? bias[ch] : 0;
+
+        for (int32_t ky = ker_y_start; ky < ker_y_end; ky++)
+        {
+            const int32_t idx_y = base_y + dilation_y * ky;
+            for (int32_t kx = ker_x_start; kx < ker_x_end; kx++)
+            {
+                const int32_t idx_x = base_x + dilation_x * kx;
+                acc += (input[(idx_y * input_x + idx_x) * channels + ch] + dw_conv_params->input_offset) *
+                    kernel[(ky * kernel_x + kx) * channels + ch];
+            }
+        }
+        acc = arm_nn_requantize(acc, output_mult[ch], output_shift[ch]);
+        acc += dw_conv_params->output_offset;
+        acc = MAX(acc, dw_conv_params->activation.min);
+        acc = MIN(acc, dw_conv_params->activation.max);
+        output[ch] = (q7_t)acc;
+    }
+}
+
+/*
+ * AVX2: 16 channels per block. (input + input_offset) * kernel fits int16,
+ * so each tap is one 16-bit multiply, widened into two int32 accumulators.
+ */
+ARM_NN_X86_TARGET_AVX2
+void arm_depthwise_conv_s8_avx2(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                const cmsis_nn_per_channel_quant_params *quant_params,
+                                const cmsis_nn_dims *input_dims,
+                                const q7_t *input,
+                                const cmsis_nn_dims *filter_dims,
+                                const q7_t *kernel,
+                                const int32_t *bias,
+                                const cmsis_nn_dims *output_dims,
+                                q7_t *output)
+{
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t channels = input_dims->c;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t dilation_x = dw_conv_params->dilation.w;
+    const int32_t dilation_y = dw_conv_params->dilation.h;
+    const int32_t *output_mult = quant_params->multiplier;
+    const int32_t *output_shift = quant_params->shift;
+    const int32_t ch_end = channels & ~0xF;
+    const __m256i offset = _mm256_set1_epi16((int16_t)dw_conv_params->input_offset);
+
+    for (int32_t i_batch = 0; i_batch < input_dims->n; i_batch++)
+    {
+        for (int32_t i_out_y = 0; i_out_y < output_dims->h; i_out_y++)
+        {
+            const int32_t base_y = i_out_y * dw_conv_params->stride.h - dw_conv_params->padding.h;
+            int32_t ker_y_start, ker_y_end;
+            depthwise_tap_range(base_y, dilation_y, kernel_y, input_y, &ker_y_start, &ker_y_end);
+
+            for (int32_t i_out_x = 0; i_out_x < output_dims->w; i_out_x++)
+            {
+                const int32_t base_x = i_out_x * dw_conv_params->stride.w - dw_conv_params->padding.w;
+                int32_t ker_x_start, ker_x_end;
+                depthwise_tap_range(base_x, dilation_x, kernel_x, input_x, &ker_x_start, &ker_x_end);
+
+                for (int32_t ch = 0; ch < ch_end; ch += 16)
+                {
+                    __m256i acc_lo, acc_hi;
+                    if (bias)
+                    {
+                        acc_lo = _mm256_loadu_si256((const __m256i *)(bias + ch));
+                        acc_hi = _mm256_loadu_si256((const __m256i *)(bias + ch + 8));
+                    }
+                    else
+                    {
+                        acc_lo = _mm256_setzero_si256();
+                        acc_hi = _mm256_setzero_si256();
+                    }
+
+                    for (int32_t ky = ker_y_start; ky < ker_y_end; ky++)
+                    {
+                        const int32_t idx_y = base_y + dilation_y * ky;
+                        for (int32_t kx = ker_x_start; kx < ker_x_end; kx++)
+                        {
+                            const int32_t idx_x = base_x + dilation_x * kx;
+                            const q7_t *in_ptr = input + (idx_y * input_x + idx_x) * channels + ch;
+                            const q7_t *ker_ptr = kernel + (ky * kernel_x + kx) * channels + ch;
+
+                            const __m256i x =
+                                _mm256_add_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)in_ptr)), offset);
+                            const __m256i w = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)ker_ptr));
+                            const __m256i p = _mm256_mullo_epi16(x, w);
+                            acc_lo = _mm256_add_epi32(acc_lo, _mm256_cvtepi16_epi32(_mm256_castsi256_si128(p)));
+                            acc_hi = _mm256_add_epi32(acc_hi, _mm256_cvtepi16_epi32(_mm256_extracti128_si256(p, 1)));
+                        }
+                    }
+
+                    acc_lo = arm_nn_requantize_avx2(acc_lo,
+                                                    _mm256_loadu_si256((const __m256i *)(output_mult + ch)),
+                                                    _mm256_loadu_si256((const __m256i *)(output_shift + ch)));
+                    acc_hi = arm_nn_requantize_avx2(acc_hi,
+                                                    _mm256_loadu_si256((const __m256i *)(output_mult + ch + 8)),
+                                                    _mm256_loadu_si256((const __m256i *)(output_shift + ch + 8)));
+                    acc_lo = arm_nn_offset_clamp_avx2(acc_lo,
+                                                      dw_conv_params->output_offset,
+                                                      dw_conv_params->activation.min,
+                                                      dw_conv_params->activation.max);
+                    acc_hi = arm_nn_offset_clamp_avx2(acc_hi,
+                                                      dw_conv_params->output_offset,
+                                                      dw_conv_params->activation.min,
+                                                      dw_conv_params->activation.max);
+                    const __m256i s16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(acc_lo, acc_hi), 0xD8);
+                    const __m128i s8 =
+                        _mm_packs_epi16(_mm256_castsi256_si128(s16), _mm256_extracti128_si256(s16, 1));
+                    _mm_storeu_si128((__m128i *)(output + ch), s8);
+                }
+
+                depthwise_channel_tail(input,
+                                       kernel,
+                                       bias,
+                                       output,
+                                       output_mult,
+                                       output_shift,
+                                       ch_end,
+                                       channels,
+                                       input_x,
+                                       kernel_x,
+                                       base_x,
+                                       base_y,
+                                       dilation_x,
+                                       dilation_y,
+                                       ker_x_start,
+                                       ker_x_end,
+                                       ker_y_start,
+                                       ker_y_end,
+                                       dw_conv_params);
+                output += channels;
+            }
+        }
+        input += input_x * input_y * channels;
+    }
+}
+
+/*
+ * AVX-512: 32 channels per block, the last block masked so no channel is
+ * left to scalar code.
+ */
+ARM_NN_X86_TARGET_AVX512
+void arm_depthwise_conv_s8_avx512(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                  const cmsis_nn_per_channel_quant_params *quant_params,
+                                  const cmsis_nn_dims *input_dims,
+                                  const q7_t *input,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const q7_t *kernel,
+                                  const int32_t *bias,
+                                  const cmsis_nn_dims *output_dims,
+                                  q7_t *output)
+{
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t channels = input_dims->c;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t dilation_x = dw_conv_params->dilation.w;
+    const int32_t dilation_y = dw_conv_params->dilation.h;
+    const int32_t *output_mult = quant_params->multiplier;
+    const int32_t *output_shift = quant_params->shift;
+    const __m512i offset = _mm512_set1_epi16((int16_t)dw_conv_params->input_offset);
+
+    for (int32_t i_batch = 0; i_batch < input_dims->n; i_batch++)
+    {
+        for (int32_t i_out_y = 0; i_out_y < output_dims->h; i_out_y++)
+        {
+            const int32_t base_y = i_out_y * dw_conv_params->stride.h - dw_conv_params->padding.h;
+            int32_t ker_y_start, ker_y_end;
+            depthwise_tap_range(base_y, dilation_y, kernel_y, input_y, &ker_y_start, &ker_y_end);
+
+            for (int32_t i_out_x = 0; i_out_x < output_dims->w; i_out_x++)
+            {
+                const int32_t base_x = i_out_x * dw_conv_params->stride.w - dw_conv_params->padding.w;
+                int32_t ker_x_start, ker_x_end;
+                depthwise_tap_range(base_x, dilation_x, kernel_x, input_x, &ker_x_start, &ker_x_end);
+
+                for (int32_t ch = 0; ch < channels; ch += 32)
+                {
+                    const int32_t num = MIN(32, channels - ch);
+                    const __mmask64 mask = ~0ULL >> (64 - num);
+                    const __mmask16 mask_lo = (__mmask16)(num >= 16 ? 0xFFFF : (1U << num) - 1U);
+                    const __mmask16 mask_hi = (__mmask16)(num <= 16 ? 0 : (1U << (num - 16)) - 1U);
+                    __m512i acc_lo, acc_hi;
+
+                    if (bias)
+                    {
+                        acc_lo = _mm512_maskz_loadu_epi32(mask_lo, bias + ch);
+                        acc_hi = _mm512_maskz_loadu_epi32(mask_hi, bias + ch + 16);
+                    }
+                    else
+                    {
+                        acc_lo = _mm512_setzero_si512();
+                        acc_hi = _mm512_setzero_si512();
+                    }
+
+                    for (int32_t ky = ker_y_start; ky < ker_y_end; ky++)
+                    {
+                        const int32_t idx_y = base_y + dilation_y * ky;
+                        for (int32_t kx = ker_x_start; kx < ker_x_end; kx++)
+                        {
+                            const int32_t idx_x = base_x + dilation_x * kx;
+                            const q7_t *in_ptr = input + (idx_y * input_x + idx_x) * channels + ch;
+                            const q7_t *ker_ptr = kernel + (ky * kernel_x + kx) * channels + ch;
+
+                            /* Masked lanes read 0: (0 + input_offset) * 0 */
+                            const __m512i x = _mm512_add_epi16(
+                                _mm512_cvtepi8_epi16(_mm512_castsi512_si256(_mm512_maskz_loadu_epi8(mask, in_ptr))),
+                                offset);
+                            const __m512i w =
+                                _mm512_cvtepi8_epi16(_mm512_castsi512_si256(_mm512_maskz_loadu_epi8(mask, ker_ptr)));
+                            const __m512i p = _mm512_mullo_epi16(x, w);
+                            acc_lo = _mm512_add_epi32(acc_lo, _mm512_cvtepi16_epi32(_mm512_castsi512_si256(p)));
+                            acc_hi = _mm512_add_epi32(acc_hi, _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(p, 1)));
+                        }
+                    }
+
+                    acc_lo = arm_nn_requantize_avx512(acc_lo,
+                                                      _mm512_maskz_loadu_epi32(mask_lo, output_mult + ch),
+                                                      _mm512_maskz_loadu_epi32(mask_lo, output_shift + ch));
+                    acc_lo = arm_nn_offset_clamp_avx512(acc_lo,
+                                                        dw_conv_params->output_offset,
+                                                        dw_conv_params->activation.min,
+                                                        dw_conv_params->activation.max);
+                    _mm512_mask_cvtepi32_storeu_epi8(output + ch, mask_lo, acc_lo);
+                    if (mask_hi)
+                    {
+                        acc_hi = arm_nn_requantize_avx512(acc_hi,
+                                                          _mm512_maskz_loadu_epi32(mask_hi, output_mult + ch + 16),
+                                                          _mm512_maskz_loadu_epi32(mask_hi, output_shift + ch + 16));
+                        acc_hi = arm_nn_offset_clamp_avx512(acc_hi,
+                                                            dw_conv_params->output_offset,
+                                                            dw_conv_params->activation.min,
+                                                            dw_conv_params->activation.max);
+                        _mm512_mask_cvtepi32_storeu_epi8(output + ch + 16, mask_hi, acc_hi);
+                    }
+                }
+                output += channels;
+            }
+        }
+        input += input_x * input_y * channels;
+    }
+}
+
+/**
+ * @} end of groupNNX86 group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
@@ -0,0 +1,284 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_mat_mult_nt_t_s8_x86.c
+ * Description:  AVX2 and AVX-512 VNNI s8 matrix multiplication with the
+ *               RHS transposed and per-channel requantization
+ *
+ * Target Processor:  x86-64 hosts
+ * -------------------------------------------------------------------- */
+
+#include "arm_nn_x86_simd.h"
+
+#if defined(ARM_MATH_X86)
+
+/**
+ * @ingroup groupNNX86
+ */
+
+/**
+ * @addtogroup groupNNX86
+ * @{
+ */
+
+/*
+ * Per-channel parameters of a block of 4 RHS rows. Rows past the end repeat
+ * the last one so the block is always full; their results are not stored.
+ */
+static void mat_mult_block_params(const q7_t *rhs,
+                                  const q31_t *bias,
+                                  const int32_t *dst_multipliers,
+                                  const int32_t *dst_shifts,
+                                  const int32_t first,
+                                  const int32_t rhs_rows,
+                                  const int32_t rhs_cols,
+                                  const q7_t **rhs_ptr,
+                                  int32_t *b4,
+                                  int32_t *m4,
+                                  int32_t *s4)
+{
+    for (int32_t i = 0; i < 4; i++)
+    {
+        const int32_t row = MIN(first + i, rhs_rows - 1);
+        rhs_ptr[i] = rhs + row * rhs_cols;
+        b4[i] = bias ? bias[row] : 0;
+        m4[i] = dst_multipliers[row];
+        s4[i] = dst_shifts[row];
+    }
+}
+
+/*
+ * AVX2: 2 LHS rows x 4 RHS rows per block. Operands are sign extended to
+ * 16 bits with the LHS offset folded in, (lhs + lhs_offset) * rhs fits int16
+ * and vpmaddwd adds pairs of them into the int32 accumulators.
+ */
+ARM_NN_X86_TARGET_AVX2
+void arm_nn_mat_mult_nt_t_s8_avx2(const q7_t *lhs,
+                                  const int32_t lhs_stride,
+                                  const q7_t *rhs,
+                                  const q31_t *bias,
+                                  q7_t *dst,
+                                  const int32_t *dst_multipliers,
+                                  const int32_t *dst_shifts,
+                                  const int32_t lhs_rows,
+                                  const int32_t rhs_rows,
+                                  const int32_t rhs_cols,
+                                  const int32_t lhs_offset,
+                                  const int32_t dst_offset,
+                                  const int32_t activation_min,
+                                  const int32_t activation_max)
+{
+    const __m256i offset = _mm256_set1_epi16((int16_t)lhs_offset);
+    const int32_t col_end = rhs_cols & ~0xF;
+    const int32_t col_tail = rhs_cols & 0xF;
+
+    for (int32_t c = 0; c < rhs_rows; c += 4)
+    {
+        const q7_t *rhs_ptr[4];
+        int32_t b4[4], m4[4], s4[4];
+        const int32_t num_ch = MIN(4, rhs_rows - c);
+
+        mat_mult_block_params(rhs, bias, dst_multipliers, dst_shifts, c, rhs_rows, rhs_cols, rhs_ptr, b4, m4, s4);
+
+        const __m256i bias_v = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)b4));
+        const __m256i mult_v = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)m4));
+        const __m256i shift_v = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)s4));
+
+        for (int32_t r = 0; r < lhs_rows; r += 2)
+        {
+            const int32_t num_rows = MIN(2, lhs_rows - r);
+            const q7_t *lhs_0 = lhs + r * lhs_stride;
+            const q7_t *lhs_1 = lhs_0 + (num_rows - 1) * lhs_stride;
+            __m256i acc[2][4];
+
+            for (int32_t i = 0; i < 4; i++)
+            {
+                acc[0][i] = _mm256_setzero_si256();
+                acc[1][i] = _mm256_setzero_si256();
+            }
+
+            for (int32_t k = 0; k < col_end; k += 16)
+            {
+                const __m256i x0 =
+                    _mm256_add_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(lhs_0 + k))), offset);
+                const __m256i x1 =
+                    _mm256_add_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(lhs_1 + k))), offset);
+                for (int32_t i = 0; i < 4; i++)
+                {
+                    const __m256i y = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(rhs_ptr[i] + k)));
+                    acc[0][i] = _mm256_add_epi32(acc[0][i], _mm256_madd_epi16(x0, y));
+                    acc[1][i] = _mm256_add_epi32(acc[1][i], _mm256_madd_epi16(x1, y));
+                }
+            }
+            if (col_tail)
+            {
+                /* Zero padding: (0 + lhs_offset) * 0 adds nothing */
+                const __m256i x0 =
+                    _mm256_add_epi16(_mm256_cvtepi8_epi16(arm_nn_load_tail_s8(lhs_0 + col_end, col_tail)), offset);
+                const __m256i x1 =
+                    _mm256_add_epi16(_mm256_cvtepi8_epi16(arm_nn_load_tail_s8(lhs_1 + col_end, col_tail)), offset);
+                for (int32_t i = 0; i < 4; i++)
+                {
+                    const __m256i y = _mm256_cvtepi8_epi16(arm_nn_load_tail_s8(rhs_ptr[i] + col_end, col_tail));
+                    acc[0][i] = _mm256_add_epi32(acc[0][i], _mm256_madd_epi16(x0, y));
+                    acc[1][i] = _mm256_add_epi32(acc[1][i], _mm256_madd_epi16(x1, y));
+                }
+            }
+
+            __m256i res = _mm256_set_m128i(arm_nn_reduce4_avx2(acc[1][0], acc[1][1], acc[1][2], acc[1][3]),
+                                           arm_nn_reduce4_avx2(acc[0][0], acc[0][1], acc[0][2], acc[0][3]));
+            res = _mm256_add_epi32(res, bias_v);
+            res = arm_nn_requantize_avx2(res, mult_v, shift_v);
+            res = arm_nn_offset_clamp_avx2(res, dst_offset, activation_min, activation_max);
+
+            const __m128i out = arm_nn_pack_s8_avx2(res);
+            int32_t word = _mm_cvtsi128_si32(out);
+            memcpy(dst + r * rhs_rows + c, &word, (size_t)num_ch);
+            if (num_rows == 2)
+            {
+                word = _mm_extract_epi32(out, 1);
+                memcpy(dst + (r + 1) * rhs_rows + c, &word, (size_t)num_ch);
+            }
+        }
+    }
+}
+
+/*
+ * AVX-512 VNNI: 4 LHS rows x 4 RHS rows per block, 64 columns per step.
+ * vpdpbusd multiplies unsigned by signed bytes, so the LHS is biased to
+ * lhs + 128 (an xor of the sign bit) and the extra 128 * sum(rhs) is taken
+ * out together with the LHS offset: the column sums of the 4 RHS rows are
+ * computed once per block, which costs one RHS pass shared by all LHS rows.
+ */
+ARM_NN_X86_TARGET_AVX512
+void arm_nn_mat_mult_nt_t_s8_avx512(const q7_t *lhs,
+                                    const int32_t lhs_stride,
+                                    const q7_t *rhs,
+                                    const q31_t *bias,
+                                    q7_t *dst,
+                                    const int32_t *dst_multipliers,
+                                    const int32_t *dst_shifts,
+                                    const int32_t lhs_rows,
+                                    const int32_t rhs_rows,
+                                    const int32_t rhs_cols,
+                                    const int32_t lhs_offset,
+                                    const int32_t dst_offset,
+                                    const int32_t activation_min,
+                                    const int32_t activation_max)
+{
+    const __m512i sign = _mm512_set1_epi8((char)0x80);
+    const __m512i ones = _mm512_set1_epi8(1);
+    const int32_t col_tail = rhs_cols & 0x3F;
+    const int32_t col_end = rhs_cols - col_tail;
+    const __mmask64 tail_mask = col_tail ? (~0ULL >> (64 - col_tail)) : 0;
+
+    for (int32_t c = 0; c < rhs_rows; c += 4)
+    {
+        const q7_t *rhs_ptr[4];
+        int32_t b4[4], m4[4], s4[4];
+        const int32_t num_ch = MIN(4, rhs_rows - c);
+
+        mat_mult_block_params(rhs, bias, dst_multipliers, dst_shifts, c, rhs_rows, rhs_cols, rhs_ptr, b4, m4, s4);
+
+        /* bias + (lhs_offset - 128) * sum(rhs) per channel */
+        __m512i sum[4];
+        for (int32_t i = 0; i < 4; i++)
+        {
+            sum[i] = _mm512_setzero_si512();
+            for (int32_t k = 0; k < col_end; k += 64)
+            {
+                sum[i] = _mm512_dpbusd_epi32(sum[i], ones, _mm512_loadu_si512(rhs_ptr[i] + k));
+            }
+            if (col_tail)
+            {
+                sum[i] = _mm512_dpbusd_epi32(sum[i], ones, _mm512_maskz_loadu_epi8(tail_mask, rhs_ptr[i] + col_end));
+            }
+        }
+        __m128i corr = arm_nn_reduce4_avx2(
+            arm_nn_fold_avx512(sum[0]), arm_nn_fold_avx512(sum[1]), arm_nn_fold_avx512(sum[2]), arm_nn_fold_avx512(sum[3]));
+        corr = _mm_add_epi32(_mm_mullo_epi32(corr, _mm_set1_epi32(lhs_offset - 128)),
+                             _mm_loadu_si128((const __m128i *)b4));
+
+        const __m512i corr_v = _mm512_broadcast_i32x4(corr);
+        const __m512i mult_v = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)m4));
+        const __m512i shift_v = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)s4));
+
+        for (int32_t r = 0; r < lhs_rows; r += 4)
+        {
+            const int32_t num_rows = MIN(4, lhs_rows - r);
+            const q7_t *lhs_ptr[4];
+            __m512i acc[4][4];
+
+            for (int32_t j = 0; j < 4; j++)
+            {
+                lhs_ptr[j] = lhs + (r + MIN(j, num_rows - 1)) * lhs_stride;
+                for (int32_t i = 0; i < 4; i++)
+                {
+                    acc[j][i] = _mm512_setzero_si512();
+                }
+            }
+
+            for (int32_t k = 0; k < rhs_cols; k += 64)
+            {
+                const __mmask64 mask = (k == col_end) ? tail_mask : ~0ULL;
+                __m512i x[4];
+
+                for (int32_t j = 0; j < 4; j++)
+                {
+                    x[j] = _mm512_xor_si512(_mm512_maskz_loadu_epi8(mask, lhs_ptr[j] + k), sign);
+                }
+                for (int32_t i = 0; i < 4; i++)
+                {
+                    const __m512i w = _mm512_maskz_loadu_epi8(mask, rhs_ptr[i] + k);
+                    acc[0][i] = _mm512_dpbusd_epi32(acc[0][i], x[0], w);
+                    acc[1][i] = _mm512_dpbusd_epi32(acc[1][i], x[1], w);
+                    acc[2][i] = _mm512_dpbusd_epi32(acc[2][i], x[2], w);
+                    acc[3][i] = _mm512_dpbusd_epi32(acc[3][i], x[3], w);
+                }
+            }
+
+            /* Lane 4 * j + i holds LHS row j against RHS row i */
+            __m128i row[4];
+            for (int32_t j = 0; j < 4; j++)
+            {
+                row[j] = arm_nn_reduce4_avx2(arm_nn_fold_avx512(acc[j][0]),
+                                             arm_nn_fold_avx512(acc[j][1]),
+                                             arm_nn_fold_avx512(acc[j][2]),
+                                             arm_nn_fold_avx512(acc[j][3]));
+            }
+            __m512i res = _mm512_inserti64x4(
+                _mm512_castsi256_si512(_mm256_set_m128i(row[1], row[0])), _mm256_set_m128i(row[3], row[2]), 1);
+            res = _mm512_add_epi32(res, corr_v);
+            res = arm_nn_requantize_avx512(res, mult_v, shift_v);
+            res = arm_nn_offset_clamp_avx512(res, dst_offset, activation_min, activation_max);
+
+            int32_t words[4];
+            _mm_storeu_si128((__m128i *)words, _mm512_cvtepi32_epi8(res));
+            for (int32_t j = 0; j < num_rows; j++)
+            {
+                memcpy(dst + (r + j) * rhs_rows + c, &words[j], (size_t)num_ch);
+            }
+        }
+    }
+}
+
+/**
+ * @} end of groupNNX86 group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
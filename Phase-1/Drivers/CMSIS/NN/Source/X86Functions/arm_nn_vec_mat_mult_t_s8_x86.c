@@ -0,0 +1,219 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_vec_mat_mult_t_s8_x86.c
+ * Description:  AVX2 and AVX-512 VNNI s8 vector by transposed matrix
+ *               multiplication
+ *
+ * Target Processor:  x86-64 hosts
+ * -------------------------------------------------------------------- */
+
+#include "arm_nn_x86_simd.h"
+
+#if defined(ARM_MATH_X86)
+
+/**
+ * @ingroup groupNNX86
+ */
+
+/**
+ * @addtogroup groupNNX86
+ * @{
+ */
+
+/*
+ * Bias and RHS rows of a block of 8 outputs; rows past the end repeat the
+ * last one and are not stored.
+ */
+static void vec_mat_block_params(const q7_t *rhs,
+                                 const q31_t *bias,
+                                 const int32_t first,
+                                 const int32_t rhs_rows,
+                                 const int32_t rhs_cols,
+                                 const q7_t **rhs_ptr,
+                                 int32_t *b8)
+{
+    for (int32_t i = 0; i < 8; i++)
+    {
+        const int32_t row = MIN(first + i, rhs_rows - 1);
+        rhs_ptr[i] = rhs + row * rhs_cols;
+        b8[i] = bias ? bias[row] : 0;
+    }
+}
+
+static void vec_mat_store(q7_t *dst, const __m128i out, const int32_t num, const int32_t address_offset)
+{
+    int8_t bytes[16];
+
+    _mm_storeu_si128((__m128i *)bytes, out);
+    if (address_offset == 1)
+    {
+        memcpy(dst, bytes, (size_t)num);
+        return;
+    }
+    for (int32_t i = 0; i < num; i++)
+    {
+        dst[i * address_offset] = bytes[i];
+    }
+}
+
+/*
+ * AVX2: 8 RHS rows per block, the LHS is widened once per 16 columns and
+ * shared by the 8 multiply-adds.
+ */
+ARM_NN_X86_TARGET_AVX2
+void arm_nn_vec_mat_mult_t_s8_avx2(const q7_t *lhs,
+                                   const q7_t *rhs,
+                                   const q31_t *bias,
+                                   q7_t *dst,
+                                   const int32_t lhs_offset,
+                                   const int32_t dst_offset,
+                                   const int32_t dst_multiplier,
+                                   const int32_t dst_shift,
+                                   const int32_t rhs_cols,
+                                   const int32_t rhs_rows,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max,
+                                   const int32_t address_offset)
+{
+    const __m256i offset = _mm256_set1_epi16((int16_t)lhs_offset);
+    const __m256i mult_v = _mm256_set1_epi32(dst_multiplier);
+    const __m256i shift_v = _mm256_set1_epi32(dst_shift);
+    const int32_t col_end = rhs_cols & ~0xF;
+    const int32_t col_tail = rhs_cols & 0xF;
+
+    for (int32_t c = 0; c < rhs_rows; c += 8)
+    {
+        const q7_t *rhs_ptr[8];
+        __m256i acc[8];
+        const int32_t num = MIN(8, rhs_rows - c);
+        int32_t b8[8];
+
+        vec_mat_block_params(rhs, bias, c, rhs_rows, rhs_cols, rhs_ptr, b8);
+        const __m256i bias_v = _mm256_loadu_si256((const __m256i *)b8);
+
+        for (int32_t i = 0; i < 8; i++)
+        {
+            acc[i] = _mm256_setzero_si256();
+        }
+
+        for (int32_t k = 0; k < col_end; k += 16)
+        {
+            const __m256i x =
+                _mm256_add_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(lhs + k))), offset);
+            for (int32_t i = 0; i < 8; i++)
+            {
+                const __m256i y = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(rhs_ptr[i] + k)));
+                acc[i] = _mm256_add_epi32(acc[i], _mm256_madd_epi16(x, y));
+            }
+        }
+        if (col_tail)
+        {
+            /* Zero padding: (0 + lhs_offset) * 0 adds nothing */
+            const __m256i x = _mm256_add_epi16(_mm256_cvtepi8_epi16(arm_nn_load_tail_s8(lhs + col_end, col_tail)), offset);
+            for (int32_t i = 0; i < 8; i++)
+            {
+                const __m256i y = _mm256_cvtepi8_epi16(arm_nn_load_tail_s8(rhs_ptr[i] + col_end, col_tail));
+                acc[i] = _mm256_add_epi32(acc[i], _mm256_madd_epi16(x, y));
+            }
+        }
+
+        __m256i res = _mm256_add_epi32(arm_nn_reduce8_avx2(acc), bias_v);
+        res = arm_nn_requantize_avx2(res, mult_v, shift_v);
+        res = arm_nn_offset_clamp_avx2(res, dst_offset, activation_min, activation_max);
+        vec_mat_store(dst + c * address_offset, arm_nn_pack_s8_avx2(res), num, address_offset);
+    }
+}
+
+/*
+ * AVX-512 VNNI: 8 RHS rows per block, 64 columns per step. As in
+ * arm_nn_mat_mult_nt_t_s8_avx512() the LHS is biased to unsigned; with a
+ * single LHS row the RHS sums for the correction are accumulated in the same
+ * pass, by a second vpdpbusd against a vector of ones.
+ */
+ARM_NN_X86_TARGET_AVX512
+void arm_nn_vec_mat_mult_t_s8_avx512(const q7_t *lhs,
+                                     const q7_t *rhs,
+                                     const q31_t *bias,
+                                     q7_t *dst,
+                                     const int32_t lhs_offset,
+                                     const int32_t dst_offset,
+                                     const int32_t dst_multiplier,
+                                     const int32_t dst_shift,
+                                     const int32_t rhs_cols,
+                                     const int32_t rhs_rows,
+                                     const int32_t activation_min,
+                                     const int32_t activation_max,
+                                     const int32_t address_offset)
+{
+    const __m512i sign = _mm512_set1_epi8((char)0x80);
+    const __m512i ones = _mm512_set1_epi8(1);
+    const __m256i mult_v = _mm256_set1_epi32(dst_multiplier);
+    const __m256i shift_v = _mm256_set1_epi32(dst_shift);
+    const __m256i corr_v = _mm256_set1_epi32(lhs_offset - 128);
+    const int32_t col_tail = rhs_cols & 0x3F;
+    const int32_t col_end = rhs_cols - col_tail;
+    const __mmask64 tail_mask = col_tail ? (~0ULL >> (64 - col_tail)) : 0;
+
+    for (int32_t c = 0; c < rhs_rows; c += 8)
+    {
+        const q7_t *rhs_ptr[8];
+        __m512i acc[8], sum[8];
+        const int32_t num = MIN(8, rhs_rows - c);
+        int32_t b8[8];
+
+        vec_mat_block_params(rhs, bias, c, rhs_rows, rhs_cols, rhs_ptr, b8);
+        const __m256i bias_v = _mm256_loadu_si256((const __m256i *)b8);
+
+        for (int32_t i = 0; i < 8; i++)
+        {
+            acc[i] = _mm512_setzero_si512();
+            sum[i] = _mm512_setzero_si512();
+        }
+
+        for (int32_t k = 0; k < rhs_cols; k += 64)
+        {
+            const __mmask64 mask = (k == col_end) ? tail_mask : ~0ULL;
+            const __m512i x = _mm512_xor_si512(_mm512_maskz_loadu_epi8(mask, lhs + k), sign);
+            for (int32_t i = 0; i < 8; i++)
+            {
+                const __m512i w = _mm512_maskz_loadu_epi8(mask, rhs_ptr[i] + k);
+                acc[i] = _mm512_dpbusd_epi32(acc[i], x, w);
+                sum[i] = _mm512_dpbusd_epi32(sum[i], ones, w);
+            }
+        }
+
+        __m256i acc8[8], sum8[8];
+        for (int32_t i = 0; i < 8; i++)
+        {
+            acc8[i] = arm_nn_fold_avx512(acc[i]);
+            sum8[i] = arm_nn_fold_avx512(sum[i]);
+        }
+        __m256i res = _mm256_add_epi32(arm_nn_reduce8_avx2(acc8), bias_v);
+        res = _mm256_add_epi32(res, _mm256_mullo_epi32(arm_nn_reduce8_avx2(sum8), corr_v));
+        res = arm_nn_requantize_avx2(res, mult_v, shift_v);
+        res = arm_nn_offset_clamp_avx2(res, dst_offset, activation_min, activation_max);
+        vec_mat_store(dst + c * address_offset, arm_nn_pack_s8_avx2(res), num, address_offset);
+    }
+}
+
+/**
+ * @} end of groupNNX86 group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_x86_level.c
+ * Description:  Run-time selection of the x86 code path
+ *
+ * Target Processor:  x86-64 hosts
+ * -------------------------------------------------------------------- */
+
+#include "arm_nn_x86.h"
+
+#if defined(ARM_MATH_X86)
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @ingroup groupNNX86
+ */
+
+/**
+ * @addtogroup groupNNX86
+ * @{
+ */
+
+/* -1 until the first query */
+static int arm_nn_x86_level_current = -1;
+
+static arm_nn_x86_level arm_nn_x86_detect(void)
+{
+    __builtin_cpu_init();
+    if (!__builtin_cpu_supports("avx2"))
+    {
+        return ARM_NN_X86_LEVEL_SCALAR;
+    }
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vnni"))
+    {
+        return ARM_NN_X86_LEVEL_AVX512_VNNI;
+    }
+    return ARM_NN_X86_LEVEL_AVX2;
+}
+
+/*
+ * Code path level in use.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_nn_x86_level arm_nn_x86_get_level(void)
+{
+    if (arm_nn_x86_level_current < 0)
+    {
+        arm_nn_x86_level level = arm_nn_x86_detect();
+        const char *env = getenv("ARM_NN_X86_LEVEL");
+
+        if (env != NULL)
+        {
+            if (strcmp(env, "scalar") == 0)
+            {
+                level = ARM_NN_X86_LEVEL_SCALAR;
+            }
+            else if (strcmp(env, "avx2") == 0 && level > ARM_NN_X86_LEVEL_AVX2)
+            {
+                level = ARM_NN_X86_LEVEL_AVX2;
+            }
+        }
+        arm_nn_x86_level_current = (int)level;
+    }
+
+    return (arm_nn_x86_level)arm_nn_x86_level_current;
+}
+
+/*
+ * Force a code path level.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_nn_x86_level arm_nn_x86_set_level(arm_nn_x86_level level)
+{
+    arm_nn_x86_level max = arm_nn_x86_detect();
+
+    arm_nn_x86_level_current = (int)((level > max) ? max : level);
+    return (arm_nn_x86_level)arm_nn_x86_level_current;
+}
+
+/**
+ * @} end of groupNNX86 group
+ */
+
+#endif /* defined(ARM_MATH_X86) */
@@ -0,0 +1,172 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_x86_simd.h
+ * Description:  Vector requantization and reduction helpers shared by the
+ *               x86 kernels
+ *
+ * Target Processor:  x86-64 hosts
+ * -------------------------------------------------------------------- */
+
+#ifndef _ARM_NN_X86_SIMD_H_
+#define _ARM_NN_X86_SIMD_H_
+
+#include "arm_nnsupportfunctions.h"
+
+#if defined(ARM_MATH_X86)
+
+#include <immintrin.h>
+
+/*
+ * The library is compiled for the x86-64 baseline. The kernels are compiled
+ * per function with a target attribute; AVX-512 functions may inline the AVX2
+ * helpers since their target is a superset.
+ */
+#define ARM_NN_X86_TARGET_AVX2 __attribute__((target("avx2")))
+#define ARM_NN_X86_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512bw,avx512vnni")))
+
+/**
+ * @brief Vector form of arm_nn_requantize(), eight lanes with their own multiplier and shift
+ *
+ * The 64-bit products of the even and odd lanes are formed separately
+ * (vpmuldq only reads the low half of each quadword); bits 31..62 of each,
+ * after adding the 1 << 30 rounding term, are the doubling high multiply.
+ * The rounding divide then follows arm_nn_divide_by_power_of_two() step by step.
+ */
+ARM_NN_X86_TARGET_AVX2 static inline __m256i arm_nn_requantize_avx2(__m256i val, __m256i mult, __m256i shift)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i round = _mm256_set1_epi64x(1LL << 30);
+    const __m256i left = _mm256_max_epi32(shift, zero);
+    const __m256i right = _mm256_max_epi32(_mm256_sub_epi32(zero, shift), zero);
+
+    val = _mm256_sllv_epi32(val, left);
+
+    __m256i even = _mm256_add_epi64(_mm256_mul_epi32(val, mult), round);
+    __m256i odd = _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(val, 32), _mm256_srli_epi64(mult, 32)), round);
+    even = _mm256_srli_epi64(even, 31);
+    odd = _mm256_slli_epi64(odd, 1);
+    val = _mm256_blend_epi32(even, odd, 0xAA);
+
+    const __m256i mask = _mm256_sub_epi32(_mm256_sllv_epi32(one, right), one);
+    const __m256i remainder = _mm256_and_si256(val, mask);
+    __m256i threshold = _mm256_srli_epi32(mask, 1);
+
+    val = _mm256_srav_epi32(val, right);
+    threshold = _mm256_sub_epi32(threshold, _mm256_cmpgt_epi32(zero, val));
+    return _mm256_sub_epi32(val, _mm256_cmpgt_epi32(remainder, threshold));
+}
+
+/**
+ * @brief Sixteen lane arm_nn_requantize(), see arm_nn_requantize_avx2()
+ */
+ARM_NN_X86_TARGET_AVX512 static inline __m512i arm_nn_requantize_avx512(__m512i val, __m512i mult, __m512i shift)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i round = _mm512_set1_epi64(1LL << 30);
+    const __m512i left = _mm512_max_epi32(shift, zero);
+    const __m512i right = _mm512_max_epi32(_mm512_sub_epi32(zero, shift), zero);
+
+    val = _mm512_sllv_epi32(val, left);
+
+    __m512i even = _mm512_add_epi64(_mm512_mul_epi32(val, mult), round);
+    __m512i odd = _mm512_add_epi64(_mm512_mul_epi32(_mm512_srli_epi64(val, 32), _mm512_srli_epi64(mult, 32)), round);
+    even = _mm512_srli_epi64(even, 31);
+    odd = _mm512_slli_epi64(odd, 1);
+    val = _mm512_mask_blend_epi32(0xAAAA, even, odd);
+
+    const __m512i mask = _mm512_sub_epi32(_mm512_sllv_epi32(one, right), one);
+    const __m512i remainder = _mm512_and_si512(val, mask);
+    __m512i threshold = _mm512_srli_epi32(mask, 1);
+
+    val = _mm512_srav_epi32(val, right);
+    threshold = _mm512_mask_add_epi32(threshold, _mm512_cmplt_epi32_mask(val, zero), threshold, one);
+    return _mm512_mask_add_epi32(val, _mm512_cmpgt_epi32_mask(remainder, threshold), val, one);
+}
+
+/**
+ * @brief Add the output offset and clamp to the activation range
+ */
+ARM_NN_X86_TARGET_AVX2 static inline __m256i
+arm_nn_offset_clamp_avx2(__m256i val, const int32_t offset, const int32_t act_min, const int32_t act_max)
+{
+    val = _mm256_add_epi32(val, _mm256_set1_epi32(offset));
+    val = _mm256_max_epi32(val, _mm256_set1_epi32(act_min));
+    return _mm256_min_epi32(val, _mm256_set1_epi32(act_max));
+}
+
+ARM_NN_X86_TARGET_AVX512 static inline __m512i
+arm_nn_offset_clamp_avx512(__m512i val, const int32_t offset, const int32_t act_min, const int32_t act_max)
+{
+    val = _mm512_add_epi32(val, _mm512_set1_epi32(offset));
+    val = _mm512_max_epi32(val, _mm512_set1_epi32(act_min));
+    return _mm512_min_epi32(val, _mm512_set1_epi32(act_max));
+}
+
+/**
+ * @brief Eight clamped int32 lanes to eight int8 in the low quadword
+ */
+ARM_NN_X86_TARGET_AVX2 static inline __m128i arm_nn_pack_s8_avx2(__m256i val)
+{
+    const __m128i s16 = _mm_packs_epi32(_mm256_castsi256_si128(val), _mm256_extracti128_si256(val, 1));
+    return _mm_packs_epi16(s16, s16);
+}
+
+/**
+ * @brief Horizontal sums of four vectors, lane i holding the sum of vector i
+ */
+ARM_NN_X86_TARGET_AVX2 static inline __m128i arm_nn_reduce4_avx2(__m256i a, __m256i b, __m256i c, __m256i d)
+{
+    const __m256i abcd = _mm256_hadd_epi32(_mm256_hadd_epi32(a, b), _mm256_hadd_epi32(c, d));
+    return _mm_add_epi32(_mm256_castsi256_si128(abcd), _mm256_extracti128_si256(abcd, 1));
+}
+
+/**
+ * @brief Horizontal sums of eight vectors, lane i holding the sum of vector i
+ */
+ARM_NN_X86_TARGET_AVX2 static inline __m256i arm_nn_reduce8_avx2(const __m256i *v)
+{
+    const __m256i abcd = _mm256_hadd_epi32(_mm256_hadd_epi32(v[0], v[1]), _mm256_hadd_epi32(v[2], v[3]));
+    const __m256i efgh = _mm256_hadd_epi32(_mm256_hadd_epi32(v[4], v[5]), _mm256_hadd_epi32(v[6], v[7]));
+    return _mm256_add_epi32(_mm256_permute2x128_si256(abcd, efgh, 0x20), _mm256_permute2x128_si256(abcd, efgh, 0x31));
+}
+
+/**
+ * @brief Fold the two halves of a 16 lane vector, keeping lane sums mod 8
+ */
+ARM_NN_X86_TARGET_AVX512 static inline __m256i arm_nn_fold_avx512(__m512i v)
+{
+    return _mm256_add_epi32(_mm512_castsi512_si256(v), _mm512_extracti64x4_epi64(v, 1));
+}
+
+/**
+ * @brief Load the last n < 16 elements of a row, zero padded
+ */
+static inline __m128i arm_nn_load_tail_s8(const int8_t *src, const int32_t n)
+{
+    int8_t buf[16] = {0};
+
+    memcpy(buf, src, (size_t)n);
+    return _mm_loadu_si128((const __m128i *)buf);
+}
+
+#endif /* defined(ARM_MATH_X86) */
+
+#endif /* _ARM_NN_X86_SIMD_H_ */
@@ -0,0 +1,1417 @@
+/* dsp_bench.c
+ *
+ * CMSIS-DSP kernel benchmark.
+ *
+ * Times the kernel families we choose between when building a product
+ * feature (FIR, biquad, sample rate conversion, CFFT/RFFT, batched FFT,
+ * matrix multiply and GEMM, SVM and naive Bayes, MFCC, sorting) in
+ * f32/q31/q15 at the block sizes the firmware actually uses, and reports
+ * cost per call and per sample and throughput in samples per second.
+ *
+ * Cycles come from bh_cycles: TSC ticks on x86 (constant rate, not core
+ * clocks under turbo), DWT cycles on the M4. Host numbers are for relative
+ * comparison and regression tracking, not absolute M4 budgets.
+ *
+ *   dsp_bench [--filter SUBSTR] [--min-time MS] [--csv PATH] [--json PATH]
+ *             [--level scalar|sse2|avx2]
+ *
+ * A table always goes to stdout; --csv / --json add machine-readable copies.
+ * --level pins the x86 code path (ARM_MATH_X86 builds) so SIMD and scalar
+ * runs can be compared.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "arm_math.h"
+#include "bh_cycles.h"
+#include "../tools/harness_util.h"
+
+/* ============================================
+   Configuration
+   ============================================ */
+
+#define BENCH_MAX_LEN       16384U      // Largest buffer: complex 8192-point or 2x RFFT 8192
+#define BENCH_REPEATS       5U          // Timed batches per case, best one is reported
+#define BENCH_DEFAULT_MS    100U        // Default time budget per case
+#define BENCH_MAX_MS        2000U       // Keeps each batch well inside the 32-bit counter
+
+#define FIR_TAPS            64U
+#define FIR_BLOCK           256U
+#define DECIM_FACTOR        4U
+#define FIR_LONG_MAX_TAPS   4096U       // Room-correction length filters
+#define BIQUAD_STAGES       4U
+#define BIQUAD_BLOCK        256U
+#define BIQUAD_MAX_CH       8U          // Mic array width for the multi-channel cascade
+#define MFCC_MEL            40U
+#define MFCC_DCT            13U
+#define MFCC_FS             16000.0f
+#define BATCH_FRAMES        64U         // Frames per batched FFT call
+#define BATCH_MAX_LEN       4096U
+
+/* ============================================
+   Case Table
+   ============================================ */
+
+typedef struct {
+    const char *kernel;         // CMSIS function family
+    const char *type;           // f32 / q31 / q15
+    const char *params;         // Extra shape info for the report
+    uint32_t size;              // Block size, FFT length, matrix dim, ...
+    uint32_t samples;           // Samples (or output elements) per kernel call
+    uint32_t calls;             // Kernel calls per run() (e.g. forward + inverse)
+    int  (*setup)(uint32_t size);
+    void (*run)(uint32_t size);
+} bench_case_t;
+
+typedef struct {
+    const bench_case_t *c;
+    uint64_t iters;
+    double ns_per_call;
+    double cycles_per_call;
+} bench_result_t;
+
+/* ============================================
+   Shared Buffers
+   ============================================ */
+
+static float32_t f_a[BENCH_MAX_LEN + 2], f_b[BENCH_MAX_LEN + 2], f_c[BENCH_MAX_LEN + 2];
+static float32_t f_src[BENCH_MAX_LEN + 2], f_state[BENCH_MAX_LEN], f_coef[BENCH_MAX_LEN];
+static q31_t q31_a[BENCH_MAX_LEN + 2], q31_b[BENCH_MAX_LEN + 2], q31_c[BENCH_MAX_LEN + 2];
+static q31_t q31_src[BENCH_MAX_LEN + 2], q31_state[BENCH_MAX_LEN], q31_coef[BENCH_MAX_LEN];
+static q15_t q15_a[BENCH_MAX_LEN + 2], q15_b[BENCH_MAX_LEN + 2], q15_c[BENCH_MAX_LEN + 2];
+static q15_t q15_src[BENCH_MAX_LEN + 2], q15_state[BENCH_MAX_LEN], q15_coef[BENCH_MAX_LEN];
+
+static uint32_t rng_state = 0x12345678U;
+
+/**
+ * @brief Deterministic uniform noise in [-0.5, 0.5)
+ */
+static float32_t bench_rand(void)
+{
+    rng_state = rng_state * 1664525U + 1013904223U;
+    return (float32_t)(rng_state >> 8) / 16777216.0f - 0.5f;
+}
+
+/**
+ * @brief Fill the shared source buffers with the same noise in every format
+ */
+static void bench_fill_sources(void)
+{
+    for (uint32_t i = 0; i < BENCH_MAX_LEN + 2U; i++) {
+        f_src[i] = bench_rand();
+    }
+    arm_float_to_q31(f_src, q31_src, BENCH_MAX_LEN + 2U);
+    arm_float_to_q15(f_src, q15_src, BENCH_MAX_LEN + 2U);
+}
+
+/**
+ * @brief Copy the reference input into the working buffers of all formats
+ */
+static void bench_load_inputs(uint32_t len)
+{
+    memcpy(f_a, f_src, len * sizeof(float32_t));
+    memcpy(q31_a, q31_src, len * sizeof(q31_t));
+    memcpy(q15_a, q15_src, len * sizeof(q15_t));
+}
+
+/* ============================================
+   FIR
+   ============================================ */
+
+static arm_fir_instance_f32 fir_f32;
+static arm_fir_instance_q31 fir_q31;
+static arm_fir_instance_q15 fir_q15;
+static arm_fir_decimate_instance_f32 decim_f32;
+static arm_fir_decimate_instance_q31 decim_q31;
+static arm_fir_decimate_instance_q15 decim_q15;
+
+static void fir_coeffs(void)
+{
+    // Windowed-sinc low-pass at fs/8, well inside q15 range
+    for (uint32_t i = 0; i < FIR_TAPS; i++) {
+        float32_t n = (float32_t)i - (FIR_TAPS - 1U) / 2.0f;
+        float32_t sinc = (n == 0.0f) ? 0.25f : arm_sin_f32(PI * 0.25f * n) / (PI * n);
+        float32_t w = 0.54f - 0.46f * arm_cos_f32(2.0f * PI * i / (FIR_TAPS - 1U));
+        f_coef[i] = sinc * w;
+    }
+    arm_float_to_q31(f_coef, q31_coef, FIR_TAPS);
+    arm_float_to_q15(f_coef, q15_coef, FIR_TAPS);
+}
+
+static int fir_setup(uint32_t block)
+{
+    fir_coeffs();
+    bench_load_inputs(block);
+    arm_fir_init_f32(&fir_f32, FIR_TAPS, f_coef, f_state, block);
+    arm_fir_init_q31(&fir_q31, FIR_TAPS, q31_coef, q31_state, block);
+    return arm_fir_init_q15(&fir_q15, FIR_TAPS, q15_coef, q15_state, block) == ARM_MATH_SUCCESS;
+}
+
+static int decim_setup(uint32_t block)
+{
+    fir_coeffs();
+    bench_load_inputs(block);
+    return arm_fir_decimate_init_f32(&decim_f32, FIR_TAPS, DECIM_FACTOR, f_coef, f_state, block) == ARM_MATH_SUCCESS
+        && arm_fir_decimate_init_q31(&decim_q31, FIR_TAPS, DECIM_FACTOR, q31_coef, q31_state, block) == ARM_MATH_SUCCESS
+        && arm_fir_decimate_init_q15(&decim_q15, FIR_TAPS, DECIM_FACTOR, q15_coef, q15_state, block) == ARM_MATH_SUCCESS;
+}
+
+static void fir_f32_run(uint32_t n)      { arm_fir_f32(&fir_f32, f_a, f_b, n); }
+static void fir_q31_run(uint32_t n)      { arm_fir_q31(&fir_q31, q31_a, q31_b, n); }
+static void fir_q15_run(uint32_t n)      { arm_fir_q15(&fir_q15, q15_a, q15_b, n); }
+static void fir_fast_q31_run(uint32_t n) { arm_fir_fast_q31(&fir_q31, q31_a, q31_b, n); }
+static void fir_fast_q15_run(uint32_t n) { arm_fir_fast_q15(&fir_q15, q15_a, q15_b, n); }
+static void decim_f32_run(uint32_t n)    { arm_fir_decimate_f32(&decim_f32, f_a, f_b, n); }
+static void decim_q31_run(uint32_t n)    { arm_fir_decimate_q31(&decim_q31, q31_a, q31_b, n); }
+static void decim_q15_run(uint32_t n)    { arm_fir_decimate_q15(&decim_q15, q15_a, q15_b, n); }
+
+// Long filters: direct form against partitioned FFT, filter length swept
+// at a fixed block (= partition) size to locate the crossover.
+
+static arm_fir_fft_instance_f32 fir_fft_f32;
+static arm_fir_auto_instance_f32 fir_auto_f32;
+static float32_t fir_fft_coef[BENCH_MAX_LEN], fir_fft_state[BENCH_MAX_LEN];
+static float32_t fir_auto_coef[BENCH_MAX_LEN], fir_auto_state[BENCH_MAX_LEN];
+static uint32_t fir_long_block;
+
+static int fir_long_setup(uint32_t taps, uint32_t block)
+{
+    for (uint32_t i = 0; i < taps; i++) {
+        f_coef[i] = bench_rand();
+    }
+    fir_long_block = block;
+    bench_load_inputs(block);
+    arm_fir_init_f32(&fir_f32, (uint16_t)taps, f_coef, f_state, block);
+    return arm_fir_fft_init_f32(&fir_fft_f32, (uint16_t)taps, f_coef, (uint16_t)block,
+                                fir_fft_coef, fir_fft_state) == ARM_MATH_SUCCESS
+        && arm_fir_auto_init_f32(&fir_auto_f32, (uint16_t)taps, f_coef,
+                                 fir_auto_coef, fir_auto_state, block) == ARM_MATH_SUCCESS;
+}
+
+static int fir_long64_setup(uint32_t taps)  { return fir_long_setup(taps, 64U); }
+static int fir_long256_setup(uint32_t taps) { return fir_long_setup(taps, 256U); }
+
+static void fir_long_direct_run(uint32_t n) { (void)n; arm_fir_f32(&fir_f32, f_a, f_b, fir_long_block); }
+static void fir_long_fft_run(uint32_t n)    { (void)n; arm_fir_fft_f32(&fir_fft_f32, f_a, f_b, fir_long_block); }
+static void fir_long_auto_run(uint32_t n)   { (void)n; arm_fir_auto_f32(&fir_auto_f32, f_a, f_b, fir_long_block); }
+
+/* ============================================
+   Sample Rate Conversion
+   ============================================ */
+
+// 10 ms of input per call. The resamplers against chaining the existing
+// interpolator and decimator: for 44.1 kHz -> 48 kHz that is interpolate
+// by 160 with the whole filter, then keep one sample in 147 (a 1-tap
+// decimator, the cheapest chain possible).
+
+#define RS_CHAIN_MAX        (441U * 160U)
+
+static arm_resample_poly_instance_f32 rs_poly_f32;
+static arm_resample_poly_instance_q15 rs_poly_q15;
+static arm_resample_frac_instance_f32 rs_frac_f32;
+static arm_resample_frac_instance_q15 rs_frac_q15;
+static float32_t rs_poly_coef_f32[8192], rs_frac_coef_f32[8192], rs_state_f32[2][1024];
+static q15_t rs_poly_coef_q15[8192], rs_frac_coef_q15[8192], rs_state_q15[2][1024];
+
+static arm_fir_interpolate_instance_f32 rs_interp_f32;
+static arm_fir_interpolate_instance_q15 rs_interp_q15;
+static arm_fir_decimate_instance_f32 rs_decim_f32;
+static arm_fir_decimate_instance_q15 rs_decim_q15;
+static float32_t *rs_mid_f32, *rs_decim_state_f32;
+static q15_t *rs_mid_q15, *rs_decim_state_q15;
+static uint32_t rs_mid_len;
+
+static uint32_t rs_gcd(uint32_t a, uint32_t b)
+{
+    while (b != 0U) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static int rs_setup(uint32_t in_rate, uint32_t out_rate, arm_resample_quality q, uint32_t block)
+{
+    uint32_t g = rs_gcd(in_rate, out_rate);
+    uint16_t L = (uint16_t)(out_rate / g), M = (uint16_t)(in_rate / g);
+
+    if (ARM_RESAMPLE_POLY_COEFFS_SIZE(L, M, q) > 8192U
+        || ARM_RESAMPLE_FRAC_COEFFS_SIZE(in_rate, out_rate, q) > 8192U
+        || ARM_RESAMPLE_STATE_SIZE(in_rate, out_rate, q, block) > 1024U) {
+        return 0;
+    }
+    bench_load_inputs(block);
+    return arm_resample_poly_init_f32(&rs_poly_f32, L, M, q, rs_poly_coef_f32,
+                                      rs_state_f32[0], block) == ARM_MATH_SUCCESS
+        && arm_resample_poly_init_q15(&rs_poly_q15, L, M, q, rs_poly_coef_q15,
+                                      rs_state_q15[0], block) == ARM_MATH_SUCCESS
+        && arm_resample_frac_init_f32(&rs_frac_f32, in_rate, out_rate, q, rs_frac_coef_f32,
+                                      rs_state_f32[1], block) == ARM_MATH_SUCCESS
+        && arm_resample_frac_init_q15(&rs_frac_q15, in_rate, out_rate, q, rs_frac_coef_q15,
+                                      rs_state_q15[1], block) == ARM_MATH_SUCCESS;
+}
+
+static int rs_44k1_fast_setup(uint32_t n) { return rs_setup(44100U, 48000U, ARM_RESAMPLE_FAST, n); }
+static int rs_44k1_bal_setup(uint32_t n)  { return rs_setup(44100U, 48000U, ARM_RESAMPLE_BALANCED, n); }
+static int rs_44k1_best_setup(uint32_t n) { return rs_setup(44100U, 48000U, ARM_RESAMPLE_BEST, n); }
+static int rs_48k_16k_setup(uint32_t n)   { return rs_setup(48000U, 16000U, ARM_RESAMPLE_BALANCED, n); }
+static int rs_16k_48k_setup(uint32_t n)   { return rs_setup(16000U, 48000U, ARM_RESAMPLE_BALANCED, n); }
+
+// Chains with the taps of the BALANCED resampler: 16 per phase of the
+// interpolator, 48 for the decimator by 3 (16 per output x 3).
+static int rs_chain_setup(uint32_t L, uint32_t M, uint32_t block)
+{
+    uint32_t interp_taps = 16U * L;
+    uint32_t decim_taps = (L == 1U) ? 16U * M : 1U;
+
+    if (!rs_mid_f32) {
+        rs_mid_f32 = malloc(RS_CHAIN_MAX * sizeof(float32_t));
+        rs_mid_q15 = malloc(RS_CHAIN_MAX * sizeof(q15_t));
+        rs_decim_state_f32 = malloc((RS_CHAIN_MAX + 64U) * sizeof(float32_t));
+        rs_decim_state_q15 = malloc((RS_CHAIN_MAX + 64U) * sizeof(q15_t));
+        if (!rs_mid_f32 || !rs_mid_q15 || !rs_decim_state_f32 || !rs_decim_state_q15) {
+            return 0;
+        }
+    }
+    for (uint32_t i = 0; i < interp_taps; i++) {
+        rs_poly_coef_f32[i] = bench_rand() / (float32_t)interp_taps;
+        rs_poly_coef_q15[i] = (q15_t)(rs_poly_coef_f32[i] * 32767.0f);
+    }
+    rs_mid_len = block * L;
+    bench_load_inputs(block);
+    return arm_fir_interpolate_init_f32(&rs_interp_f32, (uint8_t)L, (uint16_t)interp_taps,
+                                        rs_poly_coef_f32, rs_state_f32[0], block) == ARM_MATH_SUCCESS
+        && arm_fir_interpolate_init_q15(&rs_interp_q15, (uint8_t)L, (uint16_t)interp_taps,
+                                        rs_poly_coef_q15, rs_state_q15[0], block) == ARM_MATH_SUCCESS
+        && arm_fir_decimate_init_f32(&rs_decim_f32, (uint16_t)decim_taps, (uint8_t)M,
+                                     rs_poly_coef_f32, rs_decim_state_f32, rs_mid_len) == ARM_MATH_SUCCESS
+        && arm_fir_decimate_init_q15(&rs_decim_q15, (uint16_t)decim_taps, (uint8_t)M,
+                                     rs_poly_coef_q15, rs_decim_state_q15, rs_mid_len) == ARM_MATH_SUCCESS;
+}
+
+static int rs_chain_44k1_setup(uint32_t n) { return rs_chain_setup(160U, 147U, n); }
+static int rs_chain_48k_setup(uint32_t n)  { return rs_chain_setup(1U, 3U, n); }
+static int rs_chain_16k_setup(uint32_t n)  { return rs_chain_setup(3U, 1U, n); }
+
+static void rs_poly_f32_run(uint32_t n) { arm_resample_poly_f32(&rs_poly_f32, f_a, f_b, n); }
+static void rs_poly_q15_run(uint32_t n) { arm_resample_poly_q15(&rs_poly_q15, q15_a, q15_b, n); }
+static void rs_frac_f32_run(uint32_t n) { arm_resample_frac_f32(&rs_frac_f32, f_a, f_b, n); }
+static void rs_frac_q15_run(uint32_t n) { arm_resample_frac_q15(&rs_frac_q15, q15_a, q15_b, n); }
+
+static void rs_chain_f32_run(uint32_t n)
+{
+    float32_t *mid = f_a;
+
+    if (rs_interp_f32.L > 1U) {
+        arm_fir_interpolate_f32(&rs_interp_f32, f_a, rs_mid_f32, n);
+        mid = rs_mid_f32;
+    }
+    if (rs_decim_f32.M > 1U) {
+        arm_fir_decimate_f32(&rs_decim_f32, mid, f_b, rs_mid_len);
+    }
+}
+
+static void rs_chain_q15_run(uint32_t n)
+{
+    q15_t *mid = q15_a;
+
+    if (rs_interp_q15.L > 1U) {
+        arm_fir_interpolate_q15(&rs_interp_q15, q15_a, rs_mid_q15, n);
+        mid = rs_mid_q15;
+    }
+    if (rs_decim_q15.M > 1U) {
+        arm_fir_decimate_q15(&rs_decim_q15, mid, q15_b, rs_mid_len);
+    }
+}
+
+/* ============================================
+   Biquad
+   ============================================ */
+
+static arm_biquad_casd_df1_inst_f32 bq_df1_f32;
+static arm_biquad_cascade_df2T_instance_f32 bq_df2t_f32;
+static arm_biquad_casd_df1_inst_q31 bq_df1_q31;
+static arm_biquad_casd_df1_inst_q15 bq_df1_q15;
+
+static int biquad_setup(uint32_t block)
+{
+    // Stable 2nd-order low-pass, repeated; CMSIS sign convention for a1/a2
+    const float32_t sec[5] = { 0.2f, 0.4f, 0.2f, 0.5f, -0.3f };
+
+    bench_load_inputs(block);
+    for (uint32_t s = 0; s < BIQUAD_STAGES; s++) {
+        for (uint32_t k = 0; k < 5U; k++) {
+            f_coef[5U * s + k] = sec[k];
+            q31_coef[5U * s + k] = (q31_t)(sec[k] * 0.5f * 2147483648.0f);    // postShift 1
+        }
+        // q15 layout: {b0, 0, b1, b2, a1, a2}
+        q15_coef[6U * s + 0U] = (q15_t)(sec[0] * 0.5f * 32768.0f);
+        q15_coef[6U * s + 1U] = 0;
+        q15_coef[6U * s + 2U] = (q15_t)(sec[1] * 0.5f * 32768.0f);
+        q15_coef[6U * s + 3U] = (q15_t)(sec[2] * 0.5f * 32768.0f);
+        q15_coef[6U * s + 4U] = (q15_t)(sec[3] * 0.5f * 32768.0f);
+        q15_coef[6U * s + 5U] = (q15_t)(sec[4] * 0.5f * 32768.0f);
+    }
+
+    arm_biquad_cascade_df1_init_f32(&bq_df1_f32, BIQUAD_STAGES, f_coef, f_state);
+    arm_biquad_cascade_df2T_init_f32(&bq_df2t_f32, BIQUAD_STAGES, f_coef, f_state + 4U * BIQUAD_STAGES);
+    arm_biquad_cascade_df1_init_q31(&bq_df1_q31, BIQUAD_STAGES, q31_coef, q31_state, 1);
+    arm_biquad_cascade_df1_init_q15(&bq_df1_q15, BIQUAD_STAGES, q15_coef, q15_state, 1);
+    return 1;
+}
+
+static void bq_df1_f32_run(uint32_t n)       { arm_biquad_cascade_df1_f32(&bq_df1_f32, f_a, f_b, n); }
+static void bq_df2t_f32_run(uint32_t n)      { arm_biquad_cascade_df2T_f32(&bq_df2t_f32, f_a, f_b, n); }
+static void bq_df1_q31_run(uint32_t n)       { arm_biquad_cascade_df1_q31(&bq_df1_q31, q31_a, q31_b, n); }
+static void bq_df1_fast_q31_run(uint32_t n)  { arm_biquad_cascade_df1_fast_q31(&bq_df1_q31, q31_a, q31_b, n); }
+static void bq_df1_q15_run(uint32_t n)       { arm_biquad_cascade_df1_q15(&bq_df1_q15, q15_a, q15_b, n); }
+static void bq_df1_fast_q15_run(uint32_t n)  { arm_biquad_cascade_df1_fast_q15(&bq_df1_q15, q15_a, q15_b, n); }
+
+// N channels: one interleaved multi-channel call against one mono call per
+// (planar) channel, same coefficients for every channel.
+
+static arm_biquad_cascade_df2T_instance_f32 bq_ch_f32[BIQUAD_MAX_CH];
+static arm_biquad_casd_df1_inst_q31 bq_ch_q31[BIQUAD_MAX_CH];
+static arm_biquad_cascade_multich_df2T_instance_f32 bq_mc_f32;
+static arm_biquad_cascade_multich_df1_instance_q31 bq_mc_q31;
+static float32_t bq_mc_f32_coef[5U * BIQUAD_STAGES * BIQUAD_MAX_CH];
+static q31_t bq_mc_q31_coef[5U * BIQUAD_STAGES * BIQUAD_MAX_CH];
+
+static int biquad_multich_setup(uint32_t block, uint16_t ch)
+{
+    float32_t *fs = f_state + 4U * BIQUAD_STAGES * (BIQUAD_MAX_CH + 1U);
+    q31_t *qs = q31_state + 4U * BIQUAD_STAGES * (BIQUAD_MAX_CH + 1U);
+
+    biquad_setup(block);
+    bench_load_inputs(block * ch);
+    for (uint32_t c = 0; c < ch; c++) {
+        arm_biquad_cascade_df2T_init_f32(&bq_ch_f32[c], BIQUAD_STAGES, f_coef, f_state + 4U * BIQUAD_STAGES * (c + 1U));
+        arm_biquad_cascade_df1_init_q31(&bq_ch_q31[c], BIQUAD_STAGES, q31_coef, q31_state + 4U * BIQUAD_STAGES * (c + 1U), 1);
+    }
+    arm_biquad_cascade_multich_df2T_init_f32(&bq_mc_f32, BIQUAD_STAGES, ch, f_coef, 0, bq_mc_f32_coef, fs);
+    arm_biquad_cascade_multich_df1_init_q31(&bq_mc_q31, BIQUAD_STAGES, ch, q31_coef, 0, bq_mc_q31_coef, qs, 1);
+    return 1;
+}
+
+static int bq_ch4_setup(uint32_t block) { return biquad_multich_setup(block, 4U); }
+static int bq_ch8_setup(uint32_t block) { return biquad_multich_setup(block, 8U); }
+
+static void bq_loop_f32_run(uint32_t n, uint32_t ch)
+{
+    for (uint32_t c = 0; c < ch; c++) {
+        arm_biquad_cascade_df2T_f32(&bq_ch_f32[c], f_a + c * n, f_b + c * n, n);
+    }
+}
+
+static void bq_loop_q31_run(uint32_t n, uint32_t ch)
+{
+    for (uint32_t c = 0; c < ch; c++) {
+        arm_biquad_cascade_df1_q31(&bq_ch_q31[c], q31_a + c * n, q31_b + c * n, n);
+    }
+}
+
+static void bq_loop4_f32_run(uint32_t n)  { bq_loop_f32_run(n, 4U); }
+static void bq_loop8_f32_run(uint32_t n)  { bq_loop_f32_run(n, 8U); }
+static void bq_loop4_q31_run(uint32_t n)  { bq_loop_q31_run(n, 4U); }
+static void bq_loop8_q31_run(uint32_t n)  { bq_loop_q31_run(n, 8U); }
+static void bq_mc_f32_run(uint32_t n)     { arm_biquad_cascade_multich_df2T_f32(&bq_mc_f32, f_a, f_b, n); }
+static void bq_mc_q31_run(uint32_t n)     { arm_biquad_cascade_multich_df1_q31(&bq_mc_q31, q31_a, q31_b, n); }
+
+/* ============================================
+   Vector Kernels
+   ============================================ */
+
+static int vec_setup(uint32_t n)
+{
+    bench_load_inputs(2U * n);
+    memcpy(f_b, f_src + n, n * sizeof(float32_t));
+    memcpy(q31_b, q31_src + n, n * sizeof(q31_t));
+    memcpy(q15_b, q15_src + n, n * sizeof(q15_t));
+    return 1;
+}
+
+static void dot_f32_run(uint32_t n)
+{
+    float32_t r;
+    arm_dot_prod_f32(f_a, f_b, n, &r);
+    f_c[0] = r;
+}
+
+static void dot_q31_run(uint32_t n)
+{
+    q63_t r;
+    arm_dot_prod_q31(q31_a, q31_b, n, &r);
+    q31_c[0] = (q31_t)r;
+}
+
+static void dot_q15_run(uint32_t n)
+{
+    q63_t r;
+    arm_dot_prod_q15(q15_a, q15_b, n, &r);
+    q15_c[0] = (q15_t)r;
+}
+
+static void mag_f32_run(uint32_t n) { arm_cmplx_mag_f32(f_a, f_c, n); }
+static void mag_q31_run(uint32_t n) { arm_cmplx_mag_q31(q31_a, q31_c, n); }
+static void mag_q15_run(uint32_t n) { arm_cmplx_mag_q15(q15_a, q15_c, n); }
+
+/* ============================================
+   FFT
+   ============================================ */
+
+// Every FFT run is a forward + inverse pair so in-place data stays bounded
+
+static arm_cfft_instance_f32 cfft_f32;
+static arm_cfft_instance_q31 cfft_q31;
+static arm_cfft_instance_q15 cfft_q15;
+static arm_rfft_fast_instance_f32 rfft_f32;
+static arm_rfft_instance_q31 rfft_q31_fwd, rfft_q31_inv;
+static arm_rfft_instance_q15 rfft_q15_fwd, rfft_q15_inv;
+
+static int cfft_setup(uint32_t n)
+{
+    bench_load_inputs(2U * n);
+    return arm_cfft_init_f32(&cfft_f32, (uint16_t)n) == ARM_MATH_SUCCESS
+        && arm_cfft_init_q31(&cfft_q31, (uint16_t)n) == ARM_MATH_SUCCESS
+        && arm_cfft_init_q15(&cfft_q15, (uint16_t)n) == ARM_MATH_SUCCESS;
+}
+
+static void cfft_f32_run(uint32_t n)
+{
+    (void)n;
+    arm_cfft_f32(&cfft_f32, f_a, 0, 1);
+    arm_cfft_f32(&cfft_f32, f_a, 1, 1);
+}
+
+static void cfft_q31_run(uint32_t n)
+{
+    (void)n;
+    arm_cfft_q31(&cfft_q31, q31_a, 0, 1);
+    arm_cfft_q31(&cfft_q31, q31_a, 1, 1);
+}
+
+static void cfft_q15_run(uint32_t n)
+{
+    (void)n;
+    arm_cfft_q15(&cfft_q15, q15_a, 0, 1);
+    arm_cfft_q15(&cfft_q15, q15_a, 1, 1);
+}
+
+static int rfft_f32_setup(uint32_t n)
+{
+    bench_load_inputs(n);
+    return arm_rfft_fast_init_f32(&rfft_f32, (uint16_t)n) == ARM_MATH_SUCCESS;
+}
+
+static int rfft_q_setup(uint32_t n)
+{
+    bench_load_inputs(2U * n);
+    return arm_rfft_init_q31(&rfft_q31_fwd, n, 0, 1) == ARM_MATH_SUCCESS
+        && arm_rfft_init_q31(&rfft_q31_inv, n, 1, 1) == ARM_MATH_SUCCESS
+        && arm_rfft_init_q15(&rfft_q15_fwd, n, 0, 1) == ARM_MATH_SUCCESS
+        && arm_rfft_init_q15(&rfft_q15_inv, n, 1, 1) == ARM_MATH_SUCCESS;
+}
+
+static void rfft_f32_run(uint32_t n)
+{
+    (void)n;
+    arm_rfft_fast_f32(&rfft_f32, f_a, f_b, 0);
+    arm_rfft_fast_f32(&rfft_f32, f_b, f_a, 1);
+}
+
+static void rfft_q31_run(uint32_t n)
+{
+    (void)n;
+    arm_rfft_q31(&rfft_q31_fwd, q31_a, q31_b);
+    arm_rfft_q31(&rfft_q31_inv, q31_b, q31_a);
+}
+
+static void rfft_q15_run(uint32_t n)
+{
+    (void)n;
+    arm_rfft_q15(&rfft_q15_fwd, q15_a, q15_b);
+    arm_rfft_q15(&rfft_q15_inv, q15_b, q15_a);
+}
+
+/* ============================================
+   Batched FFT
+   ============================================ */
+
+// BATCH_FRAMES frames per run, batched calls against a loop of single-frame
+// calls on the same data. Forward + inverse pairs, as above.
+
+static float32_t *batch_a, *batch_b;
+
+static int batch_setup(uint32_t n)
+{
+    size_t len = 2U * (size_t)n * BATCH_FRAMES;
+
+    if (!batch_a) {
+        batch_a = malloc(2U * BATCH_MAX_LEN * BATCH_FRAMES * sizeof(float32_t));
+        batch_b = malloc(2U * BATCH_MAX_LEN * BATCH_FRAMES * sizeof(float32_t));
+        if (!batch_a || !batch_b) {
+            return 0;
+        }
+    }
+    for (size_t i = 0; i < len; i++) {
+        batch_a[i] = f_src[i % BENCH_MAX_LEN];
+    }
+    return arm_cfft_init_f32(&cfft_f32, (uint16_t)n) == ARM_MATH_SUCCESS
+        && arm_rfft_fast_init_f32(&rfft_f32, (uint16_t)n) == ARM_MATH_SUCCESS;
+}
+
+static void cfft_loop_run(uint32_t n)
+{
+    for (uint32_t f = 0; f < BATCH_FRAMES; f++) {
+        arm_cfft_f32(&cfft_f32, batch_a + 2U * n * f, 0, 1);
+    }
+    for (uint32_t f = 0; f < BATCH_FRAMES; f++) {
+        arm_cfft_f32(&cfft_f32, batch_a + 2U * n * f, 1, 1);
+    }
+}
+
+static void cfft_batch_run(uint32_t n, arm_fft_batch_layout layout)
+{
+    arm_cfft_batch_f32(&cfft_f32, batch_a, BATCH_FRAMES, 2U * n, layout, 0);
+    arm_cfft_batch_f32(&cfft_f32, batch_a, BATCH_FRAMES, 2U * n, layout, 1);
+}
+
+static void cfft_contig_run(uint32_t n) { cfft_batch_run(n, ARM_FFT_BATCH_CONTIGUOUS); }
+static void cfft_inter_run(uint32_t n)  { cfft_batch_run(n, ARM_FFT_BATCH_INTERLEAVED); }
+
+static void rfft_loop_run(uint32_t n)
+{
+    for (uint32_t f = 0; f < BATCH_FRAMES; f++) {
+        arm_rfft_fast_f32(&rfft_f32, batch_a + n * f, batch_b + n * f, 0);
+    }
+    for (uint32_t f = 0; f < BATCH_FRAMES; f++) {
+        arm_rfft_fast_f32(&rfft_f32, batch_b + n * f, batch_a + n * f, 1);
+    }
+}
+
+static void rfft_batch_run(uint32_t n, arm_fft_batch_layout layout)
+{
+    arm_rfft_fast_batch_f32(&rfft_f32, batch_a, batch_b, BATCH_FRAMES, n, n, layout, 0);
+    arm_rfft_fast_batch_f32(&rfft_f32, batch_b, batch_a, BATCH_FRAMES, n, n, layout, 1);
+}
+
+static void rfft_contig_run(uint32_t n) { rfft_batch_run(n, ARM_FFT_BATCH_CONTIGUOUS); }
+static void rfft_inter_run(uint32_t n)  { rfft_batch_run(n, ARM_FFT_BATCH_INTERLEAVED); }
+
+/* ============================================
+   Matrix Multiply
+   ============================================ */
+
+static arm_matrix_instance_f32 mat_f32[3];
+static arm_matrix_instance_q31 mat_q31[3];
+static arm_matrix_instance_q15 mat_q15[3];
+
+static int mat_setup(uint32_t n)
+{
+    // Scale so q-format dot products of length n do not saturate
+    for (uint32_t i = 0; i < n * n; i++) {
+        f_a[i] = f_src[i] / (float32_t)n;
+        f_b[i] = f_src[i + n * n];
+    }
+    arm_float_to_q31(f_a, q31_a, n * n);
+    arm_float_to_q31(f_b, q31_b, n * n);
+    arm_float_to_q15(f_a, q15_a, n * n);
+    arm_float_to_q15(f_b, q15_b, n * n);
+
+    arm_mat_init_f32(&mat_f32[0], n, n, f_a);
+    arm_mat_init_f32(&mat_f32[1], n, n, f_b);
+    arm_mat_init_f32(&mat_f32[2], n, n, f_c);
+    arm_mat_init_q31(&mat_q31[0], n, n, q31_a);
+    arm_mat_init_q31(&mat_q31[1], n, n, q31_b);
+    arm_mat_init_q31(&mat_q31[2], n, n, q31_c);
+    arm_mat_init_q15(&mat_q15[0], n, n, q15_a);
+    arm_mat_init_q15(&mat_q15[1], n, n, q15_b);
+    arm_mat_init_q15(&mat_q15[2], n, n, q15_c);
+    return 1;
+}
+
+static void mat_f32_run(uint32_t n)      { (void)n; arm_mat_mult_f32(&mat_f32[0], &mat_f32[1], &mat_f32[2]); }
+static void mat_q31_run(uint32_t n)      { (void)n; arm_mat_mult_q31(&mat_q31[0], &mat_q31[1], &mat_q31[2]); }
+static void mat_fast_q31_run(uint32_t n) { (void)n; arm_mat_mult_fast_q31(&mat_q31[0], &mat_q31[1], &mat_q31[2]); }
+static void mat_q15_run(uint32_t n)      { (void)n; arm_mat_mult_q15(&mat_q15[0], &mat_q15[1], &mat_q15[2], q15_state); }
+static void mat_fast_q15_run(uint32_t n) { (void)n; arm_mat_mult_fast_q15(&mat_q15[0], &mat_q15[1], &mat_q15[2], q15_state); }
+
+/* ============================================
+   GEMM
+   ============================================ */
+
+// size = matrix dim; samples = 2 n^3 operations, so the last column reads MFLOP/s
+
+#define GEMM_MAX_DIM    512U
+
+static float32_t gemm_f32_buf[3][GEMM_MAX_DIM * GEMM_MAX_DIM];
+static float32_t gemm_f32_tmp[GEMM_MAX_DIM * GEMM_MAX_DIM];
+static q31_t gemm_q31_buf[3][GEMM_MAX_DIM * GEMM_MAX_DIM];
+static arm_matrix_instance_f32 gemm_f32_mat[4];
+static arm_matrix_instance_q31 gemm_q31_mat[3];
+static arm_mat_gemm_instance_f32 gemm_f32;
+static arm_mat_gemm_instance_q31 gemm_q31;
+
+static int gemm_setup(uint32_t n, arm_mat_op opB, uint32_t numThreads)
+{
+    for (uint32_t i = 0; i < n * n; i++) {
+        gemm_f32_buf[0][i] = f_src[i % BENCH_MAX_LEN] / (float32_t)n;
+        gemm_f32_buf[1][i] = f_src[(i + 7U) % BENCH_MAX_LEN];
+    }
+    arm_float_to_q31(gemm_f32_buf[0], gemm_q31_buf[0], n * n);
+    arm_float_to_q31(gemm_f32_buf[1], gemm_q31_buf[1], n * n);
+
+    for (uint32_t i = 0; i < 3U; i++) {
+        arm_mat_init_f32(&gemm_f32_mat[i], n, n, gemm_f32_buf[i]);
+        arm_mat_init_q31(&gemm_q31_mat[i], n, n, gemm_q31_buf[i]);
+    }
+    arm_mat_init_f32(&gemm_f32_mat[3], n, n, gemm_f32_tmp);
+    arm_mat_gemm_init_f32(&gemm_f32, ARM_MAT_NOTRANS, opB, numThreads);
+    arm_mat_gemm_init_q31(&gemm_q31, ARM_MAT_NOTRANS, opB, numThreads);
+    return 1;
+}
+
+static int gemm_nn_setup(uint32_t n) { return gemm_setup(n, ARM_MAT_NOTRANS, 1U); }
+static int gemm_nt_setup(uint32_t n) { return gemm_setup(n, ARM_MAT_TRANS, 1U); }
+static int gemm_mt_setup(uint32_t n) { return gemm_setup(n, ARM_MAT_NOTRANS, 0U); }
+
+static void gemm_mult_f32_run(uint32_t n)
+{
+    (void)n;
+    arm_mat_mult_f32(&gemm_f32_mat[0], &gemm_f32_mat[1], &gemm_f32_mat[2]);
+}
+
+static void gemm_trans_mult_f32_run(uint32_t n)
+{
+    // A * B^T the old way: explicit transpose, then multiply
+    (void)n;
+    arm_mat_trans_f32(&gemm_f32_mat[1], &gemm_f32_mat[3]);
+    arm_mat_mult_f32(&gemm_f32_mat[0], &gemm_f32_mat[3], &gemm_f32_mat[2]);
+}
+
+static void gemm_f32_run(uint32_t n)
+{
+    (void)n;
+    arm_mat_gemm_f32(&gemm_f32, &gemm_f32_mat[0], &gemm_f32_mat[1], &gemm_f32_mat[2]);
+}
+
+static void gemm_mult_q31_run(uint32_t n)
+{
+    (void)n;
+    arm_mat_mult_q31(&gemm_q31_mat[0], &gemm_q31_mat[1], &gemm_q31_mat[2]);
+}
+
+static void gemm_q31_run(uint32_t n)
+{
+    (void)n;
+    arm_mat_gemm_q31(&gemm_q31, &gemm_q31_mat[0], &gemm_q31_mat[1], &gemm_q31_mat[2]);
+}
+
+/* ============================================
+   SVM / Naive Bayes
+   ============================================ */
+
+// size = support vectors (SVM) or classes (Bayes); samples = feature vectors
+// classified per call, so the last column reads million vectors per second
+
+#define CLS_VECTORS     100U        // One second of 10 ms feature frames
+#define CLS_MAX_DIM     40U
+#define CLS_MAX_SV      256U
+#define CLS_MAX_CLASSES 16U
+
+static float32_t cls_sv[CLS_MAX_SV * CLS_MAX_DIM], cls_alpha[CLS_MAX_SV];
+static float32_t cls_in[CLS_VECTORS * CLS_MAX_DIM];
+static float32_t cls_theta[CLS_MAX_CLASSES * CLS_MAX_DIM], cls_sigma[CLS_MAX_CLASSES * CLS_MAX_DIM];
+static float32_t cls_prior[CLS_MAX_CLASSES], cls_prob[CLS_MAX_CLASSES];
+static float32_t cls_scratch[ARM_SVM_RBF_BATCH_SCRATCH_SIZE(CLS_MAX_SV, CLS_MAX_DIM)
+                           + ARM_GAUSSIAN_NAIVE_BAYES_BATCH_SCRATCH_SIZE(CLS_MAX_DIM, CLS_MAX_CLASSES)];
+static int32_t cls_svm_out[CLS_VECTORS];
+static uint32_t cls_bayes_out[CLS_VECTORS];
+static const int32_t cls_labels[2] = { 0, 1 };
+static arm_svm_linear_instance_f32 svm_linear;
+static arm_svm_rbf_instance_f32 svm_rbf;
+static arm_gaussian_naive_bayes_instance_f32 bayes;
+
+static int cls_setup(uint32_t n, uint32_t dim)
+{
+    uint32_t numSV = (n < CLS_MAX_SV) ? n : CLS_MAX_SV;
+    uint32_t numClasses = (n < CLS_MAX_CLASSES) ? n : CLS_MAX_CLASSES;
+
+    for (uint32_t i = 0; i < numSV * dim; i++) {
+        cls_sv[i] = f_src[i % BENCH_MAX_LEN];
+    }
+    for (uint32_t i = 0; i < numSV; i++) {
+        cls_alpha[i] = f_src[(i + 11U) % BENCH_MAX_LEN];
+    }
+    for (uint32_t i = 0; i < CLS_VECTORS * dim; i++) {
+        cls_in[i] = f_src[(i + 7U) % BENCH_MAX_LEN];
+    }
+    for (uint32_t i = 0; i < numClasses * dim; i++) {
+        cls_theta[i] = f_src[(i + 3U) % BENCH_MAX_LEN];
+        cls_sigma[i] = 0.6f + f_src[(i + 5U) % BENCH_MAX_LEN];
+    }
+    for (uint32_t i = 0; i < numClasses; i++) {
+        cls_prior[i] = 1.0f / (float32_t)numClasses;
+    }
+
+    arm_svm_linear_init_f32(&svm_linear, numSV, dim, 0.1f, cls_alpha, cls_sv, cls_labels);
+    arm_svm_rbf_init_f32(&svm_rbf, numSV, dim, 0.1f, cls_alpha, cls_sv, cls_labels, 1.0f / (float32_t)dim);
+    bayes.vectorDimension = dim;
+    bayes.numberOfClasses = numClasses;
+    bayes.theta = cls_theta;
+    bayes.sigma = cls_sigma;
+    bayes.classPriors = cls_prior;
+    bayes.epsilon = 1e-9f;
+    return 1;
+}
+
+static int cls_d13_setup(uint32_t n) { return cls_setup(n, MFCC_DCT); }
+static int cls_d40_setup(uint32_t n) { return cls_setup(n, MFCC_MEL); }
+
+static void svm_linear_loop_run(uint32_t n)
+{
+    (void)n;
+    for (uint32_t i = 0; i < CLS_VECTORS; i++) {
+        arm_svm_linear_predict_f32(&svm_linear, cls_in + i * svm_linear.vectorDimension, &cls_svm_out[i]);
+    }
+}
+
+static void svm_linear_batch_run(uint32_t n)
+{
+    (void)n;
+    arm_svm_linear_predict_batch_f32(&svm_linear, cls_in, CLS_VECTORS, cls_scratch, cls_svm_out);
+}
+
+static void svm_rbf_loop_run(uint32_t n)
+{
+    (void)n;
+    for (uint32_t i = 0; i < CLS_VECTORS; i++) {
+        arm_svm_rbf_predict_f32(&svm_rbf, cls_in + i * svm_rbf.vectorDimension, &cls_svm_out[i]);
+    }
+}
+
+static void svm_rbf_batch_run(uint32_t n)
+{
+    (void)n;
+    arm_svm_rbf_predict_batch_f32(&svm_rbf, cls_in, CLS_VECTORS, cls_scratch, cls_svm_out);
+}
+
+static void bayes_loop_run(uint32_t n)
+{
+    (void)n;
+    for (uint32_t i = 0; i < CLS_VECTORS; i++) {
+        cls_bayes_out[i] = arm_gaussian_naive_bayes_predict_f32(&bayes, cls_in + i * bayes.vectorDimension,
+                                                                cls_prob, cls_scratch);
+    }
+}
+
+static void bayes_batch_run(uint32_t n)
+{
+    (void)n;
+    arm_gaussian_naive_bayes_predict_batch_f32(&bayes, cls_in, CLS_VECTORS, NULL, cls_scratch, cls_bayes_out);
+}
+
+/* ============================================
+   MFCC
+   ============================================ */
+
+static arm_mfcc_instance_f32 mfcc_f32;
+static arm_mfcc_instance_q31 mfcc_q31;
+static arm_mfcc_instance_q15 mfcc_q15;
+
+static uint32_t mel_pos[MFCC_MEL], mel_len[MFCC_MEL];
+static float32_t mel_f32[BENCH_MAX_LEN / 4U], dct_f32[MFCC_MEL * MFCC_DCT], win_f32[BENCH_MAX_LEN / 4U];
+static q31_t mel_q31[BENCH_MAX_LEN / 4U], dct_q31[MFCC_MEL * MFCC_DCT], win_q31[BENCH_MAX_LEN / 4U];
+static q15_t mel_q15[BENCH_MAX_LEN / 4U], dct_q15[MFCC_MEL * MFCC_DCT], win_q15[BENCH_MAX_LEN / 4U];
+
+static float32_t hz_to_mel(float32_t hz) { return 1127.0f * logf(1.0f + hz / 700.0f); }
+static float32_t mel_to_hz(float32_t m)  { return 700.0f * (expf(m / 1127.0f) - 1.0f); }
+
+/**
+ * @brief Build Hann window, triangular mel filterbank and DCT-II matrix for fft_len
+ * @return Total number of filterbank coefficients
+ */
+static uint32_t mfcc_tables(uint32_t fft_len)
+{
+    uint32_t bins[MFCC_MEL + 2U];
+    float32_t mel_lo = hz_to_mel(20.0f);
+    float32_t mel_hi = hz_to_mel(MFCC_FS / 2.0f);
+    uint32_t total = 0;
+
+    for (uint32_t i = 0; i < fft_len; i++) {
+        win_f32[i] = 0.5f - 0.5f * cosf(2.0f * PI * i / fft_len);
+    }
+
+    for (uint32_t i = 0; i < MFCC_MEL + 2U; i++) {
+        float32_t hz = mel_to_hz(mel_lo + (mel_hi - mel_lo) * i / (MFCC_MEL + 1U));
+        bins[i] = (uint32_t)(hz * fft_len / MFCC_FS + 0.5f);
+    }
+
+    for (uint32_t m = 0; m < MFCC_MEL; m++) {
+        uint32_t lo = bins[m], mid = bins[m + 1U], hi = bins[m + 2U];
+        if (mid <= lo) mid = lo + 1U;
+        if (hi <= mid) hi = mid + 1U;
+
+        mel_pos[m] = lo + 1U;
+        mel_len[m] = hi - lo - 1U;
+        for (uint32_t k = lo + 1U; k < hi; k++) {
+            mel_f32[total++] = (k <= mid) ? (float32_t)(k - lo) / (mid - lo)
+                                          : (float32_t)(hi - k) / (hi - mid);
+        }
+    }
+
+    for (uint32_t k = 0; k < MFCC_DCT; k++) {
+        for (uint32_t n = 0; n < MFCC_MEL; n++) {
+            dct_f32[k * MFCC_MEL + n] = sqrtf(2.0f / MFCC_MEL) * cosf(PI / MFCC_MEL * (n + 0.5f) * k);
+        }
+    }
+
+    arm_float_to_q31(win_f32, win_q31, fft_len);
+    arm_float_to_q15(win_f32, win_q15, fft_len);
+    arm_float_to_q31(mel_f32, mel_q31, total);
+    arm_float_to_q15(mel_f32, mel_q15, total);
+    arm_float_to_q31(dct_f32, dct_q31, MFCC_MEL * MFCC_DCT);
+    arm_float_to_q15(dct_f32, dct_q15, MFCC_MEL * MFCC_DCT);
+    return total;
+}
+
+static int mfcc_setup(uint32_t n)
+{
+    mfcc_tables(n);
+    return arm_mfcc_init_f32(&mfcc_f32, n, MFCC_MEL, MFCC_DCT, dct_f32, mel_pos, mel_len, mel_f32, win_f32) == ARM_MATH_SUCCESS
+        && arm_mfcc_init_q31(&mfcc_q31, n, MFCC_MEL, MFCC_DCT, dct_q31, mel_pos, mel_len, mel_q31, win_q31) == ARM_MATH_SUCCESS
+        && arm_mfcc_init_q15(&mfcc_q15, n, MFCC_MEL, MFCC_DCT, dct_q15, mel_pos, mel_len, mel_q15, win_q15) == ARM_MATH_SUCCESS;
+}
+
+// arm_mfcc_* work in place on their input, so each frame starts from a fresh copy
+static void mfcc_f32_run(uint32_t n)
+{
+    memcpy(f_a, f_src, n * sizeof(float32_t));
+    arm_mfcc_f32(&mfcc_f32, f_a, f_b, f_c);
+}
+
+static void mfcc_q31_run(uint32_t n)
+{
+    memcpy(q31_a, q31_src, n * sizeof(q31_t));
+    arm_mfcc_q31(&mfcc_q31, q31_a, q31_b, q31_c);
+}
+
+static void mfcc_q15_run(uint32_t n)
+{
+    memcpy(q15_a, q15_src, n * sizeof(q15_t));
+    arm_mfcc_q15(&mfcc_q15, q15_a, q15_b, q31_c);
+}
+
+/* ============================================
+   Sorting
+   ============================================ */
+
+// Out-of-place: every call re-sorts the same unsorted source
+
+static arm_sort_instance_f32 sort_f32;
+static arm_merge_sort_instance_f32 merge_f32;
+
+static int sort_setup_alg(uint32_t n, arm_sort_alg alg)
+{
+    (void)n;
+    arm_sort_init_f32(&sort_f32, alg, ARM_SORT_ASCENDING);
+    return 1;
+}
+
+static int sort_bitonic_setup(uint32_t n)   { return sort_setup_alg(n, ARM_SORT_BITONIC); }
+static int sort_bubble_setup(uint32_t n)    { return sort_setup_alg(n, ARM_SORT_BUBBLE); }
+static int sort_heap_setup(uint32_t n)      { return sort_setup_alg(n, ARM_SORT_HEAP); }
+static int sort_insertion_setup(uint32_t n) { return sort_setup_alg(n, ARM_SORT_INSERTION); }
+static int sort_quick_setup(uint32_t n)     { return sort_setup_alg(n, ARM_SORT_QUICK); }
+static int sort_selection_setup(uint32_t n) { return sort_setup_alg(n, ARM_SORT_SELECTION); }
+
+static int sort_merge_setup(uint32_t n)
+{
+    (void)n;
+    arm_merge_sort_init_f32(&merge_f32, ARM_SORT_ASCENDING, f_c);
+    return 1;
+}
+
+static void sort_f32_run(uint32_t n)  { arm_sort_f32(&sort_f32, f_src, f_b, n); }
+static void merge_f32_run(uint32_t n) { arm_merge_sort_f32(&merge_f32, f_src, f_b, n); }
+
+// Radix sort, argsort and top-k share one scratch buffer
+
+#define TOPK_K  8U                      // Spectral peaks per frame
+
+static arm_radix_sort_instance_f32 radix_f32, topk_f32;
+static arm_radix_sort_instance_q31 radix_q31;
+static arm_radix_sort_instance_q15 radix_q15;
+static uint64_t radix_scratch[ARM_RADIX_ARGSORT_SCRATCH_SIZE(BENCH_MAX_LEN)];
+static uint32_t radix_index[BENCH_MAX_LEN];
+
+static int radix_setup_threads(uint32_t threads)
+{
+    arm_radix_sort_init_f32(&radix_f32, ARM_SORT_ASCENDING, threads, radix_scratch);
+    arm_radix_sort_init_q31(&radix_q31, ARM_SORT_ASCENDING, threads, radix_scratch);
+    arm_radix_sort_init_q15(&radix_q15, ARM_SORT_ASCENDING, threads, radix_scratch);
+    arm_radix_sort_init_f32(&topk_f32, ARM_SORT_DESCENDING, 1U, radix_scratch);
+    return 1;
+}
+
+static int radix_setup(uint32_t n)    { (void)n; return radix_setup_threads(1U); }
+static int radix_mt_setup(uint32_t n) { (void)n; return radix_setup_threads(0U); }
+
+static void radix_f32_run(uint32_t n)   { arm_radix_sort_f32(&radix_f32, f_src, f_b, n); }
+static void radix_q31_run(uint32_t n)   { arm_radix_sort_q31(&radix_q31, q31_src, q31_b, n); }
+static void radix_q15_run(uint32_t n)   { arm_radix_sort_q15(&radix_q15, q15_src, q15_b, n); }
+static void argsort_f32_run(uint32_t n) { arm_radix_argsort_f32(&radix_f32, f_src, f_b, radix_index, n); }
+static void topk_f32_run(uint32_t n)    { arm_topk_f32(&topk_f32, f_src, n, TOPK_K, f_b, radix_index); }
+
+/* ============================================
+   Distance Matrix / k-NN
+   ============================================ */
+
+// size = number of vectors on each side, all pairs per call
+
+#define DIST_MAX_VEC    256U
+#define KNN_REFS        1024U           // Enrolled templates
+#define KNN_K           5U
+
+static arm_distance_matrix_instance_f32 dist_f32;
+static arm_knn_instance_f32 knn_f32;
+static float32_t dist_out[DIST_MAX_VEC * DIST_MAX_VEC];
+static float32_t dist_norms[ARM_KNN_NORMS_SIZE(KNN_REFS, 13U)];     // Also >= ARM_DISTANCE_NORMS_SIZE(256, 256, 40)
+static float32_t knn_dist[ARM_KNN_DIST_SIZE(KNN_REFS)], knn_best[ARM_KNN_QUERY_BLOCK * KNN_K];
+static uint32_t knn_index[ARM_KNN_QUERY_BLOCK * KNN_K];
+static uint64_t knn_heap[KNN_K];
+static uint32_t dist_dim;
+static arm_distance_metric dist_metric;
+
+static int dist_setup(uint32_t n, uint32_t dim, arm_distance_metric metric)
+{
+    (void)n;
+    dist_dim = dim;
+    dist_metric = metric;
+    arm_distance_matrix_init_f32(&dist_f32, metric, 1U, dist_norms);
+    return 1;
+}
+
+static int dist_euclid13_setup(uint32_t n) { return dist_setup(n, 13U, ARM_DISTANCE_EUCLIDEAN); }
+static int dist_euclid40_setup(uint32_t n) { return dist_setup(n, 40U, ARM_DISTANCE_EUCLIDEAN); }
+static int dist_city40_setup(uint32_t n)   { return dist_setup(n, 40U, ARM_DISTANCE_CITYBLOCK); }
+
+static void dist_matrix_run(uint32_t n)
+{
+    arm_distance_matrix_f32(&dist_f32, f_src, n, f_src + 8192U, n, dist_dim, dist_out);
+}
+
+static void dist_loop_run(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        for (uint32_t j = 0; j < n; j++) {
+            const float32_t *a = f_src + i * dist_dim, *b = f_src + 8192U + j * dist_dim;
+            dist_out[i * n + j] = (dist_metric == ARM_DISTANCE_CITYBLOCK)
+                                ? arm_cityblock_distance_f32(a, b, dist_dim)
+                                : arm_euclidean_distance_f32(a, b, dist_dim);
+        }
+    }
+}
+
+static int knn_setup(uint32_t n)
+{
+    (void)n;
+    return arm_knn_init_f32(&knn_f32, ARM_DISTANCE_EUCLIDEAN, f_src, KNN_REFS, 13U, KNN_K, 1U,
+                            dist_norms, knn_dist, knn_heap) == ARM_MATH_SUCCESS;
+}
+
+static void knn_run(uint32_t n) { arm_knn_f32(&knn_f32, f_src + 8192U, n, KNN_K, knn_best, knn_index); }
+
+/* ============================================
+   Case List
+   ============================================ */
+
+#define FFT_SIZES(kernel, type, params, setup, run) \
+    { kernel, type, params,   16U,   16U, 2U, setup, run }, \
+    { kernel, type, params,   32U,   32U, 2U, setup, run }, \
+    { kernel, type, params,   64U,   64U, 2U, setup, run }, \
+    { kernel, type, params,  128U,  128U, 2U, setup, run }, \
+    { kernel, type, params,  256U,  256U, 2U, setup, run }, \
+    { kernel, type, params,  512U,  512U, 2U, setup, run }, \
+    { kernel, type, params, 1024U, 1024U, 2U, setup, run }, \
+    { kernel, type, params, 2048U, 2048U, 2U, setup, run }, \
+    { kernel, type, params, 4096U, 4096U, 2U, setup, run }
+
+#define BATCH_SIZES(kernel, params, run) \
+    { kernel, "f32", params,  256U,  256U * BATCH_FRAMES, 2U, batch_setup, run }, \
+    { kernel, "f32", params,  512U,  512U * BATCH_FRAMES, 2U, batch_setup, run }, \
+    { kernel, "f32", params, 1024U, 1024U * BATCH_FRAMES, 2U, batch_setup, run }, \
+    { kernel, "f32", params, 2048U, 2048U * BATCH_FRAMES, 2U, batch_setup, run }, \
+    { kernel, "f32", params, 4096U, 4096U * BATCH_FRAMES, 2U, batch_setup, run }
+
+#define FIR_LONG_TAPS(params, block, setup, run) \
+    { "fir_long", "f32", params,   16U, block, 1U, setup, run }, \
+    { "fir_long", "f32", params,   32U, block, 1U, setup, run }, \
+    { "fir_long", "f32", params,   64U, block, 1U, setup, run }, \
+    { "fir_long", "f32", params,  128U, block, 1U, setup, run }, \
+    { "fir_long", "f32", params,  256U, block, 1U, setup, run }, \
+    { "fir_long", "f32", params,  512U, block, 1U, setup, run }, \
+    { "fir_long", "f32", params, 1024U, block, 1U, setup, run }, \
+    { "fir_long", "f32", params, 2048U, block, 1U, setup, run }, \
+    { "fir_long", "f32", params, FIR_LONG_MAX_TAPS, block, 1U, setup, run }
+
+#define MAT_SIZES(kernel, type, run) \
+    { kernel, type, "square",  8U,   64U, 1U, mat_setup, run }, \
+    { kernel, type, "square", 16U,  256U, 1U, mat_setup, run }, \
+    { kernel, type, "square", 32U, 1024U, 1U, mat_setup, run }, \
+    { kernel, type, "square", 64U, 4096U, 1U, mat_setup, run }
+
+#define GEMM_SIZES(kernel, type, params, setup, run) \
+    { kernel, type, params,  64U, 2U *  64U *  64U *  64U, 1U, setup, run }, \
+    { kernel, type, params, 128U, 2U * 128U * 128U * 128U, 1U, setup, run }, \
+    { kernel, type, params, 256U, 2U * 256U * 256U * 256U, 1U, setup, run }, \
+    { kernel, type, params, 512U, 2U * 512U * 512U * 512U, 1U, setup, run }
+
+#define SORT_SIZES(kernel, setup, run) \
+    { kernel, "f32", "random",   64U,   64U, 1U, setup, run }, \
+    { kernel, "f32", "random",  256U,  256U, 1U, setup, run }, \
+    { kernel, "f32", "random", 1024U, 1024U, 1U, setup, run }
+
+static const bench_case_t bench_cases[] = {
+    { "fir",              "f32", "taps=64",       FIR_BLOCK, FIR_BLOCK, 1U, fir_setup, fir_f32_run },
+    { "fir",              "q31", "taps=64",       FIR_BLOCK, FIR_BLOCK, 1U, fir_setup, fir_q31_run },
+    { "fir_fast",         "q31", "taps=64",       FIR_BLOCK, FIR_BLOCK, 1U, fir_setup, fir_fast_q31_run },
+    { "fir",              "q15", "taps=64",       FIR_BLOCK, FIR_BLOCK, 1U, fir_setup, fir_q15_run },
+    { "fir_fast",         "q15", "taps=64",       FIR_BLOCK, FIR_BLOCK, 1U, fir_setup, fir_fast_q15_run },
+    { "fir_decimate",     "f32", "taps=64 m=4",   FIR_BLOCK, FIR_BLOCK, 1U, decim_setup, decim_f32_run },
+    { "fir_decimate",     "q31", "taps=64 m=4",   FIR_BLOCK, FIR_BLOCK, 1U, decim_setup, decim_q31_run },
+    { "fir_decimate",     "q15", "taps=64 m=4",   FIR_BLOCK, FIR_BLOCK, 1U, decim_setup, decim_q15_run },
+    FIR_LONG_TAPS("block=64 direct",  64U,  fir_long64_setup,  fir_long_direct_run),
+    FIR_LONG_TAPS("block=64 fft",     64U,  fir_long64_setup,  fir_long_fft_run),
+    FIR_LONG_TAPS("block=64 auto",    64U,  fir_long64_setup,  fir_long_auto_run),
+    FIR_LONG_TAPS("block=256 direct", 256U, fir_long256_setup, fir_long_direct_run),
+    FIR_LONG_TAPS("block=256 fft",    256U, fir_long256_setup, fir_long_fft_run),
+    FIR_LONG_TAPS("block=256 auto",   256U, fir_long256_setup, fir_long_auto_run),
+    { "resample",         "f32", "44k1-48k poly8",  441U, 441U, 1U, rs_44k1_fast_setup, rs_poly_f32_run },
+    { "resample",         "f32", "44k1-48k poly16", 441U, 441U, 1U, rs_44k1_bal_setup,  rs_poly_f32_run },
+    { "resample",         "f32", "44k1-48k poly32", 441U, 441U, 1U, rs_44k1_best_setup, rs_poly_f32_run },
+    { "resample",         "f32", "44k1-48k frac8",  441U, 441U, 1U, rs_44k1_fast_setup, rs_frac_f32_run },
+    { "resample",         "f32", "44k1-48k frac16", 441U, 441U, 1U, rs_44k1_bal_setup,  rs_frac_f32_run },
+    { "resample",         "f32", "44k1-48k frac32", 441U, 441U, 1U, rs_44k1_best_setup, rs_frac_f32_run },
+    { "resample",         "f32", "44k1-48k chain",  441U, 441U, 1U, rs_chain_44k1_setup, rs_chain_f32_run },
+    { "resample",         "f32", "48k-16k poly16",  480U, 480U, 1U, rs_48k_16k_setup,   rs_poly_f32_run },
+    { "resample",         "f32", "48k-16k frac16",  480U, 480U, 1U, rs_48k_16k_setup,   rs_frac_f32_run },
+    { "resample",         "f32", "48k-16k chain",   480U, 480U, 1U, rs_chain_48k_setup, rs_chain_f32_run },
+    { "resample",         "f32", "16k-48k poly16",  160U, 160U, 1U, rs_16k_48k_setup,   rs_poly_f32_run },
+    { "resample",         "f32", "16k-48k frac16",  160U, 160U, 1U, rs_16k_48k_setup,   rs_frac_f32_run },
+    { "resample",         "f32", "16k-48k chain",   160U, 160U, 1U, rs_chain_16k_setup, rs_chain_f32_run },
+    { "resample",         "q15", "44k1-48k poly16", 441U, 441U, 1U, rs_44k1_bal_setup,  rs_poly_q15_run },
+    { "resample",         "q15", "44k1-48k frac16", 441U, 441U, 1U, rs_44k1_bal_setup,  rs_frac_q15_run },
+    { "resample",         "q15", "44k1-48k chain",  441U, 441U, 1U, rs_chain_44k1_setup, rs_chain_q15_run },
+    { "resample",         "q15", "48k-16k poly16",  480U, 480U, 1U, rs_48k_16k_setup,   rs_poly_q15_run },
+    { "resample",         "q15", "48k-16k frac16",  480U, 480U, 1U, rs_48k_16k_setup,   rs_frac_q15_run },
+    { "resample",         "q15", "48k-16k chain",   480U, 480U, 1U, rs_chain_48k_setup, rs_chain_q15_run },
+    { "resample",         "q15", "16k-48k poly16",  160U, 160U, 1U, rs_16k_48k_setup,   rs_poly_q15_run },
+    { "resample",         "q15", "16k-48k frac16",  160U, 160U, 1U, rs_16k_48k_setup,   rs_frac_q15_run },
+    { "resample",         "q15", "16k-48k chain",   160U, 160U, 1U, rs_chain_16k_setup, rs_chain_q15_run },
+
+    { "biquad_df1",       "f32", "stages=4", BIQUAD_BLOCK, BIQUAD_BLOCK, 1U, biquad_setup, bq_df1_f32_run },
+    { "biquad_df2T",      "f32", "stages=4", BIQUAD_BLOCK, BIQUAD_BLOCK, 1U, biquad_setup, bq_df2t_f32_run },
+    { "biquad_df1",       "q31", "stages=4", BIQUAD_BLOCK, BIQUAD_BLOCK, 1U, biquad_setup, bq_df1_q31_run },
+    { "biquad_df1_fast",  "q31", "stages=4", BIQUAD_BLOCK, BIQUAD_BLOCK, 1U, biquad_setup, bq_df1_fast_q31_run },
+    { "biquad_df1",       "q15", "stages=4", BIQUAD_BLOCK, BIQUAD_BLOCK, 1U, biquad_setup, bq_df1_q15_run },
+    { "biquad_df1_fast",  "q15", "stages=4", BIQUAD_BLOCK, BIQUAD_BLOCK, 1U, biquad_setup, bq_df1_fast_q15_run },
+    { "biquad_multich",   "f32", "ch=4 loop",    BIQUAD_BLOCK, BIQUAD_BLOCK     , 4U, bq_ch4_setup, bq_loop4_f32_run },
+    { "biquad_multich",   "f32", "ch=4 df2T",    BIQUAD_BLOCK, 4U * BIQUAD_BLOCK, 1U, bq_ch4_setup, bq_mc_f32_run },
+    { "biquad_multich",   "f32", "ch=8 loop",    BIQUAD_BLOCK, BIQUAD_BLOCK     , 8U, bq_ch8_setup, bq_loop8_f32_run },
+    { "biquad_multich",   "f32", "ch=8 df2T",    BIQUAD_BLOCK, 8U * BIQUAD_BLOCK, 1U, bq_ch8_setup, bq_mc_f32_run },
+    { "biquad_multich",   "q31", "ch=4 loop",    BIQUAD_BLOCK, BIQUAD_BLOCK     , 4U, bq_ch4_setup, bq_loop4_q31_run },
+    { "biquad_multich",   "q31", "ch=4 df1",     BIQUAD_BLOCK, 4U * BIQUAD_BLOCK, 1U, bq_ch4_setup, bq_mc_q31_run },
+    { "biquad_multich",   "q31", "ch=8 loop",    BIQUAD_BLOCK, BIQUAD_BLOCK     , 8U, bq_ch8_setup, bq_loop8_q31_run },
+    { "biquad_multich",   "q31", "ch=8 df1",     BIQUAD_BLOCK, 8U * BIQUAD_BLOCK, 1U, bq_ch8_setup, bq_mc_q31_run },
+
+    { "dot_prod",  "f32", "",  1024U, 1024U, 1U, vec_setup, dot_f32_run },
+    { "dot_prod",  "q31", "",  1024U, 1024U, 1U, vec_setup, dot_q31_run },
+    { "dot_prod",  "q15", "",  1024U, 1024U, 1U, vec_setup, dot_q15_run },
+    { "cmplx_mag", "f32", "",   512U,  512U, 1U, vec_setup, mag_f32_run },
+    { "cmplx_mag", "q31", "",   512U,  512U, 1U, vec_setup, mag_q31_run },
+    { "cmplx_mag", "q15", "",   512U,  512U, 1U, vec_setup, mag_q15_run },
+
+    FFT_SIZES("cfft", "f32", "fwd+inv", cfft_setup, cfft_f32_run),
+    FFT_SIZES("cfft", "q31", "fwd+inv", cfft_setup, cfft_q31_run),
+    FFT_SIZES("cfft", "q15", "fwd+inv", cfft_setup, cfft_q15_run),
+    { "rfft_fast", "f32", "fwd+inv",   32U,   32U, 2U, rfft_f32_setup, rfft_f32_run },
+    { "rfft_fast", "f32", "fwd+inv",   64U,   64U, 2U, rfft_f32_setup, rfft_f32_run },
+    { "rfft_fast", "f32", "fwd+inv",  128U,  128U, 2U, rfft_f32_setup, rfft_f32_run },
+    { "rfft_fast", "f32", "fwd+inv",  256U,  256U, 2U, rfft_f32_setup, rfft_f32_run },
+    { "rfft_fast", "f32", "fwd+inv",  512U,  512U, 2U, rfft_f32_setup, rfft_f32_run },
+    { "rfft_fast", "f32", "fwd+inv", 1024U, 1024U, 2U, rfft_f32_setup, rfft_f32_run },
+    { "rfft_fast", "f32", "fwd+inv", 2048U, 2048U, 2U, rfft_f32_setup, rfft_f32_run },
+    { "rfft_fast", "f32", "fwd+inv", 4096U, 4096U, 2U, rfft_f32_setup, rfft_f32_run },
+    BATCH_SIZES("cfft_batch", "x64 loop",        cfft_loop_run),
+    BATCH_SIZES("cfft_batch", "x64 contiguous",  cfft_contig_run),
+    BATCH_SIZES("cfft_batch", "x64 interleaved", cfft_inter_run),
+    BATCH_SIZES("rfft_fast_batch", "x64 loop",        rfft_loop_run),
+    BATCH_SIZES("rfft_fast_batch", "x64 contiguous",  rfft_contig_run),
+    BATCH_SIZES("rfft_fast_batch", "x64 interleaved", rfft_inter_run),
+    { "rfft",      "q31", "fwd+inv",   32U,   32U, 2U, rfft_q_setup, rfft_q31_run },
+    { "rfft",      "q31", "fwd+inv",   64U,   64U, 2U, rfft_q_setup, rfft_q31_run },
+    { "rfft",      "q31", "fwd+inv",  128U,  128U, 2U, rfft_q_setup, rfft_q31_run },
+    { "rfft",      "q31", "fwd+inv",  256U,  256U, 2U, rfft_q_setup, rfft_q31_run },
+    { "rfft",      "q31", "fwd+inv",  512U,  512U, 2U, rfft_q_setup, rfft_q31_run },
+    { "rfft",      "q31", "fwd+inv", 1024U, 1024U, 2U, rfft_q_setup, rfft_q31_run },
+    { "rfft",      "q31", "fwd+inv", 2048U, 2048U, 2U, rfft_q_setup, rfft_q31_run },
+    { "rfft",      "q31", "fwd+inv", 4096U, 4096U, 2U, rfft_q_setup, rfft_q31_run },
+    { "rfft",      "q31", "fwd+inv", 8192U, 8192U, 2U, rfft_q_setup, rfft_q31_run },
+    { "rfft",      "q15", "fwd+inv",   32U,   32U, 2U, rfft_q_setup, rfft_q15_run },
+    { "rfft",      "q15", "fwd+inv",   64U,   64U, 2U, rfft_q_setup, rfft_q15_run },
+    { "rfft",      "q15", "fwd+inv",  128U,  128U, 2U, rfft_q_setup, rfft_q15_run },
+    { "rfft",      "q15", "fwd+inv",  256U,  256U, 2U, rfft_q_setup, rfft_q15_run },
+    { "rfft",      "q15", "fwd+inv",  512U,  512U, 2U, rfft_q_setup, rfft_q15_run },
+    { "rfft",      "q15", "fwd+inv", 1024U, 1024U, 2U, rfft_q_setup, rfft_q15_run },
+    { "rfft",      "q15", "fwd+inv", 2048U, 2048U, 2U, rfft_q_setup, rfft_q15_run },
+    { "rfft",      "q15", "fwd+inv", 4096U, 4096U, 2U, rfft_q_setup, rfft_q15_run },
+    { "rfft",      "q15", "fwd+inv", 8192U, 8192U, 2U, rfft_q_setup, rfft_q15_run },
+
+    MAT_SIZES("mat_mult",      "f32", mat_f32_run),
+    MAT_SIZES("mat_mult",      "q31", mat_q31_run),
+    MAT_SIZES("mat_mult_fast", "q31", mat_fast_q31_run),
+    MAT_SIZES("mat_mult",      "q15", mat_q15_run),
+    MAT_SIZES("mat_mult_fast", "q15", mat_fast_q15_run),
+
+    GEMM_SIZES("gemm_mult",  "f32", "A*B",          gemm_nn_setup, gemm_mult_f32_run),
+    GEMM_SIZES("gemm",       "f32", "A*B",          gemm_nn_setup, gemm_f32_run),
+    GEMM_SIZES("gemm",       "f32", "A*B threads",  gemm_mt_setup, gemm_f32_run),
+    GEMM_SIZES("gemm_trans", "f32", "A*B^T",        gemm_nn_setup, gemm_trans_mult_f32_run),
+    GEMM_SIZES("gemm",       "f32", "A*B^T",        gemm_nt_setup, gemm_f32_run),
+    GEMM_SIZES("gemm_mult",  "q31", "A*B",          gemm_nn_setup, gemm_mult_q31_run),
+    GEMM_SIZES("gemm",       "q31", "A*B",          gemm_nn_setup, gemm_q31_run),
+    GEMM_SIZES("gemm",       "q31", "A*B^T",        gemm_nt_setup, gemm_q31_run),
+
+    { "svm_linear",  "f32", "d=13 loop",   64U, CLS_VECTORS, 1U, cls_d13_setup, svm_linear_loop_run },
+    { "svm_linear",  "f32", "d=13 batch",  64U, CLS_VECTORS, 1U, cls_d13_setup, svm_linear_batch_run },
+    { "svm_linear",  "f32", "d=40 loop",  256U, CLS_VECTORS, 1U, cls_d40_setup, svm_linear_loop_run },
+    { "svm_linear",  "f32", "d=40 batch", 256U, CLS_VECTORS, 1U, cls_d40_setup, svm_linear_batch_run },
+    { "svm_rbf",     "f32", "d=13 loop",   64U, CLS_VECTORS, 1U, cls_d13_setup, svm_rbf_loop_run },
+    { "svm_rbf",     "f32", "d=13 batch",  64U, CLS_VECTORS, 1U, cls_d13_setup, svm_rbf_batch_run },
+    { "svm_rbf",     "f32", "d=40 loop",  256U, CLS_VECTORS, 1U, cls_d40_setup, svm_rbf_loop_run },
+    { "svm_rbf",     "f32", "d=40 batch", 256U, CLS_VECTORS, 1U, cls_d40_setup, svm_rbf_batch_run },
+    { "naive_bayes", "f32", "d=13 loop",    4U, CLS_VECTORS, 1U, cls_d13_setup, bayes_loop_run },
+    { "naive_bayes", "f32", "d=13 batch",   4U, CLS_VECTORS, 1U, cls_d13_setup, bayes_batch_run },
+    { "naive_bayes", "f32", "d=40 loop",   12U, CLS_VECTORS, 1U, cls_d40_setup, bayes_loop_run },
+    { "naive_bayes", "f32", "d=40 batch",  12U, CLS_VECTORS, 1U, cls_d40_setup, bayes_batch_run },
+
+    { "mfcc", "f32", "mel=40 dct=13",  256U,  256U, 1U, mfcc_setup, mfcc_f32_run },
+    { "mfcc", "f32", "mel=40 dct=13",  512U,  512U, 1U, mfcc_setup, mfcc_f32_run },
+    { "mfcc", "f32", "mel=40 dct=13", 1024U, 1024U, 1U, mfcc_setup, mfcc_f32_run },
+    { "mfcc", "q31", "mel=40 dct=13",  256U,  256U, 1U, mfcc_setup, mfcc_q31_run },
+    { "mfcc", "q31", "mel=40 dct=13",  512U,  512U, 1U, mfcc_setup, mfcc_q31_run },
+    { "mfcc", "q31", "mel=40 dct=13", 1024U, 1024U, 1U, mfcc_setup, mfcc_q31_run },
+    { "mfcc", "q15", "mel=40 dct=13",  256U,  256U, 1U, mfcc_setup, mfcc_q15_run },
+    { "mfcc", "q15", "mel=40 dct=13",  512U,  512U, 1U, mfcc_setup, mfcc_q15_run },
+    { "mfcc", "q15", "mel=40 dct=13", 1024U, 1024U, 1U, mfcc_setup, mfcc_q15_run },
+
+    SORT_SIZES("sort_bitonic",   sort_bitonic_setup,   sort_f32_run),
+    SORT_SIZES("sort_bubble",    sort_bubble_setup,    sort_f32_run),
+    SORT_SIZES("sort_heap",      sort_heap_setup,      sort_f32_run),
+    SORT_SIZES("sort_insertion", sort_insertion_setup, sort_f32_run),
+    SORT_SIZES("sort_quick",     sort_quick_setup,     sort_f32_run),
+    SORT_SIZES("sort_selection", sort_selection_setup, sort_f32_run),
+    SORT_SIZES("sort_merge",     sort_merge_setup,     merge_f32_run),
+    SORT_SIZES("sort_radix",     radix_setup,          radix_f32_run),
+    { "sort_radix",    "f32", "random",          16384U, 16384U, 1U, radix_setup,    radix_f32_run },
+    { "sort_radix",    "f32", "random threads",  16384U, 16384U, 1U, radix_mt_setup, radix_f32_run },
+    { "sort_radix",    "q31", "random",           1024U,  1024U, 1U, radix_setup,    radix_q31_run },
+    { "sort_radix",    "q15", "random",           1024U,  1024U, 1U, radix_setup,    radix_q15_run },
+    { "argsort_radix", "f32", "random",           1024U,  1024U, 1U, radix_setup,    argsort_f32_run },
+    { "topk",          "f32", "k=8",              1024U,  1024U, 1U, radix_setup,    topk_f32_run },
+    { "topk",          "f32", "k=8",             16384U, 16384U, 1U, radix_setup,    topk_f32_run },
+
+    { "dist_loop",     "f32", "euclid dim=13",     64U,   64U *  64U, 1U, dist_euclid13_setup, dist_loop_run },
+    { "dist_matrix",   "f32", "euclid dim=13",     64U,   64U *  64U, 1U, dist_euclid13_setup, dist_matrix_run },
+    { "dist_loop",     "f32", "euclid dim=13",    256U,  256U * 256U, 1U, dist_euclid13_setup, dist_loop_run },
+    { "dist_matrix",   "f32", "euclid dim=13",    256U,  256U * 256U, 1U, dist_euclid13_setup, dist_matrix_run },
+    { "dist_loop",     "f32", "euclid dim=40",    256U,  256U * 256U, 1U, dist_euclid40_setup, dist_loop_run },
+    { "dist_matrix",   "f32", "euclid dim=40",    256U,  256U * 256U, 1U, dist_euclid40_setup, dist_matrix_run },
+    { "dist_loop",     "f32", "cityblock dim=40", 256U,  256U * 256U, 1U, dist_city40_setup,   dist_loop_run },
+    { "dist_matrix",   "f32", "cityblock dim=40", 256U,  256U * 256U, 1U, dist_city40_setup,   dist_matrix_run },
+    { "knn",           "f32", "refs=1024 k=5",     16U,   16U, 1U, knn_setup, knn_run },
+};
+
+#define BENCH_NUM_CASES (sizeof(bench_cases) / sizeof(bench_cases[0]))
+
+/* ============================================
+   Timing
+   ============================================ */
+
+/**
+ * @brief Time one case: calibrate an iteration count for the budget, then
+ *        keep the fastest of BENCH_REPEATS batches
+ * @return 0 if the kernel rejected its configuration
+ */
+static int bench_run_case(const bench_case_t *c, uint32_t min_time_ms, bench_result_t *r)
+{
+    if (!c->setup(c->size)) return 0;
+
+    // Warm caches and branch predictors, and get a rough per-run cost
+    uint64_t t0 = now_ns();
+    c->run(c->size);
+    uint64_t one = now_ns() - t0;
+    if (one == 0U) one = 1U;
+
+    uint64_t batch_ns = (uint64_t)min_time_ms * 1000000ULL / BENCH_REPEATS;
+    uint64_t iters = batch_ns / one;
+    if (iters == 0U) iters = 1U;
+
+    double best_ns = 0.0, best_cycles = 0.0;
+    for (uint32_t rep = 0; rep < BENCH_REPEATS; rep++) {
+        uint64_t start_ns = now_ns();
+        uint32_t start_cyc = bh_cycles_now();
+        for (uint64_t i = 0; i < iters; i++) {
+            c->run(c->size);
+        }
+        uint32_t cyc = bh_cycles_now() - start_cyc;
+        uint64_t ns = now_ns() - start_ns;
+
+        if (rep == 0U || (double)ns < best_ns) {
+            best_ns = (double)ns;
+            best_cycles = (double)cyc;
+        }
+    }
+
+    r->c = c;
+    r->iters = iters;
+    r->ns_per_call = best_ns / (double)(iters * c->calls);
+    r->cycles_per_call = best_cycles / (double)(iters * c->calls);
+    return 1;
+}
+
+/* ============================================
+   Output
+   ============================================ */
+
+static void write_csv(FILE *f, const bench_result_t *res, uint32_t n)
+{
+    fprintf(f, "kernel,type,size,params,samples,iters,ns_per_call,cycles_per_call,ns_per_sample,cycles_per_sample\n");
+    for (uint32_t i = 0; i < n; i++) {
+        const bench_result_t *r = &res[i];
+        fprintf(f, "%s,%s,%u,%s,%u,%llu,%.1f,%.1f,%.3f,%.3f\n",
+                r->c->kernel, r->c->type, r->c->size, r->c->params, r->c->samples,
+                (unsigned long long)r->iters, r->ns_per_call, r->cycles_per_call,
+                r->ns_per_call / r->c->samples, r->cycles_per_call / r->c->samples);
+    }
+}
+
+static const char *bench_level_name(void)
+{
+#if defined(ARM_MATH_X86)
+    static const char *names[] = { "scalar", "sse2", "avx2" };
+    return names[arm_x86_get_level()];
+#else
+    return "scalar";
+#endif
+}
+
+static void write_json(FILE *f, const bench_result_t *res, uint32_t n, uint32_t min_time_ms)
+{
+    fprintf(f, "{\n  \"meta\": {\"compiler\": \"%s\", \"level\": \"%s\", \"min_time_ms\": %u, \"repeats\": %u},\n",
+            __VERSION__, bench_level_name(), min_time_ms, BENCH_REPEATS);
+    fprintf(f, "  \"results\": [\n");
+    for (uint32_t i = 0; i < n; i++) {
+        const bench_result_t *r = &res[i];
+        fprintf(f, "    {\"kernel\": \"%s\", \"type\": \"%s\", \"size\": %u, \"params\": \"%s\", "
+                   "\"samples\": %u, \"iters\": %llu, \"ns_per_call\": %.1f, \"cycles_per_call\": %.1f, "
+                   "\"ns_per_sample\": %.3f, \"cycles_per_sample\": %.3f}%s\n",
+                r->c->kernel, r->c->type, r->c->size, r->c->params, r->c->samples,
+                (unsigned long long)r->iters, r->ns_per_call, r->cycles_per_call,
+                r->ns_per_call / r->c->samples, r->cycles_per_call / r->c->samples,
+                (i + 1U < n) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [--filter SUBSTR] [--min-time MS] [--csv PATH] [--json PATH]"
+                    " [--level scalar|sse2|avx2]\n", prog);
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    const char *filter = NULL, *csv_path = NULL, *json_path = NULL;
+    uint32_t min_time_ms = BENCH_DEFAULT_MS;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            min_time_ms = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (strcmp(argv[i], "--level") == 0 && i + 1 < argc) {
+            const char *lvl = argv[++i];
+#if defined(ARM_MATH_X86)
+            arm_x86_set_level(strcmp(lvl, "scalar") == 0 ? ARM_X86_LEVEL_SCALAR :
+                              strcmp(lvl, "sse2") == 0   ? ARM_X86_LEVEL_SSE2 : ARM_X86_LEVEL_AVX2);
+#else
+            if (strcmp(lvl, "scalar") != 0) fprintf(stderr, "built without ARM_MATH_X86, running scalar\n");
+#endif
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (min_time_ms == 0U) min_time_ms = 1U;
+    if (min_time_ms > BENCH_MAX_MS) min_time_ms = BENCH_MAX_MS;
+
+    static bench_result_t results[BENCH_NUM_CASES];
+    uint32_t n = 0;
+
+    bh_cycles_init();
+    bench_fill_sources();
+
+    printf("# code path: %s\n", bench_level_name());
+    printf("%-16s %-4s %6s %-14s %12s %12s %10s %10s\n",
+           "kernel", "type", "size", "params", "ns/call", "cyc/call", "cyc/sample", "Msample/s");
+
+    for (uint32_t i = 0; i < BENCH_NUM_CASES; i++) {
+        const bench_case_t *c = &bench_cases[i];
+        char name[64];
+
+        snprintf(name, sizeof(name), "%s_%s", c->kernel, c->type);
+        if (filter != NULL && strstr(name, filter) == NULL) continue;
+
+        if (!bench_run_case(c, min_time_ms, &results[n])) {
+            fprintf(stderr, "%s size %u: init failed, skipped\n", name, c->size);
+            continue;
+        }
+
+        const bench_result_t *r = &results[n++];
+        printf("%-16s %-4s %6u %-14s %12.1f %12.1f %10.2f %10.2f\n",
+               c->kernel, c->type, c->size, c->params,
+               r->ns_per_call, r->cycles_per_call, r->cycles_per_call / c->samples,
+               1e3 * c->samples / r->ns_per_call);
+        fflush(stdout);
+    }
+
+    if (csv_path != NULL) {
+        FILE *f = fopen(csv_path, "w");
+        if (f == NULL) { perror(csv_path); return 1; }
+        write_csv(f, results, n);
+        fclose(f);
+    }
+
+    if (json_path != NULL) {
+        FILE *f = fopen(json_path, "w");
+        if (f == NULL) { perror(json_path); return 1; }
+        write_json(f, results, n, min_time_ms);
+        fclose(f);
+    }
+
+    return 0;
+}
@@ -0,0 +1,512 @@
+/* nn_bench.c
+ *
+ * CMSIS-NN s8 kernel benchmark for the x86 SIMD backend.
+ *
+ * Runs the kernels the backend accelerates (arm_nn_mat_mult_nt_t_s8,
+ * arm_nn_vec_mat_mult_t_s8, arm_nn_mat_mul_core_4x_s8, arm_convolve_s8 and
+ * the depthwise convolutions) on layer shapes taken from the models we ship
+ * (DS-CNN keyword spotter, its streaming 1xN form, FC heads, LSTM gate
+ * projections, MobileNet-style blocks) at every code path the CPU supports,
+ * and reports time per call and the speedup over the scalar C reference.
+ *
+ * Before timing, every case and a randomized sweep of shapes, offsets,
+ * multipliers, shifts and activation ranges are run at each level and the
+ * outputs compared byte for byte with the scalar path: the SIMD kernels must
+ * be bit-exact, and the exit status is 1 if any output differs.
+ *
+ *   nn_bench [--filter SUBSTR] [--min-time MS] [--csv PATH] [--fuzz N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+#include "bh_cycles.h"
+#include "../tools/harness_util.h"
+
+/* ============================================
+   Configuration
+   ============================================ */
+
+#define BENCH_REPEATS       5U          // Timed batches per case, best one is reported
+#define BENCH_DEFAULT_MS    100U        // Default time budget per case and level
+#define BENCH_MAX_MS        2000U
+#define BENCH_FUZZ          2000U       // Default random shapes in the bit-exactness sweep
+
+#define NN_MAX_IN           (128U * 1024U)
+#define NN_MAX_W            (512U * 1024U)
+#define NN_MAX_OUT          (128U * 1024U)
+#define NN_MAX_CH           2048U
+#define NN_MAX_SCRATCH      (64U * 1024U)
+
+#if defined(ARM_MATH_X86)
+#define NN_LEVELS           3
+#else
+#define NN_LEVELS           1
+#endif
+
+static const char *level_names[] = { "scalar", "avx2", "avx512" };
+
+/* ============================================
+   Case Table
+   ============================================ */
+
+typedef enum {
+    NN_MAT_MULT,    // arm_nn_mat_mult_nt_t_s8: rows = h * w, cols = cin, rhs rows = cout
+    NN_VEC_MAT,     // arm_nn_vec_mat_mult_t_s8: cols = cin, rows = cout
+    NN_CORE_4X,     // arm_nn_mat_mul_core_4x_s8: 4 rows of kh * kw * cin
+    NN_CONV,        // arm_convolve_s8
+    NN_DW_CONV      // arm_depthwise_conv_wrapper_s8, ch_mult 1
+} nn_kind_t;
+
+typedef struct {
+    nn_kind_t kind;
+    const char *kernel;
+    const char *layer;          // Where the shape comes from
+    int32_t n, h, w, cin, cout;
+    int32_t kh, kw, stride, pad, dil;
+} nn_case_t;
+
+static const nn_case_t nn_cases[] = {
+    { NN_MAT_MULT, "mat_mult_nt_t", "kws pw 25x5 64->64",      1, 25,  5,   64,   64, 1, 1, 1, 0, 1 },
+    { NN_MAT_MULT, "mat_mult_nt_t", "mbnet pw 14x14 128->128", 1, 14, 14,  128,  128, 1, 1, 1, 0, 1 },
+    { NN_MAT_MULT, "mat_mult_nt_t", "stream col 6x64->64",     1,  1,  1,  384,   64, 1, 1, 1, 0, 1 },
+    { NN_VEC_MAT,  "vec_mat_mult_t", "kws fc 64->12",          1,  1,  1,   64,   12, 1, 1, 1, 0, 1 },
+    { NN_VEC_MAT,  "vec_mat_mult_t", "fc 1024->256",           1,  1,  1, 1024,  256, 1, 1, 1, 0, 1 },
+    { NN_VEC_MAT,  "vec_mat_mult_t", "lstm gates 128->512",    1,  1,  1,  128,  512, 1, 1, 1, 0, 1 },
+    { NN_CORE_4X,  "mat_mul_core_4x", "4 cols 3x3x64->64",     1,  1,  1,   64,   64, 3, 3, 1, 0, 1 },
+    { NN_CONV,     "convolve",      "kws 10x4 s2 49x10x1->64", 1, 49, 10,    1,   64, 10, 4, 2, 1, 1 },
+    { NN_CONV,     "convolve",      "3x3 32x32x16->32",        1, 32, 32,   16,   32, 3, 3, 1, 1, 1 },
+    { NN_DW_CONV,  "depthwise",     "kws dw 3x3 25x5x64",      1, 25,  5,   64,   64, 3, 3, 1, 1, 1 },
+    { NN_DW_CONV,  "depthwise",     "mbnet dw 3x3 s2 56x56x32", 1, 56, 56,  32,   32, 3, 3, 2, 1, 1 },
+    { NN_DW_CONV,  "depthwise",     "dw 5x5 14x14x120",        1, 14, 14,  120,  120, 5, 5, 1, 2, 1 },
+};
+
+#define NN_NUM_CASES (sizeof(nn_cases) / sizeof(nn_cases[0]))
+
+/* ============================================
+   Operands
+   ============================================ */
+
+typedef struct {
+    int32_t input_offset;
+    int32_t output_offset;
+    int32_t act_min;
+    int32_t act_max;
+    int32_t address_offset;     // vec_mat only
+    int use_bias;
+} nn_quant_t;
+
+static int8_t in_buf[NN_MAX_IN], w_buf[NN_MAX_W];
+static int8_t out_buf[NN_LEVELS][NN_MAX_OUT];
+static int32_t bias_buf[NN_MAX_CH], mult_buf[NN_MAX_CH], shift_buf[NN_MAX_CH];
+static int8_t scratch[NN_MAX_SCRATCH];
+
+static uint32_t rng_state = 0x12345678U;
+
+static uint32_t rng_next(void)
+{
+    rng_state = rng_state * 1664525U + 1013904223U;
+    return rng_state >> 8;
+}
+
+/**
+ * @brief Uniform integer in [lo, hi]
+ */
+static int32_t rng_range(int32_t lo, int32_t hi)
+{
+    return lo + (int32_t)(rng_next() % (uint32_t)(hi - lo + 1));
+}
+
+static int32_t out_dim(int32_t in, int32_t k, int32_t stride, int32_t pad, int32_t dil)
+{
+    return (in + 2 * pad - dil * (k - 1) - 1) / stride + 1;
+}
+
+static uint64_t case_macs(const nn_case_t *c)
+{
+    switch (c->kind) {
+    case NN_MAT_MULT: return (uint64_t)c->h * c->w * c->cin * c->cout;
+    case NN_VEC_MAT:  return (uint64_t)c->cin * c->cout;
+    case NN_CORE_4X:  return 4ULL * c->kh * c->kw * c->cin * c->cout;
+    case NN_CONV:
+        return (uint64_t)c->n * out_dim(c->h, c->kh, c->stride, c->pad, c->dil) *
+               out_dim(c->w, c->kw, c->stride, c->pad, c->dil) * c->cout * c->kh * c->kw * c->cin;
+    case NN_DW_CONV:
+        return (uint64_t)c->n * out_dim(c->h, c->kh, c->stride, c->pad, c->dil) *
+               out_dim(c->w, c->kw, c->stride, c->pad, c->dil) * c->cout * c->kh * c->kw;
+    }
+    return 0;
+}
+
+static size_t case_out_len(const nn_case_t *c)
+{
+    switch (c->kind) {
+    case NN_MAT_MULT: return (size_t)c->h * c->w * c->cout;
+    case NN_VEC_MAT:  return (size_t)c->cout * 3U;      // Room for address_offset up to 3
+    case NN_CORE_4X:  return 4U * (size_t)c->cout;
+    case NN_CONV:
+    case NN_DW_CONV:
+        return (size_t)c->n * out_dim(c->h, c->kh, c->stride, c->pad, c->dil) *
+               out_dim(c->w, c->kw, c->stride, c->pad, c->dil) * c->cout;
+    }
+    return 0;
+}
+
+static size_t case_in_len(const nn_case_t *c)
+{
+    if (c->kind == NN_CORE_4X) return 4U * (size_t)c->kh * c->kw * c->cin;
+    return (size_t)c->n * c->h * c->w * c->cin;
+}
+
+static size_t case_w_len(const nn_case_t *c)
+{
+    if (c->kind == NN_DW_CONV) return (size_t)c->kh * c->kw * c->cout;
+    return (size_t)c->cout * c->kh * c->kw * c->cin;
+}
+
+static int case_fits(const nn_case_t *c)
+{
+    return case_in_len(c) <= NN_MAX_IN && case_w_len(c) <= NN_MAX_W && case_out_len(c) <= NN_MAX_OUT &&
+           c->cout <= (int32_t)NN_MAX_CH && 4U * (size_t)c->kh * c->kw * c->cin <= NN_MAX_SCRATCH;
+}
+
+/**
+ * @brief Random operands. Multipliers are Q31 in [0.5, 1), shifts keep the
+ *        requantized values in range for the accumulator size of the layer,
+ *        and a wider spread (positive shifts included) when fuzzing.
+ */
+static void fill_operands(const nn_case_t *c, nn_quant_t *q, int fuzz)
+{
+    for (size_t i = 0; i < case_in_len(c); i++) in_buf[i] = (int8_t)rng_range(-128, 127);
+    for (size_t i = 0; i < case_w_len(c); i++) w_buf[i] = (int8_t)rng_range(-128, 127);
+    for (int32_t i = 0; i < c->cout; i++) {
+        bias_buf[i] = rng_range(-20000, 20000);
+        mult_buf[i] = (int32_t)(0x40000000U + (rng_next() << 6) % 0x3FFFFFFFU);
+        shift_buf[i] = fuzz ? rng_range(-24, 1) : rng_range(-12, -8);
+    }
+
+    q->input_offset = fuzz ? rng_range(-127, 128) : 128;
+    q->output_offset = fuzz ? rng_range(-128, 127) : -128;
+    q->act_min = fuzz ? rng_range(-128, 0) : -128;
+    q->act_max = fuzz ? rng_range(q->act_min, 127) : 127;
+    q->address_offset = fuzz ? rng_range(1, 3) : 1;
+    q->use_bias = fuzz ? (rng_next() & 3U) != 0U : 1;
+    if (c->kind == NN_DW_CONV) q->use_bias = 1;     // arm_depthwise_conv_3x3_s8 requires one
+}
+
+/* ============================================
+   Kernel Calls
+   ============================================ */
+
+static void run_case(const nn_case_t *c, const nn_quant_t *q, int8_t *out)
+{
+    const int32_t *bias = q->use_bias ? bias_buf : NULL;
+
+    switch (c->kind) {
+    case NN_MAT_MULT:
+        arm_nn_mat_mult_nt_t_s8(in_buf, w_buf, bias, out, mult_buf, shift_buf, c->h * c->w, c->cout, c->cin,
+                                q->input_offset, q->output_offset, q->act_min, q->act_max);
+        break;
+
+    case NN_VEC_MAT:
+        arm_nn_vec_mat_mult_t_s8(in_buf, w_buf, bias, out, q->input_offset, 0, q->output_offset, mult_buf[0],
+                                 shift_buf[0], c->cin, c->cout, q->act_min, q->act_max, q->address_offset);
+        break;
+
+    case NN_CORE_4X: {
+        const int32_t k = c->kh * c->kw * c->cin;
+        cmsis_nn_conv_params conv = { 0 };
+        cmsis_nn_per_channel_quant_params quant = { mult_buf, shift_buf };
+
+        conv.input_offset = q->input_offset;
+        conv.output_offset = q->output_offset;
+        conv.activation.min = q->act_min;
+        conv.activation.max = q->act_max;
+        arm_nn_mat_mul_core_4x_s8(k, k, in_buf, w_buf, c->cout, &conv, &quant, bias, out);
+        break;
+    }
+
+    case NN_CONV: {
+        cmsis_nn_context ctx = { scratch, (int32_t)sizeof(scratch) };
+        cmsis_nn_conv_params conv = { 0 };
+        cmsis_nn_per_channel_quant_params quant = { mult_buf, shift_buf };
+        cmsis_nn_dims in_dims = { c->n, c->h, c->w, c->cin };
+        cmsis_nn_dims f_dims = { c->cout, c->kh, c->kw, c->cin };
+        cmsis_nn_dims b_dims = { 1, 1, 1, c->cout };
+        cmsis_nn_dims o_dims = { c->n, out_dim(c->h, c->kh, c->stride, c->pad, c->dil),
+                                 out_dim(c->w, c->kw, c->stride, c->pad, c->dil), c->cout };
+
+        conv.input_offset = q->input_offset;
+        conv.output_offset = q->output_offset;
+        conv.stride.h = conv.stride.w = c->stride;
+        conv.padding.h = conv.padding.w = c->pad;
+        conv.dilation.h = conv.dilation.w = c->dil;
+        conv.activation.min = q->act_min;
+        conv.activation.max = q->act_max;
+        arm_convolve_s8(&ctx, &conv, &quant, &in_dims, in_buf, &f_dims, w_buf, &b_dims, bias, &o_dims, out);
+        break;
+    }
+
+    case NN_DW_CONV: {
+        cmsis_nn_context ctx = { scratch, (int32_t)sizeof(scratch) };
+        cmsis_nn_dw_conv_params dw = { 0 };
+        cmsis_nn_per_channel_quant_params quant = { mult_buf, shift_buf };
+        cmsis_nn_dims in_dims = { c->n, c->h, c->w, c->cin };
+        cmsis_nn_dims f_dims = { 1, c->kh, c->kw, c->cout };
+        cmsis_nn_dims b_dims = { 1, 1, 1, c->cout };
+        cmsis_nn_dims o_dims = { c->n, out_dim(c->h, c->kh, c->stride, c->pad, c->dil),
+                                 out_dim(c->w, c->kw, c->stride, c->pad, c->dil), c->cout };
+
+        dw.input_offset = q->input_offset;
+        dw.output_offset = q->output_offset;
+        dw.ch_mult = 1;
+        dw.stride.h = dw.stride.w = c->stride;
+        dw.padding.h = dw.padding.w = c->pad;
+        dw.dilation.h = dw.dilation.w = c->dil;
+        dw.activation.min = q->act_min;
+        dw.activation.max = q->act_max;
+        arm_depthwise_conv_wrapper_s8(&ctx, &dw, &quant, &in_dims, in_buf, &f_dims, w_buf, &b_dims, bias,
+                                      &o_dims, out);
+        break;
+    }
+    }
+}
+
+/**
+ * @brief Select a code path
+ * @return 0 if the CPU does not have it
+ */
+static int set_level(int level)
+{
+#if defined(ARM_MATH_X86)
+    return (int)arm_nn_x86_set_level((arm_nn_x86_level)level) == level;
+#else
+    return level == 0;
+#endif
+}
+
+/**
+ * @brief Run a case at every available level on the same operands
+ * @return number of levels whose output differs from the scalar one
+ */
+static int check_case(const nn_case_t *c, const nn_quant_t *q)
+{
+    const size_t len = case_out_len(c);
+    int bad = 0;
+
+    for (int level = 0; level < NN_LEVELS; level++) {
+        if (!set_level(level)) continue;
+        memset(out_buf[level], 0x55, len);
+        run_case(c, q, out_buf[level]);
+        if (level > 0 && memcmp(out_buf[level], out_buf[0], len) != 0) bad++;
+    }
+    return bad;
+}
+
+/**
+ * @brief Random shapes around the block and tail sizes of the kernels
+ */
+static void fuzz_case(nn_case_t *c)
+{
+    memset(c, 0, sizeof(*c));
+    c->kind = (nn_kind_t)rng_range(NN_MAT_MULT, NN_DW_CONV);
+    c->n = 1;
+    c->kh = c->kw = c->stride = c->dil = 1;
+
+    switch (c->kind) {
+    case NN_MAT_MULT:
+        c->h = rng_range(1, 9);
+        c->w = 1;
+        c->cin = rng_range(1, 200);
+        c->cout = rng_range(1, 21);
+        break;
+    case NN_VEC_MAT:
+        c->h = c->w = 1;
+        c->cin = rng_range(1, 300);
+        c->cout = rng_range(1, 30);
+        break;
+    case NN_CORE_4X:
+        c->h = c->w = 1;
+        c->cin = rng_range(1, 150);
+        c->cout = rng_range(1, 13);
+        break;
+    case NN_CONV:
+        c->n = rng_range(1, 2);
+        c->h = rng_range(1, 9);
+        c->w = rng_range(1, 9);
+        c->cin = rng_range(1, 20);
+        c->cout = rng_range(1, 20);
+        c->kh = rng_range(1, MIN(4, c->h));
+        c->kw = rng_range(1, MIN(4, c->w));
+        c->stride = rng_range(1, 2);
+        c->pad = rng_range(0, c->kh / 2);
+        c->dil = (c->kh * 2 <= c->h && c->kw * 2 <= c->w) ? rng_range(1, 2) : 1;
+        break;
+    case NN_DW_CONV:
+        c->n = 1;
+        c->h = rng_range(1, 10);
+        c->w = rng_range(1, 10);
+        c->cin = c->cout = rng_range(1, 70);
+        c->kh = rng_range(1, MIN(5, c->h));
+        c->kw = rng_range(1, MIN(5, c->w));
+        if ((rng_next() & 1U) && c->h >= 3 && c->w >= 3) c->kh = c->kw = 3;     // 3x3 path
+        c->stride = rng_range(1, 2);
+        c->pad = rng_range(0, MIN(c->kh, c->kw) / 2);
+        c->dil = (c->kh * 2 <= c->h && c->kw * 2 <= c->w) ? rng_range(1, 2) : 1;
+        break;
+    }
+}
+
+/* ============================================
+   Timing
+   ============================================ */
+
+/**
+ * @brief Time one case at the current level: calibrate an iteration count
+ *        for the budget, then keep the fastest of BENCH_REPEATS batches
+ */
+static void time_case(const nn_case_t *c, const nn_quant_t *q, uint32_t min_time_ms, double *ns, double *cycles)
+{
+    uint64_t t0 = now_ns();
+    run_case(c, q, out_buf[0]);
+    uint64_t one = now_ns() - t0;
+    if (one == 0U) one = 1U;
+
+    uint64_t iters = (uint64_t)min_time_ms * 1000000ULL / BENCH_REPEATS / one;
+    if (iters == 0U) iters = 1U;
+
+    for (uint32_t rep = 0; rep < BENCH_REPEATS; rep++) {
+        uint64_t start_ns = now_ns();
+        uint32_t start_cyc = bh_cycles_now();
+        for (uint64_t i = 0; i < iters; i++) {
+            run_case(c, q, out_buf[0]);
+        }
+        uint32_t cyc = bh_cycles_now() - start_cyc;
+        double t = (double)(now_ns() - start_ns) / (double)iters;
+
+        if (rep == 0U || t < *ns) {
+            *ns = t;
+            *cycles = (double)cyc / (double)iters;
+        }
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [--filter SUBSTR] [--min-time MS] [--csv PATH] [--fuzz N]\n", prog);
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    const char *filter = NULL, *csv_path = NULL;
+    uint32_t min_time_ms = BENCH_DEFAULT_MS;
+    uint32_t fuzz = BENCH_FUZZ;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            min_time_ms = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else if (strcmp(argv[i], "--fuzz") == 0 && i + 1 < argc) {
+            fuzz = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (min_time_ms == 0U) min_time_ms = 1U;
+    if (min_time_ms > BENCH_MAX_MS) min_time_ms = BENCH_MAX_MS;
+
+    bh_cycles_init();
+
+    // Bit-exactness first: random shapes, then the benchmark cases themselves
+    uint32_t mismatches = 0, checked = 0;
+    for (uint32_t t = 0; t < fuzz; t++) {
+        nn_case_t c;
+        nn_quant_t q;
+
+        fuzz_case(&c);
+        if (!case_fits(&c)) continue;
+        fill_operands(&c, &q, 1);
+        if (check_case(&c, &q) != 0) {
+            if (mismatches < 10U) {
+                fprintf(stderr, "mismatch: kind %d n %d h %d w %d cin %d cout %d k %dx%d s %d p %d d %d\n",
+                        (int)c.kind, c.n, c.h, c.w, c.cin, c.cout, c.kh, c.kw, c.stride, c.pad, c.dil);
+            }
+            mismatches++;
+        }
+        checked++;
+    }
+
+    int available = 1;
+    for (int level = 1; level < NN_LEVELS; level++) {
+        if (set_level(level)) available = level + 1;
+    }
+
+    printf("# code paths: %d (%s), bit-exact check: %u random shapes, %u mismatches\n",
+           available, level_names[available - 1], checked, mismatches);
+    printf("%-16s %-26s %9s %11s %15s %15s\n",
+           "kernel", "layer", "MMAC", "scalar us", "avx2 us (x)", "avx512 us (x)");
+
+    FILE *csv = NULL;
+    if (csv_path != NULL) {
+        csv = fopen(csv_path, "w");
+        if (csv == NULL) { perror(csv_path); return 1; }
+        fprintf(csv, "kernel,layer,macs,level,ns_per_call,cycles_per_call,speedup,bit_exact\n");
+    }
+
+    for (uint32_t i = 0; i < NN_NUM_CASES; i++) {
+        const nn_case_t *c = &nn_cases[i];
+        char name[96];
+        nn_quant_t q;
+        double ns[NN_LEVELS] = { 0 }, cycles[NN_LEVELS] = { 0 };
+
+        snprintf(name, sizeof(name), "%s %s", c->kernel, c->layer);
+        if (filter != NULL && strstr(name, filter) == NULL) continue;
+        if (!case_fits(c)) {
+            fprintf(stderr, "%s: too large, skipped\n", name);
+            continue;
+        }
+
+        fill_operands(c, &q, 0);
+        const int exact = check_case(c, &q) == 0;
+        if (!exact) mismatches++;
+
+        printf("%-16s %-26s %9.3f", c->kernel, c->layer, (double)case_macs(c) / 1e6);
+        for (int level = 0; level < NN_LEVELS; level++) {
+            if (!set_level(level)) {
+                printf(" %15s", "-");
+                continue;
+            }
+            time_case(c, &q, min_time_ms, &ns[level], &cycles[level]);
+            if (level == 0) {
+                printf(" %11.2f", ns[0] / 1e3);
+            } else {
+                char cell[32];
+                snprintf(cell, sizeof(cell), "%.2f (%.1fx)", ns[level] / 1e3, ns[0] / ns[level]);
+                printf(" %15s", cell);
+            }
+            if (csv != NULL) {
+                fprintf(csv, "%s,%s,%llu,%s,%.1f,%.1f,%.2f,%d\n", c->kernel, c->layer,
+                        (unsigned long long)case_macs(c), level_names[level], ns[level], cycles[level],
+                        ns[0] / ns[level], exact);
+            }
+        }
+        printf("%s\n", exact ? "" : "  MISMATCH");
+        fflush(stdout);
+    }
+
+    if (csv != NULL) fclose(csv);
+
+    return mismatches != 0U;
+}
@@ -0,0 +1,237 @@
+/* biquad_multich_harness.c
+ *
+ * Agreement of the N-channel interleaved biquad cascades with one mono
+ * cascade per channel:
+ *
+ *   f32   arm_biquad_cascade_multich_df2T_f32 and arm_biquad_cascade_df2T_f32
+ *         on each de-interleaved channel, both against the same cascade in
+ *         double precision; error over the largest output. Sharp sections
+ *         amplify rounding and the two forms round in a different order,
+ *         so the multichannel error must be within 4x the mono one (run
+ *         at the scalar level, also plain C), or under 1e-6
+ *   q31   arm_biquad_cascade_multich_df1_q31 against
+ *         arm_biquad_cascade_df1_q31 on each channel; must be bit-exact,
+ *         including a loud input that wraps the way the mono filter does
+ *
+ * Channel counts cover the 4-lane (f32) and 2-lane (q31) groups with and
+ * without leftovers. Each configuration runs with shared and per-channel
+ * coefficients, out of place and in place, on a 1000-sample stream cut
+ * into blocks of 1 to 257 so the state carries across calls. Sections are
+ * stable, with random poles and zeros; q31 coefficients are Q30 with a
+ * postShift of 1.
+ *
+ *   biquad_multich_harness [--seed N]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "harness_util.h"
+
+#define MAX_CH          16U
+#define MAX_STAGES      6U
+#define STREAM_LEN      1000U
+#define MIN_ERR         1e-6
+#define ERR_RATIO       4.0
+
+static float32_t coeffs_f32[MAX_CH * 5U * MAX_STAGES], lanes_f32[MAX_CH * 5U * MAX_STAGES];
+static float32_t state_f32[MAX_CH * 4U * MAX_STAGES];
+static float32_t in_f32[MAX_CH * STREAM_LEN], out_f32[MAX_CH * STREAM_LEN];
+static float32_t mono_in_f32[STREAM_LEN], mono_out_f32[STREAM_LEN], mono_f32[MAX_CH * STREAM_LEN];
+static double ref_f64[MAX_CH * STREAM_LEN];
+
+static q31_t coeffs_q31[MAX_CH * 5U * MAX_STAGES], lanes_q31[MAX_CH * 5U * MAX_STAGES];
+static q31_t state_q31[MAX_CH * 4U * MAX_STAGES];
+static q31_t in_q31[MAX_CH * STREAM_LEN], out_q31[MAX_CH * STREAM_LEN], ref_q31[MAX_CH * STREAM_LEN];
+static q31_t mono_in_q31[STREAM_LEN], mono_out_q31[STREAM_LEN];
+
+/* ============================================
+   Coefficients
+   ============================================ */
+
+// One stable section {b0, b1, b2, a1, a2}, a1/a2 in the CMSIS sign convention
+static void section(float32_t *c)
+{
+    float32_t r = 0.725f + 0.225f * syn_rand(), w = (float32_t)PI * (0.5f + 0.5f * syn_rand());
+    float32_t rz = 0.5f + 0.5f * syn_rand(), wz = (float32_t)PI * (0.5f + 0.5f * syn_rand());
+
+    c[0] = 0.25f;
+    c[1] = -c[0] * 2.0f * rz * cosf(wz);
+    c[2] = c[0] * rz * rz;
+    c[3] = 2.0f * r * cosf(w);
+    c[4] = -r * r;
+}
+
+static void make_coeffs(uint32_t sets, uint32_t stages)
+{
+    for (uint32_t i = 0; i < sets * stages; i++) {
+        section(coeffs_f32 + 5U * i);
+        for (uint32_t k = 0; k < 5U; k++) {
+            coeffs_q31[5U * i + k] = (q31_t)lrintf(coeffs_f32[5U * i + k] * 1073741824.0f);
+        }
+    }
+}
+
+/* ============================================
+   Filters under test and reference
+   ============================================ */
+
+static void run_multich_f32(uint32_t ch, uint32_t stages, int per_ch, uint32_t block, int in_place)
+{
+    arm_biquad_cascade_multich_df2T_instance_f32 S;
+
+    arm_biquad_cascade_multich_df2T_init_f32(&S, (uint8_t)stages, (uint16_t)ch, coeffs_f32, (uint8_t)per_ch,
+                                             lanes_f32, state_f32);
+    if (in_place) memcpy(out_f32, in_f32, ch * STREAM_LEN * sizeof(float32_t));
+    for (uint32_t n = 0; n < STREAM_LEN; n += block) {
+        const uint32_t len = (STREAM_LEN - n < block) ? STREAM_LEN - n : block;
+        arm_biquad_cascade_multich_df2T_f32(&S, (in_place ? out_f32 : in_f32) + n * ch, out_f32 + n * ch, len);
+    }
+}
+
+static void run_mono_f32(uint32_t ch, uint32_t stages, int per_ch)
+{
+    for (uint32_t c = 0; c < ch; c++) {
+        arm_biquad_cascade_df2T_instance_f32 S;
+
+        arm_biquad_cascade_df2T_init_f32(&S, (uint8_t)stages, coeffs_f32 + (per_ch ? 5U * stages * c : 0U),
+                                         state_f32);
+        for (uint32_t n = 0; n < STREAM_LEN; n++) mono_in_f32[n] = in_f32[n * ch + c];
+        arm_biquad_cascade_df2T_f32(&S, mono_in_f32, mono_out_f32, STREAM_LEN);
+        for (uint32_t n = 0; n < STREAM_LEN; n++) mono_f32[n * ch + c] = mono_out_f32[n];
+    }
+}
+
+// Transposed direct form II in double precision, one channel at a time
+static void run_ref_f64(uint32_t ch, uint32_t stages, int per_ch)
+{
+    for (uint32_t c = 0; c < ch; c++) {
+        const float32_t *coeffs = coeffs_f32 + (per_ch ? 5U * stages * c : 0U);
+        double d[2U * MAX_STAGES] = { 0.0 };
+
+        for (uint32_t n = 0; n < STREAM_LEN; n++) {
+            double x = in_f32[n * ch + c];
+
+            for (uint32_t s = 0; s < stages; s++) {
+                const float32_t *k = coeffs + 5U * s;
+                double y = k[0] * x + d[2U * s];
+
+                d[2U * s] = k[1] * x + k[3] * y + d[2U * s + 1U];
+                d[2U * s + 1U] = k[2] * x + k[4] * y;
+                x = y;
+            }
+            ref_f64[n * ch + c] = x;
+        }
+    }
+}
+
+static void run_multich_q31(uint32_t ch, uint32_t stages, int per_ch, uint32_t block, int in_place)
+{
+    arm_biquad_cascade_multich_df1_instance_q31 S;
+
+    arm_biquad_cascade_multich_df1_init_q31(&S, (uint8_t)stages, (uint16_t)ch, coeffs_q31, (uint8_t)per_ch,
+                                            lanes_q31, state_q31, 1);
+    if (in_place) memcpy(out_q31, in_q31, ch * STREAM_LEN * sizeof(q31_t));
+    for (uint32_t n = 0; n < STREAM_LEN; n += block) {
+        const uint32_t len = (STREAM_LEN - n < block) ? STREAM_LEN - n : block;
+        arm_biquad_cascade_multich_df1_q31(&S, (in_place ? out_q31 : in_q31) + n * ch, out_q31 + n * ch, len);
+    }
+}
+
+static void run_mono_q31(uint32_t ch, uint32_t stages, int per_ch)
+{
+    for (uint32_t c = 0; c < ch; c++) {
+        arm_biquad_casd_df1_inst_q31 S;
+
+        arm_biquad_cascade_df1_init_q31(&S, (uint8_t)stages, coeffs_q31 + (per_ch ? 5U * stages * c : 0U),
+                                        state_q31, 1);
+        for (uint32_t n = 0; n < STREAM_LEN; n++) mono_in_q31[n] = in_q31[n * ch + c];
+        arm_biquad_cascade_df1_q31(&S, mono_in_q31, mono_out_q31, STREAM_LEN);
+        for (uint32_t n = 0; n < STREAM_LEN; n++) ref_q31[n * ch + c] = mono_out_q31[n];
+    }
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    static const uint32_t channels[] = { 1, 2, 3, 4, 5, 7, 8, 9, 16 };
+    static const uint32_t stage_list[] = { 1, 2, 4, MAX_STAGES };
+    static const uint32_t blocks[] = { 1, 3, 64, 257 };
+    static const float32_t levels[] = { 0.1f, 0.9f };
+    const uint32_t runs = 2U * sizeof(blocks) / sizeof(blocks[0]);
+    uint32_t failures = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            harness_rng = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (harness_rng == 0U) harness_rng = 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+#if defined(ARM_MATH_X86)
+    // The mono reference in plain C, like the multichannel filters
+    arm_x86_set_level(ARM_X86_LEVEL_SCALAR);
+#endif
+
+    printf("ch  stages  coeffs       f32 err (mono)        q31 mismatches (level 0.1 / 0.9)\n");
+    for (size_t c = 0; c < sizeof(channels) / sizeof(channels[0]); c++) {
+        for (size_t s = 0; s < sizeof(stage_list) / sizeof(stage_list[0]); s++) {
+            for (int per_ch = 0; per_ch < 2; per_ch++) {
+                const uint32_t ch = channels[c], stages = stage_list[s];
+                uint32_t bad_q31[2] = { 0, 0 };
+                double err = 0.0, err_mono = 0.0, peak = 0.0;
+
+                make_coeffs(per_ch ? ch : 1U, stages);
+
+                for (uint32_t i = 0; i < ch * STREAM_LEN; i++) in_f32[i] = syn_rand();
+                run_mono_f32(ch, stages, per_ch);
+                run_ref_f64(ch, stages, per_ch);
+                for (uint32_t i = 0; i < ch * STREAM_LEN; i++) peak = fmax(peak, fabs(ref_f64[i]));
+                for (uint32_t i = 0; i < ch * STREAM_LEN; i++) {
+                    err_mono = fmax(err_mono, fabs((double)mono_f32[i] - ref_f64[i]) / peak);
+                }
+                for (size_t b = 0; b < sizeof(blocks) / sizeof(blocks[0]); b++) {
+                    for (int in_place = 0; in_place < 2; in_place++) {
+                        run_multich_f32(ch, stages, per_ch, blocks[b], in_place);
+                        for (uint32_t i = 0; i < ch * STREAM_LEN; i++) {
+                            err = fmax(err, fabs((double)out_f32[i] - ref_f64[i]) / peak);
+                        }
+                    }
+                }
+
+                for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+                    for (uint32_t i = 0; i < ch * STREAM_LEN; i++) {
+                        in_q31[i] = (q31_t)lrintf(levels[l] * syn_rand() * 2147483520.0f);
+                    }
+                    run_mono_q31(ch, stages, per_ch);
+                    for (size_t b = 0; b < sizeof(blocks) / sizeof(blocks[0]); b++) {
+                        for (int in_place = 0; in_place < 2; in_place++) {
+                            run_multich_q31(ch, stages, per_ch, blocks[b], in_place);
+                            if (memcmp(out_q31, ref_q31, ch * STREAM_LEN * sizeof(q31_t)) != 0) bad_q31[l]++;
+                        }
+                    }
+                }
+
+                const int fail = err > fmax(ERR_RATIO * err_mono, MIN_ERR) || bad_q31[0] || bad_q31[1];
+                failures += fail ? 1U : 0U;
+                if (fail || stages == MAX_STAGES) {
+                    printf("%2u  %6u  %-11s %8.2e (%8.2e)  %u/%u  %u/%u%s\n", ch, stages,
+                           per_ch ? "per-channel" : "shared", err, err_mono, bad_q31[0], runs, bad_q31[1], runs,
+                           fail ? "  FAIL" : "");
+                }
+            }
+        }
+    }
+
+    printf("\n%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
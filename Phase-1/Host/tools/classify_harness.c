@@ -0,0 +1,129 @@
+/* classify_harness.c
+ *
+ * Agreement of the batched classifiers (arm_svm_linear_predict_batch_f32,
+ * arm_svm_rbf_predict_batch_f32, arm_gaussian_naive_bayes_predict_batch_f32)
+ * with their one-vector counterparts.
+ *
+ * Models and inputs are drawn around 0 with a spread of 1 and around -300
+ * with a spread of 0.1, the second standing in for features with a large
+ * mean (log energies, un-normalised MFCCs) where the expanded squares of
+ * the batched forms cancel if they are not centred. Variances and the RBF
+ * gamma follow the spread. Every input must get the same class from both
+ * forms; the naive Bayes log probabilities are compared too, relative to
+ * the range of the class scores of each input.
+ *
+ *   classify_harness [--vectors N] [--seed N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "arm_math.h"
+#include "harness_util.h"
+
+#define DIM             13U
+#define NUM_SV          64U
+#define NUM_CLASSES     8U
+#define MAX_VECTORS     1000U
+#define MAX_PROB_ERR    1e-3f
+
+static float32_t in[MAX_VECTORS * DIM];
+static float32_t sv[NUM_SV * DIM], alpha[NUM_SV];
+static float32_t theta[NUM_CLASSES * DIM], sigma[NUM_CLASSES * DIM], prior[NUM_CLASSES];
+static float32_t prob[MAX_VECTORS * NUM_CLASSES], prob_one[NUM_CLASSES];
+static float32_t scratch[ARM_SVM_RBF_BATCH_SCRATCH_SIZE(NUM_SV, DIM)
+                       + ARM_GAUSSIAN_NAIVE_BAYES_BATCH_SCRATCH_SIZE(DIM, NUM_CLASSES)];
+static int32_t svm_out[MAX_VECTORS];
+static uint32_t bayes_out[MAX_VECTORS];
+static const int32_t labels[2] = { 0, 1 };
+
+static void fill(float32_t *x, uint32_t n, float32_t offset, float32_t spread)
+{
+    for (uint32_t i = 0; i < n; i++) x[i] = offset + spread * syn_rand();
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    static const float32_t offsets[] = { 0.0f, -300.0f }, spreads[] = { 1.0f, 0.1f };
+    uint32_t vectors = 200U, failures = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--vectors") == 0 && i + 1 < argc) {
+            vectors = (uint32_t)strtoul(argv[++i], NULL, 0);
+            vectors = vectors > MAX_VECTORS ? MAX_VECTORS : vectors;
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            harness_rng = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (harness_rng == 0U) harness_rng = 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--vectors N] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("classifier   offset  disagree  max log-prob err\n");
+    for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+        arm_svm_linear_instance_f32 linear;
+        arm_svm_rbf_instance_f32 rbf;
+        arm_gaussian_naive_bayes_instance_f32 bayes;
+        uint32_t bad_linear = 0, bad_rbf = 0, bad_bayes = 0;
+        float32_t prob_err = 0.0f, s = spreads[o];
+
+        fill(in, vectors * DIM, offsets[o], s);
+        fill(sv, NUM_SV * DIM, offsets[o], s);
+        fill(alpha, NUM_SV, 0.0f, 1.0f);
+        fill(theta, NUM_CLASSES * DIM, offsets[o], s);
+        for (uint32_t i = 0; i < NUM_CLASSES * DIM; i++) sigma[i] = s * s * (0.5f + 0.5f * fabsf(syn_rand()));
+        for (uint32_t c = 0; c < NUM_CLASSES; c++) prior[c] = 1.0f / NUM_CLASSES;
+
+        arm_svm_linear_init_f32(&linear, NUM_SV, DIM, 0.1f, alpha, sv, labels);
+        arm_svm_rbf_init_f32(&rbf, NUM_SV, DIM, 0.1f, alpha, sv, labels, 1.0f / (DIM * s * s));
+        bayes.vectorDimension = DIM;
+        bayes.numberOfClasses = NUM_CLASSES;
+        bayes.theta = theta;
+        bayes.sigma = sigma;
+        bayes.classPriors = prior;
+        bayes.epsilon = 1e-9f;
+
+        arm_svm_linear_predict_batch_f32(&linear, in, vectors, scratch, svm_out);
+        for (uint32_t v = 0; v < vectors; v++) {
+            int32_t one;
+            arm_svm_linear_predict_f32(&linear, in + v * DIM, &one);
+            bad_linear += (one != svm_out[v]) ? 1U : 0U;
+        }
+
+        arm_svm_rbf_predict_batch_f32(&rbf, in, vectors, scratch, svm_out);
+        for (uint32_t v = 0; v < vectors; v++) {
+            int32_t one;
+            arm_svm_rbf_predict_f32(&rbf, in + v * DIM, &one);
+            bad_rbf += (one != svm_out[v]) ? 1U : 0U;
+        }
+
+        // Log probability error relative to the range of the input's class scores
+        arm_gaussian_naive_bayes_predict_batch_f32(&bayes, in, vectors, prob, scratch, bayes_out);
+        for (uint32_t v = 0; v < vectors; v++) {
+            float32_t lo, hi;
+            uint32_t one = arm_gaussian_naive_bayes_predict_f32(&bayes, in + v * DIM, prob_one, NULL), at;
+
+            bad_bayes += (one != bayes_out[v]) ? 1U : 0U;
+            arm_min_f32(prob_one, NUM_CLASSES, &lo, &at);
+            arm_max_f32(prob_one, NUM_CLASSES, &hi, &at);
+            for (uint32_t c = 0; c < NUM_CLASSES; c++) {
+                prob_err = fmaxf(prob_err, fabsf(prob[v * NUM_CLASSES + c] - prob_one[c]) / (hi - lo));
+            }
+        }
+
+        failures += bad_linear + bad_rbf + bad_bayes + (prob_err > MAX_PROB_ERR ? 1U : 0U);
+        printf("svm_linear   %6.1f  %4u/%u\n", (double)offsets[o], bad_linear, vectors);
+        printf("svm_rbf      %6.1f  %4u/%u\n", (double)offsets[o], bad_rbf, vectors);
+        printf("naive_bayes  %6.1f  %4u/%u  %10.2e\n", (double)offsets[o], bad_bayes, vectors, (double)prob_err);
+    }
+
+    printf("\n%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,179 @@
+/* distance_harness.c
+ *
+ * Accuracy of the distance matrix (arm_distance_matrix_f32) and the k-NN
+ * search (arm_knn_f32) against the one-pair DistanceFunctions kernels.
+ *
+ * Every metric is checked for A x B and for A x A (the symmetric path),
+ * on data centred at 0 and on data offset to 100 with a spread of 0.05,
+ * where |a|^2 + |b|^2 - 2 a.b computed naively loses every significant
+ * digit. The error is relative to the one-pair distance, floored at 1e-3
+ * of the mean distance so near-duplicates do not dominate. The cosine
+ * distance is not shift invariant and is ill-conditioned on the offset
+ * data in any form; its error is absolute (it lies in [0, 2]).
+ *
+ * The k-NN check takes each query's neighbours from arm_knn_f32 and
+ * counts a miss when the i-th neighbour is farther (by the one-pair
+ * distance) than the true i-th nearest by more than 1e-4 relative.
+ *
+ *   distance_harness [--threads N] [--seed N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "arm_math.h"
+#include "harness_util.h"
+
+#define NUM_A       64U
+#define NUM_B       1024U
+#define MAX_DIM     40U
+#define KNN_K       5U
+#define MAX_ERR     1e-3f
+
+static const char *const metric_names[] = { "euclidean", "sqeuclidean", "cosine", "cityblock", "chebyshev" };
+
+static float32_t a[NUM_A * MAX_DIM], b[NUM_B * MAX_DIM];
+static float32_t out[NUM_A * NUM_B], ref[NUM_A * NUM_B];
+static float32_t norms[ARM_DISTANCE_NORMS_SIZE(NUM_A, NUM_B, MAX_DIM)];
+static float32_t knn_norms[ARM_KNN_NORMS_SIZE(NUM_B, MAX_DIM)], knn_dist[ARM_KNN_DIST_SIZE(NUM_B)];
+static float32_t best[NUM_A * KNN_K];
+static uint32_t best_index[NUM_A * KNN_K];
+static uint64_t heap[KNN_K];
+
+/* ============================================
+   Reference
+   ============================================ */
+
+static float32_t pair_distance(arm_distance_metric metric, const float32_t *x, const float32_t *y, uint32_t dim)
+{
+    float32_t d;
+
+    switch (metric) {
+    case ARM_DISTANCE_EUCLIDEAN:   return arm_euclidean_distance_f32(x, y, dim);
+    case ARM_DISTANCE_SQEUCLIDEAN: d = arm_euclidean_distance_f32(x, y, dim); return d * d;
+    case ARM_DISTANCE_COSINE:      return arm_cosine_distance_f32(x, y, dim);
+    case ARM_DISTANCE_CITYBLOCK:   return arm_cityblock_distance_f32(x, y, dim);
+    default:                       return arm_chebyshev_distance_f32(x, y, dim);
+    }
+}
+
+static void fill(float32_t *x, uint32_t n, float32_t offset, float32_t spread)
+{
+    for (uint32_t i = 0; i < n; i++) x[i] = offset + spread * syn_rand();
+}
+
+// Largest error relative to the reference, floored at 1e-3 of its mean
+// (absolute for the cosine distance)
+static float32_t max_rel_error(arm_distance_metric metric, const float32_t *d, const float32_t *r, uint32_t n)
+{
+    double mean = 0.0;
+    float32_t worst = 0.0f;
+
+    for (uint32_t i = 0; i < n; i++) mean += r[i];
+    mean = (metric == ARM_DISTANCE_COSINE) ? 1e3 : mean / n;
+    for (uint32_t i = 0; i < n; i++) {
+        float32_t e = fabsf(d[i] - r[i]) / fmaxf(r[i], 1e-3f * (float32_t)mean);
+        worst = fmaxf(worst, e);
+    }
+    return worst;
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    static const uint32_t dims[] = { 13U, 40U };
+    static const float32_t offsets[] = { 0.0f, 100.0f };
+    uint32_t threads = 1U, failures = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            harness_rng = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (harness_rng == 0U) harness_rng = 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--threads N] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("metric       dim  offset   A x B err   A x A err\n");
+    for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+        for (size_t di = 0; di < sizeof(dims) / sizeof(dims[0]); di++) {
+            const uint32_t dim = dims[di];
+            const float32_t spread = offsets[o] != 0.0f ? 0.05f : 1.0f;
+
+            fill(a, NUM_A * dim, offsets[o], spread);
+            fill(b, NUM_B * dim, offsets[o], spread);
+
+            for (int m = ARM_DISTANCE_EUCLIDEAN; m <= ARM_DISTANCE_CHEBYSHEV; m++) {
+                arm_distance_matrix_instance_f32 S;
+                float32_t err_ab, err_aa;
+
+                arm_distance_matrix_init_f32(&S, (arm_distance_metric)m, threads, norms);
+
+                arm_distance_matrix_f32(&S, a, NUM_A, b, NUM_B, dim, out);
+                for (uint32_t i = 0; i < NUM_A; i++) {
+                    for (uint32_t j = 0; j < NUM_B; j++) {
+                        ref[i * NUM_B + j] = pair_distance((arm_distance_metric)m, a + i * dim, b + j * dim, dim);
+                    }
+                }
+                err_ab = max_rel_error((arm_distance_metric)m, out, ref, NUM_A * NUM_B);
+
+                arm_distance_matrix_f32(&S, a, NUM_A, a, NUM_A, dim, out);
+                for (uint32_t i = 0; i < NUM_A; i++) {
+                    for (uint32_t j = 0; j < NUM_A; j++) {
+                        ref[i * NUM_A + j] = (i == j) ? out[i * NUM_A + j]
+                                           : pair_distance((arm_distance_metric)m, a + i * dim, a + j * dim, dim);
+                    }
+                }
+                err_aa = max_rel_error((arm_distance_metric)m, out, ref, NUM_A * NUM_A);
+
+                if (err_ab > MAX_ERR || err_aa > MAX_ERR) failures++;
+                printf("%-11s  %3u  %6.1f  %10.2e  %10.2e%s\n", metric_names[m], dim, (double)offsets[o],
+                       (double)err_ab, (double)err_aa, (err_ab > MAX_ERR || err_aa > MAX_ERR) ? "  FAIL" : "");
+            }
+        }
+    }
+
+    printf("\nk-NN, euclidean, %u refs, %u queries, k=%u\n", NUM_B, NUM_A, KNN_K);
+    for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+        const uint32_t dim = 13U;
+        const float32_t spread = offsets[o] != 0.0f ? 0.05f : 1.0f;
+        arm_knn_instance_f32 K;
+        uint32_t missed = 0;
+
+        fill(a, NUM_A * dim, offsets[o], spread);
+        fill(b, NUM_B * dim, offsets[o], spread);
+        arm_knn_init_f32(&K, ARM_DISTANCE_EUCLIDEAN, b, NUM_B, dim, KNN_K, threads, knn_norms, knn_dist, heap);
+        arm_knn_f32(&K, a, NUM_A, KNN_K, best, best_index);
+
+        for (uint32_t q = 0; q < NUM_A; q++) {
+            float32_t *d = ref + q * NUM_B, sorted[NUM_B];
+            int miss = 0;
+
+            for (uint32_t j = 0; j < NUM_B; j++) d[j] = arm_euclidean_distance_f32(a + q * dim, b + j * dim, dim);
+            memcpy(sorted, d, sizeof(sorted));
+            for (uint32_t i = 0; i < KNN_K; i++) {
+                uint32_t m = i;
+                for (uint32_t j = i + 1U; j < NUM_B; j++) m = sorted[j] < sorted[m] ? j : m;
+                float32_t t = sorted[i];
+                sorted[i] = sorted[m];
+                sorted[m] = t;
+                if (d[best_index[q * KNN_K + i]] > sorted[i] * (1.0f + 1e-4f)) miss = 1;
+            }
+            missed += (uint32_t)miss;
+        }
+        if (missed != 0U) failures++;
+        printf("offset %6.1f: %u of %u queries with a wrong neighbour%s\n", (double)offsets[o], missed, NUM_A,
+               missed ? "  FAIL" : "");
+    }
+
+    printf("\n%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
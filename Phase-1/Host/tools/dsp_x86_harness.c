@@ -0,0 +1,366 @@
+/* dsp_x86_harness.c
+ *
+ * Agreement of the x86 SIMD paths (Source/X86Functions) with the portable C
+ * code they replace. Every kernel with an x86 hook runs at each
+ * arm_x86_set_level() the CPU supports, on the same input, and is compared
+ * with the scalar level:
+ *
+ *   fir         arm_fir_f32, 1 to 64 taps, a 1000-sample stream cut into
+ *               blocks of 1 to 256 so the state carries across calls
+ *   biquad      arm_biquad_cascade_df2T_f32, 1 section (scalar on every
+ *               level) and 2 to 8 sections, stable random sections
+ *   cfft        arm_cfft_f32, every length, forward and inverse, with
+ *               bitReverseFlag 1 (AVX2 path) and 0 (scalar on every level)
+ *   dot_prod    arm_dot_prod_f32, lengths 0 to 1000
+ *   mat_mult    arm_mat_mult_f32, odd shapes below and above the GEMM
+ *               routing threshold
+ *   cmplx_mag   arm_cmplx_mag_f32, lengths 0 to 1000
+ *   vexp        arm_vexp_f32 over [-80, 80]
+ *
+ * The SIMD paths reassociate sums and use FMA, so results are compared
+ * with a relative tolerance: the error is scaled by the largest reference
+ * output (by sum |a*b| for the dot product, per element for vexp). Paths
+ * that should stay scalar must be bit-exact. Levels the CPU lacks are
+ * reported as n/a.
+ *
+ *   dsp_x86_harness [--seed N]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "harness_util.h"
+
+#if defined(ARM_MATH_X86)
+
+#define MAX_LEN         4096U
+#define STREAM_LEN      1000U
+#define MAX_TAPS        64U
+#define MAX_STAGES      8U
+#define MAX_DIM         160U
+#define NUM_LEVELS      3U
+
+#define TOL_FILTER      1e-5
+#define TOL_CFFT        1e-5
+#define TOL_DOT         1e-6
+#define TOL_MAT         1e-5
+#define TOL_MAG         1e-6
+#define TOL_EXP         1e-6
+
+static const char *const level_names[NUM_LEVELS] = { "scalar", "sse2", "avx2" };
+
+static float32_t in[2U * MAX_LEN], in2[2U * MAX_LEN];
+static float32_t ref[2U * MAX_LEN], out[2U * MAX_LEN];
+static float32_t mat_a[MAX_DIM * MAX_DIM], mat_b[MAX_DIM * MAX_DIM];
+static float32_t mat_ref[MAX_DIM * MAX_DIM], mat_out[MAX_DIM * MAX_DIM];
+static float32_t state[MAX_TAPS + STREAM_LEN];
+static float32_t coeffs[MAX_TAPS > 5U * MAX_STAGES ? MAX_TAPS : 5U * MAX_STAGES];
+
+static uint32_t failures;
+
+/* ============================================
+   Comparison
+   ============================================ */
+
+static void fill(float32_t *x, uint32_t n, float32_t scale)
+{
+    for (uint32_t i = 0; i < n; i++) x[i] = scale * syn_rand();
+}
+
+// Largest |y - r| over the largest |r|; exact = 1 when any difference fails
+static double scaled_error(const float32_t *y, const float32_t *r, uint32_t n, int exact, int *bad)
+{
+    double peak = 0.0, worst = 0.0;
+
+    for (uint32_t i = 0; i < n; i++) peak = fmax(peak, fabs((double)r[i]));
+    for (uint32_t i = 0; i < n; i++) {
+        double e = fabs((double)y[i] - (double)r[i]);
+        if (exact && memcmp(&y[i], &r[i], sizeof(float32_t)) != 0) *bad = 1;
+        if (isnan((double)y[i]) != isnan((double)r[i])) *bad = 1;
+        worst = fmax(worst, e);
+    }
+    return worst / (peak > 0.0 ? peak : 1.0);
+}
+
+// One table row: the worst error per level, FAIL past tol (or when bad)
+static void report(const char *name, const double err[NUM_LEVELS], const int avail[NUM_LEVELS],
+                   const int bad[NUM_LEVELS], double tol)
+{
+    int fail = 0;
+
+    printf("%-28s", name);
+    for (uint32_t l = 1; l < NUM_LEVELS; l++) {
+        if (!avail[l]) {
+            printf("  %10s", "n/a");
+            continue;
+        }
+        printf("  %10.2e", err[l]);
+        if (err[l] > tol || bad[l]) fail = 1;
+    }
+    printf("%s\n", fail ? "  FAIL" : "");
+    failures += fail ? 1U : 0U;
+}
+
+/* ============================================
+   Kernels
+   ============================================ */
+
+static void run_fir(uint32_t taps, uint32_t block, float32_t *y)
+{
+    arm_fir_instance_f32 S;
+
+    memset(state, 0, sizeof(state));
+    arm_fir_init_f32(&S, (uint16_t)taps, coeffs, state, block);
+    for (uint32_t n = 0; n < STREAM_LEN; n += block) {
+        const uint32_t len = (STREAM_LEN - n < block) ? STREAM_LEN - n : block;
+        arm_fir_f32(&S, in + n, y + n, len);
+    }
+}
+
+static void run_biquad(uint32_t stages, uint32_t block, float32_t *y)
+{
+    arm_biquad_cascade_df2T_instance_f32 S;
+
+    memset(state, 0, sizeof(state));
+    arm_biquad_cascade_df2T_init_f32(&S, (uint8_t)stages, coeffs, state);
+    for (uint32_t n = 0; n < STREAM_LEN; n += block) {
+        const uint32_t len = (STREAM_LEN - n < block) ? STREAM_LEN - n : block;
+        arm_biquad_cascade_df2T_f32(&S, in + n, y + n, len);
+    }
+}
+
+// Stable sections: poles at radius 0.5-0.95, zeros anywhere in the unit disk
+static void biquad_coeffs(uint32_t stages)
+{
+    for (uint32_t s = 0; s < stages; s++) {
+        float32_t *c = coeffs + 5U * s;
+        float32_t r = 0.725f + 0.225f * syn_rand(), w = (float32_t)PI * (0.5f + 0.5f * syn_rand());
+        float32_t rz = 0.5f + 0.5f * syn_rand(), wz = (float32_t)PI * (0.5f + 0.5f * syn_rand());
+
+        c[0] = 0.5f;
+        c[1] = -c[0] * 2.0f * rz * cosf(wz);
+        c[2] = c[0] * rz * rz;
+        c[3] = 2.0f * r * cosf(w);
+        c[4] = -r * r;
+    }
+}
+
+static void run_mat(uint32_t m, uint32_t k, uint32_t n, float32_t *y)
+{
+    arm_matrix_instance_f32 A, B, C;
+
+    arm_mat_init_f32(&A, (uint16_t)m, (uint16_t)k, mat_a);
+    arm_mat_init_f32(&B, (uint16_t)k, (uint16_t)n, mat_b);
+    arm_mat_init_f32(&C, (uint16_t)m, (uint16_t)n, y);
+    arm_mat_mult_f32(&A, &B, &C);
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    static const uint32_t taps_list[] = { 1, 3, 4, 5, 8, 17, 29, 32, 33, 64 };
+    static const uint32_t blocks[] = { 1, 3, 16, 17, 64, 256 };
+    static const uint32_t stage_list[] = { 1, 2, 3, 4, 5, 8 };
+    static const uint32_t fft_lens[] = { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+    static const uint32_t lens[] = { 0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 33, 64, 255, 1000 };
+    static const uint32_t shapes[][3] = { { 1, 1, 1 }, { 3, 5, 7 }, { 13, 40, 9 }, { 17, 33, 65 },
+                                          { 64, 64, 64 }, { 129, 127, 131 }, { 160, 160, 160 } };
+    int avail[NUM_LEVELS] = { 1, 0, 0 };
+    char name[64];
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            harness_rng = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (harness_rng == 0U) harness_rng = 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    for (uint32_t l = 1; l < NUM_LEVELS; l++) {
+        avail[l] = (arm_x86_set_level((arm_x86_level)l) == (arm_x86_level)l);
+    }
+    printf("kernel                        %10s  %10s   (error vs scalar)\n", level_names[1], level_names[2]);
+
+    // FIR, state carried across blocks
+    for (size_t t = 0; t < sizeof(taps_list) / sizeof(taps_list[0]); t++) {
+        const uint32_t taps = taps_list[t];
+        double err[NUM_LEVELS] = { 0.0 };
+        int bad[NUM_LEVELS] = { 0 };
+
+        fill(coeffs, taps, 1.0f);
+        fill(in, STREAM_LEN, 1.0f);
+        for (size_t b = 0; b < sizeof(blocks) / sizeof(blocks[0]); b++) {
+            arm_x86_set_level(ARM_X86_LEVEL_SCALAR);
+            run_fir(taps, blocks[b], ref);
+            for (uint32_t l = 1; l < NUM_LEVELS; l++) {
+                if (!avail[l]) continue;
+                arm_x86_set_level((arm_x86_level)l);
+                run_fir(taps, blocks[b], out);
+                err[l] = fmax(err[l], scaled_error(out, ref, STREAM_LEN, 0, &bad[l]));
+            }
+        }
+        snprintf(name, sizeof(name), "fir_f32 taps=%u", taps);
+        report(name, err, avail, bad, TOL_FILTER);
+    }
+
+    // Biquad cascade; one section never leaves the scalar code
+    for (size_t s = 0; s < sizeof(stage_list) / sizeof(stage_list[0]); s++) {
+        const uint32_t stages = stage_list[s];
+        double err[NUM_LEVELS] = { 0.0 };
+        int bad[NUM_LEVELS] = { 0 };
+
+        biquad_coeffs(stages);
+        fill(in, STREAM_LEN, 1.0f);
+        for (size_t b = 0; b < sizeof(blocks) / sizeof(blocks[0]); b++) {
+            arm_x86_set_level(ARM_X86_LEVEL_SCALAR);
+            run_biquad(stages, blocks[b], ref);
+            for (uint32_t l = 1; l < NUM_LEVELS; l++) {
+                if (!avail[l]) continue;
+                arm_x86_set_level((arm_x86_level)l);
+                run_biquad(stages, blocks[b], out);
+                err[l] = fmax(err[l], scaled_error(out, ref, STREAM_LEN, stages == 1U, &bad[l]));
+            }
+        }
+        snprintf(name, sizeof(name), "biquad_df2T_f32 stages=%u", stages);
+        report(name, err, avail, bad, TOL_FILTER);
+    }
+
+    // CFFT; without the bit reversal the scalar code runs on every level
+    for (uint32_t rev = 0; rev < 2U; rev++) {
+        for (uint32_t ifft = 0; ifft < 2U; ifft++) {
+            for (size_t f = 0; f < sizeof(fft_lens) / sizeof(fft_lens[0]); f++) {
+                const uint32_t len = fft_lens[f];
+                arm_cfft_instance_f32 S;
+                double err[NUM_LEVELS] = { 0.0 };
+                int bad[NUM_LEVELS] = { 0 };
+
+                arm_cfft_init_f32(&S, (uint16_t)len);
+                fill(in, 2U * len, 1.0f);
+                arm_x86_set_level(ARM_X86_LEVEL_SCALAR);
+                memcpy(ref, in, 2U * len * sizeof(float32_t));
+                arm_cfft_f32(&S, ref, (uint8_t)ifft, (uint8_t)rev);
+                for (uint32_t l = 1; l < NUM_LEVELS; l++) {
+                    if (!avail[l]) continue;
+                    arm_x86_set_level((arm_x86_level)l);
+                    memcpy(out, in, 2U * len * sizeof(float32_t));
+                    arm_cfft_f32(&S, out, (uint8_t)ifft, (uint8_t)rev);
+                    err[l] = scaled_error(out, ref, 2U * len, rev == 0U, &bad[l]);
+                }
+                snprintf(name, sizeof(name), "cfft_f32 %s %u bitrev=%u", ifft ? "inv" : "fwd", len, rev);
+                report(name, err, avail, bad, TOL_CFFT);
+            }
+        }
+    }
+
+    // Dot product, error over sum |a*b| since the sum itself can cancel
+    {
+        double err[NUM_LEVELS] = { 0.0 };
+        int bad[NUM_LEVELS] = { 0 };
+
+        for (size_t n = 0; n < sizeof(lens) / sizeof(lens[0]); n++) {
+            const uint32_t len = lens[n];
+            double mag = 0.0;
+            float32_t r, y;
+
+            fill(in, len, 1.0f);
+            fill(in2, len, 1.0f);
+            for (uint32_t i = 0; i < len; i++) mag += fabs((double)in[i] * in2[i]);
+            arm_x86_set_level(ARM_X86_LEVEL_SCALAR);
+            arm_dot_prod_f32(in, in2, len, &r);
+            for (uint32_t l = 1; l < NUM_LEVELS; l++) {
+                if (!avail[l]) continue;
+                arm_x86_set_level((arm_x86_level)l);
+                arm_dot_prod_f32(in, in2, len, &y);
+                err[l] = fmax(err[l], fabs((double)y - (double)r) / (mag > 0.0 ? mag : 1.0));
+            }
+        }
+        report("dot_prod_f32 len=0..1000", err, avail, bad, TOL_DOT);
+    }
+
+    // Matrix product, per-shape error over the largest output
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        const uint32_t m = shapes[s][0], k = shapes[s][1], n = shapes[s][2];
+        double err[NUM_LEVELS] = { 0.0 };
+        int bad[NUM_LEVELS] = { 0 };
+
+        fill(mat_a, m * k, 1.0f);
+        fill(mat_b, k * n, 1.0f);
+        arm_x86_set_level(ARM_X86_LEVEL_SCALAR);
+        run_mat(m, k, n, mat_ref);
+        for (uint32_t l = 1; l < NUM_LEVELS; l++) {
+            if (!avail[l]) continue;
+            arm_x86_set_level((arm_x86_level)l);
+            run_mat(m, k, n, mat_out);
+            err[l] = scaled_error(mat_out, mat_ref, m * n, 0, &bad[l]);
+        }
+        snprintf(name, sizeof(name), "mat_mult_f32 %ux%ux%u", m, k, n);
+        report(name, err, avail, bad, TOL_MAT);
+    }
+
+    // Complex magnitude
+    {
+        double err[NUM_LEVELS] = { 0.0 };
+        int bad[NUM_LEVELS] = { 0 };
+
+        for (size_t n = 0; n < sizeof(lens) / sizeof(lens[0]); n++) {
+            const uint32_t len = lens[n];
+
+            fill(in, 2U * len, 100.0f);
+            arm_x86_set_level(ARM_X86_LEVEL_SCALAR);
+            arm_cmplx_mag_f32(in, ref, len);
+            for (uint32_t l = 1; l < NUM_LEVELS; l++) {
+                if (!avail[l]) continue;
+                arm_x86_set_level((arm_x86_level)l);
+                arm_cmplx_mag_f32(in, out, len);
+                for (uint32_t i = 0; i < len; i++) {
+                    err[l] = fmax(err[l], fabs((double)out[i] - ref[i]) / fmax((double)ref[i], 1e-30));
+                }
+            }
+        }
+        report("cmplx_mag_f32 len=0..1000", err, avail, bad, TOL_MAG);
+    }
+
+    // Exponential, relative per element
+    {
+        double err[NUM_LEVELS] = { 0.0 };
+        int bad[NUM_LEVELS] = { 0 };
+
+        for (size_t n = 0; n < sizeof(lens) / sizeof(lens[0]); n++) {
+            const uint32_t len = lens[n];
+
+            fill(in, len, 80.0f);
+            arm_x86_set_level(ARM_X86_LEVEL_SCALAR);
+            arm_vexp_f32(in, ref, len);
+            for (uint32_t l = 1; l < NUM_LEVELS; l++) {
+                if (!avail[l]) continue;
+                arm_x86_set_level((arm_x86_level)l);
+                arm_vexp_f32(in, out, len);
+                for (uint32_t i = 0; i < len; i++) {
+                    err[l] = fmax(err[l], fabs((double)out[i] - ref[i]) / fmax((double)ref[i], 1e-30));
+                }
+            }
+        }
+        report("vexp_f32 len=0..1000", err, avail, bad, TOL_EXP);
+    }
+
+    printf("\n%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
+
+#else
+
+int main(void)
+{
+    printf("built without ARM_MATH_X86, no SIMD paths to check\n");
+    return 0;
+}
+
+#endif /* defined(ARM_MATH_X86) */
@@ -0,0 +1,267 @@
+/* fft_batch_harness.c
+ *
+ * Agreement of the batched FFTs and the STFT (BatchFFT group) with the
+ * single-frame functions they stand in for.
+ *
+ *   cfft   arm_cfft_batch_f32 against arm_cfft_f32 with bitReverseFlag 1
+ *          on each frame, every length, forward and inverse, contiguous
+ *          (frames padded apart) and interleaved layouts
+ *   rfft   arm_rfft_fast_batch_f32 against arm_rfft_fast_f32 on each
+ *          frame, same lengths, directions and layouts
+ *   stft   arm_stft_f32 against a window, zero-pad and arm_rfft_fast_f32
+ *          of each frame done by hand, with overlapping, adjacent and
+ *          gapped hops, frames shorter than the FFT, a Hann and a
+ *          rectangular (NULL) window
+ *
+ * Frame counts straddle ARM_FFT_BATCH_MIN_FRAMES and reach past one tile
+ * of ARM_FFT_BATCH_TILE_BYTES. The error is the largest difference over
+ * the largest reference value of the case. Every output buffer ends in a
+ * guard band, and the contiguous padding between frames and the STFT
+ * scratch past its documented size must come back untouched. Strides too
+ * small for a frame must be refused with ARM_MATH_ARGUMENT_ERROR.
+ *
+ *   fft_batch_harness [--seed N]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "harness_util.h"
+
+#define MAX_LEN         4096U
+#define MAX_FRAMES      80U
+#define STFT_FRAMES     50U
+#define PAD             6U
+#define GUARD           16U
+#define GUARD_VALUE     1234.5f
+#define MAX_ERR         1e-5
+
+static float32_t src[MAX_FRAMES * (2U * MAX_LEN + PAD) + GUARD];
+static float32_t work[MAX_FRAMES * (2U * MAX_LEN + PAD) + GUARD];
+static float32_t out[MAX_FRAMES * (2U * MAX_LEN + PAD) + GUARD];
+static float32_t ref[MAX_FRAMES * 2U * MAX_LEN];
+static float32_t frame[2U * MAX_LEN], window[MAX_LEN];
+static float32_t scratch[MAX_LEN * ARM_FFT_BATCH_MIN_FRAMES + GUARD];
+
+static uint32_t failures;
+
+/* ============================================
+   Helpers
+   ============================================ */
+
+static void fill(float32_t *x, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) x[i] = syn_rand();
+}
+
+static void guard(float32_t *x, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) x[i] = GUARD_VALUE;
+}
+
+static int guard_intact(const float32_t *x, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        if (x[i] != GUARD_VALUE) return 0;
+    }
+    return 1;
+}
+
+// Index of value v of frame f in either layout (width 2 for complex values)
+static uint32_t at(arm_fft_batch_layout layout, uint32_t f, uint32_t v, uint32_t stride, uint32_t frames,
+                   uint32_t width)
+{
+    if (layout == ARM_FFT_BATCH_CONTIGUOUS) return f * stride + v;
+    return (v / width * frames + f) * width + v % width;
+}
+
+static double peak(const float32_t *x, uint32_t n)
+{
+    double p = 0.0;
+
+    for (uint32_t i = 0; i < n; i++) p = fmax(p, fabs((double)x[i]));
+    return p > 0.0 ? p : 1.0;
+}
+
+// One row for the largest frame count of each case, and for every failure
+static void report(const char *name, uint32_t len, const char *variant, uint32_t frames, int show, double err,
+                   int ok)
+{
+    int fail = !ok || err > MAX_ERR;
+
+    if (fail || show) {
+        printf("%-5s %5u  %-18s  %3u  %10.2e%s\n", name, len, variant, frames, err, fail ? "  FAIL" : "");
+    }
+    failures += fail ? 1U : 0U;
+}
+
+/* ============================================
+   Batched CFFT and RFFT
+   ============================================ */
+
+static void check_cfft(uint32_t len, uint32_t frames, arm_fft_batch_layout layout, uint8_t ifft)
+{
+    const uint32_t stride = 2U * len + PAD, total = (layout == ARM_FFT_BATCH_CONTIGUOUS) ? frames * stride
+                                                                                     : frames * 2U * len;
+    arm_cfft_instance_f32 S;
+    double err = 0.0;
+    int ok;
+
+    arm_cfft_init_f32(&S, (uint16_t)len);
+    fill(src, frames * 2U * len);
+    guard(work, total + GUARD);
+    for (uint32_t f = 0; f < frames; f++) {
+        for (uint32_t v = 0; v < 2U * len; v++) {
+            work[at(layout, f, v, stride, frames, 2U)] = src[f * 2U * len + v];
+        }
+        memcpy(ref + f * 2U * len, src + f * 2U * len, 2U * len * sizeof(float32_t));
+        arm_cfft_f32(&S, ref + f * 2U * len, ifft, 1U);
+    }
+
+    ok = arm_cfft_batch_f32(&S, work, frames, stride, layout, ifft) == ARM_MATH_SUCCESS;
+    ok = ok && guard_intact(work + total, GUARD);
+    for (uint32_t f = 0; f < frames; f++) {
+        const double p = peak(ref + f * 2U * len, 2U * len);
+        for (uint32_t v = 0; v < 2U * len; v++) {
+            float32_t y = work[at(layout, f, v, stride, frames, 2U)];
+            err = fmax(err, fabs((double)y - ref[f * 2U * len + v]) / p);
+        }
+        if (layout == ARM_FFT_BATCH_CONTIGUOUS) ok = ok && guard_intact(work + f * stride + 2U * len, PAD);
+    }
+    report("cfft", len, layout == ARM_FFT_BATCH_CONTIGUOUS ? (ifft ? "contig inv" : "contig fwd")
+                                                          : (ifft ? "interleaved inv" : "interleaved fwd"),
+           frames, frames == MAX_FRAMES, err, ok);
+}
+
+static void check_rfft(uint32_t len, uint32_t frames, arm_fft_batch_layout layout, uint8_t ifft)
+{
+    const uint32_t stride = len + PAD, total = (layout == ARM_FFT_BATCH_CONTIGUOUS) ? frames * stride : frames * len;
+    arm_rfft_fast_instance_f32 S;
+    double err = 0.0;
+    int ok;
+
+    arm_rfft_fast_init_f32(&S, (uint16_t)len);
+    fill(src, frames * len);
+    guard(out, total + GUARD);
+    for (uint32_t f = 0; f < frames; f++) {
+        for (uint32_t v = 0; v < len; v++) work[at(layout, f, v, stride, frames, 1U)] = src[f * len + v];
+        memcpy(frame, src + f * len, len * sizeof(float32_t));
+        arm_rfft_fast_f32(&S, frame, ref + f * len, ifft);
+    }
+
+    ok = arm_rfft_fast_batch_f32(&S, work, out, frames, stride, stride, layout, ifft) == ARM_MATH_SUCCESS;
+    ok = ok && guard_intact(out + total, GUARD);
+    for (uint32_t f = 0; f < frames; f++) {
+        const double p = peak(ref + f * len, len);
+        for (uint32_t v = 0; v < len; v++) {
+            float32_t y = out[at(layout, f, v, stride, frames, 1U)];
+            err = fmax(err, fabs((double)y - ref[f * len + v]) / p);
+        }
+        if (layout == ARM_FFT_BATCH_CONTIGUOUS) ok = ok && guard_intact(out + f * stride + len, PAD);
+    }
+    report("rfft", len, layout == ARM_FFT_BATCH_CONTIGUOUS ? (ifft ? "contig inv" : "contig fwd")
+                                                          : (ifft ? "interleaved inv" : "interleaved fwd"),
+           frames, frames == MAX_FRAMES, err, ok);
+}
+
+/* ============================================
+   STFT
+   ============================================ */
+
+static void check_stft(uint32_t len, uint32_t win_len, uint32_t hop, uint32_t frames, int hann)
+{
+    const uint32_t samples = (frames - 1U) * hop + win_len;
+    arm_stft_instance_f32 S;
+    double err = 0.0;
+    char variant[32];
+    int ok;
+
+    for (uint32_t k = 0; k < win_len; k++) window[k] = 0.5f - 0.5f * cosf(2.0f * (float32_t)PI * k / win_len);
+    ok = arm_stft_init_f32(&S, (uint16_t)len, (uint16_t)win_len, (uint16_t)hop, hann ? window : NULL)
+         == ARM_MATH_SUCCESS;
+    fill(src, samples);
+    guard(out, frames * len + GUARD);
+    guard(scratch, sizeof(scratch) / sizeof(scratch[0]));
+
+    for (uint32_t f = 0; f < frames; f++) {
+        memset(frame, 0, len * sizeof(float32_t));
+        for (uint32_t k = 0; k < win_len; k++) frame[k] = src[f * hop + k] * (hann ? window[k] : 1.0f);
+        arm_rfft_fast_f32(&S.rfft, frame, ref + f * len, 0U);
+    }
+
+    arm_stft_f32(&S, src, frames, out, scratch);
+    ok = ok && guard_intact(out + frames * len, GUARD);
+    ok = ok && guard_intact(scratch + len * ARM_FFT_BATCH_MIN_FRAMES, GUARD);
+    for (uint32_t f = 0; f < frames; f++) {
+        const double p = peak(ref + f * len, len);
+        for (uint32_t v = 0; v < len; v++) err = fmax(err, fabs((double)out[f * len + v] - ref[f * len + v]) / p);
+    }
+    snprintf(variant, sizeof(variant), "win %u hop %u %s", win_len, hop, hann ? "hann" : "rect");
+    report("stft", len, variant, frames, frames == STFT_FRAMES, err, ok);
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    static const uint32_t lens[] = { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+    static const uint32_t frame_counts[] = { 1, 3, ARM_FFT_BATCH_MIN_FRAMES, ARM_FFT_BATCH_MIN_FRAMES + 1U, 37,
+                                             MAX_FRAMES };
+    static const uint32_t stft_frames[] = { 1, 7, 8, 9, STFT_FRAMES };
+    arm_cfft_instance_f32 C;
+    arm_rfft_fast_instance_f32 R;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            harness_rng = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (harness_rng == 0U) harness_rng = 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("kind    len  variant             frames  err\n");
+    for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        for (size_t n = 0; n < sizeof(frame_counts) / sizeof(frame_counts[0]); n++) {
+            for (uint8_t ifft = 0; ifft < 2U; ifft++) {
+                check_cfft(lens[l], frame_counts[n], ARM_FFT_BATCH_CONTIGUOUS, ifft);
+                check_cfft(lens[l], frame_counts[n], ARM_FFT_BATCH_INTERLEAVED, ifft);
+                // The real FFT starts at 32 points
+                if (lens[l] >= 32U) {
+                    check_rfft(lens[l], frame_counts[n], ARM_FFT_BATCH_CONTIGUOUS, ifft);
+                    check_rfft(lens[l], frame_counts[n], ARM_FFT_BATCH_INTERLEAVED, ifft);
+                }
+            }
+        }
+    }
+
+    for (size_t n = 0; n < sizeof(stft_frames) / sizeof(stft_frames[0]); n++) {
+        for (int hann = 0; hann < 2; hann++) {
+            check_stft(512U, 400U, 160U, stft_frames[n], hann);
+            check_stft(512U, 512U, 512U, stft_frames[n], hann);
+            check_stft(256U, 200U, 300U, stft_frames[n], hann);
+            check_stft(1024U, 640U, 320U, stft_frames[n], hann);
+        }
+    }
+
+    // Strides that cannot hold a frame
+    arm_cfft_init_f32(&C, 256U);
+    arm_rfft_fast_init_f32(&R, 256U);
+    if (arm_cfft_batch_f32(&C, work, 2U, 511U, ARM_FFT_BATCH_CONTIGUOUS, 0U) != ARM_MATH_ARGUMENT_ERROR ||
+        arm_rfft_fast_batch_f32(&R, work, out, 2U, 255U, 256U, ARM_FFT_BATCH_CONTIGUOUS, 0U)
+            != ARM_MATH_ARGUMENT_ERROR ||
+        arm_rfft_fast_batch_f32(&R, work, out, 2U, 256U, 255U, ARM_FFT_BATCH_CONTIGUOUS, 0U)
+            != ARM_MATH_ARGUMENT_ERROR) {
+        printf("short stride accepted  FAIL\n");
+        failures++;
+    }
+
+    printf("\n%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
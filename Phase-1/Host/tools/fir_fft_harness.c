@@ -0,0 +1,168 @@
+/* fir_fft_harness.c
+ *
+ * Agreement of the partitioned FFT FIR filter (arm_fir_fft_f32) and of the
+ * automatic direct/FFT choice (arm_fir_auto_f32) with arm_fir_f32.
+ *
+ *   fft    every partition length from 16 to 2048 against tap counts on
+ *          both sides of a partition boundary, up to 4096, blocks of one
+ *          and three partitions; a block that is not a whole number of
+ *          partitions must return ARM_MATH_LENGTH_ERROR
+ *   auto   tap counts from 1 to 4096 against block sizes from 1 to 1024,
+ *          whichever form arm_fir_auto_part_len_f32 picks (shown as the
+ *          partition length, 0 for the direct form)
+ *
+ * Each run filters a 6144-sample stream in equal blocks, so the state and
+ * the frequency-domain delay line carry across calls. The error is the
+ * largest difference over the largest output of arm_fir_f32 run on the
+ * same stream. The output buffer ends in a guard band.
+ *
+ *   fir_fft_harness [--seed N]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "harness_util.h"
+
+#define STREAM_LEN      6144U
+#define MAX_TAPS        4096U
+#define MAX_PART        2048U
+#define GUARD           16U
+#define GUARD_VALUE     1234.5f
+#define MAX_ERR         1e-5
+
+static float32_t coeffs[MAX_TAPS], in[STREAM_LEN], ref[STREAM_LEN], out[STREAM_LEN + GUARD];
+static float32_t fir_state[MAX_TAPS + STREAM_LEN];
+// ARM_FIR_FFT_COEFFS_SIZE and ARM_FIR_FFT_STATE_SIZE are at most 2 taps + 2 and + 8 partitions
+static float32_t coeffs_freq[2U * MAX_TAPS + 2U * MAX_PART];
+static float32_t fft_state[2U * MAX_TAPS + 8U * MAX_PART];
+
+/* ============================================
+   Reference and comparison
+   ============================================ */
+
+// arm_fir_f32 over the first len samples, in blocks of block
+static void run_direct(uint32_t taps, uint32_t block, uint32_t len)
+{
+    arm_fir_instance_f32 S;
+
+    arm_fir_init_f32(&S, (uint16_t)taps, coeffs, fir_state, block);
+    for (uint32_t n = 0; n < len; n += block) arm_fir_f32(&S, in + n, ref + n, block);
+}
+
+static double error(uint32_t len, int *ok)
+{
+    double peak = 0.0, worst = 0.0;
+
+    for (uint32_t i = 0; i < len; i++) peak = fmax(peak, fabs((double)ref[i]));
+    for (uint32_t i = 0; i < len; i++) worst = fmax(worst, fabs((double)out[i] - ref[i]));
+    for (uint32_t i = 0; i < GUARD; i++) {
+        if (out[len + i] != GUARD_VALUE) *ok = 0;
+    }
+    return worst / (peak > 0.0 ? peak : 1.0);
+}
+
+static void guard(uint32_t len)
+{
+    for (uint32_t i = 0; i < GUARD; i++) out[len + i] = GUARD_VALUE;
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    static const uint32_t fft_taps[] = { 1, 15, 16, 17, 255, 256, 257, 1000, 2048, 4096 };
+    static const uint32_t auto_taps[] = { 1, 8, 32, 64, 200, 512, 1024, 4096 };
+    static const uint32_t auto_blocks[] = { 1, 16, 64, 100, 256, 1024 };
+    uint32_t failures = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            harness_rng = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (harness_rng == 0U) harness_rng = 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    for (uint32_t i = 0; i < STREAM_LEN; i++) in[i] = syn_rand();
+
+    printf("arm_fir_fft_f32, worst error over block sizes of 1 and 3 partitions\n");
+    printf(" taps");
+    for (uint32_t part = 16U; part <= MAX_PART; part <<= 1U) printf("  %8u", part);
+    printf("\n");
+    for (size_t t = 0; t < sizeof(fft_taps) / sizeof(fft_taps[0]); t++) {
+        const uint32_t taps = fft_taps[t];
+        int row_fail = 0;
+
+        for (uint32_t i = 0; i < taps; i++) coeffs[i] = syn_rand() / sqrtf((float32_t)taps);
+        printf("%5u", taps);
+        for (uint32_t part = 16U; part <= MAX_PART; part <<= 1U) {
+            double err = 0.0;
+            int ok = 1;
+
+            for (uint32_t mult = 1U; mult <= 3U; mult += 2U) {
+                const uint32_t block = part * mult, len = STREAM_LEN / block * block;
+                arm_fir_fft_instance_f32 S;
+
+                run_direct(taps, block, len);
+                guard(len);
+                ok &= arm_fir_fft_init_f32(&S, (uint16_t)taps, coeffs, (uint16_t)part, coeffs_freq, fft_state)
+                      == ARM_MATH_SUCCESS;
+                for (uint32_t n = 0; n < len; n += block) {
+                    ok &= arm_fir_fft_f32(&S, in + n, out + n, block) == ARM_MATH_SUCCESS;
+                }
+                err = fmax(err, error(len, &ok));
+                ok &= arm_fir_fft_f32(&S, in, out, part + 1U) == ARM_MATH_LENGTH_ERROR;
+            }
+            printf("  %8.2e", err);
+            if (!ok || err > MAX_ERR) row_fail = 1;
+        }
+        printf("%s\n", row_fail ? "  FAIL" : "");
+        failures += (uint32_t)row_fail;
+    }
+
+    printf("\narm_fir_auto_f32, error (partition length picked, 0 = direct form)\n");
+    printf(" taps");
+    for (size_t b = 0; b < sizeof(auto_blocks) / sizeof(auto_blocks[0]); b++) {
+        printf("    block %-5u", auto_blocks[b]);
+    }
+    printf("\n");
+    for (size_t t = 0; t < sizeof(auto_taps) / sizeof(auto_taps[0]); t++) {
+        const uint32_t taps = auto_taps[t];
+        int row_fail = 0;
+
+        for (uint32_t i = 0; i < taps; i++) coeffs[i] = syn_rand() / sqrtf((float32_t)taps);
+        printf("%5u", taps);
+        for (size_t b = 0; b < sizeof(auto_blocks) / sizeof(auto_blocks[0]); b++) {
+            const uint32_t block = auto_blocks[b], len = STREAM_LEN / block * block;
+            const uint16_t part = arm_fir_auto_part_len_f32((uint16_t)taps, block);
+            arm_fir_auto_instance_f32 S;
+            double err;
+            int ok = 1;
+
+            run_direct(taps, block, len);
+            guard(len);
+            ok &= arm_fir_auto_init_f32(&S, (uint16_t)taps, coeffs, coeffs_freq,
+                                        part ? fft_state : fir_state, block) == ARM_MATH_SUCCESS;
+            ok &= S.partLen == part;
+            for (uint32_t n = 0; n < len; n += block) {
+                ok &= arm_fir_auto_f32(&S, in + n, out + n, block) == ARM_MATH_SUCCESS;
+            }
+            err = error(len, &ok);
+            printf("  %8.2e %4u", err, part);
+            if (!ok || err > MAX_ERR) row_fail = 1;
+        }
+        printf("%s\n", row_fail ? "  FAIL" : "");
+        failures += (uint32_t)row_fail;
+    }
+
+    printf("\n%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,224 @@
+/* gemm_harness.c
+ *
+ * Agreement of the general matrix multiplications (arm_mat_gemm_f32,
+ * arm_mat_gemm_q31) with arm_mat_trans + arm_mat_mult, for the four
+ * operand forms (A * B, A^T * B, A * B^T, A^T * B^T) and 1, 2, 3 threads
+ * and all CPUs:
+ *
+ *   q31   must be bit-exact with arm_mat_trans_q31 + arm_mat_mult_q31 and
+ *         with a plain 2.62 sum in C (arm_mat_mult_q31 itself hands large
+ *         products to the GEMM)
+ *   f32   error against a double product, over the sum of |a| * |b| of
+ *         each output, must be under 1e-6 for both arm_mat_gemm_f32 and
+ *         arm_mat_trans_f32 + arm_mat_mult_f32
+ *
+ * Shapes are odd around the 4 x 16 (f32) and 2 x 4 (q31) micro-kernels,
+ * deeper than one 256-deep slice, and large enough (over 3 x 2^21
+ * multiply-accumulates) to be split between three threads, by rows and by
+ * columns. The output ends in a guard band. q31 inputs are below 2^27 so
+ * the 2.62 sums cannot overflow.
+ *
+ *   gemm_harness [--seed N]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "harness_util.h"
+
+#define MAX_ELEMS       (320U * 300U)
+#define GUARD           16U
+#define GUARD_F32       1234.5f
+#define GUARD_Q31       0x12345678
+#define MAX_ERR         1e-6
+
+typedef struct {
+    uint16_t m, k, n;
+} shape_t;
+
+static float32_t a_f32[MAX_ELEMS], b_f32[MAX_ELEMS], at_f32[MAX_ELEMS], bt_f32[MAX_ELEMS];
+static float32_t c_f32[MAX_ELEMS + GUARD], ref_f32[MAX_ELEMS];
+static double ref_f64[MAX_ELEMS], mag_f64[MAX_ELEMS];
+static q31_t a_q31[MAX_ELEMS], b_q31[MAX_ELEMS], at_q31[MAX_ELEMS], bt_q31[MAX_ELEMS];
+static q31_t c_q31[MAX_ELEMS + GUARD], ref_q31[MAX_ELEMS], plain_q31[MAX_ELEMS];
+static float32_t opa_f32[MAX_ELEMS], opb_f32[MAX_ELEMS];
+static q31_t opa_q31[MAX_ELEMS], opb_q31[MAX_ELEMS];
+
+/* ============================================
+   References
+   ============================================ */
+
+// Plain products of op(A) (m x k) and op(B) (k x n), given untransposed as a (m x k) and b (k x n)
+static void plain(uint32_t m, uint32_t k, uint32_t n)
+{
+    for (uint32_t i = 0; i < m; i++) {
+        for (uint32_t j = 0; j < n; j++) {
+            double s = 0.0, mag = 0.0;
+            q63_t q = 0;
+
+            for (uint32_t p = 0; p < k; p++) {
+                s += (double)a_f32[i * k + p] * b_f32[p * n + j];
+                mag += fabs((double)a_f32[i * k + p] * b_f32[p * n + j]);
+                q += (q63_t)a_q31[i * k + p] * b_q31[p * n + j];
+            }
+            ref_f64[i * n + j] = s;
+            mag_f64[i * n + j] = mag;
+            plain_q31[i * n + j] = (q31_t)(q >> 31);
+        }
+    }
+}
+
+// dst = op(src) in buf, with arm_mat_trans
+static arm_status op_f32(const arm_matrix_instance_f32 *src, arm_mat_op op, arm_matrix_instance_f32 *dst,
+                         float32_t *buf)
+{
+    if (op == ARM_MAT_NOTRANS) {
+        *dst = *src;
+        return ARM_MATH_SUCCESS;
+    }
+    arm_mat_init_f32(dst, src->numCols, src->numRows, buf);
+    return arm_mat_trans_f32(src, dst);
+}
+
+static arm_status op_q31(const arm_matrix_instance_q31 *src, arm_mat_op op, arm_matrix_instance_q31 *dst,
+                         q31_t *buf)
+{
+    if (op == ARM_MAT_NOTRANS) {
+        *dst = *src;
+        return ARM_MATH_SUCCESS;
+    }
+    arm_mat_init_q31(dst, src->numCols, src->numRows, buf);
+    return arm_mat_trans_q31(src, dst);
+}
+
+static double error_f32(const float32_t *c, uint32_t len)
+{
+    double worst = 0.0;
+
+    for (uint32_t i = 0; i < len; i++) {
+        worst = fmax(worst, fabs((double)c[i] - ref_f64[i]) / (mag_f64[i] > 0.0 ? mag_f64[i] : 1.0));
+    }
+    return worst;
+}
+
+static void guard(uint32_t len)
+{
+    for (uint32_t i = 0; i < GUARD; i++) {
+        c_f32[len + i] = GUARD_F32;
+        c_q31[len + i] = GUARD_Q31;
+    }
+}
+
+static int guard_ok(uint32_t len)
+{
+    for (uint32_t i = 0; i < GUARD; i++) {
+        if (c_f32[len + i] != GUARD_F32 || c_q31[len + i] != GUARD_Q31) return 0;
+    }
+    return 1;
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    static const shape_t shapes[] = {
+        { 1, 1, 1 }, { 1, 7, 1 }, { 3, 5, 2 }, { 4, 16, 16 }, { 5, 17, 33 }, { 17, 3, 15 },
+        { 63, 257, 31 }, { 64, 300, 64 }, { 400, 130, 131 }, { 131, 130, 400 }, { 161, 300, 97 },
+    };
+    static const uint32_t threads[] = { 1, 2, 3, 0 };
+    static const char *const ops[] = { "A*B", "A'*B", "A*B'", "A'*B'" };
+    uint32_t failures = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            harness_rng = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (harness_rng == 0U) harness_rng = 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("   M    K    N  op     f32 gemm  f32 trans+mult  q31 mismatches (threads 1/2/3/all)\n");
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        const uint32_t m = shapes[s].m, k = shapes[s].k, n = shapes[s].n;
+        arm_matrix_instance_f32 A, B, At, Bt, OA, OB, C, R;
+        arm_matrix_instance_q31 Aq, Bq, Atq, Btq, OAq, OBq, Cq, Rq;
+
+        for (uint32_t i = 0; i < m * k; i++) {
+            a_f32[i] = syn_rand();
+            a_q31[i] = (q31_t)(harness_rand_u32()) >> 5;
+        }
+        for (uint32_t i = 0; i < k * n; i++) {
+            b_f32[i] = syn_rand();
+            b_q31[i] = (q31_t)(harness_rand_u32()) >> 5;
+        }
+        plain(m, k, n);
+
+        // Stored transposes, read through opA/opB
+        arm_mat_init_f32(&A, (uint16_t)m, (uint16_t)k, a_f32);
+        arm_mat_init_f32(&B, (uint16_t)k, (uint16_t)n, b_f32);
+        arm_mat_init_f32(&At, (uint16_t)k, (uint16_t)m, at_f32);
+        arm_mat_init_f32(&Bt, (uint16_t)n, (uint16_t)k, bt_f32);
+        arm_mat_trans_f32(&A, &At);
+        arm_mat_trans_f32(&B, &Bt);
+        arm_mat_init_q31(&Aq, (uint16_t)m, (uint16_t)k, a_q31);
+        arm_mat_init_q31(&Bq, (uint16_t)k, (uint16_t)n, b_q31);
+        arm_mat_init_q31(&Atq, (uint16_t)k, (uint16_t)m, at_q31);
+        arm_mat_init_q31(&Btq, (uint16_t)n, (uint16_t)k, bt_q31);
+        arm_mat_trans_q31(&Aq, &Atq);
+        arm_mat_trans_q31(&Bq, &Btq);
+        arm_mat_init_f32(&C, (uint16_t)m, (uint16_t)n, c_f32);
+        arm_mat_init_f32(&R, (uint16_t)m, (uint16_t)n, ref_f32);
+        arm_mat_init_q31(&Cq, (uint16_t)m, (uint16_t)n, c_q31);
+        arm_mat_init_q31(&Rq, (uint16_t)m, (uint16_t)n, ref_q31);
+
+        for (uint32_t op = 0; op < 4U; op++) {
+            const arm_mat_op opA = (op & 1U) ? ARM_MAT_TRANS : ARM_MAT_NOTRANS;
+            const arm_mat_op opB = (op & 2U) ? ARM_MAT_TRANS : ARM_MAT_NOTRANS;
+            const arm_matrix_instance_f32 *srcA = (op & 1U) ? &At : &A, *srcB = (op & 2U) ? &Bt : &B;
+            const arm_matrix_instance_q31 *srcAq = (op & 1U) ? &Atq : &Aq, *srcBq = (op & 2U) ? &Btq : &Bq;
+            uint32_t bad_q31[4] = { 0, 0, 0, 0 };
+            double err = 0.0, err_ref;
+            int ok = 1;
+
+            // The copy the GEMM avoids: transpose the stored operands back, then multiply
+            ok &= op_f32(srcA, opA, &OA, opa_f32) == ARM_MATH_SUCCESS
+                  && op_f32(srcB, opB, &OB, opb_f32) == ARM_MATH_SUCCESS;
+            ok &= op_q31(srcAq, opA, &OAq, opa_q31) == ARM_MATH_SUCCESS
+                  && op_q31(srcBq, opB, &OBq, opb_q31) == ARM_MATH_SUCCESS;
+            ok &= arm_mat_mult_f32(&OA, &OB, &R) == ARM_MATH_SUCCESS;
+            ok &= arm_mat_mult_q31(&OAq, &OBq, &Rq) == ARM_MATH_SUCCESS;
+            err_ref = error_f32(ref_f32, m * n);
+            ok &= memcmp(ref_q31, plain_q31, m * n * sizeof(q31_t)) == 0;
+
+            for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+                arm_mat_gemm_instance_f32 G;
+                arm_mat_gemm_instance_q31 Gq;
+
+                guard(m * n);
+                arm_mat_gemm_init_f32(&G, opA, opB, threads[t]);
+                arm_mat_gemm_init_q31(&Gq, opA, opB, threads[t]);
+                ok &= arm_mat_gemm_f32(&G, srcA, srcB, &C) == ARM_MATH_SUCCESS;
+                ok &= arm_mat_gemm_q31(&Gq, srcAq, srcBq, &Cq) == ARM_MATH_SUCCESS;
+                ok &= guard_ok(m * n);
+                err = fmax(err, error_f32(c_f32, m * n));
+                if (memcmp(c_q31, ref_q31, m * n * sizeof(q31_t)) != 0) bad_q31[t]++;
+            }
+
+            const int fail = !ok || err > MAX_ERR || err_ref > MAX_ERR || bad_q31[0] || bad_q31[1] || bad_q31[2]
+                             || bad_q31[3];
+            failures += fail ? 1U : 0U;
+            printf("%4u %4u %4u  %-5s  %8.2e  %8.2e        %u/%u/%u/%u%s\n", m, k, n, ops[op], err, err_ref,
+                   bad_q31[0], bad_q31[1], bad_q31[2], bad_q31[3], fail ? "  FAIL" : "");
+        }
+    }
+
+    printf("\n%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,95 @@
+/* harness_util.h
+ *
+ * Helpers shared by the host harnesses and benchmarks: a deterministic
+ * xorshift generator, the synthetic talkers used when no recording is
+ * given, and a monotonic wall clock.
+ */
+
+#ifndef HARNESS_UTIL_H
+#define HARNESS_UTIL_H
+
+#include <math.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifndef PI
+#define PI 3.14159265358979f
+#endif
+
+// xorshift32 state; a harness may reseed it (never with 0)
+static uint32_t harness_rng __attribute__((unused)) = 0x2545F491U;
+
+static inline uint32_t harness_rand_u32(void)
+{
+    harness_rng ^= harness_rng << 13;
+    harness_rng ^= harness_rng >> 17;
+    harness_rng ^= harness_rng << 5;
+    return harness_rng;
+}
+
+// Uniform in [-1, 1)
+static inline float syn_rand(void)
+{
+    return (float)(int32_t)harness_rand_u32() / 2147483648.0f;
+}
+
+// Speech-like: white noise through a resonance at f0, in talk spurts with
+// a syllabic envelope. on/off are the spurt and pause lengths in seconds.
+static inline void syn_talker_noise(float *x, uint32_t len, uint32_t rate, float f0, float on, float off, float gain)
+{
+    float r = 0.95f, c = 2.0f * r * cosf(2.0f * (float)PI * f0 / rate);
+    float y1 = 0.0f, y2 = 0.0f;
+
+    for (uint32_t n = 0; n < len; n++) {
+        float t = (float)n / rate;
+        float y = syn_rand() + c * y1 - r * r * y2;
+        float env = fmodf(t, on + off) < on ? fabsf(sinf((float)PI * 4.0f * t)) : 0.0f;
+
+        y2 = y1;
+        y1 = y;
+        x[n] = gain * 0.1f * env * y;
+    }
+}
+
+// Speech-like: a glottal pulse train with a gliding pitch through two
+// formant resonances, in talk spurts with a syllabic envelope. on/off are
+// the spurt and pause lengths in seconds, the first spurt starts after one
+// pause.
+static inline void syn_talker_voiced(float *x, uint32_t len, uint32_t rate, float on, float off)
+{
+    static const float formant[2] = { 600.0f, 1800.0f };
+    float r = 0.97f, c[2], y1[2] = { 0.0f }, y2[2] = { 0.0f };
+    float phase = 0.0f;
+
+    for (int i = 0; i < 2; i++) {
+        c[i] = 2.0f * r * cosf(2.0f * (float)PI * formant[i] / rate);
+    }
+    for (uint32_t n = 0; n < len; n++) {
+        float t = (float)n / rate;
+        float f0 = 140.0f + 40.0f * sinf(2.0f * (float)PI * 0.7f * t);
+        float e = 0.05f * syn_rand(), v = 0.0f;
+        float env = fmodf(t, on + off) >= off ? fabsf(sinf((float)PI * 4.0f * (t - off))) : 0.0f;
+
+        phase += f0 / rate;
+        if (phase >= 1.0f) {
+            phase -= 1.0f;
+            e += 1.0f;
+        }
+        for (int i = 0; i < 2; i++) {
+            float y = e + c[i] * y1[i] - r * r * y2[i];
+            y2[i] = y1[i];
+            y1[i] = y;
+            v += y;
+        }
+        x[n] = env * v;
+    }
+}
+
+static inline uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+#endif /* HARNESS_UTIL_H */
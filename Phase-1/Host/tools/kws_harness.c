@@ -0,0 +1,910 @@
+/* kws_harness.c
+ *
+ * Detection accuracy and cost of the always-on keyword spotter (bh_kws).
+ *
+ * Runs a long recording through bh_kws_process_adc() in DMA-sized blocks,
+ * exactly as the firmware task does, and scores the detections against
+ * the keyword times: a detection from 30% into a keyword up to 1 s after
+ * its end is a hit, anything else a false alarm. Reports recall, false
+ * alarms per hour, latency, and the cycles of the front end per hop and of
+ * every inference.
+ *
+ *   kws_harness [--in STREAM.wav --labels TIMES.txt] [--model M.bhnn --input-scale S --input-zp Z]
+ *               [--channels N] [--seconds N] [--threshold P] [--smooth N] [--stride N]
+ *               [--budget CYCLES] [--sweep] [--export PREFIX] [--seed N]
+ *
+ * Without --model the classifier is trained here on synthetic speech: a
+ * formant synthesizer says the keyword ("sh-a-n-i"), other words (many of
+ * them near misses: the keyword with a sound dropped, swapped or reordered)
+ * and nothing, with random pitch, vocal tract length, speaking rate and
+ * level over background noise. The DS-CNN (49x10 MFCC, a 10x4 stride-2
+ * conv, four depthwise-separable blocks, average pooling to four time
+ * segments, a fully connected layer and softmax over silence / unknown /
+ * keyword) keeps its random int8 convolutions as features; only the fully
+ * connected layer is fitted (softmax regression on the int8 pooled features
+ * of the training clips), then quantized like a converter would. Clip
+ * accuracy is reported on held-out clips, for the float head and for the
+ * int8 model. Without --in, the stream is synthesized the same way with
+ * speakers not seen in training.
+ *
+ * --labels has one "start end" pair per keyword, in seconds. --model runs a
+ * BHNN model instead (same input shape and class order; its input
+ * quantization comes from --input-scale and --input-zp). --sweep repeats
+ * the stream at several thresholds. --export writes PREFIX.bhnn and
+ * PREFIX_model.h (the model as a C array and the front end and decision
+ * settings) for the firmware; Host/tools/nn_planner.c makes its plan.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "arm_math.h"
+#include "bh_arena.h"
+#include "bh_cycles.h"
+#include "bh_kws.h"
+#include "bh_nn_graph.h"
+#include "harness_util.h"
+#include "nn_model.h"
+#include "wav_io.h"
+
+#define RATE            16000U
+#define FFT_LEN         1024U
+#define WIN_LEN         640U            // 40 ms
+#define HOP_LEN         320U            // 20 ms
+#define NUM_MELS        40U
+#define NUM_DCT         10U
+#define NUM_ROWS        49U
+#define ADC_BITS        12U
+
+#define CLIP            RATE            // 1 s, the span of the feature matrix
+#define LEAD            (RATE / 2U)     // Noise before each clip, primes the front end
+#define MAX_WORD        (RATE * 2U)
+#define NUM_CLASSES     3U              // silence, unknown, keyword
+#define ARENA_BYTES     (512U * 1024U)
+
+enum { SILENCE = 0, UNKNOWN, KEYWORD };
+static const char *const class_names[NUM_CLASSES] = { "silence", "unknown", "keyword" };
+
+static uint8_t arena_mem[ARENA_BYTES] __attribute__((aligned(16)));
+
+/* ============================================
+   Speech Synthesizer
+   ============================================ */
+
+static float syn_uniform(float lo, float hi)
+{
+    return lo + (hi - lo) * 0.5f * (syn_rand() + 1.0f);
+}
+
+enum { VOICED = 0, FRICATIVE, STOP };
+
+typedef struct {
+    float f[3];                 // Formants, or the noise band centre in f[0]
+    float amp;
+    float ms;                   // Typical duration
+    int kind;
+} phone_t;
+
+// Adult male formant averages; the speaker scale moves them
+static const phone_t phones[] = {
+    { { 730.0f, 1090.0f, 2440.0f }, 1.00f, 170.0f, VOICED },     // a
+    { { 270.0f, 2290.0f, 3010.0f }, 0.80f, 180.0f, VOICED },     // i
+    { { 300.0f,  870.0f, 2240.0f }, 0.80f, 170.0f, VOICED },     // u
+    { { 530.0f, 1840.0f, 2480.0f }, 0.90f, 150.0f, VOICED },     // e
+    { { 570.0f,  840.0f, 2410.0f }, 0.90f, 160.0f, VOICED },     // o
+    { { 490.0f, 1350.0f, 1690.0f }, 0.90f, 160.0f, VOICED },     // er
+    { { 250.0f, 1700.0f, 2600.0f }, 0.30f,  70.0f, VOICED },     // n
+    { { 250.0f, 1100.0f, 2300.0f }, 0.30f,  70.0f, VOICED },     // m
+    { { 5500.0f,   0.0f,    0.0f }, 0.25f, 110.0f, FRICATIVE },  // s
+    { { 2800.0f,   0.0f,    0.0f }, 0.35f, 120.0f, FRICATIVE },  // sh
+    { { 4000.0f,   0.0f,    0.0f }, 0.60f,  50.0f, STOP },       // t
+    { { 1800.0f,   0.0f,    0.0f }, 0.60f,  50.0f, STOP },       // k
+};
+#define NUM_PHONES      (sizeof(phones) / sizeof(phones[0]))
+enum { PH_A = 0, PH_I, PH_U, PH_E, PH_O, PH_ER, PH_N, PH_M, PH_S, PH_SH, PH_T, PH_K };
+
+static const int keyword[] = { PH_SH, PH_A, PH_N, PH_I };
+#define KEYWORD_LEN     4
+
+typedef struct {
+    float f0;                   // Hz
+    float vtl;                  // Formant scale (shorter vocal tract: higher)
+    float rate;                 // Duration scale
+    float level;                // Peak, linear
+} speaker_t;
+
+static void syn_speaker(speaker_t *s)
+{
+    s->f0 = syn_uniform(85.0f, 250.0f);
+    s->vtl = 0.88f + 0.30f * (s->f0 - 85.0f) / 165.0f + syn_uniform(-0.04f, 0.04f);
+    s->rate = syn_uniform(0.8f, 1.25f);
+    s->level = powf(10.0f, syn_uniform(-30.0f, -8.0f) / 20.0f);
+}
+
+typedef struct {
+    float y1, y2;
+} reson_t;
+
+// Two-pole resonator with about unit gain at its centre
+static float reson(reson_t *r, float x, float f, float bw)
+{
+    float rad = expf(-(float)PI * bw / RATE);
+    float y = (1.0f - rad) * x + 2.0f * rad * cosf(2.0f * (float)PI * f / RATE) * r->y1 - rad * rad * r->y2;
+
+    r->y2 = r->y1;
+    r->y1 = y;
+    return y;
+}
+
+// Says a phone sequence; returns the number of samples written
+static uint32_t syn_word(const int *ph, int n, const speaker_t *spk, float *out, uint32_t cap)
+{
+    uint32_t start[8], len = 0, pos = 0;
+    reson_t vr[3] = { { 0 } }, fr = { 0 };
+    float f[3], amp_v = 0.0f, amp_f = 0.0f, phase = 0.0f, peak = 0.0f;
+
+    for (int i = 0; i < n; i++) {
+        start[i] = len;
+        len += (uint32_t)(phones[ph[i]].ms * spk->rate * syn_uniform(0.85f, 1.15f) * RATE / 1000.0f);
+    }
+    if (len > cap) len = cap;
+    for (int k = 0; k < 3; k++) f[k] = phones[PH_A].f[k] * spk->vtl;
+
+    for (uint32_t t = 0; t < len; t++) {
+        while (pos + 1 < (uint32_t)n && t >= start[pos + 1]) pos++;
+        const phone_t *p = &phones[ph[pos]];
+        uint32_t into = t - start[pos];
+        float tv = 0.0f, tf = 0.0f, v = 0.0f, x;
+
+        // Formants glide to the voiced targets over ~25 ms
+        if (p->kind == VOICED) {
+            for (int k = 0; k < 3; k++) f[k] += 0.0025f * (p->f[k] * spk->vtl - f[k]);
+            tv = p->amp;
+        } else if (p->kind == FRICATIVE || into < RATE / 60U) {
+            tf = p->amp;            // Stops: a burst, then the closure
+        }
+        amp_v += 0.004f * (tv - amp_v);
+        amp_f += 0.004f * (tf - amp_f);
+
+        // Glottal pulses with a falling pitch contour and some jitter
+        phase += spk->f0 * (1.1f - 0.2f * (float)t / (float)len) * (1.0f + 0.01f * syn_rand()) / RATE;
+        if (phase >= 1.0f) {
+            phase -= 1.0f;
+            v = 1.0f;
+        }
+        x = v;
+        for (int k = 0; k < 3; k++) x = reson(&vr[k], x, f[k], 60.0f + 30.0f * k) * 4.0f;
+        x *= amp_v;
+        x += amp_f * reson(&fr, syn_rand(), p->f[0] * (0.9f + 0.1f * spk->vtl), 1500.0f);
+
+        out[t] = x;
+        if (fabsf(x) > peak) peak = fabsf(x);
+    }
+    for (uint32_t t = 0; t < len; t++) out[t] *= spk->level / (peak > 0.0f ? peak : 1.0f);
+    return len;
+}
+
+// Any other word; 40% are near misses of the keyword
+static int syn_other(int *ph)
+{
+    int n;
+
+    if (syn_rand() < -0.2f) {
+        memcpy(ph, keyword, sizeof(keyword));
+        n = KEYWORD_LEN;
+        switch ((int)syn_uniform(0.0f, 3.999f)) {
+        case 0: {                                       // drop a sound
+            int j = (int)syn_uniform(0.0f, 3.999f);
+            memmove(ph + j, ph + j + 1, (size_t)(KEYWORD_LEN - 1 - j) * sizeof(int));
+            n--;
+            break;
+        }
+        case 1:                                         // another first consonant
+            ph[0] = (syn_rand() < 0.0f) ? PH_S : PH_K;
+            break;
+        case 2:                                         // other vowels
+            ph[1] = PH_O + (syn_rand() < 0.0f);
+            ph[3] = PH_U;
+            break;
+        default:                                        // vowels swapped
+            ph[1] = PH_I;
+            ph[3] = PH_A;
+            break;
+        }
+    } else {
+        n = 2 + (int)syn_uniform(0.0f, 3.999f);
+        for (int i = 0; i < n; i++) ph[i] = (int)syn_uniform(0.0f, NUM_PHONES - 0.001f);
+    }
+    if (n == KEYWORD_LEN && memcmp(ph, keyword, sizeof(keyword)) == 0) ph[2] = PH_M;
+    return n;
+}
+
+// Low-passed white noise at a random level, added to x
+static void syn_noise(float *x, uint32_t len, float db_lo, float db_hi)
+{
+    float g = powf(10.0f, syn_uniform(db_lo, db_hi) / 20.0f) * 2.5f, y = 0.0f;
+
+    for (uint32_t n = 0; n < len; n++) {
+        y = 0.8f * y + 0.2f * syn_rand();
+        x[n] += g * y;
+    }
+}
+
+// One training clip: LEAD + CLIP samples, the word ends inside the clip
+static void syn_clip(int cls, float *x)
+{
+    static float word[MAX_WORD];
+    speaker_t spk;
+    int ph[8], n;
+    uint32_t len, end;
+
+    memset(x, 0, (LEAD + CLIP) * sizeof(float));
+    syn_noise(x, LEAD + CLIP, -70.0f, -45.0f);
+    if (cls == SILENCE) return;
+
+    syn_speaker(&spk);
+    if (cls == KEYWORD) {
+        memcpy(ph, keyword, sizeof(keyword));
+        n = KEYWORD_LEN;
+    } else {
+        n = syn_other(ph);
+    }
+    len = syn_word(ph, n, &spk, word, MAX_WORD);
+
+    // Keywords end in the last half of the window, as the stream inferences
+    // will see them; other words anywhere
+    end = LEAD + CLIP - (uint32_t)(syn_uniform(0.02f, (cls == KEYWORD) ? 0.45f : 0.9f) * RATE);
+    if (end < len) end = len;
+    for (uint32_t t = 0; t < len; t++) x[end - len + t] += word[t];
+}
+
+/* ============================================
+   Stream
+   ============================================ */
+
+typedef struct {
+    float start, end;           // Seconds
+    int hit;
+} keyword_t;
+
+// Words every 0.8-2.5 s, 30% of them the keyword
+static float *syn_stream(uint32_t seconds, uint32_t *len, keyword_t *kw, uint32_t *num_kw, uint32_t max_kw)
+{
+    static float word[MAX_WORD];
+    float *x = (float *)calloc((size_t)seconds * RATE, sizeof(float));
+    uint32_t t = RATE;
+
+    *len = seconds * RATE;
+    *num_kw = 0;
+    if (x == NULL) return NULL;
+    for (uint32_t s = 0; s < seconds; s += 10U) {
+        syn_noise(x + s * RATE, ((seconds - s < 10U) ? seconds - s : 10U) * RATE, -65.0f, -50.0f);
+    }
+
+    while (t + MAX_WORD < *len) {
+        speaker_t spk;
+        int ph[8], n;
+        float r = syn_rand();
+
+        syn_speaker(&spk);
+        if (r < -0.4f && *num_kw < max_kw) {
+            memcpy(ph, keyword, sizeof(keyword));
+            n = KEYWORD_LEN;
+        } else if (r < 0.8f) {
+            n = syn_other(ph);
+        } else {
+            t += RATE;
+            continue;
+        }
+        uint32_t wlen = syn_word(ph, n, &spk, word, MAX_WORD);
+        for (uint32_t i = 0; i < wlen; i++) x[t + i] += word[i];
+        if (n == KEYWORD_LEN && memcmp(ph, keyword, sizeof(keyword)) == 0) {
+            kw[*num_kw].start = (float)t / RATE;
+            kw[*num_kw].end = (float)(t + wlen) / RATE;
+            (*num_kw)++;
+        }
+        t += wlen + (uint32_t)(syn_uniform(0.8f, 2.5f) * RATE);
+    }
+    return x;
+}
+
+static keyword_t *read_labels(const char *path, uint32_t *num)
+{
+    FILE *f = fopen(path, "r");
+    keyword_t *kw = NULL;
+    float a, b;
+    uint32_t cap = 0;
+
+    *num = 0;
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+    while (fscanf(f, "%f %f", &a, &b) == 2) {
+        if (*num == cap) {
+            cap = cap ? 2U * cap : 64U;
+            kw = (keyword_t *)realloc(kw, cap * sizeof(keyword_t));
+        }
+        kw[*num].start = a;
+        kw[*num].end = b;
+        (*num)++;
+    }
+    fclose(f);
+    return kw;
+}
+
+// Samples as the ADC delivers them: 12-bit right-aligned, off mid-scale
+static void to_adc(const float *x, uint16_t *codes, uint32_t len)
+{
+    for (uint32_t n = 0; n < len; n++) {
+        float v = x[n] * 32768.0f;
+        int32_t q = (int32_t)lrintf(v < -32768.0f ? -32768.0f : v > 32767.0f ? 32767.0f : v);
+        int32_t c = (q >> (16 - ADC_BITS)) + (1 << (ADC_BITS - 1)) + 37;
+        codes[n] = (uint16_t)(c < 0 ? 0 : c > (1 << ADC_BITS) - 1 ? (1 << ADC_BITS) - 1 : c);
+    }
+}
+
+/* ============================================
+   Training
+   ============================================ */
+
+typedef struct {
+    uint32_t count;
+    int *label;
+    q15_t *features;            // count x NUM_ROWS x NUM_DCT
+} clips_t;
+
+static void make_clips(clips_t *c, uint32_t per_class, bh_kws_t *fe)
+{
+    static float x[LEAD + CLIP];
+    static q15_t pcm[LEAD + CLIP];
+    uint32_t row = NUM_ROWS * NUM_DCT;
+
+    c->count = per_class * NUM_CLASSES;
+    c->label = (int *)malloc(c->count * sizeof(int));
+    c->features = (q15_t *)malloc((size_t)c->count * row * sizeof(q15_t));
+    for (uint32_t i = 0; i < c->count; i++) {
+        c->label[i] = (int)(i % NUM_CLASSES);
+        syn_clip(c->label[i], x);
+        arm_float_to_q15(x, pcm, LEAD + CLIP);
+        bh_kws_reset(fe);
+        bh_kws_process_q15(fe, pcm, LEAD + CLIP);
+        memcpy(c->features + (size_t)i * row, bh_kws_features(fe), row * sizeof(q15_t));
+    }
+}
+
+static int cmp_q15(const void *a, const void *b)
+{
+    return *(const q15_t *)a - *(const q15_t *)b;
+}
+
+// Input scale and zero point covering the 0.1% to 99.9% range of the features
+static void input_range(const clips_t *c, float *scale, int32_t *zp)
+{
+    size_t n = (size_t)c->count * NUM_ROWS * NUM_DCT;
+    q15_t *sorted = (q15_t *)malloc(n * sizeof(q15_t));
+    float lo, hi;
+
+    memcpy(sorted, c->features, n * sizeof(q15_t));
+    qsort(sorted, n, sizeof(q15_t), cmp_q15);
+    lo = sorted[n / 1000U] / 128.0f;
+    hi = sorted[n - 1U - n / 1000U] / 128.0f;
+    free(sorted);
+
+    *scale = (hi - lo) / 255.0f;
+    *zp = -128 - (int32_t)lrintf(lo / *scale);
+}
+
+// Pooled trunk outputs of every clip, dequantized
+static float *trunk_features(const clips_t *c, bh_kws_t *q, const uint8_t *trunk, uint32_t trunk_size,
+                             double scale, int32_t zp, uint32_t *dim)
+{
+    bh_arena_t arena;
+    bh_nn_graph_t g;
+    float *f;
+
+    bh_arena_init(&arena, arena_mem, ARENA_BYTES);
+    if (bh_nn_graph_init(&g, &arena, trunk, trunk_size) != ARM_MATH_SUCCESS) return NULL;
+    *dim = bh_nn_graph_output_bytes(&g);
+    f = (float *)malloc((size_t)c->count * *dim * sizeof(float));
+    for (uint32_t i = 0; i < c->count; i++) {
+        bh_kws_quantize(q, c->features + (size_t)i * NUM_ROWS * NUM_DCT, bh_nn_graph_input(&g));
+        bh_nn_graph_invoke(&g);
+        for (uint32_t k = 0; k < *dim; k++) {
+            f[(size_t)i * *dim + k] = (float)((bh_nn_graph_output(&g)[k] - zp) * scale);
+        }
+    }
+    return f;
+}
+
+// Raw-feature weights from standardized ones, optionally rounded to the
+// per-tensor int8 grid
+static void head_round(const float *w, const float *inv, uint32_t dim, int quantize, float *wq)
+{
+    float wmax = 0.0f, step;
+
+    for (uint32_t j = 0; j < NUM_CLASSES * dim; j++) {
+        wq[j] = w[j] * inv[j % dim];
+        wmax = fmaxf(wmax, fabsf(wq[j]));
+    }
+    step = wmax / 127.0f;
+    if (quantize && step > 0.0f) {
+        for (uint32_t j = 0; j < NUM_CLASSES * dim; j++) wq[j] = roundf(wq[j] / step) * step;
+    }
+}
+
+// Softmax regression with L2, full-batch Adam, on standardized features. w
+// is NUM_CLASSES x dim and comes back folded onto the raw features. The
+// last third of the iterations run the forward pass with the weights
+// rounded to the per-tensor int8 grid nn_model_fc_float() will use (the
+// gradient passes straight through): pooled ReLU features sit far from
+// zero, so the logits are small differences of large sums, and plain
+// post-training rounding costs several points of accuracy.
+static void train_head(const float *x, const int *label, uint32_t count, uint32_t dim, float *w, float *b)
+{
+    float *mean = (float *)calloc(dim, sizeof(float)), *inv = (float *)calloc(dim, sizeof(float));
+    float *wq = (float *)malloc(NUM_CLASSES * dim * sizeof(float));
+    float *gw = (float *)malloc(NUM_CLASSES * dim * sizeof(float));
+    float *m1 = (float *)calloc(NUM_CLASSES * (dim + 1U), sizeof(float));
+    float *m2 = (float *)calloc(NUM_CLASSES * (dim + 1U), sizeof(float));
+    float gb[NUM_CLASSES];
+    const float lr = 0.02f, l2 = 1e-3f, b1 = 0.9f, b2 = 0.999f;
+    const uint32_t iters = 900U;
+
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t k = 0; k < dim; k++) mean[k] += x[(size_t)i * dim + k] / (float)count;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t k = 0; k < dim; k++) {
+            float d = x[(size_t)i * dim + k] - mean[k];
+            inv[k] += d * d / (float)count;
+        }
+    }
+    for (uint32_t k = 0; k < dim; k++) inv[k] = 1.0f / sqrtf(inv[k] + 1e-8f);
+
+    memset(w, 0, NUM_CLASSES * dim * sizeof(float));
+    memset(b, 0, NUM_CLASSES * sizeof(float));
+    for (uint32_t it = 1; it <= iters; it++) {
+        head_round(w, inv, dim, 3U * it > 2U * iters, wq);
+        memset(gw, 0, NUM_CLASSES * dim * sizeof(float));
+        memset(gb, 0, sizeof(gb));
+        for (uint32_t i = 0; i < count; i++) {
+            const float *xi = x + (size_t)i * dim;
+            float z[NUM_CLASSES], zmax = -1e30f, sum = 0.0f;
+
+            for (uint32_t c = 0; c < NUM_CLASSES; c++) {
+                z[c] = b[c];
+                for (uint32_t k = 0; k < dim; k++) z[c] += wq[c * dim + k] * (xi[k] - mean[k]);
+                if (z[c] > zmax) zmax = z[c];
+            }
+            for (uint32_t c = 0; c < NUM_CLASSES; c++) sum += (z[c] = expf(z[c] - zmax));
+            for (uint32_t c = 0; c < NUM_CLASSES; c++) {
+                float err = (z[c] / sum - (label[i] == (int)c)) / (float)count;
+                gb[c] += err;
+                for (uint32_t k = 0; k < dim; k++) gw[c * dim + k] += err * (xi[k] - mean[k]) * inv[k];
+            }
+        }
+        for (uint32_t c = 0; c < NUM_CLASSES; c++) {
+            for (uint32_t k = 0; k <= dim; k++) {
+                float *p = (k < dim) ? &w[c * dim + k] : &b[c];
+                float g = (k < dim) ? gw[c * dim + k] + l2 * *p : gb[c];
+                uint32_t j = c * (dim + 1U) + k;
+
+                m1[j] = b1 * m1[j] + (1.0f - b1) * g;
+                m2[j] = b2 * m2[j] + (1.0f - b2) * g * g;
+                *p -= lr * (m1[j] / (1.0f - powf(b1, (float)it))) /
+                      (sqrtf(m2[j] / (1.0f - powf(b2, (float)it))) + 1e-8f);
+            }
+        }
+    }
+
+    // Fold the standardization into the rounded weights and the bias
+    head_round(w, inv, dim, 1, wq);
+    for (uint32_t c = 0; c < NUM_CLASSES; c++) {
+        for (uint32_t k = 0; k < dim; k++) {
+            w[c * dim + k] = wq[c * dim + k];
+            b[c] -= wq[c * dim + k] * mean[k];
+        }
+    }
+    free(mean);
+    free(inv);
+    free(wq);
+    free(gw);
+    free(m1);
+    free(m2);
+}
+
+static int head_predict(const float *x, uint32_t dim, const float *w, const float *b, float *logit)
+{
+    int best = 0;
+
+    for (uint32_t c = 0; c < NUM_CLASSES; c++) {
+        logit[c] = b[c];
+        for (uint32_t k = 0; k < dim; k++) logit[c] += w[c * dim + k] * x[k];
+        if (logit[c] > logit[best]) best = (int)c;
+    }
+    return best;
+}
+
+/* ============================================
+   Model Export
+   ============================================ */
+
+static int write_model_header(const char *path, const uint8_t *blob, uint32_t size, float input_scale,
+                              int32_t input_zp, const bh_kws_config_t *cfg)
+{
+    FILE *f = fopen(path, "w");
+
+    if (f == NULL) {
+        perror(path);
+        return 0;
+    }
+    fprintf(f, "/* kws_model.h - written by Host/tools/kws_harness.c, do not edit */\n\n");
+    fprintf(f, "#ifndef KWS_MODEL_H\n#define KWS_MODEL_H\n\n#include <stdint.h>\n\n");
+    fprintf(f, "// Front end\n");
+    fprintf(f, "#define KWS_SAMPLE_RATE     %uU\n#define KWS_FFT_LEN         %uU\n", RATE, FFT_LEN);
+    fprintf(f, "#define KWS_WIN_LEN         %uU\n#define KWS_HOP_LEN         %uU\n", WIN_LEN, HOP_LEN);
+    fprintf(f, "#define KWS_NUM_MELS        %uU\n#define KWS_NUM_DCT         %uU\n", NUM_MELS, NUM_DCT);
+    fprintf(f, "#define KWS_NUM_ROWS        %uU\n\n", NUM_ROWS);
+    fprintf(f, "// Model input quantization and classes (silence, unknown, keyword)\n");
+    fprintf(f, "#define KWS_INPUT_SCALE     %.9gf\n#define KWS_INPUT_ZP        (%d)\n", (double)input_scale,
+            (int)input_zp);
+    fprintf(f, "#define KWS_NUM_CLASSES     %uU\n#define KWS_FIRST_KEYWORD   %uU\n\n", NUM_CLASSES, KEYWORD);
+    fprintf(f, "// Decision settings the accuracy was measured with\n");
+    fprintf(f, "#define KWS_STRIDE          %uU\n#define KWS_SMOOTH          %uU\n", cfg->stride, cfg->smooth);
+    fprintf(f, "#define KWS_THRESHOLD       %uU\n#define KWS_REFRACTORY      %uU\n\n", cfg->threshold,
+            cfg->refractory);
+    fprintf(f, "#define KWS_MODEL_BYTES     %uU\n\n", size);
+    fprintf(f, "// BHNN model; words keep it 4-byte aligned\nstatic const uint32_t kws_model[%u] = {", size / 4U);
+    for (uint32_t i = 0; i < size / 4U; i++) {
+        uint32_t v;
+        memcpy(&v, blob + 4U * i, 4U);
+        fprintf(f, "%s0x%08X,", (i % 8U) ? " " : "\n    ", v);
+    }
+    fprintf(f, "\n};\n\n#endif /* KWS_MODEL_H */\n");
+    if (fclose(f) != 0) {
+        perror(path);
+        return 0;
+    }
+    return 1;
+}
+
+/* ============================================
+   Streaming Evaluation
+   ============================================ */
+
+typedef struct {
+    const bh_kws_t *kws;
+    float *time;                // Seconds, per detection
+    uint32_t count, cap;
+} detections_t;
+
+static void on_detect(void *ctx, uint32_t label, uint8_t score)
+{
+    detections_t *d = (detections_t *)ctx;
+
+    (void)label;
+    (void)score;
+    if (d->count == d->cap) {
+        d->cap = d->cap ? 2U * d->cap : 64U;
+        d->time = (float *)realloc(d->time, d->cap * sizeof(float));
+    }
+    d->time[d->count++] = (float)d->kws->hops * HOP_LEN / RATE;
+}
+
+typedef struct {
+    uint32_t hits, false_alarms;
+    double latency;             // Seconds after the keyword end, summed over hits
+    double ns;                  // Wall time of the whole stream
+} score_t;
+
+static arm_status run_stream(bh_kws_t *k, const uint16_t *codes, uint32_t len, keyword_t *kw, uint32_t num_kw,
+                             score_t *s)
+{
+    detections_t d = { k, NULL, 0, 0 };
+    arm_status st = ARM_MATH_SUCCESS;
+    uint64_t t0;
+
+    k->cfg.notify = on_detect;
+    k->cfg.ctx = &d;
+    bh_kws_reset(k);
+    bh_kws_reset_stats(k);
+
+    t0 = now_ns();
+    // One DMA half-buffer per stride, as in the firmware
+    uint32_t block = k->cfg.stride * HOP_LEN;
+    for (uint32_t pos = 0; pos + block <= len && st == ARM_MATH_SUCCESS; pos += block) {
+        st = bh_kws_process_adc(k, codes + pos, block);
+    }
+    memset(s, 0, sizeof(*s));
+    s->ns = (double)(now_ns() - t0);
+
+    for (uint32_t i = 0; i < num_kw; i++) kw[i].hit = 0;
+    for (uint32_t i = 0; i < d.count; i++) {
+        int matched = 0;
+        for (uint32_t j = 0; j < num_kw && !matched; j++) {
+            float from = kw[j].start + 0.3f * (kw[j].end - kw[j].start);
+            if (!kw[j].hit && d.time[i] >= from && d.time[i] <= kw[j].end + 1.0f) {
+                kw[j].hit = 1;
+                s->hits++;
+                s->latency += d.time[i] - kw[j].end;
+                matched = 1;
+            }
+        }
+        if (!matched) s->false_alarms++;
+    }
+    free(d.time);
+    return st;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [--in STREAM.wav --labels TIMES.txt] [--model M.bhnn --input-scale S --input-zp Z]\n"
+                    "          [--channels N] [--seconds N] [--threshold P] [--smooth N] [--stride N]\n"
+                    "          [--budget CYCLES] [--sweep] [--export PREFIX] [--seed N]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    const char *in_path = NULL, *labels_path = NULL, *model_path = NULL, *export_prefix = NULL;
+    uint32_t channels = 64U, seconds = 600U, seed = 1U, budget = 0U, smooth = 3U, stride = 5U;
+    float threshold = 0.8f, input_scale = 0.0f;
+    int32_t input_zp = 0;
+    int sweep = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--in") == 0 && i + 1 < argc) {
+            in_path = argv[++i];
+        } else if (strcmp(argv[i], "--labels") == 0 && i + 1 < argc) {
+            labels_path = argv[++i];
+        } else if (strcmp(argv[i], "--model") == 0 && i + 1 < argc) {
+            model_path = argv[++i];
+        } else if (strcmp(argv[i], "--input-scale") == 0 && i + 1 < argc) {
+            input_scale = (float)atof(argv[++i]);
+        } else if (strcmp(argv[i], "--input-zp") == 0 && i + 1 < argc) {
+            input_zp = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--channels") == 0 && i + 1 < argc) {
+            channels = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            seconds = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            threshold = (float)atof(argv[++i]);
+        } else if (strcmp(argv[i], "--smooth") == 0 && i + 1 < argc) {
+            smooth = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--stride") == 0 && i + 1 < argc) {
+            stride = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+            budget = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--export") == 0 && i + 1 < argc) {
+            export_prefix = argv[++i];
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--sweep") == 0) {
+            sweep = 1;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if ((in_path == NULL) != (labels_path == NULL) || (model_path != NULL && input_scale <= 0.0f)
+        || channels == 0U || seconds < 10U || threshold <= 0.0f || threshold > 1.0f
+        || smooth == 0U || smooth > BH_KWS_MAX_SMOOTH || stride == 0U) {
+        usage(argv[0]);
+        return 2;
+    }
+    harness_rng ^= seed * 0x9E3779B9U;
+
+    bh_kws_config_t cfg = {
+        .sample_rate = RATE, .fft_len = FFT_LEN, .win_len = WIN_LEN, .hop_len = HOP_LEN,
+        .num_mels = NUM_MELS, .num_dct = NUM_DCT, .num_rows = NUM_ROWS,
+        .stride = stride, .smooth = smooth, .first_keyword = KEYWORD,
+        .threshold = (uint8_t)lrintf(threshold * 255.0f), .refractory = 1000U / (stride * 20U) + 1U,
+        .budget_cycles = budget,
+    };
+    bh_arena_t arena;
+    bh_kws_t fe;
+    uint8_t *blob = NULL;
+    uint32_t size = 0;
+
+    bh_cycles_init();
+
+    /* ---------- Model: load, or train the head on synthetic clips ---------- */
+    if (model_path != NULL) {
+        blob = nn_model_read(model_path, &size);
+        if (blob == NULL) return 1;
+        printf("# model %s, input scale %.4f zero point %d\n", model_path, (double)input_scale, (int)input_zp);
+    } else {
+        clips_t train, test;
+        uint32_t dim;
+
+        // Front end only, to collect the features of the training clips
+        bh_arena_init(&arena, arena_mem, ARENA_BYTES);
+        if (bh_kws_init(&fe, &arena, &cfg) != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "front end init failed\n");
+            return 1;
+        }
+        make_clips(&train, 1000U, &fe);
+        make_clips(&test, 200U, &fe);
+        input_range(&train, &input_scale, &input_zp);
+
+        bh_kws_config_t qcfg = cfg;
+        qcfg.input_scale = input_scale;
+        qcfg.input_zp = input_zp;
+        bh_arena_init(&arena, arena_mem, ARENA_BYTES);
+        if (bh_kws_init(&fe, &arena, &qcfg) != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "input scale %g out of range\n", (double)input_scale);
+            return 1;
+        }
+
+        // Random int8 trunk: 10x4 stride-2 conv, four DS blocks, pooling to 4 time segments
+        nn_model_t *m = (nn_model_t *)malloc(sizeof(nn_model_t));
+        uint16_t in, x, pool;
+        double rms = 0.0;
+        int8_t *q = (int8_t *)malloc(NUM_ROWS * NUM_DCT);
+
+        for (uint32_t i = 0; i < train.count; i++) {
+            bh_kws_quantize(&fe, train.features + (size_t)i * NUM_ROWS * NUM_DCT, q);
+            for (uint32_t k = 0; k < NUM_ROWS * NUM_DCT; k++) rms += (double)(q[k] - input_zp) * (q[k] - input_zp);
+        }
+        free(q);
+
+        nn_model_init(m, seed);
+        in = nn_model_activation(m, 1, NUM_ROWS, NUM_DCT, 1, input_scale, input_zp);
+        m->rms[in] = sqrt(rms / ((double)train.count * NUM_ROWS * NUM_DCT));
+        x = nn_model_conv(m, in, (int32_t)channels, 10, 4, 2, 2, 1, 1);
+        for (int b = 0; b < 4; b++) {
+            x = nn_model_dw_conv(m, x, 3, 3, 1, 1, 1, 1);
+            x = nn_model_conv(m, x, (int32_t)channels, 1, 1, 1, 1, 1, 1);
+        }
+        pool = nn_model_pool(m, BH_NN_OP_AVGPOOL, x, 6, m->tensors[x].dims.w, 6, m->tensors[x].dims.w, 0);
+
+        uint32_t trunk_size;
+        uint8_t *trunk = nn_model_save(m, in, pool, &trunk_size);
+        float *ftrain = trunk_features(&train, &fe, trunk, trunk_size, m->scale[pool], m->zp[pool], &dim);
+        float *ftest = trunk_features(&test, &fe, trunk, trunk_size, m->scale[pool], m->zp[pool], &dim);
+        if (ftrain == NULL || ftest == NULL) {
+            fprintf(stderr, "trunk init failed\n");
+            return 1;
+        }
+
+        float *w = (float *)malloc(NUM_CLASSES * dim * sizeof(float)), b[NUM_CLASSES], logit[NUM_CLASSES];
+        double lmax = 0.0;
+        uint32_t float_ok = 0;
+        train_head(ftrain, train.label, train.count, dim, w, b);
+        for (uint32_t i = 0; i < train.count; i++) {
+            head_predict(ftrain + (size_t)i * dim, dim, w, b, logit);
+            for (uint32_t c = 0; c < NUM_CLASSES; c++) lmax = fmax(lmax, fabs(logit[c]));
+        }
+        for (uint32_t i = 0; i < test.count; i++) {
+            float_ok += head_predict(ftest + (size_t)i * dim, dim, w, b, logit) == test.label[i];
+        }
+
+        uint16_t out = nn_model_softmax(m, nn_model_fc_float(m, pool, NUM_CLASSES, w, b, lmax / 127.0));
+        blob = nn_model_save(m, in, out, &size);
+
+        // Held-out clips through the whole int8 model
+        uint32_t confusion[NUM_CLASSES][NUM_CLASSES] = { { 0 } }, int8_ok = 0;
+        bh_nn_graph_t g;
+        bh_arena_init(&arena, arena_mem, ARENA_BYTES);
+        if (bh_nn_graph_init(&g, &arena, blob, size) != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "model init failed\n");
+            return 1;
+        }
+        for (uint32_t i = 0; i < test.count; i++) {
+            const int8_t *p = bh_nn_graph_output(&g);
+            uint32_t best = 0;
+
+            bh_kws_quantize(&fe, test.features + (size_t)i * NUM_ROWS * NUM_DCT, bh_nn_graph_input(&g));
+            bh_nn_graph_invoke(&g);
+            for (uint32_t c = 1; c < NUM_CLASSES; c++) {
+                if (p[c] > p[best]) best = c;
+            }
+            confusion[test.label[i]][best]++;
+            int8_ok += best == (uint32_t)test.label[i];
+        }
+
+        printf("# DS-CNN %ux%u MFCC, %u channels, %u classes; trained head on %u clips, %u held out\n",
+               NUM_ROWS, NUM_DCT, channels, NUM_CLASSES, train.count, test.count);
+        printf("# input scale %.4f zero point %d; model %u bytes\n", (double)input_scale, (int)input_zp, size);
+        printf("clip accuracy: float head %.1f%%, int8 model %.1f%%\n", 100.0 * float_ok / test.count,
+               100.0 * int8_ok / test.count);
+        printf("%-10s", "true\\pred");
+        for (uint32_t c = 0; c < NUM_CLASSES; c++) printf(" %8s", class_names[c]);
+        printf("\n");
+        for (uint32_t r = 0; r < NUM_CLASSES; r++) {
+            printf("%-10s", class_names[r]);
+            for (uint32_t c = 0; c < NUM_CLASSES; c++) printf(" %8u", confusion[r][c]);
+            printf("\n");
+        }
+
+        free(trunk);
+        free(ftrain);
+        free(ftest);
+        free(w);
+        free(train.label);
+        free(train.features);
+        free(test.label);
+        free(test.features);
+        nn_model_free(m);
+        free(m);
+    }
+
+    /* ---------- Spotter on the stream ---------- */
+    bh_kws_t kws;
+    cfg.model = blob;
+    cfg.model_size = size;
+    cfg.input_scale = input_scale;
+    cfg.input_zp = input_zp;
+    bh_arena_init(&arena, arena_mem, ARENA_BYTES);
+    arm_status st = bh_kws_init(&kws, &arena, &cfg);
+    if (st != ARM_MATH_SUCCESS) {
+        fprintf(stderr, "bh_kws_init failed (%d): model does not match the front end?\n", (int)st);
+        return 1;
+    }
+
+    if (export_prefix != NULL) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s.bhnn", export_prefix);
+        if (!nn_model_write(path, blob, size)) return 1;
+        snprintf(path, sizeof(path), "%s_model.h", export_prefix);
+        if (!write_model_header(path, blob, size, input_scale, input_zp, &cfg)) return 1;
+        printf("wrote %s.bhnn and %s\n", export_prefix, path);
+    }
+
+    keyword_t *kw;
+    uint32_t len, num_kw;
+    float *x;
+    if (in_path != NULL) {
+        uint32_t rate = 0;
+        x = wav_read(in_path, &rate, &len);
+        if (x == NULL) return 1;
+        if (rate != RATE) {
+            fprintf(stderr, "%s: %u Hz, the front end runs at %u Hz\n", in_path, rate, RATE);
+            return 1;
+        }
+        kw = read_labels(labels_path, &num_kw);
+        if (kw == NULL) return 1;
+    } else {
+        kw = (keyword_t *)malloc(seconds * sizeof(keyword_t));
+        x = syn_stream(seconds, &len, kw, &num_kw, seconds);
+        if (kw == NULL || x == NULL) return 1;
+    }
+    uint16_t *codes = (uint16_t *)malloc(len * sizeof(uint16_t));
+    if (codes == NULL) return 1;
+    to_adc(x, codes, len);
+
+    double hours = (double)len / RATE / 3600.0;
+    score_t s;
+    printf("\n# %s: %.0f s, %u keywords; 12-bit ADC codes in blocks of %u; inference every %u hops (%u ms), "
+           "%u averaged\n", in_path ? in_path : "synthetic stream", (double)len / RATE, num_kw, cfg.stride * HOP_LEN,
+           cfg.stride, cfg.stride * HOP_LEN * 1000U / RATE, cfg.smooth);
+    printf("threshold  hits  misses  false alarms  recall   FA/hour  latency\n");
+    for (int t = sweep ? 0 : -1; t < (sweep ? 6 : 0); t++) {
+        kws.cfg.threshold = (t < 0) ? cfg.threshold : (uint8_t)lrintf((0.5f + 0.09f * (float)t) * 255.0f);
+        st = run_stream(&kws, codes, len, kw, num_kw, &s);
+        if (st != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "kernel error %d\n", (int)st);
+            return 1;
+        }
+        printf("%9.2f  %4u  %6u  %12u  %5.1f%%  %8.1f  %5.0f ms\n", kws.cfg.threshold / 255.0, s.hits,
+               num_kw - s.hits, s.false_alarms, num_kw ? 100.0 * s.hits / num_kw : 0.0,
+               s.false_alarms / hours, s.hits ? 1000.0 * s.latency / s.hits : 0.0);
+    }
+
+    // Cost of the last run
+    printf("\nfront end  %.0f cycles per hop (%u hops)\n", (double)kws.fe_cycles_total / kws.hops, kws.hops);
+    printf("inference  %.0f cycles mean, %u max (%u inferences, %u over budget, %u skipped)\n",
+           (double)kws.cycles_total / kws.inferences, kws.cycles_max, kws.inferences, kws.over_budget,
+           kws.skipped);
+    printf("load       %.2f%% of real time on this host; arena %u bytes\n",
+           100.0 * s.ns / 1e9 / ((double)len / RATE), (uint32_t)(ARENA_BYTES - bh_arena_remaining(&arena)));
+
+    free(codes);
+    free(x);
+    free(kw);
+    free(blob);
+    return 0;
+}
@@ -0,0 +1,392 @@
+/* logmel_harness.c
+ *
+ * Accuracy and cost of the streaming Q15 log-mel extractor
+ * (arm_logmel_stream_q15 / arm_logmel_stream_adc_q15) against the f32 path.
+ *
+ * Feeds a recording to the extractor in DMA-sized blocks, the way the
+ * capture interrupt does, and recomputes every feature row in floating
+ * point from the same samples: the Q15 window, arm_rfft_fast_f32,
+ * arm_cmplx_mag_f32, the Mel filters and ln(x + 1e-6), i.e. arm_mfcc_f32
+ * without its per-frame normalization. Reports the error per level of the
+ * input and the cycles per frame.
+ *
+ *   logmel_harness [--in SPEECH.wav] [--fft N] [--win N] [--hop N] [--mels N]
+ *                  [--dct N] [--rows N] [--block N] [--adc] [--csv PATH]
+ *
+ * The default is the DS-CNN keyword spotting front end: 16 kHz, 40 ms
+ * frames every 20 ms, 1024-point FFT, 40 Mel filters, 49 rows. Without --in,
+ * 8 s of voiced speech-like sound with a little noise is synthesized, at
+ * -6, -26, -46 and -66 dBFS peak for 2 s each, to cover the dynamic range
+ * of a microphone input.
+ *
+ * --dct N outputs N MFCCs per row instead of log-mel energies. --adc feeds
+ * the samples as 12-bit right-aligned ADC codes through
+ * arm_logmel_stream_adc_q15, and the reference applies the same DC blocker.
+ * --block sets the DMA half-buffer length (default 256, deliberately not a
+ * multiple of the hop).
+ *
+ * For comparison, arm_mfcc_q15 is checked the same way against
+ * arm_mfcc_f32 on the same frames (both normalize each frame by its peak).
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "arm_math.h"
+#include "bh_cycles.h"
+#include "harness_util.h"
+#include "wav_io.h"
+
+#define SYN_RATE        16000U
+#define SYN_SECONDS     8U
+#define MAX_FFT         4096U
+#define MAX_MELS        128U
+#define ADC_BITS        12U
+
+// Voiced speech-like sound: a pulse train with a gliding pitch through two
+// formant resonances, syllabic envelope, plus a little white noise. The
+// level drops by 20 dB every 2 s.
+static void syn_speech(float *x, uint32_t len)
+{
+    static const float formant[2] = { 700.0f, 2200.0f };
+    float r = 0.97f, c[2], y1[2] = { 0.0f }, y2[2] = { 0.0f };
+    float phase = 0.0f, peak = 0.0f;
+
+    for (int i = 0; i < 2; i++) {
+        c[i] = 2.0f * r * cosf(2.0f * (float)PI * formant[i] / SYN_RATE);
+    }
+    for (uint32_t n = 0; n < len; n++) {
+        float t = (float)n / SYN_RATE;
+        float f0 = 130.0f + 50.0f * sinf(2.0f * (float)PI * 0.6f * t);
+        float e = 0.0f, v = 0.0f;
+
+        phase += f0 / SYN_RATE;
+        if (phase >= 1.0f) {
+            phase -= 1.0f;
+            e = 1.0f;
+        }
+        for (int i = 0; i < 2; i++) {
+            float y = e + c[i] * y1[i] - r * r * y2[i];
+            y2[i] = y1[i];
+            y1[i] = y;
+            v += y;
+        }
+        x[n] = v * (0.2f + fabsf(sinf((float)PI * 3.0f * t))) + 0.05f * syn_rand();
+        if (fabsf(x[n]) > peak) peak = fabsf(x[n]);
+    }
+    for (uint32_t n = 0; n < len; n++) {
+        x[n] *= 0.5f / peak * powf(10.0f, -(float)(n / (2U * SYN_RATE)));
+    }
+}
+
+static float32_t hz_to_mel(float32_t hz) { return 1127.0f * logf(1.0f + hz / 700.0f); }
+static float32_t mel_to_hz(float32_t m)  { return 700.0f * (expf(m / 1127.0f) - 1.0f); }
+
+static uint32_t mel_pos[MAX_MELS], mel_len[MAX_MELS];
+static float32_t mel_f32[MAX_FFT], dct_f32[MAX_MELS * MAX_MELS], win_f32[MAX_FFT], pad_f32[MAX_FFT];
+static q15_t mel_q15[MAX_FFT], dct_q15[MAX_MELS * MAX_MELS], win_q15[MAX_FFT], pad_q15[MAX_FFT];
+
+// Hann window of win_len (and zero-padded to fft_len for arm_mfcc_*),
+// triangular Mel filters from 20 Hz to Nyquist, DCT-II
+static void tables(uint32_t fft_len, uint32_t win_len, uint32_t mels, uint32_t ceps, uint32_t rate)
+{
+    uint32_t bins[MAX_MELS + 2U];
+    float32_t mel_lo = hz_to_mel(20.0f), mel_hi = hz_to_mel(rate / 2.0f);
+    uint32_t total = 0;
+
+    memset(pad_f32, 0, sizeof(pad_f32));
+    for (uint32_t i = 0; i < win_len; i++) {
+        win_f32[i] = 0.5f - 0.5f * cosf(2.0f * PI * i / win_len);
+    }
+    arm_float_to_q15(win_f32, win_q15, win_len);
+    // The reference uses the Q15 window, so only the arithmetic differs
+    arm_q15_to_float(win_q15, pad_f32, win_len);
+    memcpy(win_f32, pad_f32, win_len * sizeof(float32_t));
+    memset(pad_q15, 0, sizeof(pad_q15));
+    memcpy(pad_q15, win_q15, win_len * sizeof(q15_t));
+
+    for (uint32_t i = 0; i < mels + 2U; i++) {
+        float32_t hz = mel_to_hz(mel_lo + (mel_hi - mel_lo) * i / (mels + 1U));
+        bins[i] = (uint32_t)(hz * fft_len / rate + 0.5f);
+    }
+    for (uint32_t m = 0; m < mels; m++) {
+        uint32_t lo = bins[m], mid = bins[m + 1U], hi = bins[m + 2U];
+        if (mid <= lo) mid = lo + 1U;
+        if (hi <= mid) hi = mid + 1U;
+
+        mel_pos[m] = lo + 1U;
+        mel_len[m] = hi - lo - 1U;
+        for (uint32_t k = lo + 1U; k < hi; k++) {
+            mel_f32[total++] = (k <= mid) ? (float32_t)(k - lo) / (mid - lo)
+                                          : (float32_t)(hi - k) / (hi - mid);
+        }
+    }
+    arm_float_to_q15(mel_f32, mel_q15, total);
+    arm_q15_to_float(mel_q15, mel_f32, total);
+
+    // Identity without DCT, so arm_mfcc_* give log-mel energies
+    memset(dct_f32, 0, sizeof(dct_f32));
+    for (uint32_t k = 0; k < (ceps ? ceps : mels); k++) {
+        for (uint32_t n = 0; n < mels; n++) {
+            dct_f32[k * mels + n] = ceps ? sqrtf(2.0f / mels) * cosf(PI / mels * (n + 0.5f) * k)
+                                         : (k == n ? 0.999969f : 0.0f);
+        }
+    }
+    arm_float_to_q15(dct_f32, dct_q15, (ceps ? ceps : mels) * mels);
+    arm_q15_to_float(dct_q15, dct_f32, (ceps ? ceps : mels) * mels);
+}
+
+// f32 path on one frame: window, FFT, magnitudes, Mel filters, ln(x + 1e-6), DCT
+static void reference(const arm_rfft_fast_instance_f32 *rfft, const float *frame, uint32_t fft_len,
+                      uint32_t win_len, uint32_t mels, uint32_t ceps, float *row)
+{
+    static float32_t buf[MAX_FFT], spec[MAX_FFT + 2U], mag[MAX_FFT / 2U + 1U], logmel[MAX_MELS];
+    const float32_t *coef = mel_f32;
+
+    memset(buf, 0, fft_len * sizeof(float32_t));
+    arm_mult_f32(frame, win_f32, buf, win_len);
+    arm_rfft_fast_f32((arm_rfft_fast_instance_f32 *)rfft, buf, spec, 0);
+    spec[fft_len] = spec[1];
+    spec[fft_len + 1U] = 0.0f;
+    spec[1] = 0.0f;
+    arm_cmplx_mag_f32(spec, mag, fft_len / 2U + 1U);
+    for (uint32_t m = 0; m < mels; m++) {
+        float32_t e;
+        arm_dot_prod_f32(mag + mel_pos[m], coef, mel_len[m], &e);
+        coef += mel_len[m];
+        logmel[m] = logf(e + 1e-6f);
+    }
+    if (ceps) {
+        arm_matrix_instance_f32 dct = { (uint16_t)ceps, (uint16_t)mels, dct_f32 };
+        arm_mat_vec_mult_f32(&dct, logmel, row);
+    } else {
+        memcpy(row, logmel, mels * sizeof(float));
+    }
+}
+
+// Error statistics per level segment
+struct err_stats {
+    double sum, max;
+    uint32_t count;
+};
+
+static void err_add(struct err_stats *s, double e)
+{
+    e = fabs(e);
+    s->sum += e;
+    if (e > s->max) s->max = e;
+    s->count++;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [--in SPEECH.wav] [--fft N] [--win N] [--hop N] [--mels N]\n"
+                    "          [--dct N] [--rows N] [--block N] [--adc] [--csv PATH]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    const char *in_path = NULL, *csv_path = NULL;
+    uint32_t rate = SYN_RATE, len = 0;
+    uint32_t fft_len = 1024U, win_len = 640U, hop = 320U, mels = 40U, ceps = 0U, rows = 49U, block = 256U;
+    int adc = 0;
+    float *in;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "--in") == 0) {
+            in_path = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "--csv") == 0) {
+            csv_path = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "--fft") == 0) {
+            fft_len = (uint32_t)atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--win") == 0) {
+            win_len = (uint32_t)atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--hop") == 0) {
+            hop = (uint32_t)atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--mels") == 0) {
+            mels = (uint32_t)atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--dct") == 0) {
+            ceps = (uint32_t)atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--rows") == 0) {
+            rows = (uint32_t)atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--block") == 0) {
+            block = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--adc") == 0) {
+            adc = 1;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (fft_len > MAX_FFT || win_len > fft_len || hop == 0U || hop > win_len || mels == 0U
+        || mels > MAX_MELS || ceps > mels || rows == 0U || block == 0U) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (in_path != NULL) {
+        in = wav_read(in_path, &rate, &len);
+        if (in == NULL) return 1;
+    } else {
+        len = SYN_RATE * SYN_SECONDS;
+        in = malloc(len * sizeof(float));
+        if (in == NULL) return 1;
+        syn_speech(in, len);
+    }
+
+    uint32_t row_len = ceps ? ceps : mels;
+    tables(fft_len, win_len, mels, ceps, rate);
+
+    // Samples as the extractor sees them: Q15, or ADC codes and the DC-blocked Q15
+    q15_t *pcm = malloc(len * sizeof(q15_t));
+    uint16_t *codes = malloc(len * sizeof(uint16_t));
+    float *seen = malloc(len * sizeof(float));
+    if (pcm == NULL || codes == NULL || seen == NULL) return 1;
+    arm_float_to_q15(in, pcm, len);
+    if (adc) {
+        double x1 = 0.0, y1 = 0.0;
+        for (uint32_t n = 0; n < len; n++) {
+            int32_t c = ((int32_t)pcm[n] >> (16 - ADC_BITS)) + (1 << (ADC_BITS - 1)) + 37;  // bias off mid-scale
+            double x;
+            codes[n] = (uint16_t)(c < 0 ? 0 : c > (1 << ADC_BITS) - 1 ? (1 << ADC_BITS) - 1 : c);
+            x = (double)(((int32_t)codes[n] - (1 << (ADC_BITS - 1))) << (16 - ADC_BITS)) / 32768.0;
+            y1 = x - x1 + 0.995 * y1;
+            x1 = x;
+            seen[n] = (float)y1;
+        }
+    } else {
+        arm_q15_to_float(pcm, seen, len);
+    }
+
+    arm_logmel_stream_instance_q15 lm;
+    q31_t *state = malloc(ARM_LOGMEL_STREAM_STATE_SIZE_Q15(fft_len, win_len, mels) * sizeof(q31_t));
+    q15_t *features = malloc(rows * row_len * sizeof(q15_t));
+    if (state == NULL || features == NULL
+        || arm_logmel_stream_init_q15(&lm, fft_len, win_len, hop, mels, ceps,
+                                      ceps ? dct_q15 : NULL, mel_pos, mel_len, mel_q15, win_q15,
+                                      features, rows, state) != ARM_MATH_SUCCESS) {
+        fprintf(stderr, "log-mel init failed\n");
+        return 1;
+    }
+    lm.adcBits = ADC_BITS;
+
+    // Existing per-frame Q15 path, for comparison
+    arm_mfcc_instance_f32 mf;
+    arm_mfcc_instance_q15 mq;
+    arm_rfft_fast_instance_f32 rfft;
+    static float32_t mf_in[MAX_FFT], mf_tmp[2U * MAX_FFT + 2U], mf_out[MAX_MELS];
+    static q15_t mq_in[MAX_FFT], mq_out[MAX_MELS];
+    static q31_t mq_tmp[2U * MAX_FFT];
+    if (arm_rfft_fast_init_f32(&rfft, (uint16_t)fft_len) != ARM_MATH_SUCCESS
+        || arm_mfcc_init_f32(&mf, fft_len, mels, row_len, dct_f32, mel_pos, mel_len, mel_f32, pad_f32) != ARM_MATH_SUCCESS
+        || arm_mfcc_init_q15(&mq, fft_len, mels, row_len, dct_q15, mel_pos, mel_len, mel_q15, pad_q15) != ARM_MATH_SUCCESS) {
+        fprintf(stderr, "FFT length %u not supported\n", fft_len);
+        return 1;
+    }
+
+    FILE *csv = NULL;
+    if (csv_path != NULL) {
+        csv = fopen(csv_path, "w");
+        if (csv == NULL) { perror(csv_path); return 1; }
+        fprintf(csv, "row,time_s,max_err,mean_err\n");
+    }
+
+    bh_cycles_init();
+
+    printf("# %s, %u Hz, %s input in blocks of %u, FFT %u, window %u, hop %u, %u Mel filters, %s\n",
+           in_path ? in_path : "synthetic", rate, adc ? "12-bit ADC" : "Q15", block,
+           fft_len, win_len, hop, mels, ceps ? "DCT" : "log-mel");
+
+    enum { NUM_SEGS = 4 };
+    struct err_stats seg[NUM_SEGS] = { { 0 } }, mseg[NUM_SEGS] = { { 0 } };
+    float ref[MAX_MELS];
+    uint64_t cyc_frames = 0, cyc_max = 0, cyc_buffer = 0, ns_frames = 0;
+    uint32_t total_rows = 0, buffer_calls = 0;
+    uint32_t seg_len = in_path ? (len + NUM_SEGS - 1U) / NUM_SEGS : 2U * SYN_RATE;
+
+    for (uint32_t pos = 0; pos + block <= len; pos += block) {
+        uint32_t c0 = bh_cycles_now();
+        uint64_t t0 = now_ns();
+        uint32_t got = adc ? arm_logmel_stream_adc_q15(&lm, codes + pos, block)
+                           : arm_logmel_stream_q15(&lm, pcm + pos, block);
+        uint64_t t1 = now_ns();
+        uint32_t cyc = bh_cycles_now() - c0;
+
+        if (got == 0U) {
+            cyc_buffer += cyc;
+            buffer_calls++;
+            continue;
+        }
+        // Blocks shorter than the hop give at most one row
+        cyc_frames += cyc;
+        ns_frames += t1 - t0;
+        if (got == 1U && cyc > cyc_max) cyc_max = cyc;
+
+        // Rows just added are the last 'got' rows. The buffer holds winLen - hop
+        // samples after a frame, so the last frame ended 'fill - (winLen - hop)'
+        // samples before the end of the block
+        for (uint32_t r = 0; r < got; r++) {
+            const q15_t *row = features + (rows - got + r) * row_len;
+            uint32_t end = (pos + block) - (lm.fill - (win_len - hop)) - hop * (got - 1U - r);
+            uint32_t start = end - win_len;
+            uint32_t s = (end - 1U) / seg_len;
+            double emax = 0.0, esum = 0.0;
+
+            // The frame buffer starts with zeros: skip rows that include them
+            if (end < win_len) continue;
+            if (s >= NUM_SEGS) s = NUM_SEGS - 1U;
+
+            reference(&rfft, seen + start, fft_len, win_len, mels, ceps, ref);
+            for (uint32_t k = 0; k < row_len; k++) {
+                double e = row[k] / 128.0 - ref[k];
+                err_add(&seg[s], e);
+                esum += fabs(e);
+                if (fabs(e) > emax) emax = fabs(e);
+            }
+            if (csv) {
+                fprintf(csv, "%u,%.3f,%.4f,%.4f\n", total_rows + r, (double)end / rate, emax, esum / row_len);
+            }
+
+            // arm_mfcc_q15 against arm_mfcc_f32, same frame, both normalized
+            memset(mf_in, 0, fft_len * sizeof(float32_t));
+            memcpy(mf_in, seen + start, win_len * sizeof(float32_t));
+            arm_float_to_q15(mf_in, mq_in, fft_len);
+            arm_q15_to_float(mq_in, mf_in, fft_len);
+            arm_mfcc_f32(&mf, mf_in, mf_out, mf_tmp);
+            arm_mfcc_q15(&mq, mq_in, mq_out, mq_tmp);
+            for (uint32_t k = 0; k < row_len; k++) {
+                err_add(&mseg[s], mq_out[k] / 128.0 - mf_out[k]);
+            }
+        }
+        total_rows += got;
+    }
+
+    printf("%-24s %22s %22s\n", "", "arm_logmel_stream_q15", "arm_mfcc_q15");
+    printf("%-24s %10s %11s %10s %11s\n", "segment", "mean_err", "max_err", "mean_err", "max_err");
+    for (uint32_t s = 0; s < NUM_SEGS; s++) {
+        char name[32];
+        if (seg[s].count == 0U) continue;
+        if (in_path) snprintf(name, sizeof(name), "quarter %u", s + 1U);
+        else snprintf(name, sizeof(name), "%u-%u s, %d dBFS", 2U * s, 2U * s + 2U, -6 - 20 * (int)s);
+        printf("%-24s %10.4f %11.4f %10.4f %11.4f\n", name,
+               seg[s].sum / seg[s].count, seg[s].max, mseg[s].sum / mseg[s].count, mseg[s].max);
+    }
+    printf("# errors in natural log units of magnitude (1.0 = 8.7 dB); Q8.7 step is %.4f\n", 1.0 / 128.0);
+    if (total_rows != 0U) {
+        printf("# %u rows: %.0f cycles per frame (max %.0f), %.1f us; buffering %.0f cycles per block of %u\n",
+               total_rows, (double)cyc_frames / total_rows, (double)cyc_max, ns_frames / 1e3 / total_rows,
+               buffer_calls ? (double)cyc_buffer / buffer_calls : 0.0, block);
+    }
+
+    if (csv) fclose(csv);
+    free(state);
+    free(features);
+    free(pcm);
+    free(codes);
+    free(seen);
+    free(in);
+    return 0;
+}
@@ -0,0 +1,389 @@
+/* nn_fuse_harness.c
+ *
+ * Conv + activation + 2x2 pooling fused into one kernel
+ * (arm_convolve_max_pool_2x2_s8, arm_convolve_avg_pool_2x2_s8) against the
+ * same block as separate CMSIS-NN layers: conv, optionally arm_relu6_s8,
+ * then arm_max_pool_s8 / arm_avgpool_s8.
+ *
+ *   check   random shapes (padding, stride, dilation, odd sizes, batches,
+ *           activation ranges, offsets), fused output bit for bit against
+ *           the chain;
+ *   blocks  typical CNN blocks, cycles of both (interleaved runs), the
+ *           intermediate conv tensor the chain writes and reads back, and
+ *           the peak activation RAM of each: the chain holds input + conv
+ *           output, then conv output + pooled output; the fused kernel
+ *           input + pooled output and a 4 x C_OUT window;
+ *   graph   nn_model_cnn with and without CONV_POOL through bh_nn_graph:
+ *           planned activation bytes, arena and cycles per invoke, outputs
+ *           compared bit for bit.
+ *
+ *   nn_fuse_harness [--runs N] [--checks N] [--seed N]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+#include "bh_arena.h"
+#include "bh_cycles.h"
+#include "bh_nn_graph.h"
+#include "nn_model.h"
+
+#define ARENA_BYTES     (256U * 1024U)
+
+static uint8_t arena_a[ARENA_BYTES] __attribute__((aligned(16)));
+static uint8_t arena_b[ARENA_BYTES] __attribute__((aligned(16)));
+
+/* ============================================
+   One block
+   ============================================ */
+
+typedef struct {
+    const char *name;
+    cmsis_nn_dims input, filter;
+    cmsis_nn_conv_params conv;
+    int average;                // 2x2 average pooling, max otherwise
+    int relu6;                  // arm_relu6_s8 between conv and pooling
+} block_t;
+
+typedef struct {
+    const block_t *b;
+    cmsis_nn_dims conv_out, pool_out, bias_dims;
+    cmsis_nn_conv_params fused_conv;
+    int8_t *input, *filter, *conv, *chain, *fused;
+    int32_t *bias, *mult, *shift;
+    cmsis_nn_context conv_ctx, pool_ctx, fused_ctx;
+} run_t;
+
+static int32_t conv_dim(int32_t in, int32_t k, int32_t stride, int32_t pad, int32_t dilation)
+{
+    return (in + 2 * pad - dilation * (k - 1) - 1) / stride + 1;
+}
+
+static void run_init(run_t *r, const block_t *b)
+{
+    const cmsis_nn_dims *in = &b->input, *f = &b->filter;
+    uint32_t in_bytes = (uint32_t)(in->n * in->h * in->w * in->c);
+    uint32_t f_bytes = (uint32_t)(f->n * f->h * f->w * f->c);
+
+    memset(r, 0, sizeof(*r));
+    r->b = b;
+    r->conv_out.n = in->n;
+    r->conv_out.h = conv_dim(in->h, f->h, b->conv.stride.h, b->conv.padding.h, b->conv.dilation.h);
+    r->conv_out.w = conv_dim(in->w, f->w, b->conv.stride.w, b->conv.padding.w, b->conv.dilation.w);
+    r->conv_out.c = f->n;
+    r->pool_out = r->conv_out;
+    r->pool_out.h /= 2;
+    r->pool_out.w /= 2;
+    r->bias_dims.n = 1;
+    r->bias_dims.h = 1;
+    r->bias_dims.w = 1;
+    r->bias_dims.c = f->n;
+
+    // arm_relu6_s8 after the conv clamp is one clamp to the intersection
+    r->fused_conv = b->conv;
+    if (b->relu6) {
+        r->fused_conv.activation.min = MAX(b->conv.activation.min, 0);
+        r->fused_conv.activation.max = MIN(b->conv.activation.max, 6);
+    }
+
+    r->input = (int8_t *)malloc(in_bytes);
+    r->filter = (int8_t *)malloc(f_bytes);
+    r->bias = (int32_t *)malloc((size_t)f->n * sizeof(int32_t));
+    r->mult = (int32_t *)malloc((size_t)f->n * sizeof(int32_t));
+    r->shift = (int32_t *)malloc((size_t)f->n * sizeof(int32_t));
+    r->conv = (int8_t *)malloc((size_t)(r->conv_out.n * r->conv_out.h * r->conv_out.w * r->conv_out.c));
+    r->chain = (int8_t *)malloc((size_t)(r->pool_out.n * r->pool_out.h * r->pool_out.w * r->pool_out.c) + 1U);
+    r->fused = (int8_t *)malloc((size_t)(r->pool_out.n * r->pool_out.h * r->pool_out.w * r->pool_out.c) + 1U);
+
+    for (uint32_t i = 0; i < in_bytes; i++) r->input[i] = nn_rand_s8();
+    for (uint32_t i = 0; i < f_bytes; i++) r->filter[i] = nn_rand_s8();
+    // Output scale about 1 / (8 * sqrt(depth)) of the accumulator: outputs of tens of LSB
+    for (int32_t c = 0; c < f->n; c++) {
+        double real = 1.0 / (8.0 * 64.0 * sqrt((double)(f->h * f->w * f->c)));
+        r->bias[c] = nn_rand_range(-4000, 4000);
+        nn_quantize_multiplier(real * (0.75 + 0.5 * (double)(harness_rand_u32() >> 8) / 16777216.0), &r->mult[c],
+                               &r->shift[c]);
+    }
+
+    r->conv_ctx.size = arm_convolve_wrapper_s8_get_buffer_size(&r->b->conv, in, f, &r->conv_out);
+    r->conv_ctx.buf = malloc((size_t)r->conv_ctx.size + 1U);
+    r->pool_ctx.size = b->average ? arm_avgpool_s8_get_buffer_size(r->pool_out.w, r->pool_out.c) : 0;
+    r->pool_ctx.buf = malloc((size_t)r->pool_ctx.size + 1U);
+    r->fused_ctx.size = arm_convolve_pool_2x2_s8_get_buffer_size(in, f, &r->pool_out);
+    r->fused_ctx.buf = malloc((size_t)r->fused_ctx.size);
+}
+
+static void run_free(run_t *r)
+{
+    free(r->input);
+    free(r->filter);
+    free(r->bias);
+    free(r->mult);
+    free(r->shift);
+    free(r->conv);
+    free(r->chain);
+    free(r->fused);
+    free(r->conv_ctx.buf);
+    free(r->pool_ctx.buf);
+    free(r->fused_ctx.buf);
+}
+
+// Conv, relu6, pooling as separate layers
+static arm_status run_chain(run_t *r)
+{
+    const block_t *b = r->b;
+    cmsis_nn_per_channel_quant_params qp = { r->mult, r->shift };
+    cmsis_nn_pool_params pp = { { 2, 2 }, { 0, 0 }, { -128, 127 } };
+    cmsis_nn_dims pool_filter = { 1, 2, 2, 1 };
+    arm_status st;
+
+    st = arm_convolve_wrapper_s8(&r->conv_ctx, &b->conv, &qp, &b->input, r->input, &b->filter, r->filter,
+                                 &r->bias_dims, r->bias, &r->conv_out, r->conv);
+    if (st != ARM_MATH_SUCCESS) return st;
+    if (b->relu6) {
+        uint32_t n = (uint32_t)(r->conv_out.n * r->conv_out.h * r->conv_out.w * r->conv_out.c);
+        for (uint32_t i = 0; i < n; i += 0xFFFFU) arm_relu6_s8(r->conv + i, (uint16_t)MIN(n - i, 0xFFFFU));
+    }
+
+    // The pooling kernels take one batch
+    for (int32_t n = 0; n < r->conv_out.n; n++) {
+        const int8_t *src = r->conv + n * r->conv_out.h * r->conv_out.w * r->conv_out.c;
+        int8_t *dst = r->chain + n * r->pool_out.h * r->pool_out.w * r->pool_out.c;
+
+        st = b->average ? arm_avgpool_s8(&r->pool_ctx, &pp, &r->conv_out, src, &pool_filter, &r->pool_out, dst)
+                        : arm_max_pool_s8(&r->pool_ctx, &pp, &r->conv_out, src, &pool_filter, &r->pool_out, dst);
+        if (st != ARM_MATH_SUCCESS) return st;
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_fused(run_t *r)
+{
+    const block_t *b = r->b;
+    cmsis_nn_per_channel_quant_params qp = { r->mult, r->shift };
+
+    return (b->average ? arm_convolve_avg_pool_2x2_s8 : arm_convolve_max_pool_2x2_s8)(
+        &r->fused_ctx, &r->fused_conv, &qp, &b->input, r->input, &b->filter, r->filter, &r->bias_dims, r->bias,
+        &r->pool_out, r->fused);
+}
+
+static int run_compare(run_t *r)
+{
+    size_t n = (size_t)(r->pool_out.n * r->pool_out.h * r->pool_out.w * r->pool_out.c);
+
+    if (run_chain(r) != ARM_MATH_SUCCESS || run_fused(r) != ARM_MATH_SUCCESS) return 0;
+    return memcmp(r->chain, r->fused, n) == 0;
+}
+
+/* ============================================
+   Random shapes
+   ============================================ */
+
+static uint32_t check_random(uint32_t checks)
+{
+    uint32_t bad = 0;
+
+    for (uint32_t k = 0; k < checks; k++) {
+        block_t b;
+        run_t r;
+        int32_t lo, hi;
+
+        memset(&b, 0, sizeof(b));
+        b.name = "random";
+        b.input.n = nn_rand_range(1, 2);
+        b.input.h = nn_rand_range(3, 13);
+        b.input.w = nn_rand_range(3, 13);
+        b.input.c = nn_rand_range(1, 9);
+        b.filter.n = nn_rand_range(1, 12);
+        b.filter.h = nn_rand_range(1, 3);
+        b.filter.w = nn_rand_range(1, 3);
+        b.filter.c = b.input.c;
+        b.conv.stride.h = nn_rand_range(1, 2);
+        b.conv.stride.w = nn_rand_range(1, 2);
+        b.conv.dilation.h = nn_rand_range(1, 2);
+        b.conv.dilation.w = nn_rand_range(1, 2);
+        b.conv.padding.h = nn_rand_range(0, b.filter.h / 2 * b.conv.dilation.h);
+        b.conv.padding.w = nn_rand_range(0, b.filter.w / 2 * b.conv.dilation.w);
+        b.conv.input_offset = nn_rand_range(-127, 128);
+        b.conv.output_offset = nn_rand_range(-128, 127);
+        lo = nn_rand_range(-128, 20);
+        hi = nn_rand_range(lo, 127);
+        b.conv.activation.min = lo;
+        b.conv.activation.max = hi;
+        b.average = (int)(harness_rand_u32() & 1U);
+        b.relu6 = (harness_rand_u32() & 3U) == 0U;
+        if (b.relu6 && (lo > 6 || hi < 0)) b.relu6 = 0;
+
+        // Needs at least one pooling window
+        if (conv_dim(b.input.h, b.filter.h, b.conv.stride.h, b.conv.padding.h, b.conv.dilation.h) < 2 ||
+            conv_dim(b.input.w, b.filter.w, b.conv.stride.w, b.conv.padding.w, b.conv.dilation.w) < 2) {
+            k--;
+            continue;
+        }
+
+        run_init(&r, &b);
+        if (!run_compare(&r)) {
+            if (bad++ < 5) {
+                fprintf(stderr, "mismatch: in %dx%dx%dx%d, filter %dx%dx%d, stride %d/%d, pad %d/%d, dil %d/%d, %s%s\n",
+                        (int)b.input.n, (int)b.input.h, (int)b.input.w, (int)b.input.c, (int)b.filter.n,
+                        (int)b.filter.h, (int)b.filter.w, (int)b.conv.stride.h, (int)b.conv.stride.w,
+                        (int)b.conv.padding.h, (int)b.conv.padding.w, (int)b.conv.dilation.h,
+                        (int)b.conv.dilation.w, b.average ? "avg" : "max", b.relu6 ? " relu6" : "");
+            }
+        }
+        run_free(&r);
+    }
+    return bad;
+}
+
+/* ============================================
+   Typical blocks
+   ============================================ */
+
+#define BLOCK(name, h, w, cin, cout, k, pad, lo, avg, relu6)                                         \
+    { name, { 1, h, w, cin }, { cout, k, k, cin },                                                  \
+      { 0, -128, { 1, 1 }, { pad, pad }, { 1, 1 }, { lo, 127 } }, avg, relu6 }
+
+static const block_t blocks[] = {
+    BLOCK("stem 32x32x3 -> 16, max", 32, 32, 3, 16, 3, 1, -128, 0, 0),
+    BLOCK("32x32x16 -> 32, relu6, max", 32, 32, 16, 32, 3, 1, -128, 0, 1),
+    BLOCK("16x16x32 -> 64, max", 16, 16, 32, 64, 3, 1, -128, 0, 0),
+    BLOCK("8x8x64 -> 64, avg", 8, 8, 64, 64, 3, 1, -128, 1, 0),
+    BLOCK("spectrogram 49x10x1 -> 32, max", 49, 10, 1, 32, 3, 1, -128, 0, 0),
+};
+
+static int bench_blocks(uint32_t runs)
+{
+    int bad = 0;
+
+    printf("block                               conv out     pooled    intermediate B  traffic B  peak RAM B"
+           "          cycles chain -> fused   change\n");
+    for (size_t k = 0; k < sizeof(blocks) / sizeof(blocks[0]); k++) {
+        const block_t *b = &blocks[k];
+        run_t r;
+        uint64_t chain = 0, fused = 0;
+        char conv_shape[24], pool_shape[24];
+
+        run_init(&r, b);
+        if (!run_compare(&r)) bad++;
+        for (uint32_t i = 0; i < runs; i++) {
+            uint32_t t0 = bh_cycles_now();
+            run_chain(&r);
+            uint32_t t1 = bh_cycles_now();
+            run_fused(&r);
+            uint32_t t2 = bh_cycles_now();
+            chain += (uint32_t)(t1 - t0);
+            fused += (uint32_t)(t2 - t1);
+        }
+
+        uint32_t in_bytes = (uint32_t)(b->input.h * b->input.w * b->input.c);
+        uint32_t conv_bytes = (uint32_t)(r.conv_out.h * r.conv_out.w * r.conv_out.c);
+        uint32_t pool_bytes = (uint32_t)(r.pool_out.h * r.pool_out.w * r.pool_out.c);
+        // Written by the conv and read by the pooling, relu6 reads and writes it once more
+        uint32_t traffic = (b->relu6 ? 4U : 2U) * conv_bytes;
+        uint32_t peak_chain = MAX(in_bytes + conv_bytes + (uint32_t)r.conv_ctx.size,
+                                  conv_bytes + pool_bytes + (uint32_t)r.pool_ctx.size);
+        uint32_t peak_fused = in_bytes + pool_bytes + (uint32_t)r.fused_ctx.size;
+
+        snprintf(conv_shape, sizeof(conv_shape), "%dx%dx%d", (int)r.conv_out.h, (int)r.conv_out.w,
+                 (int)r.conv_out.c);
+        snprintf(pool_shape, sizeof(pool_shape), "%dx%dx%d", (int)r.pool_out.h, (int)r.pool_out.w,
+                 (int)r.pool_out.c);
+        printf("%-34s  %-10s  %-9s  %14u  %9u  %5u -> %-5u  %10llu -> %-10llu  %+6.1f%%%s\n", b->name, conv_shape,
+               pool_shape, conv_bytes, traffic, peak_chain, peak_fused, (unsigned long long)(chain / runs),
+               (unsigned long long)(fused / runs), 100.0 * ((double)fused - (double)chain) / (double)chain,
+               run_compare(&r) ? "" : "  MISMATCH");
+        run_free(&r);
+    }
+    return bad;
+}
+
+/* ============================================
+   Graph
+   ============================================ */
+
+static int bench_graph(uint32_t runs, uint32_t seed)
+{
+    uint32_t size_a = 0, size_b = 0, in_bytes, out_bytes, bad = 0;
+    uint8_t *blob_a = nn_model_cnn(seed, 0, &size_a);
+    uint8_t *blob_b = nn_model_cnn(seed, 1, &size_b);
+    uint64_t cycles_a = 0, cycles_b = 0;
+    bh_arena_t arena_ra, arena_rb;
+    bh_nn_graph_t a, b;
+
+    bh_arena_init(&arena_ra, arena_a, ARENA_BYTES);
+    bh_arena_init(&arena_rb, arena_b, ARENA_BYTES);
+    if (bh_nn_graph_init(&a, &arena_ra, blob_a, size_a) != ARM_MATH_SUCCESS ||
+        bh_nn_graph_init(&b, &arena_rb, blob_b, size_b) != ARM_MATH_SUCCESS) {
+        fprintf(stderr, "cnn: bh_nn_graph_init failed\n");
+        return 1;
+    }
+
+    in_bytes = bh_nn_graph_input_bytes(&a);
+    out_bytes = bh_nn_graph_output_bytes(&a);
+    for (uint32_t r = 0; r < runs; r++) {
+        int8_t *x = bh_nn_graph_input(&a);
+        for (uint32_t i = 0; i < in_bytes; i++) x[i] = nn_rand_s8();
+        memcpy(bh_nn_graph_input(&b), x, in_bytes);
+
+        uint32_t t0 = bh_cycles_now();
+        arm_status sa = bh_nn_graph_invoke(&a);
+        uint32_t t1 = bh_cycles_now();
+        arm_status sb = bh_nn_graph_invoke(&b);
+        uint32_t t2 = bh_cycles_now();
+        if (sa != ARM_MATH_SUCCESS || sb != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "invoke failed\n");
+            return 1;
+        }
+        cycles_a += (uint32_t)(t1 - t0);
+        cycles_b += (uint32_t)(t2 - t1);
+        if (memcmp(bh_nn_graph_output(&a), bh_nn_graph_output(&b), out_bytes) != 0) bad++;
+    }
+
+    printf("\nmodel cnn (3 conv / ReLU / 2x2 pooling blocks, 32x32x3 input), %u runs\n", runs);
+    printf("                   layers  activations B  scratch B  arena B    cycles/invoke\n");
+    printf("separate layers    %6u  %13u  %9d  %7u  %15llu\n", a.header->num_layers, a.activation_bytes,
+           (int)a.scratch.size, (unsigned)arena_ra.used, (unsigned long long)(cycles_a / runs));
+    printf("fused (conv_pool)  %6u  %13u  %9d  %7u  %15llu\n", b.header->num_layers, b.activation_bytes,
+           (int)b.scratch.size, (unsigned)arena_rb.used, (unsigned long long)(cycles_b / runs));
+    printf("outputs bit-exact: %s\n", bad ? "MISMATCH" : "OK");
+
+    free(blob_a);
+    free(blob_b);
+    return bad ? 1 : 0;
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    uint32_t runs = 200, checks = 500, seed = 1, bad;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+            runs = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--checks") == 0 && i + 1 < argc) {
+            checks = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+            harness_rng = seed ? seed : 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--runs N] [--checks N] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (runs == 0U) runs = 1U;
+    bh_cycles_init();
+
+    bad = check_random(checks);
+    printf("random shapes: %u of %u bit-exact with conv -> [relu6 ->] pooling\n\n", checks - bad, checks);
+    bad += (uint32_t)bench_blocks(runs);
+    bad += (uint32_t)bench_graph(runs, seed);
+    return bad ? 1 : 0;
+}
@@ -0,0 +1,362 @@
+/* nn_graph_harness.c
+ *
+ * Correctness, memory and per-layer cost of the CMSIS-NN graph runtime
+ * (bh_nn_graph).
+ *
+ * Loads a BHNN model into a static arena and runs it on random inputs.
+ * Every output is checked bit for bit against a reference that calls the
+ * same CMSIS-NN kernels on the model tables with one private malloc'ed
+ * buffer per tensor and per layer scratch, so any aliasing mistake in the
+ * activation plan or a scratch buffer sized too small shows up as a
+ * mismatch. Reports the planned arena against the sum of all activation
+ * tensors and the cycles of every layer.
+ *
+ *   nn_graph_harness [--net dscnn|mixed|cnn|cnn_unfused] [--model PATH] [--write PATH]
+ *                    [--runs N] [--seed N]
+ *
+ * --net picks one of the reference models of nn_model.h (random weights):
+ * dscnn (default), the DS-CNN-S keyword spotter, mixed, which exercises
+ * the other ops, or cnn, conv / pooling blocks with the pooling fused into
+ * the conv (cnn_unfused: the same as separate layers). --model runs a BHNN
+ * file instead, --write saves the built one.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+#include "bh_arena.h"
+#include "bh_cycles.h"
+#include "bh_nn_graph.h"
+#include "nn_model.h"
+
+#define ARENA_BYTES     (256U * 1024U)
+
+static uint8_t arena_mem[ARENA_BYTES] __attribute__((aligned(16)));
+
+/* ============================================
+   Reference: one buffer per tensor
+   ============================================ */
+
+typedef struct {
+    const bh_nn_header_t *h;
+    const bh_nn_tensor_t *t;
+    const bh_nn_layer_t *l;
+    void **data;
+} ref_t;
+
+static void ref_init(ref_t *r, const uint8_t *model)
+{
+    r->h = (const bh_nn_header_t *)model;
+    r->t = (const bh_nn_tensor_t *)(model + sizeof(bh_nn_header_t));
+    r->l = (const bh_nn_layer_t *)(r->t + r->h->num_tensors);
+    r->data = (void **)calloc(r->h->num_tensors, sizeof(void *));
+
+    for (uint32_t i = 0; i < r->h->num_tensors; i++) {
+        if (r->t[i].kind == BH_NN_CONST) {
+            r->data[i] = (void *)(model + r->t[i].offset);
+        } else {
+            r->data[i] = calloc(1, bh_nn_tensor_bytes(&r->t[i]));
+        }
+    }
+}
+
+static void ref_free(ref_t *r)
+{
+    for (uint32_t i = 0; i < r->h->num_tensors; i++) {
+        if (r->t[i].kind != BH_NN_CONST) free(r->data[i]);
+    }
+    free(r->data);
+}
+
+static int ref_layer(ref_t *r, const bh_nn_layer_t *l)
+{
+    const cmsis_nn_dims *in = &r->t[l->inputs[0]].dims;
+    const cmsis_nn_dims *out = &r->t[l->output].dims;
+    const int8_t *src = (const int8_t *)r->data[l->inputs[0]];
+    int8_t *dst = (int8_t *)r->data[l->output];
+    const int32_t *p = l->params;
+    const uint16_t *o = l->inputs;
+    cmsis_nn_context ctx = { NULL, 0 };
+    arm_status st = ARM_MATH_SUCCESS;
+
+    switch (l->op) {
+    case BH_NN_OP_CONV: {
+        cmsis_nn_conv_params cp = { p[0], p[1], { p[2], p[3] }, { p[4], p[5] }, { p[6], p[7] }, { p[8], p[9] } };
+        cmsis_nn_per_channel_quant_params qp = { (int32_t *)r->data[o[3]], (int32_t *)r->data[o[4]] };
+        ctx.size = arm_convolve_wrapper_s8_get_buffer_size(&cp, in, &r->t[o[1]].dims, out);
+        ctx.buf = malloc((size_t)ctx.size + 1U);
+        st = arm_convolve_wrapper_s8(&ctx, &cp, &qp, in, src, &r->t[o[1]].dims, (const q7_t *)r->data[o[1]],
+                                     &r->t[o[2]].dims, (const int32_t *)r->data[o[2]], out, dst);
+        break;
+    }
+    case BH_NN_OP_DW_CONV: {
+        cmsis_nn_dw_conv_params dp = { p[0], p[1], p[10], { p[2], p[3] }, { p[4], p[5] }, { p[6], p[7] },
+                                       { p[8], p[9] } };
+        cmsis_nn_per_channel_quant_params qp = { (int32_t *)r->data[o[3]], (int32_t *)r->data[o[4]] };
+        ctx.size = arm_depthwise_conv_wrapper_s8_get_buffer_size(&dp, in, &r->t[o[1]].dims, out);
+        ctx.buf = malloc((size_t)ctx.size + 1U);
+        st = arm_depthwise_conv_wrapper_s8(&ctx, &dp, &qp, in, src, &r->t[o[1]].dims,
+                                           (const q7_t *)r->data[o[1]], &r->t[o[2]].dims,
+                                           (const int32_t *)r->data[o[2]], out, dst);
+        break;
+    }
+    case BH_NN_OP_FC: {
+        cmsis_nn_fc_params fp = { p[0], p[1], p[2], { p[3], p[4] } };
+        cmsis_nn_per_tensor_quant_params qp = { p[5], p[6] };
+        st = arm_fully_connected_s8(&ctx, &fp, &qp, in, src, &r->t[o[1]].dims, (const q7_t *)r->data[o[1]],
+                                    &r->t[o[2]].dims, (const int32_t *)r->data[o[2]], out, dst);
+        break;
+    }
+    case BH_NN_OP_CONV_PACKED: {
+        cmsis_nn_conv_params cp = { p[0], p[1], { p[2], p[3] }, { p[4], p[5] }, { p[6], p[7] }, { p[8], p[9] } };
+        cmsis_nn_per_channel_quant_params qp = { (int32_t *)r->data[o[3]], (int32_t *)r->data[o[4]] };
+        cmsis_nn_dims filter = { out->c, p[10], p[11], in->c };
+        ctx.size = arm_convolve_packed_s8_get_buffer_size(in, &filter);
+        ctx.buf = malloc((size_t)ctx.size + 1U);
+        st = arm_convolve_packed_s8(&ctx, &cp, &qp, in, src, &filter, (const q7_t *)r->data[o[1]],
+                                    (const int32_t *)r->data[o[2]], out, dst);
+        break;
+    }
+    case BH_NN_OP_FC_PACKED: {
+        cmsis_nn_fc_params fp = { p[0], p[1], p[2], { p[3], p[4] } };
+        cmsis_nn_per_tensor_quant_params qp = { p[5], p[6] };
+        cmsis_nn_dims filter = { in->h * in->w * in->c, 1, 1, out->c };
+        ctx.size = arm_fully_connected_packed_s8_get_buffer_size(&filter);
+        ctx.buf = malloc((size_t)ctx.size + 1U);
+        st = arm_fully_connected_packed_s8(&ctx, &fp, &qp, in, src, &filter, (const q7_t *)r->data[o[1]],
+                                           (const int32_t *)r->data[o[2]], out, dst);
+        break;
+    }
+    case BH_NN_OP_CONV_POOL: {
+        cmsis_nn_conv_params cp = { p[0], p[1], { p[2], p[3] }, { p[4], p[5] }, { p[6], p[7] }, { p[8], p[9] } };
+        cmsis_nn_per_channel_quant_params qp = { (int32_t *)r->data[o[3]], (int32_t *)r->data[o[4]] };
+        ctx.size = arm_convolve_pool_2x2_s8_get_buffer_size(in, &r->t[o[1]].dims, out);
+        ctx.buf = malloc((size_t)ctx.size + 1U);
+        st = (p[10] == BH_NN_OP_AVGPOOL ? arm_convolve_avg_pool_2x2_s8 : arm_convolve_max_pool_2x2_s8)(
+            &ctx, &cp, &qp, in, src, &r->t[o[1]].dims, (const q7_t *)r->data[o[1]], &r->t[o[2]].dims,
+            (const int32_t *)r->data[o[2]], out, dst);
+        break;
+    }
+    case BH_NN_OP_AVGPOOL:
+    case BH_NN_OP_MAXPOOL: {
+        cmsis_nn_pool_params pp = { { p[0], p[1] }, { p[2], p[3] }, { p[4], p[5] } };
+        cmsis_nn_dims filter = { 1, p[7], p[6], 1 };
+        ctx.size = arm_avgpool_s8_get_buffer_size(out->w, in->c);
+        ctx.buf = malloc((size_t)ctx.size + 1U);
+        st = (l->op == BH_NN_OP_AVGPOOL) ? arm_avgpool_s8(&ctx, &pp, in, src, &filter, out, dst)
+                                         : arm_max_pool_s8(&ctx, &pp, in, src, &filter, out, dst);
+        break;
+    }
+    case BH_NN_OP_SOFTMAX:
+        arm_softmax_s8(src, in->n * in->h * in->w, in->c, p[0], p[1], p[2], dst);
+        break;
+    case BH_NN_OP_ADD:
+        st = arm_elementwise_add_s8(src, (const int8_t *)r->data[o[1]], p[0], p[1], p[2], p[3], p[4], p[5], p[6],
+                                    dst, p[7], p[8], p[9], p[10], p[11], out->n * out->h * out->w * out->c);
+        break;
+    case BH_NN_OP_RELU6: {
+        int32_t n = out->n * out->h * out->w * out->c;
+        memcpy(dst, src, (size_t)n);
+        arm_relu6_s8(dst, (uint16_t)n);
+        break;
+    }
+    case BH_NN_OP_RESHAPE:
+        memcpy(dst, src, bh_nn_tensor_bytes(&r->t[l->output]));
+        break;
+    case BH_NN_OP_SVDF: {
+        cmsis_nn_svdf_params sp = { p[0], p[1], p[2], { p[3], p[4] }, { p[5], p[6] } };
+        cmsis_nn_per_tensor_quant_params iq = { p[7], p[8] }, oq = { p[9], p[10] };
+        int32_t features = r->t[o[2]].dims.n;
+        cmsis_nn_context a, b;
+        a.size = (int32_t)sizeof(q31_t) * in->n * features;
+        b.size = (int32_t)sizeof(q31_t) * in->n * (features / p[0]);
+        a.buf = malloc((size_t)a.size);
+        b.buf = malloc((size_t)b.size);
+        st = arm_svdf_s8(&a, &b, &sp, &iq, &oq, in, src, &r->t[o[1]].dims, (q7_t *)r->data[o[1]],
+                         &r->t[o[2]].dims, (const q7_t *)r->data[o[2]], &r->t[o[3]].dims,
+                         (const q7_t *)r->data[o[3]], &r->t[o[4]].dims, (const q31_t *)r->data[o[4]], out, dst);
+        free(a.buf);
+        free(b.buf);
+        break;
+    }
+    default:
+        return 0;
+    }
+    free(ctx.buf);
+    return st == ARM_MATH_SUCCESS;
+}
+
+/* ============================================
+   Report helpers
+   ============================================ */
+
+static uint64_t layer_macs(const bh_nn_tensor_t *t, const bh_nn_layer_t *l)
+{
+    const cmsis_nn_dims *out = &t[l->output].dims;
+    uint64_t outputs = (uint64_t)out->n * out->h * out->w * out->c;
+    const cmsis_nn_dims *f = &t[l->inputs[1]].dims;
+
+    switch (l->op) {
+    case BH_NN_OP_CONV:
+        return outputs * (uint64_t)(f->h * f->w * f->c);
+    case BH_NN_OP_CONV_POOL:
+        return 4U * outputs * (uint64_t)(f->h * f->w * f->c);
+    case BH_NN_OP_DW_CONV:
+        return outputs * (uint64_t)(f->h * f->w);
+    case BH_NN_OP_FC:
+        return outputs * (uint64_t)f->n;
+    case BH_NN_OP_CONV_PACKED:
+        return outputs * (uint64_t)(l->params[10] * l->params[11] * t[l->inputs[0]].dims.c);
+    case BH_NN_OP_FC_PACKED: {
+        const cmsis_nn_dims *in = &t[l->inputs[0]].dims;
+        return outputs * (uint64_t)(in->h * in->w * in->c);
+    }
+    case BH_NN_OP_SVDF: {
+        // Feature stage over the input, time stage over the memory
+        const cmsis_nn_dims *in = &t[l->inputs[0]].dims;
+        const cmsis_nn_dims *wt = &t[l->inputs[3]].dims;
+        return (uint64_t)in->n * (uint64_t)wt->n * (uint64_t)(in->h + wt->h);
+    }
+    default:
+        return 0;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *net = "dscnn", *model_path = NULL, *write_path = NULL;
+    uint32_t runs = 200, seed = 1, size = 0;
+    uint8_t *blob;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--net") == 0 && i + 1 < argc) {
+            net = argv[++i];
+        } else if (strcmp(argv[i], "--model") == 0 && i + 1 < argc) {
+            model_path = argv[++i];
+        } else if (strcmp(argv[i], "--write") == 0 && i + 1 < argc) {
+            write_path = argv[++i];
+        } else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+            runs = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else {
+            fprintf(stderr, "usage: %s [--net dscnn|mixed|cnn|cnn_unfused] [--model PATH] [--write PATH]\n"
+                            "       [--runs N] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (model_path != NULL) {
+        uint8_t *file = nn_model_read(model_path, &size);
+        if (file == NULL) return 1;
+        blob = file;
+        net = model_path;
+    } else if ((blob = nn_model_build(net, seed, &size)) == NULL) {
+        fprintf(stderr, "unknown net %s\n", net);
+        return 2;
+    }
+    if (write_path != NULL && !nn_model_write(write_path, blob, size)) return 1;
+
+    // Malformed models and a short arena must be refused
+    {
+        bh_arena_t small;
+        bh_nn_graph_t g;
+        uint32_t magic = ((uint32_t *)blob)[0];
+
+        bh_arena_init(&small, arena_mem, 256);
+        if (bh_nn_graph_init(&g, &small, blob, size) != ARM_MATH_LENGTH_ERROR) {
+            printf("FAIL: 256-byte arena accepted\n");
+            return 1;
+        }
+        ((uint32_t *)blob)[0] = magic ^ 1U;
+        bh_arena_init(&small, arena_mem, ARENA_BYTES);
+        if (bh_nn_graph_init(&g, &small, blob, size) != ARM_MATH_ARGUMENT_ERROR) {
+            printf("FAIL: bad magic accepted\n");
+            return 1;
+        }
+        ((uint32_t *)blob)[0] = magic;
+        if (bh_nn_graph_init(&g, &small, blob, size - 4U) != ARM_MATH_ARGUMENT_ERROR) {
+            printf("FAIL: truncated model accepted\n");
+            return 1;
+        }
+    }
+
+    bh_arena_t arena;
+    bh_nn_graph_t g;
+    arm_status st;
+
+    bh_arena_init(&arena, arena_mem, ARENA_BYTES);
+    st = bh_nn_graph_init(&g, &arena, blob, size);
+    if (st != ARM_MATH_SUCCESS) {
+        fprintf(stderr, "%s: bh_nn_graph_init failed (%d)\n", net, (int)st);
+        return 1;
+    }
+
+    const bh_nn_header_t *h = g.header;
+    uint32_t naive = 0, weights = 0;
+    for (uint32_t t = 0; t < h->num_tensors; t++) {
+        uint32_t bytes = bh_nn_tensor_bytes(&g.tensors[t]);
+        if (g.tensors[t].kind == BH_NN_ACTIVATION) naive += bytes;
+        if (g.tensors[t].kind == BH_NN_CONST) weights += bytes;
+    }
+
+    printf("model %s: %u bytes, %u tensors, %u layers, %u bytes of constants\n", net, size, h->num_tensors,
+           h->num_layers, weights);
+    printf("activations %u bytes planned (%u if every tensor had its own buffer, %.1fx)\n", g.activation_bytes,
+           naive, (double)naive / (double)g.activation_bytes);
+    printf("scratch     %d bytes, state %u bytes, arena used %u of %u bytes\n", (int)g.scratch.size, g.state_bytes,
+           (uint32_t)(ARENA_BYTES - bh_arena_remaining(&arena)), ARENA_BYTES);
+
+    // Bit-exact check against the unshared reference, state carried across runs
+    ref_t ref;
+    uint32_t in_bytes = bh_nn_graph_input_bytes(&g), out_bytes = bh_nn_graph_output_bytes(&g);
+    uint32_t mismatches = 0;
+
+    ref_init(&ref, blob);
+    for (uint32_t r = 0; r < runs; r++) {
+        int8_t *x = bh_nn_graph_input(&g);
+        for (uint32_t i = 0; i < in_bytes; i++) x[i] = nn_rand_s8();
+        memcpy(ref.data[h->input], x, in_bytes);
+
+        st = bh_nn_graph_invoke(&g);
+        for (uint32_t l = 0; l < h->num_layers; l++) {
+            if (!ref_layer(&ref, &ref.l[l])) {
+                fprintf(stderr, "reference layer %u failed\n", l);
+                return 1;
+            }
+        }
+        if (st != ARM_MATH_SUCCESS || memcmp(bh_nn_graph_output(&g), ref.data[h->output], out_bytes) != 0) {
+            mismatches++;
+        }
+    }
+    ref_free(&ref);
+    printf("bit-exact vs reference: %u of %u runs %s\n\n", runs - mismatches, runs,
+           mismatches ? "MISMATCH" : "OK");
+
+    // Per-layer cost: mean over the timed runs after a clean stats reset
+    uint64_t total = 0, total_macs = 0;
+    bh_nn_graph_reset_stats(&g);
+    for (uint32_t r = 0; r < runs; r++) bh_nn_graph_invoke(&g);
+    for (uint32_t l = 0; l < h->num_layers; l++) total += bh_nn_graph_layer_cycles(&g, l);
+
+    printf("layer  op        output           MACs      cycles  max cycles  share\n");
+    for (uint32_t l = 0; l < h->num_layers; l++) {
+        const bh_nn_layer_t *layer = &g.layers[l];
+        const cmsis_nn_dims *d = &g.tensors[layer->output].dims;
+        uint32_t cycles = bh_nn_graph_layer_cycles(&g, l);
+        uint64_t macs = layer_macs(g.tensors, layer);
+        char shape[32];
+
+        total_macs += macs;
+        snprintf(shape, sizeof(shape), "%dx%dx%dx%d", (int)d->n, (int)d->h, (int)d->w, (int)d->c);
+        printf("%5u  %-8s  %-14s %8llu  %10u  %10u  %4.1f%%\n", l, bh_nn_op_name(layer->op), shape,
+               (unsigned long long)macs, cycles, g.stats[l].cycles_max, 100.0 * (double)cycles / (double)total);
+    }
+    printf("total                           %8llu  %10llu              (%.2f MAC/cycle)\n",
+           (unsigned long long)total_macs, (unsigned long long)total, (double)total_macs / (double)total);
+
+    free(blob);
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,675 @@
+/* nn_model.h
+ *
+ * BHNN model builder for the host tools: adds tensors and layers the way
+ * a converter would, with random int8 weights and TFLite-style
+ * requantization, and serializes the result in the format bh_nn_graph.h
+ * loads. Weights are scaled by 1/sqrt(fan-in) and every output scale is
+ * picked from the estimated RMS of its input, so activations stay around
+ * 40 LSB through any depth: no layer saturates or collapses to zero, and
+ * the classifier softmax is not one-hot.
+ *
+ * Tensor indices returned by the layer helpers are activation tensors;
+ * nn_model_save() fixes the constant data offsets and returns the blob.
+ */
+
+#ifndef NN_MODEL_H
+#define NN_MODEL_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bh_nn_graph.h"
+#include "harness_util.h"
+
+#define NN_MODEL_MAX_TENSORS    256U
+#define NN_MODEL_MAX_LAYERS     96U
+#define NN_MODEL_ACT_STD        40.0        // Target activation spread, LSB
+#define NN_MODEL_GAIN           1.41421356  // Mean weight gain, He-style for ReLU
+
+typedef struct {
+    bh_nn_tensor_t tensors[NN_MODEL_MAX_TENSORS];
+    bh_nn_layer_t layers[NN_MODEL_MAX_LAYERS];
+    double scale[NN_MODEL_MAX_TENSORS];     // Activations: real value per LSB
+    int32_t zp[NN_MODEL_MAX_TENSORS];       // Activations: zero point
+    double rms[NN_MODEL_MAX_TENSORS];       // Activations: expected RMS about zp, LSB
+    uint32_t num_tensors;
+    uint32_t num_layers;
+    uint8_t *data;                          // Constant data, offsets relative to it until saved
+    uint32_t data_len;
+    uint32_t data_cap;
+    uint32_t rng;
+} nn_model_t;
+
+static inline void nn_model_init(nn_model_t *m, uint32_t seed)
+{
+    memset(m, 0, sizeof(*m));
+    m->rng = seed ? seed : 0x9E3779B9U;
+}
+
+static inline void nn_model_free(nn_model_t *m)
+{
+    free(m->data);
+    m->data = NULL;
+}
+
+static inline uint32_t nn_model_rand(nn_model_t *m)
+{
+    m->rng ^= m->rng << 13;
+    m->rng ^= m->rng >> 17;
+    m->rng ^= m->rng << 5;
+    return m->rng;
+}
+
+// Uniform in [-1, 1)
+static inline double nn_model_uniform(nn_model_t *m)
+{
+    return (double)(int32_t)nn_model_rand(m) / 2147483648.0;
+}
+
+// Test data for the tools, from the shared harness generator (not the model's own)
+static inline int8_t nn_rand_s8(void)
+{
+    return (int8_t)(harness_rand_u32() >> 24);
+}
+
+// Uniform in [lo, hi]
+static inline int32_t nn_rand_range(int32_t lo, int32_t hi)
+{
+    return lo + (int32_t)(harness_rand_u32() % (uint32_t)(hi - lo + 1));
+}
+
+// Uniform in [-1, 1)
+static inline double nn_rand_uniform(void)
+{
+    return (double)(int32_t)harness_rand_u32() / 2147483648.0;
+}
+
+/* ============================================
+   Quantization (same rounding as TFLite)
+   ============================================ */
+
+// real = mult * 2^(shift - 31), mult in [2^30, 2^31)
+static inline void nn_quantize_multiplier(double real, int32_t *mult, int32_t *shift)
+{
+    int exp = 0;
+    double q;
+    int64_t fixed;
+
+    if (real == 0.0) {
+        *mult = 0;
+        *shift = 0;
+        return;
+    }
+    q = frexp(real, &exp);
+    fixed = (int64_t)llround(q * 2147483648.0);
+    if (fixed == (1LL << 31)) {
+        fixed /= 2;
+        exp++;
+    }
+    if (exp < -31) {
+        fixed = 0;
+        exp = 0;
+    }
+    *mult = (int32_t)fixed;
+    *shift = exp;
+}
+
+// arm_softmax_s8 parameters for beta = 1 (5 integer bits in the scaled difference)
+static inline void nn_softmax_params(double input_scale, int32_t *mult, int32_t *shift, int32_t *diff_min)
+{
+    double real = input_scale * (double)(1LL << 26);
+
+    if (real > 2147483647.0) real = 2147483647.0;
+    nn_quantize_multiplier(real, mult, shift);
+    *diff_min = -(int32_t)floor(31.0 * (double)(1LL << 26) / (double)(1LL << *shift));
+}
+
+/* ============================================
+   Tensors and Layers
+   ============================================ */
+
+static inline uint16_t nn_model_tensor(nn_model_t *m, bh_nn_type_t type, bh_nn_kind_t kind,
+                                       int32_t n, int32_t h, int32_t w, int32_t c, const void *data)
+{
+    bh_nn_tensor_t *t;
+    uint32_t index = m->num_tensors++;
+
+    if (index >= NN_MODEL_MAX_TENSORS) {
+        fprintf(stderr, "nn_model: too many tensors\n");
+        exit(1);
+    }
+    t = &m->tensors[index];
+    memset(t, 0, sizeof(*t));
+    t->dims.n = n;
+    t->dims.h = h;
+    t->dims.w = w;
+    t->dims.c = c;
+    t->type = (uint8_t)type;
+    t->kind = (uint8_t)kind;
+
+    if (kind == BH_NN_CONST) {
+        uint32_t bytes = bh_nn_tensor_bytes(t);
+        uint32_t need = ((m->data_len + 3U) & ~3U) + bytes;
+
+        if (need > m->data_cap) {
+            m->data_cap = (need > 2U * m->data_cap) ? need : 2U * m->data_cap;
+            m->data = (uint8_t *)realloc(m->data, m->data_cap);
+        }
+        while (m->data_len & 3U) m->data[m->data_len++] = 0;
+        t->offset = m->data_len;
+        memcpy(m->data + m->data_len, data, bytes);
+        m->data_len += bytes;
+    }
+    return (uint16_t)index;
+}
+
+static inline uint16_t nn_model_activation(nn_model_t *m, int32_t n, int32_t h, int32_t w, int32_t c,
+                                           double scale, int32_t zp)
+{
+    uint16_t t = nn_model_tensor(m, BH_NN_S8, BH_NN_ACTIVATION, n, h, w, c, NULL);
+
+    m->scale[t] = scale;
+    m->zp[t] = zp;
+    m->rms[t] = NN_MODEL_ACT_STD;
+    return t;
+}
+
+static inline void nn_model_layer(nn_model_t *m, bh_nn_op_t op, uint16_t output,
+                                  const uint16_t *inputs, uint32_t num_inputs,
+                                  const int32_t *params, uint32_t num_params)
+{
+    bh_nn_layer_t *l;
+
+    if (m->num_layers >= NN_MODEL_MAX_LAYERS) {
+        fprintf(stderr, "nn_model: too many layers\n");
+        exit(1);
+    }
+    l = &m->layers[m->num_layers++];
+    memset(l, 0, sizeof(*l));
+    l->op = (uint8_t)op;
+    l->num_inputs = (uint8_t)num_inputs;
+    l->output = output;
+    for (uint32_t k = 0; k < BH_NN_MAX_INPUTS; k++) l->inputs[k] = (k < num_inputs) ? inputs[k] : BH_NN_NONE;
+    memcpy(l->params, params, num_params * sizeof(int32_t));
+}
+
+// Output size and leading padding of one spatial dimension
+static inline int32_t nn_model_out_dim(int32_t in, int32_t k, int32_t stride, int same, int32_t *pad)
+{
+    int32_t out, total;
+
+    if (!same) {
+        *pad = 0;
+        return (in - k) / stride + 1;
+    }
+    out = (in + stride - 1) / stride;
+    total = (out - 1) * stride + k - in;
+    *pad = (total > 0) ? total / 2 : 0;
+    return out;
+}
+
+// Weight scale of a reduction over `depth` inputs: uniform int8 weights
+// times this have a variance of k^2 / depth.
+static inline double nn_model_wscale(int32_t depth, double k)
+{
+    return k * sqrt(3.0 / (double)depth) / 127.0;
+}
+
+// Random weights plus bias, multiplier and shift (each optional) for a
+// conv-like layer with `cout` output channels reducing over `depth` inputs,
+// and the output tensor {n, h, w, cout} they requantize to.
+static inline uint16_t nn_model_weights(nn_model_t *m, uint16_t in, int32_t depth, int32_t cout, int relu,
+                                        int8_t *w, uint32_t wlen, int32_t *bias, int32_t *mult, int32_t *shift,
+                                        int32_t n, int32_t h, int32_t ow)
+{
+    double s_in = m->scale[in];
+    double acc_std = NN_MODEL_GAIN * m->rms[in] * s_in;
+    double s_out = acc_std / NN_MODEL_ACT_STD;
+    uint16_t out;
+
+    for (uint32_t i = 0; i < wlen; i++) w[i] = (int8_t)lround(127.0 * nn_model_uniform(m));
+    for (int32_t c = 0; c < cout; c++) {
+        double s_acc = s_in * nn_model_wscale(depth, NN_MODEL_GAIN * (1.0 + 0.25 * nn_model_uniform(m)));
+
+        if (bias != NULL) bias[c] = (int32_t)lround(0.5 * acc_std * nn_model_uniform(m) / s_acc);
+        if (mult != NULL) nn_quantize_multiplier(s_acc / s_out, &mult[c], &shift[c]);
+    }
+
+    // ReLU is folded into the zero point: real 0 at the bottom of the range,
+    // so the -128 clamp of every layer cuts the negative values
+    out = nn_model_activation(m, n, h, ow, cout, s_out, relu ? -128 : 0);
+    if (relu) m->rms[out] = NN_MODEL_ACT_STD / sqrt(2.0);
+    return out;
+}
+
+/* ============================================
+   Layer Helpers (return the output tensor)
+   ============================================ */
+
+// pool = BH_NN_OP_MAXPOOL or BH_NN_OP_AVGPOOL fuses a 2x2 stride 2 pooling
+// of the output (CONV_POOL), BH_NN_OP_CONV is a plain conv. The weights drawn
+// are the same either way.
+static inline uint16_t nn_model_conv_pool(nn_model_t *m, uint16_t in, int32_t cout, int32_t kh, int32_t kw,
+                                          int32_t sh, int32_t sw, int same, int relu, bh_nn_op_t pool)
+{
+    const cmsis_nn_dims d = m->tensors[in].dims;
+    int32_t pad_h, pad_w, oh, ow;
+    uint32_t wlen = (uint32_t)(cout * kh * kw * d.c);
+    int8_t *w = (int8_t *)malloc(wlen);
+    int32_t *bias = (int32_t *)malloc((size_t)cout * sizeof(int32_t) * 3U);
+    uint16_t ops[5], out;
+
+    oh = nn_model_out_dim(d.h, kh, sh, same, &pad_h);
+    ow = nn_model_out_dim(d.w, kw, sw, same, &pad_w);
+    if (pool != BH_NN_OP_CONV) {
+        oh /= 2;
+        ow /= 2;
+    }
+    out = nn_model_weights(m, in, kh * kw * d.c, cout, relu, w, wlen, bias, bias + cout, bias + 2 * cout,
+                           d.n, oh, ow);
+
+    ops[0] = in;
+    ops[1] = nn_model_tensor(m, BH_NN_S8, BH_NN_CONST, cout, kh, kw, d.c, w);
+    ops[2] = nn_model_tensor(m, BH_NN_S32, BH_NN_CONST, 1, 1, 1, cout, bias);
+    ops[3] = nn_model_tensor(m, BH_NN_S32, BH_NN_CONST, 1, 1, 1, cout, bias + cout);
+    ops[4] = nn_model_tensor(m, BH_NN_S32, BH_NN_CONST, 1, 1, 1, cout, bias + 2 * cout);
+
+    const int32_t p[11] = { -m->zp[in], m->zp[out], sw, sh, pad_w, pad_h, 1, 1, -128, 127, (int32_t)pool };
+    if (pool == BH_NN_OP_CONV) {
+        nn_model_layer(m, BH_NN_OP_CONV, out, ops, 5, p, 10);
+    } else {
+        nn_model_layer(m, BH_NN_OP_CONV_POOL, out, ops, 5, p, 11);
+    }
+    free(w);
+    free(bias);
+    return out;
+}
+
+static inline uint16_t nn_model_conv(nn_model_t *m, uint16_t in, int32_t cout, int32_t kh, int32_t kw,
+                                     int32_t sh, int32_t sw, int same, int relu)
+{
+    return nn_model_conv_pool(m, in, cout, kh, kw, sh, sw, same, relu, BH_NN_OP_CONV);
+}
+
+static inline uint16_t nn_model_dw_conv(nn_model_t *m, uint16_t in, int32_t kh, int32_t kw,
+                                        int32_t sh, int32_t sw, int same, int relu)
+{
+    const cmsis_nn_dims d = m->tensors[in].dims;
+    int32_t pad_h, pad_w, oh, ow;
+    uint32_t wlen = (uint32_t)(kh * kw * d.c);
+    int8_t *w = (int8_t *)malloc(wlen);
+    int32_t *bias = (int32_t *)malloc((size_t)d.c * sizeof(int32_t) * 3U);
+    uint16_t ops[5], out;
+
+    oh = nn_model_out_dim(d.h, kh, sh, same, &pad_h);
+    ow = nn_model_out_dim(d.w, kw, sw, same, &pad_w);
+    out = nn_model_weights(m, in, kh * kw, d.c, relu, w, wlen, bias, bias + d.c, bias + 2 * d.c, d.n, oh, ow);
+
+    ops[0] = in;
+    ops[1] = nn_model_tensor(m, BH_NN_S8, BH_NN_CONST, 1, kh, kw, d.c, w);
+    ops[2] = nn_model_tensor(m, BH_NN_S32, BH_NN_CONST, 1, 1, 1, d.c, bias);
+    ops[3] = nn_model_tensor(m, BH_NN_S32, BH_NN_CONST, 1, 1, 1, d.c, bias + d.c);
+    ops[4] = nn_model_tensor(m, BH_NN_S32, BH_NN_CONST, 1, 1, 1, d.c, bias + 2 * d.c);
+
+    const int32_t p[11] = { -m->zp[in], m->zp[out], sw, sh, pad_w, pad_h, 1, 1, -128, 127, 1 };
+    nn_model_layer(m, BH_NN_OP_DW_CONV, out, ops, 5, p, 11);
+    free(w);
+    free(bias);
+    return out;
+}
+
+static inline uint16_t nn_model_fc(nn_model_t *m, uint16_t in, int32_t units, int relu)
+{
+    const cmsis_nn_dims d = m->tensors[in].dims;
+    int32_t depth = d.h * d.w * d.c, mult, shift;
+    uint32_t wlen = (uint32_t)(units * depth);
+    int8_t *w = (int8_t *)malloc(wlen);
+    int32_t *bias = (int32_t *)malloc((size_t)units * sizeof(int32_t));
+    uint16_t ops[3], out;
+
+    // Per-tensor quantization: one multiplier from the mean weight scale
+    out = nn_model_weights(m, in, depth, units, relu, w, wlen, bias, NULL, NULL, d.n, 1, 1);
+    nn_quantize_multiplier(m->scale[in] * nn_model_wscale(depth, NN_MODEL_GAIN) / m->scale[out], &mult, &shift);
+
+    ops[0] = in;
+    ops[1] = nn_model_tensor(m, BH_NN_S8, BH_NN_CONST, depth, 1, 1, units, w);
+    ops[2] = nn_model_tensor(m, BH_NN_S32, BH_NN_CONST, 1, 1, 1, units, bias);
+
+    const int32_t p[7] = { -m->zp[in], 0, m->zp[out], -128, 127, mult, shift };
+    nn_model_layer(m, BH_NN_OP_FC, out, ops, 3, p, 7);
+    free(w);
+    free(bias);
+    return out;
+}
+
+// Fully connected layer from trained float weights (units x depth, row per
+// output) and biases, per-tensor int8 like the TFLite converter; the output
+// has zero point 0 and out_scale per LSB.
+static inline uint16_t nn_model_fc_float(nn_model_t *m, uint16_t in, int32_t units, const float *weights,
+                                         const float *biases, double out_scale)
+{
+    const cmsis_nn_dims d = m->tensors[in].dims;
+    int32_t depth = d.h * d.w * d.c, mult, shift;
+    uint32_t wlen = (uint32_t)(units * depth);
+    int8_t *w = (int8_t *)malloc(wlen);
+    int32_t *bias = (int32_t *)malloc((size_t)units * sizeof(int32_t));
+    double wmax = 0.0, s_w;
+    uint16_t ops[3], out;
+
+    for (uint32_t i = 0; i < wlen; i++) wmax = fmax(wmax, fabs(weights[i]));
+    s_w = (wmax > 0.0) ? wmax / 127.0 : 1.0;
+    for (uint32_t i = 0; i < wlen; i++) w[i] = (int8_t)lround(weights[i] / s_w);
+    for (int32_t u = 0; u < units; u++) bias[u] = (int32_t)lround(biases[u] / (m->scale[in] * s_w));
+
+    out = nn_model_activation(m, d.n, 1, 1, units, out_scale, 0);
+    nn_quantize_multiplier(m->scale[in] * s_w / out_scale, &mult, &shift);
+
+    ops[0] = in;
+    ops[1] = nn_model_tensor(m, BH_NN_S8, BH_NN_CONST, depth, 1, 1, units, w);
+    ops[2] = nn_model_tensor(m, BH_NN_S32, BH_NN_CONST, 1, 1, 1, units, bias);
+
+    const int32_t p[7] = { -m->zp[in], 0, 0, -128, 127, mult, shift };
+    nn_model_layer(m, BH_NN_OP_FC, out, ops, 3, p, 7);
+    free(w);
+    free(bias);
+    return out;
+}
+
+static inline uint16_t nn_model_pool(nn_model_t *m, bh_nn_op_t op, uint16_t in, int32_t kh, int32_t kw,
+                                     int32_t sh, int32_t sw, int same)
+{
+    const cmsis_nn_dims d = m->tensors[in].dims;
+    int32_t pad_h, pad_w;
+    int32_t oh = nn_model_out_dim(d.h, kh, sh, same, &pad_h);
+    int32_t ow = nn_model_out_dim(d.w, kw, sw, same, &pad_w);
+    uint16_t out = nn_model_activation(m, d.n, oh, ow, d.c, m->scale[in], m->zp[in]);
+    const int32_t p[8] = { sw, sh, pad_w, pad_h, -128, 127, kw, kh };
+
+    m->rms[out] = m->rms[in];
+
+    nn_model_layer(m, op, out, &in, 1, p, 8);
+    return out;
+}
+
+static inline uint16_t nn_model_softmax(nn_model_t *m, uint16_t in)
+{
+    const cmsis_nn_dims d = m->tensors[in].dims;
+    uint16_t out = nn_model_activation(m, d.n, d.h, d.w, d.c, 1.0 / 256.0, -128);
+    int32_t p[3];
+
+    nn_softmax_params(m->scale[in], &p[0], &p[1], &p[2]);
+    nn_model_layer(m, BH_NN_OP_SOFTMAX, out, &in, 1, p, 3);
+    return out;
+}
+
+static inline uint16_t nn_model_add(nn_model_t *m, uint16_t a, uint16_t b)
+{
+    const cmsis_nn_dims d = m->tensors[a].dims;
+    double twice_max = 2.0 * fmax(m->scale[a], m->scale[b]);
+    double s_out = (m->scale[a] * m->rms[a] + m->scale[b] * m->rms[b]) / NN_MODEL_ACT_STD;
+    uint16_t ops[2] = { a, b };
+    int32_t p[12];
+
+    nn_quantize_multiplier(m->scale[a] / twice_max, &p[1], &p[2]);
+    nn_quantize_multiplier(m->scale[b] / twice_max, &p[4], &p[5]);
+    nn_quantize_multiplier(twice_max / ((double)(1 << 20) * s_out), &p[8], &p[9]);
+    p[0] = -m->zp[a];
+    p[3] = -m->zp[b];
+    p[6] = 20;
+    p[7] = 0;
+    p[10] = -128;
+    p[11] = 127;
+
+    uint16_t out = nn_model_activation(m, d.n, d.h, d.w, d.c, s_out, 0);
+    nn_model_layer(m, BH_NN_OP_ADD, out, ops, 2, p, 12);
+    return out;
+}
+
+static inline uint16_t nn_model_relu6(nn_model_t *m, uint16_t in)
+{
+    const cmsis_nn_dims d = m->tensors[in].dims;
+    uint16_t out = nn_model_activation(m, d.n, d.h, d.w, d.c, m->scale[in], m->zp[in]);
+
+    // arm_relu6_s8 clamps the raw values to [0, 6]
+    m->rms[out] = 4.0;
+    nn_model_layer(m, BH_NN_OP_RELU6, out, &in, 1, NULL, 0);
+    return out;
+}
+
+static inline uint16_t nn_model_reshape(nn_model_t *m, uint16_t in, int32_t n, int32_t h, int32_t w, int32_t c)
+{
+    uint16_t out = nn_model_activation(m, n, h, w, c, m->scale[in], m->zp[in]);
+
+    m->rms[out] = m->rms[in];
+    nn_model_layer(m, BH_NN_OP_RESHAPE, out, &in, 1, NULL, 0);
+    return out;
+}
+
+// Input is flattened to {batches, features, 1, 1} first if needed
+static inline uint16_t nn_model_svdf(nn_model_t *m, uint16_t in, int32_t rank, int32_t units, int32_t memory)
+{
+    cmsis_nn_dims d = m->tensors[in].dims;
+    int32_t size = d.h * d.w * d.c, filters = rank * units;
+    int8_t *wf = (int8_t *)malloc((size_t)(filters * size));
+    int8_t *wt = (int8_t *)malloc((size_t)(filters * memory));
+    int32_t *bias = (int32_t *)malloc((size_t)units * sizeof(int32_t));
+    double s_state, s_out, s_acc;
+    int32_t p[11];
+    uint16_t ops[5];
+
+    if (d.w != 1 || d.c != 1) in = nn_model_reshape(m, in, d.n, size, 1, 1);
+
+    // Feature stage: input x weights_feature, one int8 state column per step
+    s_state = NN_MODEL_GAIN * m->rms[in] * m->scale[in] / NN_MODEL_ACT_STD;
+    for (int32_t i = 0; i < filters * size; i++) wf[i] = (int8_t)lround(127.0 * nn_model_uniform(m));
+    nn_quantize_multiplier(m->scale[in] * nn_model_wscale(size, NN_MODEL_GAIN) / s_state, &p[7], &p[8]);
+
+    // Time stage: state x weights_time over the memory, summed over rank
+    s_acc = s_state * nn_model_wscale(memory * rank, NN_MODEL_GAIN);
+    s_out = NN_MODEL_GAIN * s_state;
+    for (int32_t i = 0; i < filters * memory; i++) wt[i] = (int8_t)lround(127.0 * nn_model_uniform(m));
+    for (int32_t u = 0; u < units; u++) {
+        bias[u] = (int32_t)lround(0.5 * NN_MODEL_ACT_STD * s_out * nn_model_uniform(m) / s_acc);
+    }
+    nn_quantize_multiplier(s_acc / s_out, &p[9], &p[10]);
+
+    ops[0] = in;
+    ops[1] = nn_model_tensor(m, BH_NN_S8, BH_NN_STATE, d.n, 1, 1, filters * memory, NULL);
+    ops[2] = nn_model_tensor(m, BH_NN_S8, BH_NN_CONST, filters, 1, 1, size, wf);
+    ops[3] = nn_model_tensor(m, BH_NN_S8, BH_NN_CONST, filters, memory, 1, 1, wt);
+    ops[4] = nn_model_tensor(m, BH_NN_S32, BH_NN_CONST, 1, 1, 1, units, bias);
+
+    p[0] = rank;
+    p[1] = m->zp[in];           // arm_svdf_s8 negates it itself
+    p[2] = 0;
+    p[3] = -128;
+    p[4] = 127;
+    p[5] = -128;
+    p[6] = 127;
+
+    uint16_t out = nn_model_activation(m, d.n, 1, 1, units, s_out, 0);
+    nn_model_layer(m, BH_NN_OP_SVDF, out, ops, 5, p, 11);
+    free(wf);
+    free(wt);
+    free(bias);
+    return out;
+}
+
+/* ============================================
+   Serialization
+   ============================================ */
+
+// Returns the model (malloc'ed, caller frees) and its size.
+static inline uint8_t *nn_model_save(const nn_model_t *m, uint16_t input, uint16_t output, uint32_t *size)
+{
+    uint32_t base = (uint32_t)(sizeof(bh_nn_header_t) + m->num_tensors * sizeof(bh_nn_tensor_t) +
+                               m->num_layers * sizeof(bh_nn_layer_t));
+    uint32_t total = (base + m->data_len + 3U) & ~3U;
+    uint8_t *blob = (uint8_t *)calloc(1, total);
+    bh_nn_header_t h;
+    bh_nn_tensor_t *t = (bh_nn_tensor_t *)(blob + sizeof(bh_nn_header_t));
+
+    memset(&h, 0, sizeof(h));
+    h.magic = BH_NN_MAGIC;
+    h.version = BH_NN_VERSION;
+    h.num_tensors = (uint16_t)m->num_tensors;
+    h.num_layers = (uint16_t)m->num_layers;
+    h.input = input;
+    h.output = output;
+    h.size = total;
+
+    memcpy(blob, &h, sizeof(h));
+    memcpy(t, m->tensors, m->num_tensors * sizeof(bh_nn_tensor_t));
+    memcpy(t + m->num_tensors, m->layers, m->num_layers * sizeof(bh_nn_layer_t));
+    if (m->data_len) memcpy(blob + base, m->data, m->data_len);
+    for (uint32_t i = 0; i < m->num_tensors; i++) {
+        if (t[i].kind == BH_NN_CONST) t[i].offset += base;
+    }
+    *size = total;
+    return blob;
+}
+
+// Returns the file contents (malloc'ed, caller frees) or NULL with a message on stderr.
+static inline uint8_t *nn_model_read(const char *path, uint32_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *blob = NULL;
+    long len;
+
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+    if (fseek(f, 0, SEEK_END) == 0 && (len = ftell(f)) > 0 && fseek(f, 0, SEEK_SET) == 0) {
+        blob = (uint8_t *)malloc((size_t)len);
+        if (blob != NULL && fread(blob, 1, (size_t)len, f) == (size_t)len) {
+            *size = (uint32_t)len;
+        } else {
+            free(blob);
+            blob = NULL;
+        }
+    }
+    if (blob == NULL) fprintf(stderr, "%s: read failed\n", path);
+    fclose(f);
+    return blob;
+}
+
+static inline int nn_model_write(const char *path, const uint8_t *blob, uint32_t size)
+{
+    FILE *f = fopen(path, "wb");
+    int ok;
+
+    if (f == NULL) {
+        perror(path);
+        return 0;
+    }
+    ok = fwrite(blob, 1, size, f) == size;
+    ok &= fclose(f) == 0;
+    if (!ok) fprintf(stderr, "%s: write failed\n", path);
+    return ok;
+}
+
+/* ============================================
+   Reference Models
+   ============================================ */
+
+// DS-CNN-S keyword spotter: 49x10 MFCC input, a 10x4 stride-2 conv, four
+// depthwise-separable blocks of 64 channels, global average pooling and a
+// 12-way classifier.
+static inline uint8_t *nn_model_dscnn(uint32_t seed, uint32_t *size)
+{
+    nn_model_t *m = (nn_model_t *)malloc(sizeof(nn_model_t));
+    uint16_t in, x;
+    uint8_t *blob;
+
+    nn_model_init(m, seed);
+    in = nn_model_activation(m, 1, 49, 10, 1, 1.0 / 32.0, 0);
+    x = nn_model_conv(m, in, 64, 10, 4, 2, 2, 1, 1);
+    for (int b = 0; b < 4; b++) {
+        x = nn_model_dw_conv(m, x, 3, 3, 1, 1, 1, 1);
+        x = nn_model_conv(m, x, 64, 1, 1, 1, 1, 1, 1);
+    }
+    x = nn_model_pool(m, BH_NN_OP_AVGPOOL, x, m->tensors[x].dims.h, m->tensors[x].dims.w, 1, 1, 0);
+    x = nn_model_fc(m, x, 12, 0);
+    x = nn_model_softmax(m, x);
+
+    blob = nn_model_save(m, in, x, size);
+    nn_model_free(m);
+    free(m);
+    return blob;
+}
+
+// Small model covering the other ops: max pooling, a residual add, relu6,
+// reshape and two stateful SVDF layers.
+static inline uint8_t *nn_model_mixed(uint32_t seed, uint32_t *size)
+{
+    nn_model_t *m = (nn_model_t *)malloc(sizeof(nn_model_t));
+    uint16_t in, a, b, x;
+    uint8_t *blob;
+
+    nn_model_init(m, seed);
+    in = nn_model_activation(m, 1, 16, 16, 3, 1.0 / 64.0, -3);
+    a = nn_model_conv(m, in, 16, 3, 3, 1, 1, 1, 1);
+    a = nn_model_pool(m, BH_NN_OP_MAXPOOL, a, 2, 2, 2, 2, 0);
+    b = nn_model_dw_conv(m, a, 3, 3, 1, 1, 1, 0);
+    b = nn_model_conv(m, b, 16, 1, 1, 1, 1, 1, 0);
+    x = nn_model_add(m, a, b);
+    x = nn_model_relu6(m, x);
+    x = nn_model_conv(m, x, 8, 3, 3, 2, 2, 1, 1);
+    x = nn_model_svdf(m, x, 2, 32, 8);
+    x = nn_model_svdf(m, x, 1, 16, 4);
+    x = nn_model_fc(m, x, 10, 0);
+    x = nn_model_softmax(m, x);
+
+    blob = nn_model_save(m, in, x, size);
+    nn_model_free(m);
+    free(m);
+    return blob;
+}
+
+// Small image classifier of conv / ReLU / 2x2 pooling blocks: 32x32x3
+// input, 3x3 convs of 16, 32 and 64 channels, max pooling twice and average
+// pooling once, global average pooling and a 10-way classifier. fused puts
+// each pooling in its conv (CONV_POOL); the weights are the same.
+static inline uint8_t *nn_model_cnn(uint32_t seed, int fused, uint32_t *size)
+{
+    static const bh_nn_op_t pools[3] = { BH_NN_OP_MAXPOOL, BH_NN_OP_MAXPOOL, BH_NN_OP_AVGPOOL };
+    nn_model_t *m = (nn_model_t *)malloc(sizeof(nn_model_t));
+    uint16_t in, x;
+    uint8_t *blob;
+
+    nn_model_init(m, seed);
+    in = nn_model_activation(m, 1, 32, 32, 3, 1.0 / 64.0, 0);
+    x = in;
+    for (int b = 0; b < 3; b++) {
+        if (fused) {
+            x = nn_model_conv_pool(m, x, 16 << b, 3, 3, 1, 1, 1, 1, pools[b]);
+        } else {
+            x = nn_model_conv(m, x, 16 << b, 3, 3, 1, 1, 1, 1);
+            x = nn_model_pool(m, pools[b], x, 2, 2, 2, 2, 0);
+        }
+    }
+    x = nn_model_pool(m, BH_NN_OP_AVGPOOL, x, m->tensors[x].dims.h, m->tensors[x].dims.w, 1, 1, 0);
+    x = nn_model_fc(m, x, 10, 0);
+    x = nn_model_softmax(m, x);
+
+    blob = nn_model_save(m, in, x, size);
+    nn_model_free(m);
+    free(m);
+    return blob;
+}
+
+// Reference model by name ("dscnn", "mixed", "cnn", "cnn_unfused"), NULL if unknown
+static inline uint8_t *nn_model_build(const char *name, uint32_t seed, uint32_t *size)
+{
+    if (strcmp(name, "dscnn") == 0) return nn_model_dscnn(seed, size);
+    if (strcmp(name, "mixed") == 0) return nn_model_mixed(seed, size);
+    if (strcmp(name, "cnn") == 0) return nn_model_cnn(seed, 1, size);
+    if (strcmp(name, "cnn_unfused") == 0) return nn_model_cnn(seed, 0, size);
+    return NULL;
+}
+
+#endif /* NN_MODEL_H */
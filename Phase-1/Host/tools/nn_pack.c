@@ -0,0 +1,313 @@
+/* nn_pack.c
+ *
+ * Offline weight packing for BHNN models (bh_nn_graph).
+ *
+ * arm_convolve_s8 and arm_fully_connected_s8 redo work on every inference
+ * that only depends on the weights: the input offset is added to each
+ * activation (or multiplied into the row sums), and a depth that is not a
+ * multiple of 4 leaves every row with a scalar tail. This tool does it
+ * once. Every CONV becomes a CONV_PACKED layer (and with --fc every FC a
+ * FC_PACKED layer):
+ *
+ *   packed filter  S8  {rows, 1, 1, depth rounded up to 4}, zero padded
+ *   kernel sums    S32 {1, 1, 1, rows}, bias + input_offset * sum(row)
+ *
+ * (arm_nn_pack_weights_s8), so the kernels multiply raw int8 activations
+ * and start each accumulator at its kernel sum. The filter and bias of a
+ * packed layer are dropped from the model; depthwise convolutions and the
+ * other ops are copied unchanged.
+ *
+ * FC layers are left alone by default: arm_fully_connected_s8 already
+ * folds the input offset into its row sums, so for a depth that is a
+ * multiple of 4 FC_PACKED makes the same arm_nn_vec_mat_mult_t_s8 call
+ * and measures slower, not faster.
+ *
+ * The packed model is run next to the original on random inputs and every
+ * layer output is compared bit for bit, then both are timed layer by
+ * layer (interleaved invokes, so both see the same machine state).
+ *
+ *   nn_pack [--net dscnn|mixed|cnn|cnn_unfused] [--model PATH] [--out PATH]
+ *           [--fc] [--runs N] [--seed N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+#include "bh_arena.h"
+#include "bh_nn_graph.h"
+#include "nn_model.h"
+
+#define ARENA_BYTES     (256U * 1024U)
+
+static uint8_t arena_a[ARENA_BYTES] __attribute__((aligned(16)));
+static uint8_t arena_b[ARENA_BYTES] __attribute__((aligned(16)));
+
+/* ============================================
+   Packing
+   ============================================ */
+
+static int pack_fc;             // --fc: FC layers too
+
+static int packable(const bh_nn_tensor_t *t, const bh_nn_layer_t *l)
+{
+    if (l->op == BH_NN_OP_CONV) return t[l->inputs[1]].type == BH_NN_S8;
+    // The packed FC has no filter offset (arm_fully_connected_s8 ignores it too)
+    if (l->op == BH_NN_OP_FC) return pack_fc && t[l->inputs[1]].type == BH_NN_S8 && l->params[1] == 0;
+    return 0;
+}
+
+// Rewrites the model with every packable layer packed; NULL on a bad model.
+static uint8_t *pack_model(const uint8_t *blob, uint32_t size, uint32_t *packed_size)
+{
+    bh_nn_graph_t g;
+    nn_model_t *m;
+    uint16_t *remap;
+    uint8_t *keep, *out;
+
+    if (bh_nn_graph_load(&g, blob, size) != ARM_MATH_SUCCESS) return NULL;
+
+    const bh_nn_header_t *h = g.header;
+    const bh_nn_tensor_t *t = g.tensors;
+
+    // Constants that a layer other than as packed filter or bias still reads
+    keep = (uint8_t *)calloc(h->num_tensors, 1);
+    remap = (uint16_t *)malloc(h->num_tensors * sizeof(uint16_t));
+    for (uint32_t k = 0; k < h->num_layers; k++) {
+        const bh_nn_layer_t *l = &g.layers[k];
+        for (uint32_t i = 0; i < l->num_inputs; i++) {
+            if (!packable(t, l) || (i != 1U && i != 2U)) keep[l->inputs[i]] = 1;
+        }
+    }
+
+    m = (nn_model_t *)malloc(sizeof(nn_model_t));
+    nn_model_init(m, 0);
+    for (uint32_t i = 0; i < h->num_tensors; i++) {
+        const void *data = (t[i].kind == BH_NN_CONST) ? blob + t[i].offset : NULL;
+
+        remap[i] = BH_NN_NONE;
+        if (t[i].kind != BH_NN_CONST || keep[i]) {
+            remap[i] = nn_model_tensor(m, (bh_nn_type_t)t[i].type, (bh_nn_kind_t)t[i].kind, t[i].dims.n,
+                                       t[i].dims.h, t[i].dims.w, t[i].dims.c, data);
+        }
+    }
+
+    for (uint32_t k = 0; k < h->num_layers; k++) {
+        const bh_nn_layer_t *l = &g.layers[k];
+        uint16_t inputs[BH_NN_MAX_INPUTS];
+        int32_t params[BH_NN_MAX_PARAMS];
+        bh_nn_op_t op = (bh_nn_op_t)l->op;
+
+        for (uint32_t i = 0; i < l->num_inputs; i++) inputs[i] = remap[l->inputs[i]];
+        memcpy(params, l->params, sizeof(params));
+
+        if (packable(t, l)) {
+            const cmsis_nn_dims *in = &t[l->inputs[0]].dims, *f = &t[l->inputs[1]].dims;
+            int32_t rows = (op == BH_NN_OP_CONV) ? f->n : f->c;
+            int32_t depth = (op == BH_NN_OP_CONV) ? f->h * f->w * f->c : in->h * in->w * in->c;
+            int32_t cols = arm_nn_packed_s8_cols(depth);
+            q7_t *packed = (q7_t *)malloc((size_t)(rows * cols));
+            int32_t *sums = (int32_t *)malloc((size_t)rows * sizeof(int32_t));
+
+            // FC filters are {depth, 1, 1, units} but stored one unit after another
+            arm_nn_pack_weights_s8((const q7_t *)(blob + t[l->inputs[1]].offset),
+                                   (const int32_t *)(blob + t[l->inputs[2]].offset), rows, depth, params[0],
+                                   packed, sums);
+            inputs[1] = nn_model_tensor(m, BH_NN_S8, BH_NN_CONST, rows, 1, 1, cols, packed);
+            inputs[2] = nn_model_tensor(m, BH_NN_S32, BH_NN_CONST, 1, 1, 1, rows, sums);
+            free(packed);
+            free(sums);
+
+            if (op == BH_NN_OP_CONV) {
+                op = BH_NN_OP_CONV_PACKED;
+                params[10] = f->h;
+                params[11] = f->w;
+            } else {
+                op = BH_NN_OP_FC_PACKED;
+            }
+        }
+        nn_model_layer(m, op, remap[l->output], inputs, l->num_inputs, params, BH_NN_MAX_PARAMS);
+    }
+
+    out = nn_model_save(m, remap[h->input], remap[h->output], packed_size);
+    nn_model_free(m);
+    free(m);
+    free(remap);
+    free(keep);
+    return out;
+}
+
+/* ============================================
+   Layer-by-layer comparison
+   ============================================ */
+
+typedef struct {
+    int8_t **ref;               // Per layer: output of the original model
+    uint32_t *mismatches;       // Per layer: runs whose packed output differed
+} compare_t;
+
+static void store_hook(void *ctx, const bh_nn_graph_t *g, uint32_t layer)
+{
+    compare_t *c = (compare_t *)ctx;
+    uint16_t out = g->layers[layer].output;
+
+    memcpy(c->ref[layer], g->data[out], bh_nn_tensor_bytes(&g->tensors[out]));
+}
+
+static void compare_hook(void *ctx, const bh_nn_graph_t *g, uint32_t layer)
+{
+    compare_t *c = (compare_t *)ctx;
+    uint16_t out = g->layers[layer].output;
+
+    if (memcmp(c->ref[layer], g->data[out], bh_nn_tensor_bytes(&g->tensors[out])) != 0) c->mismatches[layer]++;
+}
+
+// Bytes of the filter and bias operands of a layer
+static uint32_t weight_bytes(const bh_nn_graph_t *g, uint32_t layer)
+{
+    const bh_nn_layer_t *l = &g->layers[layer];
+    uint32_t bytes = 0;
+
+    for (uint32_t i = 1; i < 3U && i < l->num_inputs; i++) {
+        if (g->tensors[l->inputs[i]].kind == BH_NN_CONST) bytes += bh_nn_tensor_bytes(&g->tensors[l->inputs[i]]);
+    }
+    return bytes;
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    const char *net = "dscnn", *model_path = NULL, *out_path = NULL;
+    uint32_t runs = 200, seed = 1, size = 0, packed_size = 0;
+    uint8_t *blob, *packed;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--net") == 0 && i + 1 < argc) {
+            net = argv[++i];
+        } else if (strcmp(argv[i], "--model") == 0 && i + 1 < argc) {
+            model_path = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "--fc") == 0) {
+            pack_fc = 1;
+        } else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+            runs = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else {
+            fprintf(stderr, "usage: %s [--net dscnn|mixed|cnn|cnn_unfused] [--model PATH] [--out PATH]\n"
+                            "       [--fc] [--runs N] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (runs == 0U) runs = 1U;
+
+    if (model_path != NULL) {
+        if ((blob = nn_model_read(model_path, &size)) == NULL) return 1;
+        net = model_path;
+    } else if ((blob = nn_model_build(net, seed, &size)) == NULL) {
+        fprintf(stderr, "unknown net %s\n", net);
+        return 2;
+    }
+
+    if ((packed = pack_model(blob, size, &packed_size)) == NULL) {
+        fprintf(stderr, "%s: not a valid BHNN model\n", net);
+        return 1;
+    }
+    if (out_path != NULL && !nn_model_write(out_path, packed, packed_size)) return 1;
+
+    bh_arena_t arena;
+    bh_nn_graph_t a, b;
+    arm_status st;
+
+    bh_arena_init(&arena, arena_a, ARENA_BYTES);
+    st = bh_nn_graph_init(&a, &arena, blob, size);
+    if (st == ARM_MATH_SUCCESS) {
+        bh_arena_init(&arena, arena_b, ARENA_BYTES);
+        st = bh_nn_graph_init(&b, &arena, packed, packed_size);
+    }
+    if (st != ARM_MATH_SUCCESS) {
+        fprintf(stderr, "%s: bh_nn_graph_init failed (%d)\n", net, (int)st);
+        return 1;
+    }
+
+    const bh_nn_header_t *h = a.header;
+    uint32_t in_bytes = bh_nn_graph_input_bytes(&a);
+    compare_t cmp;
+    uint32_t bad = 0;
+
+    printf("model %s: %u -> %u bytes packed, scratch %d -> %d bytes\n", net, size, packed_size,
+           (int)a.scratch.size, (int)b.scratch.size);
+
+    // Bit-exact, layer by layer, state carried across runs
+    cmp.ref = (int8_t **)malloc(h->num_layers * sizeof(int8_t *));
+    cmp.mismatches = (uint32_t *)calloc(h->num_layers, sizeof(uint32_t));
+    for (uint32_t l = 0; l < h->num_layers; l++) {
+        cmp.ref[l] = (int8_t *)malloc(bh_nn_tensor_bytes(&a.tensors[a.layers[l].output]));
+    }
+    bh_nn_graph_set_hook(&a, store_hook, &cmp);
+    bh_nn_graph_set_hook(&b, compare_hook, &cmp);
+    for (uint32_t r = 0; r < runs; r++) {
+        int8_t *x = bh_nn_graph_input(&a);
+        for (uint32_t i = 0; i < in_bytes; i++) x[i] = nn_rand_s8();
+        memcpy(bh_nn_graph_input(&b), x, in_bytes);
+
+        if (bh_nn_graph_invoke(&a) != ARM_MATH_SUCCESS || bh_nn_graph_invoke(&b) != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "invoke failed\n");
+            return 1;
+        }
+    }
+    bh_nn_graph_set_hook(&a, NULL, NULL);
+    bh_nn_graph_set_hook(&b, NULL, NULL);
+    for (uint32_t l = 0; l < h->num_layers; l++) bad += cmp.mismatches[l];
+    printf("bit-exact vs original: %s (%u layers x %u runs)\n\n", bad ? "MISMATCH" : "OK", h->num_layers, runs);
+
+    // Per-layer cost, interleaved runs
+    uint64_t total_a = 0, total_b = 0, packed_a = 0, packed_b = 0;
+    bh_nn_graph_reset_stats(&a);
+    bh_nn_graph_reset_stats(&b);
+    for (uint32_t r = 0; r < runs; r++) {
+        bh_nn_graph_invoke(&a);
+        bh_nn_graph_invoke(&b);
+    }
+
+    printf("layer  op                 output            MACs   weights B before->after    cycles before->after   change\n");
+    for (uint32_t l = 0; l < h->num_layers; l++) {
+        const bh_nn_layer_t *la = &a.layers[l], *lb = &b.layers[l];
+        const cmsis_nn_dims *d = &a.tensors[la->output].dims;
+        uint32_t ca = bh_nn_graph_layer_cycles(&a, l), cb = bh_nn_graph_layer_cycles(&b, l);
+        bh_nn_layer_cost_t cost;
+        char shape[32], ops[32];
+
+        bh_nn_graph_layer_cost(&a, l, &cost);
+        total_a += ca;
+        total_b += cb;
+        if (la->op != lb->op) {
+            packed_a += ca;
+            packed_b += cb;
+        }
+        snprintf(shape, sizeof(shape), "%dx%dx%dx%d", (int)d->n, (int)d->h, (int)d->w, (int)d->c);
+        snprintf(ops, sizeof(ops), "%s%s%s", bh_nn_op_name(la->op), (la->op != lb->op) ? " -> " : "",
+                 (la->op != lb->op) ? bh_nn_op_name(lb->op) : "");
+        printf("%5u  %-17s  %-14s %8llu  %9u -> %-9u  %10u -> %-10u  %+6.1f%%%s\n", l, ops, shape,
+               (unsigned long long)cost.macs, weight_bytes(&a, l), weight_bytes(&b, l), ca, cb,
+               ca ? 100.0 * ((double)cb - (double)ca) / (double)ca : 0.0, cmp.mismatches[l] ? "  MISMATCH" : "");
+    }
+    printf("packed layers  %10llu -> %-10llu  %+6.1f%%\n", (unsigned long long)packed_a,
+           (unsigned long long)packed_b,
+           packed_a ? 100.0 * ((double)packed_b - (double)packed_a) / (double)packed_a : 0.0);
+    printf("whole model    %10llu -> %-10llu  %+6.1f%%\n", (unsigned long long)total_a,
+           (unsigned long long)total_b,
+           total_a ? 100.0 * ((double)total_b - (double)total_a) / (double)total_a : 0.0);
+
+    for (uint32_t l = 0; l < h->num_layers; l++) free(cmp.ref[l]);
+    free(cmp.ref);
+    free(cmp.mismatches);
+    free(packed);
+    free(blob);
+    return bad ? 1 : 0;
+}
@@ -0,0 +1,358 @@
+/* nn_parallel_harness.c
+ *
+ * Multithreaded batch inference: bh_nn_parallel_conv_s8 / _fc_s8 against
+ * the single-threaded CMSIS-NN kernels they wrap.
+ *
+ * Every layer of the table runs with random weights and inputs at each
+ * batch size. The output at every thread count from 1 to 8 must equal the
+ * plain kernel's byte for byte; counts above the CPU count are included so
+ * all three ways of splitting a layer (batches, pointwise rows, output
+ * channels) are exercised on any host. Then each layer is timed at 1 ..
+ * --threads threads (default: online CPUs), printing the wall time per
+ * batch item and the speedup over the plain kernel, followed by the
+ * scaling table: speedup and efficiency (speedup / threads) of each
+ * thread count over one thread, per layer and for the whole table.
+ *
+ * The scaling table only means something with at least --threads online
+ * CPUs; with fewer, the extra threads share a core and the harness says
+ * so. For the Pi 5 (four A76 cores):
+ *
+ *   nn_parallel_harness --threads 4
+ *
+ *   nn_parallel_harness [--batch N[,N...]] [--threads N] [--min-time MS] [--seed N]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "arm_nnfunctions.h"
+#include "bh_nn_parallel.h"
+#include "nn_model.h"
+
+#define MAX_BATCHES     8
+#define MAX_THREADS     32U
+#define CHECK_THREADS   8U
+
+typedef struct {
+    const char *name;
+    int fc;                         // Fully connected, else convolution
+    int32_t h, w, cin;              // Input (FC: cin is the depth)
+    int32_t cout;
+    int32_t kh, kw, stride_h, stride_w, pad_h, pad_w;
+} layer_t;
+
+// DS-CNN keyword spotter layers, a small CNN block and two classifiers
+static const layer_t layers[] = {
+    { "kws conv 10x4 s2 49x10x1->64", 0, 49, 10, 1,    64,  10, 4, 2, 2, 4, 1 },
+    { "kws pw 25x5 64->64",           0, 25, 5,  64,   64,  1,  1, 1, 1, 0, 0 },
+    { "cnn 3x3 32x32x16->32",         0, 32, 32, 16,   32,  3,  3, 1, 1, 1, 1 },
+    { "cnn 3x3 s2 16x16x32->64",      0, 16, 16, 32,   64,  3,  3, 2, 2, 0, 0 },
+    { "fc 1024->256",                 1, 1,  1,  1024, 256, 1,  1, 1, 1, 0, 0 },
+    { "kws fc 64->12",                1, 1,  1,  64,   12,  1,  1, 1, 1, 0, 0 },
+};
+
+#define NUM_LAYERS  (sizeof(layers) / sizeof(layers[0]))
+
+// Time per batch item of each layer at 1 .. MAX_THREADS threads, us
+static double times[MAX_BATCHES][NUM_LAYERS][MAX_THREADS + 1U];
+
+typedef struct {
+    const layer_t *l;
+    cmsis_nn_dims in_dims, filter_dims, bias_dims, out_dims;
+    cmsis_nn_conv_params conv;
+    cmsis_nn_fc_params fc;
+    cmsis_nn_per_channel_quant_params conv_q;
+    cmsis_nn_per_tensor_quant_params fc_q;
+    int8_t *input, *weights, *ref, *out;
+    int32_t *bias, *mult, *shift;
+    size_t out_bytes;
+} setup_t;
+
+static double now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static void *xmalloc(size_t bytes)
+{
+    void *p = malloc(bytes ? bytes : 1U);
+
+    if (p == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+// Random layer at a batch size; multipliers put the outputs at ~40 LSB RMS
+static void setup_init(setup_t *s, const layer_t *l, int32_t batch)
+{
+    int32_t oh = (l->h + 2 * l->pad_h - l->kh) / l->stride_h + 1;
+    int32_t ow = (l->w + 2 * l->pad_w - l->kw) / l->stride_w + 1;
+    int32_t depth = l->kh * l->kw * l->cin;
+    size_t in_bytes = (size_t)batch * l->h * l->w * l->cin;
+    int32_t in_zp = nn_rand_range(-20, 20), out_zp = nn_rand_range(-20, 20);
+    double acc_rms = sqrt((double)depth) * 73.0 * 74.0;
+
+    memset(s, 0, sizeof(*s));
+    s->l = l;
+    s->in_dims = (cmsis_nn_dims){ batch, l->h, l->w, l->cin };
+    s->bias_dims = (cmsis_nn_dims){ 1, 1, 1, l->cout };
+    if (l->fc) {
+        s->filter_dims = (cmsis_nn_dims){ depth, 1, 1, l->cout };
+        s->out_dims = (cmsis_nn_dims){ batch, 1, 1, l->cout };
+    } else {
+        s->filter_dims = (cmsis_nn_dims){ l->cout, l->kh, l->kw, l->cin };
+        s->out_dims = (cmsis_nn_dims){ batch, oh, ow, l->cout };
+    }
+    s->out_bytes = (size_t)s->out_dims.n * s->out_dims.h * s->out_dims.w * s->out_dims.c;
+
+    s->input = (int8_t *)xmalloc(in_bytes);
+    s->weights = (int8_t *)xmalloc((size_t)l->cout * depth);
+    s->ref = (int8_t *)xmalloc(s->out_bytes);
+    s->out = (int8_t *)xmalloc(s->out_bytes);
+    s->bias = (int32_t *)xmalloc((size_t)l->cout * sizeof(int32_t));
+    s->mult = (int32_t *)xmalloc((size_t)l->cout * sizeof(int32_t));
+    s->shift = (int32_t *)xmalloc((size_t)l->cout * sizeof(int32_t));
+
+    for (size_t i = 0; i < in_bytes; i++) s->input[i] = (int8_t)nn_rand_range(-128, 127);
+    for (int32_t i = 0; i < l->cout * depth; i++) s->weights[i] = (int8_t)nn_rand_range(-127, 127);
+    for (int32_t c = 0; c < l->cout; c++) {
+        s->bias[c] = nn_rand_range(-2000, 2000);
+        nn_quantize_multiplier(40.0 / acc_rms * (0.7 + 0.6 * nn_rand_range(0, 1000) / 1000.0), &s->mult[c],
+                               &s->shift[c]);
+    }
+
+    s->conv.input_offset = -in_zp;
+    s->conv.output_offset = out_zp;
+    s->conv.stride.h = l->stride_h;
+    s->conv.stride.w = l->stride_w;
+    s->conv.padding.h = l->pad_h;
+    s->conv.padding.w = l->pad_w;
+    s->conv.dilation.h = s->conv.dilation.w = 1;
+    s->conv.activation.min = out_zp;        // ReLU
+    s->conv.activation.max = 127;
+    s->conv_q.multiplier = s->mult;
+    s->conv_q.shift = s->shift;
+
+    s->fc.input_offset = -in_zp;
+    s->fc.filter_offset = 0;
+    s->fc.output_offset = out_zp;
+    s->fc.activation.min = -128;
+    s->fc.activation.max = 127;
+    s->fc_q.multiplier = s->mult[0];
+    s->fc_q.shift = s->shift[0];
+}
+
+static void setup_free(setup_t *s)
+{
+    free(s->input);
+    free(s->weights);
+    free(s->ref);
+    free(s->out);
+    free(s->bias);
+    free(s->mult);
+    free(s->shift);
+}
+
+static uint64_t setup_macs(const setup_t *s)
+{
+    const layer_t *l = s->l;
+
+    return (uint64_t)s->out_dims.n * s->out_dims.h * s->out_dims.w * l->cout * l->kh * l->kw * l->cin;
+}
+
+/* ============================================
+   Runs
+   ============================================ */
+
+// Plain kernel into ref
+static arm_status run_plain(setup_t *s, cmsis_nn_context *ctx)
+{
+    if (s->l->fc) {
+        return arm_fully_connected_s8(ctx, &s->fc, &s->fc_q, &s->in_dims, s->input, &s->filter_dims, s->weights,
+                                      &s->bias_dims, s->bias, &s->out_dims, s->ref);
+    }
+    return arm_convolve_wrapper_s8(ctx, &s->conv, &s->conv_q, &s->in_dims, s->input, &s->filter_dims, s->weights,
+                                   &s->bias_dims, s->bias, &s->out_dims, s->ref);
+}
+
+// Threaded layer into out
+static arm_status run_parallel(setup_t *s, uint32_t threads, cmsis_nn_context *ctx)
+{
+    if (s->l->fc) {
+        return bh_nn_parallel_fc_s8(threads, ctx, &s->fc, &s->fc_q, &s->in_dims, s->input, &s->filter_dims,
+                                    s->weights, &s->bias_dims, s->bias, &s->out_dims, s->out);
+    }
+    return bh_nn_parallel_conv_s8(threads, ctx, &s->conv, &s->conv_q, &s->in_dims, s->input, &s->filter_dims,
+                                  s->weights, &s->bias_dims, s->bias, &s->out_dims, s->out);
+}
+
+static int32_t buffer_size(const setup_t *s, uint32_t threads)
+{
+    if (threads == 0U) {
+        return s->l->fc ? arm_fully_connected_s8_get_buffer_size(&s->filter_dims)
+                        : arm_convolve_wrapper_s8_get_buffer_size(&s->conv, &s->in_dims, &s->filter_dims,
+                                                                  &s->out_dims);
+    }
+    return s->l->fc ? bh_nn_parallel_fc_s8_get_buffer_size(threads, &s->filter_dims)
+                    : bh_nn_parallel_conv_s8_get_buffer_size(threads, &s->conv, &s->in_dims, &s->filter_dims,
+                                                             &s->out_dims);
+}
+
+// Wall time of one call, ms; threads 0 times the plain kernel
+static double time_layer(setup_t *s, uint32_t threads, double min_ms)
+{
+    cmsis_nn_context ctx;
+    uint32_t reps = 1U;
+    double elapsed;
+
+    ctx.size = buffer_size(s, threads);
+    ctx.buf = xmalloc((size_t)ctx.size);
+    for (;;) {
+        double t0 = now_ms();
+        for (uint32_t r = 0; r < reps; r++) {
+            if (threads == 0U) run_plain(s, &ctx);
+            else run_parallel(s, threads, &ctx);
+        }
+        elapsed = now_ms() - t0;
+        if (elapsed >= min_ms || reps >= (1U << 24)) break;
+        reps = (elapsed > 0.0 && min_ms / elapsed < 64.0) ? (uint32_t)(reps * (min_ms / elapsed) * 1.1) + 1U
+                                                          : reps * 64U;
+    }
+    free(ctx.buf);
+    return elapsed / reps;
+}
+
+// Every thread count against the plain kernel, returns the number of mismatching runs
+static uint32_t check_layer(setup_t *s)
+{
+    cmsis_nn_context ctx;
+    uint32_t bad = 0;
+
+    ctx.size = buffer_size(s, 0U);
+    ctx.buf = xmalloc((size_t)ctx.size);
+    run_plain(s, &ctx);
+    free(ctx.buf);
+
+    for (uint32_t t = 1U; t <= CHECK_THREADS; t++) {
+        ctx.size = buffer_size(s, t);
+        ctx.buf = xmalloc((size_t)ctx.size);
+        memset(s->out, 0x5A, s->out_bytes);
+        if (run_parallel(s, t, &ctx) != ARM_MATH_SUCCESS || memcmp(s->out, s->ref, s->out_bytes) != 0) {
+            fprintf(stderr, "MISMATCH %s batch %d threads %u\n", s->l->name, (int)s->in_dims.n, t);
+            bad++;
+        }
+        // One byte short must be refused
+        if (ctx.size > 0) {
+            ctx.size--;
+            if (run_parallel(s, t, &ctx) != ARM_MATH_ARGUMENT_ERROR) {
+                fprintf(stderr, "short context accepted: %s threads %u\n", s->l->name, t);
+                bad++;
+            }
+        }
+        free(ctx.buf);
+    }
+    return bad;
+}
+
+int main(int argc, char **argv)
+{
+    int32_t batches[MAX_BATCHES] = { 1, 16, 256 };
+    uint32_t num_batches = 3U;
+    uint32_t max_threads = bh_nn_parallel_threads(0U), cpus = max_threads;
+    double min_ms = 100.0;
+    uint32_t bad = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+            char *p = argv[++i];
+            num_batches = 0U;
+            while (*p != '\0' && num_batches < MAX_BATCHES) {
+                batches[num_batches] = (int32_t)strtol(p, &p, 0);
+                if (batches[num_batches] > 0) num_batches++;
+                if (*p == ',') p++;
+                else break;
+            }
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            max_threads = bh_nn_parallel_threads((uint32_t)strtoul(argv[++i], NULL, 0));
+            max_threads = max_threads > MAX_THREADS ? MAX_THREADS : max_threads;
+        } else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            min_ms = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            harness_rng = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (harness_rng == 0U) harness_rng = 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--batch N[,N...]] [--threads N] [--min-time MS] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (num_batches == 0U) {
+        fprintf(stderr, "no batch size\n");
+        return 2;
+    }
+
+    max_threads = max_threads > MAX_THREADS ? MAX_THREADS : max_threads;
+    printf("online CPUs: %u, timing 1..%u threads\n\n", cpus, max_threads);
+    printf("%-30s %6s %10s %8s", "layer", "batch", "MMAC", "plain");
+    for (uint32_t t = 1U; t <= max_threads; t++) printf("   %2u thr (x)   ", t);
+    printf("\n");
+
+    for (uint32_t b = 0; b < num_batches; b++) {
+        for (uint32_t l = 0; l < NUM_LAYERS; l++) {
+            setup_t s;
+            double plain;
+
+            setup_init(&s, &layers[l], batches[b]);
+            bad += check_layer(&s);
+
+            // Times per batch item, us
+            plain = time_layer(&s, 0U, min_ms) * 1e3 / batches[b];
+            printf("%-30s %6d %10.2f %8.1f", layers[l].name, (int)batches[b], (double)setup_macs(&s) * 1e-6, plain);
+            for (uint32_t t = 1U; t <= max_threads; t++) {
+                double us = time_layer(&s, t, min_ms) * 1e3 / batches[b];
+                times[b][l][t] = us;
+                printf(" %8.1f (%4.2f)", us, plain / us);
+            }
+            printf("\n");
+            fflush(stdout);
+            setup_free(&s);
+        }
+    }
+
+    printf("\nus per batch item; (x) speedup over the plain kernel\n");
+
+    // Speedup and efficiency over one thread; "all" is the whole table run layer after layer
+    printf("\nscaling over 1 thread: speedup (efficiency)\n");
+    printf("%-30s %6s", "layer", "batch");
+    for (uint32_t t = 1U; t <= max_threads; t++) printf("    %2u thr      ", t);
+    printf("\n");
+    for (uint32_t b = 0; b < num_batches; b++) {
+        for (uint32_t l = 0; l <= NUM_LAYERS; l++) {
+            double one = 0.0;
+
+            for (uint32_t k = 0; k < NUM_LAYERS; k++) one += (l == NUM_LAYERS || k == l) ? times[b][k][1] : 0.0;
+            printf("%-30s %6d", l < NUM_LAYERS ? layers[l].name : "all", (int)batches[b]);
+            for (uint32_t t = 1U; t <= max_threads; t++) {
+                double us = 0.0;
+
+                for (uint32_t k = 0; k < NUM_LAYERS; k++) us += (l == NUM_LAYERS || k == l) ? times[b][k][t] : 0.0;
+                printf("  %5.2f (%3.0f%%)  ", one / us, 100.0 * one / us / t);
+            }
+            printf("\n");
+        }
+    }
+    if (max_threads > cpus) {
+        printf("only %u online CPU(s): above %u thread(s) the parts share cores, so this is not a scaling result\n",
+               cpus, cpus);
+    }
+    printf("bit-exact check, 1..%u threads: %s\n", CHECK_THREADS, bad ? "FAILED" : "ok");
+    return bad ? 1 : 0;
+}
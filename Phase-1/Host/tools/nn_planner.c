@@ -0,0 +1,543 @@
+/* nn_planner.c
+ *
+ * Offline activation memory planner for BHNN models (bh_nn_graph).
+ *
+ * Computes the lifetime of every activation tensor, merges the in-place
+ * layers (RELU6, ADD and RESHAPE write over an input that dies there, the
+ * same rule bh_nn_graph_init() applies), and assigns each buffer an offset
+ * in one activation region so that no two buffers that are live at the
+ * same time overlap. Several greedy orders are tried; a branch and bound
+ * over placement orders then either proves one of them optimal or finds a
+ * smaller plan. Placing buffers first-fit in order of their offsets in any
+ * valid plan never makes that plan bigger, so searching the orders covers
+ * the optimum. The lower bound is the largest sum of buffers live at one
+ * layer.
+ *
+ * The scratch size is the largest *_get_buffer_size() of all layers for the
+ * target: the host build runs the plain C kernels, whose depthwise and
+ * average pooling need no scratch, so for --target m4 (default) the
+ * Cortex-M4 (ARM_MATH_DSP) sizes of those two are used instead.
+ *
+ * Writes a C header with the offsets and the exact arena size for
+ * bh_nn_graph_init_planned(), so the firmware does no planning or sizing:
+ *
+ *     #include "dscnn_plan.h"
+ *     static uint8_t nn_mem[DSCNN_ARENA_BYTES];
+ *     bh_arena_init(&arena, nn_mem, sizeof(nn_mem));
+ *     bh_nn_graph_init_planned(&g, &arena, model, model_size, &dscnn_plan);
+ *
+ * The plan is checked for overlaps, then the model is run on the host with
+ * the plan and with the runtime planner on random inputs (bit-exact).
+ *
+ *   nn_planner [--net dscnn|mixed|cnn|cnn_unfused] [--model PATH] [--out HEADER] [--name NAME]
+ *              [--target m4|host] [--no-inplace] [--nodes N] [--runs N]
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bh_arena.h"
+#include "bh_nn_graph.h"
+#include "nn_model.h"
+
+#define ALIGN(x)        (((x) + BH_ARENA_ALIGN - 1U) & ~(BH_ARENA_ALIGN - 1U))
+
+typedef struct {
+    const bh_nn_graph_t *g;
+    uint32_t num;               // Buffers (group roots)
+    uint16_t *tensor;           // Root tensor of each buffer
+    uint32_t *bytes;            // Aligned size
+    int32_t *first, *last;      // Lifetime in layers
+    uint8_t *conflict;          // num x num, lifetimes intersect
+} plan_t;
+
+/* ============================================
+   Placement
+   ============================================ */
+
+// Lowest offset for buffer b that clears every placed, conflicting buffer
+static uint32_t first_fit(const plan_t *p, const uint32_t *offset, const uint8_t *placed, uint32_t b)
+{
+    uint32_t candidate = 0, moved = 1;
+
+    while (moved) {
+        moved = 0;
+        for (uint32_t j = 0; j < p->num; j++) {
+            if (!placed[j] || !p->conflict[b * p->num + j]) continue;
+            if (candidate < offset[j] + p->bytes[j] && offset[j] < candidate + p->bytes[b]) {
+                candidate = offset[j] + p->bytes[j];
+                moved = 1;
+            }
+        }
+    }
+    return candidate;
+}
+
+// First-fit in the given order; returns the region size
+static uint32_t place_order(const plan_t *p, const uint32_t *order, uint32_t *offset)
+{
+    uint8_t *placed = (uint8_t *)calloc(p->num, 1);
+    uint32_t total = 0;
+
+    for (uint32_t i = 0; i < p->num; i++) {
+        uint32_t b = order[i];
+        offset[b] = first_fit(p, offset, placed, b);
+        placed[b] = 1;
+        if (offset[b] + p->bytes[b] > total) total = offset[b] + p->bytes[b];
+    }
+    free(placed);
+    return total;
+}
+
+typedef int (*order_cmp)(const plan_t *p, uint32_t a, uint32_t b);
+
+static int by_size(const plan_t *p, uint32_t a, uint32_t b)
+{
+    return p->bytes[a] > p->bytes[b];
+}
+
+static int by_length(const plan_t *p, uint32_t a, uint32_t b)
+{
+    return (p->last[a] - p->first[a]) > (p->last[b] - p->first[b]) ||
+           ((p->last[a] - p->first[a]) == (p->last[b] - p->first[b]) && p->bytes[a] > p->bytes[b]);
+}
+
+static int by_area(const plan_t *p, uint32_t a, uint32_t b)
+{
+    return (uint64_t)p->bytes[a] * (uint64_t)(p->last[a] - p->first[a] + 1) >
+           (uint64_t)p->bytes[b] * (uint64_t)(p->last[b] - p->first[b] + 1);
+}
+
+static int by_first_use(const plan_t *p, uint32_t a, uint32_t b)
+{
+    return p->first[a] < p->first[b];
+}
+
+// Largest sum of buffers live during one layer
+static uint32_t lower_bound(const plan_t *p)
+{
+    uint32_t best = 0;
+
+    for (int32_t l = -1; l <= (int32_t)p->g->header->num_layers; l++) {
+        uint32_t live = 0;
+        for (uint32_t b = 0; b < p->num; b++) {
+            if (p->first[b] <= l && l <= p->last[b]) live += p->bytes[b];
+        }
+        if (live > best) best = live;
+    }
+    return best;
+}
+
+/* ============================================
+   Branch and bound over placement orders
+   ============================================ */
+
+typedef struct {
+    const plan_t *p;
+    uint32_t *offset;
+    uint8_t *placed;
+    uint32_t *best_offset;
+    uint32_t best;
+    uint32_t bound;
+    uint64_t nodes;
+    uint64_t max_nodes;
+} search_t;
+
+// Only orders with non-decreasing offsets are expanded (ties by index):
+// re-placing any plan first-fit in offset order reaches such an order.
+static void search(search_t *s, uint32_t depth, uint32_t peak, uint32_t prev_off, uint32_t prev)
+{
+    const plan_t *p = s->p;
+
+    if (s->nodes >= s->max_nodes || s->best == s->bound) return;
+    s->nodes++;
+    if (depth == p->num) {
+        if (peak < s->best) {
+            s->best = peak;
+            memcpy(s->best_offset, s->offset, p->num * sizeof(uint32_t));
+        }
+        return;
+    }
+
+    for (uint32_t b = 0; b < p->num; b++) {
+        if (s->placed[b]) continue;
+
+        uint32_t off = first_fit(p, s->offset, s->placed, b);
+        uint32_t end = off + p->bytes[b];
+
+        if (depth > 0U && (off < prev_off || (off == prev_off && b < prev))) continue;
+        if ((end > peak ? end : peak) >= s->best) continue;
+
+        s->offset[b] = off;
+        s->placed[b] = 1;
+        search(s, depth + 1, end > peak ? end : peak, off, b);
+        s->placed[b] = 0;
+    }
+}
+
+/* ============================================
+   Scratch per target
+   ============================================ */
+
+static int32_t layer_scratch(const bh_nn_graph_t *g, uint32_t l, int m4)
+{
+    const bh_nn_layer_t *layer = &g->layers[l];
+    const cmsis_nn_dims *in = &g->tensors[layer->inputs[0]].dims;
+    const cmsis_nn_dims *out = &g->tensors[layer->output].dims;
+    int32_t host = bh_nn_graph_layer_scratch(g, l);
+
+    if (!m4) return host;
+
+    switch (layer->op) {
+    case BH_NN_OP_DW_CONV: {
+        // arm_depthwise_conv_s8_opt_get_buffer_size() with ARM_MATH_DSP
+        const cmsis_nn_dims *f = &g->tensors[layer->inputs[1]].dims;
+        if (in->c == out->c && in->n == 1 && layer->params[6] == 1 && layer->params[7] == 1) {
+            return in->c * f->w * f->h * (int32_t)sizeof(int16_t);
+        }
+        return host;
+    }
+    case BH_NN_OP_AVGPOOL:
+        // arm_avgpool_s8_get_buffer_size() with ARM_MATH_DSP
+        return in->c * (int32_t)sizeof(int32_t);
+    case BH_NN_OP_CONV_PACKED: {
+        // arm_convolve_packed_s8_get_buffer_size() with ARM_MATH_DSP: two q15
+        // columns, plus an s8 staging column when C_IN is not a multiple of 4
+        int32_t cols = g->tensors[layer->inputs[1]].dims.c;
+        return 2 * cols * (int32_t)sizeof(int16_t) + ((in->c & 3) ? cols : 0);
+    }
+    default:
+        return host;
+    }
+}
+
+/* ============================================
+   Header output
+   ============================================ */
+
+static void write_header(FILE *f, const bh_nn_graph_t *g, const char *name, const char *source,
+                         const uint32_t *offset, const int32_t *first, const int32_t *last, const uint16_t *root,
+                         uint32_t activation, uint32_t bound, uint32_t scratch, uint32_t state, const char *target)
+{
+    char upper[64];
+    const bh_nn_header_t *h = g->header;
+    size_t i;
+
+    for (i = 0; name[i] != '\0' && i + 1 < sizeof(upper); i++) upper[i] = (char)toupper((unsigned char)name[i]);
+    upper[i] = '\0';
+
+    fprintf(f, "/* %s_plan.h\n *\n", name);
+    fprintf(f, " * Memory plan of %s (%u-byte BHNN model, %u tensors, %u layers) for\n", source, h->size,
+            h->num_tensors, h->num_layers);
+    fprintf(f, " * bh_nn_graph_init_planned(). Generated by Host/tools/nn_planner, do not edit.\n *\n");
+    fprintf(f, " * Activations %u bytes (lower bound %u), scratch %u bytes for the %s,\n", activation, bound,
+            scratch, target);
+    fprintf(f, " * state %u bytes.\n */\n\n", state);
+    fprintf(f, "#ifndef %s_PLAN_H\n#define %s_PLAN_H\n\n#include \"bh_nn_graph.h\"\n\n", upper, upper);
+    fprintf(f, "#define %s_NUM_TENSORS       %uU\n", upper, h->num_tensors);
+    fprintf(f, "#define %s_NUM_LAYERS        %uU\n", upper, h->num_layers);
+    fprintf(f, "#define %s_ACTIVATION_BYTES  %uU\n", upper, activation);
+    fprintf(f, "#define %s_SCRATCH_BYTES     %uU\n", upper, scratch);
+    fprintf(f, "#define %s_STATE_BYTES       %uU\n", upper, state);
+    fprintf(f, "#define %s_ARENA_BYTES       \\\n", upper);
+    fprintf(f, "    BH_NN_ARENA_BYTES(%s_NUM_TENSORS, %s_NUM_LAYERS, %s_ACTIVATION_BYTES, %s_SCRATCH_BYTES, \\\n",
+            upper, upper, upper, upper);
+    fprintf(f, "                      %s_STATE_BYTES)\n\n", upper);
+
+    fprintf(f, "// Offset in the activation or state region, per tensor\n");
+    fprintf(f, "static const uint32_t %s_offsets[%s_NUM_TENSORS] = {\n", name, upper);
+    for (uint32_t t = 0; t < h->num_tensors; t++) {
+        const bh_nn_tensor_t *tensor = &g->tensors[t];
+        const cmsis_nn_dims *d = &tensor->dims;
+        char value[20];
+
+        if (tensor->kind == BH_NN_CONST) {
+            snprintf(value, sizeof(value), "BH_NN_NO_OFFSET,");
+        } else {
+            snprintf(value, sizeof(value), "%u,", offset[t]);
+        }
+        fprintf(f, "    %-16s  // %3u ", value, t);
+        if (tensor->kind == BH_NN_CONST) {
+            fprintf(f, "const\n");
+        } else if (tensor->kind == BH_NN_STATE) {
+            fprintf(f, "state %dx%dx%dx%d\n", (int)d->n, (int)d->h, (int)d->w, (int)d->c);
+        } else {
+            int32_t r = root[t];
+            fprintf(f, "%dx%dx%dx%d, layers %d..%d", (int)d->n, (int)d->h, (int)d->w, (int)d->c, (int)first[r],
+                    (int)last[r]);
+            if (r != (int32_t)t) fprintf(f, ", in place of %d", (int)r);
+            fprintf(f, "\n");
+        }
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "static const bh_nn_plan_t %s_plan = {\n", name);
+    fprintf(f, "    %s_NUM_TENSORS, %s_NUM_LAYERS,\n", upper, upper);
+    fprintf(f, "    %s_ACTIVATION_BYTES, %s_SCRATCH_BYTES, %s_STATE_BYTES,\n", upper, upper, upper);
+    fprintf(f, "    %s_offsets\n};\n\n#endif /* %s_PLAN_H */\n", name, upper);
+}
+
+/* ============================================
+   Host check
+   ============================================ */
+
+// Runs the planned and the runtime-planned graph side by side; returns mismatching runs or -1
+static int check_plan(const uint8_t *blob, uint32_t size, const bh_nn_plan_t *plan, uint32_t runs)
+{
+    size_t bytes = BH_NN_ARENA_BYTES(plan->num_tensors, plan->num_layers, plan->activation_bytes,
+                                     plan->scratch_bytes, plan->state_bytes);
+    uint8_t *mem_a = (uint8_t *)malloc(bytes + 1U), *mem_b = (uint8_t *)malloc(1U << 20);
+    bh_arena_t arena_a, arena_b;
+    bh_nn_graph_t a, b;
+    int bad = 0;
+
+    // Odd start: the arena size must cover a misaligned buffer too
+    bh_arena_init(&arena_a, mem_a + 1, bytes);
+    bh_arena_init(&arena_b, mem_b, 1U << 20);
+    if (bh_nn_graph_init_planned(&a, &arena_a, blob, size, plan) != ARM_MATH_SUCCESS ||
+        bh_nn_graph_init(&b, &arena_b, blob, size) != ARM_MATH_SUCCESS) {
+        bad = -1;
+    }
+    for (uint32_t r = 0; r < runs && bad >= 0; r++) {
+        int8_t *xa = bh_nn_graph_input(&a), *xb = bh_nn_graph_input(&b);
+        for (uint32_t i = 0; i < bh_nn_graph_input_bytes(&a); i++) xa[i] = xb[i] = nn_rand_s8();
+        if (bh_nn_graph_invoke(&a) != ARM_MATH_SUCCESS || bh_nn_graph_invoke(&b) != ARM_MATH_SUCCESS ||
+            memcmp(bh_nn_graph_output(&a), bh_nn_graph_output(&b), bh_nn_graph_output_bytes(&a)) != 0) {
+            bad++;
+        }
+    }
+    free(mem_a);
+    free(mem_b);
+    return bad;
+}
+
+int main(int argc, char **argv)
+{
+    const char *net = "dscnn", *model_path = NULL, *out_path = NULL, *name = NULL, *target = "m4";
+    uint32_t size = 0, runs = 100, inplace = 1;
+    uint64_t max_nodes = 2000000;
+    uint8_t *blob;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--net") == 0 && i + 1 < argc) {
+            net = argv[++i];
+        } else if (strcmp(argv[i], "--model") == 0 && i + 1 < argc) {
+            model_path = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "--name") == 0 && i + 1 < argc) {
+            name = argv[++i];
+        } else if (strcmp(argv[i], "--target") == 0 && i + 1 < argc) {
+            target = argv[++i];
+        } else if (strcmp(argv[i], "--no-inplace") == 0) {
+            inplace = 0;
+        } else if (strcmp(argv[i], "--nodes") == 0 && i + 1 < argc) {
+            max_nodes = strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+            runs = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else {
+            fprintf(stderr, "usage: %s [--net dscnn|mixed|cnn|cnn_unfused] [--model PATH] [--out HEADER]\n"
+                            "       [--name NAME] [--target m4|host] [--no-inplace] [--nodes N] [--runs N]\n", argv[0]);
+            return 2;
+        }
+    }
+    int m4 = strcmp(target, "m4") == 0;
+    if (!m4 && strcmp(target, "host") != 0) {
+        fprintf(stderr, "unknown target %s\n", target);
+        return 2;
+    }
+
+    if (model_path != NULL) {
+        if ((blob = nn_model_read(model_path, &size)) == NULL) return 1;
+    } else if ((blob = nn_model_build(net, 1, &size)) == NULL) {
+        fprintf(stderr, "unknown net %s\n", net);
+        return 2;
+    }
+    if (name == NULL) name = (model_path != NULL) ? "model" : net;
+
+    bh_nn_graph_t g;
+    if (bh_nn_graph_load(&g, blob, size) != ARM_MATH_SUCCESS) {
+        fprintf(stderr, "%s: not a valid BHNN model\n", model_path ? model_path : net);
+        return 1;
+    }
+    const bh_nn_header_t *h = g.header;
+    uint32_t nt = h->num_tensors;
+
+    // Lifetimes and in-place groups (the runtime's rule)
+    int32_t *first = (int32_t *)malloc(nt * sizeof(int32_t));
+    int32_t *last = (int32_t *)malloc(nt * sizeof(int32_t));
+    uint16_t *root = (uint16_t *)malloc(nt * sizeof(uint16_t));
+    bh_nn_graph_lifetimes(&g, first, last, root);
+    if (!inplace) {
+        // Undo the merging: every tensor its own buffer with its own lifetime
+        for (uint32_t t = 0; t < nt; t++) root[t] = (uint16_t)t;
+        for (uint32_t t = 0; t < nt; t++) {
+            if (g.tensors[t].kind != BH_NN_ACTIVATION) continue;
+            first[t] = (t == h->input) ? -1 : (int32_t)h->num_layers;
+            last[t] = (t == h->output) ? (int32_t)h->num_layers : -1;
+            for (uint32_t l = 0; l < h->num_layers; l++) {
+                uint32_t used = g.layers[l].output == t;
+                for (uint32_t k = 0; k < g.layers[l].num_inputs; k++) used |= g.layers[l].inputs[k] == t;
+                if (used && (int32_t)l < first[t]) first[t] = (int32_t)l;
+                if (used && (int32_t)l > last[t]) last[t] = (int32_t)l;
+            }
+        }
+    }
+
+    plan_t p;
+    p.g = &g;
+    p.num = 0;
+    p.tensor = (uint16_t *)malloc(nt * sizeof(uint16_t));
+    p.bytes = (uint32_t *)malloc(nt * sizeof(uint32_t));
+    p.first = (int32_t *)malloc(nt * sizeof(int32_t));
+    p.last = (int32_t *)malloc(nt * sizeof(int32_t));
+    uint32_t naive = 0, merged = 0;
+    for (uint32_t t = 0; t < nt; t++) {
+        if (g.tensors[t].kind != BH_NN_ACTIVATION) continue;
+        naive += ALIGN(bh_nn_tensor_bytes(&g.tensors[t]));
+        if (root[t] != t) {
+            merged++;
+            continue;
+        }
+        p.tensor[p.num] = (uint16_t)t;
+        p.bytes[p.num] = ALIGN(bh_nn_tensor_bytes(&g.tensors[t]));
+        p.first[p.num] = first[t];
+        p.last[p.num] = last[t];
+        p.num++;
+    }
+    p.conflict = (uint8_t *)malloc((size_t)p.num * p.num);
+    for (uint32_t a = 0; a < p.num; a++) {
+        for (uint32_t b = 0; b < p.num; b++) {
+            p.conflict[a * p.num + b] = a != b && !(p.first[a] > p.last[b] || p.first[b] > p.last[a]);
+        }
+    }
+
+    // Greedy orders
+    static const struct {
+        const char *name;
+        order_cmp cmp;
+    } orders[] = {
+        { "greedy by size", by_size },
+        { "greedy by lifetime", by_length },
+        { "greedy by size x lifetime", by_area },
+        { "greedy by first use", by_first_use },
+    };
+    uint32_t *order = (uint32_t *)malloc(p.num * sizeof(uint32_t));
+    uint32_t *offset = (uint32_t *)malloc(p.num * sizeof(uint32_t));
+    uint32_t *best_offset = (uint32_t *)malloc(p.num * sizeof(uint32_t));
+    uint32_t bound = lower_bound(&p), best = UINT32_MAX;
+    const char *best_name = "";
+
+    printf("model %s: %u tensors, %u layers, %u activation buffers (%u tensors in place)\n",
+           model_path ? model_path : net, nt, h->num_layers, p.num, merged);
+    printf("  %-28s %8u bytes\n", "one buffer per tensor", naive);
+    printf("  %-28s %8u bytes\n", "lower bound (peak live)", bound);
+    for (size_t k = 0; k < sizeof(orders) / sizeof(orders[0]); k++) {
+        for (uint32_t i = 0; i < p.num; i++) {
+            uint32_t pos = i;
+            while (pos > 0U && orders[k].cmp(&p, i, order[pos - 1U])) {
+                order[pos] = order[pos - 1U];
+                pos--;
+            }
+            order[pos] = i;
+        }
+        uint32_t total = place_order(&p, order, offset);
+        printf("  %-28s %8u bytes\n", orders[k].name, total);
+        if (total < best) {
+            best = total;
+            best_name = orders[k].name;
+            memcpy(best_offset, offset, p.num * sizeof(uint32_t));
+        }
+    }
+
+    // Exact search, seeded with the best greedy plan
+    search_t s;
+    s.p = &p;
+    s.offset = offset;
+    s.placed = (uint8_t *)calloc(p.num, 1);
+    s.best_offset = best_offset;
+    s.best = best;
+    s.bound = bound;
+    s.nodes = 0;
+    s.max_nodes = max_nodes;
+    search(&s, 0, 0, 0, 0);
+    int proved = s.best == bound || s.nodes < max_nodes;
+    if (s.best < best) best_name = "branch and bound";
+    best = s.best;
+    printf("  %-28s %8u bytes (%llu nodes, %s)\n", "branch and bound", best, (unsigned long long)s.nodes,
+           proved ? "optimal" : "node limit, best found");
+    printf("plan: %s, %u bytes\n", best_name, best);
+
+    // Per-tensor offsets, overlap check against the raw lifetimes
+    uint32_t *tensor_offset = (uint32_t *)malloc(nt * sizeof(uint32_t));
+    uint32_t state = 0;
+    for (uint32_t t = 0; t < nt; t++) tensor_offset[t] = BH_NN_NO_OFFSET;
+    for (uint32_t b = 0; b < p.num; b++) tensor_offset[p.tensor[b]] = best_offset[b];
+    for (uint32_t t = 0; t < nt; t++) {
+        if (g.tensors[t].kind == BH_NN_ACTIVATION) tensor_offset[t] = tensor_offset[root[t]];
+        if (g.tensors[t].kind == BH_NN_STATE) {
+            tensor_offset[t] = state;
+            state += ALIGN(bh_nn_tensor_bytes(&g.tensors[t]));
+        }
+    }
+    for (uint32_t a = 0; a < p.num; a++) {
+        for (uint32_t b = 0; b < p.num; b++) {
+            if (p.conflict[a * p.num + b] && best_offset[a] < best_offset[b] + p.bytes[b] &&
+                best_offset[b] < best_offset[a] + p.bytes[a]) {
+                fprintf(stderr, "FAIL: tensors %u and %u overlap\n", p.tensor[a], p.tensor[b]);
+                return 1;
+            }
+        }
+    }
+
+    // Scratch for the target
+    uint32_t scratch = 0;
+    for (uint32_t l = 0; l < h->num_layers; l++) {
+        int32_t need = layer_scratch(&g, l, m4);
+        if (need > (int32_t)scratch) scratch = (uint32_t)need;
+    }
+
+    bh_nn_plan_t plan = { (uint16_t)nt, h->num_layers, best, scratch, state, tensor_offset };
+    printf("scratch %u bytes (%s), state %u bytes, arena %u bytes on this host\n", scratch,
+           m4 ? "Cortex-M4, ARM_MATH_DSP" : "host build", state,
+           (uint32_t)BH_NN_ARENA_BYTES(nt, h->num_layers, best, scratch, state));
+
+    int bad = check_plan(blob, size, &plan, runs);
+    if (bad != 0) {
+        fprintf(stderr, "FAIL: planned graph %s\n", bad < 0 ? "refused by bh_nn_graph_init_planned" : "differs");
+        return 1;
+    }
+    printf("host check: %u runs bit-exact with the runtime planner\n", runs);
+
+    if (out_path != NULL) {
+        FILE *f = fopen(out_path, "w");
+        if (f == NULL) {
+            perror(out_path);
+            return 1;
+        }
+        write_header(f, &g, name, model_path ? model_path : net, tensor_offset, first, last, root, best, bound,
+                     scratch, state, m4 ? "Cortex-M4" : "host");
+        if (fclose(f) != 0) {
+            perror(out_path);
+            return 1;
+        }
+        printf("wrote %s\n", out_path);
+    }
+
+    free(tensor_offset);
+    free(s.placed);
+    free(order);
+    free(offset);
+    free(best_offset);
+    free(p.conflict);
+    free(p.tensor);
+    free(p.bytes);
+    free(p.first);
+    free(p.last);
+    free(first);
+    free(last);
+    free(root);
+    free(blob);
+    return 0;
+}
@@ -0,0 +1,647 @@
+/* nn_profile.c
+ *
+ * Per-layer profile and accuracy drift of a quantized model run through
+ * bh_nn_graph: where the cycles go and where the int8 arithmetic loses
+ * the signal.
+ *
+ * For every layer it reports the static cost (MACs, bytes of weights and
+ * activations moved, from bh_nn_graph_layer_cost), the measured cycles,
+ * statistics of the int8 output (range, mean, spread, share of elements
+ * stuck at -128 / 127) and two signal-to-noise ratios against a float
+ * reference of the same layer:
+ *
+ *   local  the layer recomputed in double from the int8 inputs the graph
+ *          gave it: the error this layer adds (requantization, int8
+ *          storage, fixed-point pooling, softmax or add);
+ *   drift  a float model run alongside, layer by layer from the same
+ *          input, never rounded: the error accumulated up to this layer.
+ *
+ * The reference works in the LSB units of each tensor. Scales are not
+ * stored in a BHNN model, but every ratio the layer applies is: a conv
+ * output is out_offset + M * acc with M = mult * 2^(shift - 31), the float
+ * reference just skips the rounding, so any model file can be checked.
+ * Signal power is measured about each tensor's zero point; the activation
+ * clamp (ReLU, ReLU6) is part of the float layer, saturation outside it
+ * is error. A layer with low local SNR wants more precision (int16
+ * activations, per-channel scales); one with many cycles per MAC wants a
+ * better kernel.
+ *
+ *   nn_profile [--net dscnn|mixed|cnn|cnn_unfused] [--model PATH] [--runs N] [--seed N]
+ *              [--csv PATH]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+#include "bh_arena.h"
+#include "bh_nn_graph.h"
+#include "nn_model.h"
+
+#define ARENA_BYTES     (256U * 1024U)
+
+static uint8_t arena_mem[ARENA_BYTES] __attribute__((aligned(16)));
+
+typedef struct {
+    double signal;              // Sum of (reference - zero point)^2
+    double noise;               // Sum of (int8 - reference)^2
+    double max_err;
+} snr_t;
+
+typedef struct {
+    const bh_nn_graph_t *g;
+    int32_t *zp;                // Per tensor, activations only
+    int8_t **q;                 // Per activation tensor: int8 output as the graph made it
+    double **f;                 // Per activation tensor: drift reference
+    double **state;             // Per state tensor: drift reference of the SVDF history
+    double *tmp_in[2];          // Local reference inputs
+    double *tmp_out;
+    snr_t *local;               // Per layer
+    snr_t *drift;
+} profile_t;
+
+/* ============================================
+   Float Reference (LSB units of each tensor)
+   ============================================ */
+
+// Real multiplier of a CMSIS-NN (mult, shift) pair
+static double real_mult(int32_t mult, int32_t shift)
+{
+    return (double)mult * ldexp(1.0, shift - 31);
+}
+
+static double clampd(double v, double lo, double hi)
+{
+    return (v < lo) ? lo : (v > hi) ? hi : v;
+}
+
+static uint32_t elements(const cmsis_nn_dims *d)
+{
+    return (uint32_t)(d->n * d->h * d->w * d->c);
+}
+
+// Bias of row r; a packed layer has the kernel sum bias + input_offset * sum(w) instead
+static double ref_bias(const bh_nn_graph_t *g, const bh_nn_layer_t *l, int32_t r, const int8_t *row, int32_t depth)
+{
+    const int32_t *bias = (const int32_t *)g->data[l->inputs[2]];
+    double b = (bias != NULL) ? bias[r] : 0.0;
+
+    if (l->op == BH_NN_OP_CONV_PACKED || l->op == BH_NN_OP_FC_PACKED) {
+        for (int32_t d = 0; d < depth; d++) b -= (double)l->params[0] * row[d];
+    }
+    return b;
+}
+
+// Fused 2x2 stride 2 pooling of a conv output x of dims cd
+static void ref_pool_2x2(const cmsis_nn_dims *cd, const double *x, int average, double *y)
+{
+    for (int32_t n = 0; n < cd->n; n++) {
+        for (int32_t oy = 0; oy < cd->h / 2; oy++) {
+            for (int32_t ox = 0; ox < cd->w / 2; ox++) {
+                for (int32_t c = 0; c < cd->c; c++) {
+                    const double *px = x + ((n * cd->h + 2 * oy) * cd->w + 2 * ox) * cd->c + c;
+                    double a = px[0], b = px[cd->c], d = px[cd->w * cd->c], e = px[(cd->w + 1) * cd->c];
+                    *y++ = average ? (a + b + d + e) / 4.0 : fmax(fmax(a, b), fmax(d, e));
+                }
+            }
+        }
+    }
+}
+
+static void ref_conv(const bh_nn_graph_t *g, const bh_nn_layer_t *l, const double *x, double *y, int depthwise)
+{
+    const cmsis_nn_dims *id = &g->tensors[l->inputs[0]].dims;
+    cmsis_nn_dims conv = g->tensors[l->output].dims;
+    const cmsis_nn_dims *od = &conv;
+    double *out = y;
+    const cmsis_nn_dims *fd = &g->tensors[l->inputs[1]].dims;
+    const int8_t *w = (const int8_t *)g->data[l->inputs[1]];
+    const int32_t *mult = (const int32_t *)g->data[l->inputs[3]];
+    const int32_t *shift = (const int32_t *)g->data[l->inputs[4]];
+    const int32_t *p = l->params;
+    int32_t ch_mult = depthwise ? p[10] : 1;
+    int32_t kh = fd->h, kw = fd->w, cin = fd->c, row = fd->h * fd->w * fd->c;
+
+    // Packed filter: {Cout, 1, 1, padded depth}, kernel size in the params
+    if (l->op == BH_NN_OP_CONV_PACKED) {
+        kh = p[10];
+        kw = p[11];
+        cin = id->c;
+        row = fd->c;
+    }
+
+    // Fused pooling: the conv rows and columns its windows cover, pooled at the end
+    if (l->op == BH_NN_OP_CONV_POOL) {
+        conv.h *= 2;
+        conv.w *= 2;
+        y = (double *)malloc(elements(&conv) * sizeof(double));
+    }
+
+    for (int32_t n = 0; n < od->n; n++) {
+        for (int32_t oy = 0; oy < od->h; oy++) {
+            for (int32_t ox = 0; ox < od->w; ox++) {
+                for (int32_t c = 0; c < od->c; c++) {
+                    double acc = depthwise ? ref_bias(g, l, c, NULL, 0) : ref_bias(g, l, c, w + c * row, row);
+
+                    for (int32_t ky = 0; ky < kh; ky++) {
+                        int32_t iy = oy * p[3] - p[5] + ky * p[7];
+                        if (iy < 0 || iy >= id->h) continue;
+                        for (int32_t kx = 0; kx < kw; kx++) {
+                            int32_t ix = ox * p[2] - p[4] + kx * p[6];
+                            if (ix < 0 || ix >= id->w) continue;
+                            const double *px = x + ((n * id->h + iy) * id->w + ix) * id->c;
+                            if (depthwise) {
+                                acc += (px[c / ch_mult] + p[0]) * w[(ky * kw + kx) * fd->c + c];
+                            } else {
+                                const int8_t *pw = w + c * row + (ky * kw + kx) * cin;
+                                for (int32_t ci = 0; ci < cin; ci++) acc += (px[ci] + p[0]) * pw[ci];
+                            }
+                        }
+                    }
+                    y[((n * od->h + oy) * od->w + ox) * od->c + c] =
+                        clampd(p[1] + real_mult(mult[c], shift[c]) * acc, p[8], p[9]);
+                }
+            }
+        }
+    }
+    if (y != out) {
+        ref_pool_2x2(&conv, y, p[10] == BH_NN_OP_AVGPOOL, out);
+        free(y);
+    }
+}
+
+static void ref_fc(const bh_nn_graph_t *g, const bh_nn_layer_t *l, const double *x, double *y)
+{
+    const cmsis_nn_dims *od = &g->tensors[l->output].dims;
+    int32_t depth = g->tensors[l->inputs[1]].dims.n, row = depth;
+    const int8_t *w = (const int8_t *)g->data[l->inputs[1]];
+    const int32_t *p = l->params;
+    double m = real_mult(p[5], p[6]);
+
+    // Packed filter: one padded row per unit
+    if (l->op == BH_NN_OP_FC_PACKED) {
+        depth = (int32_t)(elements(&g->tensors[l->inputs[0]].dims) / (uint32_t)od->n);
+        row = g->tensors[l->inputs[1]].dims.c;
+    }
+
+    for (int32_t n = 0; n < od->n; n++) {
+        for (int32_t u = 0; u < od->c; u++) {
+            double acc = ref_bias(g, l, u, w + u * row, row);
+            for (int32_t d = 0; d < depth; d++) acc += (x[n * depth + d] + p[0]) * (w[u * row + d] + p[1]);
+            y[n * od->c + u] = clampd(p[2] + m * acc, p[3], p[4]);
+        }
+    }
+}
+
+static void ref_pool(const bh_nn_graph_t *g, const bh_nn_layer_t *l, const double *x, double *y)
+{
+    const cmsis_nn_dims *id = &g->tensors[l->inputs[0]].dims, *od = &g->tensors[l->output].dims;
+    const int32_t *p = l->params;
+
+    for (int32_t n = 0; n < od->n; n++) {
+        for (int32_t oy = 0; oy < od->h; oy++) {
+            for (int32_t ox = 0; ox < od->w; ox++) {
+                for (int32_t c = 0; c < od->c; c++) {
+                    double sum = 0.0, best = -1e300;
+                    int32_t count = 0;
+
+                    for (int32_t ky = 0; ky < p[7]; ky++) {
+                        int32_t iy = oy * p[1] - p[3] + ky;
+                        if (iy < 0 || iy >= id->h) continue;
+                        for (int32_t kx = 0; kx < p[6]; kx++) {
+                            int32_t ix = ox * p[0] - p[2] + kx;
+                            if (ix < 0 || ix >= id->w) continue;
+                            double v = x[((n * id->h + iy) * id->w + ix) * id->c + c];
+                            sum += v;
+                            if (v > best) best = v;
+                            count++;
+                        }
+                    }
+                    double v = (l->op == BH_NN_OP_AVGPOOL) ? sum / (count ? count : 1) : best;
+                    y[((n * od->h + oy) * od->w + ox) * od->c + c] = clampd(v, p[4], p[5]);
+                }
+            }
+        }
+    }
+}
+
+static void ref_softmax(const bh_nn_graph_t *g, const bh_nn_layer_t *l, const double *x, double *y)
+{
+    const cmsis_nn_dims *d = &g->tensors[l->output].dims;
+    int32_t rows = d->n * d->h * d->w;
+    double scale = real_mult(l->params[0], l->params[1]) / (double)(1LL << 26);
+
+    for (int32_t r = 0; r < rows; r++) {
+        const double *xr = x + r * d->c;
+        double top = xr[0], sum = 0.0;
+
+        for (int32_t c = 1; c < d->c; c++) top = fmax(top, xr[c]);
+        for (int32_t c = 0; c < d->c; c++) sum += exp(scale * (xr[c] - top));
+        // Output scale 1/256, zero point -128
+        for (int32_t c = 0; c < d->c; c++) {
+            y[r * d->c + c] = clampd(256.0 * exp(scale * (xr[c] - top)) / sum - 128.0, -128.0, 127.0);
+        }
+    }
+}
+
+static void ref_add(const bh_nn_graph_t *g, const bh_nn_layer_t *l, const double *a, const double *b, double *y)
+{
+    const int32_t *p = l->params;
+    uint32_t n = elements(&g->tensors[l->output].dims);
+    double ma = real_mult(p[1], p[2]), mb = real_mult(p[4], p[5]);
+    double mo = real_mult(p[8], p[9]) * ldexp(1.0, p[6]);
+
+    for (uint32_t i = 0; i < n; i++) {
+        y[i] = clampd(p[7] + mo * (ma * (a[i] + p[0]) + mb * (b[i] + p[3])), p[10], p[11]);
+    }
+}
+
+// state: batches x filters x memory; shift: 0 when the history is already
+// shifted (local reference on the graph's own state)
+static void ref_svdf(const bh_nn_graph_t *g, const bh_nn_layer_t *l, const double *x, double *state, int shift,
+                     double *y)
+{
+    const cmsis_nn_dims *od = &g->tensors[l->output].dims;
+    const cmsis_nn_dims *wfd = &g->tensors[l->inputs[2]].dims, *wtd = &g->tensors[l->inputs[3]].dims;
+    const int8_t *wf = (const int8_t *)g->data[l->inputs[2]];
+    const int8_t *wt = (const int8_t *)g->data[l->inputs[3]];
+    const int32_t *bias = (const int32_t *)g->data[l->inputs[4]];
+    const int32_t *p = l->params;
+    int32_t filters = wfd->n, size = wfd->c, memory = wtd->h, rank = p[0];
+    double m_in = real_mult(p[7], p[8]), m_out = real_mult(p[9], p[10]);
+
+    for (int32_t n = 0; n < od->n; n++) {
+        double *s = state + n * filters * memory;
+
+        for (int32_t f = 0; f < filters; f++) {
+            double acc = 0.0;
+
+            if (shift) memmove(s + f * memory, s + f * memory + 1, (size_t)(memory - 1) * sizeof(double));
+            for (int32_t i = 0; i < size; i++) acc += (x[n * size + i] - p[1]) * wf[f * size + i];
+            s[f * memory + memory - 1] = clampd(m_in * acc, p[3], p[4]);
+        }
+        for (int32_t u = 0; u < od->c; u++) {
+            double acc = (bias != NULL) ? bias[u] : 0.0;
+            for (int32_t r = 0; r < rank; r++) {
+                int32_t f = u * rank + r;
+                for (int32_t t = 0; t < memory; t++) acc += wt[f * memory + t] * s[f * memory + t];
+            }
+            y[n * od->c + u] = clampd(p[2] + m_out * acc, p[5], p[6]);
+        }
+    }
+}
+
+// One layer on float inputs; state NULL for layers without history
+static void ref_layer(const bh_nn_graph_t *g, uint32_t layer, double *const *in, double *state, int shift,
+                      double *y)
+{
+    const bh_nn_layer_t *l = &g->layers[layer];
+    uint32_t n = elements(&g->tensors[l->output].dims);
+
+    switch (l->op) {
+    case BH_NN_OP_CONV:
+    case BH_NN_OP_CONV_PACKED:
+    case BH_NN_OP_CONV_POOL:
+        ref_conv(g, l, in[0], y, 0);
+        break;
+    case BH_NN_OP_DW_CONV:
+        ref_conv(g, l, in[0], y, 1);
+        break;
+    case BH_NN_OP_FC:
+    case BH_NN_OP_FC_PACKED:
+        ref_fc(g, l, in[0], y);
+        break;
+    case BH_NN_OP_AVGPOOL:
+    case BH_NN_OP_MAXPOOL:
+        ref_pool(g, l, in[0], y);
+        break;
+    case BH_NN_OP_SOFTMAX:
+        ref_softmax(g, l, in[0], y);
+        break;
+    case BH_NN_OP_ADD:
+        ref_add(g, l, in[0], in[1], y);
+        break;
+    case BH_NN_OP_RELU6:
+        for (uint32_t i = 0; i < n; i++) y[i] = clampd(in[0][i], 0.0, 6.0);
+        break;
+    case BH_NN_OP_RESHAPE:
+        memcpy(y, in[0], n * sizeof(double));
+        break;
+    case BH_NN_OP_SVDF:
+        ref_svdf(g, l, in[0], state, shift, y);
+        break;
+    default:
+        break;
+    }
+}
+
+/* ============================================
+   Zero Points
+   ============================================ */
+
+// Output zero point of each activation tensor from its producer, the
+// graph input's from the offset its first consumer applies
+static void find_zero_points(const bh_nn_graph_t *g, int32_t *zp)
+{
+    const bh_nn_header_t *h = g->header;
+
+    memset(zp, 0, h->num_tensors * sizeof(int32_t));
+    for (uint32_t k = 0; k < h->num_layers; k++) {
+        const bh_nn_layer_t *l = &g->layers[k];
+        const int32_t *p = l->params;
+
+        if (l->inputs[0] == h->input) {
+            switch (l->op) {
+            case BH_NN_OP_CONV:
+            case BH_NN_OP_DW_CONV:
+            case BH_NN_OP_FC:
+            case BH_NN_OP_CONV_PACKED:
+            case BH_NN_OP_FC_PACKED:
+            case BH_NN_OP_CONV_POOL:
+            case BH_NN_OP_ADD:
+                zp[h->input] = -p[0];
+                break;
+            case BH_NN_OP_SVDF:
+                zp[h->input] = p[1];
+                break;
+            default:
+                break;
+            }
+        }
+        switch (l->op) {
+        case BH_NN_OP_CONV:
+        case BH_NN_OP_DW_CONV:
+        case BH_NN_OP_CONV_PACKED:
+        case BH_NN_OP_CONV_POOL:
+            zp[l->output] = p[1];
+            break;
+        case BH_NN_OP_FC:
+        case BH_NN_OP_FC_PACKED:
+        case BH_NN_OP_SVDF:
+            zp[l->output] = p[2];
+            break;
+        case BH_NN_OP_SOFTMAX:
+            zp[l->output] = -128;
+            break;
+        case BH_NN_OP_ADD:
+            zp[l->output] = p[7];
+            break;
+        default:
+            zp[l->output] = zp[l->inputs[0]];
+            break;
+        }
+    }
+}
+
+/* ============================================
+   Layer Hook
+   ============================================ */
+
+static void snr_add(snr_t *s, const int8_t *q, const double *ref, uint32_t n, int32_t zp)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        double e = (double)q[i] - ref[i];
+        s->signal += (ref[i] - zp) * (ref[i] - zp);
+        s->noise += e * e;
+        if (fabs(e) > s->max_err) s->max_err = fabs(e);
+    }
+}
+
+static double snr_db(const snr_t *s)
+{
+    if (s->noise <= 0.0) return INFINITY;
+    return 10.0 * log10(s->signal / s->noise);
+}
+
+static void profile_hook(void *ctx, const bh_nn_graph_t *g, uint32_t layer)
+{
+    profile_t *P = (profile_t *)ctx;
+    const bh_nn_layer_t *l = &g->layers[layer];
+    uint32_t out = l->output;
+    uint32_t n = elements(&g->tensors[out].dims);
+    uint32_t num_act = (l->op == BH_NN_OP_ADD) ? 2U : 1U;
+    double *drift_in[2] = { NULL, NULL };
+    double *local_state = NULL, *drift_state = NULL;
+
+    memcpy(P->q[out], g->data[out], n);
+
+    // Local: the graph's own int8 inputs (copies, in-place layers overwrote them)
+    for (uint32_t k = 0; k < num_act; k++) {
+        uint32_t t = l->inputs[k];
+        uint32_t m = elements(&g->tensors[t].dims);
+        for (uint32_t i = 0; i < m; i++) P->tmp_in[k][i] = P->q[t][i];
+        drift_in[k] = P->f[t];
+    }
+    if (l->op == BH_NN_OP_SVDF) {
+        // The graph state is already shifted; its newest column is replaced by the float one
+        uint32_t s = l->inputs[1];
+        uint32_t m = elements(&g->tensors[s].dims);
+        const int8_t *gs = (const int8_t *)g->data[s];
+
+        local_state = (double *)malloc(m * sizeof(double));
+        for (uint32_t i = 0; i < m; i++) local_state[i] = gs[i];
+        drift_state = P->state[s];
+    }
+    ref_layer(g, layer, P->tmp_in, local_state, 0, P->tmp_out);
+    snr_add(&P->local[layer], P->q[out], P->tmp_out, n, P->zp[out]);
+    free(local_state);
+
+    // Drift: float inputs from the float model
+    ref_layer(g, layer, drift_in, drift_state, 1, P->f[out]);
+    snr_add(&P->drift[layer], P->q[out], P->f[out], n, P->zp[out]);
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    const char *net = "dscnn", *model_path = NULL, *csv_path = NULL;
+    uint32_t runs = 50, seed = 1, size = 0;
+    uint8_t *blob;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--net") == 0 && i + 1 < argc) {
+            net = argv[++i];
+        } else if (strcmp(argv[i], "--model") == 0 && i + 1 < argc) {
+            model_path = argv[++i];
+        } else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+            runs = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--net dscnn|mixed|cnn|cnn_unfused] [--model PATH] [--runs N] [--seed N]\n"
+                            "       [--csv PATH]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (runs == 0U) runs = 1U;
+
+    if (model_path != NULL) {
+        if ((blob = nn_model_read(model_path, &size)) == NULL) return 1;
+        net = model_path;
+    } else if ((blob = nn_model_build(net, seed, &size)) == NULL) {
+        fprintf(stderr, "unknown net %s\n", net);
+        return 2;
+    }
+
+    bh_arena_t arena;
+    bh_nn_graph_t g;
+    arm_status st;
+
+    bh_arena_init(&arena, arena_mem, ARENA_BYTES);
+    st = bh_nn_graph_init(&g, &arena, blob, size);
+    if (st != ARM_MATH_SUCCESS) {
+        fprintf(stderr, "%s: bh_nn_graph_init failed (%d)\n", net, (int)st);
+        return 1;
+    }
+
+    const bh_nn_header_t *h = g.header;
+    uint32_t num_tensors = h->num_tensors, num_layers = h->num_layers;
+    uint32_t largest = 0;
+    profile_t P;
+
+    memset(&P, 0, sizeof(P));
+    P.g = &g;
+    P.zp = (int32_t *)calloc(num_tensors, sizeof(int32_t));
+    P.q = (int8_t **)calloc(num_tensors, sizeof(int8_t *));
+    P.f = (double **)calloc(num_tensors, sizeof(double *));
+    P.state = (double **)calloc(num_tensors, sizeof(double *));
+    P.local = (snr_t *)calloc(num_layers, sizeof(snr_t));
+    P.drift = (snr_t *)calloc(num_layers, sizeof(snr_t));
+    for (uint32_t t = 0; t < num_tensors; t++) {
+        uint32_t n = elements(&g.tensors[t].dims);
+
+        if (g.tensors[t].kind == BH_NN_ACTIVATION) {
+            P.q[t] = (int8_t *)calloc(n, 1);
+            P.f[t] = (double *)calloc(n, sizeof(double));
+            if (n > largest) largest = n;
+        } else if (g.tensors[t].kind == BH_NN_STATE) {
+            P.state[t] = (double *)calloc(n, sizeof(double));
+        }
+    }
+    P.tmp_in[0] = (double *)calloc(largest, sizeof(double));
+    P.tmp_in[1] = (double *)calloc(largest, sizeof(double));
+    P.tmp_out = (double *)calloc(largest, sizeof(double));
+    find_zero_points(&g, P.zp);
+
+    bh_nn_output_stats_t *outputs = (bh_nn_output_stats_t *)calloc(num_layers, sizeof(bh_nn_output_stats_t));
+    uint32_t in_bytes = bh_nn_graph_input_bytes(&g);
+
+    // Cycles without the hook first: the float reference would evict the caches
+    for (uint32_t r = 0; r < runs; r++) {
+        int8_t *x = bh_nn_graph_input(&g);
+        for (uint32_t i = 0; i < in_bytes; i++) x[i] = nn_rand_s8();
+        bh_nn_graph_invoke(&g);
+    }
+
+    // Then statistics and references, from a cleared history
+    bh_nn_graph_reset_state(&g);
+    bh_nn_graph_set_output_stats(&g, outputs);
+    bh_nn_graph_set_hook(&g, profile_hook, &P);
+    for (uint32_t r = 0; r < runs; r++) {
+        int8_t *x = bh_nn_graph_input(&g);
+        for (uint32_t i = 0; i < in_bytes; i++) {
+            x[i] = nn_rand_s8();
+            P.q[h->input][i] = x[i];
+            P.f[h->input][i] = x[i];
+        }
+        if (bh_nn_graph_invoke(&g) != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "invoke failed\n");
+            return 1;
+        }
+    }
+
+    FILE *csv = NULL;
+    if (csv_path != NULL && (csv = fopen(csv_path, "w")) == NULL) {
+        perror(csv_path);
+        return 1;
+    }
+    if (csv != NULL) {
+        fprintf(csv, "layer,op,output,macs,weight_bytes,input_bytes,output_bytes,cycles,min,max,mean,std,"
+                     "at_min_pct,at_max_pct,snr_local_db,snr_drift_db,max_err_lsb\n");
+    }
+
+    printf("model %s, %u layers, %u runs (cycles: bh_cycles ticks, traffic: weights + inputs + outputs)\n\n", net,
+           num_layers, runs);
+    printf("layer op       output          MACs   traffic    cycles  MAC/cyc   min  max    mean   std"
+           "  @-128  @127  local dB  drift dB\n");
+
+    uint64_t total_cycles = 0, total_macs = 0, total_traffic = 0;
+    uint32_t worst_local = 0, worst_cycles = 0;
+    for (uint32_t l = 0; l < num_layers; l++) {
+        if (snr_db(&P.local[l]) < snr_db(&P.local[worst_local])) worst_local = l;
+        if (bh_nn_graph_layer_cycles(&g, l) > bh_nn_graph_layer_cycles(&g, worst_cycles)) worst_cycles = l;
+    }
+
+    for (uint32_t l = 0; l < num_layers; l++) {
+        const bh_nn_layer_t *layer = &g.layers[l];
+        const cmsis_nn_dims *d = &g.tensors[layer->output].dims;
+        const bh_nn_output_stats_t *o = &outputs[l];
+        bh_nn_layer_cost_t cost;
+        uint32_t cycles = bh_nn_graph_layer_cycles(&g, l);
+        uint32_t traffic;
+        double mean, std;
+        char shape[32];
+
+        bh_nn_graph_layer_cost(&g, l, &cost);
+        traffic = cost.weight_bytes + cost.input_bytes + cost.output_bytes;
+        mean = (double)o->sum / (double)o->count;
+        std = sqrt(fmax((double)o->sum_sq / (double)o->count - mean * mean, 0.0));
+        total_cycles += cycles;
+        total_macs += cost.macs;
+        total_traffic += traffic;
+
+        snprintf(shape, sizeof(shape), "%dx%dx%dx%d", (int)d->n, (int)d->h, (int)d->w, (int)d->c);
+        printf("%5u %-8s %-12s %8llu %9u %9u %8.2f  %4d %4d %7.1f %5.1f %5.1f%% %4.1f%% %9.1f %9.1f%s\n", l,
+               bh_nn_op_name(layer->op), shape, (unsigned long long)cost.macs, traffic, cycles,
+               cycles ? (double)cost.macs / cycles : 0.0, o->min, o->max, mean, std,
+               100.0 * o->at_min / (double)o->count, 100.0 * o->at_max / (double)o->count, snr_db(&P.local[l]),
+               snr_db(&P.drift[l]),
+               (l == worst_local && l == worst_cycles) ? "  <- lowest SNR, most cycles"
+               : (l == worst_local)                    ? "  <- lowest SNR"
+               : (l == worst_cycles)                   ? "  <- most cycles"
+                                                       : "");
+        if (csv != NULL) {
+            fprintf(csv, "%u,%s,%s,%llu,%u,%u,%u,%u,%d,%d,%.3f,%.3f,%.3f,%.3f,%.2f,%.2f,%.3f\n", l,
+                    bh_nn_op_name(layer->op), shape, (unsigned long long)cost.macs, cost.weight_bytes,
+                    cost.input_bytes, cost.output_bytes, cycles, o->min, o->max, mean, std,
+                    100.0 * o->at_min / (double)o->count, 100.0 * o->at_max / (double)o->count,
+                    snr_db(&P.local[l]), snr_db(&P.drift[l]), P.local[l].max_err);
+        }
+    }
+    printf("total                       %10llu %9llu %9llu %8.2f\n", (unsigned long long)total_macs,
+           (unsigned long long)total_traffic, (unsigned long long)total_cycles,
+           total_cycles ? (double)total_macs / (double)total_cycles : 0.0);
+    printf("\nlocal: this layer from the graph's int8 inputs; drift: float model from the same input\n");
+    uint32_t worst_err = 0;
+    for (uint32_t l = 1; l < num_layers; l++) {
+        if (P.local[l].max_err > P.local[worst_err].max_err) worst_err = l;
+    }
+    printf("output SNR %.1f dB, largest local error %.2f LSB (layer %u)\n", snr_db(&P.drift[num_layers - 1U]),
+           P.local[worst_err].max_err, worst_err);
+
+    if (csv != NULL) fclose(csv);
+    for (uint32_t t = 0; t < num_tensors; t++) {
+        free(P.q[t]);
+        free(P.f[t]);
+        free(P.state[t]);
+    }
+    free(P.q);
+    free(P.f);
+    free(P.state);
+    free(P.zp);
+    free(P.tmp_in[0]);
+    free(P.tmp_in[1]);
+    free(P.tmp_out);
+    free(P.local);
+    free(P.drift);
+    free(outputs);
+    free(blob);
+    return 0;
+}
@@ -0,0 +1,244 @@
+/* nn_stream_harness.c
+ *
+ * Streaming (incremental) temporal convolution: arm_convolve_1_x_n_stream_s8
+ * against recomputing the whole window every hop.
+ *
+ * A stack of 1xN convolutions over MFCC frames (time along W, coefficients
+ * as channels, a TC-ResNet style keyword spotter front) gets one new frame
+ * per hop. The reference keeps the last W frames and runs every layer over
+ * the whole window with arm_convolve_1_x_n_s8, as a stateless model has to;
+ * the streaming stack feeds the new frame through one ring per layer and
+ * computes only the output columns it completes. After the receptive field
+ * has filled, every streamed column must equal the newest column of the
+ * reference bit for bit. Reports MACs and cycles per hop of both.
+ *
+ *   nn_stream_harness [--hops N] [--window W] [--seed N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+#include "bh_cycles.h"
+#include "nn_model.h"
+
+#define NUM_LAYERS      4
+#define MFCC            10
+
+typedef struct {
+    int32_t cin, cout, k, stride, relu;
+    int8_t *w;
+    int32_t *bias, *mult, *shift;
+    int32_t in_zp, out_zp;
+} layer_t;
+
+// 10 -> 32 -> 48 -> 64 channels, the last with stride 2
+static layer_t layers[NUM_LAYERS] = {
+    { MFCC, 32, 6, 1, 1, NULL, NULL, NULL, NULL, 0, 0 },
+    { 32,   48, 9, 1, 1, NULL, NULL, NULL, NULL, 0, 0 },
+    { 48,   64, 9, 1, 0, NULL, NULL, NULL, NULL, 0, 0 },
+    { 64,   64, 6, 2, 1, NULL, NULL, NULL, NULL, 0, 0 },
+};
+
+// Random weights; per-channel multipliers put the outputs at ~40 LSB RMS
+static void layer_init(layer_t *l, int32_t in_zp)
+{
+    int32_t depth = l->k * l->cin;
+
+    l->w = (int8_t *)malloc((size_t)l->cout * depth);
+    l->bias = (int32_t *)malloc((size_t)l->cout * sizeof(int32_t));
+    l->mult = (int32_t *)malloc((size_t)l->cout * sizeof(int32_t));
+    l->shift = (int32_t *)malloc((size_t)l->cout * sizeof(int32_t));
+    l->in_zp = in_zp;
+    l->out_zp = nn_rand_range(-20, 20);
+
+    for (int32_t i = 0; i < l->cout * depth; i++) l->w[i] = (int8_t)nn_rand_range(-127, 127);
+    for (int32_t c = 0; c < l->cout; c++) {
+        double acc_rms = sqrt((double)depth) * 73.0 * 45.0;
+        l->bias[c] = nn_rand_range(-2000, 2000);
+        nn_quantize_multiplier(40.0 / acc_rms * (0.7 + 0.6 * nn_rand_range(0, 1000) / 1000.0), &l->mult[c],
+                               &l->shift[c]);
+    }
+}
+
+static void layer_params(const layer_t *l, cmsis_nn_conv_params *p, cmsis_nn_per_channel_quant_params *q,
+                         cmsis_nn_dims *filter)
+{
+    memset(p, 0, sizeof(*p));
+    p->input_offset = -l->in_zp;
+    p->output_offset = l->out_zp;
+    p->stride.w = l->stride;
+    p->stride.h = 1;
+    p->dilation.w = 1;
+    p->dilation.h = 1;
+    p->activation.min = l->relu ? l->out_zp : -128;
+    p->activation.max = 127;
+    q->multiplier = l->mult;
+    q->shift = l->shift;
+    *filter = (cmsis_nn_dims){ l->cout, 1, l->k, l->cin };
+}
+
+int main(int argc, char **argv)
+{
+    int32_t hops = 3000, window = 49, seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--hops") == 0 && i + 1 < argc) {
+            hops = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--window") == 0 && i + 1 < argc) {
+            window = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [--hops N] [--window W] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+    harness_rng ^= (uint32_t)seed * 0x9E3779B9U;
+    bh_cycles_init();
+
+    // Window width at every layer; the full-window kernel wants multiples of 4
+    int32_t width[NUM_LAYERS + 1], receptive = 1, step = 1;
+    width[0] = window;
+    for (int l = 0; l < NUM_LAYERS; l++) {
+        width[l + 1] = (width[l] - layers[l].k) / layers[l].stride + 1;
+        if (width[l + 1] < 1 || width[l + 1] % 4 != 0 || (width[l] - layers[l].k) % layers[l].stride != 0) {
+            fprintf(stderr, "window %d: layer %d output width %d, need a positive multiple of 4 "
+                            "ending on the newest column\n", window, l, width[l + 1]);
+            return 2;
+        }
+        receptive += (layers[l].k - 1) * step;
+        step *= layers[l].stride;
+    }
+
+    int32_t zp = nn_rand_range(-30, 30), scratch_bytes = 0;
+    for (int l = 0; l < NUM_LAYERS; l++) {
+        layer_init(&layers[l], zp);
+        zp = layers[l].out_zp;
+        cmsis_nn_dims in = { 1, 1, width[l], layers[l].cin }, f = { layers[l].cout, 1, layers[l].k, layers[l].cin };
+        int32_t b = arm_convolve_1_x_n_s8_get_buffer_size(&in, &f);
+        if (b > scratch_bytes) scratch_bytes = b;
+    }
+
+    // Reference: one buffer per layer output, the window of frames
+    int8_t *act[NUM_LAYERS + 1];
+    for (int l = 0; l <= NUM_LAYERS; l++) {
+        int32_t c = (l == 0) ? MFCC : layers[l - 1].cout;
+        act[l] = (int8_t *)malloc((size_t)width[l] * c);
+    }
+    memset(act[0], -layers[0].in_zp, (size_t)window * MFCC);
+    cmsis_nn_context ctx = { malloc((size_t)scratch_bytes + 1U), scratch_bytes };
+
+    // Streaming: a ring per layer, one output column per layer at most
+    cmsis_nn_conv_stream_state state[NUM_LAYERS];
+    int8_t *col[NUM_LAYERS + 1];
+    int32_t state_bytes = 0;
+    col[0] = (int8_t *)malloc(MFCC);
+    for (int l = 0; l < NUM_LAYERS; l++) {
+        cmsis_nn_conv_params p;
+        cmsis_nn_per_channel_quant_params q;
+        cmsis_nn_dims in = { 1, 1, 1, layers[l].cin }, f;
+        int32_t bytes;
+
+        layer_params(&layers[l], &p, &q, &f);
+        bytes = arm_convolve_1_x_n_stream_s8_get_state_size(&in, &f);
+        state_bytes += bytes;
+        state[l].buf = (int8_t *)malloc((size_t)bytes);
+        arm_convolve_1_x_n_stream_s8_reset(&state[l], &p, &in, &f);
+        col[l + 1] = (int8_t *)malloc((size_t)layers[l].cout);
+    }
+
+    uint64_t ref_cycles[NUM_LAYERS] = { 0 }, str_cycles[NUM_LAYERS] = { 0 };
+    uint64_t ref_macs[NUM_LAYERS] = { 0 }, str_macs[NUM_LAYERS] = { 0 };
+    uint32_t checked[NUM_LAYERS] = { 0 }, mismatches = 0;
+
+    for (int32_t hop = 0; hop < hops; hop++) {
+        for (int32_t c = 0; c < MFCC; c++) col[0][c] = (int8_t)nn_rand_range(-128, 127);
+
+        // Reference: slide the window, recompute every layer over all of it
+        memmove(act[0], act[0] + MFCC, (size_t)(window - 1) * MFCC);
+        memcpy(act[0] + (window - 1) * MFCC, col[0], MFCC);
+        for (int l = 0; l < NUM_LAYERS; l++) {
+            cmsis_nn_conv_params p;
+            cmsis_nn_per_channel_quant_params q;
+            cmsis_nn_dims in = { 1, 1, width[l], layers[l].cin }, f, bias = { 1, 1, 1, layers[l].cout };
+            cmsis_nn_dims out = { 1, 1, width[l + 1], layers[l].cout };
+            uint32_t t0;
+
+            layer_params(&layers[l], &p, &q, &f);
+            t0 = bh_cycles_now();
+            if (arm_convolve_1_x_n_s8(&ctx, &p, &q, &in, act[l], &f, layers[l].w, &bias, layers[l].bias, &out,
+                                      act[l + 1]) != ARM_MATH_SUCCESS) {
+                fprintf(stderr, "arm_convolve_1_x_n_s8 failed at layer %d\n", l);
+                return 1;
+            }
+            ref_cycles[l] += bh_cycles_now() - t0;
+            ref_macs[l] += (uint64_t)width[l + 1] * layers[l].k * layers[l].cin * layers[l].cout;
+        }
+
+        // Streaming: push the new column down the stack while layers produce one
+        for (int l = 0; l < NUM_LAYERS; l++) {
+            cmsis_nn_conv_params p;
+            cmsis_nn_per_channel_quant_params q;
+            cmsis_nn_dims in = { 1, 1, 1, layers[l].cin }, f, bias = { 1, 1, 1, layers[l].cout };
+            cmsis_nn_dims out = { 1, 1, 1, layers[l].cout };
+            int32_t produced = 0;
+            uint32_t t0;
+
+            layer_params(&layers[l], &p, &q, &f);
+            t0 = bh_cycles_now();
+            arm_convolve_1_x_n_stream_s8(&state[l], &p, &q, &in, col[l], &f, layers[l].w, &bias, layers[l].bias,
+                                         &out, col[l + 1], &produced);
+            str_cycles[l] += bh_cycles_now() - t0;
+            str_macs[l] += (uint64_t)produced * layers[l].k * layers[l].cin * layers[l].cout;
+            if (produced == 0) break;
+
+            // The streamed column is the newest one of the window, once the history is real
+            if (hop >= receptive - 1) {
+                const int8_t *newest = act[l + 1] + (width[l + 1] - 1) * layers[l].cout;
+                checked[l]++;
+                if (memcmp(newest, col[l + 1], (size_t)layers[l].cout) != 0) {
+                    if (mismatches++ < 5) fprintf(stderr, "hop %d layer %d: streamed column differs\n", hop, l);
+                }
+            }
+        }
+    }
+
+    printf("# 1xN conv stack over %d-frame windows of %d MFCC, %d hops; receptive field %d frames\n", window, MFCC,
+           hops, receptive);
+    printf("# streaming state %d bytes; full window activations + scratch %d bytes\n", state_bytes,
+           (int)(window * MFCC + width[1] * 32 + width[2] * 48 + width[3] * 64 + width[4] * 64 + scratch_bytes));
+    printf("layer  shape              k  s   width   full MACs/hop  stream MACs/hop   full cyc/hop  stream cyc/hop"
+           "  speedup\n");
+    uint64_t rm = 0, sm = 0, rc = 0, sc = 0;
+    for (int l = 0; l < NUM_LAYERS; l++) {
+        printf("%5d  %3d -> %3d  %8s %2d %2d  %6d  %14.0f  %15.0f  %13.0f  %14.0f  %6.1fx\n", l, (int)layers[l].cin,
+               (int)layers[l].cout, layers[l].relu ? "relu" : "", (int)layers[l].k, (int)layers[l].stride,
+               (int)width[l + 1], (double)ref_macs[l] / hops, (double)str_macs[l] / hops,
+               (double)ref_cycles[l] / hops, (double)str_cycles[l] / hops,
+               (double)ref_cycles[l] / (double)(str_cycles[l] ? str_cycles[l] : 1));
+        rm += ref_macs[l];
+        sm += str_macs[l];
+        rc += ref_cycles[l];
+        sc += str_cycles[l];
+    }
+    printf("total                                  %14.0f  %15.0f  %13.0f  %14.0f  %6.1fx\n", (double)rm / hops,
+           (double)sm / hops, (double)rc / hops, (double)sc / hops, (double)rc / (double)(sc ? sc : 1));
+    printf("bit-exact vs full window: %u columns checked (", checked[0] + checked[1] + checked[2] + checked[3]);
+    for (int l = 0; l < NUM_LAYERS; l++) printf("%s%u", l ? "/" : "", checked[l]);
+    printf(" per layer), %u mismatches\n", mismatches);
+
+    for (int l = 0; l < NUM_LAYERS; l++) {
+        free(layers[l].w);
+        free(layers[l].bias);
+        free(layers[l].mult);
+        free(layers[l].shift);
+        free(state[l].buf);
+        free(col[l + 1]);
+    }
+    for (int l = 0; l <= NUM_LAYERS; l++) free(act[l]);
+    free(col[0]);
+    free(ctx.buf);
+    return mismatches ? 1 : 0;
+}
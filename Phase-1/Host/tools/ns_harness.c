@@ -0,0 +1,308 @@
+/* ns_harness.c
+ *
+ * Offline WAV-in / WAV-out benchmark for the spectral noise suppressor
+ * (arm_noise_suppress_f32 / arm_noise_suppress_q15).
+ *
+ * Runs the suppressor over a recording in 10 ms frames, the way the
+ * capture path calls it, and reports per second of audio the mean gain and
+ * the CPU time per 10 ms frame, plus the SNR before and after when the
+ * clean signal is known.
+ *
+ *   ns_harness [--in NOISY.wav [--clean CLEAN.wav]] [--out OUT.wav]
+ *              [--q15] [--floor-db DB] [--snr DB] [--csv PATH]
+ *
+ * Without --in a 12 s recording is synthesized at 16 kHz: talk spurts of
+ * voiced speech-like sound over fan noise (low-pass noise plus 100 Hz hum),
+ * starting after 0.5 s of noise (the suppressor takes the first 100 ms as
+ * noise), with the noise 6 dB louder from 8 s on to check that the noise
+ * floor follows.
+ * --snr sets the speech to noise ratio of the mix (default 5 dB).
+ *
+ * With the clean signal, SNR is clean power over the power of the
+ * difference between the output and the clean signal, delayed by the
+ * suppressor latency; it counts speech distortion as well as residual
+ * noise. Noise reduction is input over output power in the frames where
+ * the clean signal is silent.
+ *
+ * --q15 runs the Q15 suppressor, and the f32 one untimed alongside to report
+ * how far the Q15 output is from it. --floor-db sets the largest attenuation
+ * (default 18 dB). --csv writes one line per frame.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "arm_math.h"
+#include "bh_cycles.h"
+#include "harness_util.h"
+#include "wav_io.h"
+
+#define SYN_RATE        16000U
+#define SYN_SECONDS     12U
+#define SYN_STEP        8U          // noise 6 dB louder from here, in seconds
+#define HOP_MS          10U
+
+// Fan noise: one-pole low-passed white noise and a 100 Hz hum
+static void syn_noise(float *x, uint32_t len)
+{
+    float lp = 0.0f;
+
+    for (uint32_t n = 0; n < len; n++) {
+        lp = 0.9f * lp + 0.1f * syn_rand();
+        x[n] = lp + 0.02f * sinf(2.0f * (float)PI * 100.0f * n / SYN_RATE)
+             + 0.02f * syn_rand();
+        if (n >= SYN_STEP * SYN_RATE) x[n] *= 2.0f;
+    }
+}
+
+static double power(const float *x, uint32_t len)
+{
+    double p = 0.0;
+    for (uint32_t n = 0; n < len; n++) p += (double)x[n] * x[n];
+    return p;
+}
+
+// Power of a - b
+static double error_power(const float *a, const float *b, uint32_t len)
+{
+    double p = 0.0;
+    for (uint32_t n = 0; n < len; n++) p += (double)(a[n] - b[n]) * (a[n] - b[n]);
+    return p;
+}
+
+static double db(double num, double den)
+{
+    return 10.0 * log10((num + 1e-20) / (den + 1e-20));
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [--in NOISY.wav [--clean CLEAN.wav]] [--out OUT.wav]\n"
+                    "          [--q15] [--floor-db DB] [--snr DB] [--csv PATH]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    const char *in_path = NULL, *clean_path = NULL, *out_path = NULL, *csv_path = NULL;
+    uint32_t rate = SYN_RATE, len = 0;
+    float floor_db = 18.0f, snr_db = 5.0f;
+    int q15 = 0;
+    float *in, *clean = NULL, *out, *ref = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "--in") == 0) {
+            in_path = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "--clean") == 0) {
+            clean_path = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "--out") == 0) {
+            out_path = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "--csv") == 0) {
+            csv_path = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "--floor-db") == 0) {
+            floor_db = (float)atof(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--snr") == 0) {
+            snr_db = (float)atof(argv[++i]);
+        } else if (strcmp(argv[i], "--q15") == 0) {
+            q15 = 1;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (clean_path != NULL && in_path == NULL) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (in_path != NULL) {
+        uint32_t r2 = 0, n2 = 0;
+
+        in = wav_read(in_path, &rate, &len);
+        if (in == NULL) return 1;
+        if (clean_path != NULL) {
+            clean = wav_read(clean_path, &r2, &n2);
+            if (clean == NULL) return 1;
+            if (r2 != rate) {
+                fprintf(stderr, "sample rates differ: %u / %u\n", rate, r2);
+                return 1;
+            }
+            if (n2 < len) len = n2;
+        }
+    } else {
+        float *noise;
+        float peak = 0.0f, g;
+
+        len = SYN_RATE * SYN_SECONDS;
+        in = malloc(len * sizeof(float));
+        clean = malloc(len * sizeof(float));
+        noise = malloc(len * sizeof(float));
+        if (in == NULL || clean == NULL || noise == NULL) return 1;
+
+        syn_talker_voiced(clean, len, SYN_RATE, 1.6f, 0.5f);
+        syn_noise(noise, len);
+
+        // Set the SNR on the first part, then scale the mix to -6 dBFS peak
+        g = sqrtf((float)(power(clean, SYN_STEP * SYN_RATE) / power(noise, SYN_STEP * SYN_RATE)))
+          * powf(10.0f, -snr_db / 20.0f);
+        for (uint32_t n = 0; n < len; n++) {
+            in[n] = clean[n] + g * noise[n];
+            if (fabsf(in[n]) > peak) peak = fabsf(in[n]);
+        }
+        g = 0.5f / peak;
+        for (uint32_t n = 0; n < len; n++) {
+            in[n] *= g;
+            clean[n] *= g;
+        }
+        free(noise);
+    }
+
+    uint32_t hop = rate * HOP_MS / 1000U;
+    uint32_t frames = len / hop;
+    float gain_min = powf(10.0f, -floor_db / 20.0f);
+
+    arm_noise_suppress_instance_f32 ns;
+    arm_noise_suppress_instance_q15 ns_q15;
+    float32_t *state = NULL;
+    q31_t *state_q15 = NULL;
+    q15_t *buf_q15 = NULL;
+
+    out = malloc(len * sizeof(float));
+    state = malloc(ARM_NS_STATE_SIZE_F32(hop) * sizeof(float32_t));
+    if (out == NULL || state == NULL || hop > 2048U
+        || arm_noise_suppress_init_f32(&ns, (uint16_t)hop, rate, state) != ARM_MATH_SUCCESS) {
+        fprintf(stderr, "noise suppressor init failed (hop %u)\n", hop);
+        return 1;
+    }
+    ns.gainMin = gain_min;
+    if (q15) {
+        ref = malloc(len * sizeof(float));
+        state_q15 = malloc(ARM_NS_STATE_SIZE_Q15(hop) * sizeof(q31_t));
+        buf_q15 = malloc(hop * sizeof(q15_t));
+        if (ref == NULL || state_q15 == NULL || buf_q15 == NULL
+            || arm_noise_suppress_init_q15(&ns_q15, (uint16_t)hop, rate, state_q15) != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "noise suppressor init failed (hop %u)\n", hop);
+            return 1;
+        }
+        ns_q15.gainMin = (q15_t)__SSAT((q31_t)roundf(gain_min * 32768.0f), 16);
+    }
+
+    FILE *csv = NULL;
+    if (csv_path != NULL) {
+        csv = fopen(csv_path, "w");
+        if (csv == NULL) { perror(csv_path); return 1; }
+        fprintf(csv, "frame,time_s,mean_gain,ns,cycles\n");
+    }
+
+    bh_cycles_init();
+
+    printf("# %s, %u Hz, %s, hop %u (FFT %u), floor -%.0f dB\n",
+           in_path ? in_path : "synthetic", rate, q15 ? "q15" : "f32",
+           hop, ARM_NS_FFT_LEN(hop), floor_db);
+    printf("%6s %8s %10s %10s %10s %10s %8s\n",
+           "second", "gain", "in_snr", "out_snr", "us/frame", "max_us", "cpu_%");
+
+    double sec_gain = 0.0, sec_ns = 0.0, sec_max = 0.0, tot_ns = 0.0, tot_max = 0.0;
+    double sec_c = 0.0, sec_in = 0.0, sec_out = 0.0;
+    double all_c = 0.0, all_in = 0.0, all_out = 0.0, pause_in = 0.0, pause_out = 0.0;
+    double seg_in = 0.0, seg_out = 0.0;
+    uint32_t sec_frames = 0, seg_frames = 0;
+
+    for (uint32_t f = 0; f < frames; f++) {
+        const float *x = in + f * hop;
+        float *y = out + f * hop;
+        float mean_gain;
+
+        uint64_t t0 = now_ns();
+        uint32_t c0 = bh_cycles_now();
+        if (q15) {
+            arm_float_to_q15(x, buf_q15, hop);
+            arm_noise_suppress_q15(&ns_q15, buf_q15, buf_q15, hop);
+            arm_q15_to_float(buf_q15, y, hop);
+        } else {
+            arm_noise_suppress_f32(&ns, x, y, hop);
+        }
+        uint32_t cyc = bh_cycles_now() - c0;
+        double ns_frame = (double)(now_ns() - t0);
+
+        if (q15) {
+            arm_noise_suppress_f32(&ns, x, ref + f * hop, hop);
+            mean_gain = ns_q15.meanGain / 32768.0f;
+        } else {
+            mean_gain = ns.meanGain;
+        }
+
+        if (csv) {
+            fprintf(csv, "%u,%.2f,%.3f,%.0f,%u\n", f, (double)f * hop / rate, mean_gain, ns_frame, cyc);
+        }
+
+        // The output is late by one hop: compare frame f - 1 of the input
+        if (clean != NULL && f > 0U) {
+            const float *c = clean + (f - 1U) * hop, *xi = in + (f - 1U) * hop;
+            double pc = power(c, hop), pi = error_power(xi, c, hop), po = error_power(y, c, hop);
+
+            sec_c += pc;
+            sec_in += pi;
+            sec_out += po;
+            if (f * hop >= rate) {
+                all_c += pc;
+                all_in += pi;
+                all_out += po;
+                if (pc < 1e-9 * hop) {
+                    pause_in += power(xi, hop);
+                    pause_out += power(y, hop);
+                } else {
+                    // Segmental SNR, clamped to [-10, 35] dB as usual
+                    seg_in += fmin(fmax(db(pc, pi), -10.0), 35.0);
+                    seg_out += fmin(fmax(db(pc, po), -10.0), 35.0);
+                    seg_frames++;
+                }
+            }
+        }
+        sec_gain += mean_gain;
+        sec_ns += ns_frame;
+        tot_ns += ns_frame;
+        if (ns_frame > sec_max) sec_max = ns_frame;
+        if (ns_frame > tot_max) tot_max = ns_frame;
+
+        if (++sec_frames == 100U || f + 1U == frames) {
+            printf("%6u %8.2f ", (f * hop) / rate, sec_gain / sec_frames);
+            if (clean != NULL) printf("%10.1f %10.1f", db(sec_c, sec_in), db(sec_c, sec_out));
+            else printf("%10s %10s", "-", "-");
+            printf(" %10.1f %10.1f %8.2f\n", sec_ns / sec_frames / 1e3, sec_max / 1e3, sec_ns / sec_frames / 1e5);
+            sec_gain = sec_ns = sec_max = sec_c = sec_in = sec_out = 0.0;
+            sec_frames = 0;
+        }
+    }
+
+    if (clean != NULL) {
+        printf("# SNR after 1 s: %.1f dB in, %.1f dB out\n", db(all_c, all_in), db(all_c, all_out));
+        if (seg_frames != 0U) {
+            printf("# segmental SNR in speech: %.1f dB in, %.1f dB out\n",
+                   seg_in / seg_frames, seg_out / seg_frames);
+        }
+        if (pause_in > 0.0) {
+            printf("# noise reduction in speech pauses: %.1f dB\n", db(pause_in, pause_out));
+        }
+    }
+    if (q15) {
+        uint32_t n = frames * hop;
+        printf("# q15 output vs f32 output: %.1f dB SNR\n", db(power(ref, n), error_power(out, ref, n)));
+    }
+    printf("# CPU per 10 ms frame: mean %.1f us, max %.1f us (%.2f%% of real time)\n",
+           tot_ns / frames / 1e3, tot_max / 1e3, tot_ns / frames / 1e5);
+
+    if (csv) fclose(csv);
+    if (out_path != NULL && wav_write(out_path, out, frames * hop, rate) != 0) return 1;
+
+    free(buf_q15);
+    free(state_q15);
+    free(state);
+    free(ref);
+    free(out);
+    free(in);
+    free(clean);
+    return 0;
+}
@@ -0,0 +1,356 @@
+/* pipeline_harness.c
+ *
+ * Accuracy and cost of the streaming DSP pipeline (bh_pipeline) and of the
+ * FFTs it is built on.
+ *
+ *   pipeline  biquad -> FIR decimate -> rfft -> complex magnitude, the
+ *             chain in the bh_pipeline.h example: 16 kHz input in blocks
+ *             of 1024, a 2-section high-pass / low-shelf biquad cascade, a
+ *             32-tap low-pass decimating by 4, a 256-point real FFT and
+ *             128 magnitudes. The same chain runs in double precision,
+ *             state carried across blocks, with a direct DFT in place of
+ *             the FFT. Reports the SNR of the spectrum, the largest error
+ *             against the spectrum peak, the mean and worst bh_cycles per
+ *             stage, and checks that the caller's input block is never
+ *             written.
+ *   fft       arm_rfft_fast_f32, arm_cfft_f32, arm_cfft_q31 and
+ *             arm_cfft_q15 (forward) at every supported length against a
+ *             direct DFT of the same input, SNR in dB. The fixed-point
+ *             CFFTs scale by 1/N, the reference is scaled the same way.
+ *
+ *   pipeline_harness [--blocks N] [--seed N]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "bh_arena.h"
+#include "bh_cycles.h"
+#include "bh_pipeline.h"
+#include "harness_util.h"
+
+#define RATE            16000.0
+#define BLOCK           1024U
+#define DECIM           4U
+#define TAPS            32U
+#define SECTIONS        2U
+#define FFT_LEN         (BLOCK / DECIM)
+#define MAX_FFT         4096U
+
+static uint8_t arena_mem[64U * 1024U] __attribute__((aligned(16)));
+
+/* ============================================
+   Reference
+   ============================================ */
+
+static double snr_db(double signal, double noise)
+{
+    return 10.0 * log10((signal + 1e-30) / (noise + 1e-30));
+}
+
+// Direct DFT of len complex (re, im interleaved) samples
+static void ref_dft(const double *x, double *y, uint32_t len)
+{
+    for (uint32_t k = 0; k < len; k++) {
+        double re = 0.0, im = 0.0;
+
+        for (uint32_t n = 0; n < len; n++) {
+            double a = -2.0 * M_PI * (double)((uint64_t)k * n % len) / (double)len;
+            re += x[2 * n] * cos(a) - x[2 * n + 1] * sin(a);
+            im += x[2 * n] * sin(a) + x[2 * n + 1] * cos(a);
+        }
+        y[2 * k] = re;
+        y[2 * k + 1] = im;
+    }
+}
+
+// RBJ cookbook biquads in the CMSIS df2T layout {b0, b1, b2, -a1, -a2}
+static void design_biquads(float32_t *c, double *cd)
+{
+    const double w_hp = 2.0 * M_PI * 100.0 / RATE, w_sh = 2.0 * M_PI * 300.0 / RATE;
+    const double q = 0.70710678, a_sh = pow(10.0, 6.0 / 40.0);
+    double al, b[2][3], a[2][3];
+
+    al = sin(w_hp) / (2.0 * q);
+    b[0][0] = (1.0 + cos(w_hp)) / 2.0;
+    b[0][1] = -(1.0 + cos(w_hp));
+    b[0][2] = (1.0 + cos(w_hp)) / 2.0;
+    a[0][0] = 1.0 + al;
+    a[0][1] = -2.0 * cos(w_hp);
+    a[0][2] = 1.0 - al;
+
+    // +6 dB low shelf
+    al = sin(w_sh) / 2.0 * sqrt(2.0);
+    b[1][0] = a_sh * ((a_sh + 1.0) - (a_sh - 1.0) * cos(w_sh) + 2.0 * sqrt(a_sh) * al);
+    b[1][1] = 2.0 * a_sh * ((a_sh - 1.0) - (a_sh + 1.0) * cos(w_sh));
+    b[1][2] = a_sh * ((a_sh + 1.0) - (a_sh - 1.0) * cos(w_sh) - 2.0 * sqrt(a_sh) * al);
+    a[1][0] = (a_sh + 1.0) + (a_sh - 1.0) * cos(w_sh) + 2.0 * sqrt(a_sh) * al;
+    a[1][1] = -2.0 * ((a_sh - 1.0) + (a_sh + 1.0) * cos(w_sh));
+    a[1][2] = (a_sh + 1.0) + (a_sh - 1.0) * cos(w_sh) - 2.0 * sqrt(a_sh) * al;
+
+    for (uint32_t s = 0; s < SECTIONS; s++) {
+        cd[5 * s + 0] = b[s][0] / a[s][0];
+        cd[5 * s + 1] = b[s][1] / a[s][0];
+        cd[5 * s + 2] = b[s][2] / a[s][0];
+        cd[5 * s + 3] = -a[s][1] / a[s][0];
+        cd[5 * s + 4] = -a[s][2] / a[s][0];
+    }
+    // The reference uses the rounded coefficients: only the arithmetic differs
+    for (uint32_t i = 0; i < 5U * SECTIONS; i++) {
+        c[i] = (float32_t)cd[i];
+        cd[i] = c[i];
+    }
+}
+
+// Hamming windowed sinc at 0.8 of the decimated Nyquist, time reversed (symmetric anyway)
+static void design_fir(float32_t *c, double *cd)
+{
+    const double fc = 0.8 * 0.5 / DECIM;
+    double sum = 0.0;
+
+    for (uint32_t k = 0; k < TAPS; k++) {
+        double m = (double)k - (TAPS - 1U) / 2.0;
+        double h = (m == 0.0) ? 2.0 * fc : sin(2.0 * M_PI * fc * m) / (M_PI * m);
+        cd[k] = h * (0.54 - 0.46 * cos(2.0 * M_PI * k / (TAPS - 1U)));
+        sum += cd[k];
+    }
+    for (uint32_t k = 0; k < TAPS; k++) {
+        c[k] = (float32_t)(cd[k] / sum);
+        cd[k] = c[k];
+    }
+}
+
+typedef struct {
+    const double *biquad, *fir;
+    double d[SECTIONS][2];          // df2T state per section
+    double hist[TAPS - 1U + BLOCK]; // FIR input, the last TAPS - 1 samples of the previous block first
+} ref_chain_t;
+
+// One block through the double precision chain; writes FFT_LEN / 2 magnitudes
+static void ref_block(ref_chain_t *r, const float32_t *x, double *mag)
+{
+    double *y = r->hist + TAPS - 1U;
+    double dec[2 * FFT_LEN], spec[2 * FFT_LEN];
+
+    for (uint32_t n = 0; n < BLOCK; n++) {
+        double v = x[n];
+        for (uint32_t s = 0; s < SECTIONS; s++) {
+            const double *c = r->biquad + 5U * s;
+            double out = c[0] * v + r->d[s][0];
+            r->d[s][0] = c[1] * v + c[3] * out + r->d[s][1];
+            r->d[s][1] = c[2] * v + c[4] * out;
+            v = out;
+        }
+        y[n] = v;
+    }
+
+    // arm_fir_decimate_f32 keeps every M-th output, the one at the first of each M inputs
+    for (uint32_t j = 0; j < FFT_LEN; j++) {
+        uint32_t n = DECIM * j;
+        double acc = 0.0;
+        for (uint32_t k = 0; k < TAPS; k++) acc += r->fir[k] * r->hist[n + k];  // y[n - (TAPS - 1) + k]
+        dec[2 * j] = acc;
+        dec[2 * j + 1] = 0.0;
+    }
+    memmove(r->hist, r->hist + BLOCK, (TAPS - 1U) * sizeof(double));
+
+    // arm_rfft_fast_f32 packs X[N/2] into the imaginary part of bin 0
+    ref_dft(dec, spec, FFT_LEN);
+    mag[0] = sqrt(spec[0] * spec[0] + spec[FFT_LEN] * spec[FFT_LEN]);
+    for (uint32_t k = 1; k < FFT_LEN / 2U; k++) mag[k] = hypot(spec[2 * k], spec[2 * k + 1]);
+}
+
+/* ============================================
+   Pipeline
+   ============================================ */
+
+// Tones (one moving), hum, DC and a little noise
+static void make_block(float32_t *x, uint32_t block)
+{
+    for (uint32_t n = 0; n < BLOCK; n++) {
+        double t = (double)(block * BLOCK + n) / RATE;
+        double f = 440.0 + 300.0 * sin(2.0 * M_PI * 0.3 * t);
+        x[n] = (float32_t)(0.2 + 0.25 * sin(2.0 * M_PI * 50.0 * t) + 0.3 * sin(2.0 * M_PI * f * t) +
+                           0.1 * sin(2.0 * M_PI * 1250.0 * t) + 0.01 * syn_rand());
+    }
+}
+
+static int run_pipeline(uint32_t blocks)
+{
+    static const char *const names[] = { "biquad", "fir_decimate", "rfft", "cmplx_mag" };
+    float32_t biquad[5U * SECTIONS], fir[TAPS];
+    double biquad_d[5U * SECTIONS], fir_d[TAPS];
+    float32_t x[BLOCK], x_copy[BLOCK], out[FFT_LEN / 2U];
+    double ref[FFT_LEN / 2U], sig = 0.0, err = 0.0, peak = 0.0, max_err = 0.0;
+    uint32_t max_cycles[4] = { 0 };
+    ref_chain_t r;
+    bh_arena_t arena;
+    bh_pipeline_t p;
+    int clobbered = 0;
+
+    design_biquads(biquad, biquad_d);
+    design_fir(fir, fir_d);
+    memset(&r, 0, sizeof(r));
+    r.biquad = biquad_d;
+    r.fir = fir_d;
+
+    bh_arena_init(&arena, arena_mem, sizeof(arena_mem));
+    if (bh_pipeline_init(&p, &arena, BLOCK) != ARM_MATH_SUCCESS ||
+        bh_pipeline_add_biquad(&p, SECTIONS, biquad) != ARM_MATH_SUCCESS ||
+        bh_pipeline_add_fir_decimate(&p, TAPS, DECIM, fir) != ARM_MATH_SUCCESS ||
+        bh_pipeline_add_rfft(&p) != ARM_MATH_SUCCESS || bh_pipeline_add_cmplx_mag(&p) != ARM_MATH_SUCCESS ||
+        bh_pipeline_finalize(&p) != ARM_MATH_SUCCESS || bh_pipeline_output_len(&p) != FFT_LEN / 2U) {
+        fprintf(stderr, "pipeline setup failed\n");
+        return 1;
+    }
+
+    for (uint32_t b = 0; b < blocks; b++) {
+        make_block(x, b);
+        memcpy(x_copy, x, sizeof(x));
+        bh_pipeline_process(&p, x, out);
+        if (memcmp(x, x_copy, sizeof(x)) != 0) clobbered = 1;
+        for (uint32_t s = 0; s < 4U; s++) {
+            if (p.stages[s].cycles_last > max_cycles[s]) max_cycles[s] = p.stages[s].cycles_last;
+        }
+
+        ref_block(&r, x, ref);
+        for (uint32_t k = 0; k < FFT_LEN / 2U; k++) {
+            double e = (double)out[k] - ref[k];
+            sig += ref[k] * ref[k];
+            err += e * e;
+            if (ref[k] > peak) peak = ref[k];
+            if (fabs(e) > max_err) max_err = fabs(e);
+        }
+    }
+
+    printf("# bh_pipeline: %u blocks of %u samples, biquad x%u -> fir_decimate %u taps /%u -> rfft %u -> cmplx_mag\n",
+           blocks, BLOCK, SECTIONS, TAPS, DECIM, FFT_LEN);
+    printf("stage          in -> out   cycles mean   cycles max\n");
+    uint64_t total = 0;
+    for (uint32_t s = 0; s < p.num_stages; s++) {
+        uint32_t c = bh_pipeline_stage_cycles(&p, s);
+        total += c;
+        printf("%-12s  %4u -> %-4u  %11u  %11u\n", names[s], p.stages[s].in_len, p.stages[s].out_len, c,
+               max_cycles[s]);
+    }
+    printf("total                      %11llu\n", (unsigned long long)total);
+    printf("spectrum vs double reference: SNR %.1f dB, max error %.2e of peak; input block %s\n\n",
+           snr_db(sig, err), max_err / peak, clobbered ? "WRITTEN" : "untouched");
+    return clobbered || snr_db(sig, err) < 90.0;
+}
+
+/* ============================================
+   FFTs
+   ============================================ */
+
+static int run_ffts(void)
+{
+    static double x[2 * MAX_FFT], y[2 * MAX_FFT];
+    static float32_t f_in[2 * MAX_FFT], f_out[2 * MAX_FFT];
+    static q31_t q31[2 * MAX_FFT];
+    static q15_t q15[2 * MAX_FFT];
+    int bad = 0;
+
+    printf("# forward FFTs against a direct DFT, SNR dB\n");
+    printf("   N  rfft_fast_f32  cfft_f32  cfft_q31  cfft_q15\n");
+    for (uint32_t n = 16; n <= MAX_FFT; n *= 2U) {
+        double snr[4] = { 0.0, 0.0, 0.0, 0.0 }, sig, err;
+
+        // Complex input at half scale, the q15/q31 copies of the same values
+        for (uint32_t i = 0; i < 2U * n; i++) {
+            f_in[i] = 0.5f * syn_rand();
+            q31[i] = (q31_t)lrint((double)f_in[i] * 2147483648.0);
+            q15[i] = (q15_t)lrint((double)f_in[i] * 32768.0);
+            x[i] = f_in[i];
+        }
+
+        // rfft_fast on the real parts (32 points and up)
+        if (n >= 32U) {
+            arm_rfft_fast_instance_f32 rf;
+            double xr[2 * MAX_FFT];
+
+            for (uint32_t i = 0; i < n; i++) {
+                xr[2 * i] = f_in[2 * i];
+                xr[2 * i + 1] = 0.0;
+                f_out[i] = f_in[2 * i];
+            }
+            ref_dft(xr, y, n);
+            arm_rfft_fast_init_f32(&rf, (uint16_t)n);
+            arm_rfft_fast_f32(&rf, f_out, f_out + n, 0);
+            const float32_t *o = f_out + n;
+            sig = y[0] * y[0] + y[n] * y[n];
+            err = (o[0] - y[0]) * (o[0] - y[0]) + (o[1] - y[n]) * (o[1] - y[n]);
+            for (uint32_t k = 1; k < n / 2U; k++) {
+                sig += y[2 * k] * y[2 * k] + y[2 * k + 1] * y[2 * k + 1];
+                err += (o[2 * k] - y[2 * k]) * (o[2 * k] - y[2 * k]) +
+                       (o[2 * k + 1] - y[2 * k + 1]) * (o[2 * k + 1] - y[2 * k + 1]);
+            }
+            snr[0] = snr_db(sig, err);
+        }
+
+        ref_dft(x, y, n);
+        arm_cfft_instance_f32 cf;
+        arm_cfft_instance_q31 c31;
+        arm_cfft_instance_q15 c15;
+
+        arm_cfft_init_f32(&cf, (uint16_t)n);
+        arm_cfft_init_q31(&c31, (uint16_t)n);
+        arm_cfft_init_q15(&c15, (uint16_t)n);
+        memcpy(f_out, f_in, 2U * n * sizeof(float32_t));
+        arm_cfft_f32(&cf, f_out, 0, 1);
+        arm_cfft_q31(&c31, q31, 0, 1);
+        arm_cfft_q15(&c15, q15, 0, 1);
+
+        double s_f = 0.0, e_f = 0.0, s_q = 0.0, e_31 = 0.0, e_15 = 0.0;
+        for (uint32_t i = 0; i < 2U * n; i++) {
+            double yq = y[i] / n;
+            s_f += y[i] * y[i];
+            e_f += (f_out[i] - y[i]) * (f_out[i] - y[i]);
+            s_q += yq * yq;
+            e_31 += (q31[i] / 2147483648.0 - yq) * (q31[i] / 2147483648.0 - yq);
+            e_15 += (q15[i] / 32768.0 - yq) * (q15[i] / 32768.0 - yq);
+        }
+        snr[1] = snr_db(s_f, e_f);
+        snr[2] = snr_db(s_q, e_31);
+        snr[3] = snr_db(s_q, e_15);
+
+        if (n >= 32U) {
+            printf("%4u  %13.1f", n, snr[0]);
+        } else {
+            printf("%4u  %13s", n, "-");
+        }
+        printf("  %8.1f  %8.1f  %8.1f\n", snr[1], snr[2], snr[3]);
+        if ((n >= 32U && snr[0] < 100.0) || snr[1] < 100.0 || snr[2] < 60.0 || snr[3] < 10.0) bad = 1;
+    }
+    return bad;
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    uint32_t blocks = 200;
+    int bad;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--blocks") == 0 && i + 1 < argc) {
+            blocks = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            harness_rng = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (harness_rng == 0U) harness_rng = 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--blocks N] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (blocks == 0U) blocks = 1U;
+
+    bad = run_pipeline(blocks);
+    bad |= run_ffts();
+    return bad;
+}
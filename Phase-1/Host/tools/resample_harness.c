@@ -0,0 +1,223 @@
+/* resample_harness.c
+ *
+ * Streaming behaviour of the sample rate converters (arm_resample_poly_f32,
+ * arm_resample_poly_q15, arm_resample_frac_f32, arm_resample_frac_q15):
+ *
+ *   split   one second of noise at the input rate (47999 samples for the
+ *           rational converter, whose rates are the reduced M and L), fed
+ *           in blocks of 480, 1, 7 and 160 and in random blocks up to 480;
+ *           every split must give the same output, bit for bit, as the
+ *           first
+ *   count   the total must be exactly ceil(N * out / in) for N input
+ *           samples, the outputs whose instant falls inside the input, so
+ *           44100 Hz to 48000 Hz gives 48000 samples for one second
+ *   max     no call may write more than ARM_RESAMPLE_MAX_OUTPUT samples;
+ *           the output buffer ends in a guard band
+ *
+ * Rates cover upsampling, downsampling, an integer ratio each way and, for
+ * the fractional converter, ratios whose Q32 step is not exact. Each runs
+ * at the fast and best quality.
+ *
+ *   resample_harness [--seed N]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "harness_util.h"
+
+#define MAX_RATE        48000U
+#define MAX_BLOCK       480U
+#define POLY_LEN        (MAX_RATE - 1U)
+#define MAX_UP          6U
+#define MAX_OUT         (MAX_UP * MAX_RATE + 1U)
+#define MAX_COEFFS      32768U
+#define MAX_STATE       (MAX_UP * ARM_RESAMPLE_BEST + MAX_BLOCK)
+#define GUARD           16U
+#define GUARD_F32       1234.5f
+#define GUARD_Q15       0x1234
+
+typedef struct {
+    uint32_t in, out;
+} rates_t;
+
+static float32_t in_f32[MAX_RATE], out_f32[MAX_OUT], ref_f32[MAX_OUT];
+static float32_t coeffs_f32[MAX_COEFFS], state_f32[MAX_STATE], blk_f32[MAX_UP * MAX_BLOCK + 1U + GUARD];
+static q15_t in_q15[MAX_RATE], out_q15[MAX_OUT], ref_q15[MAX_OUT];
+static q15_t coeffs_q15[MAX_COEFFS], state_q15[MAX_STATE], blk_q15[MAX_UP * MAX_BLOCK + 1U + GUARD];
+
+/* ============================================
+   Streams
+   ============================================ */
+
+// Block sizes of split s, 0 to SPLITS-1; the last one is random
+#define SPLITS          5U
+
+static uint32_t next_block(uint32_t split, uint32_t left)
+{
+    static const uint32_t sizes[SPLITS - 1U] = { MAX_BLOCK, 1U, 7U, 160U };
+    uint32_t b = (split < SPLITS - 1U) ? sizes[split] : 1U + harness_rand_u32() % MAX_BLOCK;
+
+    return b < left ? b : left;
+}
+
+typedef uint32_t (*run_f32_fn)(void *S, const float32_t *src, float32_t *dst, uint32_t len);
+typedef uint32_t (*run_q15_fn)(void *S, const q15_t *src, q15_t *dst, uint32_t len);
+
+static uint32_t poly_f32(void *S, const float32_t *src, float32_t *dst, uint32_t len)
+{
+    return arm_resample_poly_f32((arm_resample_poly_instance_f32 *)S, src, dst, len);
+}
+
+static uint32_t poly_q15(void *S, const q15_t *src, q15_t *dst, uint32_t len)
+{
+    return arm_resample_poly_q15((arm_resample_poly_instance_q15 *)S, src, dst, len);
+}
+
+static uint32_t frac_f32(void *S, const float32_t *src, float32_t *dst, uint32_t len)
+{
+    return arm_resample_frac_f32((arm_resample_frac_instance_f32 *)S, src, dst, len);
+}
+
+static uint32_t frac_q15(void *S, const q15_t *src, q15_t *dst, uint32_t len)
+{
+    return arm_resample_frac_q15((arm_resample_frac_instance_q15 *)S, src, dst, len);
+}
+
+// Runs the stream through S in the blocks of split; returns the output count, 0 on an overrun
+static uint32_t stream_f32(run_f32_fn run, void *S, rates_t r, uint32_t split, uint32_t len)
+{
+    uint32_t total = 0;
+
+    for (uint32_t n = 0; n < len;) {
+        const uint32_t b = next_block(split, len - n), max = ARM_RESAMPLE_MAX_OUTPUT(r.in, r.out, b);
+        uint32_t got;
+
+        for (uint32_t i = 0; i < GUARD; i++) blk_f32[max + i] = GUARD_F32;
+        got = run(S, in_f32 + n, blk_f32, b);
+        if (got > max || total + got > MAX_OUT) return 0;
+        for (uint32_t i = 0; i < GUARD; i++) {
+            if (blk_f32[max + i] != GUARD_F32) return 0;
+        }
+        memcpy(out_f32 + total, blk_f32, got * sizeof(float32_t));
+        total += got;
+        n += b;
+    }
+    return total;
+}
+
+static uint32_t stream_q15(run_q15_fn run, void *S, rates_t r, uint32_t split, uint32_t len)
+{
+    uint32_t total = 0;
+
+    for (uint32_t n = 0; n < len;) {
+        const uint32_t b = next_block(split, len - n), max = ARM_RESAMPLE_MAX_OUTPUT(r.in, r.out, b);
+        uint32_t got;
+
+        for (uint32_t i = 0; i < GUARD; i++) blk_q15[max + i] = GUARD_Q15;
+        got = run(S, in_q15 + n, blk_q15, b);
+        if (got > max || total + got > MAX_OUT) return 0;
+        for (uint32_t i = 0; i < GUARD; i++) {
+            if (blk_q15[max + i] != GUARD_Q15) return 0;
+        }
+        memcpy(out_q15 + total, blk_q15, got * sizeof(q15_t));
+        total += got;
+        n += b;
+    }
+    return total;
+}
+
+/* ============================================
+   One converter at one rate and quality
+   ============================================ */
+
+// Runs len input samples; prints one row and returns 1 on failure
+static int check(const char *name, rates_t r, arm_resample_quality q, int frac, uint32_t len)
+{
+    const uint32_t expect = (uint32_t)(((uint64_t)len * r.out + r.in - 1U) / r.in);
+    uint32_t count_f32[SPLITS], count_q15[SPLITS], diff_f32 = 0, diff_q15 = 0, bad_count = 0;
+
+    for (uint32_t s = 0; s < SPLITS; s++) {
+        arm_resample_poly_instance_f32 pf;
+        arm_resample_poly_instance_q15 pq;
+        arm_resample_frac_instance_f32 ff;
+        arm_resample_frac_instance_q15 fq;
+
+        if (frac) {
+            arm_resample_frac_init_f32(&ff, r.in, r.out, q, coeffs_f32, state_f32, MAX_BLOCK);
+            arm_resample_frac_init_q15(&fq, r.in, r.out, q, coeffs_q15, state_q15, MAX_BLOCK);
+            count_f32[s] = stream_f32(frac_f32, &ff, r, s, len);
+            count_q15[s] = stream_q15(frac_q15, &fq, r, s, len);
+        } else {
+            arm_resample_poly_init_f32(&pf, (uint16_t)r.out, (uint16_t)r.in, q, coeffs_f32, state_f32, MAX_BLOCK);
+            arm_resample_poly_init_q15(&pq, (uint16_t)r.out, (uint16_t)r.in, q, coeffs_q15, state_q15, MAX_BLOCK);
+            count_f32[s] = stream_f32(poly_f32, &pf, r, s, len);
+            count_q15[s] = stream_q15(poly_q15, &pq, r, s, len);
+        }
+
+        bad_count += (count_f32[s] != expect) + (count_q15[s] != expect);
+        if (s == 0U) {
+            memcpy(ref_f32, out_f32, count_f32[0] * sizeof(float32_t));
+            memcpy(ref_q15, out_q15, count_q15[0] * sizeof(q15_t));
+        } else {
+            if (count_f32[s] != count_f32[0] || memcmp(out_f32, ref_f32, count_f32[0] * sizeof(float32_t)) != 0) {
+                diff_f32++;
+            }
+            if (count_q15[s] != count_q15[0] || memcmp(out_q15, ref_q15, count_q15[0] * sizeof(q15_t)) != 0) {
+                diff_q15++;
+            }
+        }
+    }
+
+    const int fail = bad_count || diff_f32 || diff_q15;
+    printf("%-5s %5u -> %5u  %-4s  %6u  %6u %6u  %u/%u  %u/%u%s\n", name, r.in, r.out,
+           q == ARM_RESAMPLE_FAST ? "fast" : "best", expect, count_f32[0], count_q15[0],
+           diff_f32, SPLITS - 1U, diff_q15, SPLITS - 1U, fail ? "  FAIL" : "");
+    return fail;
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    static const rates_t poly_rates[] = { { 147, 160 }, { 160, 147 }, { 1, 3 }, { 3, 1 }, { 2, 3 }, { 6, 1 } };
+    static const rates_t frac_rates[] = {
+        { 44100, 48000 }, { 48000, 44100 }, { 44100, 16000 }, { 16000, 44100 },
+        { 8000, 48000 }, { 48000, 8000 }, { 44100, 44100 }, { 47999, 48000 },
+    };
+    static const arm_resample_quality qualities[] = { ARM_RESAMPLE_FAST, ARM_RESAMPLE_BEST };
+    uint32_t failures = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            harness_rng = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (harness_rng == 0U) harness_rng = 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    for (uint32_t i = 0; i < MAX_RATE; i++) {
+        in_f32[i] = 0.5f * syn_rand();
+        in_q15[i] = (q15_t)lrintf(in_f32[i] * 32767.0f);
+    }
+
+    printf("conv    in  ->   out  qual  expect     f32    q15  split mismatches f32 / q15\n");
+    for (size_t q = 0; q < sizeof(qualities) / sizeof(qualities[0]); q++) {
+        for (size_t r = 0; r < sizeof(poly_rates) / sizeof(poly_rates[0]); r++) {
+            failures += (uint32_t)check("poly", poly_rates[r], qualities[q], 0, POLY_LEN);
+        }
+        for (size_t r = 0; r < sizeof(frac_rates) / sizeof(frac_rates[0]); r++) {
+            failures += (uint32_t)check("frac", frac_rates[r], qualities[q], 1, frac_rates[r].in);
+        }
+    }
+
+    printf("\n%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
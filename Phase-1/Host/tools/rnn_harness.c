@@ -0,0 +1,392 @@
+/* rnn_harness.c
+ *
+ * Accuracy and cost of the s8 LSTM and GRU cells (arm_lstm_s8, arm_gru_s8)
+ * at the hidden sizes of small VAD / noise suppression models.
+ *
+ * Each cell gets random float weights and a temporally correlated input
+ * sequence (log-mel like: I features, AR(1) per feature). The weights are
+ * quantized the way a converter would: the gate rows over [input, hidden]
+ * share one scale (the input and hidden LSB folded into the matrix), the
+ * bias and the input zero point go into kernel sums. Two float references
+ * run alongside in double, never rounded:
+ *
+ *   qw     the dequantized int8 weights: the error of the cell arithmetic
+ *          (s8 Q3.4 pre-activations, table sigmoid / tanh, s16 cell, s8 h);
+ *   float  the original weights: the whole error including weight rounding.
+ *
+ * The SNR is over every hidden output of the sequence (h at 1/128 per LSB).
+ * The step API is checked bit for bit against the sequence API, and a
+ * sequence split in two calls against one call (state carried). Cycles per
+ * step are the mean over the whole sequence.
+ *
+ *   rnn_harness [--steps N] [--seed N]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+#include "bh_cycles.h"
+#include "nn_model.h"
+
+#define INPUT_SCALE     (1.0 / 64.0)
+#define INPUT_ZP        (-3)
+#define HIDDEN_SCALE    (1.0 / 128.0)
+
+typedef struct {
+    double *gate, *gate_b;      // [G * H, I + H], [G * H]
+    double *in, *in_b;          // GRU candidate: [H, I], [H]
+    double *rec, *rec_b;        // GRU candidate: [H, H], [H]
+} float_weights_t;
+
+typedef struct {
+    int gru;
+    int32_t in, hid;
+    float_weights_t real, deq;
+    int8_t *q_gate, *q_in, *q_rec;
+    int32_t *ks_gate, *ks_in, *b_rec;
+    cmsis_nn_lstm_weights lstm;
+    cmsis_nn_gru_weights gru_w;
+} cell_t;
+
+static double sigmoid(double x)
+{
+    return 1.0 / (1.0 + exp(-x));
+}
+
+/* ============================================
+   Weights
+   ============================================ */
+
+// Rows of in_cols input weights in [-in_range, in_range), then recurrent
+// weights in [-rec_range, rec_range)
+static double *random_rows(int32_t rows, int32_t cols, int32_t in_cols, double in_range, double rec_range)
+{
+    double *m = (double *)malloc((size_t)(rows * cols) * sizeof(double));
+    for (int32_t i = 0; i < rows * cols; i++) m[i] = ((i % cols < in_cols) ? in_range : rec_range) * nn_rand_uniform();
+    return m;
+}
+
+// Quantizes rows whose first in_cols columns multiply the input and the rest
+// the hidden state to one s8 scale, in pre-activation units per accumulator
+// LSB; fills the kernel sums, the Q3.4 multiplier and the dequantized copy.
+static void quantize(const double *w, const double *b, int32_t rows, int32_t cols, int32_t in_cols, int8_t *q,
+                     int32_t *ks, int32_t *mult, int32_t *shift, double *deq_w, double *deq_b)
+{
+    int32_t *bq = (int32_t *)malloc((size_t)rows * sizeof(int32_t));
+    double max = 0.0, s;
+
+    for (int32_t i = 0; i < rows * cols; i++) {
+        double v = fabs(w[i]) * ((i % cols < in_cols) ? INPUT_SCALE : HIDDEN_SCALE);
+        if (v > max) max = v;
+    }
+    s = max / 127.0;
+    for (int32_t i = 0; i < rows * cols; i++) {
+        double lsb = (i % cols < in_cols) ? INPUT_SCALE : HIDDEN_SCALE;
+        q[i] = (int8_t)lrint(w[i] * lsb / s);
+        deq_w[i] = q[i] * s / lsb;
+    }
+    for (int32_t r = 0; r < rows; r++) {
+        bq[r] = (int32_t)lrint(b[r] / s);
+        deq_b[r] = bq[r] * s;
+    }
+    arm_rnn_kernel_sums_s8(q, bq, rows, in_cols, cols, -INPUT_ZP, ks);
+    nn_quantize_multiplier(s * 16.0, mult, shift);
+    free(bq);
+}
+
+static void cell_init(cell_t *c, int gru, int32_t in, int32_t hid)
+{
+    int32_t gates = gru ? 2 : 4, cols = in + hid;
+    // Input terms give pre-activations of std ~1.2; recurrent matrices have a
+    // spectral radius ~0.9, contractive like a trained cell (random ones at
+    // full gain are chaotic from H = 128 and no reference can follow them)
+    double in_range = sqrt(18.0 / (double)in), rec_range = 0.9 * sqrt(3.0 / (double)hid);
+
+    memset(c, 0, sizeof(*c));
+    c->gru = gru;
+    c->in = in;
+    c->hid = hid;
+
+    c->real.gate = random_rows(gates * hid, cols, in, in_range, rec_range);
+    c->real.gate_b = random_rows(gates * hid, 1, 1, 0.5, 0.0);
+    if (!gru) {
+        for (int32_t i = hid; i < 2 * hid; i++) c->real.gate_b[i] += 1.0; // Forget gate bias
+    }
+    c->deq.gate = (double *)malloc((size_t)(gates * hid * cols) * sizeof(double));
+    c->deq.gate_b = (double *)malloc((size_t)(gates * hid) * sizeof(double));
+    c->q_gate = (int8_t *)malloc((size_t)(gates * hid * cols));
+    c->ks_gate = (int32_t *)malloc((size_t)(gates * hid) * sizeof(int32_t));
+
+    if (!gru) {
+        quantize(c->real.gate, c->real.gate_b, 4 * hid, cols, in, c->q_gate, c->ks_gate, &c->lstm.gate_multiplier,
+                 &c->lstm.gate_shift, c->deq.gate, c->deq.gate_b);
+        c->lstm.weights = c->q_gate;
+        c->lstm.kernel_sums = c->ks_gate;
+        return;
+    }
+
+    quantize(c->real.gate, c->real.gate_b, 2 * hid, cols, in, c->q_gate, c->ks_gate, &c->gru_w.gate_multiplier,
+             &c->gru_w.gate_shift, c->deq.gate, c->deq.gate_b);
+
+    c->real.in = random_rows(hid, in, in, in_range, 0.0);
+    c->real.in_b = random_rows(hid, 1, 1, 0.5, 0.0);
+    c->real.rec = random_rows(hid, hid, 0, 0.0, rec_range);
+    c->real.rec_b = random_rows(hid, 1, 1, 0.5, 0.0);
+    c->deq.in = (double *)malloc((size_t)(hid * in) * sizeof(double));
+    c->deq.in_b = (double *)malloc((size_t)hid * sizeof(double));
+    c->deq.rec = (double *)malloc((size_t)(hid * hid) * sizeof(double));
+    c->deq.rec_b = (double *)malloc((size_t)hid * sizeof(double));
+    c->q_in = (int8_t *)malloc((size_t)(hid * in));
+    c->q_rec = (int8_t *)malloc((size_t)(hid * hid));
+    c->ks_in = (int32_t *)malloc((size_t)hid * sizeof(int32_t));
+    c->b_rec = (int32_t *)malloc((size_t)hid * sizeof(int32_t));
+    quantize(c->real.in, c->real.in_b, hid, in, in, c->q_in, c->ks_in, &c->gru_w.input_multiplier,
+             &c->gru_w.input_shift, c->deq.in, c->deq.in_b);
+    quantize(c->real.rec, c->real.rec_b, hid, hid, 0, c->q_rec, c->b_rec, &c->gru_w.recurrent_multiplier,
+             &c->gru_w.recurrent_shift, c->deq.rec, c->deq.rec_b);
+
+    c->gru_w.gate_weights = c->q_gate;
+    c->gru_w.gate_kernel_sums = c->ks_gate;
+    c->gru_w.input_weights = c->q_in;
+    c->gru_w.input_kernel_sums = c->ks_in;
+    c->gru_w.recurrent_weights = c->q_rec;
+    c->gru_w.recurrent_bias = c->b_rec;
+}
+
+static void float_weights_free(float_weights_t *w)
+{
+    free(w->gate);
+    free(w->gate_b);
+    free(w->in);
+    free(w->in_b);
+    free(w->rec);
+    free(w->rec_b);
+}
+
+static void cell_free(cell_t *c)
+{
+    float_weights_free(&c->real);
+    float_weights_free(&c->deq);
+    free(c->q_gate);
+    free(c->q_in);
+    free(c->q_rec);
+    free(c->ks_gate);
+    free(c->ks_in);
+    free(c->b_rec);
+}
+
+/* ============================================
+   Float reference
+   ============================================ */
+
+// pre[r] = b[r] + row r of w over v (cols elements)
+static void float_matvec(const double *w, const double *b, const double *v, int32_t rows, int32_t cols, double *pre)
+{
+    for (int32_t r = 0; r < rows; r++) {
+        double acc = b[r];
+        for (int32_t k = 0; k < cols; k++) acc += w[r * cols + k] * v[k];
+        pre[r] = acc;
+    }
+}
+
+// One step; xh holds [x, h], cell the LSTM cell state, pre 4 * H scratch
+static void float_step(const cell_t *c, const float_weights_t *w, double *xh, double *cell, double *pre)
+{
+    int32_t in = c->in, hid = c->hid;
+    double *h = xh + in;
+
+    if (!c->gru) {
+        float_matvec(w->gate, w->gate_b, xh, 4 * hid, in + hid, pre);
+        for (int32_t j = 0; j < hid; j++) {
+            double i = sigmoid(pre[j]), f = sigmoid(pre[hid + j]);
+            double g = tanh(pre[2 * hid + j]), o = sigmoid(pre[3 * hid + j]);
+            cell[j] = f * cell[j] + i * g;
+            h[j] = o * tanh(cell[j]);
+        }
+        return;
+    }
+
+    float_matvec(w->gate, w->gate_b, xh, 2 * hid, in + hid, pre);
+    float_matvec(w->in, w->in_b, xh, hid, in, pre + 2 * hid);
+    float_matvec(w->rec, w->rec_b, h, hid, hid, pre + 3 * hid);
+    for (int32_t j = 0; j < hid; j++) {
+        double z = sigmoid(pre[j]), r = sigmoid(pre[hid + j]);
+        double n = tanh(pre[2 * hid + j] + r * pre[3 * hid + j]);
+        h[j] = n + z * (h[j] - n);
+    }
+}
+
+/* ============================================
+   One configuration
+   ============================================ */
+
+typedef struct {
+    double snr_qw, snr_float, max_err;
+    double cycles_per_step;
+    uint32_t mismatches;
+    int32_t state_bytes, scratch_bytes;
+    uint64_t macs;
+} result_t;
+
+static arm_status run_cell(const cell_t *c, const cmsis_nn_context *ctx, cmsis_nn_rnn_state *st,
+                           const cmsis_nn_dims *in_dims, const int8_t *x, const cmsis_nn_dims *out_dims, int8_t *h)
+{
+    return c->gru ? arm_gru_s8(ctx, &c->gru_w, st, in_dims, x, out_dims, h)
+                  : arm_lstm_s8(ctx, &c->lstm, st, in_dims, x, out_dims, h);
+}
+
+static arm_status step_cell(const cell_t *c, const cmsis_nn_context *ctx, cmsis_nn_rnn_state *st,
+                            const cmsis_nn_dims *in_dims, const int8_t *x, const cmsis_nn_dims *out_dims, int8_t *h)
+{
+    return c->gru ? arm_gru_step_s8(ctx, &c->gru_w, st, in_dims, x, out_dims, h)
+                  : arm_lstm_step_s8(ctx, &c->lstm, st, in_dims, x, out_dims, h);
+}
+
+static int run_config(int gru, int32_t in, int32_t hid, int32_t steps, result_t *res)
+{
+    cell_t c;
+    cmsis_nn_dims in_dims = { steps, 1, 1, in }, out_dims = { steps, 1, 1, hid };
+    cmsis_nn_dims in1 = { 1, 1, 1, in }, out1 = { 1, 1, 1, hid };
+    cmsis_nn_context ctx;
+    cmsis_nn_rnn_state st;
+    int8_t *x = (int8_t *)malloc((size_t)(steps * in));
+    int8_t *h = (int8_t *)malloc((size_t)(steps * hid));
+    int8_t *h2 = (int8_t *)malloc((size_t)(steps * hid));
+    double *xh_q = (double *)calloc((size_t)(in + hid), sizeof(double));
+    double *xh_f = (double *)calloc((size_t)(in + hid), sizeof(double));
+    double *cell_q = (double *)calloc((size_t)hid, sizeof(double));
+    double *cell_f = (double *)calloc((size_t)hid, sizeof(double));
+    double *pre = (double *)malloc((size_t)(4 * hid) * sizeof(double));
+    double *ar = (double *)calloc((size_t)in, sizeof(double));
+    double sig = 0.0, noise_qw = 0.0, noise_f = 0.0, max_err = 0.0;
+    int ok = 1;
+
+    cell_init(&c, gru, in, hid);
+
+    ctx.size = gru ? arm_gru_s8_get_buffer_size(&out_dims) : arm_lstm_s8_get_buffer_size(&out_dims);
+    ctx.buf = malloc((size_t)ctx.size);
+    st.input_hidden = (int8_t *)malloc((size_t)(in + hid));
+    st.cell = (int16_t *)malloc((size_t)hid * sizeof(int16_t));
+    res->scratch_bytes = ctx.size;
+    res->state_bytes = in + hid + hid * (int32_t)sizeof(int16_t);
+    res->macs = (uint64_t)(gru ? 3 : 4) * (uint64_t)hid * (uint64_t)(in + hid);
+
+    // Input: AR(1) per feature, std about 0.5, quantized
+    for (int32_t t = 0; t < steps; t++) {
+        for (int32_t k = 0; k < in; k++) {
+            ar[k] = 0.9 * ar[k] + 0.38 * nn_rand_uniform();
+            long q = lrint(ar[k] / INPUT_SCALE) + INPUT_ZP;
+            x[t * in + k] = (int8_t)(q < -128 ? -128 : q > 127 ? 127 : q);
+        }
+    }
+
+    // Sequence API, timed
+    arm_rnn_state_s8_reset(&st, in, hid);
+    uint32_t t0 = bh_cycles_now();
+    if (run_cell(&c, &ctx, &st, &in_dims, x, &out_dims, h) != ARM_MATH_SUCCESS) ok = 0;
+    res->cycles_per_step = (double)(uint32_t)(bh_cycles_now() - t0) / (double)steps;
+
+    // Step API and a split sequence must give the same outputs
+    res->mismatches = 0;
+    arm_rnn_state_s8_reset(&st, in, hid);
+    for (int32_t t = 0; t < steps; t++) {
+        if (step_cell(&c, &ctx, &st, &in1, x + t * in, &out1, h2 + t * hid) != ARM_MATH_SUCCESS) ok = 0;
+    }
+    if (memcmp(h, h2, (size_t)(steps * hid)) != 0) res->mismatches++;
+    arm_rnn_state_s8_reset(&st, in, hid);
+    {
+        cmsis_nn_dims a_in = { steps / 3, 1, 1, in }, a_out = { steps / 3, 1, 1, hid };
+        cmsis_nn_dims b_in = { steps - steps / 3, 1, 1, in }, b_out = { steps - steps / 3, 1, 1, hid };
+        if (run_cell(&c, &ctx, &st, &a_in, x, &a_out, h2) != ARM_MATH_SUCCESS ||
+            run_cell(&c, &ctx, &st, &b_in, x + (steps / 3) * in, &b_out, h2 + (steps / 3) * hid) != ARM_MATH_SUCCESS) {
+            ok = 0;
+        }
+    }
+    if (memcmp(h, h2, (size_t)(steps * hid)) != 0) res->mismatches++;
+    {
+        cmsis_nn_dims bad = { steps - 1, 1, 1, hid };
+        if (run_cell(&c, &ctx, &st, &in_dims, x, &bad, h2) != ARM_MATH_SIZE_MISMATCH) res->mismatches++;
+    }
+
+    // Float references on the same (dequantized) input
+    for (int32_t t = 0; t < steps; t++) {
+        for (int32_t k = 0; k < in; k++) xh_q[k] = xh_f[k] = (x[t * in + k] - INPUT_ZP) * INPUT_SCALE;
+        float_step(&c, &c.deq, xh_q, cell_q, pre);
+        float_step(&c, &c.real, xh_f, cell_f, pre);
+        for (int32_t j = 0; j < hid; j++) {
+            double v = h[t * hid + j] * HIDDEN_SCALE;
+            double eq = v - xh_q[in + j], ef = v - xh_f[in + j];
+            sig += xh_f[in + j] * xh_f[in + j];
+            noise_qw += eq * eq;
+            noise_f += ef * ef;
+            if (fabs(eq) / HIDDEN_SCALE > max_err) max_err = fabs(eq) / HIDDEN_SCALE;
+        }
+    }
+    res->snr_qw = 10.0 * log10(sig / (noise_qw > 0.0 ? noise_qw : 1e-30));
+    res->snr_float = 10.0 * log10(sig / (noise_f > 0.0 ? noise_f : 1e-30));
+    res->max_err = max_err;
+
+    cell_free(&c);
+    free(ctx.buf);
+    free(st.input_hidden);
+    free(st.cell);
+    free(x);
+    free(h);
+    free(h2);
+    free(xh_q);
+    free(xh_f);
+    free(cell_q);
+    free(cell_f);
+    free(pre);
+    free(ar);
+    return ok;
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    static const int32_t sizes[][2] = { { 40, 32 }, { 40, 64 }, { 40, 128 }, { 64, 256 } };
+    int32_t steps = 500;
+    uint32_t failures = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--steps") == 0 && i + 1 < argc) {
+            steps = (int32_t)strtol(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            harness_rng = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (harness_rng == 0U) harness_rng = 1U;
+        } else {
+            fprintf(stderr, "usage: %s [--steps N] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (steps < 3) steps = 3;
+    bh_cycles_init();
+
+    printf("# s8 LSTM / GRU cells, %d steps; SNR of h against double precision with the dequantized (qw)\n", steps);
+    printf("# and the original (float) weights; max error in h LSB against qw\n");
+    printf("cell     I    H   MACs/step  cycles/step  MAC/cycle  SNR qw dB  SNR float dB  max err  state B  "
+           "scratch B  exact\n");
+    for (int gru = 0; gru < 2; gru++) {
+        for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+            result_t r;
+            if (!run_config(gru, sizes[k][0], sizes[k][1], steps, &r)) {
+                fprintf(stderr, "%s %d/%d: kernel failed\n", gru ? "gru" : "lstm", (int)sizes[k][0],
+                        (int)sizes[k][1]);
+                return 1;
+            }
+            failures += r.mismatches;
+            printf("%-5s  %3d  %3d  %10llu  %11.0f  %9.2f  %9.1f  %12.1f  %7.2f  %7d  %9d  %s\n", gru ? "gru" : "lstm",
+                   (int)sizes[k][0], (int)sizes[k][1], (unsigned long long)r.macs, r.cycles_per_step,
+                   (double)r.macs / r.cycles_per_step, r.snr_qw, r.snr_float, r.max_err, (int)r.state_bytes,
+                   (int)r.scratch_bytes, r.mismatches ? "MISMATCH" : "OK");
+        }
+    }
+    return failures ? 1 : 0;
+}
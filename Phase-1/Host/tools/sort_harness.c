@@ -0,0 +1,257 @@
+/* sort_harness.c
+ *
+ * Correctness and cost of the radix sort, argsort and top-k
+ * (arm_radix_sort_*, arm_radix_argsort_*, arm_topk_*) for f32, q31 and
+ * q15, serial and threaded.
+ *
+ * The reference is a qsort of (key, index) pairs, key the order-preserving
+ * bit pattern of the value (so -0.0 sorts before +0.0), inverted for
+ * descending order: a stable sort in either direction. Inputs are drawn
+ * from a small set of values so there are many ties, and every f32 input
+ * mixes in -0.0 and +0.0. Sizes straddle the insertion sort cut-off (80)
+ * and the per-thread chunk (32k), up to 1M.
+ *
+ * Every configuration runs at each thread count given; the first line says
+ * whether the library was built with ARM_MATH_PTHREAD and how many parts a
+ * 1M-element sort actually gets for each count, so a build without threads
+ * cannot pass for a threaded check: without it, asking for more than one
+ * thread fails the run. Thread count 0 is one per core. The last table is
+ * ns per element at 1M.
+ *
+ *   sort_harness [--threads N[,N...]] [--max N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_parallel.h"
+#include "harness_util.h"
+
+#define MAX_THREADS     8U
+
+typedef enum { T_F32, T_Q31, T_Q15 } type_t;
+
+static const char *const type_names[] = { "f32", "q31", "q15" };
+static const size_t type_bytes[] = { sizeof(float32_t), sizeof(q31_t), sizeof(q15_t) };
+
+/* ============================================
+   Reference
+   ============================================ */
+
+static uint32_t sort_key(type_t t, const void *x, uint32_t i, int descending)
+{
+    uint32_t k;
+
+    if (t == T_F32) {
+        uint32_t b;
+        memcpy(&b, (const float32_t *)x + i, sizeof(b));
+        k = (b & 0x80000000U) ? ~b : (b | 0x80000000U);
+    } else if (t == T_Q31) {
+        k = (uint32_t)((const q31_t *)x)[i] ^ 0x80000000U;
+    } else {
+        k = (uint32_t)(uint16_t)((const q15_t *)x)[i] ^ 0x8000U;
+    }
+    return descending ? ~k : k;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// Stable order of x as indices
+static void ref_order(type_t t, const void *x, uint32_t n, int descending, uint32_t *order)
+{
+    uint64_t *pairs = (uint64_t *)malloc(((size_t)n + 1U) * sizeof(uint64_t));
+
+    for (uint32_t i = 0; i < n; i++) pairs[i] = ((uint64_t)sort_key(t, x, i, descending) << 32) | i;
+    qsort(pairs, n, sizeof(uint64_t), cmp_u64);
+    for (uint32_t i = 0; i < n; i++) order[i] = (uint32_t)pairs[i];
+    free(pairs);
+}
+
+// Few distinct values, so most elements tie
+static void fill(type_t t, void *x, uint32_t n)
+{
+    static const float32_t special[] = { -0.0f, 0.0f, 1.5f, -2.25f };
+
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t v = (int32_t)(harness_rand_u32() % 64U) - 32;
+
+        if (t == T_F32) {
+            ((float32_t *)x)[i] = (harness_rand_u32() & 7U) == 0U ? special[harness_rand_u32() & 3U]
+                                                                   : (float32_t)v * 0.125f;
+        } else if (t == T_Q31) {
+            ((q31_t *)x)[i] = v * 0x01000000 + (int32_t)(harness_rand_u32() & 1U);
+        } else {
+            ((q15_t *)x)[i] = (q15_t)(v * 0x0100);
+        }
+    }
+}
+
+/* ============================================
+   Kernels under test
+   ============================================ */
+
+typedef union {
+    arm_radix_sort_instance_f32 f32;
+    arm_radix_sort_instance_q31 q31;
+    arm_radix_sort_instance_q15 q15;
+} instance_t;
+
+static void init(type_t t, instance_t *s, int descending, uint32_t threads, uint64_t *scratch)
+{
+    arm_sort_dir dir = descending ? ARM_SORT_DESCENDING : ARM_SORT_ASCENDING;
+
+    if (t == T_F32) arm_radix_sort_init_f32(&s->f32, dir, threads, scratch);
+    if (t == T_Q31) arm_radix_sort_init_q31(&s->q31, dir, threads, scratch);
+    if (t == T_Q15) arm_radix_sort_init_q15(&s->q15, dir, threads, scratch);
+}
+
+static void sort(type_t t, const instance_t *s, const void *x, void *y, uint32_t n)
+{
+    if (t == T_F32) arm_radix_sort_f32(&s->f32, (const float32_t *)x, (float32_t *)y, n);
+    if (t == T_Q31) arm_radix_sort_q31(&s->q31, (const q31_t *)x, (q31_t *)y, n);
+    if (t == T_Q15) arm_radix_sort_q15(&s->q15, (const q15_t *)x, (q15_t *)y, n);
+}
+
+static void argsort(type_t t, const instance_t *s, const void *x, void *y, uint32_t *idx, uint32_t n)
+{
+    if (t == T_F32) arm_radix_argsort_f32(&s->f32, (const float32_t *)x, (float32_t *)y, idx, n);
+    if (t == T_Q31) arm_radix_argsort_q31(&s->q31, (const q31_t *)x, (q31_t *)y, idx, n);
+    if (t == T_Q15) arm_radix_argsort_q15(&s->q15, (const q15_t *)x, (q15_t *)y, idx, n);
+}
+
+static uint32_t topk(type_t t, const instance_t *s, const void *x, uint32_t n, uint32_t k, void *y, uint32_t *idx)
+{
+    if (t == T_F32) return arm_topk_f32(&s->f32, (const float32_t *)x, n, k, (float32_t *)y, idx);
+    if (t == T_Q31) return arm_topk_q31(&s->q31, (const q31_t *)x, n, k, (q31_t *)y, idx);
+    return arm_topk_q15(&s->q15, (const q15_t *)x, n, k, (q15_t *)y, idx);
+}
+
+// y[i] must be bit for bit x[order[i]]
+static int same_values(type_t t, const void *x, const uint32_t *order, const void *y, uint32_t n)
+{
+    const size_t e = type_bytes[t];
+
+    for (uint32_t i = 0; i < n; i++) {
+        if (memcmp((const uint8_t *)y + i * e, (const uint8_t *)x + order[i] * e, e) != 0) return 0;
+    }
+    return 1;
+}
+
+/* ============================================
+   Main
+   ============================================ */
+
+int main(int argc, char **argv)
+{
+    static const uint32_t sizes[] = { 0, 1, 2, 79, 80, 81, 1000, 32767, 32768, 65537, 100003, 1U << 20 };
+    uint32_t threads[MAX_THREADS] = { 1, 2, 3, 4, 7, 0 }, num_threads = 6, max_n = 1U << 20;
+    uint32_t failures = 0, checks = 0;
+    double ns[3][MAX_THREADS] = { { 0.0 } };
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            char *p = argv[++i];
+            num_threads = 0;
+            while (*p != '\0' && num_threads < MAX_THREADS) {
+                threads[num_threads++] = (uint32_t)strtoul(p, &p, 0);
+                if (*p == ',') p++;
+            }
+        } else if (strcmp(argv[i], "--max") == 0 && i + 1 < argc) {
+            max_n = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else {
+            fprintf(stderr, "usage: %s [--threads N[,N...]] [--max N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+#if defined(ARM_MATH_PTHREAD)
+    printf("# ARM_MATH_PTHREAD on; parts of a 1M sort per requested thread count:");
+#else
+    printf("# ARM_MATH_PTHREAD off (serial only); parts of a 1M sort per requested thread count:");
+#endif
+    for (uint32_t t = 0; t < num_threads; t++) {
+        printf(" %u->%u", threads[t], arm_parallel_threads(threads[t], 1U << 20, 32768U));
+    }
+    printf("\n");
+
+    size_t cap = (size_t)max_n + 1U;
+    void *x = malloc(cap * sizeof(float32_t)), *y = malloc(cap * sizeof(float32_t));
+    uint32_t *order = (uint32_t *)malloc(cap * sizeof(uint32_t)), *idx = (uint32_t *)malloc(cap * sizeof(uint32_t));
+    uint64_t *scratch = (uint64_t *)malloc(ARM_RADIX_ARGSORT_SCRATCH_SIZE(cap) * sizeof(uint64_t));
+
+    printf("type  dir   size      sort  argsort  topk  (per thread count)\n");
+    for (int t = T_F32; t <= T_Q15; t++) {
+        for (int desc = 0; desc < 2; desc++) {
+            for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]) && sizes[k] <= max_n; k++) {
+                const uint32_t n = sizes[k], top = n < 8U ? n : 8U;
+                uint32_t bad_sort = 0, bad_arg = 0, bad_top = 0;
+
+                fill((type_t)t, x, n);
+                ref_order((type_t)t, x, n, desc, order);
+                for (uint32_t th = 0; th < num_threads; th++) {
+                    instance_t s;
+                    uint64_t t0;
+
+                    init((type_t)t, &s, desc, threads[th], scratch);
+                    t0 = now_ns();
+                    sort((type_t)t, &s, x, y, n);
+                    if (n == (1U << 20) && !desc) ns[t][th] = (double)(now_ns() - t0) / n;
+                    if (!same_values((type_t)t, x, order, y, n)) bad_sort++;
+
+                    memset(idx, 0xFF, (size_t)n * sizeof(uint32_t));
+                    argsort((type_t)t, &s, x, y, idx, n);
+                    if (memcmp(idx, order, (size_t)n * sizeof(uint32_t)) != 0 ||
+                        !same_values((type_t)t, x, order, y, n)) {
+                        bad_arg++;
+                    }
+
+                    if (topk((type_t)t, &s, x, n, 8U, y, idx) != top ||
+                        memcmp(idx, order, top * sizeof(uint32_t)) != 0 || !same_values((type_t)t, x, order, y, top)) {
+                        bad_top++;
+                    }
+                    checks += 3U;
+                }
+                failures += bad_sort + bad_arg + bad_top;
+                if (bad_sort + bad_arg + bad_top != 0U || n == (1U << 20)) {
+                    printf("%-4s  %-4s  %7u  %8s  %7s  %4s\n", type_names[t], desc ? "desc" : "asc", n,
+                           bad_sort ? "FAIL" : "ok", bad_arg ? "FAIL" : "ok", bad_top ? "FAIL" : "ok");
+                }
+            }
+        }
+    }
+    printf("%u of %u checks passed\n\n", checks - failures, checks);
+
+#if !defined(ARM_MATH_PTHREAD)
+    for (uint32_t th = 0; th < num_threads; th++) {
+        if (threads[th] != 1U) {
+            printf("threads %u requested but the library is serial only (build with PTHREAD=1)\n\n", threads[th]);
+            failures++;
+            break;
+        }
+    }
+#endif
+
+    if (max_n >= (1U << 20)) {
+        printf("ns/element, 1M ascending sort\nthreads");
+        for (uint32_t th = 0; th < num_threads; th++) printf("  %6u", threads[th]);
+        printf("\n");
+        for (int t = T_F32; t <= T_Q15; t++) {
+            printf("%-7s", type_names[t]);
+            for (uint32_t th = 0; th < num_threads; th++) printf("  %6.2f", ns[t][th]);
+            printf("\n");
+        }
+    }
+
+    free(x);
+    free(y);
+    free(order);
+    free(idx);
+    free(scratch);
+    return failures ? 1 : 0;
+}
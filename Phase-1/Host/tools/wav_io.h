@@ -0,0 +1,130 @@
+/* wav_io.h
+ *
+ * Minimal WAV reader / writer for the host tools: RIFF/WAVE with PCM
+ * 16-bit or IEEE float 32-bit samples. Multi-channel files are read as
+ * their first channel. Samples are float in [-1, 1).
+ */
+
+#ifndef WAV_IO_H
+#define WAV_IO_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static inline uint32_t wav_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint16_t wav_le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+// Returns the samples (malloc'ed, caller frees) or NULL with a message on stderr.
+static inline float *wav_read(const char *path, uint32_t *rate, uint32_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t hdr[12], ck[8], fmt[16];
+    uint16_t format = 0, channels = 0, bits = 0;
+    float *out = NULL;
+
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+    if (fread(hdr, 1, 12, f) != 12 || memcmp(hdr, "RIFF", 4) != 0 || memcmp(hdr + 8, "WAVE", 4) != 0) {
+        fprintf(stderr, "%s: not a WAV file\n", path);
+        goto done;
+    }
+
+    while (fread(ck, 1, 8, f) == 8) {
+        uint32_t size = wav_le32(ck + 4);
+
+        if (memcmp(ck, "fmt ", 4) == 0 && size >= 16) {
+            if (fread(fmt, 1, 16, f) != 16) break;
+            format = wav_le16(fmt);
+            channels = wav_le16(fmt + 2);
+            *rate = wav_le32(fmt + 4);
+            bits = wav_le16(fmt + 14);
+            fseek(f, (long)(size - 16U + (size & 1U)), SEEK_CUR);
+        } else if (memcmp(ck, "data", 4) == 0 && channels != 0U) {
+            uint32_t frame = channels * (bits / 8U);
+            uint8_t *raw;
+
+            if (!((format == 1 && bits == 16) || (format == 3 && bits == 32))) {
+                fprintf(stderr, "%s: only PCM 16-bit and float 32-bit are supported\n", path);
+                goto done;
+            }
+            *len = size / frame;
+            raw = malloc(size);
+            out = malloc((*len ? *len : 1U) * sizeof(float));
+            if (raw == NULL || out == NULL || fread(raw, 1, size, f) != size) {
+                fprintf(stderr, "%s: short read\n", path);
+                free(raw);
+                free(out);
+                out = NULL;
+                goto done;
+            }
+            for (uint32_t i = 0; i < *len; i++) {
+                const uint8_t *s = raw + (size_t)i * frame;
+                if (format == 1) {
+                    out[i] = (float)(int16_t)wav_le16(s) / 32768.0f;
+                } else {
+                    uint32_t u = wav_le32(s);
+                    memcpy(&out[i], &u, sizeof(float));
+                }
+            }
+            free(raw);
+            goto done;
+        } else {
+            fseek(f, (long)(size + (size & 1U)), SEEK_CUR);
+        }
+    }
+    fprintf(stderr, "%s: no audio data\n", path);
+
+done:
+    fclose(f);
+    return out;
+}
+
+static inline void wav_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+}
+
+// Mono PCM 16-bit, samples clipped to [-1, 1). Returns 0 on success.
+static inline int wav_write(const char *path, const float *x, uint32_t len, uint32_t rate)
+{
+    FILE *f = fopen(path, "wb");
+    uint8_t hdr[44];
+
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    memcpy(hdr, "RIFF", 4);
+    wav_put32(hdr + 4, 36U + 2U * len);
+    memcpy(hdr + 8, "WAVEfmt ", 8);
+    wav_put32(hdr + 16, 16U);
+    wav_put32(hdr + 20, 1U | (1U << 16));        // PCM, mono
+    wav_put32(hdr + 24, rate);
+    wav_put32(hdr + 28, 2U * rate);
+    wav_put32(hdr + 32, 2U | (16U << 16));       // block align, bits
+    memcpy(hdr + 36, "data", 4);
+    wav_put32(hdr + 40, 2U * len);
+    fwrite(hdr, 1, sizeof(hdr), f);
+
+    for (uint32_t i = 0; i < len; i++) {
+        float v = x[i] * 32768.0f;
+        int16_t s = (int16_t)(v >= 32767.0f ? 32767 : (v <= -32768.0f ? -32768 : (int32_t)lrintf(v)));
+        uint8_t b[2] = { (uint8_t)s, (uint8_t)((uint16_t)s >> 8) };
+        fwrite(b, 1, 2, f);
+    }
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+#endif /* WAV_IO_H */
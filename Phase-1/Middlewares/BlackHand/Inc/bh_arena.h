@@ -0,0 +1,40 @@
+/* bh_arena.h */
+
+#ifndef BH_ARENA_H
+#define BH_ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================
+   Bump Allocator
+   ============================================ */
+
+// Every allocation is rounded up to this many bytes so float32/q31
+// buffers can be handed straight to SIMD code on either target.
+#define BH_ARENA_ALIGN 16U
+
+/**
+ * @brief Fixed-size memory region carved up at init time.
+ *        Nothing is ever freed individually; reset the whole arena instead.
+ */
+typedef struct {
+    uint8_t *base;
+    size_t   size;
+    size_t   used;
+} bh_arena_t;
+
+void   bh_arena_init(bh_arena_t *arena, void *buffer, size_t size);
+void  *bh_arena_alloc(bh_arena_t *arena, size_t bytes);
+void   bh_arena_reset(bh_arena_t *arena);
+size_t bh_arena_remaining(const bh_arena_t *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BH_ARENA_H */
@@ -0,0 +1,29 @@
+/* bh_cycles.h */
+
+#ifndef BH_CYCLES_H
+#define BH_CYCLES_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================
+   Cycle Counter
+   ============================================ */
+
+// Cortex-M4: DWT->CYCCNT core clock cycles (wraps every ~24 s at 180 MHz).
+// x86-64:    TSC ticks.
+// Other hosts: CLOCK_MONOTONIC nanoseconds.
+// Only differences of two readings are meaningful; unsigned subtraction
+// handles the 32-bit wrap.
+
+void     bh_cycles_init(void);
+uint32_t bh_cycles_now(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BH_CYCLES_H */
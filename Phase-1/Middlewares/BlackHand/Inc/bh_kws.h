@@ -0,0 +1,160 @@
+/* bh_kws.h */
+
+#ifndef BH_KWS_H
+#define BH_KWS_H
+
+#include "arm_math.h"
+#include "bh_arena.h"
+#include "bh_nn_graph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================
+   Always-On Keyword Spotter
+   ============================================
+
+   Streaming front end, int8 classifier and decision logic for a wake word,
+   all in one arena:
+
+     - samples (Q15, or raw ADC codes straight from the DMA half-buffer)
+       go through arm_logmel_stream_q15 / arm_logmel_stream_adc_q15, which
+       append one log-mel (or MFCC) row per hop to a rolling matrix;
+     - every `stride` hops the matrix is quantized to the model input and
+       the model runs through bh_nn_graph (a DS-CNN: depthwise and 1x1
+       convolutions, average pooling, a fully connected layer and softmax);
+     - the class posteriors are averaged over the last `smooth` inferences,
+       and a keyword whose average reaches `threshold` is reported through
+       the notify callback, once per `refractory` inferences.
+
+   Each inference (quantize, invoke, decide) is timed with bh_cycles and
+   held against a fixed budget: one that overruns it delays the next by a
+   stride, so the spotter never takes more than budget / stride of the CPU
+   on average, whatever the model costs.
+
+   Typical use (firmware, ADC DMA half/full callbacks notify the task):
+
+       static uint8_t mem[KWS_ARENA_BYTES + BH_KWS_FRONT_END_BYTES(1024, 640, 40, 10, 49)];
+       bh_arena_t arena;
+       bh_kws_t kws;
+
+       bh_arena_init(&arena, mem, sizeof(mem));
+       bh_kws_init(&kws, &arena, &cfg);                // cfg.plan = &kws_plan
+       for (;;) {
+           wait for a half-buffer;
+           bh_kws_process_adc(&kws, half, KWS_BLOCK);   // cfg.notify fires on detection
+       }
+
+   The model input is {1, num_rows, row_len, 1} int8 and its output holds one
+   softmax score per class; classes below `first_keyword` are background
+   (silence, unknown words) and are never reported.
+*/
+
+#define BH_KWS_MAX_CLASSES  16U             // Softmax outputs
+#define BH_KWS_MAX_SMOOTH   16U             // Inferences averaged
+
+/**
+ * @brief Detection callback
+ * @param ctx: User context from the config
+ * @param label: Class index of the keyword
+ * @param score: Smoothed posterior, 0..255
+ */
+typedef void (*bh_kws_fn)(void *ctx, uint32_t label, uint8_t score);
+
+typedef struct {
+    // Front end: Hann window, Mel filters from 20 Hz to Nyquist, DCT-II (num_dct 0: log-mel rows)
+    uint32_t sample_rate;
+    uint32_t fft_len;
+    uint32_t win_len;
+    uint32_t hop_len;
+    uint32_t num_mels;
+    uint32_t num_dct;
+    uint32_t num_rows;              // Rows of the feature matrix, the model input height
+
+    // Model; plan NULL plans it at init. model NULL: front end only
+    const void *model;
+    uint32_t model_size;
+    const bh_nn_plan_t *plan;
+    float32_t input_scale;          // Feature value (natural log units) per input LSB, 0 if unknown
+    int32_t input_zp;               // Input zero point
+
+    // Decision
+    uint32_t stride;                // Hops between inferences
+    uint32_t smooth;                // Inferences averaged, 1..BH_KWS_MAX_SMOOTH
+    uint32_t first_keyword;         // Classes from here on are keywords
+    uint8_t threshold;              // Smoothed posterior to report, 0..255
+    uint32_t refractory;            // Inferences ignored after a detection
+    uint32_t budget_cycles;         // Per inference, 0 for no budget
+
+    bh_kws_fn notify;
+    void *ctx;
+} bh_kws_config_t;
+
+typedef struct {
+    bh_kws_config_t cfg;
+    arm_logmel_stream_instance_q15 fe;
+    q15_t *features;                // rows x row_len, oldest row first
+    uint32_t rows;
+    uint32_t row_len;
+    q31_t *fe_state;
+    q15_t *window;
+    q15_t *filter_coefs;
+    uint32_t *filter_pos;
+    uint32_t *filter_len;
+    q15_t *dct;
+    int32_t input_mult;             // Q8.7 feature to input LSB, Q16
+
+    bh_nn_graph_t graph;
+    uint8_t has_model;
+    uint32_t num_classes;
+
+    // Decision state
+    uint32_t hops;                  // Rows since reset
+    uint32_t due;                   // Hops until the next inference
+    uint32_t hold;                  // Inferences left in the refractory period
+    uint32_t filled;                // Inferences in the history
+    uint32_t head;
+    uint8_t history[BH_KWS_MAX_SMOOTH][BH_KWS_MAX_CLASSES];
+    uint16_t sum[BH_KWS_MAX_CLASSES];
+    uint8_t score[BH_KWS_MAX_CLASSES];  // Smoothed posteriors of the last inference
+
+    // Profiling (bh_cycles ticks)
+    uint32_t fe_cycles_last;        // Front end, per block
+    uint64_t fe_cycles_total;
+    uint32_t cycles_last;           // Per inference
+    uint32_t cycles_max;
+    uint64_t cycles_total;
+    uint32_t inferences;
+    uint32_t over_budget;           // Inferences longer than budget_cycles
+    uint32_t skipped;               // Inferences not run (overrun or hops arriving faster than a block)
+    uint32_t detections;
+} bh_kws_t;
+
+// Arena bytes the front end takes on top of the graph (see BH_NN_ARENA_BYTES)
+#define BH_KWS_FRONT_END_BYTES(fft_len, win_len, mels, dct, rows)                                  \
+    (BH_NN_ROUND((win_len) * 2U) + 2U * BH_NN_ROUND((mels) * 4U) + BH_NN_ROUND(((fft_len) + 2U) * 2U) + \
+     BH_NN_ROUND((dct) * (mels) * 2U) + BH_NN_ROUND((rows) * ((dct) ? (dct) : (mels)) * 2U) +        \
+     BH_NN_ROUND(ARM_LOGMEL_STREAM_STATE_SIZE_Q15(fft_len, win_len, mels) * 4U))
+
+// Setup
+arm_status bh_kws_init(bh_kws_t *k, bh_arena_t *arena, const bh_kws_config_t *cfg);
+void       bh_kws_reset(bh_kws_t *k);
+
+// Runtime
+arm_status bh_kws_process_q15(bh_kws_t *k, const q15_t *src, uint32_t len);
+arm_status bh_kws_process_adc(bh_kws_t *k, const uint16_t *codes, uint32_t len);
+arm_status bh_kws_infer(bh_kws_t *k);
+
+// Features
+const q15_t *bh_kws_features(const bh_kws_t *k);
+void         bh_kws_quantize(const bh_kws_t *k, const q15_t *features, int8_t *dst);
+
+// Profiling
+void bh_kws_reset_stats(bh_kws_t *k);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BH_KWS_H */
@@ -0,0 +1,291 @@
+/* bh_nn_graph.h */
+
+#ifndef BH_NN_GRAPH_H
+#define BH_NN_GRAPH_H
+
+#include "arm_nnfunctions.h"
+#include "bh_arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================
+   CMSIS-NN Graph Runtime
+   ============================================
+
+   Runs a whole int8 model, stored in the compact "BHNN" format below,
+   through the CMSIS-NN s8 kernels. The model is used in place (it can
+   live in flash); everything the runtime needs at run time comes from one
+   arena at init:
+
+     - the activation region: every activation tensor gets a fixed offset,
+       planned from tensor lifetimes so tensors that are never live at the
+       same time share memory. RELU6, ADD and RESHAPE write over an input
+       that dies at that layer (in place);
+     - one scratch buffer, sized from the largest *_get_buffer_size() of
+       all layers and shared by them;
+     - persistent state (SVDF history), cleared by bh_nn_graph_reset_state();
+     - per-layer cycle counters.
+
+   For finding the layer that makes a model slow or inaccurate there is
+   more, all off the hot path unless asked for: bh_nn_graph_layer_cost()
+   gives the MACs and bytes a layer moves, bh_nn_graph_set_output_stats()
+   keeps range and saturation statistics of every layer output, and
+   bh_nn_graph_set_hook() hands each output to a callback as it is made
+   (Host/tools/nn_profile.c compares them against a float reference).
+
+   Typical use:
+
+       static uint8_t mem[64 * 1024];
+       bh_arena_t arena;
+       bh_nn_graph_t g;
+
+       bh_arena_init(&arena, mem, sizeof(mem));
+       bh_nn_graph_init(&g, &arena, model_bhnn, sizeof(model_bhnn));
+
+       memcpy(bh_nn_graph_input(&g), features, bh_nn_graph_input_bytes(&g));
+       bh_nn_graph_invoke(&g);
+       scores = bh_nn_graph_output(&g);
+
+   The plan can also be computed offline (Host/tools/nn_planner.c), which
+   writes a header with the offsets and the exact arena size; the firmware
+   then calls bh_nn_graph_init_planned() on a static buffer of
+   <NAME>_ARENA_BYTES and nothing is planned or sized on the target.
+
+   Model layout (little endian, every section 4-byte aligned, offsets from
+   the start of the model):
+
+       bh_nn_header_t
+       bh_nn_tensor_t  tensors[num_tensors]
+       bh_nn_layer_t   layers[num_layers]      in execution order
+       constant data   weights, biases, per-channel multipliers/shifts
+
+   Tensor dims are stored exactly as the kernels expect them for the role
+   the tensor plays (see bh_nn_op_t), so they are handed to CMSIS-NN
+   without conversion.
+*/
+
+#define BH_NN_MAGIC         0x4E4E4842U     // "BHNN"
+#define BH_NN_VERSION       1U
+#define BH_NN_MAX_INPUTS    6U              // Tensor operands per layer
+#define BH_NN_MAX_PARAMS    12U             // int32 parameters per layer
+#define BH_NN_NONE          0xFFFFU         // Unused operand slot
+#define BH_NN_NO_OFFSET     0xFFFFFFFFU     // Plan entry of a constant tensor
+
+typedef enum {
+    BH_NN_S8 = 0,
+    BH_NN_S16,
+    BH_NN_S32
+} bh_nn_type_t;
+
+typedef enum {
+    BH_NN_CONST = 0,        // Data stored in the model
+    BH_NN_ACTIVATION,       // Planned into the activation region
+    BH_NN_STATE             // Persistent across invokes, zeroed at init
+} bh_nn_kind_t;
+
+/*
+ * Operand and parameter layout of each op. Dims follow the CMSIS-NN
+ * prototypes: filter {Cout, Kh, Kw, Cin} for CONV, {1, Kh, Kw, Cout} for
+ * DW_CONV, {depth, 1, 1, Cout} for FC.
+ *
+ *   CONV     in: input, filter, bias(s32), mult(s32), shift(s32)
+ *            p:  input_offset, output_offset, stride_w, stride_h, pad_w, pad_h,
+ *                dilation_w, dilation_h, act_min, act_max
+ *   DW_CONV  as CONV, p[10] = ch_mult
+ *   FC       in: input, filter, bias(s32)
+ *            p:  input_offset, filter_offset, output_offset, act_min, act_max,
+ *                multiplier, shift
+ *   AVGPOOL, MAXPOOL
+ *            in: input
+ *            p:  stride_w, stride_h, pad_w, pad_h, act_min, act_max, filter_w, filter_h
+ *   SOFTMAX  in: input (rows of C values)
+ *            p:  mult, shift, diff_min
+ *   ADD      in: input1, input2
+ *            p:  in1_offset, in1_mult, in1_shift, in2_offset, in2_mult, in2_shift,
+ *                left_shift, out_offset, out_mult, out_shift, act_min, act_max
+ *   RELU6    in: input
+ *   RESHAPE  in: input (same element count as the output)
+ *   SVDF     in: input, state(STATE), weights_feature, weights_time, bias(s32)
+ *            p:  rank, input_offset, output_offset, in_act_min, in_act_max,
+ *                out_act_min, out_act_max, in_mult, in_shift, out_mult, out_shift
+ *   CONV_PACKED
+ *            in: input, packed filter, kernel sums(s32), mult(s32), shift(s32)
+ *            p:  as CONV, p[10] = kernel_h, p[11] = kernel_w
+ *   FC_PACKED
+ *            in: input, packed filter, kernel sums(s32)
+ *            p:  as FC
+ *   CONV_POOL
+ *            in: as CONV
+ *            p:  as CONV, p[10] = BH_NN_OP_MAXPOOL or BH_NN_OP_AVGPOOL; the
+ *                output is the conv output after a 2x2 stride 2 pooling
+ *
+ * The packed ops take the output of arm_nn_pack_weights_s8(), written by
+ * Host/tools/nn_pack.c: a filter of {Cout, 1, 1, depth rounded up to 4} and
+ * bias + input_offset * sum(weights) per channel in place of the bias.
+ */
+typedef enum {
+    BH_NN_OP_CONV = 0,      // arm_convolve_wrapper_s8
+    BH_NN_OP_DW_CONV,       // arm_depthwise_conv_wrapper_s8
+    BH_NN_OP_FC,            // arm_fully_connected_s8
+    BH_NN_OP_AVGPOOL,       // arm_avgpool_s8
+    BH_NN_OP_MAXPOOL,       // arm_max_pool_s8
+    BH_NN_OP_SOFTMAX,       // arm_softmax_s8
+    BH_NN_OP_ADD,           // arm_elementwise_add_s8
+    BH_NN_OP_RELU6,         // arm_relu6_s8
+    BH_NN_OP_RESHAPE,       // arm_reshape_s8
+    BH_NN_OP_SVDF,          // arm_svdf_s8
+    BH_NN_OP_CONV_PACKED,   // arm_convolve_packed_s8
+    BH_NN_OP_FC_PACKED,     // arm_fully_connected_packed_s8
+    BH_NN_OP_CONV_POOL,     // arm_convolve_max_pool_2x2_s8, arm_convolve_avg_pool_2x2_s8
+    BH_NN_OP_COUNT
+} bh_nn_op_t;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t num_tensors;
+    uint16_t num_layers;
+    uint16_t input;         // Graph input tensor
+    uint16_t output;        // Graph output tensor
+    uint16_t reserved;
+    uint32_t size;          // Bytes in the whole model
+} bh_nn_header_t;
+
+typedef struct {
+    cmsis_nn_dims dims;
+    uint8_t  type;          // bh_nn_type_t
+    uint8_t  kind;          // bh_nn_kind_t
+    uint16_t reserved;
+    uint32_t offset;        // BH_NN_CONST: data offset in the model
+} bh_nn_tensor_t;
+
+typedef struct {
+    uint8_t  op;            // bh_nn_op_t
+    uint8_t  num_inputs;
+    uint16_t output;
+    uint16_t inputs[BH_NN_MAX_INPUTS];
+    int32_t  params[BH_NN_MAX_PARAMS];
+} bh_nn_layer_t;
+
+typedef struct {
+    uint32_t cycles_last;
+    uint32_t cycles_max;
+    uint64_t cycles_total;
+    uint32_t runs;
+} bh_nn_layer_stats_t;
+
+/**
+ * @brief Work of one invoke of a layer, from its dims alone
+ * @note input_bytes counts what the kernel gathers: every filter tap of a
+ *       CONV, DW_CONV or pooling window (the im2col / window reads), every
+ *       element once for the other ops. Traffic estimate = weight_bytes +
+ *       input_bytes + output_bytes; caches and kernel-specific rereads of
+ *       the weights are not modelled.
+ */
+typedef struct {
+    uint64_t macs;              // Multiply-accumulates; element ops for pooling, softmax, add, relu6
+    uint32_t weight_bytes;      // Constant operands (weights, bias, multipliers, shifts)
+    uint32_t input_bytes;       // Activation and state reads
+    uint32_t output_bytes;      // Activation and state writes
+    uint32_t scratch_bytes;     // Kernel scratch of this build
+} bh_nn_layer_cost_t;
+
+/**
+ * @brief Statistics of a layer's int8 output, over every invoke since enabled or reset
+ */
+typedef struct {
+    uint64_t count;             // Elements seen
+    int64_t  sum;
+    uint64_t sum_sq;
+    uint32_t at_min;            // Elements at -128
+    uint32_t at_max;            // Elements at 127
+    int8_t   min;
+    int8_t   max;
+    uint16_t reserved;
+} bh_nn_output_stats_t;
+
+/**
+ * @brief Called by bh_nn_graph_invoke() after each layer, outside its cycle count
+ * @note The layer's output is at g->data[g->layers[layer].output] until a later
+ *       layer reuses the memory.
+ */
+struct bh_nn_graph;
+typedef void (*bh_nn_layer_hook_t)(void *ctx, const struct bh_nn_graph *g, uint32_t layer);
+
+/**
+ * @brief Memory plan computed offline
+ * @note offsets[t] is the byte offset of tensor t in the activation region
+ *       (BH_NN_ACTIVATION) or the state region (BH_NN_STATE), BH_NN_NO_OFFSET
+ *       for constants. Tensors may share bytes only when their lifetimes do
+ *       not overlap or the layer runs in place.
+ */
+typedef struct {
+    uint16_t num_tensors;
+    uint16_t num_layers;
+    uint32_t activation_bytes;
+    uint32_t scratch_bytes;         // For the target the plan was made for
+    uint32_t state_bytes;
+    const uint32_t *offsets;
+} bh_nn_plan_t;
+
+// Arena bytes bh_nn_graph_init_planned() takes, for sizing a static buffer
+// (one extra BH_ARENA_ALIGN covers a buffer that is not aligned itself)
+#define BH_NN_ROUND(bytes)  (((bytes) + BH_ARENA_ALIGN - 1U) & ~(BH_ARENA_ALIGN - 1U))
+#define BH_NN_ARENA_BYTES(num_tensors, num_layers, activation, scratch, state)          \
+    (BH_ARENA_ALIGN + BH_NN_ROUND((num_tensors) * sizeof(void *)) +                       \
+     BH_NN_ROUND((num_layers) * sizeof(bh_nn_layer_stats_t)) + BH_NN_ROUND(activation) + \
+     BH_NN_ROUND(scratch) + BH_NN_ROUND(state))
+
+typedef struct bh_nn_graph {
+    const uint8_t *model;
+    const bh_nn_header_t *header;
+    const bh_nn_tensor_t *tensors;
+    const bh_nn_layer_t *layers;
+    void **data;                    // Per tensor: model, activation region or state
+    uint8_t *activations;
+    uint32_t activation_bytes;      // Planned size of the activation region
+    uint8_t *state;
+    uint32_t state_bytes;
+    cmsis_nn_context scratch;       // Shared by every layer
+    bh_nn_layer_stats_t *stats;
+    bh_nn_output_stats_t *outputs;  // Optional, see bh_nn_graph_set_output_stats()
+    bh_nn_layer_hook_t hook;        // Optional, see bh_nn_graph_set_hook()
+    void *hook_ctx;
+} bh_nn_graph_t;
+
+// Setup
+arm_status bh_nn_graph_init(bh_nn_graph_t *g, bh_arena_t *arena, const void *model, size_t model_size);
+arm_status bh_nn_graph_init_planned(bh_nn_graph_t *g, bh_arena_t *arena, const void *model, size_t model_size,
+                                    const bh_nn_plan_t *plan);
+void       bh_nn_graph_reset_state(bh_nn_graph_t *g);
+
+// Planning (shared with the offline planner)
+arm_status bh_nn_graph_load(bh_nn_graph_t *g, const void *model, size_t model_size);
+void       bh_nn_graph_lifetimes(const bh_nn_graph_t *g, int32_t *first, int32_t *last, uint16_t *root);
+int32_t    bh_nn_graph_layer_scratch(const bh_nn_graph_t *g, uint32_t layer);
+
+// Runtime
+arm_status bh_nn_graph_invoke(bh_nn_graph_t *g);
+int8_t    *bh_nn_graph_input(const bh_nn_graph_t *g);
+uint32_t   bh_nn_graph_input_bytes(const bh_nn_graph_t *g);
+int8_t    *bh_nn_graph_output(const bh_nn_graph_t *g);
+uint32_t   bh_nn_graph_output_bytes(const bh_nn_graph_t *g);
+
+// Inspection
+uint32_t    bh_nn_tensor_bytes(const bh_nn_tensor_t *t);
+const char *bh_nn_op_name(uint8_t op);
+
+// Profiling
+uint32_t bh_nn_graph_layer_cycles(const bh_nn_graph_t *g, uint32_t layer);
+void     bh_nn_graph_reset_stats(bh_nn_graph_t *g);
+void     bh_nn_graph_layer_cost(const bh_nn_graph_t *g, uint32_t layer, bh_nn_layer_cost_t *cost);
+void     bh_nn_graph_set_output_stats(bh_nn_graph_t *g, bh_nn_output_stats_t *stats);
+void     bh_nn_graph_set_hook(bh_nn_graph_t *g, bh_nn_layer_hook_t hook, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BH_NN_GRAPH_H */
@@ -0,0 +1,97 @@
+/* bh_nn_parallel.h */
+
+#ifndef BH_NN_PARALLEL_H
+#define BH_NN_PARALLEL_H
+
+#include "arm_nnfunctions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================
+   Multithreaded CMSIS-NN Layers
+   ============================================
+
+   Drop-in versions of arm_convolve_wrapper_s8 and arm_fully_connected_s8
+   that split one call across the CMSIS-DSP worker pool (arm_parallel_run,
+   Linux hosts built with ARM_MATH_PTHREAD). Every part runs the unmodified
+   CMSIS-NN kernel on its share, so results are bit-identical to the
+   single-threaded call for any thread count.
+
+   How a call is split, for a team of P parts:
+
+     - n >= P: whole batches per part (clips of an offline evaluation);
+     - 1x1 convolutions that take arm_convolve_1x1_s8_fast: output pixels
+       of all batches per part, a pointwise layer being a fully connected
+       layer over n * h * w rows;
+     - otherwise output channels, in steps of `chunk` channels (a multiple
+       of 4) handed out round robin. A fully connected part writes its
+       channels in place; a convolution part computes one batch of a step
+       into its own staging buffer and copies it into the NHWC output.
+
+   The context holds one slice per thread, each with the kernel's own
+   scratch (*_get_buffer_size() of the wrapped kernel) followed by the
+   staging buffer. Both sizes and the channel step follow from the thread
+   count, so the count passed to bh_nn_parallel_*_get_buffer_size() must be
+   the one passed to the layer; 0 means one thread per online CPU (see
+   bh_nn_parallel_threads()). A team can come out smaller than asked for
+   (pool busy, small layer); the parts then take more steps each and the
+   slices still fit.
+
+       uint32_t threads = bh_nn_parallel_threads(0);
+       cmsis_nn_context ctx;
+
+       ctx.size = bh_nn_parallel_conv_s8_get_buffer_size(threads, &cp, &in_dims, &f_dims, &out_dims);
+       ctx.buf = malloc(ctx.size);
+       bh_nn_parallel_conv_s8(threads, &ctx, &cp, &qp, &in_dims, in, &f_dims, w, &b_dims, b, &out_dims, out);
+
+   Without ARM_MATH_PTHREAD (the firmware) the functions run on the caller
+   with a single slice and behave exactly like the wrapped kernels.
+*/
+
+// Least multiply-accumulates worth waking one more worker for
+#define BH_NN_PARALLEL_MIN_MACS     (64U * 1024U)
+
+// Thread count a request resolves to (0: online CPUs, capped at the pool size)
+uint32_t bh_nn_parallel_threads(uint32_t requested);
+
+// Convolution (arm_convolve_wrapper_s8)
+int32_t    bh_nn_parallel_conv_s8_get_buffer_size(uint32_t threads,
+                                                  const cmsis_nn_conv_params *conv_params,
+                                                  const cmsis_nn_dims *input_dims,
+                                                  const cmsis_nn_dims *filter_dims,
+                                                  const cmsis_nn_dims *output_dims);
+arm_status bh_nn_parallel_conv_s8(uint32_t threads,
+                                  const cmsis_nn_context *ctx,
+                                  const cmsis_nn_conv_params *conv_params,
+                                  const cmsis_nn_per_channel_quant_params *quant_params,
+                                  const cmsis_nn_dims *input_dims,
+                                  const q7_t *input_data,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const q7_t *filter_data,
+                                  const cmsis_nn_dims *bias_dims,
+                                  const int32_t *bias_data,
+                                  const cmsis_nn_dims *output_dims,
+                                  q7_t *output_data);
+
+// Fully connected (arm_fully_connected_s8)
+int32_t    bh_nn_parallel_fc_s8_get_buffer_size(uint32_t threads, const cmsis_nn_dims *filter_dims);
+arm_status bh_nn_parallel_fc_s8(uint32_t threads,
+                                const cmsis_nn_context *ctx,
+                                const cmsis_nn_fc_params *fc_params,
+                                const cmsis_nn_per_tensor_quant_params *quant_params,
+                                const cmsis_nn_dims *input_dims,
+                                const q7_t *input_data,
+                                const cmsis_nn_dims *filter_dims,
+                                const q7_t *filter_data,
+                                const cmsis_nn_dims *bias_dims,
+                                const int32_t *bias_data,
+                                const cmsis_nn_dims *output_dims,
+                                q7_t *output_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BH_NN_PARALLEL_H */
@@ -0,0 +1,120 @@
+/* bh_pipeline.h */
+
+#ifndef BH_PIPELINE_H
+#define BH_PIPELINE_H
+
+#include "arm_math.h"
+#include "bh_arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================
+   Streaming DSP Pipeline
+   ============================================
+
+   Chains CMSIS-DSP blocks with a fixed block size. All filter state and
+   the two ping-pong work buffers come from one arena, so the pipeline
+   never touches the heap after setup and runs the same on the F429 and
+   on Linux.
+
+   Typical use:
+
+       static uint8_t mem[8192];
+       bh_arena_t arena;
+       bh_pipeline_t pipe;
+
+       bh_arena_init(&arena, mem, sizeof(mem));
+       bh_pipeline_init(&pipe, &arena, 1024);
+       bh_pipeline_add_biquad(&pipe, 2, hpf_coeffs);       // 1024 -> 1024
+       bh_pipeline_add_fir_decimate(&pipe, 32, 4, lpf);    // 1024 -> 256
+       bh_pipeline_add_rfft(&pipe);                        // 256  -> 256
+       bh_pipeline_add_cmplx_mag(&pipe);                   // 256  -> 128
+       bh_pipeline_finalize(&pipe);
+
+       for (;;) bh_pipeline_process(&pipe, adc_block, spectrum);
+
+   Stages are validated as they are added: each stage's input length is
+   the previous stage's output length.
+*/
+
+#define BH_PIPELINE_MAX_STAGES 8U
+
+typedef enum {
+    BH_STAGE_BIQUAD_DF2T = 0,   // arm_biquad_cascade_df2T_f32, in place
+    BH_STAGE_FIR_DECIMATE,      // arm_fir_decimate_f32
+    BH_STAGE_RFFT,              // arm_rfft_fast_f32, clobbers its input
+    BH_STAGE_CMPLX_MAG,         // arm_cmplx_mag_f32, in place
+    BH_STAGE_CUSTOM             // user callback
+} bh_stage_kind_t;
+
+/**
+ * @brief Custom stage callback
+ * @param ctx: User context given to bh_pipeline_add_custom()
+ * @param src: in_len input samples
+ * @param dst: out_len output samples (may equal src for in-place stages)
+ */
+typedef void (*bh_stage_fn)(void *ctx, const float32_t *src, float32_t *dst);
+
+typedef struct {
+    bh_stage_kind_t kind;
+    uint32_t in_len;
+    uint32_t out_len;
+    uint8_t  in_place;          // Output may overwrite input
+    uint8_t  clobbers_input;    // Input is scratch after the call
+    float32_t *state;           // Arena-owned filter history
+    uint32_t state_len;
+
+    union {
+        arm_biquad_cascade_df2T_instance_f32 biquad;
+        arm_fir_decimate_instance_f32        decimate;
+        arm_rfft_fast_instance_f32           rfft;
+        struct {
+            bh_stage_fn fn;
+            void *ctx;
+        } custom;
+    } u;
+
+    // Profiling (bh_cycles ticks)
+    uint32_t cycles_last;
+    uint32_t cycles_max;
+    uint64_t cycles_total;
+    uint32_t blocks;
+} bh_stage_t;
+
+typedef struct {
+    bh_arena_t *arena;
+    uint32_t block_size;        // Samples consumed per bh_pipeline_process()
+    uint32_t num_stages;
+    uint32_t work_len;          // Samples per work buffer
+    float32_t *work[2];
+    uint8_t finalized;
+    bh_stage_t stages[BH_PIPELINE_MAX_STAGES];
+} bh_pipeline_t;
+
+// Setup
+arm_status bh_pipeline_init(bh_pipeline_t *p, bh_arena_t *arena, uint32_t block_size);
+arm_status bh_pipeline_add_biquad(bh_pipeline_t *p, uint8_t num_stages, const float32_t *coeffs);
+arm_status bh_pipeline_add_fir_decimate(bh_pipeline_t *p, uint16_t num_taps, uint8_t m,
+                                        const float32_t *coeffs);
+arm_status bh_pipeline_add_rfft(bh_pipeline_t *p);
+arm_status bh_pipeline_add_cmplx_mag(bh_pipeline_t *p);
+arm_status bh_pipeline_add_custom(bh_pipeline_t *p, bh_stage_fn fn, void *ctx,
+                                  uint32_t out_len, uint8_t in_place);
+arm_status bh_pipeline_finalize(bh_pipeline_t *p);
+
+// Runtime
+arm_status bh_pipeline_process(bh_pipeline_t *p, const float32_t *src, float32_t *dst);
+uint32_t   bh_pipeline_output_len(const bh_pipeline_t *p);
+void       bh_pipeline_reset(bh_pipeline_t *p);
+
+// Profiling
+uint32_t bh_pipeline_stage_cycles(const bh_pipeline_t *p, uint32_t stage);
+void     bh_pipeline_reset_stats(bh_pipeline_t *p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BH_PIPELINE_H */
@@ -0,0 +1,61 @@
+/* bh_arena.c */
+
+#include "bh_arena.h"
+
+/**
+ * @brief Attach an arena to a caller-owned buffer
+ * @param arena: Arena to initialize
+ * @param buffer: Backing storage (static array on the MCU)
+ * @param size: Size of buffer in bytes
+ */
+void bh_arena_init(bh_arena_t *arena, void *buffer, size_t size)
+{
+    uintptr_t addr = (uintptr_t)buffer;
+    size_t skip = (BH_ARENA_ALIGN - (addr % BH_ARENA_ALIGN)) % BH_ARENA_ALIGN;
+
+    // Align the base once so every later offset stays aligned
+    if (buffer == NULL || size < skip) {
+        arena->base = NULL;
+        arena->size = 0;
+    } else {
+        arena->base = (uint8_t *)buffer + skip;
+        arena->size = size - skip;
+    }
+    arena->used = 0;
+}
+
+/**
+ * @brief Take bytes from the arena
+ * @param arena: Arena to allocate from
+ * @param bytes: Number of bytes requested
+ * @return Aligned pointer, or NULL when the arena is exhausted
+ */
+void *bh_arena_alloc(bh_arena_t *arena, size_t bytes)
+{
+    size_t rounded = (bytes + BH_ARENA_ALIGN - 1U) & ~(size_t)(BH_ARENA_ALIGN - 1U);
+
+    if (rounded > arena->size - arena->used) return NULL;
+
+    void *ptr = arena->base + arena->used;
+    arena->used += rounded;
+    return ptr;
+}
+
+/**
+ * @brief Release every allocation at once
+ * @param arena: Arena to reset
+ */
+void bh_arena_reset(bh_arena_t *arena)
+{
+    arena->used = 0;
+}
+
+/**
+ * @brief Bytes still available
+ * @param arena: Arena to query
+ * @return Remaining capacity in bytes
+ */
+size_t bh_arena_remaining(const bh_arena_t *arena)
+{
+    return arena->size - arena->used;
+}
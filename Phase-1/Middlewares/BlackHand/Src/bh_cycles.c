@@ -0,0 +1,75 @@
+/* bh_cycles.c */
+
+#include "bh_cycles.h"
+
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+
+/* ============================================
+   Cortex-M: DWT cycle counter
+   ============================================ */
+
+#define DEMCR        (*(volatile uint32_t *)0xE000EDFCU)
+#define DWT_CTRL     (*(volatile uint32_t *)0xE0001000U)
+#define DWT_CYCCNT   (*(volatile uint32_t *)0xE0001004U)
+#define DWT_LAR      (*(volatile uint32_t *)0xE0001FB0U)
+
+#define DEMCR_TRCENA      (1UL << 24)
+#define DWT_CTRL_CYCCNTENA (1UL << 0)
+
+/**
+ * @brief Enable trace and start the free-running cycle counter
+ */
+void bh_cycles_init(void)
+{
+    DEMCR |= DEMCR_TRCENA;
+    DWT_LAR = 0xC5ACCE55U;      // Unlock (ignored on parts without a lock)
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief Read the cycle counter
+ * @return Core clock cycles since bh_cycles_init()
+ */
+uint32_t bh_cycles_now(void)
+{
+    return DWT_CYCCNT;
+}
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+/* ============================================
+   x86 host: time-stamp counter
+   ============================================ */
+
+#include <x86intrin.h>
+
+void bh_cycles_init(void)
+{
+}
+
+uint32_t bh_cycles_now(void)
+{
+    return (uint32_t)__rdtsc();
+}
+
+#else
+
+/* ============================================
+   Other hosts: monotonic clock in ns
+   ============================================ */
+
+#include <time.h>
+
+void bh_cycles_init(void)
+{
+}
+
+uint32_t bh_cycles_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+#endif
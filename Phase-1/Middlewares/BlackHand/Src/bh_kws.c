@@ -0,0 +1,390 @@
+/* bh_kws.c */
+
+#include "bh_kws.h"
+#include "bh_cycles.h"
+
+#include <math.h>
+#include <string.h>
+
+/* ============================================
+   Private Helpers
+   ============================================ */
+
+/**
+ * @brief Round and saturate a float to Q15
+ */
+static q15_t bh_kws_to_q15(float32_t x)
+{
+    float32_t v = x * 32768.0f;
+    int32_t q = (int32_t)(v + ((v >= 0.0f) ? 0.5f : -0.5f));
+
+    return (q15_t)((q > 32767) ? 32767 : (q < -32768) ? -32768 : q);
+}
+
+static float32_t bh_kws_hz_to_mel(float32_t hz) { return 1127.0f * logf(1.0f + hz / 700.0f); }
+static float32_t bh_kws_mel_to_hz(float32_t m)  { return 700.0f * (expf(m / 1127.0f) - 1.0f); }
+
+/**
+ * @brief FFT bin of the i-th of num_mels + 2 Mel band edges, 20 Hz to Nyquist
+ */
+static uint32_t bh_kws_mel_bin(const bh_kws_config_t *cfg, uint32_t i)
+{
+    float32_t lo = bh_kws_hz_to_mel(20.0f), hi = bh_kws_hz_to_mel(0.5f * (float32_t)cfg->sample_rate);
+    float32_t hz = bh_kws_mel_to_hz(lo + (hi - lo) * (float32_t)i / (float32_t)(cfg->num_mels + 1U));
+
+    return (uint32_t)(hz * (float32_t)cfg->fft_len / (float32_t)cfg->sample_rate + 0.5f);
+}
+
+/**
+ * @brief Build the window, Mel filter and DCT tables in the arena
+ * @note Same tables as Host/tools/logmel_harness.c: Hann window, triangular
+ *       filters with unit peaks, orthogonal DCT-II scaled by sqrt(2 / mels).
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR (more filter weights than
+ *         fft_len + 2) or ARM_MATH_LENGTH_ERROR (arena too small)
+ */
+static arm_status bh_kws_tables(bh_kws_t *k, bh_arena_t *arena)
+{
+    const bh_kws_config_t *cfg = &k->cfg;
+    uint32_t mels = cfg->num_mels, total = 0;
+
+    k->window = (q15_t *)bh_arena_alloc(arena, cfg->win_len * sizeof(q15_t));
+    k->filter_pos = (uint32_t *)bh_arena_alloc(arena, mels * sizeof(uint32_t));
+    k->filter_len = (uint32_t *)bh_arena_alloc(arena, mels * sizeof(uint32_t));
+    k->filter_coefs = (q15_t *)bh_arena_alloc(arena, (cfg->fft_len + 2U) * sizeof(q15_t));
+    k->dct = NULL;
+    if (cfg->num_dct != 0U) k->dct = (q15_t *)bh_arena_alloc(arena, cfg->num_dct * mels * sizeof(q15_t));
+    if (k->window == NULL || k->filter_pos == NULL || k->filter_len == NULL || k->filter_coefs == NULL
+        || (cfg->num_dct != 0U && k->dct == NULL)) {
+        return ARM_MATH_LENGTH_ERROR;
+    }
+
+    for (uint32_t i = 0; i < cfg->win_len; i++) {
+        k->window[i] = bh_kws_to_q15(0.5f - 0.5f * cosf(2.0f * PI * (float32_t)i / (float32_t)cfg->win_len));
+    }
+
+    for (uint32_t m = 0; m < mels; m++) {
+        uint32_t lo = bh_kws_mel_bin(cfg, m), mid = bh_kws_mel_bin(cfg, m + 1U), hi = bh_kws_mel_bin(cfg, m + 2U);
+        if (mid <= lo) mid = lo + 1U;
+        if (hi <= mid) hi = mid + 1U;
+        if (hi > cfg->fft_len / 2U + 1U || total + (hi - lo - 1U) > cfg->fft_len + 2U) return ARM_MATH_ARGUMENT_ERROR;
+
+        k->filter_pos[m] = lo + 1U;
+        k->filter_len[m] = hi - lo - 1U;
+        for (uint32_t b = lo + 1U; b < hi; b++) {
+            float32_t w = (b <= mid) ? (float32_t)(b - lo) / (float32_t)(mid - lo)
+                                     : (float32_t)(hi - b) / (float32_t)(hi - mid);
+            k->filter_coefs[total++] = bh_kws_to_q15(w);
+        }
+    }
+
+    for (uint32_t c = 0; c < cfg->num_dct; c++) {
+        for (uint32_t n = 0; n < mels; n++) {
+            k->dct[c * mels + n] = bh_kws_to_q15(sqrtf(2.0f / (float32_t)mels) *
+                                                 cosf(PI / (float32_t)mels * ((float32_t)n + 0.5f) * (float32_t)c));
+        }
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Check the model against the front end and the decision settings
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+ */
+static arm_status bh_kws_check_model(bh_kws_t *k)
+{
+    const bh_nn_graph_t *g = &k->graph;
+    const bh_nn_tensor_t *in = &g->tensors[g->header->input];
+    const bh_nn_tensor_t *out = &g->tensors[g->header->output];
+
+    if (in->type != BH_NN_S8 || out->type != BH_NN_S8) return ARM_MATH_ARGUMENT_ERROR;
+    if (in->dims.n != 1 || in->dims.h != (int32_t)k->rows || in->dims.w != (int32_t)k->row_len || in->dims.c != 1) {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    k->num_classes = bh_nn_tensor_bytes(out);
+    if (k->num_classes > BH_KWS_MAX_CLASSES || k->cfg.first_keyword >= k->num_classes) {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Add the posteriors of the last invoke to the history and report a keyword
+ */
+static void bh_kws_decide(bh_kws_t *k)
+{
+    const int8_t *out = bh_nn_graph_output(&k->graph);
+    uint8_t *slot = k->history[k->head];
+    uint32_t best = 0, best_score = 0;
+
+    // Running sums over the last `smooth` inferences
+    for (uint32_t c = 0; c < k->num_classes; c++) {
+        uint8_t p = (uint8_t)((int32_t)out[c] + 128);
+        if (k->filled == k->cfg.smooth) k->sum[c] -= slot[c];
+        k->sum[c] += p;
+        slot[c] = p;
+    }
+    if (k->filled < k->cfg.smooth) k->filled++;
+    if (++k->head == k->cfg.smooth) k->head = 0;
+
+    for (uint32_t c = 0; c < k->num_classes; c++) {
+        k->score[c] = (uint8_t)(k->sum[c] / k->filled);
+        if (c >= k->cfg.first_keyword && k->score[c] > best_score) {
+            best = c;
+            best_score = k->score[c];
+        }
+    }
+
+    if (k->hold != 0U) {
+        k->hold--;
+        return;
+    }
+    // A full history, so one confident frame is not enough
+    if (k->filled == k->cfg.smooth && best_score >= k->cfg.threshold) {
+        k->hold = k->cfg.refractory;
+        k->detections++;
+        if (k->cfg.notify != NULL) k->cfg.notify(k->cfg.ctx, best, (uint8_t)best_score);
+    }
+}
+
+/**
+ * @brief Count new rows and run the inference that fell due, if any
+ * @param rows: Rows the front end just added
+ */
+static arm_status bh_kws_advance(bh_kws_t *k, uint32_t rows)
+{
+    uint32_t pending = 0;
+
+    if (rows == 0U) return ARM_MATH_SUCCESS;
+    k->hops += rows;
+    if (!k->has_model) return ARM_MATH_SUCCESS;
+
+    while (rows >= k->due) {
+        rows -= k->due;
+        k->due = k->cfg.stride;
+        pending++;
+    }
+    k->due -= rows;
+
+    // Nothing before the matrix holds real rows only; then the latest window wins
+    if (pending == 0U || k->hops < k->rows) return ARM_MATH_SUCCESS;
+    k->skipped += pending - 1U;
+
+    arm_status status = bh_kws_infer(k);
+
+    // Overrun: give the time back by skipping the next slot
+    if (k->cfg.budget_cycles != 0U && k->cycles_last > k->cfg.budget_cycles) {
+        k->over_budget++;
+        k->skipped++;
+        k->due += k->cfg.stride;
+    }
+    return status;
+}
+
+/* ============================================
+   Setup
+   ============================================ */
+
+/**
+ * @brief Build the front end tables and load the model
+ * @note The config is copied; the model and plan must outlive the spotter.
+ * @param k: Spotter to initialize
+ * @param arena: Arena for the tables, front end state, features and graph
+ * @param cfg: Front end, model and decision settings
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR (bad settings, or a model
+ *         that does not match them) or ARM_MATH_LENGTH_ERROR (arena too small)
+ */
+arm_status bh_kws_init(bh_kws_t *k, bh_arena_t *arena, const bh_kws_config_t *cfg)
+{
+    if (k == NULL || arena == NULL || cfg == NULL) return ARM_MATH_ARGUMENT_ERROR;
+    if (cfg->sample_rate == 0U || cfg->num_mels == 0U || cfg->num_dct > cfg->num_mels || cfg->num_rows == 0U) {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    memset(k, 0, sizeof(*k));
+    k->cfg = *cfg;
+    k->rows = cfg->num_rows;
+    k->row_len = cfg->num_dct ? cfg->num_dct : cfg->num_mels;
+
+    // Q8.7 value v is v / 128 log units: input LSB = v * (512 / scale) / 65536
+    if (cfg->input_scale > 0.0f) {
+        float32_t mult = 512.0f / cfg->input_scale;
+        if (!(mult >= 1.0f && mult < 65536.0f) || cfg->input_zp < -128 || cfg->input_zp > 127) {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+        k->input_mult = (int32_t)(mult + 0.5f);
+    }
+    if (cfg->model != NULL && (k->input_mult == 0 || cfg->stride == 0U || cfg->smooth == 0U
+                               || cfg->smooth > BH_KWS_MAX_SMOOTH)) {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    arm_status status = bh_kws_tables(k, arena);
+    if (status != ARM_MATH_SUCCESS) return status;
+
+    k->features = (q15_t *)bh_arena_alloc(arena, k->rows * k->row_len * sizeof(q15_t));
+    k->fe_state = (q31_t *)bh_arena_alloc(arena, ARM_LOGMEL_STREAM_STATE_SIZE_Q15(cfg->fft_len, cfg->win_len,
+                                                                                   cfg->num_mels) * sizeof(q31_t));
+    if (k->features == NULL || k->fe_state == NULL) return ARM_MATH_LENGTH_ERROR;
+
+    status = arm_logmel_stream_init_q15(&k->fe, cfg->fft_len, cfg->win_len, cfg->hop_len, cfg->num_mels,
+                                        cfg->num_dct, k->dct, k->filter_pos, k->filter_len, k->filter_coefs,
+                                        k->window, k->features, k->rows, k->fe_state);
+    if (status != ARM_MATH_SUCCESS) return status;
+
+    if (cfg->model != NULL) {
+        status = (cfg->plan != NULL)
+            ? bh_nn_graph_init_planned(&k->graph, arena, cfg->model, cfg->model_size, cfg->plan)
+            : bh_nn_graph_init(&k->graph, arena, cfg->model, cfg->model_size);
+        if (status != ARM_MATH_SUCCESS) return status;
+        status = bh_kws_check_model(k);
+        if (status != ARM_MATH_SUCCESS) return status;
+        k->has_model = 1;
+    }
+
+    bh_kws_reset(k);
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Start a new stream: clear the front end, features, history and model state
+ * @param k: Initialized spotter
+ */
+void bh_kws_reset(bh_kws_t *k)
+{
+    const bh_kws_config_t *cfg = &k->cfg;
+    uint8_t adc_bits = k->fe.adcBits;
+    q15_t dc_coef = k->fe.dcCoef;
+
+    // Same arguments as at init, so this cannot fail
+    (void)arm_logmel_stream_init_q15(&k->fe, cfg->fft_len, cfg->win_len, cfg->hop_len, cfg->num_mels,
+                                     cfg->num_dct, k->dct, k->filter_pos, k->filter_len, k->filter_coefs,
+                                     k->window, k->features, k->rows, k->fe_state);
+    k->fe.adcBits = adc_bits;
+    k->fe.dcCoef = dc_coef;
+
+    k->hops = 0;
+    k->due = cfg->stride;
+    k->hold = 0;
+    k->filled = 0;
+    k->head = 0;
+    memset(k->history, 0, sizeof(k->history));
+    memset(k->sum, 0, sizeof(k->sum));
+    memset(k->score, 0, sizeof(k->score));
+    if (k->has_model) bh_nn_graph_reset_state(&k->graph);
+}
+
+/* ============================================
+   Runtime
+   ============================================ */
+
+/**
+ * @brief Feed Q15 samples; runs the model when an inference falls due
+ * @param k: Initialized spotter
+ * @param src: Samples, any count
+ * @param len: Number of samples
+ * @return ARM_MATH_SUCCESS or the model's kernel error
+ */
+arm_status bh_kws_process_q15(bh_kws_t *k, const q15_t *src, uint32_t len)
+{
+    uint32_t t0 = bh_cycles_now();
+    uint32_t rows = arm_logmel_stream_q15(&k->fe, src, len);
+
+    k->fe_cycles_last = bh_cycles_now() - t0;
+    k->fe_cycles_total += k->fe_cycles_last;
+    return bh_kws_advance(k, rows);
+}
+
+/**
+ * @brief Feed raw right-aligned ADC codes (fe.adcBits bits, 12 by default)
+ * @param k: Initialized spotter
+ * @param codes: DMA half-buffer
+ * @param len: Number of samples
+ * @return ARM_MATH_SUCCESS or the model's kernel error
+ */
+arm_status bh_kws_process_adc(bh_kws_t *k, const uint16_t *codes, uint32_t len)
+{
+    uint32_t t0 = bh_cycles_now();
+    uint32_t rows = arm_logmel_stream_adc_q15(&k->fe, codes, len);
+
+    k->fe_cycles_last = bh_cycles_now() - t0;
+    k->fe_cycles_total += k->fe_cycles_last;
+    return bh_kws_advance(k, rows);
+}
+
+/**
+ * @brief Classify the current feature matrix now and update the decision
+ * @note Called by the process functions every `stride` hops; calling it
+ *       directly adds an inference without moving the schedule.
+ * @param k: Spotter with a model
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR (no model) or the kernel error
+ */
+arm_status bh_kws_infer(bh_kws_t *k)
+{
+    if (!k->has_model) return ARM_MATH_ARGUMENT_ERROR;
+
+    uint32_t t0 = bh_cycles_now();
+    bh_kws_quantize(k, k->features, bh_nn_graph_input(&k->graph));
+    arm_status status = bh_nn_graph_invoke(&k->graph);
+    if (status == ARM_MATH_SUCCESS) bh_kws_decide(k);
+    uint32_t dt = bh_cycles_now() - t0;
+
+    k->cycles_last = dt;
+    k->cycles_total += dt;
+    if (dt > k->cycles_max) k->cycles_max = dt;
+    k->inferences++;
+    return status;
+}
+
+/* ============================================
+   Features
+   ============================================ */
+
+/**
+ * @brief Current feature matrix
+ * @param k: Initialized spotter
+ * @return rows x row_len Q8.7 values, oldest row first
+ */
+const q15_t *bh_kws_features(const bh_kws_t *k)
+{
+    return k->features;
+}
+
+/**
+ * @brief Quantize a feature matrix the way the model input expects it
+ * @note Needs input_scale in the config, with or without a model (a front
+ *       end only spotter can prepare training data this way)
+ * @param k: Initialized spotter
+ * @param features: rows x row_len Q8.7 values, e.g. bh_kws_features()
+ * @param dst: rows x row_len int8 values
+ */
+void bh_kws_quantize(const bh_kws_t *k, const q15_t *features, int8_t *dst)
+{
+    uint32_t n = k->rows * k->row_len;
+
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t v = ((features[i] * k->input_mult + (1 << 15)) >> 16) + k->cfg.input_zp;
+        dst[i] = (int8_t)((v > 127) ? 127 : (v < -128) ? -128 : v);
+    }
+}
+
+/* ============================================
+   Profiling
+   ============================================ */
+
+/**
+ * @brief Clear the cycle counters and the inference and detection counts
+ * @param k: Initialized spotter
+ */
+void bh_kws_reset_stats(bh_kws_t *k)
+{
+    k->fe_cycles_last = 0;
+    k->fe_cycles_total = 0;
+    k->cycles_last = 0;
+    k->cycles_max = 0;
+    k->cycles_total = 0;
+    k->inferences = 0;
+    k->over_budget = 0;
+    k->skipped = 0;
+    k->detections = 0;
+    if (k->has_model) bh_nn_graph_reset_stats(&k->graph);
+}
@@ -0,0 +1,940 @@
+/* bh_nn_graph.c */
+
+#include "bh_nn_graph.h"
+#include "bh_cycles.h"
+
+#include <string.h>
+
+/* ============================================
+   Private Helpers
+   ============================================ */
+
+// Operands each op needs (see bh_nn_op_t)
+static const uint8_t bh_nn_op_inputs[BH_NN_OP_COUNT] = {
+    5, 5, 3, 1, 1, 1, 2, 1, 1, 5, 5, 3, 5
+};
+
+static const char *const bh_nn_op_names[BH_NN_OP_COUNT] = {
+    "conv", "dw_conv", "fc", "avgpool", "maxpool",
+    "softmax", "add", "relu6", "reshape", "svdf",
+    "conv_pk", "fc_pk", "conv_pool"
+};
+
+/**
+ * @brief Round a byte count up to the arena alignment
+ */
+static uint32_t bh_nn_align(uint32_t bytes)
+{
+    return (bytes + BH_ARENA_ALIGN - 1U) & ~(BH_ARENA_ALIGN - 1U);
+}
+
+/**
+ * @brief Elements of a tensor
+ */
+static uint32_t bh_nn_elements(const bh_nn_tensor_t *t)
+{
+    return (uint32_t)(t->dims.n * t->dims.h * t->dims.w * t->dims.c);
+}
+
+/**
+ * @brief Filter dims of a packed layer as they were before packing
+ * @note CONV_PACKED: {Cout, kernel_h, kernel_w, Cin}; FC_PACKED: {depth, 1, 1, Cout}.
+ */
+static cmsis_nn_dims bh_nn_unpacked_filter(const bh_nn_graph_t *g, const bh_nn_layer_t *l)
+{
+    const bh_nn_tensor_t *in = &g->tensors[l->inputs[0]];
+    const bh_nn_tensor_t *out = &g->tensors[l->output];
+    cmsis_nn_dims f = { 1, 1, 1, 1 };
+
+    if (l->op == BH_NN_OP_CONV_PACKED) {
+        f.n = out->dims.c;
+        f.h = l->params[10];
+        f.w = l->params[11];
+        f.c = in->dims.c;
+    } else {
+        f.n = (int32_t)(bh_nn_elements(in) / (uint32_t)in->dims.n);
+        f.c = out->dims.c;
+    }
+    return f;
+}
+
+/**
+ * @brief Check tables, operand indices and constant data against the model size
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+ */
+static arm_status bh_nn_validate(const bh_nn_graph_t *g, size_t model_size)
+{
+    const bh_nn_header_t *h = g->header;
+    uint32_t num_tensors = h->num_tensors;
+
+    if (h->input >= num_tensors || h->output >= num_tensors) return ARM_MATH_ARGUMENT_ERROR;
+
+    for (uint32_t i = 0; i < num_tensors; i++) {
+        const bh_nn_tensor_t *t = &g->tensors[i];
+
+        if (t->dims.n <= 0 || t->dims.h <= 0 || t->dims.w <= 0 || t->dims.c <= 0) return ARM_MATH_ARGUMENT_ERROR;
+        if (t->type > BH_NN_S32 || t->kind > BH_NN_STATE) return ARM_MATH_ARGUMENT_ERROR;
+        if (t->kind == BH_NN_CONST &&
+            ((t->offset & 3U) != 0U || t->offset > model_size ||
+             bh_nn_tensor_bytes(t) > model_size - t->offset)) {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    if (g->tensors[h->input].kind != BH_NN_ACTIVATION || g->tensors[h->output].kind != BH_NN_ACTIVATION) {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (uint32_t l = 0; l < h->num_layers; l++) {
+        const bh_nn_layer_t *layer = &g->layers[l];
+
+        if (layer->op >= BH_NN_OP_COUNT || layer->num_inputs < bh_nn_op_inputs[layer->op] ||
+            layer->num_inputs > BH_NN_MAX_INPUTS) {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+        if (layer->output >= num_tensors || g->tensors[layer->output].kind != BH_NN_ACTIVATION ||
+            g->tensors[layer->output].type != BH_NN_S8) {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+        for (uint32_t k = 0; k < layer->num_inputs; k++) {
+            if (layer->inputs[k] >= num_tensors) return ARM_MATH_ARGUMENT_ERROR;
+        }
+        // A packed filter's depth comes from the params, so its size is checked against them
+        if (layer->op == BH_NN_OP_CONV_PACKED || layer->op == BH_NN_OP_FC_PACKED) {
+            const cmsis_nn_dims *w = &g->tensors[layer->inputs[1]].dims;
+            cmsis_nn_dims f = bh_nn_unpacked_filter(g, layer);
+            int32_t rows = (layer->op == BH_NN_OP_CONV_PACKED) ? f.n : f.c;
+            int32_t depth = (layer->op == BH_NN_OP_CONV_PACKED) ? f.h * f.w * f.c : f.n;
+
+            if (w->n != rows || w->c != arm_nn_packed_s8_cols(depth) || w->h * w->w != 1) {
+                return ARM_MATH_ARGUMENT_ERROR;
+            }
+        }
+        if (layer->op == BH_NN_OP_CONV_POOL && layer->params[10] != BH_NN_OP_MAXPOOL &&
+            layer->params[10] != BH_NN_OP_AVGPOOL) {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+/* ============================================
+   Activation Planning
+   ============================================ */
+
+/**
+ * @brief First and last layer touching an activation tensor
+ * @note The graph input is live from before layer 0 and the graph output
+ *       until after the last layer.
+ */
+static void bh_nn_lifetime(const bh_nn_graph_t *g, uint32_t t, int32_t *first, int32_t *last)
+{
+    int32_t num_layers = (int32_t)g->header->num_layers;
+
+    *first = (t == g->header->input) ? -1 : num_layers;
+    *last = (t == g->header->output) ? num_layers : -1;
+
+    for (int32_t l = 0; l < num_layers; l++) {
+        const bh_nn_layer_t *layer = &g->layers[l];
+        uint32_t used = (layer->output == t);
+
+        for (uint32_t k = 0; k < layer->num_inputs; k++) {
+            if (layer->inputs[k] == t) used = 1;
+        }
+        if (used) {
+            if (l < *first) *first = l;
+            if (l > *last) *last = l;
+        }
+    }
+    if (*last < *first) *last = *first;
+}
+
+/**
+ * @brief Lifetimes of all activation tensors, with in-place layers merged
+ * @note RELU6, ADD and RESHAPE handle every element independently, so their
+ *       output can take the buffer of an input of the same size that is not
+ *       read after the layer. Such tensors form one group; root[t] is the
+ *       first tensor of t's group and first/last of a root span the group.
+ * @param g: Loaded graph
+ * @param first: num_tensors entries, first layer using the tensor (-1 for the input)
+ * @param last: num_tensors entries, last layer using it (num_layers for the output)
+ * @param root: num_tensors entries, buffer owner of each tensor
+ */
+void bh_nn_graph_lifetimes(const bh_nn_graph_t *g, int32_t *first, int32_t *last, uint16_t *root)
+{
+    uint32_t num_tensors = g->header->num_tensors;
+
+    for (uint32_t t = 0; t < num_tensors; t++) {
+        root[t] = (uint16_t)t;
+        first[t] = last[t] = -1;
+        if (g->tensors[t].kind == BH_NN_ACTIVATION) bh_nn_lifetime(g, t, &first[t], &last[t]);
+    }
+
+    for (uint32_t l = 0; l < g->header->num_layers; l++) {
+        const bh_nn_layer_t *layer = &g->layers[l];
+        uint32_t out = layer->output;
+        uint32_t candidates = (layer->op == BH_NN_OP_ADD) ? 2U : 1U;
+
+        if (layer->op != BH_NN_OP_RELU6 && layer->op != BH_NN_OP_ADD && layer->op != BH_NN_OP_RESHAPE) continue;
+        if (root[out] != out || out == g->header->input) continue;
+
+        for (uint32_t k = 0; k < candidates; k++) {
+            uint32_t r = root[layer->inputs[k]];
+
+            if (g->tensors[r].kind != BH_NN_ACTIVATION || last[r] != (int32_t)l) continue;
+            if (bh_nn_tensor_bytes(&g->tensors[r]) != bh_nn_tensor_bytes(&g->tensors[out])) continue;
+
+            root[out] = (uint16_t)r;
+            if (last[out] > last[r]) last[r] = last[out];
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Give every activation tensor an offset in one region (greedy by size)
+ * @note Largest buffers are placed first, each at the lowest offset that does
+ *       not overlap a placed buffer whose lifetime intersects its own. State
+ *       tensors are laid out one after another in their own region.
+ * @param g: Loaded graph
+ * @param offset: num_tensors entries, receives the plan (BH_NN_NO_OFFSET for constants)
+ * @param first/last/root: from bh_nn_graph_lifetimes()
+ * @param order: num_tensors scratch slots
+ * @param state_bytes: receives the size of the state region
+ * @return Bytes of the activation region
+ */
+static uint32_t bh_nn_plan(const bh_nn_graph_t *g, uint32_t *offset, const int32_t *first, const int32_t *last,
+                           const uint16_t *root, uint16_t *order, uint32_t *state_bytes)
+{
+    uint32_t num_tensors = g->header->num_tensors;
+    uint32_t num = 0, total = 0, state = 0;
+
+    for (uint32_t t = 0; t < num_tensors; t++) {
+        offset[t] = BH_NN_NO_OFFSET;
+        if (g->tensors[t].kind == BH_NN_STATE) {
+            offset[t] = state;
+            state += bh_nn_align(bh_nn_tensor_bytes(&g->tensors[t]));
+        }
+        if (g->tensors[t].kind != BH_NN_ACTIVATION || root[t] != t) continue;
+
+        // Insertion sort by size, largest first
+        uint32_t bytes = bh_nn_align(bh_nn_tensor_bytes(&g->tensors[t]));
+        uint32_t pos = num++;
+        while (pos > 0U && bh_nn_align(bh_nn_tensor_bytes(&g->tensors[order[pos - 1U]])) < bytes) {
+            order[pos] = order[pos - 1U];
+            pos--;
+        }
+        order[pos] = (uint16_t)t;
+    }
+
+    for (uint32_t i = 0; i < num; i++) {
+        uint32_t t = order[i];
+        uint32_t bytes = bh_nn_align(bh_nn_tensor_bytes(&g->tensors[t]));
+        uint32_t candidate = 0;
+        uint32_t moved = 1;
+
+        // Slide past every conflicting placed buffer until nothing overlaps
+        while (moved) {
+            moved = 0;
+            for (uint32_t j = 0; j < i; j++) {
+                uint32_t u = order[j];
+                uint32_t u_end = offset[u] + bh_nn_align(bh_nn_tensor_bytes(&g->tensors[u]));
+
+                if (first[u] > last[t] || first[t] > last[u]) continue;
+                if (candidate < u_end && offset[u] < candidate + bytes) {
+                    candidate = u_end;
+                    moved = 1;
+                }
+            }
+        }
+
+        offset[t] = candidate;
+        if (candidate + bytes > total) total = candidate + bytes;
+    }
+
+    // Group members share their root's buffer
+    for (uint32_t t = 0; t < num_tensors; t++) {
+        if (g->tensors[t].kind == BH_NN_ACTIVATION) offset[t] = offset[root[t]];
+    }
+    *state_bytes = state;
+    return total;
+}
+
+/**
+ * @brief Scratch bytes a layer asks for through the CMSIS-NN sizing functions
+ * @note The sizes depend on the build (ARM_MATH_DSP, MVE): they are the ones
+ *       of the kernels linked into this image.
+ * @param g: Loaded graph
+ * @param layer: Layer index
+ * @return Bytes of scratch the layer's kernel needs
+ */
+int32_t bh_nn_graph_layer_scratch(const bh_nn_graph_t *g, uint32_t layer)
+{
+    const bh_nn_layer_t *l = &g->layers[layer];
+    const bh_nn_tensor_t *in = &g->tensors[l->inputs[0]];
+    const bh_nn_tensor_t *out = &g->tensors[l->output];
+    const int32_t *p = l->params;
+
+    switch (l->op) {
+    case BH_NN_OP_CONV: {
+        cmsis_nn_conv_params cp = { 0 };
+        cp.stride.w = p[2];   cp.stride.h = p[3];
+        cp.padding.w = p[4];  cp.padding.h = p[5];
+        cp.dilation.w = p[6]; cp.dilation.h = p[7];
+        return arm_convolve_wrapper_s8_get_buffer_size(&cp, &in->dims, &g->tensors[l->inputs[1]].dims,
+                                                       &out->dims);
+    }
+    case BH_NN_OP_DW_CONV: {
+        cmsis_nn_dw_conv_params dp = { 0 };
+        dp.stride.w = p[2];   dp.stride.h = p[3];
+        dp.padding.w = p[4];  dp.padding.h = p[5];
+        dp.dilation.w = p[6]; dp.dilation.h = p[7];
+        dp.ch_mult = p[10];
+        return arm_depthwise_conv_wrapper_s8_get_buffer_size(&dp, &in->dims, &g->tensors[l->inputs[1]].dims,
+                                                             &out->dims);
+    }
+    case BH_NN_OP_FC:
+        return arm_fully_connected_s8_get_buffer_size(&g->tensors[l->inputs[1]].dims);
+    case BH_NN_OP_CONV_PACKED: {
+        cmsis_nn_dims f = bh_nn_unpacked_filter(g, l);
+        return arm_convolve_packed_s8_get_buffer_size(&in->dims, &f);
+    }
+    case BH_NN_OP_FC_PACKED: {
+        cmsis_nn_dims f = bh_nn_unpacked_filter(g, l);
+        return arm_fully_connected_packed_s8_get_buffer_size(&f);
+    }
+    case BH_NN_OP_CONV_POOL:
+        return arm_convolve_pool_2x2_s8_get_buffer_size(&in->dims, &g->tensors[l->inputs[1]].dims, &out->dims);
+    case BH_NN_OP_AVGPOOL:
+        return arm_avgpool_s8_get_buffer_size(out->dims.w, in->dims.c);
+    case BH_NN_OP_SVDF: {
+        // Two q31 buffers: feature products, then per-unit sums
+        int32_t batches = in->dims.n;
+        int32_t features = g->tensors[l->inputs[2]].dims.n;
+        int32_t units = features / ((p[0] > 0) ? p[0] : 1);
+        return (int32_t)sizeof(q31_t) * batches * (features + units);
+    }
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Largest scratch of all layers
+ */
+static int32_t bh_nn_scratch(const bh_nn_graph_t *g)
+{
+    int32_t scratch = 0;
+
+    for (uint32_t l = 0; l < g->header->num_layers; l++) {
+        int32_t need = bh_nn_graph_layer_scratch(g, l);
+        if (need > scratch) scratch = need;
+    }
+    return scratch;
+}
+
+/* ============================================
+   Layer Execution
+   ============================================ */
+
+/**
+ * @brief Run one layer through its CMSIS-NN kernel
+ */
+static arm_status bh_nn_layer_run(bh_nn_graph_t *g, const bh_nn_layer_t *layer)
+{
+    const bh_nn_tensor_t *in = &g->tensors[layer->inputs[0]];
+    const bh_nn_tensor_t *out = &g->tensors[layer->output];
+    const int8_t *src = (const int8_t *)g->data[layer->inputs[0]];
+    int8_t *dst = (int8_t *)g->data[layer->output];
+    const int32_t *p = layer->params;
+    const uint16_t *op = layer->inputs;
+
+    switch (layer->op) {
+    case BH_NN_OP_CONV: {
+        cmsis_nn_conv_params cp;
+        cmsis_nn_per_channel_quant_params qp;
+        cp.input_offset = p[0];   cp.output_offset = p[1];
+        cp.stride.w = p[2];       cp.stride.h = p[3];
+        cp.padding.w = p[4];      cp.padding.h = p[5];
+        cp.dilation.w = p[6];     cp.dilation.h = p[7];
+        cp.activation.min = p[8]; cp.activation.max = p[9];
+        qp.multiplier = (int32_t *)g->data[op[3]];
+        qp.shift = (int32_t *)g->data[op[4]];
+        return arm_convolve_wrapper_s8(&g->scratch, &cp, &qp, &in->dims, src,
+                                       &g->tensors[op[1]].dims, (const q7_t *)g->data[op[1]],
+                                       &g->tensors[op[2]].dims, (const int32_t *)g->data[op[2]],
+                                       &out->dims, dst);
+    }
+    case BH_NN_OP_DW_CONV: {
+        cmsis_nn_dw_conv_params dp;
+        cmsis_nn_per_channel_quant_params qp;
+        dp.input_offset = p[0];   dp.output_offset = p[1];
+        dp.stride.w = p[2];       dp.stride.h = p[3];
+        dp.padding.w = p[4];      dp.padding.h = p[5];
+        dp.dilation.w = p[6];     dp.dilation.h = p[7];
+        dp.activation.min = p[8]; dp.activation.max = p[9];
+        dp.ch_mult = p[10];
+        qp.multiplier = (int32_t *)g->data[op[3]];
+        qp.shift = (int32_t *)g->data[op[4]];
+        return arm_depthwise_conv_wrapper_s8(&g->scratch, &dp, &qp, &in->dims, src,
+                                             &g->tensors[op[1]].dims, (const q7_t *)g->data[op[1]],
+                                             &g->tensors[op[2]].dims, (const int32_t *)g->data[op[2]],
+                                             &out->dims, dst);
+    }
+    case BH_NN_OP_FC: {
+        cmsis_nn_fc_params fp;
+        cmsis_nn_per_tensor_quant_params qp;
+        fp.input_offset = p[0];   fp.filter_offset = p[1];  fp.output_offset = p[2];
+        fp.activation.min = p[3]; fp.activation.max = p[4];
+        qp.multiplier = p[5];     qp.shift = p[6];
+        return arm_fully_connected_s8(&g->scratch, &fp, &qp, &in->dims, src,
+                                      &g->tensors[op[1]].dims, (const q7_t *)g->data[op[1]],
+                                      &g->tensors[op[2]].dims, (const int32_t *)g->data[op[2]],
+                                      &out->dims, dst);
+    }
+    case BH_NN_OP_CONV_PACKED: {
+        cmsis_nn_conv_params cp;
+        cmsis_nn_per_channel_quant_params qp;
+        cmsis_nn_dims f = bh_nn_unpacked_filter(g, layer);
+        cp.input_offset = p[0];   cp.output_offset = p[1];
+        cp.stride.w = p[2];       cp.stride.h = p[3];
+        cp.padding.w = p[4];      cp.padding.h = p[5];
+        cp.dilation.w = p[6];     cp.dilation.h = p[7];
+        cp.activation.min = p[8]; cp.activation.max = p[9];
+        qp.multiplier = (int32_t *)g->data[op[3]];
+        qp.shift = (int32_t *)g->data[op[4]];
+        return arm_convolve_packed_s8(&g->scratch, &cp, &qp, &in->dims, src, &f, (const q7_t *)g->data[op[1]],
+                                      (const int32_t *)g->data[op[2]], &out->dims, dst);
+    }
+    case BH_NN_OP_FC_PACKED: {
+        cmsis_nn_fc_params fp;
+        cmsis_nn_per_tensor_quant_params qp;
+        cmsis_nn_dims f = bh_nn_unpacked_filter(g, layer);
+        fp.input_offset = p[0];   fp.filter_offset = p[1];  fp.output_offset = p[2];
+        fp.activation.min = p[3]; fp.activation.max = p[4];
+        qp.multiplier = p[5];     qp.shift = p[6];
+        return arm_fully_connected_packed_s8(&g->scratch, &fp, &qp, &in->dims, src, &f,
+                                             (const q7_t *)g->data[op[1]], (const int32_t *)g->data[op[2]],
+                                             &out->dims, dst);
+    }
+    case BH_NN_OP_CONV_POOL: {
+        cmsis_nn_conv_params cp;
+        cmsis_nn_per_channel_quant_params qp;
+        cp.input_offset = p[0];   cp.output_offset = p[1];
+        cp.stride.w = p[2];       cp.stride.h = p[3];
+        cp.padding.w = p[4];      cp.padding.h = p[5];
+        cp.dilation.w = p[6];     cp.dilation.h = p[7];
+        cp.activation.min = p[8]; cp.activation.max = p[9];
+        qp.multiplier = (int32_t *)g->data[op[3]];
+        qp.shift = (int32_t *)g->data[op[4]];
+        if (p[10] == BH_NN_OP_AVGPOOL) {
+            return arm_convolve_avg_pool_2x2_s8(&g->scratch, &cp, &qp, &in->dims, src,
+                                                &g->tensors[op[1]].dims, (const q7_t *)g->data[op[1]],
+                                                &g->tensors[op[2]].dims, (const int32_t *)g->data[op[2]],
+                                                &out->dims, dst);
+        }
+        return arm_convolve_max_pool_2x2_s8(&g->scratch, &cp, &qp, &in->dims, src,
+                                            &g->tensors[op[1]].dims, (const q7_t *)g->data[op[1]],
+                                            &g->tensors[op[2]].dims, (const int32_t *)g->data[op[2]],
+                                            &out->dims, dst);
+    }
+    case BH_NN_OP_AVGPOOL:
+    case BH_NN_OP_MAXPOOL: {
+        cmsis_nn_pool_params pp;
+        cmsis_nn_dims filter = { 0 };
+        pp.stride.w = p[0];       pp.stride.h = p[1];
+        pp.padding.w = p[2];      pp.padding.h = p[3];
+        pp.activation.min = p[4]; pp.activation.max = p[5];
+        filter.w = p[6];          filter.h = p[7];
+        if (layer->op == BH_NN_OP_AVGPOOL) {
+            return arm_avgpool_s8(&g->scratch, &pp, &in->dims, src, &filter, &out->dims, dst);
+        }
+        return arm_max_pool_s8(&g->scratch, &pp, &in->dims, src, &filter, &out->dims, dst);
+    }
+    case BH_NN_OP_SOFTMAX:
+        arm_softmax_s8(src, in->dims.n * in->dims.h * in->dims.w, in->dims.c, p[0], p[1], p[2], dst);
+        return ARM_MATH_SUCCESS;
+    case BH_NN_OP_ADD:
+        return arm_elementwise_add_s8(src, (const int8_t *)g->data[op[1]],
+                                      p[0], p[1], p[2], p[3], p[4], p[5], p[6],
+                                      dst, p[7], p[8], p[9], p[10], p[11],
+                                      (int32_t)bh_nn_elements(out));
+    case BH_NN_OP_RELU6: {
+        uint32_t n = bh_nn_elements(out);
+        if (dst != src) memcpy(dst, src, n);
+        // arm_relu6_s8 takes a 16-bit length
+        for (uint32_t i = 0; i < n; i += 0xFFFFU) {
+            uint32_t chunk = (n - i < 0xFFFFU) ? n - i : 0xFFFFU;
+            arm_relu6_s8(dst + i, (uint16_t)chunk);
+        }
+        return ARM_MATH_SUCCESS;
+    }
+    case BH_NN_OP_RESHAPE:
+        if (dst != src) arm_reshape_s8(src, dst, bh_nn_elements(out));
+        return ARM_MATH_SUCCESS;
+    case BH_NN_OP_SVDF: {
+        cmsis_nn_svdf_params sp;
+        cmsis_nn_per_tensor_quant_params in_q, out_q;
+        cmsis_nn_context buf_a, buf_b;
+        int32_t features = g->tensors[op[2]].dims.n;
+        sp.rank = p[0];
+        sp.input_offset = p[1];         sp.output_offset = p[2];
+        sp.input_activation.min = p[3]; sp.input_activation.max = p[4];
+        sp.output_activation.min = p[5]; sp.output_activation.max = p[6];
+        in_q.multiplier = p[7];         in_q.shift = p[8];
+        out_q.multiplier = p[9];        out_q.shift = p[10];
+        buf_a.buf = g->scratch.buf;
+        buf_a.size = (int32_t)sizeof(q31_t) * in->dims.n * features;
+        buf_b.buf = (int8_t *)g->scratch.buf + buf_a.size;
+        buf_b.size = g->scratch.size - buf_a.size;
+        return arm_svdf_s8(&buf_a, &buf_b, &sp, &in_q, &out_q, &in->dims, src,
+                           &g->tensors[op[1]].dims, (q7_t *)g->data[op[1]],
+                           &g->tensors[op[2]].dims, (const q7_t *)g->data[op[2]],
+                           &g->tensors[op[3]].dims, (const q7_t *)g->data[op[3]],
+                           &g->tensors[op[4]].dims, (const q31_t *)g->data[op[4]],
+                           &out->dims, dst);
+    }
+    default:
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+}
+
+/* ============================================
+   Setup
+   ============================================ */
+
+/**
+ * @brief Take the tensor table and per-layer counters from the arena
+ */
+static arm_status bh_nn_alloc_tables(bh_nn_graph_t *g, bh_arena_t *arena)
+{
+    g->data = (void **)bh_arena_alloc(arena, g->header->num_tensors * sizeof(void *));
+    g->stats = (bh_nn_layer_stats_t *)bh_arena_alloc(arena, g->header->num_layers * sizeof(bh_nn_layer_stats_t));
+    if (g->data == NULL || g->stats == NULL) return ARM_MATH_LENGTH_ERROR;
+    memset(g->stats, 0, g->header->num_layers * sizeof(bh_nn_layer_stats_t));
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Take the activation, scratch and state regions and point every tensor at its data
+ * @param offset: Plan, one entry per tensor
+ */
+static arm_status bh_nn_bind(bh_nn_graph_t *g, bh_arena_t *arena, const uint32_t *offset,
+                             uint32_t activation_bytes, int32_t scratch, uint32_t state_bytes)
+{
+    g->activation_bytes = activation_bytes;
+    g->state_bytes = state_bytes;
+    g->activations = (uint8_t *)bh_arena_alloc(arena, activation_bytes);
+    g->scratch.size = scratch;
+    g->scratch.buf = (scratch > 0) ? bh_arena_alloc(arena, (size_t)scratch) : NULL;
+    g->state = (state_bytes > 0U) ? (uint8_t *)bh_arena_alloc(arena, state_bytes) : NULL;
+    if (g->activations == NULL || (scratch > 0 && g->scratch.buf == NULL) ||
+        (state_bytes > 0U && g->state == NULL)) {
+        return ARM_MATH_LENGTH_ERROR;
+    }
+
+    for (uint32_t t = 0; t < g->header->num_tensors; t++) {
+        const bh_nn_tensor_t *tensor = &g->tensors[t];
+
+        switch (tensor->kind) {
+        case BH_NN_CONST:
+            g->data[t] = (void *)(g->model + tensor->offset);
+            break;
+        case BH_NN_ACTIVATION:
+            g->data[t] = g->activations + offset[t];
+            break;
+        default:
+            g->data[t] = g->state + offset[t];
+            break;
+        }
+    }
+
+    bh_nn_graph_reset_state(g);
+    bh_cycles_init();
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Attach a model and check it, without taking any memory
+ * @note Enough for inspecting or planning a model; bh_nn_graph_init() and
+ *       bh_nn_graph_init_planned() call it first.
+ * @param g: Graph to fill in (tables only)
+ * @param model: BHNN model, 4-byte aligned, must outlive the graph
+ * @param model_size: Bytes available at model
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR (malformed model)
+ */
+arm_status bh_nn_graph_load(bh_nn_graph_t *g, const void *model, size_t model_size)
+{
+    if (g == NULL || model == NULL) return ARM_MATH_ARGUMENT_ERROR;
+    if (((uintptr_t)model & 3U) != 0U || model_size < sizeof(bh_nn_header_t)) return ARM_MATH_ARGUMENT_ERROR;
+
+    memset(g, 0, sizeof(*g));
+    g->model = (const uint8_t *)model;
+    g->header = (const bh_nn_header_t *)model;
+
+    const bh_nn_header_t *h = g->header;
+    size_t tables = sizeof(bh_nn_header_t) + (size_t)h->num_tensors * sizeof(bh_nn_tensor_t) +
+                    (size_t)h->num_layers * sizeof(bh_nn_layer_t);
+
+    if (h->magic != BH_NN_MAGIC || h->version != BH_NN_VERSION) return ARM_MATH_ARGUMENT_ERROR;
+    if (h->size > model_size || tables > h->size || h->num_layers == 0U) return ARM_MATH_ARGUMENT_ERROR;
+
+    g->tensors = (const bh_nn_tensor_t *)(g->model + sizeof(bh_nn_header_t));
+    g->layers = (const bh_nn_layer_t *)(g->tensors + h->num_tensors);
+
+    return bh_nn_validate(g, h->size);
+}
+
+/**
+ * @brief Load a model, plan its memory and take everything from the arena
+ * @param g: Graph to initialize
+ * @param arena: Arena for the tensor table, activations, scratch, state and counters
+ * @param model: BHNN model, 4-byte aligned, must outlive the graph
+ * @param model_size: Bytes available at model
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR (malformed model) or
+ *         ARM_MATH_LENGTH_ERROR (arena too small)
+ */
+arm_status bh_nn_graph_init(bh_nn_graph_t *g, bh_arena_t *arena, const void *model, size_t model_size)
+{
+    if (arena == NULL) return ARM_MATH_ARGUMENT_ERROR;
+
+    arm_status status = bh_nn_graph_load(g, model, model_size);
+    if (status != ARM_MATH_SUCCESS) return status;
+    status = bh_nn_alloc_tables(g, arena);
+    if (status != ARM_MATH_SUCCESS) return status;
+
+    // Planning temporaries (a few bytes per tensor)
+    uint32_t num_tensors = g->header->num_tensors;
+    uint32_t *offset = (uint32_t *)bh_arena_alloc(arena, num_tensors * sizeof(uint32_t));
+    int32_t *first = (int32_t *)bh_arena_alloc(arena, num_tensors * sizeof(int32_t));
+    int32_t *last = (int32_t *)bh_arena_alloc(arena, num_tensors * sizeof(int32_t));
+    uint16_t *root = (uint16_t *)bh_arena_alloc(arena, num_tensors * sizeof(uint16_t));
+    uint16_t *order = (uint16_t *)bh_arena_alloc(arena, num_tensors * sizeof(uint16_t));
+    if (offset == NULL || first == NULL || last == NULL || root == NULL || order == NULL) {
+        return ARM_MATH_LENGTH_ERROR;
+    }
+
+    uint32_t state_bytes;
+    bh_nn_graph_lifetimes(g, first, last, root);
+    uint32_t activation_bytes = bh_nn_plan(g, offset, first, last, root, order, &state_bytes);
+
+    return bh_nn_bind(g, arena, offset, activation_bytes, bh_nn_scratch(g), state_bytes);
+}
+
+/**
+ * @brief Load a model with a plan made offline; nothing is planned or sized here
+ * @note The arena needs BH_NN_ARENA_BYTES() of the plan. A plan whose scratch
+ *       is smaller than the kernels of this build need (stale header, or made
+ *       for another target) is refused.
+ * @param g: Graph to initialize
+ * @param arena: Arena for the tensor table, activations, scratch, state and counters
+ * @param model: BHNN model the plan was made for
+ * @param model_size: Bytes available at model
+ * @param plan: Offsets and region sizes
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR (malformed model or plan) or
+ *         ARM_MATH_LENGTH_ERROR (arena too small)
+ */
+arm_status bh_nn_graph_init_planned(bh_nn_graph_t *g, bh_arena_t *arena, const void *model, size_t model_size,
+                                    const bh_nn_plan_t *plan)
+{
+    if (arena == NULL || plan == NULL || plan->offsets == NULL) return ARM_MATH_ARGUMENT_ERROR;
+
+    arm_status status = bh_nn_graph_load(g, model, model_size);
+    if (status != ARM_MATH_SUCCESS) return status;
+
+    const bh_nn_header_t *h = g->header;
+    if (plan->num_tensors != h->num_tensors || plan->num_layers != h->num_layers) return ARM_MATH_ARGUMENT_ERROR;
+    if ((int32_t)plan->scratch_bytes < bh_nn_scratch(g)) return ARM_MATH_ARGUMENT_ERROR;
+
+    for (uint32_t t = 0; t < h->num_tensors; t++) {
+        const bh_nn_tensor_t *tensor = &g->tensors[t];
+        uint32_t off = plan->offsets[t];
+        uint32_t region = (tensor->kind == BH_NN_ACTIVATION) ? plan->activation_bytes : plan->state_bytes;
+
+        if (tensor->kind == BH_NN_CONST) continue;
+        if ((off & 3U) != 0U || off > region || bh_nn_tensor_bytes(tensor) > region - off) {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    status = bh_nn_alloc_tables(g, arena);
+    if (status != ARM_MATH_SUCCESS) return status;
+    return bh_nn_bind(g, arena, plan->offsets, plan->activation_bytes, (int32_t)plan->scratch_bytes,
+                      plan->state_bytes);
+}
+
+/**
+ * @brief Clear the persistent layer state (e.g. at the start of a new stream)
+ * @param g: Graph
+ */
+void bh_nn_graph_reset_state(bh_nn_graph_t *g)
+{
+    if (g->state != NULL) memset(g->state, 0, g->state_bytes);
+}
+
+/* ============================================
+   Runtime
+   ============================================ */
+
+/**
+ * @brief Add the output of a layer that just ran to its statistics
+ */
+static void bh_nn_output_stats(bh_nn_graph_t *g, uint32_t layer)
+{
+    bh_nn_output_stats_t *o = &g->outputs[layer];
+    uint32_t out = g->layers[layer].output;
+    const int8_t *y = (const int8_t *)g->data[out];
+    uint32_t n = bh_nn_elements(&g->tensors[out]);
+    int32_t sum = 0, lo = o->min, hi = o->max;
+    uint32_t sum_sq = 0, at_min = 0, at_max = 0;
+
+    if (o->count == 0U) {
+        lo = 127;
+        hi = -128;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t v = y[i];
+
+        sum += v;
+        sum_sq += (uint32_t)(v * v);
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+        at_min += (v == -128);
+        at_max += (v == 127);
+
+        // Flush before the 32-bit sums can overflow
+        if ((i & 0xFFFFU) == 0xFFFFU) {
+            o->sum += sum;
+            o->sum_sq += sum_sq;
+            sum = 0;
+            sum_sq = 0;
+        }
+    }
+    o->sum += sum;
+    o->sum_sq += sum_sq;
+    o->at_min += at_min;
+    o->at_max += at_max;
+    o->min = (int8_t)lo;
+    o->max = (int8_t)hi;
+    o->count += n;
+}
+
+/**
+ * @brief Run every layer once on the current input
+ * @param g: Initialized graph
+ * @return ARM_MATH_SUCCESS, or the first kernel error (later layers are skipped)
+ */
+arm_status bh_nn_graph_invoke(bh_nn_graph_t *g)
+{
+    for (uint32_t l = 0; l < g->header->num_layers; l++) {
+        bh_nn_layer_stats_t *s = &g->stats[l];
+
+        uint32_t t0 = bh_cycles_now();
+        arm_status status = bh_nn_layer_run(g, &g->layers[l]);
+        uint32_t dt = bh_cycles_now() - t0;
+
+        if (status != ARM_MATH_SUCCESS) return status;
+
+        s->cycles_last = dt;
+        s->cycles_total += dt;
+        if (dt > s->cycles_max) s->cycles_max = dt;
+        s->runs++;
+
+        if (g->outputs != NULL) bh_nn_output_stats(g, l);
+        if (g->hook != NULL) g->hook(g->hook_ctx, g, l);
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Where to write the next input
+ * @param g: Initialized graph
+ * @return Input tensor in the activation region
+ */
+int8_t *bh_nn_graph_input(const bh_nn_graph_t *g)
+{
+    return (int8_t *)g->data[g->header->input];
+}
+
+/**
+ * @brief Size of the input tensor
+ * @param g: Initialized graph
+ * @return Bytes to write at bh_nn_graph_input()
+ */
+uint32_t bh_nn_graph_input_bytes(const bh_nn_graph_t *g)
+{
+    return bh_nn_tensor_bytes(&g->tensors[g->header->input]);
+}
+
+/**
+ * @brief Result of the last invoke
+ * @note Valid until the next invoke; the input may share memory with it
+ * @param g: Initialized graph
+ * @return Output tensor in the activation region
+ */
+int8_t *bh_nn_graph_output(const bh_nn_graph_t *g)
+{
+    return (int8_t *)g->data[g->header->output];
+}
+
+/**
+ * @brief Size of the output tensor
+ * @param g: Initialized graph
+ * @return Bytes available at bh_nn_graph_output()
+ */
+uint32_t bh_nn_graph_output_bytes(const bh_nn_graph_t *g)
+{
+    return bh_nn_tensor_bytes(&g->tensors[g->header->output]);
+}
+
+/* ============================================
+   Inspection
+   ============================================ */
+
+/**
+ * @brief Storage of a tensor
+ * @param t: Tensor record
+ * @return Bytes of data (elements times element size)
+ */
+uint32_t bh_nn_tensor_bytes(const bh_nn_tensor_t *t)
+{
+    static const uint8_t size[] = { 1, 2, 4 };
+    return bh_nn_elements(t) * size[(t->type <= BH_NN_S32) ? t->type : 0];
+}
+
+/**
+ * @brief Short op name for reports
+ * @param op: bh_nn_op_t value
+ * @return Name, or "?" for an unknown op
+ */
+const char *bh_nn_op_name(uint8_t op)
+{
+    return (op < BH_NN_OP_COUNT) ? bh_nn_op_names[op] : "?";
+}
+
+/* ============================================
+   Profiling
+   ============================================ */
+
+/**
+ * @brief Average cost of a layer
+ * @param g: Graph
+ * @param layer: Layer index (execution order)
+ * @return Mean bh_cycles ticks per invoke, 0 if the layer has not run
+ */
+uint32_t bh_nn_graph_layer_cycles(const bh_nn_graph_t *g, uint32_t layer)
+{
+    if (layer >= g->header->num_layers || g->stats[layer].runs == 0U) return 0;
+    return (uint32_t)(g->stats[layer].cycles_total / g->stats[layer].runs);
+}
+
+/**
+ * @brief Zero the per-layer counters
+ * @param g: Graph
+ */
+void bh_nn_graph_reset_stats(bh_nn_graph_t *g)
+{
+    memset(g->stats, 0, g->header->num_layers * sizeof(bh_nn_layer_stats_t));
+    if (g->outputs != NULL) memset(g->outputs, 0, g->header->num_layers * sizeof(bh_nn_output_stats_t));
+}
+
+/**
+ * @brief MACs and bytes moved by one invoke of a layer
+ * @note Computed from the dims, nothing is run. See bh_nn_layer_cost_t for
+ *       what each count includes.
+ * @param g: Loaded graph
+ * @param layer: Layer index (execution order)
+ * @param cost: Receives the counts (zeroed for an invalid index)
+ */
+void bh_nn_graph_layer_cost(const bh_nn_graph_t *g, uint32_t layer, bh_nn_layer_cost_t *cost)
+{
+    memset(cost, 0, sizeof(*cost));
+    if (layer >= g->header->num_layers) return;
+
+    const bh_nn_layer_t *l = &g->layers[layer];
+    const bh_nn_tensor_t *in = &g->tensors[l->inputs[0]];
+    const bh_nn_tensor_t *out = &g->tensors[l->output];
+    const int32_t *p = l->params;
+    uint64_t out_elems = bh_nn_elements(out);
+
+    // Every operand once, then the ops that gather more
+    for (uint32_t k = 0; k < l->num_inputs; k++) {
+        const bh_nn_tensor_t *t = &g->tensors[l->inputs[k]];
+
+        if (t->kind == BH_NN_CONST) cost->weight_bytes += bh_nn_tensor_bytes(t);
+        else cost->input_bytes += bh_nn_tensor_bytes(t);
+    }
+    cost->output_bytes = bh_nn_tensor_bytes(out);
+    cost->scratch_bytes = (uint32_t)bh_nn_graph_layer_scratch(g, layer);
+
+    switch (l->op) {
+    case BH_NN_OP_CONV:
+    case BH_NN_OP_CONV_PACKED:
+    case BH_NN_OP_CONV_POOL: {
+        cmsis_nn_dims f = (l->op == BH_NN_OP_CONV_PACKED) ? bh_nn_unpacked_filter(g, l) : g->tensors[l->inputs[1]].dims;
+        uint64_t taps = (uint64_t)f.h * f.w * f.c;
+        // A fused 2x2 pooling computes four conv outputs per output
+        uint64_t conv_elems = (l->op == BH_NN_OP_CONV_POOL) ? 4U * out_elems : out_elems;
+        cost->macs = conv_elems * taps;
+        cost->input_bytes = (uint32_t)((conv_elems / (uint64_t)out->dims.c) * taps);
+        break;
+    }
+    case BH_NN_OP_DW_CONV: {
+        const cmsis_nn_dims *f = &g->tensors[l->inputs[1]].dims;
+        cost->macs = out_elems * (uint64_t)(f->h * f->w);
+        cost->input_bytes = (uint32_t)(cost->macs / (uint64_t)((p[10] > 0) ? p[10] : 1));
+        break;
+    }
+    case BH_NN_OP_FC:
+        cost->macs = out_elems * (uint64_t)g->tensors[l->inputs[1]].dims.n;
+        break;
+    case BH_NN_OP_FC_PACKED:
+        cost->macs = out_elems * (uint64_t)bh_nn_unpacked_filter(g, l).n;
+        break;
+    case BH_NN_OP_AVGPOOL:
+    case BH_NN_OP_MAXPOOL:
+        cost->macs = out_elems * (uint64_t)(p[6] * p[7]);
+        cost->input_bytes = (uint32_t)cost->macs;
+        break;
+    case BH_NN_OP_SVDF: {
+        // Feature and time products; the whole state is shifted (read and written)
+        const cmsis_nn_dims *wf = &g->tensors[l->inputs[2]].dims;
+        const cmsis_nn_dims *wt = &g->tensors[l->inputs[3]].dims;
+        uint32_t state = bh_nn_tensor_bytes(&g->tensors[l->inputs[1]]);
+        cost->macs = (uint64_t)in->dims.n * (uint64_t)wf->n * (uint64_t)(wf->c + wt->h);
+        cost->output_bytes += state;
+        break;
+    }
+    case BH_NN_OP_RESHAPE:
+        // In place when planned so, a copy otherwise
+        break;
+    default:
+        // SOFTMAX, ADD, RELU6: one op per element
+        cost->macs = out_elems;
+        break;
+    }
+}
+
+/**
+ * @brief Keep statistics of every layer output from now on
+ * @note Costs one pass over each output per invoke, outside the cycle counts.
+ * @param g: Graph
+ * @param stats: num_layers entries (zeroed here), or NULL to stop
+ */
+void bh_nn_graph_set_output_stats(bh_nn_graph_t *g, bh_nn_output_stats_t *stats)
+{
+    g->outputs = stats;
+    if (stats != NULL) memset(stats, 0, g->header->num_layers * sizeof(bh_nn_output_stats_t));
+}
+
+/**
+ * @brief Call a function after every layer of every invoke
+ * @param g: Graph
+ * @param hook: Callback, or NULL to stop
+ * @param ctx: Passed to the callback
+ */
+void bh_nn_graph_set_hook(bh_nn_graph_t *g, bh_nn_layer_hook_t hook, void *ctx)
+{
+    g->hook = hook;
+    g->hook_ctx = ctx;
+}
@@ -0,0 +1,389 @@
+/* bh_nn_parallel.c */
+
+#include "bh_nn_parallel.h"
+#include "bh_arena.h"
+#include "arm_parallel.h"
+
+#include <string.h>
+
+/* ============================================
+   Private Helpers
+   ============================================ */
+
+typedef struct {
+    const cmsis_nn_context *ctx;
+    int32_t slice;                      // Bytes per part in ctx
+    int32_t kernel_bytes;               // Kernel scratch at the start of a slice
+    int32_t chunk;                      // Output channels per step of a channel split
+    const cmsis_nn_conv_params *conv_params;
+    const cmsis_nn_per_channel_quant_params *conv_quant;
+    const cmsis_nn_fc_params *fc_params;
+    const cmsis_nn_per_tensor_quant_params *fc_quant;
+    const cmsis_nn_dims *input_dims;
+    const q7_t *input;
+    const cmsis_nn_dims *filter_dims;
+    const q7_t *filter;
+    const cmsis_nn_dims *bias_dims;
+    const int32_t *bias;
+    const cmsis_nn_dims *output_dims;
+    q7_t *output;
+    arm_status status[ARM_PARALLEL_MAX_THREADS];
+} bh_nn_parallel_job_t;
+
+/**
+ * @brief Round a byte count up to the arena alignment
+ */
+static int32_t bh_nn_parallel_align(int32_t bytes)
+{
+    return (int32_t)(((uint32_t)bytes + BH_ARENA_ALIGN - 1U) & ~(BH_ARENA_ALIGN - 1U));
+}
+
+/**
+ * @brief Output channels per step when channels are shared by `threads` parts
+ */
+static int32_t bh_nn_parallel_chunk(uint32_t threads, int32_t channels)
+{
+    int32_t units = (channels + 3) / 4;
+
+    return 4 * ((units + (int32_t)threads - 1) / (int32_t)threads);
+}
+
+/**
+ * @brief Team size for a layer: no more parts than the multiply-accumulates pay for
+ */
+static uint32_t bh_nn_parallel_team(uint32_t threads, uint64_t macs)
+{
+    uint64_t work = macs / BH_NN_PARALLEL_MIN_MACS;
+
+    return arm_parallel_threads(threads, (work > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)work, 1U);
+}
+
+/**
+ * @brief Context of one part: its slice, without the staging buffer
+ */
+static cmsis_nn_context bh_nn_parallel_slice(const bh_nn_parallel_job_t *J, uint32_t part)
+{
+    cmsis_nn_context c;
+
+    c.buf = (J->kernel_bytes > 0) ? (int8_t *)J->ctx->buf + (int32_t)part * J->slice : NULL;
+    c.size = J->kernel_bytes;
+    return c;
+}
+
+/**
+ * @brief First status of the team that is not a success
+ */
+static arm_status bh_nn_parallel_status(const bh_nn_parallel_job_t *J, uint32_t parts)
+{
+    for (uint32_t p = 0; p < parts; p++) {
+        if (J->status[p] != ARM_MATH_SUCCESS) return J->status[p];
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+/* ============================================
+   Convolution
+   ============================================ */
+
+/**
+ * @brief True when arm_convolve_wrapper_s8 takes the 1x1 path (rows are independent pixels)
+ */
+static int bh_nn_parallel_pointwise(const cmsis_nn_conv_params *cp, const cmsis_nn_dims *in, const cmsis_nn_dims *f)
+{
+    return cp->padding.w == 0 && cp->padding.h == 0 && (in->c % 4) == 0 && cp->stride.w == 1 &&
+           cp->stride.h == 1 && f->w == 1 && f->h == 1 && cp->dilation.w == 1 && cp->dilation.h == 1;
+}
+
+/**
+ * @brief Rows [r0, r1) of a pointwise convolution, rows being pixels of every batch
+ */
+static arm_status bh_nn_parallel_conv_rows(const bh_nn_parallel_job_t *J, const cmsis_nn_context *ctx,
+                                           int32_t r0, int32_t r1)
+{
+    cmsis_nn_dims in = *J->input_dims, out = *J->output_dims;
+
+    in.n = out.n = 1;
+    in.h = out.h = 1;
+    in.w = out.w = r1 - r0;
+    return arm_convolve_wrapper_s8(ctx, J->conv_params, J->conv_quant, &in, J->input + r0 * in.c,
+                                   J->filter_dims, J->filter, J->bias_dims, J->bias,
+                                   &out, J->output + r0 * out.c);
+}
+
+/**
+ * @brief Channels [c0, c0 + cc) of one batch, staged and copied into the NHWC output
+ */
+static arm_status bh_nn_parallel_conv_channels(const bh_nn_parallel_job_t *J, const cmsis_nn_context *ctx,
+                                               q7_t *staging, int32_t batch, int32_t c0, int32_t cc)
+{
+    const cmsis_nn_dims *fd = J->filter_dims;
+    cmsis_nn_dims in = *J->input_dims, filter = *fd, bias = *J->bias_dims, out = *J->output_dims;
+    cmsis_nn_per_channel_quant_params quant;
+    int32_t pixels = out.h * out.w;
+    int32_t channels = out.c;
+
+    in.n = out.n = 1;
+    filter.n = bias.c = out.c = cc;
+    quant.multiplier = J->conv_quant->multiplier + c0;
+    quant.shift = J->conv_quant->shift + c0;
+
+    arm_status status = arm_convolve_wrapper_s8(ctx, J->conv_params, &quant, &in,
+                                                J->input + batch * in.h * in.w * in.c,
+                                                &filter, J->filter + c0 * fd->h * fd->w * fd->c,
+                                                &bias, (J->bias != NULL) ? J->bias + c0 : NULL,
+                                                &out, staging);
+    if (status != ARM_MATH_SUCCESS) return status;
+
+    q7_t *dst = J->output + batch * pixels * channels + c0;
+    for (int32_t i = 0; i < pixels; i++) {
+        memcpy(dst + i * channels, staging + i * cc, (size_t)cc);
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief One part of bh_nn_parallel_conv_s8()
+ */
+static void bh_nn_parallel_conv_part(void *arg, arm_parallel_team *team, uint32_t part)
+{
+    bh_nn_parallel_job_t *J = (bh_nn_parallel_job_t *)arg;
+    const cmsis_nn_dims *id = J->input_dims, *od = J->output_dims;
+    uint32_t parts = team->numParts;
+    cmsis_nn_context ctx = bh_nn_parallel_slice(J, part);
+    arm_status status = ARM_MATH_SUCCESS;
+
+    if (parts == 1U) {
+        // Whole layer, nothing to split
+        status = arm_convolve_wrapper_s8(&ctx, J->conv_params, J->conv_quant, id, J->input, J->filter_dims,
+                                         J->filter, J->bias_dims, J->bias, od, J->output);
+    } else if (id->n >= (int32_t)parts) {
+        // Whole batches per part
+        int32_t b0 = (int32_t)(((uint32_t)id->n * part) / parts);
+        int32_t b1 = (int32_t)(((uint32_t)id->n * (part + 1U)) / parts);
+        cmsis_nn_dims in = *id, out = *od;
+
+        in.n = out.n = b1 - b0;
+        if (b0 < b1) {
+            status = arm_convolve_wrapper_s8(&ctx, J->conv_params, J->conv_quant, &in,
+                                             J->input + b0 * id->h * id->w * id->c, J->filter_dims, J->filter,
+                                             J->bias_dims, J->bias, &out, J->output + b0 * od->h * od->w * od->c);
+        }
+    } else if (bh_nn_parallel_pointwise(J->conv_params, id, J->filter_dims)) {
+        // Pixels of all batches per part, in whole groups of 4
+        int32_t units = (id->n * id->h * id->w + 3) / 4;
+        int32_t r0 = 4 * (int32_t)(((uint32_t)units * part) / parts);
+        int32_t r1 = 4 * (int32_t)(((uint32_t)units * (part + 1U)) / parts);
+        int32_t rows = id->n * id->h * id->w;
+
+        if (r1 > rows) r1 = rows;
+        if (r0 < r1) status = bh_nn_parallel_conv_rows(J, &ctx, r0, r1);
+    } else {
+        // Channel steps round robin, each batch through the staging buffer
+        q7_t *staging = (q7_t *)J->ctx->buf + (int32_t)part * J->slice + bh_nn_parallel_align(J->kernel_bytes);
+        int32_t steps = (od->c + J->chunk - 1) / J->chunk;
+
+        for (int32_t s = (int32_t)part; s < steps && status == ARM_MATH_SUCCESS; s += (int32_t)parts) {
+            int32_t c0 = s * J->chunk;
+            int32_t cc = (od->c - c0 < J->chunk) ? od->c - c0 : J->chunk;
+
+            for (int32_t b = 0; b < id->n && status == ARM_MATH_SUCCESS; b++) {
+                status = bh_nn_parallel_conv_channels(J, &ctx, staging, b, c0, cc);
+            }
+        }
+    }
+    J->status[part] = status;
+}
+
+/* ============================================
+   Fully Connected
+   ============================================ */
+
+/**
+ * @brief One part of bh_nn_parallel_fc_s8()
+ */
+static void bh_nn_parallel_fc_part(void *arg, arm_parallel_team *team, uint32_t part)
+{
+    bh_nn_parallel_job_t *J = (bh_nn_parallel_job_t *)arg;
+    const cmsis_nn_dims *id = J->input_dims, *fd = J->filter_dims, *od = J->output_dims;
+    uint32_t parts = team->numParts;
+    cmsis_nn_context ctx = bh_nn_parallel_slice(J, part);
+    arm_status status = ARM_MATH_SUCCESS;
+
+    if (id->n >= (int32_t)parts) {
+        // Whole batches per part (the whole layer for a team of one)
+        int32_t b0 = (int32_t)(((uint32_t)id->n * part) / parts);
+        int32_t b1 = (int32_t)(((uint32_t)id->n * (part + 1U)) / parts);
+        cmsis_nn_dims in = *id, out = *od;
+
+        in.n = out.n = b1 - b0;
+        if (b0 < b1) {
+            status = arm_fully_connected_s8(&ctx, J->fc_params, J->fc_quant, &in, J->input + b0 * fd->n,
+                                            fd, J->filter, J->bias_dims, J->bias, &out, J->output + b0 * od->c);
+        }
+    } else {
+        // Channel steps round robin; one batch of a step is contiguous in the output
+        int32_t steps = (od->c + J->chunk - 1) / J->chunk;
+
+        for (int32_t s = (int32_t)part; s < steps && status == ARM_MATH_SUCCESS; s += (int32_t)parts) {
+            int32_t c0 = s * J->chunk;
+            cmsis_nn_dims in = *id, filter = *fd, bias = *J->bias_dims, out = *od;
+
+            in.n = out.n = 1;
+            filter.c = bias.c = out.c = (od->c - c0 < J->chunk) ? od->c - c0 : J->chunk;
+            for (int32_t b = 0; b < id->n && status == ARM_MATH_SUCCESS; b++) {
+                status = arm_fully_connected_s8(&ctx, J->fc_params, J->fc_quant, &in, J->input + b * fd->n,
+                                                &filter, J->filter + c0 * fd->n, &bias,
+                                                (J->bias != NULL) ? J->bias + c0 : NULL,
+                                                &out, J->output + b * od->c + c0);
+            }
+        }
+    }
+    J->status[part] = status;
+}
+
+/* ============================================
+   Public API
+   ============================================ */
+
+/**
+ * @brief Thread count a request resolves to
+ * @param requested: Threads asked for, 0 for one per online CPU
+ * @return Between 1 and ARM_PARALLEL_MAX_THREADS; always 1 without ARM_MATH_PTHREAD
+ */
+uint32_t bh_nn_parallel_threads(uint32_t requested)
+{
+    return arm_parallel_threads(requested, 0U, 0U);
+}
+
+/**
+ * @brief Context bytes bh_nn_parallel_conv_s8() needs for `threads` threads
+ * @note One slice per thread: arm_convolve_wrapper_s8_get_buffer_size() of the
+ *       layer, then the staging buffer of a channel step (output pixels of one
+ *       batch times the step), both rounded to BH_ARENA_ALIGN.
+ */
+int32_t bh_nn_parallel_conv_s8_get_buffer_size(uint32_t threads,
+                                               const cmsis_nn_conv_params *conv_params,
+                                               const cmsis_nn_dims *input_dims,
+                                               const cmsis_nn_dims *filter_dims,
+                                               const cmsis_nn_dims *output_dims)
+{
+    uint32_t n = bh_nn_parallel_threads(threads);
+    int32_t kernel = arm_convolve_wrapper_s8_get_buffer_size(conv_params, input_dims, filter_dims, output_dims);
+    int32_t staging = 0;
+
+    if (n == 1U) return kernel;
+    if (input_dims->n < (int32_t)n && !bh_nn_parallel_pointwise(conv_params, input_dims, filter_dims)) {
+        staging = output_dims->h * output_dims->w * bh_nn_parallel_chunk(n, output_dims->c);
+    }
+    return (int32_t)n * (bh_nn_parallel_align(kernel) + bh_nn_parallel_align(staging));
+}
+
+/**
+ * @brief arm_convolve_wrapper_s8() split across the worker pool
+ * @param threads: Same count as given to bh_nn_parallel_conv_s8_get_buffer_size()
+ * @param ctx: Scratch of bh_nn_parallel_conv_s8_get_buffer_size() bytes
+ * @note Other parameters as arm_convolve_wrapper_s8(); the output is the same byte for byte.
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR (context too small) or the kernel's status
+ */
+arm_status bh_nn_parallel_conv_s8(uint32_t threads,
+                                  const cmsis_nn_context *ctx,
+                                  const cmsis_nn_conv_params *conv_params,
+                                  const cmsis_nn_per_channel_quant_params *quant_params,
+                                  const cmsis_nn_dims *input_dims,
+                                  const q7_t *input_data,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const q7_t *filter_data,
+                                  const cmsis_nn_dims *bias_dims,
+                                  const int32_t *bias_data,
+                                  const cmsis_nn_dims *output_dims,
+                                  q7_t *output_data)
+{
+    bh_nn_parallel_job_t job;
+    uint32_t n = bh_nn_parallel_threads(threads);
+    int32_t need = bh_nn_parallel_conv_s8_get_buffer_size(n, conv_params, input_dims, filter_dims, output_dims);
+    uint64_t macs = (uint64_t)input_dims->n * (uint64_t)(output_dims->h * output_dims->w) *
+                    (uint64_t)(output_dims->c * filter_dims->h * filter_dims->w * input_dims->c);
+
+    if (need > 0 && (ctx == NULL || ctx->buf == NULL || ctx->size < need)) return ARM_MATH_ARGUMENT_ERROR;
+
+    memset(&job, 0, sizeof(job));
+    job.ctx = ctx;
+    job.slice = (n > 1U) ? need / (int32_t)n : need;
+    job.kernel_bytes = arm_convolve_wrapper_s8_get_buffer_size(conv_params, input_dims, filter_dims, output_dims);
+    job.chunk = bh_nn_parallel_chunk(n, output_dims->c);
+    job.conv_params = conv_params;
+    job.conv_quant = quant_params;
+    job.input_dims = input_dims;
+    job.input = input_data;
+    job.filter_dims = filter_dims;
+    job.filter = filter_data;
+    job.bias_dims = bias_dims;
+    job.bias = bias_data;
+    job.output_dims = output_dims;
+    job.output = output_data;
+
+    uint32_t parts = bh_nn_parallel_team(n, macs);
+    arm_parallel_run(bh_nn_parallel_conv_part, &job, parts);
+    return bh_nn_parallel_status(&job, parts);
+}
+
+/**
+ * @brief Context bytes bh_nn_parallel_fc_s8() needs for `threads` threads
+ * @note One slice of arm_fully_connected_s8_get_buffer_size() per thread;
+ *       channel steps write in place, so there is no staging.
+ */
+int32_t bh_nn_parallel_fc_s8_get_buffer_size(uint32_t threads, const cmsis_nn_dims *filter_dims)
+{
+    uint32_t n = bh_nn_parallel_threads(threads);
+    int32_t kernel = arm_fully_connected_s8_get_buffer_size(filter_dims);
+
+    return (n == 1U) ? kernel : (int32_t)n * bh_nn_parallel_align(kernel);
+}
+
+/**
+ * @brief arm_fully_connected_s8() split across the worker pool
+ * @param threads: Same count as given to bh_nn_parallel_fc_s8_get_buffer_size()
+ * @param ctx: Scratch of bh_nn_parallel_fc_s8_get_buffer_size() bytes
+ * @note Other parameters as arm_fully_connected_s8(); the output is the same byte for byte.
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR (context too small) or the kernel's status
+ */
+arm_status bh_nn_parallel_fc_s8(uint32_t threads,
+                                const cmsis_nn_context *ctx,
+                                const cmsis_nn_fc_params *fc_params,
+                                const cmsis_nn_per_tensor_quant_params *quant_params,
+                                const cmsis_nn_dims *input_dims,
+                                const q7_t *input_data,
+                                const cmsis_nn_dims *filter_dims,
+                                const q7_t *filter_data,
+                                const cmsis_nn_dims *bias_dims,
+                                const int32_t *bias_data,
+                                const cmsis_nn_dims *output_dims,
+                                q7_t *output_data)
+{
+    bh_nn_parallel_job_t job;
+    uint32_t n = bh_nn_parallel_threads(threads);
+    int32_t need = bh_nn_parallel_fc_s8_get_buffer_size(n, filter_dims);
+    uint64_t macs = (uint64_t)input_dims->n * (uint64_t)filter_dims->n * (uint64_t)output_dims->c;
+
+    if (need > 0 && (ctx == NULL || ctx->buf == NULL || ctx->size < need)) return ARM_MATH_ARGUMENT_ERROR;
+
+    memset(&job, 0, sizeof(job));
+    job.ctx = ctx;
+    job.slice = (n > 1U) ? need / (int32_t)n : need;
+    job.kernel_bytes = arm_fully_connected_s8_get_buffer_size(filter_dims);
+    job.chunk = bh_nn_parallel_chunk(n, output_dims->c);
+    job.fc_params = fc_params;
+    job.fc_quant = quant_params;
+    job.input_dims = input_dims;
+    job.input = input_data;
+    job.filter_dims = filter_dims;
+    job.filter = filter_data;
+    job.bias_dims = bias_dims;
+    job.bias = bias_data;
+    job.output_dims = output_dims;
+    job.output = output_data;
+
+    uint32_t parts = bh_nn_parallel_team(n, macs);
+    arm_parallel_run(bh_nn_parallel_fc_part, &job, parts);
+    return bh_nn_parallel_status(&job, parts);
+}
@@ -0,0 +1,341 @@
+/* bh_pipeline.c */
+
+#include "bh_pipeline.h"
+#include "bh_cycles.h"
+
+/* ============================================
+   Private Helpers
+   ============================================ */
+
+/**
+ * @brief Reserve the next stage slot
+ * @param p: Pipeline
+ * @return Zeroed stage with in_len set, or NULL if the pipeline is full/closed
+ */
+static bh_stage_t *bh_pipeline_next_stage(bh_pipeline_t *p)
+{
+    if (p->finalized || p->num_stages >= BH_PIPELINE_MAX_STAGES) return NULL;
+
+    bh_stage_t *s = &p->stages[p->num_stages];
+    memset(s, 0, sizeof(*s));
+    s->in_len = bh_pipeline_output_len(p);
+    return s;
+}
+
+/**
+ * @brief Take zeroed float storage from the arena
+ * @param p: Pipeline
+ * @param count: Number of float32_t elements
+ * @return Pointer, or NULL when the arena is exhausted
+ */
+static float32_t *bh_pipeline_alloc(bh_pipeline_t *p, uint32_t count)
+{
+    float32_t *buf = (float32_t *)bh_arena_alloc(p->arena, count * sizeof(float32_t));
+    if (buf != NULL) memset(buf, 0, count * sizeof(float32_t));
+    return buf;
+}
+
+/**
+ * @brief Run one stage
+ * @param s: Stage
+ * @param src: Stage input
+ * @param dst: Stage output
+ */
+static void bh_stage_run(bh_stage_t *s, float32_t *src, float32_t *dst)
+{
+    switch (s->kind) {
+    case BH_STAGE_BIQUAD_DF2T:
+        arm_biquad_cascade_df2T_f32(&s->u.biquad, src, dst, s->in_len);
+        break;
+    case BH_STAGE_FIR_DECIMATE:
+        arm_fir_decimate_f32(&s->u.decimate, src, dst, s->in_len);
+        break;
+    case BH_STAGE_RFFT:
+        arm_rfft_fast_f32(&s->u.rfft, src, dst, 0);
+        break;
+    case BH_STAGE_CMPLX_MAG:
+        arm_cmplx_mag_f32(src, dst, s->out_len);
+        break;
+    case BH_STAGE_CUSTOM:
+        s->u.custom.fn(s->u.custom.ctx, src, dst);
+        break;
+    }
+}
+
+/* ============================================
+   Setup
+   ============================================ */
+
+/**
+ * @brief Start an empty pipeline
+ * @param p: Pipeline to initialize
+ * @param arena: Arena that will hold all state and work buffers
+ * @param block_size: Samples consumed per bh_pipeline_process() call
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+ */
+arm_status bh_pipeline_init(bh_pipeline_t *p, bh_arena_t *arena, uint32_t block_size)
+{
+    if (p == NULL || arena == NULL || block_size == 0U) return ARM_MATH_ARGUMENT_ERROR;
+
+    memset(p, 0, sizeof(*p));
+    p->arena = arena;
+    p->block_size = block_size;
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Append a transposed direct form II biquad cascade
+ * @param p: Pipeline
+ * @param num_stages: Number of second-order sections
+ * @param coeffs: 5*num_stages coefficients {b0, b1, b2, a1, a2} per section,
+ *                must outlive the pipeline
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_LENGTH_ERROR (arena full)
+ */
+arm_status bh_pipeline_add_biquad(bh_pipeline_t *p, uint8_t num_stages, const float32_t *coeffs)
+{
+    bh_stage_t *s = bh_pipeline_next_stage(p);
+    if (s == NULL || num_stages == 0U || coeffs == NULL) return ARM_MATH_ARGUMENT_ERROR;
+
+    s->state_len = 2U * num_stages;
+    s->state = bh_pipeline_alloc(p, s->state_len);
+    if (s->state == NULL) return ARM_MATH_LENGTH_ERROR;
+
+    arm_biquad_cascade_df2T_init_f32(&s->u.biquad, num_stages, coeffs, s->state);
+    s->kind = BH_STAGE_BIQUAD_DF2T;
+    s->out_len = s->in_len;
+    s->in_place = 1;
+    p->num_stages++;
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Append an FIR decimator
+ * @param p: Pipeline
+ * @param num_taps: Number of filter taps
+ * @param m: Decimation factor, must divide the stage input length
+ * @param coeffs: Filter taps in time-reversed order, must outlive the pipeline
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_LENGTH_ERROR
+ */
+arm_status bh_pipeline_add_fir_decimate(bh_pipeline_t *p, uint16_t num_taps, uint8_t m,
+                                        const float32_t *coeffs)
+{
+    bh_stage_t *s = bh_pipeline_next_stage(p);
+    if (s == NULL || num_taps == 0U || m == 0U || coeffs == NULL) return ARM_MATH_ARGUMENT_ERROR;
+    if ((s->in_len % m) != 0U) return ARM_MATH_LENGTH_ERROR;
+
+    s->state_len = num_taps + s->in_len - 1U;
+    s->state = bh_pipeline_alloc(p, s->state_len);
+    if (s->state == NULL) return ARM_MATH_LENGTH_ERROR;
+
+    arm_status status = arm_fir_decimate_init_f32(&s->u.decimate, num_taps, m,
+                                                  coeffs, s->state, s->in_len);
+    if (status != ARM_MATH_SUCCESS) return status;
+
+    s->kind = BH_STAGE_FIR_DECIMATE;
+    s->out_len = s->in_len / m;
+    p->num_stages++;
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Append a real FFT over the whole stage input
+ * @note Output uses the CMSIS packed layout: {X[0], X[N/2], Re X[1], Im X[1], ...}
+ * @param p: Pipeline
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR, or the arm_rfft_fast_init_f32()
+ *         error when the input length is not a supported power of two
+ */
+arm_status bh_pipeline_add_rfft(bh_pipeline_t *p)
+{
+    bh_stage_t *s = bh_pipeline_next_stage(p);
+    if (s == NULL) return ARM_MATH_ARGUMENT_ERROR;
+
+    arm_status status = arm_rfft_fast_init_f32(&s->u.rfft, (uint16_t)s->in_len);
+    if (status != ARM_MATH_SUCCESS) return status;
+
+    s->kind = BH_STAGE_RFFT;
+    s->out_len = s->in_len;
+    s->clobbers_input = 1;
+    p->num_stages++;
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Append a complex magnitude stage (interleaved re/im in, magnitudes out)
+ * @note Directly after an RFFT stage, bin 0 holds |X[0] + j*X[N/2]|
+ * @param p: Pipeline
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_LENGTH_ERROR
+ */
+arm_status bh_pipeline_add_cmplx_mag(bh_pipeline_t *p)
+{
+    bh_stage_t *s = bh_pipeline_next_stage(p);
+    if (s == NULL) return ARM_MATH_ARGUMENT_ERROR;
+    if ((s->in_len & 1U) != 0U) return ARM_MATH_LENGTH_ERROR;
+
+    s->kind = BH_STAGE_CMPLX_MAG;
+    s->out_len = s->in_len / 2U;
+    s->in_place = 1;
+    p->num_stages++;
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Append a user-defined stage
+ * @param p: Pipeline
+ * @param fn: Processing callback
+ * @param ctx: Passed back to fn unchanged
+ * @param out_len: Samples produced per call
+ * @param in_place: Non-zero if fn tolerates dst == src
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+ */
+arm_status bh_pipeline_add_custom(bh_pipeline_t *p, bh_stage_fn fn, void *ctx,
+                                  uint32_t out_len, uint8_t in_place)
+{
+    bh_stage_t *s = bh_pipeline_next_stage(p);
+    if (s == NULL || fn == NULL || out_len == 0U) return ARM_MATH_ARGUMENT_ERROR;
+
+    s->kind = BH_STAGE_CUSTOM;
+    s->u.custom.fn = fn;
+    s->u.custom.ctx = ctx;
+    s->out_len = out_len;
+    s->in_place = in_place;
+    p->num_stages++;
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Size and allocate the ping-pong work buffers; no stages can be added after
+ * @param p: Pipeline
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR (no stages) or ARM_MATH_LENGTH_ERROR
+ */
+arm_status bh_pipeline_finalize(bh_pipeline_t *p)
+{
+    if (p->finalized || p->num_stages == 0U) return ARM_MATH_ARGUMENT_ERROR;
+
+    uint32_t len = p->block_size;
+    for (uint32_t i = 0; i < p->num_stages; i++) {
+        if (p->stages[i].out_len > len) len = p->stages[i].out_len;
+    }
+
+    p->work_len = len;
+    p->work[0] = bh_pipeline_alloc(p, len);
+    p->work[1] = bh_pipeline_alloc(p, len);
+    if (p->work[0] == NULL || p->work[1] == NULL) return ARM_MATH_LENGTH_ERROR;
+
+    bh_cycles_init();
+    p->finalized = 1;
+    return ARM_MATH_SUCCESS;
+}
+
+/* ============================================
+   Runtime
+   ============================================ */
+
+/**
+ * @brief Push one block through every stage
+ * @note In-place stages keep working in the current buffer; other stages
+ *       ping-pong between the two work buffers, and the last stage writes
+ *       straight into dst. src and dst must not overlap.
+ * @param p: Finalized pipeline
+ * @param src: block_size input samples (never modified)
+ * @param dst: bh_pipeline_output_len() output samples
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if not finalized
+ */
+arm_status bh_pipeline_process(bh_pipeline_t *p, const float32_t *src, float32_t *dst)
+{
+    if (!p->finalized) return ARM_MATH_ARGUMENT_ERROR;
+
+    float32_t *cur = (float32_t *)src;
+    int cur_buf = -1;           // -1: cur is the caller's (read-only) input
+
+    for (uint32_t i = 0; i < p->num_stages; i++) {
+        bh_stage_t *s = &p->stages[i];
+        float32_t *out;
+
+        // Never let a stage scribble over the caller's input
+        if (cur_buf < 0 && s->clobbers_input) {
+            memcpy(p->work[0], cur, s->in_len * sizeof(float32_t));
+            cur = p->work[0];
+            cur_buf = 0;
+        }
+
+        int out_buf;
+        if (i + 1U == p->num_stages) {
+            out = dst;
+            out_buf = -1;
+        } else if (s->in_place && cur_buf >= 0) {
+            out = cur;
+            out_buf = cur_buf;
+        } else {
+            out_buf = (cur_buf == 0) ? 1 : 0;
+            out = p->work[out_buf];
+        }
+
+        uint32_t t0 = bh_cycles_now();
+        bh_stage_run(s, cur, out);
+        uint32_t dt = bh_cycles_now() - t0;
+
+        s->cycles_last = dt;
+        s->cycles_total += dt;
+        if (dt > s->cycles_max) s->cycles_max = dt;
+        s->blocks++;
+
+        cur = out;
+        cur_buf = out_buf;
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Samples produced per block
+ * @param p: Pipeline
+ * @return Output length of the last stage (block_size if there are no stages)
+ */
+uint32_t bh_pipeline_output_len(const bh_pipeline_t *p)
+{
+    if (p->num_stages == 0U) return p->block_size;
+    return p->stages[p->num_stages - 1U].out_len;
+}
+
+/**
+ * @brief Clear all filter history (e.g. after a stream discontinuity)
+ * @param p: Pipeline
+ */
+void bh_pipeline_reset(bh_pipeline_t *p)
+{
+    for (uint32_t i = 0; i < p->num_stages; i++) {
+        bh_stage_t *s = &p->stages[i];
+        if (s->state != NULL) memset(s->state, 0, s->state_len * sizeof(float32_t));
+    }
+}
+
+/* ============================================
+   Profiling
+   ============================================ */
+
+/**
+ * @brief Average cost of a stage
+ * @param p: Pipeline
+ * @param stage: Stage index (order of the add calls)
+ * @return Mean bh_cycles ticks per block, 0 if the stage has not run
+ */
+uint32_t bh_pipeline_stage_cycles(const bh_pipeline_t *p, uint32_t stage)
+{
+    if (stage >= p->num_stages || p->stages[stage].blocks == 0U) return 0;
+    return (uint32_t)(p->stages[stage].cycles_total / p->stages[stage].blocks);
+}
+
+/**
+ * @brief Zero the per-stage counters
+ * @param p: Pipeline
+ */
+void bh_pipeline_reset_stats(bh_pipeline_t *p)
+{
+    for (uint32_t i = 0; i < p->num_stages; i++) {
+        bh_stage_t *s = &p->stages[i];
+        s->cycles_last = 0;
+        s->cycles_max = 0;
+        s->cycles_total = 0;
+        s->blocks = 0;
+    }
+}
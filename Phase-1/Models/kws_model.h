@@ -0,0 +1,1003 @@
+/* kws_model.h - written by Host/tools/kws_harness.c, do not edit */
+
+#ifndef KWS_MODEL_H
+#define KWS_MODEL_H
+
+#include <stdint.h>
+
+// Front end
+#define KWS_SAMPLE_RATE     16000U
+#define KWS_FFT_LEN         1024U
+#define KWS_WIN_LEN         640U
+#define KWS_HOP_LEN         320U
+#define KWS_NUM_MELS        40U
+#define KWS_NUM_DCT         10U
+#define KWS_NUM_ROWS        49U
+
+// Model input quantization and classes (silence, unknown, keyword)
+#define KWS_INPUT_SCALE     0.216850489f
+#define KWS_INPUT_ZP        (38)
+#define KWS_NUM_CLASSES     3U
+#define KWS_FIRST_KEYWORD   2U
+
+// Decision settings the accuracy was measured with
+#define KWS_STRIDE          5U
+#define KWS_SMOOTH          3U
+#define KWS_THRESHOLD       204U
+#define KWS_REFRACTORY      11U
+
+#define KWS_MODEL_BYTES     30952U
+
+// BHNN model; words keep it 4-byte aligned
+static const uint32_t kws_model[7738] = {
+    0x4E4E4842, 0x00330001, 0x0000000C, 0x00000032, 0x000078E8, 0x00000001, 0x00000031, 0x0000000A,
+    0x00000001, 0x00000100, 0x00000000, 0x00000001, 0x00000019, 0x00000005, 0x00000040, 0x00000100,
+    0x00000000, 0x00000040, 0x0000000A, 0x00000004, 0x00000001, 0x00000000, 0x000007DC, 0x00000001,
+    0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x000011DC, 0x00000001, 0x00000001, 0x00000001,
+    0x00000040, 0x00000002, 0x000012DC, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002,
+    0x000013DC, 0x00000001, 0x00000019, 0x00000005, 0x00000040, 0x00000100, 0x00000000, 0x00000001,
+    0x00000003, 0x00000003, 0x00000040, 0x00000000, 0x000014DC, 0x00000001, 0x00000001, 0x00000001,
+    0x00000040, 0x00000002, 0x0000171C, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002,
+    0x0000181C, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x0000191C, 0x00000001,
+    0x00000019, 0x00000005, 0x00000040, 0x00000100, 0x00000000, 0x00000040, 0x00000001, 0x00000001,
+    0x00000040, 0x00000000, 0x00001A1C, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002,
+    0x00002A1C, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x00002B1C, 0x00000001,
+    0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x00002C1C, 0x00000001, 0x00000019, 0x00000005,
+    0x00000040, 0x00000100, 0x00000000, 0x00000001, 0x00000003, 0x00000003, 0x00000040, 0x00000000,
+    0x00002D1C, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x00002F5C, 0x00000001,
+    0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x0000305C, 0x00000001, 0x00000001, 0x00000001,
+    0x00000040, 0x00000002, 0x0000315C, 0x00000001, 0x00000019, 0x00000005, 0x00000040, 0x00000100,
+    0x00000000, 0x00000040, 0x00000001, 0x00000001, 0x00000040, 0x00000000, 0x0000325C, 0x00000001,
+    0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x0000425C, 0x00000001, 0x00000001, 0x00000001,
+    0x00000040, 0x00000002, 0x0000435C, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002,
+    0x0000445C, 0x00000001, 0x00000019, 0x00000005, 0x00000040, 0x00000100, 0x00000000, 0x00000001,
+    0x00000003, 0x00000003, 0x00000040, 0x00000000, 0x0000455C, 0x00000001, 0x00000001, 0x00000001,
+    0x00000040, 0x00000002, 0x0000479C, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002,
+    0x0000489C, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x0000499C, 0x00000001,
+    0x00000019, 0x00000005, 0x00000040, 0x00000100, 0x00000000, 0x00000040, 0x00000001, 0x00000001,
+    0x00000040, 0x00000000, 0x00004A9C, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002,
+    0x00005A9C, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x00005B9C, 0x00000001,
+    0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x00005C9C, 0x00000001, 0x00000019, 0x00000005,
+    0x00000040, 0x00000100, 0x00000000, 0x00000001, 0x00000003, 0x00000003, 0x00000040, 0x00000000,
+    0x00005D9C, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x00005FDC, 0x00000001,
+    0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x000060DC, 0x00000001, 0x00000001, 0x00000001,
+    0x00000040, 0x00000002, 0x000061DC, 0x00000001, 0x00000019, 0x00000005, 0x00000040, 0x00000100,
+    0x00000000, 0x00000040, 0x00000001, 0x00000001, 0x00000040, 0x00000000, 0x000062DC, 0x00000001,
+    0x00000001, 0x00000001, 0x00000040, 0x00000002, 0x000072DC, 0x00000001, 0x00000001, 0x00000001,
+    0x00000040, 0x00000002, 0x000073DC, 0x00000001, 0x00000001, 0x00000001, 0x00000040, 0x00000002,
+    0x000074DC, 0x00000001, 0x00000004, 0x00000001, 0x00000040, 0x00000100, 0x00000000, 0x00000001,
+    0x00000001, 0x00000001, 0x00000003, 0x00000100, 0x00000000, 0x00000100, 0x00000001, 0x00000001,
+    0x00000003, 0x00000000, 0x000075DC, 0x00000001, 0x00000001, 0x00000001, 0x00000003, 0x00000002,
+    0x000078DC, 0x00000001, 0x00000001, 0x00000001, 0x00000003, 0x00000100, 0x00000000, 0x00010500,
+    0x00020000, 0x00040003, 0xFFFF0005, 0xFFFFFFDA, 0xFFFFFF80, 0x00000002, 0x00000002, 0x00000001,
+    0x00000004, 0x00000001, 0x00000001, 0xFFFFFF80, 0x0000007F, 0x00000000, 0x00000000, 0x00060501,
+    0x00070001, 0x00090008, 0xFFFF000A, 0x00000080, 0xFFFFFF80, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0xFFFFFF80, 0x0000007F, 0x00000001, 0x00000000, 0x000B0500,
+    0x000C0006, 0x000E000D, 0xFFFF000F, 0x00000080, 0xFFFFFF80, 0x00000001, 0x00000001, 0x00000000,
+    0x00000000, 0x00000001, 0x00000001, 0xFFFFFF80, 0x0000007F, 0x00000000, 0x00000000, 0x00100501,
+    0x0011000B, 0x00130012, 0xFFFF0014, 0x00000080, 0xFFFFFF80, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0xFFFFFF80, 0x0000007F, 0x00000001, 0x00000000, 0x00150500,
+    0x00160010, 0x00180017, 0xFFFF0019, 0x00000080, 0xFFFFFF80, 0x00000001, 0x00000001, 0x00000000,
+    0x00000000, 0x00000001, 0x00000001, 0xFFFFFF80, 0x0000007F, 0x00000000, 0x00000000, 0x001A0501,
+    0x001B0015, 0x001D001C, 0xFFFF001E, 0x00000080, 0xFFFFFF80, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0xFFFFFF80, 0x0000007F, 0x00000001, 0x00000000, 0x001F0500,
+    0x0020001A, 0x00220021, 0xFFFF0023, 0x00000080, 0xFFFFFF80, 0x00000001, 0x00000001, 0x00000000,
+    0x00000000, 0x00000001, 0x00000001, 0xFFFFFF80, 0x0000007F, 0x00000000, 0x00000000, 0x00240501,
+    0x0025001F, 0x00270026, 0xFFFF0028, 0x00000080, 0xFFFFFF80, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0xFFFFFF80, 0x0000007F, 0x00000001, 0x00000000, 0x00290500,
+    0x002A0024, 0x002C002B, 0xFFFF002D, 0x00000080, 0xFFFFFF80, 0x00000001, 0x00000001, 0x00000000,
+    0x00000000, 0x00000001, 0x00000001, 0xFFFFFF80, 0x0000007F, 0x00000000, 0x00000000, 0x002E0103,
+    0xFFFF0029, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000005, 0x00000006, 0x00000000, 0x00000000, 0xFFFFFF80,
+    0x0000007F, 0x00000005, 0x00000006, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x002F0302,
+    0x0030002E, 0xFFFF0031, 0xFFFFFFFF, 0x00000080, 0x00000000, 0x00000000, 0xFFFFFF80, 0x0000007F,
+    0x7DD87BC1, 0xFFFFFFFC, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00320105,
+    0xFFFF002F, 0xFFFFFFFF, 0xFFFFFFFF, 0x4FEE3265, 0x00000019, 0xFFFFFFC2, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x129F0400,
+    0x1A252C90, 0x589FAE77, 0xCA0505B5, 0xFF13C735, 0xDA52E48F, 0x14925C03, 0xCC03A63D, 0x3A59AD03,
+    0x783144D0, 0x8F48B677, 0x8ECDBA05, 0xD253A0B7, 0x065DCC18, 0xC716772B, 0x372A1A36, 0xE0DDAE0E,
+    0x55EED47B, 0x588C96F5, 0xBA57A5EF, 0x0CEBCDB5, 0x7014EE21, 0x1F64FD1B, 0x596BDFD9, 0x09AD4077,
+    0xFF9D17DE, 0x63FDBD8F, 0xBEC7D943, 0xE2700F43, 0xB10DE37C, 0x60A2BDEE, 0x7FB62D15, 0x47CBBF24,
+    0x0FDB6467, 0xDD9E60BD, 0x5A5BDB6C, 0x56F71108, 0xF7F78311, 0xFB7417A5, 0x9089F039, 0x9C77BCBE,
+    0xADB561B2, 0xD25A4EBA, 0x400FCF79, 0xC8FF2A6A, 0x74416FEB, 0x7690CCFE, 0x071C9B64, 0x382A9DA0,
+    0x90B21C73, 0x2B566764, 0x3A716995, 0xEE158B15, 0x30BD2CC3, 0x0BBFFAA2, 0xC4416494, 0xA075C8A1,
+    0x1E2A004F, 0xCD8BDCAC, 0x6E050FA2, 0xE501D6B3, 0x758C7AB5, 0xA5C61524, 0x5451B4A3, 0x23A22FFA,
+    0xA60A989D, 0x9358C4E4, 0x1FD617DB, 0x99D54B8E, 0x933BE758, 0x07AC7634, 0x31330B46, 0x889C8A40,
+    0x4A0E5293, 0x50477D43, 0xB3B8A686, 0x7C2CD297, 0x29EFFACE, 0x96265583, 0xE96F387F, 0xF2422A83,
+    0x744030C9, 0x7E2DD143, 0x4EE5B2F7, 0xB3B0C0CC, 0xD735B2F6, 0xAF543837, 0x52B57231, 0x541F9A5D,
+    0x4EA05514, 0xA856DC79, 0x94589444, 0xD737A7B6, 0x2709CBBE, 0x07473F30, 0xF95DB6C1, 0x325E38E4,
+    0x2556A8DB, 0xF6EE03A1, 0xEFF8A930, 0xE2E79B0D, 0x0AD14555, 0x8B4E66A6, 0x6A46720A, 0x11B5D62D,
+    0x18994AC5, 0x691F5CC1, 0xA2E979F3, 0x2E242769, 0x91D05196, 0x7145741B, 0xA9F24900, 0x3AE61C41,
+    0x33CC08CD, 0x48A527A6, 0x1F7DFCF7, 0xCA1CC990, 0xCF02FA3B, 0xC19B3DCC, 0x298E3E30, 0xFB8C0F11,
+    0x3C846387, 0xBC60E6AA, 0x77DEECCE, 0xAFACB58F, 0x5A4A5B7B, 0xCC0E2EE9, 0x975B0C67, 0x163DC44D,
+    0x29450D84, 0xBDEA7E54, 0xB8A1DBB8, 0xAEF0E041, 0x9B61F31C, 0x26BC635A, 0x6BEA2E51, 0xC0F0250C,
+    0xD796DCDF, 0x56E6F452, 0x605539AE, 0x5F5C47AD, 0x4B9C58FF, 0xC55E0D02, 0x99FD7C2D, 0x9137E8BD,
+    0x3921F986, 0x35EAB157, 0xDDCB1C71, 0x9E2B937C, 0x1B517E62, 0xFAC6B603, 0xDBAA44D9, 0xA1736C03,
+    0x2404C344, 0x58AA5451, 0xB648A042, 0x1FBDC3D1, 0x2A0743D1, 0xDF1A0E99, 0x0010AFE9, 0xEFCAB35A,
+    0x981CC02A, 0xB0867C78, 0x35C67ED1, 0xE7E3FA35, 0x843D4372, 0xD45B9649, 0x38FFFEF8, 0x9FBBAA07,
+    0x061978F5, 0x20931AEB, 0x428E546B, 0xF0DEAF5B, 0x303B7D67, 0xABE2FC98, 0xD3B7D7E9, 0x1878344E,
+    0x823CD818, 0xE5BCE44E, 0xC92CA548, 0x84FE7B6B, 0xF8B4C9FB, 0xBEF401FA, 0x5C605240, 0xBF305047,
+    0xC6C9210E, 0xFF39E202, 0x5DF7724F, 0x82300C15, 0x62616F1E, 0xB986A6DF, 0x4E631656, 0x9D395817,
+    0xA29249FF, 0xB7032E22, 0x956F2547, 0xB80330B6, 0x45D5F75C, 0x182AEA2C, 0x02FD91D0, 0xD2A6167B,
+    0x2A5D05CE, 0xC37B4668, 0xF332A884, 0xF736C5DF, 0xE56728CF, 0xC189A56B, 0xEF15B1AE, 0xE28A2242,
+    0x3FB001B9, 0x41BC4AE4, 0xA4E346FF, 0x9F327A1B, 0x150026A7, 0x493ABFC4, 0xC44552B9, 0xB6C0CEB2,
+    0x0D693758, 0xC666D2B8, 0x7F0F9531, 0x567A2A73, 0x5C23A4F2, 0xCD4D76FF, 0x5DC02F2F, 0xD8E8F12C,
+    0x4F23E2D6, 0xEAE34A19, 0x871DD47A, 0x5419613A, 0xBE710F72, 0x4B3F2B35, 0x101D923D, 0x19A6A490,
+    0x8F75DD74, 0xDD669B58, 0xD8E11BB8, 0x4D0303C6, 0xC81C6987, 0x3E2EA2FF, 0x7E166615, 0xFFA0E6F7,
+    0x7D7384AC, 0x3B9703A3, 0xEBE088D2, 0x06095AC0, 0x772D2C84, 0x38DFB9FA, 0x6F99DAF4, 0x7D1ED64B,
+    0x10392A90, 0x1C883B06, 0x039E1DAD, 0x0DA827C2, 0xF2A1E1DB, 0x30E66A84, 0x56F7F438, 0x8387B161,
+    0x8A6121E6, 0x63F8049B, 0x57004FBE, 0xDC68A7DA, 0x9F84CE9F, 0x19A73946, 0x08F7769B, 0x00982AEE,
+    0x0A863F48, 0x3C8A45B7, 0xBCB83CE9, 0x8EF7E2AB, 0x122B6065, 0xC7A4CD31, 0x5FEC67FD, 0x4AE6EFBE,
+    0xB1593A22, 0x49B830E8, 0xB5F4A196, 0xA3E85CA1, 0x180AAD07, 0x58C01D26, 0x654EF3C3, 0xC7AE1428,
+    0x0C16B7F9, 0x81D0CB96, 0x2DEB28D1, 0x033E88AD, 0xA3F909D6, 0x22B1151D, 0x447EA152, 0x00164854,
+    0xB80EE978, 0xEB8578D7, 0x69DF94F3, 0xE5CBF34B, 0x861047D2, 0x768DF0E3, 0x732D8F5B, 0xB168EADF,
+    0x9367F99A, 0xE6C4BBA9, 0x1AC15564, 0xFD4382BC, 0x15E11E1E, 0x2FF90771, 0x2D8A7557, 0x291847E9,
+    0x7AA4452C, 0xE554F4E0, 0x365A2292, 0xA42A5DE9, 0x5B222525, 0xD114FF92, 0xEA657A43, 0xD37C1E05,
+    0x5EF77EE2, 0xC815B99E, 0xCB40DBB8, 0xD7953898, 0xEDBF3A17, 0xF3C85645, 0x6A91A16C, 0x4B21DA97,
+    0xDE6DC016, 0xE6BD1826, 0x8A07B906, 0x2B3E40A0, 0x54A93714, 0x37F40540, 0x95A73740, 0xB5CB301B,
+    0xA6152B89, 0x1E39AF2B, 0xB4F69AE3, 0xAEC5A7EC, 0x05DD97B2, 0xCDFB7B97, 0x6766A514, 0xF3E3670D,
+    0x51BE13E3, 0x39E0AB5F, 0xE9E1B846, 0x071A60C5, 0x692ED8F7, 0x3F3034FB, 0x3E752127, 0xFC41E84D,
+    0x3F9C83F5, 0xACA0B5A6, 0x7A582849, 0xCC511DB2, 0x6F5BB96A, 0xFA7FDD23, 0x35947C75, 0x91D29215,
+    0x49707BB6, 0xC74CD199, 0x7EBAC77A, 0x4F69CE91, 0xAB5DCA22, 0xB70F65FF, 0xECCCCF15, 0x7E9FF770,
+    0xA21509BE, 0xCD5D391F, 0x9961490E, 0x4ADCB531, 0xB305BC9A, 0x1A5B1E9B, 0x5F13D02C, 0x281618AE,
+    0x8ADA1EB3, 0xA214ECC8, 0x537ADA1A, 0x4B3BE5EE, 0x91CB4650, 0x4CBB1159, 0x0CC49F68, 0x117D9335,
+    0xE8AB775D, 0xB28B8B10, 0x868A6864, 0xADFD182D, 0x20C3DABB, 0xADB52BFA, 0x4F93360B, 0x63C4A237,
+    0x7AC3DB02, 0x478FA06C, 0x364A303B, 0xE53E50DF, 0x3902420B, 0xB722262C, 0xC4852818, 0xF6F32FD6,
+    0x51202917, 0xB476ABC3, 0x1678334E, 0x8CE644AF, 0x2119FB39, 0xEFCC44E3, 0xDF2B6DB2, 0xA91905D9,
+    0x1C190558, 0xB4324A79, 0x7D0DCF33, 0x43C65DEF, 0x0888C91F, 0xA9B796FD, 0x4ADA5A22, 0xEE7A6DF6,
+    0x27FFB60F, 0xCDB6BC55, 0xCC26F170, 0xD5878E2D, 0x0AE6DAE5, 0x88E409D2, 0x684A3D2B, 0x2F4691BD,
+    0x53D0B9F7, 0xC7271668, 0x08F4277A, 0x9B025957, 0x18270909, 0x2F60523C, 0xF4229AEA, 0x1C420A51,
+    0xC58D2F37, 0x550C2B92, 0xBE62962C, 0xB00649B9, 0xBE05D872, 0xEDA43297, 0x938F5861, 0xD8C6C96A,
+    0xB1E87ACB, 0xB1714146, 0x5CBBC954, 0x5FEFEAF7, 0x90338BB3, 0x53DE7798, 0xC1999B2F, 0xDAF51C47,
+    0x763B2014, 0xE98849E6, 0x24842820, 0x4BEA22D5, 0x9562E926, 0xE9AC3575, 0xE08209D4, 0x347C17DF,
+    0xD3650747, 0x18087C1F, 0xF68DEFC1, 0x2F7D4FFD, 0x9EBF2F20, 0x6164DF1C, 0x602C3D96, 0xB2FC1B98,
+    0x043C2A39, 0x919CF18C, 0x2E07B268, 0x26102792, 0x25323365, 0x48460128, 0x9567DA7C, 0x772F6736,
+    0x7C2D9B2A, 0xF01E0E14, 0xA7751636, 0xEABA25D5, 0xA4FB1771, 0x3F0173AC, 0xAF17C20F, 0x46F3B8D5,
+    0xBC9F19E7, 0x6AB1FF9F, 0xFD101DBE, 0x95D32818, 0x36A66A58, 0x75D661AC, 0x0B60C200, 0xF5028A04,
+    0xE4B1233F, 0xFFD7B5CB, 0xD8314384, 0x033DA1D4, 0xB3F84FB6, 0x5A8CA04D, 0x50D66617, 0x9DCF8BB6,
+    0xD1A14942, 0x847EDF12, 0x437C8400, 0xA6F6BDE1, 0x4456DCFC, 0x92AB3D3E, 0x0175B88E, 0xFF98A239,
+    0x8C405324, 0x26E565FF, 0xB40A16B3, 0x60823542, 0x327D528D, 0xCBCDB423, 0xAC5BD253, 0x2CCA7DAE,
+    0x343B82BC, 0x3FEE99BA, 0xC6AC7B96, 0xBAA32BDD, 0x927996DA, 0x27D2CBB0, 0x76115529, 0xA5A8921E,
+    0xC526282C, 0xD3D35992, 0x1E63FCE9, 0x1BE12499, 0xF62ED55B, 0xE6183E88, 0x49B4CC9E, 0x05185A4C,
+    0x87EDA347, 0x67A2D09C, 0x79D54D06, 0xEF13DBD3, 0xA8085207, 0xAF8B2948, 0x19BCFA0A, 0xB8F876B2,
+    0x0F25B3C6, 0xF70227C6, 0x6E1792FD, 0xDAD9421F, 0x9275FF43, 0x338E8D11, 0xF72F9F03, 0xBE16C235,
+    0x29B93FD3, 0x882E1DDA, 0xBFF437D7, 0x26CF61BA, 0x082AF795, 0x06EC253B, 0x76BC9324, 0xABFE6631,
+    0xAC4126E7, 0xF6D6B61D, 0xC0A47809, 0x8E251C8B, 0x429F93DC, 0x0241E9EB, 0x72082A28, 0x519C5025,
+    0x3CBEB9AE, 0xCBA6C3D6, 0xFCF8DBD5, 0xC77C2C07, 0xE7955956, 0x9DEB7DA1, 0xF3F588A0, 0xF31215CA,
+    0x25ED6CA4, 0xF508A86B, 0xD29142DB, 0x4C56DFD2, 0xCE2C62B3, 0x84302B7A, 0x822EB01E, 0x4DFFD2D7,
+    0x05197530, 0x4B57BBED, 0xD36AEA5B, 0xFFA38843, 0xCBA7B2A4, 0xD9BD788D, 0xA2FF371F, 0x7A20FB06,
+    0x34D92DE6, 0xDCB13D5A, 0x5A14C9BC, 0x03572397, 0xB9EC33EB, 0xE746A341, 0x07E85D73, 0x43A4D604,
+    0x831BFC4A, 0x3EEEA316, 0xEB5B2710, 0x9B4A95BC, 0x75CCFCC6, 0x0B0C2DAD, 0xAE0CFD40, 0x03BFD077,
+    0xE92CF395, 0x245A6DF2, 0xDDFF9C42, 0xD5F5C2EA, 0x834A6922, 0x743B7E61, 0xE17C4BE4, 0xF91868C0,
+    0x0A2830CA, 0x09393F9F, 0x132CCF93, 0x70151A3E, 0x6F29E90D, 0x8EB75C07, 0xE3B40C20, 0xFD74E00E,
+    0x7B40C3AF, 0x85DEF6A7, 0xB8DCCEDA, 0x57E78A20, 0x3FF83097, 0x8DEA83E9, 0x1EDDCFC7, 0x3AC50D48,
+    0x9CB917A0, 0x7187C4D1, 0x58DE6521, 0xA456C5EE, 0xD2DB736B, 0x77397C69, 0xD61AE42B, 0x33FE949D,
+    0xC85155E6, 0x07ACEE3E, 0x9BBF7C6E, 0x905B4A6A, 0xBF232863, 0x1A74A22B, 0xEB4DB854, 0x5CBABDD1,
+    0x65B364DF, 0x689C7E79, 0x35E6EC09, 0x683055AE, 0xF1B6B5F5, 0x05A21F65, 0xAB8622BD, 0x00002491,
+    0x0000095A, 0xFFFFFBFF, 0x000011D8, 0x000016F5, 0x00001501, 0x00001C7A, 0xFFFFF88E, 0x00001396,
+    0x00000815, 0xFFFFEAB3, 0xFFFFEDD2, 0x00000E68, 0x00001138, 0xFFFFECAE, 0x00001505, 0x0000080C,
+    0xFFFFF570, 0x000019C0, 0x00001223, 0xFFFFEFAB, 0xFFFFF736, 0xFFFFF3C6, 0x000001F1, 0xFFFFE4CC,
+    0x00001BCC, 0xFFFFF9C4, 0xFFFFDFC6, 0xFFFFF9A2, 0xFFFFF67D, 0x00000AEB, 0x0000091F, 0x00001911,
+    0xFFFFDEAD, 0x00000D26, 0xFFFFE65B, 0x000007FC, 0x00001B6A, 0xFFFFEFD3, 0xFFFFFB87, 0xFFFFF2F7,
+    0xFFFFF56C, 0xFFFFFA0B, 0x000012F6, 0xFFFFF893, 0x00000ACC, 0x00000A19, 0xFFFFEAA9, 0xFFFFF45D,
+    0x000008F0, 0x00000245, 0xFFFFF631, 0x00000E1E, 0x00001FD4, 0x00000958, 0x00000A96, 0xFFFFF955,
+    0x000011E2, 0x00000835, 0xFFFFEF47, 0x00001222, 0x000008CF, 0xFFFFDE18, 0xFFFFF81B, 0x40AAD9D8,
+    0x5F999397, 0x69D43A7F, 0x500894D0, 0x46B24DEB, 0x42DFE3B4, 0x4D75F6CC, 0x5D68E638, 0x4FEFCFE0,
+    0x4A798BB9, 0x4DCF7185, 0x64797D36, 0x56F3D85A, 0x507E38A4, 0x47CC5442, 0x51CCFF66, 0x627D8CE2,
+    0x4FAC3487, 0x603B882B, 0x4664BA8D, 0x46368011, 0x4191685C, 0x56B865AA, 0x6687D2E2, 0x58426D5C,
+    0x525B4A2F, 0x55EA5CE1, 0x4786DAE4, 0x5DEAA14F, 0x6374E070, 0x62FC2935, 0x63C59E11, 0x4A928618,
+    0x497A4D6B, 0x4179CE27, 0x440E08F3, 0x661C4970, 0x53DF88A9, 0x5CAEE74B, 0x6A27EB95, 0x5120A849,
+    0x547340F8, 0x5752DE3E, 0x58A026E6, 0x5F353BF2, 0x645EC273, 0x61F97C76, 0x56259FF7, 0x43F08816,
+    0x5444EAFC, 0x46771D3D, 0x67131CFB, 0x650E0CCE, 0x4C39B127, 0x411EB498, 0x67CBBFB8, 0x5CDCEBC0,
+    0x44AFCA24, 0x564D525B, 0x5EDF307F, 0x5D3D2806, 0x617712CD, 0x427ABA79, 0x470AE180, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0x1E837E85,
+    0x72559306, 0x4AC2BD6E, 0x795A8C66, 0xC6D0277C, 0x45EA903B, 0x9F811606, 0xA5195BE7, 0x3020A1D3,
+    0x09B84376, 0x14F1F70F, 0x9D660D97, 0x0FA20689, 0xB78BF9F3, 0x97EE90B6, 0x5E4D8117, 0x758250CC,
+    0xA74025D9, 0xCE526930, 0xAB8601BD, 0x6C7482CB, 0xE15E62F4, 0x7C566106, 0x6E76D648, 0x7E7312C8,
+    0x556B7C2A, 0xCB6B945D, 0x9CBBC099, 0x15CFABA1, 0x1317A6F7, 0x18EE4F49, 0x6C667675, 0x0FAB893C,
+    0x7DDB0282, 0x00C90DF1, 0xF821C5D0, 0xD901FB5F, 0x77C6C692, 0x5700E5CD, 0x97191FA1, 0x13CFDF4B,
+    0xC64F0304, 0x09034065, 0xB6ABF9A6, 0x659236F8, 0xEB1C3001, 0x7ACAE398, 0x9505A340, 0x01C185A9,
+    0x60438FB9, 0xCEEF4EC0, 0xE5E0C2AE, 0x2F429EEE, 0x504DCBF5, 0x5A0BF934, 0x52498DA7, 0x2CD01A50,
+    0xF8FF9BE8, 0x318DC064, 0x93AEC1AF, 0xB639A5C8, 0x21524AE0, 0x07D09004, 0xF249A2D7, 0x45AB7A91,
+    0x7B315C97, 0x54BDC32F, 0xA2D20EE7, 0x92123CFF, 0xA0C4CFA7, 0xF23A50B9, 0xBCAEC573, 0xC4B6CBC5,
+    0xD1A262DD, 0xC56D85B6, 0x1B99742E, 0xB35B8F79, 0xEEFCA708, 0xA91650DE, 0x97FC630B, 0xDB3DAEB0,
+    0xBEE80E17, 0xAC84DC35, 0x0F63CE65, 0x0DB756EF, 0x6A010821, 0x67E5958F, 0x25F2F60F, 0x4855E03C,
+    0x0156789B, 0xBD310D81, 0xD531F8A7, 0x177F69B3, 0x2BCAA690, 0x28168A1B, 0x275EB166, 0x276C3CAA,
+    0xEF8609E0, 0xC18F2D56, 0xBBBCE912, 0x7C73FF15, 0x9ABC8777, 0xB7DC748C, 0xB8F5584F, 0xC2B3BC0D,
+    0xF1DB70D2, 0xB2FB793F, 0x0D3F9126, 0xFBB40FF1, 0x4F204096, 0x28677F68, 0x75DBAB9B, 0xCEBED00F,
+    0x0D30B1F6, 0xA251465C, 0x1314145E, 0x498859C5, 0xDF50FFBE, 0x8B544CBF, 0x7028B2EE, 0x78579CAE,
+    0xB2CFDEFE, 0xF5A21A54, 0x234B5E24, 0x20A3C21C, 0xEC474898, 0x5F29E647, 0x2364C6D2, 0x1577AC91,
+    0xFE2EF8C1, 0xB23737F1, 0x0A42A21C, 0xDF6CD402, 0x233C86FC, 0xC131C556, 0x5C90A6F0, 0xB7599BC2,
+    0x68079EED, 0x35231000, 0xA93AC028, 0x2B09C72D, 0xF491CD60, 0xAE6612BF, 0xEEFC78F9, 0x000006EA,
+    0x00000410, 0x0000095C, 0x0000062F, 0x000007EC, 0x00000D67, 0x00000987, 0x00000293, 0x00000FCC,
+    0xFFFFF39C, 0x0000054A, 0x00000002, 0x00000193, 0x000009BF, 0x000009B6, 0x00000048, 0xFFFFFBC2,
+    0x00000880, 0xFFFFF843, 0x000003BE, 0xFFFFFA72, 0x00000087, 0xFFFFFCF0, 0xFFFFFF31, 0x000005A4,
+    0xFFFFF79E, 0x00000781, 0xFFFFF5D8, 0xFFFFFEB5, 0xFFFFF490, 0x000009CA, 0x00000135, 0xFFFFFF8A,
+    0x0000043C, 0x00000D6F, 0xFFFFFB99, 0x000003BA, 0x00000853, 0x0000080A, 0xFFFFF603, 0x00000C49,
+    0x00000873, 0xFFFFFD35, 0xFFFFF5C2, 0x00000956, 0x00000540, 0x0000079B, 0xFFFFFBDF, 0x0000053F,
+    0xFFFFF7BE, 0xFFFFFDD0, 0xFFFFFDB9, 0x0000000F, 0x000003B7, 0xFFFFF7E6, 0xFFFFF678, 0xFFFFF5E6,
+    0x0000099A, 0x00000416, 0xFFFFFAD2, 0xFFFFF5F6, 0x0000020E, 0xFFFFFFF3, 0xFFFFFEE1, 0x6C05A3EE,
+    0x7D261FF7, 0x79CC0608, 0x5BF4D7B7, 0x5D62C720, 0x59D569C9, 0x6B4DC6CE, 0x5FCF864D, 0x502EB966,
+    0x5E457041, 0x7B4A4ACF, 0x61FC674D, 0x7EACFA95, 0x6BC844AB, 0x405E4BBC, 0x7BC24336, 0x6EDCE0DD,
+    0x7EB099C0, 0x72262216, 0x58B09777, 0x5E87D28D, 0x664CFAFB, 0x6C23F1E7, 0x799BF532, 0x76B848D2,
+    0x7E64F3DB, 0x6A3B736E, 0x67626BFB, 0x51A78DDF, 0x6DC26807, 0x70423C4A, 0x4FF9DCB4, 0x763F73A5,
+    0x6E35FDE2, 0x564B53E3, 0x7EB59DC6, 0x50ACCF47, 0x6F4A7DD9, 0x53BDB3DB, 0x7E1D166B, 0x621DDFA1,
+    0x68CE9E20, 0x6C73A708, 0x6CAE4AF6, 0x60EBFC4C, 0x688C3568, 0x6A7DD64C, 0x5A8E2470, 0x5310C217,
+    0x7A26E05C, 0x59ED05E3, 0x78D4C7B8, 0x5FB954DB, 0x6DA818B8, 0x5E62CDC0, 0x6AA54FFF, 0x78FFA7B5,
+    0x5E2A135F, 0x6825E963, 0x5532288D, 0x58DAE931, 0x64951961, 0x7DD55AC8, 0x79E07D11, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0x2FA7D284,
+    0x39EECFEE, 0xA6201FDA, 0x859C57DC, 0xC6FB8BAF, 0x15559EBA, 0x29B681EC, 0x8C9684E2, 0x125DAEFF,
+    0x1A721417, 0x2370F0F5, 0xEBC31EEF, 0xCC146288, 0xB97339BC, 0x4CA8DCEE, 0x37BAF628, 0xD3E1856A,
+    0x3F9ED36E, 0xBD15DC7D, 0xC2FB43BF, 0x3C973CAC, 0xD8E3620D, 0x05C1E3FF, 0x10EB835C, 0xBBD3E1EE,
+    0xD3844DDB, 0x66C05774, 0x8B8CE2FA, 0x021FAB4E, 0x75112018, 0x82CCCC33, 0xA38ADF1F, 0xCF7A7DB9,
+    0xE709EB22, 0x90668776, 0x93FAF8B3, 0x879073BA, 0x559DBE4C, 0xACE0D403, 0xBC5E0E34, 0x3DF7B5DC,
+    0x2118AC18, 0x88FDE497, 0xC7C10E49, 0x33F7C9DA, 0x7D8DD183, 0x82B2D801, 0x1C320B0B, 0x10606B6F,
+    0x4152CFDE, 0xF56FAF90, 0x88546760, 0x6A6345BD, 0x4273EDAB, 0x92C2A576, 0x3BD18D7C, 0xE2F94554,
+    0xF5348FDE, 0x30E109AD, 0x94779ACF, 0x35E5D58D, 0x9FE31410, 0xD25CC8AD, 0x62B6F6F3, 0xC4717884,
+    0x0315AC75, 0x3E317032, 0x56DA3169, 0xF16A8E68, 0x70E2A1F6, 0x20B76950, 0x9DB1777D, 0xACB0582A,
+    0xCCA156E7, 0x92934001, 0xF2BB8A19, 0xCB1BED25, 0x833FC64F, 0xB13DBD01, 0xAAE76E90, 0x330AB437,
+    0x2272C5E9, 0x2BDFA23B, 0xEA8484F0, 0x0861AC4F, 0xED785D2B, 0xDE8E1C3C, 0xFF2807BB, 0x681B8337,
+    0x03A0783A, 0x66043C74, 0x58C1E1E5, 0x9382AE4E, 0xF4502E7E, 0x8C612F56, 0x5DBE8A27, 0x388C88E4,
+    0x6614893E, 0x5762B9D2, 0xFE6883AF, 0x86C49852, 0xF3A760B1, 0x043D3FB9, 0xDFB9CCC1, 0x44C91DDD,
+    0x0AD96C2A, 0xCE524E70, 0x3DB30152, 0x496A4B77, 0xA455064A, 0x818C2C42, 0x24E51149, 0x84B937E1,
+    0x013C02C5, 0x131A4D02, 0xA6CB7933, 0x58056405, 0x19BB4F9B, 0x07943AA2, 0x33F3868F, 0x48E8BF12,
+    0x0968B18F, 0x9F123AAB, 0xB2709C06, 0x43193669, 0x4D2D9F63, 0x2A992EA7, 0xA55EBB53, 0x6152F513,
+    0x22560D29, 0x7D8A7EF9, 0x92C6C396, 0x31421770, 0x58B0DA8F, 0x721263A8, 0xCD881608, 0xD923365E,
+    0x4CFF2EFF, 0x9B2DAAC5, 0x10532659, 0xF0441AED, 0x402EFB83, 0xEE5F9DC7, 0x90070422, 0xA6715583,
+    0x9E63E596, 0xED36EEEC, 0xBF3D0509, 0x1693CD20, 0x93B3ED17, 0x5A1DFB52, 0xC8D6DF06, 0x9956AE3C,
+    0x0C52A445, 0x2438485B, 0x1DF4286E, 0xF725CFF3, 0xE892C1FC, 0x9F299666, 0xF72BA210, 0x77B009EF,
+    0xD2BED6C2, 0x283EDF81, 0xD09756A5, 0x2C3768EF, 0x2DFBCC4B, 0xF16CEE13, 0xB59C0FF5, 0x11FCA120,
+    0xCB1D4B55, 0x7D25E621, 0xBDD4D863, 0x838F5287, 0xACF3D59D, 0x993F73F7, 0x9ED62B75, 0xB0E7C1A3,
+    0xE90318A1, 0x4B2BA571, 0xEA0F88A0, 0x837C0B7C, 0x13FE82E7, 0xF651E6D7, 0x13E6C000, 0xBDA1F46F,
+    0x0798B5AD, 0xD7A5F59B, 0xD637240D, 0xDBEABB65, 0xF013DA5C, 0x54EEA6FC, 0xA15D9D82, 0x959245FC,
+    0xEDC69B62, 0x5CCF24ED, 0xEFBCD364, 0x17BCE5B0, 0xE9420F51, 0xD6F634CE, 0x366C51D5, 0xB78D975D,
+    0xD2229F91, 0xAC889E8A, 0x69449E30, 0x843FA038, 0x515AEFB3, 0x6D2218DB, 0x52F0E8F8, 0x36DB2BB4,
+    0xB9F5A501, 0xAE33F013, 0x2C922D60, 0x66CEB1AC, 0x4693C5A0, 0xDD18776F, 0x75888E93, 0x2695474A,
+    0x3B66AAA1, 0x48CC7A49, 0x8EA1FEDD, 0x4C1F0E41, 0x22F8BE7E, 0xFA3DDB34, 0x98AE1B8F, 0xB3811CDC,
+    0x6AFC4B43, 0xAA7C0186, 0x05374E5D, 0x9E399C70, 0x58DF7733, 0x8D58D4D6, 0x5CDD4005, 0x5A19416E,
+    0x2C6CA522, 0x21DAFCEC, 0x7528342F, 0x38D4077E, 0x7EC3D29D, 0xF41C9B10, 0x022E9156, 0xBD65DD04,
+    0x416125C3, 0xCA112DD3, 0xD113FFBC, 0x58973FEB, 0x2C15BD2D, 0xBD15E473, 0x2F22A426, 0x5C5CFFEF,
+    0xE48932F3, 0x49063D10, 0x7FAF6988, 0x99C08D2F, 0x2841D4F3, 0x9CE2735A, 0xA5227318, 0xCD620D06,
+    0x7C241025, 0x4AEFB22D, 0x2612E06B, 0xDDD6500D, 0x3291AB1A, 0x6779E38A, 0x18BC0078, 0x1089824E,
+    0x879A2161, 0x0CE92657, 0x8B0F7663, 0x43BA0F9B, 0x32BE83B8, 0x41CB5E7A, 0xC9AB4D52, 0x21B98CB3,
+    0xA9D9B42B, 0xF0306213, 0x1DFC7CC7, 0x83715593, 0xD1A74C19, 0x659D1231, 0xC8BBCAC1, 0xB4228319,
+    0xB85CF194, 0x430FA82E, 0x8CF23B2E, 0x57896B2A, 0x44B4DD4C, 0x9991C51E, 0x0D93F85E, 0xAE3C68B3,
+    0x46FEE885, 0xB707C326, 0xE41763CD, 0x64AE0F5B, 0x8294A801, 0xB286A084, 0x2684D0F8, 0x372B6B18,
+    0x96DCAA82, 0x38161FA4, 0x7BFF29F3, 0x8ABDDDAC, 0x5C6BC114, 0xA876B0D0, 0xAE72BA88, 0x91ACB664,
+    0x8F6BD41C, 0xAF14D1F1, 0x49CF49EA, 0x67BEA2F8, 0x499B4AF3, 0x1A280420, 0x708369DF, 0xFFAD6C9C,
+    0x2B2CFE27, 0x0DFA4AD0, 0x4B15DC41, 0x6F528F7C, 0x59B6719F, 0x5B0147EF, 0xDF940B0C, 0xC5F1EFFF,
+    0xB662520F, 0xEC522BA4, 0x642DFC6C, 0x13BAFE44, 0xC7B97CAF, 0x58827A47, 0x44C9641B, 0x2CBAEA79,
+    0x309BEE33, 0xCD9319D1, 0xC777B60B, 0x886D55AA, 0x33A00350, 0xA2D3FF36, 0xF3A63AE7, 0xCD2102AB,
+    0xEF903A9B, 0xC45CC001, 0xB27034D4, 0x7B5C2ED2, 0xE2E3D3B1, 0x2CEACD33, 0xE3590D6F, 0x84047137,
+    0x6E565400, 0x91FB7C35, 0x3B621168, 0x0D158C18, 0x928B51F7, 0x1CA5004D, 0x8F00FE90, 0xFA83F270,
+    0xC5C7AE0A, 0xC643460D, 0x2B038B67, 0x599A5B32, 0xE027B532, 0x1764AE94, 0x3EA4BAEF, 0xF5070EC6,
+    0x4CA0A571, 0x6ACB3F24, 0x5CBF5DD7, 0x3420A809, 0xF3D18676, 0xFE4C67FA, 0x97F104FC, 0xB403ECC7,
+    0x9636CAC8, 0xC707F23D, 0x8AC9F68A, 0xDD17C483, 0x4D2B962E, 0x9C0C220F, 0xFBDFDE04, 0xD0BB2BF1,
+    0xE3787322, 0x0A13C03F, 0x9D27DABF, 0x9F5CD5A2, 0x4C0034E3, 0x4263E6A3, 0x20504CC3, 0x83030E4F,
+    0xF0A5B4EA, 0x33EA6A32, 0x3FD937B3, 0x8F77D722, 0x6E09ADF2, 0x64A2BE99, 0x8FFD898D, 0x5B40A610,
+    0x2CFFC823, 0x6D72E926, 0xF35FE0E4, 0x4A5387C0, 0xFD13231A, 0x68E73ADA, 0xEB1D5B60, 0x8BB08533,
+    0x704770BA, 0xD3C1C6A2, 0x64C66006, 0x6520EF0A, 0xD256F7A1, 0xA02F1FC7, 0x9D74248C, 0x938E1DED,
+    0x5ACAD1F8, 0x07AEFF0E, 0x1D69D45C, 0xDCAF948E, 0x0665B807, 0x535E15E8, 0x9721E4C8, 0x3995D8FA,
+    0xEDC4B0DC, 0xB2CAA8A9, 0xDD52FC3E, 0xB25AB94F, 0x39D9D0A0, 0x3C6FBD2C, 0xBE14B508, 0xE07D0E13,
+    0x8D8B7CBB, 0x4C82C100, 0x994664FA, 0x454AAFEC, 0x60DB3AA5, 0x61921BA1, 0xF56D8834, 0x84ED3FC0,
+    0x9D5A016A, 0x5DDEFFF5, 0x6F2D58E7, 0xE2254B8C, 0x6E66CE17, 0x600779F7, 0x664B4384, 0xD2B7E40E,
+    0x90900661, 0x9AB3C845, 0xB4794FEF, 0x6DEBC75C, 0xEFC461B2, 0xA4A99415, 0xBDADD306, 0x3D61A61E,
+    0xB8613AD2, 0x0E60159D, 0x8EAC8F15, 0x9AE5F70F, 0x91C7BBF4, 0x12B63C2B, 0x4858AF61, 0x0394048C,
+    0x9A8C19A7, 0xD02EECDA, 0x5249AFDF, 0x27FEACCF, 0x2A055947, 0xD1B86304, 0x98FBABC7, 0x50E9EE9D,
+    0x663519EA, 0x77749E7E, 0x78156BAB, 0x57AD4362, 0x78200C48, 0xF745D51E, 0x151CF114, 0x8B8775AB,
+    0x28A4BD99, 0xAB9F64F2, 0xCF05A69F, 0x35C048C1, 0x01907553, 0xD1A99598, 0xAC5B11FE, 0xBBCCED41,
+    0x30AD50D4, 0xD3A94F32, 0x6ACFA863, 0x54F15534, 0xC861D32B, 0x529D8A43, 0x4FD38472, 0x2F411A10,
+    0x65A0C3C9, 0xDA33BDBA, 0x1BE57788, 0xBD2AB53D, 0x7CDC7A64, 0x3163ADDC, 0xD4873316, 0xEFAA3EF0,
+    0xB14398BF, 0x5B85DB97, 0x279E1332, 0xDA24BB4E, 0xD810A358, 0x3CEB97B6, 0x0F879DAC, 0x126F7371,
+    0x0190DA96, 0x0AB3DC05, 0xDB4EB972, 0x217D5B1E, 0x7DA07EC2, 0xFD10E068, 0xF214D1DD, 0xAA44780A,
+    0xD1A424E5, 0xA52D81D1, 0x7194FBC6, 0x7C845EED, 0x3B7ED6F5, 0xFE824A47, 0xD7236F9B, 0x139EBA48,
+    0x867D5450, 0x8B4EA89A, 0x82030586, 0xEF268E1F, 0x4849C107, 0xE16E59C6, 0x40AD3A85, 0x9937AC93,
+    0x88E6C590, 0xF2971679, 0x0A222203, 0xF88D78AE, 0xCA4B0135, 0xE1F1B8F4, 0x6E28C1CC, 0x3D211777,
+    0xDC44E989, 0xC32A9F0A, 0xE6C8BB7D, 0x473A607B, 0xD12E5CFB, 0x550AC3E1, 0x6C3C0669, 0x3EED8E34,
+    0x7ED788E5, 0x9C5D7FA3, 0xED86E9AB, 0xE6C286FC, 0x032DC5D8, 0xCC6DA103, 0xAA53083A, 0x9273A446,
+    0x84BF7403, 0xB5DB9482, 0x74CDBC1A, 0x58322C87, 0xE2363E09, 0xBC064795, 0xE2C8ABFA, 0x75575FA2,
+    0x246F5935, 0x061C9020, 0x607627E6, 0xE98CAA00, 0xB2EFC707, 0x5793672A, 0xC6419A8A, 0x8B6C8C5D,
+    0xD81146BA, 0x9785682F, 0xDD25C1A6, 0xF6941860, 0xD1DDE82E, 0x750A663B, 0x7A8C21F2, 0x339E1468,
+    0x9F517730, 0x8719EAD7, 0x57A27C00, 0xAC0673CA, 0x1F34ED2F, 0xFD608D60, 0x3B038CB1, 0x2534523F,
+    0x32AE73CF, 0x0B6F6103, 0xE2EDC9AC, 0xD8F40FB8, 0xD9306A5B, 0xB77B5EC9, 0xA9E2E5F0, 0x028C7CE5,
+    0xA6531A58, 0xDB6B4398, 0x0FDE2DCE, 0xB4A47E27, 0x3EF32872, 0xA9A8C5B7, 0xEEBB8C6D, 0x70BB2413,
+    0x668AC5A0, 0x169537D7, 0xC46773A2, 0xE54F03F0, 0x2E2B495E, 0x314411A8, 0xF00BDEB1, 0x1F7E74B8,
+    0xF511FA2F, 0x208922BF, 0x7736652A, 0xC33798ED, 0xB460B226, 0x235E18F9, 0x5164D8C2, 0x091F9431,
+    0xF1F563B5, 0xC84624BF, 0x8F53AE94, 0xFE9428F4, 0x4CCC9440, 0x71DBF692, 0x8921EF95, 0xC2132AAC,
+    0xAAB97441, 0xF7861465, 0x53F148F3, 0xE516CDA2, 0x3446A6B3, 0x302F9556, 0x00BD4806, 0xCE6B5390,
+    0x77E8BC67, 0x4EC1DEEE, 0x4642D872, 0xED29CDEA, 0x6055E162, 0x59B307D8, 0x42AF57A9, 0xE5B2533A,
+    0x5F086FBD, 0x7F5EBD47, 0x09C1A982, 0x5C93EA82, 0x30D5852C, 0x350A1AF7, 0x8AF5765D, 0x1EF452D0,
+    0x92CDA40D, 0x310D0387, 0x87095D3B, 0xC9231F25, 0x658887C2, 0xAC862354, 0xE95B3ADD, 0xE917473C,
+    0x6E0B84A8, 0x20680899, 0x1726BD40, 0xBF0EFCAF, 0x7B2EAAF9, 0x4125BF99, 0x729DD4DF, 0xC147381A,
+    0x60329418, 0x47FB08C1, 0xDD763795, 0xB7E3F5EE, 0xF41DCB81, 0x78794370, 0xAED1A333, 0x9ACDA05F,
+    0x6DF73692, 0x8607F278, 0x2E97999E, 0xD1B3B2A4, 0x63417C29, 0xA03124D2, 0xB574CE79, 0x50860E5B,
+    0x4B2839C5, 0x2568B342, 0x7C5EFFA5, 0xDB650C23, 0xFD87FAAB, 0xD797556D, 0x564E5F78, 0x683C1B01,
+    0xE925E755, 0x7F43135A, 0xE1363026, 0xF5D3F318, 0x33869C55, 0x1F0993D0, 0x79C7AB9E, 0xCB702AFA,
+    0x0557F072, 0x306A3A9A, 0xC277DFC0, 0xF6D839B4, 0x9E036153, 0x737C4A6F, 0x5DBA53BB, 0x7B0B2509,
+    0x87B3D620, 0x6B6AA0E5, 0x4155219F, 0x0F44BEBA, 0x46F0D292, 0x92B396FB, 0xC7AE3C55, 0x9766D888,
+    0x38260336, 0xE823C377, 0x6C905B2F, 0x2EC4EBBC, 0x890ECB48, 0xBD6849ED, 0x9D06341E, 0xBA837805,
+    0x731C474A, 0xD41CF02C, 0x77BEBE20, 0xCE34BC2B, 0xD1E22CD8, 0x1F8EE85F, 0x46BD0DF1, 0x7EE6A595,
+    0xF0443BB5, 0x485AEF92, 0xABA6536C, 0x30016464, 0x3746D533, 0xEF60AE30, 0x195D1D60, 0x3F9C5184,
+    0x274159B5, 0x6745EE7E, 0xCEB3A8BE, 0xC3BAA1D3, 0xB34B5C47, 0x1543F482, 0x64110325, 0x14E00892,
+    0x44BECFFC, 0xFE60CC18, 0xA65823EF, 0x1763E8E6, 0xFD3BF228, 0x96D812F5, 0x97B42776, 0x5231FC5C,
+    0x9D79AE1F, 0xD496A66D, 0xED845D9B, 0x85A6AFC4, 0x467C2833, 0x2B684077, 0xF651E1F3, 0x304A9376,
+    0xD82421D3, 0xA575D368, 0x4E8D74F8, 0x8823AE43, 0x473784AB, 0xC27F94C8, 0xA6DEA711, 0x08B6875F,
+    0xAF157BD1, 0xE4ECEBA3, 0xF9293DDE, 0x81DF540B, 0x74C15D43, 0xAF8D4E27, 0x2EBBD561, 0x3A84B158,
+    0x2F1324DA, 0x4F88B2B2, 0x64D64CD6, 0xEC478EE4, 0xD39912BB, 0x3F8BFAF2, 0x596FFA9A, 0x8D170FC8,
+    0x25672FE5, 0x86F31782, 0xBDD2652C, 0xA14278FA, 0x685817AD, 0xEFF1FCE7, 0xB21C125D, 0xE787A4C5,
+    0xAE209592, 0x7B862DB5, 0xD4EE57BA, 0x2144D837, 0xD67A05AA, 0x9EE927E7, 0x10938C37, 0x068EDEE9,
+    0x3E880D42, 0x08EDD1CF, 0xD5A090AE, 0x57FA4CEF, 0x65C805EA, 0xB974030B, 0x3818B33B, 0x8AF2BFF6,
+    0x63B3FB2F, 0x894CCFF9, 0x6DA0084B, 0xD38E8318, 0xDD82AA4B, 0x02064735, 0x2FBDAE99, 0x8C74D647,
+    0xB5DC53BD, 0xEE5F4ACD, 0x337DBAC5, 0xE526FE85, 0x495891A5, 0xCB95D7B3, 0x6E42C181, 0x4CEA2391,
+    0xFD6B627C, 0x09FD0093, 0xF9AF3875, 0x652E0EBF, 0xF9CF2BCA, 0x32322A06, 0x388E5622, 0x347102F3,
+    0x93D540C4, 0xE8F92E59, 0x7765B860, 0x821B2028, 0xC1AEAC9A, 0xC8AF072A, 0xC5DF0192, 0x0A243FA2,
+    0xDE7935FE, 0xE33184B4, 0x68DC6C3D, 0xD30D8C43, 0xF10DE4BB, 0x1637D36F, 0x58D3DC44, 0xFACC70E7,
+    0xC61B12DD, 0xC61E1571, 0x99F23734, 0xA00B179A, 0x4BA7A5CF, 0x4DECDDDD, 0x2A46289A, 0x9AEFFE67,
+    0x513E722C, 0x988A4FB2, 0x4105C2E5, 0x48A9EE59, 0x4BFA03A0, 0x631AC77B, 0xE60AA52A, 0x251BB9C4,
+    0xDA8F258F, 0x99236CDB, 0x5BFDB606, 0x231785A8, 0x904901DA, 0xABC5CEFD, 0x9AA6089B, 0x3B4119E9,
+    0x46D98ADB, 0x83A0085E, 0x552660B7, 0xBD47482F, 0xC11BB72E, 0x7A6AE411, 0xBB26813B, 0xD707C36F,
+    0x7D83FE40, 0x26A449A4, 0x68B5B1E8, 0x4016D9E8, 0xDA37C9FE, 0x7F97E795, 0x744EE115, 0xFD27C6C3,
+    0x5E7BE053, 0x7CC12FDA, 0x15CCB70D, 0x22AC109A, 0x1FC94457, 0xFA42F912, 0x4CF6F5A9, 0xA4008AD1,
+    0x073469D2, 0xA88F8FD1, 0x96A1124C, 0x5D331E7E, 0x5CE4D9B7, 0x8B9F77A5, 0xC3E7D16C, 0x3F620F7D,
+    0xFF1A4F93, 0x016DA037, 0x61267937, 0x2768F947, 0x57AD3AA5, 0xAC7D1B18, 0xB25551AD, 0x74AAC798,
+    0x225E6205, 0xB7B4AB21, 0xC114EA55, 0xC6EC1468, 0x767AF1C3, 0x70CAADEB, 0x9A5BDC25, 0xA8C099BA,
+    0xF47145CC, 0x811307C8, 0xAFFA5DC9, 0xA2FA6A73, 0xBEE9E7C9, 0x855643AA, 0x3619F75C, 0x2B3A3988,
+    0xB6BEBE87, 0x342C273A, 0x24BF6460, 0xB771A6E7, 0xAF0EECD2, 0x4C4D65BE, 0x3D90A078, 0xA05897DE,
+    0x70B5669F, 0xE1BB0B01, 0x70984AA0, 0x596B2C96, 0xF1925D6D, 0x52D768E5, 0x604EFF0A, 0xF90A2BAC,
+    0x63951EEE, 0x6D6F38C1, 0xE6EE7E7C, 0xD9A7516A, 0xB18E2DA3, 0xBD1A4F56, 0xCA63114E, 0xB0F4CBA9,
+    0x3996C68B, 0x8C9107E8, 0x5F52E78C, 0xF36218C2, 0x38961B74, 0xD619873D, 0x6FAC9E48, 0xA77E8AD1,
+    0xAD63977C, 0xBBC28E95, 0xB424003F, 0x7D51D8B0, 0xDC93B06F, 0x969D34E8, 0x8A5E63CC, 0xFEDC8792,
+    0xD22F1C5A, 0x4528AEBF, 0xB084556B, 0xDA70C638, 0x0F380746, 0xE7B7DC3D, 0xF0123DE5, 0xC8723C13,
+    0xD3132358, 0x9DECDB9E, 0x7F6111A6, 0x8AFF5BD3, 0x85AE07DC, 0xCB14AECC, 0x04ABBF45, 0x2583AA35,
+    0x402FD09D, 0xC34E9C02, 0x03F9090A, 0x6A633A3C, 0xE9F764F1, 0xEDA21CB1, 0xDE7CE66C, 0xD4A5F6DA,
+    0x6BBA6302, 0x45721F07, 0x17EE3E2D, 0xFF75DC95, 0x0D639D68, 0x081EC4D2, 0xC7D82414, 0x06CD7024,
+    0x2E7E3C27, 0x2A2352BB, 0x18E530B8, 0x67B18385, 0x1E65FB1F, 0xE08D36F8, 0x59A1892B, 0xB8A4BA4C,
+    0xB4BAB1AE, 0x28BB726D, 0x40F1571C, 0x1BC3B6A2, 0x4A350FA5, 0x5EBD3C78, 0x4940DD58, 0x043C18F1,
+    0x81A550AD, 0xC795E40D, 0xD90FB006, 0x82DF9971, 0x2DE0E260, 0x9A1B3118, 0x60A95EF6, 0xFFFFE696,
+    0xFFFFFE43, 0xFFFFDDBE, 0x000002CF, 0x000013F1, 0x0000190F, 0x000004A0, 0xFFFFE222, 0xFFFFFF6C,
+    0x00001CA3, 0x00000F8A, 0xFFFFF08B, 0xFFFFEF25, 0xFFFFE7DF, 0xFFFFED82, 0x00001570, 0x00001F4B,
+    0x00001347, 0x00000072, 0x00001302, 0x00000EDA, 0xFFFFF77C, 0x000000B6, 0x00001649, 0x0000095B,
+    0x00000CD1, 0xFFFFE6C6, 0x00000061, 0x00000D9B, 0x000020BB, 0xFFFFFDA5, 0xFFFFFF89, 0xFFFFE98D,
+    0xFFFFFFE3, 0x00002049, 0x00001EF0, 0x00001831, 0xFFFFF871, 0xFFFFE4CF, 0x00000A7F, 0xFFFFF25A,
+    0x000017C9, 0x00000E11, 0xFFFFE2CC, 0xFFFFEF28, 0xFFFFEA5B, 0x00000AE6, 0x0000099D, 0x00000BF8,
+    0xFFFFED44, 0x00000BD5, 0x000011E2, 0x0000174E, 0x00000EF4, 0x00001867, 0x00000671, 0x00000B59,
+    0xFFFFE5F0, 0x000000B5, 0xFFFFE116, 0x0000154C, 0x000007A7, 0x0000173B, 0xFFFFE199, 0x53FA2D04,
+    0x47F9C5E5, 0x45773D3A, 0x6069D7C9, 0x5AFC6B48, 0x447FD20F, 0x7EC88EED, 0x5264FEC7, 0x7F26F954,
+    0x55B5BBA3, 0x4C174E1E, 0x46758638, 0x616D0D89, 0x77EA2D5E, 0x44F24EE9, 0x59971D94, 0x4A86707B,
+    0x4FD9BC9C, 0x4610E685, 0x7E35173C, 0x59F946F3, 0x5F6967D3, 0x46D4C91A, 0x4CA8EF7F, 0x551BF744,
+    0x5C3984C9, 0x5A13FA58, 0x5BCA192F, 0x47F07717, 0x7CAD829A, 0x4047FB33, 0x5A9D5F5A, 0x5397009F,
+    0x57139D14, 0x4EEC8754, 0x49CF49FF, 0x5CC9E54B, 0x535EC8DB, 0x5202D0FA, 0x5F09DC85, 0x53086402,
+    0x7A87DF3A, 0x53045542, 0x5530CB6B, 0x7DF99BD4, 0x5F5CC100, 0x50E74FBA, 0x5FC2A67C, 0x4638ADB8,
+    0x7C6DD43D, 0x61279E5F, 0x4EFF0992, 0x5A6BB795, 0x4B10165A, 0x487A7EE6, 0x5AAFB29E, 0x799715D7,
+    0x5B795100, 0x41B7DC6E, 0x4E8AFCEE, 0x5D5D8695, 0x418783A7, 0x49E4281E, 0x44FCB420, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF7,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0x88129456,
+    0x3A968853, 0x8F607A02, 0xAF2A1690, 0xCC2A1EEB, 0x8FCBC392, 0x329482D1, 0xACF21CC2, 0x85B7F694,
+    0x009AFE16, 0x07A62E8F, 0x17126EE8, 0xCAA37DD4, 0x84B8F813, 0x06AAD8B5, 0x7041EEEE, 0xF38B52D3,
+    0x21C3CF14, 0xF7E943AE, 0x1709C140, 0xBF5B986F, 0x0122B3EF, 0x06103499, 0x37E2CA8F, 0xDCF66662,
+    0x296DE1E5, 0x461F3B68, 0xDABDF2BA, 0xBE5B8AFE, 0x97BD62F3, 0x718E1A72, 0x942CCA21, 0x43AABEB0,
+    0x4FA09BCE, 0x5014637A, 0x1859A51B, 0x6E918DE5, 0xB14B6C0B, 0x6CD2B1AC, 0x0C83FCDC, 0x0819D11F,
+    0x53EEC717, 0x0244F27D, 0x6C176BFD, 0xDBE2D383, 0x49D3E9C6, 0x73A64E66, 0x67542B05, 0xE558EDC0,
+    0x7AE7DC59, 0x5B5BFD97, 0x2B3C2C69, 0xAE5C3FFE, 0xE625DFDA, 0xCD9DE3FD, 0xD229977A, 0x2B3AC977,
+    0x600E89E0, 0xAED0000E, 0xC9A06063, 0xF2CDA54E, 0x84D7602E, 0x0E3C9C11, 0x558E0870, 0x2C9D44F3,
+    0x30D389F4, 0xD6534FB5, 0xCA19CC9C, 0xE1E0AD5B, 0xD4D26E2B, 0x675220BC, 0x56204107, 0x6AAF1B76,
+    0x8B88759A, 0x6723426C, 0x7258147A, 0xC3E6A1EF, 0x058EE5AA, 0x294574DD, 0xC67B32ED, 0x0EEDCB51,
+    0x36034748, 0x68E9C2DC, 0x36975604, 0x9EBF9A8C, 0xBE063256, 0xF99CF74D, 0xFE575D20, 0x7B10E9EF,
+    0x2731ECE8, 0xF169F488, 0xD48BB718, 0x306AE346, 0x231D0D68, 0xE0781B20, 0x39156E16, 0x65B810AC,
+    0x4D21B869, 0xE6AD8216, 0x88EA6F21, 0x3FF90572, 0x8F7EA1E2, 0xC5F93ED3, 0x53570F35, 0x6683C1DA,
+    0x49A685F2, 0x20F7F232, 0xA0105E68, 0xDB0FC960, 0x0236425E, 0x2A1D65BA, 0x8F3AAE9B, 0xABCA7E03,
+    0x73A6C224, 0x4E39E4B9, 0xC9EA0276, 0x19777A7D, 0x929969C1, 0x83F603CB, 0xB9B5C7C4, 0x5785D4D7,
+    0x83A08CD7, 0xDD1ECE50, 0x1ED54BDE, 0x9D2366B3, 0x16604030, 0xBA68692B, 0xC008335B, 0x32585600,
+    0x97B76B4F, 0xBD1B7543, 0xD0FD1C4D, 0xE72DA318, 0xDCA28E60, 0xB64E51D8, 0x6531E25D, 0xCA6C8B8D,
+    0x937011FE, 0x0132E371, 0x13398AA2, 0x7086E27D, 0xD1467D09, 0x6D9D9A7B, 0xD60CCA2E, 0xFFFFF5A4,
+    0x00000AB5, 0xFFFFF849, 0x000007B2, 0xFFFFF95F, 0xFFFFF0A4, 0xFFFFFDF0, 0xFFFFFD66, 0x000006A1,
+    0xFFFFFEB6, 0x00000638, 0xFFFFF3BA, 0x00000C10, 0xFFFFFA37, 0x00000258, 0xFFFFFACC, 0xFFFFF67D,
+    0xFFFFF20D, 0xFFFFFA5D, 0xFFFFFE85, 0x0000083F, 0x00000BF0, 0x000004D9, 0xFFFFF709, 0xFFFFFD06,
+    0xFFFFF61B, 0xFFFFFBD1, 0x000002FF, 0x0000098A, 0x0000005A, 0xFFFFFEE4, 0xFFFFF685, 0xFFFFFB8B,
+    0xFFFFFED2, 0x000009E3, 0xFFFFFC64, 0xFFFFFCCC, 0xFFFFF9A3, 0x00000987, 0x00000776, 0x0000022B,
+    0xFFFFFF16, 0x0000031E, 0xFFFFFFD9, 0x0000064C, 0x0000037A, 0xFFFFF656, 0xFFFFFE06, 0x00000A6A,
+    0x00000234, 0xFFFFF5A0, 0xFFFFFBC1, 0x000005E5, 0x00000AE1, 0xFFFFFFCC, 0xFFFFFE56, 0xFFFFF4D2,
+    0x0000036E, 0xFFFFFBB8, 0xFFFFF2CE, 0x00000C7F, 0xFFFFF35C, 0xFFFFFB84, 0xFFFFFBD8, 0x7A01861C,
+    0x6CDAC56B, 0x5B0BAE76, 0x40A9B8AD, 0x59B14632, 0x52383E5D, 0x7F209AAC, 0x7E7DF27D, 0x54F6231D,
+    0x70815CB4, 0x631B0BC3, 0x56698D92, 0x5719E190, 0x4147AC20, 0x4041C5DD, 0x6643044A, 0x402B36D2,
+    0x54AC14EA, 0x5C86C819, 0x5150AC0B, 0x6DD8AB23, 0x5EFA7B73, 0x40F9C0E6, 0x798845DF, 0x67AA0F76,
+    0x700EDA0D, 0x7F60D0DE, 0x6D8A3425, 0x6A391C0F, 0x747F39F4, 0x7F0F59EF, 0x5BDBAAE5, 0x52DFB791,
+    0x6597088C, 0x6F286B97, 0x5BA9F459, 0x76D77A8F, 0x76A47EBC, 0x69986ED3, 0x7E44B510, 0x7093B97A,
+    0x52482A42, 0x70A39768, 0x6E087BDA, 0x78B0E31D, 0x7072826D, 0x412515C0, 0x6BCCC1C9, 0x5606E676,
+    0x73DD0343, 0x5011D434, 0x6E79346C, 0x7D6C1F42, 0x572920CA, 0x7360B3F2, 0x411C523A, 0x5D53ED9B,
+    0x62CEF126, 0x63C33D97, 0x583855BC, 0x58371B30, 0x58F8D3F0, 0x7086736B, 0x65175970, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA, 0xFFFFFFFA, 0xFFFFFFF9, 0xFFFFFFFA,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xAE685B06,
+    0x4F861A2E, 0x24E05F17, 0x05B4D194, 0xB2CA0A97, 0xFF956FC6, 0x1D838336, 0x9B28B353, 0x51B31FB2,
+    0x8E6EA2EE, 0x0A010C3E, 0x66BE1305, 0x5CB3A087, 0x0EA53564, 0xAB97BAF2, 0x39CEF49B, 0x773C6F2A,
+    0x5F245CC3, 0x68A8BF5D, 0x5C8751FC, 0xA90EEADD, 0x7DD1E9BE, 0xB63864CB, 0xC10DDC8B, 0xEF6F0972,
+    0x7D909F7A, 0x8E548924, 0x292DCFF9, 0x11F4F5CC, 0x4A75D01C, 0xE3B8505B, 0x5BC80754, 0x2F0588B6,
+    0xCA9AB4F8, 0xF8A78E96, 0x946BB936, 0x184C1E9C, 0xADB2DD7B, 0x5AB5E817, 0x03354076, 0x6D46A6B4,
+    0xF02F1383, 0x739005C4, 0x93B45B29, 0xF92B22E5, 0x7687D6B8, 0x418BB5CB, 0x9AAD9465, 0x115D862B,
+    0xD334A1E0, 0x386F922A, 0x8F00C714, 0x7DBA546B, 0x940AC520, 0x2D9FFD20, 0xCF086376, 0x1B7EF68D,
+    0x988AEE0C, 0x76698B43, 0x258F200D, 0xC1111226, 0xC6124582, 0x9637274A, 0xAC730747, 0xC7B00D25,
+    0x4C6EDC69, 0x48F0A2CE, 0x76617E0D, 0x5FB2DC1E, 0x96CCAD4C, 0xC6961763, 0xC5778939, 0xDD0E0328,
+    0x56455E92, 0x77120AE0, 0x2034905E, 0x7F3D6E60, 0xCD148C18, 0xEA0BDCBA, 0xAC031299, 0x2D97C6CF,
+    0x37E6C377, 0x3EA907E6, 0xCB7FADBA, 0xEF222AC7, 0xFAD7AE48, 0x9B94CC2E, 0x30B525A5, 0x7E87AA9B,
+    0x6E607BD8, 0x9FFD05DB, 0xC6B69EAD, 0xD177E0A6, 0x4F3E06AD, 0xF8752A67, 0xC72A77AF, 0xC4B16753,
+    0x0F22682A, 0xD90AEEB1, 0x95024CFF, 0x5C70620A, 0x5F9646CA, 0x7E458387, 0xE06D3318, 0x02AACACC,
+    0xB3A7B0CB, 0xEAB4A487, 0x68C8F570, 0x5CFA06A9, 0xA4F71E8A, 0xEF6AD949, 0x46F3F8BE, 0xA8F7D056,
+    0xAF9FFCF2, 0x7EC5E705, 0x0229D8CC, 0x3D5A19A6, 0xF4F3436C, 0x60324D07, 0xF167B749, 0xE824BC56,
+    0x3D98858A, 0x46148BD0, 0x3F946041, 0xD89826F1, 0x4F70C659, 0xB6119385, 0x9F552EA1, 0xBF10F720,
+    0x0E90E650, 0xE2D595E4, 0x15D3E2BB, 0xD5C36F37, 0xEAB2ECDE, 0xFFBD4E5E, 0x3B08191C, 0x0DF89C8D,
+    0xCAAC29D8, 0x1AF0BD0E, 0x8F34B5EB, 0x78E62264, 0x53E7FF7B, 0x6372DBBA, 0x3C1E557C, 0x14EDAB19,
+    0x0F68A239, 0xF9F9184E, 0xF2424825, 0x28672EB2, 0xA6666634, 0x7D0C641E, 0x3D67BD57, 0xF07C65EC,
+    0xAC43B418, 0xD1D6CB1E, 0x5519863C, 0x5F272BB5, 0xEEDE609A, 0x5CF83882, 0x72E009CA, 0x5FBAA785,
+    0x002CC2D8, 0x44BB6F4C, 0x701BA859, 0x374215A8, 0x0A5021BF, 0xCBD25545, 0x3BBFFC32, 0xBEF38F53,
+    0xB59990D8, 0x6FB97899, 0x13C99387, 0xC4DA2ABF, 0x1DA04AA0, 0x2361A6FD, 0x6454BB5A, 0x181C7D8F,
+    0x0EDED274, 0x5C6FA5FE, 0xD03E6D2C, 0xD09CC66B, 0x6263B81E, 0x3E4367D3, 0xE542CE99, 0xB5693D22,
+    0x863E8C3E, 0x7CA62544, 0xDA3FA708, 0x3CD1769B, 0x8B9B3C1F, 0x6E836247, 0xAE91EC01, 0x49B20864,
+    0xD8905CDB, 0x5A836A77, 0x8B7893B1, 0x41024434, 0xB2AD869B, 0xB1294F15, 0xCB045A24, 0xDEA31368,
+    0xA1DBCB49, 0x3AB2BAF0, 0x09E1E141, 0x8FE75BF5, 0x0FBD2872, 0x40BAA2EB, 0x5A858763, 0x96B47D87,
+    0x007BAEB0, 0xB4FE2C5A, 0xB4FE5FDE, 0x5CA66C6A, 0x3E41D134, 0xDB9DE14C, 0xFA23E919, 0x7B9BF8EF,
+    0x9724C7CA, 0x5198DEE1, 0xDC0BE9CC, 0x9BE21306, 0xE9C185E9, 0x5596191F, 0xBAEA09AE, 0xC2E6F7C7,
+    0x50715763, 0x16AD9FAE, 0xD202CF02, 0x854D7068, 0x8B392315, 0x85A9CDC9, 0x4A172BA2, 0x2C467474,
+    0x6536CE5C, 0xB517F106, 0x31364D37, 0x1FEFA14F, 0x4C727397, 0x78D04DD1, 0x6F79B52D, 0xADDD1D04,
+    0x60B2AA27, 0x9430E7CE, 0x1567BEBD, 0x2CAB1E9A, 0xD64830CE, 0x71A68922, 0x0D29D8BD, 0x0449F44D,
+    0xF2422C28, 0x611F3A1C, 0x2AE3C5BF, 0x0AFC2CC4, 0xC65AC84E, 0xF31CCA74, 0x4CB79245, 0x35C5D4AE,
+    0x7EC9D7EE, 0x55B8D1BD, 0xDC7D617B, 0xA3BD16B4, 0x159B353F, 0xA702018B, 0xBE5DFFD4, 0x3FADF915,
+    0xFC586416, 0xA746FCD2, 0xAABC90A4, 0x239511D3, 0xACB330BC, 0x199C4ABE, 0xF247D9A5, 0xD3B8AA98,
+    0xED1896AA, 0x849168D8, 0x577FA0C9, 0xCD14046D, 0x0D9AD243, 0xF29E0E8B, 0xA1B20E49, 0xEF423F82,
+    0xF5F269BF, 0x8112361D, 0x1EC5A0C2, 0x3BEE3DB0, 0x62EB0038, 0x7CDD0FF9, 0xF2FDF626, 0x7B3894B3,
+    0xA2DD8F64, 0x3BD1D212, 0x12DA03AA, 0x3DA3B279, 0xF55C0866, 0x948CF07A, 0x88D5667A, 0xAA222837,
+    0x78718220, 0xF0DE3C38, 0x564AEA3C, 0x03671AAB, 0x416E2A8D, 0x2A2BBB47, 0xC7E7B9B3, 0x18D3D2BE,
+    0x31034CB7, 0x6189E8F8, 0x77EE8287, 0x37B738C0, 0x7429E1BC, 0x00616B4A, 0xAD17F058, 0xBCF35221,
+    0xDD9F52A4, 0xC72DDBC1, 0xBE03FC96, 0xD78885AE, 0x13029C74, 0x7BF4A915, 0xCDC58A79, 0x1EF70DE2,
+    0x5D796817, 0x756E5C85, 0x6C5D3D69, 0x2547A898, 0xC653BF74, 0xA6C15DE9, 0x60E6B8C2, 0x7C483FFB,
+    0x0AA2F3BB, 0x313CAFA2, 0x200A2403, 0x8E50E55C, 0xDCB3A460, 0xE375FF1E, 0x18359DC2, 0xD145D925,
+    0xD5EED954, 0x6D9AE215, 0x0D9AAF2D, 0x8E348200, 0x7E30A80F, 0xFC0C915E, 0x2AFD38EF, 0x142B462E,
+    0xDE3A3CE3, 0x4FC721EB, 0x834495C9, 0x52D52A37, 0xE4B6BD13, 0x142E29F7, 0xA5889A3F, 0x0E3F75F1,
+    0xABD9D805, 0x04EA7865, 0x6407C8A5, 0xC9198E1E, 0xD2A8A82D, 0xEBCFF387, 0xBA69000E, 0x3BFAB1E4,
+    0x2E17FF5E, 0xA27F1040, 0xE6D932BD, 0xA883BB4B, 0xEF1356B7, 0x91505425, 0x8EA87E28, 0x96529AA2,
+    0x8CF34BF0, 0x740F8F1C, 0x5DA67EC7, 0xD144BADD, 0xA572FDFD, 0xF8C27B2C, 0x0DD772A9, 0xDA587A0B,
+    0x61A4F675, 0x82AE284E, 0xB0DB7FA0, 0x2C797975, 0x5C7C749D, 0x916117A7, 0xD7D5152D, 0x037EB033,
+    0x0E66ED17, 0x1AEE1A13, 0x4B1673EB, 0x46414034, 0xE890AD19, 0x2E86DCC3, 0x246CEC12, 0xEB9F0BE5,
+    0xCD204956, 0x491B0CA8, 0x67ADC0E8, 0x4E5AA949, 0x99970F0B, 0xB7F3AE49, 0x2633F20D, 0xB5D878B4,
+    0x0E95F302, 0xF0A762BC, 0x454CD7D8, 0x99B7558E, 0xF3D2E0DE, 0x81C5E0B9, 0xD38E8867, 0x76EFEB3E,
+    0x23E1A8F4, 0xC1DCF2C5, 0x931F12F8, 0x41BEA5C4, 0xDA387E55, 0x101ED61E, 0x70BC7CD0, 0xB404AED4,
+    0xC0BD5A95, 0x53FC1EF7, 0x6A9C05FD, 0xC9B40531, 0x2CB8E332, 0xF5CE2344, 0x3E4DABF9, 0xE917B030,
+    0x778A590F, 0x85B189BB, 0x5A9794CD, 0xB7CCD6D1, 0xB359D030, 0x2F2F35B5, 0x984088DA, 0x159031B3,
+    0xF5D38AF3, 0x41F10779, 0x0EC6501C, 0xC19D5EBC, 0x0F55F0D4, 0x26339919, 0x99BFAE14, 0xB2F7B691,
+    0x2366F538, 0x6EB7978D, 0xB45D06D8, 0x0BBE876B, 0xB3F713A9, 0xD95B08CC, 0x44997BC9, 0xF2030B0A,
+    0x2143B2A9, 0x7DA54E2A, 0xD44D365A, 0x93248FAF, 0xD5FCA9C5, 0xCE4EBFC3, 0xF839762A, 0xC9A1D5CE,
+    0x3B8ECF6F, 0x99B94AA5, 0xF786CCF5, 0xDCF47320, 0x116E0304, 0xF776ECCD, 0xAEC88C8D, 0x456DC123,
+    0x923F2271, 0x3CF9D646, 0xCFF6E788, 0xAE94DA73, 0x73DEC3D0, 0x46E7B015, 0x871A4D72, 0xEDB4FE1A,
+    0x74157E82, 0xD97C6CF1, 0x774E6743, 0x505460C5, 0x349A72BA, 0xFC47DD6F, 0x3613E7EF, 0xE70F11F5,
+    0xCCD040E4, 0x4198AE1B, 0x68F57DFB, 0xC77957FB, 0x354DBB03, 0xD0BB938A, 0xF7C23F38, 0xD5FE9858,
+    0xF3A4EB6B, 0x5652B03D, 0x2BD81B98, 0xECE87F2D, 0x1B668686, 0x8E8408A9, 0x38B0CF9E, 0xB05054D6,
+    0x15AC5B78, 0x377B2EBE, 0x615CC12C, 0x5B7E7C5C, 0x062F2242, 0x7B8F3366, 0x044BB301, 0x85E96B56,
+    0x2326DBC0, 0x1EB158C7, 0x34F95343, 0x4CBB8F69, 0x71431D54, 0xE90762BC, 0xF5E2DAF9, 0x6FE145D5,
+    0x8C5DCC40, 0x408E312D, 0xF5152857, 0x044A8420, 0x6DA17D06, 0xD17D774B, 0xFF73CB4B, 0x039C07EB,
+    0x897A2B1D, 0x2E77F213, 0x1673D463, 0x7AF553D4, 0xC721AF1E, 0x498D1BDD, 0x7342EE98, 0xBF0F2A6E,
+    0x9F7CBEB9, 0xD41BF170, 0x86542A64, 0x467FCE46, 0xAA13DA17, 0xE9985F23, 0x631FBD9E, 0xCE158C09,
+    0xA6F93BB0, 0x95D3C153, 0x2BF1E2FE, 0x83302FB3, 0xF40A5313, 0xAA957673, 0x260C9752, 0x21739E34,
+    0xC2A8A788, 0x95A2B0FA, 0xEE0E61B2, 0xF6258E0C, 0x87FEC1D4, 0x8774F1CE, 0x942077B6, 0x32062494,
+    0xF0A22A11, 0xAD983DC2, 0x278A59D5, 0x289DD4A0, 0xF8C9617C, 0xA6A7750E, 0x2383E418, 0xB72C8CD6,
+    0xE1CFB94F, 0x5FAB0A27, 0xA311D837, 0x1208D964, 0x573D1819, 0xF8EBB738, 0xC5C9FBB0, 0x089F2060,
+    0x449FF3DC, 0xFCF44F74, 0xB3197185, 0x327BE07C, 0x1108E68D, 0x9A183CBD, 0x77C75F8F, 0x98CD75DE,
+    0x2BD6306B, 0x0DC5BBF9, 0xEAD38ADD, 0x7AE08B95, 0x3C163D03, 0x07721CD7, 0x4587330C, 0x634C6B9B,
+    0xAD581F5B, 0x8C19ACDA, 0x314A954D, 0x252E2C5C, 0x7D541EF3, 0x7BD5672B, 0xD5E1EE52, 0x6E9108DB,
+    0x9951B9A8, 0xB8DB14E7, 0x9394ADD0, 0xA91D26A3, 0xEECCADAA, 0xCE57C100, 0x2F022E22, 0xB8D6080E,
+    0x83AA2228, 0x90FDED2E, 0x5993DEF6, 0x9C4073E4, 0x02FCEE73, 0xF94E5D97, 0x54965526, 0x6D1C73B1,
+    0xF3E2AC0B, 0x9B0331A9, 0x5C757FC0, 0x9237E822, 0x11DF6E3E, 0x7D79600F, 0x0F9F2898, 0xADE9D254,
+    0xE229331E, 0x2E8D6123, 0x552925DE, 0x9A8C9BB8, 0x4A673A92, 0x6C6A36B3, 0xC0F3889B, 0x3AD98F41,
+    0x38C2F239, 0x681CB09E, 0xBE7C776C, 0xCD95AF03, 0x93FE76A8, 0xBAA0EF00, 0x82AA87D8, 0x89F162D0,
+    0x2B646F0F, 0xA70533BC, 0xCF4250AE, 0xF4D29F4E, 0x56C92D60, 0xDE891217, 0xD54CE4E8, 0x951D6AE5,
+    0x654D0BCF, 0xBCFC6FBB, 0x96A65BF2, 0x25EA772C, 0x6AD5FD6E, 0x43144F88, 0x634DF588, 0x264EC4C1,
+    0x214F3D2E, 0x64238ABD, 0x13DA0D6A, 0xA2749F22, 0x346F8482, 0x8D0D06CE, 0xDF5B91CA, 0xA8D05387,
+    0x794C21D9, 0x2F399865, 0xF05301DB, 0x5F8C2313, 0x7203D593, 0xC48C98AC, 0xBD3198A3, 0xDEDF644E,
+    0x692656AD, 0x7432798F, 0xB01145FD, 0xEAA3F695, 0x953DDE63, 0xD29DFF37, 0x7ACA9BF8, 0x2DBACDB0,
+    0x29DA442D, 0xF18B3D1D, 0xCD07DE88, 0x11930DD6, 0xE1AC9E64, 0xC15F2FE0, 0xC5039BBF, 0x652FA5F5,
+    0xC8E622DE, 0xFE9EE7C9, 0xD379A219, 0x2064D286, 0x1CA574C8, 0x560E6B66, 0x1D5D668F, 0x4158C646,
+    0xE9D7C85B, 0x63F6C702, 0x3ACE5AF7, 0xC835CA4A, 0x8B136A8C, 0xEAF5323E, 0xB80925A9, 0xC905AB79,
+    0x386247F9, 0xAFAEE73C, 0xA7E8A6FF, 0x2B1F690D, 0xD6529851, 0xE9263579, 0x8364EB67, 0xA099342A,
+    0xB2AC9999, 0xC846D64D, 0x477931AA, 0x8D1C94B3, 0x9A13DA90, 0xC36AB100, 0x2B25B6C7, 0x4961E539,
+    0xDA6C8764, 0x448A1147, 0x62C21CA6, 0x6EE7D531, 0xC35B791D, 0xF614D5E9, 0x4329D1B2, 0xDD1156E0,
+    0xB9D4C6A6, 0x9917149C, 0xEC779EEB, 0xDDA7E229, 0x30772D35, 0xCCE62411, 0x7E1C502D, 0x2B592F0A,
+    0x61E2590B, 0x9D043032, 0xC42ACC5C, 0x40A18113, 0x14915B2B, 0xB727749B, 0xAF568207, 0x16D08721,
+    0x1664D60B, 0x3A709E61, 0xA44126EB, 0xB8935F95, 0x595A5A0D, 0x69F9A722, 0x9DCD9E5F, 0xDABCFB15,
+    0xEC376AA7, 0xB72E4A89, 0xA1C10095, 0x97FDE96D, 0x40E0B37D, 0x354BD672, 0xD7A6490F, 0x0CFBB846,
+    0xFE57BAAC, 0xCD70B9EE, 0x2167CB6E, 0x54FFC278, 0x273F0ACE, 0x7474996A, 0xFF64BFCC, 0x51E8304D,
+    0x420B1B5B, 0x90353AB1, 0x04CD11C4, 0x65C6D48D, 0x3739E866, 0x8875DA24, 0x1256FB05, 0x155FD644,
+    0x0975DCC9, 0x6A1EB276, 0x4697793E, 0x1289D39F, 0xB0824DFB, 0x3C1E725A, 0x7A42D92A, 0x02BAB6B0,
+    0x021CD47E, 0x484D1AC0, 0x16EC6324, 0x4844BEF5, 0x96DDB9EF, 0xEEE8A5EB, 0x32295F96, 0x37519FB2,
+    0x26AF37E5, 0x3883DEC4, 0xA122F0BD, 0x2A0255C0, 0x002CBF96, 0x9BAFEEE2, 0x5BE517F0, 0x1B97362A,
+    0x2F60E4C4, 0xCADA6A5D, 0x6165B685, 0xA513BA59, 0xE7ADB93B, 0xB8501132, 0x5909D4C7, 0xA38F60A9,
+    0xD523EBC9, 0xE4F63628, 0x1F14DA86, 0x6228D1DA, 0xDFCB7096, 0x55F167D7, 0x88161E6B, 0xD0DCE3CF,
+    0x1798C07A, 0x194ACC4F, 0xF1972CDA, 0x5A0DF1D5, 0x2826CBD5, 0x09FE50CD, 0x680ECB36, 0xFEE2F84F,
+    0x5EE2D112, 0x44CCD57E, 0x855A52FF, 0x2BF13DEF, 0x47C1FC38, 0x6CD1837C, 0x006195D8, 0x285FD788,
+    0x475876D5, 0x4D4402E7, 0x358BAE13, 0xA1246E03, 0x84EFB4C0, 0x28DC906F, 0x23A246B5, 0x7357B6B9,
+    0x1CE2C6BA, 0x01615EE3, 0x924297C0, 0x2AA01902, 0x39C5D390, 0xE4570194, 0xF3103F17, 0x27297524,
+    0xAF901A44, 0x30F176D8, 0xE67014CB, 0xC7E57B04, 0x0EA43C7D, 0x1CA0DEA3, 0x739D7D06, 0x4D890F55,
+    0xE013B26D, 0xAAC8BD5D, 0x6792505E, 0xD55CC681, 0x555E75C6, 0x70395323, 0x518835BD, 0xB0569900,
+    0xA1FADB7E, 0x62CEBA92, 0x6B46F2BB, 0x9A3AA39F, 0x8231EF9C, 0x1D43C739, 0xABE09879, 0xCAC6E1E1,
+    0xCA7AF041, 0x999006B4, 0x8317B1EF, 0xB3D4EF7D, 0x303B13B6, 0x82908FC5, 0x0C4384EF, 0x7162A125,
+    0x89C7B74B, 0xC5A987AD, 0x4866FF6F, 0x02DC52CB, 0xCEE52B75, 0x308A501E, 0xBA14F11F, 0x7AE86C9E,
+    0x9987908C, 0xE65C85B6, 0x7DE8908D, 0x66692D27, 0xAB59833C, 0xB725764E, 0xD2779CD2, 0x3396159C,
+    0x9DD0391E, 0xD27ED923, 0x69C46A41, 0x175BA83A, 0x49B8BBB5, 0xA326CC22, 0x06679D91, 0x861D50C3,
+    0x21CFBAEB, 0x9A6E75E0, 0xED270C4F, 0x427109BE, 0x4B2E0852, 0x33E3853C, 0xA6820BAA, 0xC9A406DE,
+    0x7E1A2864, 0xFE9D6F5D, 0x8B8AA11F, 0xBE46E612, 0xE142D4AF, 0x0F87F86D, 0x5AA28C15, 0xAC98BCCB,
+    0x5B01F448, 0x69C19971, 0x184E5900, 0xE21E9563, 0x11B0F0DE, 0xCA69AD44, 0x1AFBF720, 0x72143A5D,
+    0x4970D598, 0x905547CE, 0x2B4F6F23, 0xF5FFFDA0, 0x6DCFE040, 0xC267FE6C, 0x0A2BA153, 0x4600CA64,
+    0xC1B3FC4A, 0x13C0E27A, 0x4D8DB588, 0xD77A2E4F, 0x52D06E23, 0xA231A485, 0x5C131BEE, 0x38EE8639,
+    0xDBD70422, 0x0F1D719E, 0xE43FE0EB, 0x43F30B03, 0xB365383E, 0xBD057070, 0x99BB3624, 0xFAE671FD,
+    0xF9D49F82, 0x84D4B5A9, 0x36AB1600, 0x147C0945, 0x6F79ABB2, 0xE220BD65, 0x8EC430CA, 0x4B90277B,
+    0x99AAD950, 0x520C28B7, 0xC582CF0D, 0xCF5E72A5, 0x87E53823, 0x9963860C, 0xC845419C, 0x360BB540,
+    0xC7836ED7, 0xF328528D, 0xEB009BA9, 0x1CF81B78, 0xCCCEBCCC, 0xDF10160F, 0x02062DCA, 0x587C9208,
+    0x4FA5B927, 0xCD6BAC4F, 0xEEA5BF99, 0x0F9CD28E, 0x318C627D, 0x4A19505D, 0x476C0F03, 0xDC15D511,
+    0xC9A80DB4, 0x1D8B8594, 0x08AA8AD3, 0xDE427ADA, 0xD43DDCD8, 0x06253EC7, 0x1079FD05, 0x9806E97E,
+    0xA47B84E4, 0x47E27F48, 0x7440936A, 0xF9396BAC, 0x527BDFF2, 0xF770DFAD, 0xFAB8F243, 0x7A35E0CC,
+    0x8BEEA7D5, 0x45CC4EA2, 0xF2CEF59F, 0x0625AC9E, 0xDD597013, 0x8E3C1335, 0xC26494A2, 0xF504D5C0,
+    0xFDADA719, 0xFC6C96D2, 0xC26A4E27, 0x5DEAD1EC, 0x08AC0BFA, 0x930A6FBA, 0xE6A56A4A, 0x961A83C0,
+    0x00FAEDF3, 0x6AFF121E, 0xFCEE074A, 0xE672E47E, 0x187DB0F2, 0x2D184551, 0x0612D9A4, 0x362CB86E,
+    0xD52B1543, 0x27328A7D, 0x4AB9F3B6, 0x4F49EDA9, 0xC5B9DF36, 0x7E272ED2, 0x52C9A9CB, 0xFFFFFA78,
+    0xFFFFFA39, 0x00001789, 0xFFFFE591, 0x000018C5, 0x00000F3F, 0x00000863, 0x00000C55, 0xFFFFEA3F,
+    0xFFFFE5F5, 0x000000AF, 0x00002676, 0xFFFFFA15, 0x000011A4, 0xFFFFF204, 0xFFFFEDE0, 0xFFFFE653,
+    0xFFFFDA4F, 0xFFFFF5D1, 0xFFFFF317, 0xFFFFFD9E, 0xFFFFE9B3, 0xFFFFE579, 0x0000191E, 0xFFFFFF2A,
+    0xFFFFF0E7, 0x0000032F, 0xFFFFEE17, 0x000002E5, 0xFFFFF44B, 0xFFFFFD99, 0xFFFFF0BA, 0xFFFFF438,
+    0x000008C1, 0xFFFFF04D, 0xFFFFFE7F, 0x0000192A, 0x00002037, 0xFFFFECA0, 0x00001842, 0xFFFFE4B2,
+    0xFFFFF5AB, 0x0000172B, 0xFFFFE948, 0x00001490, 0xFFFFFCDC, 0xFFFFEFD9, 0x00001AE3, 0xFFFFEF6B,
+    0x00001922, 0x00000132, 0xFFFFF812, 0xFFFFEFEC, 0xFFFFF392, 0xFFFFFFB2, 0x00000AE4, 0x000009BE,
+    0xFFFFF6BC, 0xFFFFF382, 0xFFFFFDE3, 0xFFFFF9A3, 0x000016D5, 0x0000071B, 0xFFFFF728, 0x58A137B3,
+    0x4BB44059, 0x48E12A0E, 0x5D36FD40, 0x592FE72A, 0x423ABA78, 0x7BD34E6C, 0x404CCAE4, 0x472C3E9F,
+    0x77667EC1, 0x533512F4, 0x7E8D554A, 0x5D41C205, 0x4A82EE64, 0x50D55B42, 0x6102E997, 0x519531CD,
+    0x4241320E, 0x4FD39510, 0x7BF07646, 0x57ABF587, 0x58365968, 0x561B8BE4, 0x5160A2EB, 0x4FB6E53D,
+    0x4F121C07, 0x5979E756, 0x5C9FEE0F, 0x4FFB8CAA, 0x4BE8C4EC, 0x46E1A36A, 0x5B5CF88F, 0x5F28713C,
+    0x7A399AE9, 0x77045808, 0x50FC0ECE, 0x569C4B34, 0x4CFF6DDE, 0x41C49E0F, 0x5D8B70BB, 0x44A39EA8,
+    0x45FC7CF9, 0x42AB4AB1, 0x5BC2A2A7, 0x4C12FCEE, 0x4E8CAEBE, 0x4B6D23A4, 0x56F33680, 0x5ED2F78A,
+    0x584EA005, 0x78EC1BA4, 0x519F0656, 0x5E56B548, 0x4173A555, 0x62B50020, 0x40CD0F4A, 0x76BB6183,
+    0x555BD9C6, 0x463E62D9, 0x5875361F, 0x4BBA28DB, 0x4D4D3DE1, 0x5A6DBA91, 0x40E643FA, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF7, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xA314BBBD,
+    0xA4085A33, 0x8F89C136, 0x1BAC5C4F, 0x2EFD9878, 0x89B06DA3, 0x42313B8B, 0xE701E901, 0x2B8C414D,
+    0x88D65AC1, 0xF222B284, 0x7B2EFCAE, 0x99DC6470, 0xE0B687E3, 0x2593FFA9, 0x5734D3BF, 0x13497032,
+    0x656660D5, 0x26BAB8BA, 0x7D102DB7, 0xE2B2FBC8, 0x211DE696, 0xA173365C, 0x550FC96A, 0x4A442A48,
+    0xA84619A2, 0xBEAD7837, 0xCF2364C1, 0xBF3E4428, 0x5F63A397, 0x9ECC2056, 0x478F08C3, 0xEB281068,
+    0xCB3E103D, 0xE2DDA4E0, 0x36EE7EC0, 0x5DBF105D, 0xE07D0F3E, 0x8BF07463, 0xB622A62E, 0x9698C1EE,
+    0xDA0908FC, 0xB95C7905, 0x0A24D669, 0x78C1B0FE, 0x575A3BC1, 0xFFDAF371, 0x6A5C50F4, 0x6EF6AB5B,
+    0xC463707C, 0x35344BF6, 0x5913CE22, 0x7A7FE75C, 0xD2B6A1C0, 0xAFC3A783, 0x31EBC64D, 0x648EF4C7,
+    0x42A01260, 0x9ECB3227, 0xEC1F86C0, 0x62AA06F8, 0xA1BAE389, 0xF4200C1E, 0x232ABC0E, 0x28DC703D,
+    0xAAC7530D, 0xBD0D874C, 0x311C3DDC, 0xB610F09B, 0x1118B716, 0x578C5AFB, 0xC897654E, 0xC85E61A6,
+    0x93E37088, 0x53AD2C05, 0x57AB4052, 0x1D398687, 0xC125C24B, 0x587816BA, 0x35E18226, 0xD37C07BF,
+    0x1A23E9C5, 0x38B25C5B, 0x9EA71867, 0x1EA916E7, 0xDC89E8CE, 0xDC6646C3, 0xB79B42E6, 0xE390CE7E,
+    0x5A1115EB, 0x369EFCE1, 0x537EAF44, 0xA95AE458, 0x11C964C8, 0x0610F962, 0x1FDC09EA, 0xFC30A00C,
+    0x673C600E, 0xD3D1AAA9, 0xD6084530, 0x8A646B94, 0x7C36C12F, 0xD69B67A5, 0xA70569DD, 0x6B9B5B2D,
+    0x16C80F3C, 0x55C93D18, 0x67CFC064, 0x0BEB07FC, 0x2FD17AD7, 0xCFE0DF50, 0x0B90483C, 0xDD708734,
+    0x5ADAE7A1, 0x408B2497, 0x3755D499, 0x4CDDFA1E, 0x8E83FE38, 0x70EFBD7D, 0xB47BCF36, 0xF3C7A905,
+    0x8463A65A, 0xE35F27EE, 0xC632FF8D, 0x5894898E, 0x7E0E2FA2, 0xF5B15EA6, 0x54D558EC, 0x11677574,
+    0x8662B796, 0x6CB78A83, 0x227F53A9, 0xBC145F7E, 0xFEC7D165, 0xF2143448, 0xA89588D0, 0xBFA0C689,
+    0xE93A2B4B, 0x8F843704, 0x8868F978, 0xABE4EF3D, 0xAD1D231B, 0x9BFB0073, 0x9FAD29B2, 0x00000BB3,
+    0x00000013, 0x000007B1, 0xFFFFF9C1, 0xFFFFFC44, 0xFFFFFC5C, 0x0000049D, 0xFFFFF67F, 0xFFFFF89D,
+    0x00000B30, 0x0000074C, 0xFFFFF6DF, 0x000005AC, 0xFFFFF8EB, 0xFFFFFA66, 0x000002D8, 0xFFFFFBCD,
+    0x00000571, 0x00000461, 0x00000595, 0xFFFFFEE1, 0x0000000A, 0xFFFFF6D5, 0xFFFFF540, 0x00000410,
+    0xFFFFFCC7, 0xFFFFF762, 0xFFFFFD69, 0xFFFFF9C8, 0xFFFFFA43, 0x0000028B, 0xFFFFF1CD, 0x000008EE,
+    0x000000F3, 0x000008F7, 0x000005D2, 0xFFFFFB0D, 0x000009CC, 0xFFFFF87E, 0x000002CA, 0xFFFFF1D8,
+    0xFFFFF897, 0x0000089A, 0xFFFFFADE, 0x0000087A, 0xFFFFF683, 0x000000C7, 0x00000353, 0xFFFFF2A1,
+    0xFFFFFD88, 0xFFFFFD14, 0xFFFFF857, 0x0000023D, 0xFFFFF954, 0xFFFFF6A9, 0x00000C0E, 0x00000840,
+    0xFFFFFB99, 0xFFFFF4DC, 0xFFFFF4ED, 0xFFFFFB45, 0x00000B22, 0x000002E0, 0xFFFFFAB5, 0x6820C0B6,
+    0x630FDF41, 0x553492C7, 0x77CF1369, 0x5F42AEA5, 0x7A4D2D5A, 0x774DBE66, 0x5B057F0C, 0x7AE023EB,
+    0x55DDF174, 0x50D459CD, 0x5E546B27, 0x416A072C, 0x5717E584, 0x777A7AE3, 0x7F857905, 0x56BC8A38,
+    0x5B87B7B3, 0x7A4548F4, 0x63635A17, 0x7E429DA5, 0x70714430, 0x73979730, 0x5A0E51A5, 0x57DC1B6F,
+    0x63B2BA02, 0x7F29E7EB, 0x79062340, 0x7F63D574, 0x720828E5, 0x61BEB1D2, 0x5034B58E, 0x41917F2E,
+    0x61B2A5B8, 0x7506A69C, 0x6EB20D31, 0x5AA2A3D0, 0x684F30D8, 0x5DF10064, 0x57719E90, 0x57CE1CC0,
+    0x755613AC, 0x5FE02B95, 0x693D89CC, 0x69006BD0, 0x5301EBCF, 0x608CDF7F, 0x72F9414C, 0x5375EDA7,
+    0x73AB9AD8, 0x7214DED1, 0x6AA38EE0, 0x6C0F5556, 0x741AF6A8, 0x50C6F5A6, 0x52CDBAE8, 0x59361632,
+    0x5F5E4324, 0x670D1B56, 0x5D45906D, 0x78939571, 0x523DB94A, 0x69C54430, 0x6D860BB3, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0x9D887C53,
+    0xBA5483F0, 0xDB4ABB87, 0x731686FD, 0xEDECEE6C, 0x517B2E29, 0x49C0459E, 0xFFCDFBF5, 0x699CEC37,
+    0xDFA3C8FC, 0xED65DCEB, 0x22B2DBDB, 0x87CCA644, 0x99291214, 0x34B02E97, 0x0066C08D, 0x264C5732,
+    0xD5E1AF11, 0xBE7DF3C9, 0x61068423, 0x7BA796A8, 0x833303CF, 0x9DFA1900, 0xC38F157F, 0xBA0D1CC4,
+    0xC796F299, 0xE20731FA, 0x0F90B565, 0xCC65A807, 0x790EABFD, 0x79FC52C2, 0x0104FBF1, 0xCF5D28BB,
+    0x32C1B6CB, 0xA4286A7D, 0x5B0E3A4F, 0xE104B294, 0x9F2C183C, 0x671BB184, 0x01156FDD, 0x4CD62030,
+    0x3C225CA3, 0x12AAF50E, 0xB0ABA57B, 0xAB664361, 0x8373CB6B, 0x3F539A05, 0xDE162E68, 0xB81159CF,
+    0xDA251FC1, 0xB64E84A1, 0xAAEB61CA, 0x935CDA63, 0x491A0673, 0xE3519865, 0xE9796405, 0x3F0FA34F,
+    0x823C5487, 0x615FF289, 0x8E857F3B, 0x4567BB3E, 0x79EDB2EE, 0x1F7F908A, 0x9010D498, 0x69E25E48,
+    0x6BCAF3A5, 0x56E6DD84, 0x4F4134D8, 0x927C6C41, 0xE1206EC3, 0x72BC1EEE, 0x89B6AE20, 0xF4E7BC7F,
+    0x4C273EC8, 0x93071336, 0xC4B8CA58, 0x55470B15, 0xC291D8B3, 0xEB66BB9F, 0x435FA0CF, 0x4021DF42,
+    0xB0B3F2A7, 0xC7FB75A2, 0x2E2BAA64, 0x36A72BEB, 0xD1138B10, 0x3EBF0CBB, 0xD2DCAF4E, 0x3EEA56A3,
+    0x0D88F29C, 0x06452D0F, 0xD4F8EA9A, 0x240A0E15, 0x538C2690, 0xD75EFFA2, 0x88D9B4CE, 0x5EAED8AC,
+    0x45E27DB9, 0xAFDD2B2A, 0x0852D1AF, 0x273DFBDF, 0x0B32B849, 0xB520E62E, 0x256C4EC1, 0xF6ED4F26,
+    0x52F03EE9, 0x3A9F4E44, 0x29CA7DDD, 0x9052F3C3, 0xC3FE59B5, 0x4084F6FB, 0xB4B1311B, 0xEEFFA6A5,
+    0xA0FB44BF, 0x86B7545D, 0xA837AC26, 0xFB9CB787, 0xF50B213D, 0x235AF25F, 0x59ECBF99, 0x300FDB4F,
+    0xEA7B058E, 0x63EF498E, 0x8D37D560, 0xD178E0A2, 0x4DE1EDB5, 0x7B96CFB4, 0x52654D08, 0xF9BBE8F0,
+    0x0B167122, 0xD4E88AAE, 0x898E0F75, 0xA911A44C, 0xFEFCFB65, 0xEE144CE8, 0x3CEC001C, 0xCD1E1AED,
+    0x01D95E2C, 0x987EFBD6, 0x8DEF99BD, 0x828BE493, 0x156896F8, 0x88C691F3, 0x41185A36, 0x0BB37D22,
+    0xEFBF8C47, 0xC2BD281B, 0x0FC779BA, 0x6F349D3A, 0xAF729A39, 0x1914EF50, 0xB088CC60, 0x19DB931D,
+    0x97B6AD21, 0x06CDCDD4, 0xE7186374, 0xD5446952, 0xC272CEB5, 0x10E21B77, 0xB6699579, 0x3228E518,
+    0xFC01EE0F, 0x0907AD15, 0x48D1A6BA, 0x73F31DF9, 0xB015CB72, 0x2E00ADBB, 0x2FA99A69, 0x70A28409,
+    0xD323674A, 0x4AC189EE, 0x18892CC7, 0xA543B6BA, 0x53432137, 0x68D4F390, 0xDA2F9994, 0x41AA8475,
+    0x6F78900B, 0x66379785, 0x18219F82, 0xE89E8C13, 0x8ABD0107, 0x79C01BF4, 0x8CC074D5, 0x82070258,
+    0xBA4B4B06, 0x84C5BE65, 0xF55B00C2, 0xF175EB49, 0xFC8DAA2C, 0x22529783, 0xF81481D4, 0x114048EE,
+    0x67657E8E, 0xD8FE7116, 0x36D98BB0, 0x5A919A59, 0x657BA1B8, 0xF9DA8AA9, 0x71E33C6D, 0x5B22246E,
+    0x3FB37594, 0x0AE68BB4, 0x7D18C564, 0x60BB1781, 0x42671DEB, 0x66190127, 0xCEDEF1E1, 0xE3B1440C,
+    0xB745F879, 0xE5459BF9, 0x0E6FA613, 0xFE241C6F, 0xD7B3EC3A, 0x22C055C4, 0x8D028CA4, 0x27966CBE,
+    0x8E56E55A, 0x37C41111, 0x975CA792, 0x86571962, 0x375DAE84, 0x58EF48A9, 0xB1E0BC30, 0x0B0A76D4,
+    0xD111E4C6, 0x2569A44A, 0x9D6CCDB5, 0x2EE79155, 0xBB91A61F, 0xFE752D58, 0xAB3DFD71, 0xBD03E56A,
+    0xF1C5B153, 0x9E8103AC, 0xC3E0E59C, 0xEAA918C8, 0x76ED9805, 0x6DF462D4, 0x1FB3E7F8, 0x460BA273,
+    0x7E55C7C3, 0xD1C8F113, 0x903508AD, 0xE7A1F00E, 0x2D86C256, 0x25E695A3, 0x0B90737C, 0xCAF3D056,
+    0xBD3FEF1C, 0xC4B3103C, 0xB0E8D462, 0x77068D99, 0xE7E2A4BC, 0x3B63C3B2, 0x325A7192, 0xA07F70D6,
+    0x0E2610D6, 0x0A950D25, 0x08235223, 0xED59EC88, 0xE63B1A57, 0xD35C6D55, 0xF42BF878, 0xCF49A4C3,
+    0x3412355F, 0x1945CB57, 0x2C04DFA3, 0x063F9C47, 0x9C2184F6, 0xB4909F11, 0x55F55A72, 0xDF1FD6E8,
+    0xCFC4614A, 0x09B1B4F7, 0xABE8B7E9, 0xF3551565, 0x9120AACA, 0x5AE8EC6B, 0x8D52CF3E, 0x418DBF09,
+    0xA244554B, 0xF6D6A825, 0xC6B9DB01, 0xCC687F25, 0xE7B31912, 0x5F73283D, 0x70587238, 0x91953545,
+    0xF656F4B9, 0xE616EFF9, 0x06011077, 0x6A05C2EC, 0xE3A69755, 0xBD2B4995, 0x622F0E8B, 0xDE4C3097,
+    0xE44CA0C2, 0x4C3CA725, 0xD3665198, 0x01A77EB6, 0xCD020A52, 0x11DE7034, 0xD2739E06, 0x967A764A,
+    0x8418B189, 0xB9E409D5, 0x5C61A7F2, 0x028835C4, 0xCBE8DB06, 0xAD0CE1A8, 0x04071BFC, 0x861F3A08,
+    0xCA4807F7, 0x822AF804, 0x6CEE3B29, 0x4F45D399, 0xE27F52F4, 0xB967635B, 0x6307F1B9, 0xA1A1FF49,
+    0x1EAB1620, 0xC257FA51, 0x3B6577C3, 0x200DDD11, 0x1B901A69, 0x0101A3C1, 0xB4666772, 0x6C384EC8,
+    0xF1580CF3, 0xD2C764C9, 0xD06FC1F0, 0x1B7E400F, 0xBCFB2050, 0xA058441D, 0xA4B0FD7E, 0xF444560E,
+    0x052CB9A9, 0x5C9D99A7, 0xE14CD2E0, 0xAD68844A, 0xFBCAC1EB, 0x8C63879E, 0xC8E0ABF1, 0xE0C1467A,
+    0x9633A7CF, 0xD695256E, 0x1BE4162E, 0xFD4FE110, 0xA00FC574, 0x6499E5C7, 0xD1C5E6CD, 0x85575969,
+    0x4AF73292, 0x680526CE, 0x4D153F89, 0x0A5DDDC3, 0xD67E24BC, 0xAE112514, 0xF4A463BF, 0x85D330F6,
+    0xDFFC7642, 0x43DC32ED, 0x72DF07AC, 0x93AE8886, 0x23A0CD13, 0xACFBDCBD, 0x9CDFF62C, 0xEF8EA7F6,
+    0x12EF4FB5, 0x9C9F265E, 0xAFA0157B, 0x120046BE, 0x86BFFAB8, 0xE15B7076, 0x5E51DE37, 0xF4D7DC15,
+    0x724990EA, 0xB8307C9D, 0xACF47820, 0xA1F0D9E2, 0xCCA4BC46, 0x7AEA3A65, 0xD46D62F4, 0x6FCBE035,
+    0xCC3AC842, 0xE446E4E2, 0x57546CF5, 0xE3301212, 0x3E66294C, 0xF4D865C7, 0x58F80C3D, 0xBF15F949,
+    0x4642FD69, 0xD670988C, 0x3C5726D1, 0x4CA09577, 0xAF699BDA, 0x6975E107, 0xB82DE2DF, 0x70617CF2,
+    0xC3BCBD56, 0x5962934C, 0xA637C33F, 0xB39F4BE3, 0x60CD3C47, 0x3F1F497A, 0x7365EBC2, 0xA6BC0455,
+    0xC228A77A, 0x6803DFDF, 0x5D02BA15, 0x691EFAB2, 0x2E0B51E1, 0xDC7658F0, 0x6C12141B, 0xF3B9E1C3,
+    0x93E8A475, 0xECC4EAFE, 0xFFC1FEBC, 0x2C5B77E2, 0x3E06BD0D, 0xFDC24EEF, 0xE1AEA67C, 0xE9A06E41,
+    0xD6B1F11B, 0xCCC8D8DB, 0xE793ABA7, 0xBC020516, 0x3DA6B187, 0xF7D7AEA0, 0xDD20F8D3, 0xAE89A6DC,
+    0xBEEAEAD7, 0x3076B87D, 0x948B9C42, 0xFFD11B5D, 0xDFA6F4F4, 0xD99C2C67, 0xC5674F31, 0x91082BAB,
+    0x13EFF2D2, 0x12951988, 0xFC110144, 0x98BD77F9, 0x7878EE3A, 0xFF9AAA02, 0x3DB8A822, 0xD05E2E3B,
+    0x93376D2A, 0x5BA374AA, 0xB06FF04B, 0x27797359, 0xD1989A83, 0x0C91DE09, 0x946EE0F1, 0xAEFD388E,
+    0x8E50FF2E, 0xBAD7A69D, 0x466408A3, 0x5C68FE53, 0xD9FD4989, 0xB7B902E4, 0x86BED91C, 0x34C5755E,
+    0x984C874B, 0xD975C7EA, 0x1BA3D845, 0x0E3437DC, 0x53BDBF63, 0xC80DA40B, 0x2C3F5C73, 0x8B2108BB,
+    0x88F7DF2A, 0xA4FC63DA, 0xFF8F5FF8, 0xAD4B5682, 0x8B73DA8D, 0x2BFB89DF, 0x41F4992B, 0x7489CBBB,
+    0x5EA7841C, 0xB1AC1611, 0x03F4CEEE, 0x3FE01961, 0x7EC53F6C, 0xF556C332, 0x1E084778, 0x93872B55,
+    0x223689EF, 0x2CD9131A, 0xC8B15384, 0x43863D2B, 0xAF1A7BFD, 0x6E0BEC35, 0x5905B6A9, 0xBED66364,
+    0x2BE8D0B1, 0x2E46B7A9, 0xE3D443F1, 0xB1D048ED, 0xD0D58B2A, 0x2561EAF5, 0x40146A11, 0x31FD0E91,
+    0x92C1D144, 0x790D8BFE, 0xF85F2553, 0x8274AFD4, 0x7584E618, 0xE5106534, 0x86CA12BC, 0x0D8F3CD6,
+    0x1F48DCDB, 0x890FDDC2, 0x4D755281, 0x791650C8, 0x3B385A09, 0xFCB8911E, 0x4A68E796, 0x597AA317,
+    0xB9286F3C, 0xB291F44E, 0x2EEC98F5, 0x29D9D89D, 0xE6911638, 0x3951FEF8, 0x9B158BB8, 0xF4B4740F,
+    0xE15A0AA1, 0x41A854A2, 0xCBACE72F, 0x17904BE3, 0x0DE681E5, 0x55B31357, 0xAA660BC7, 0x976003D7,
+    0xE5740C54, 0x9B410792, 0x0706FCD7, 0xFA065077, 0x327A36A2, 0x1BD65B53, 0xB52387AA, 0x9C69C5A0,
+    0x48C35A66, 0xC263A235, 0x0CA76B61, 0x273F92C9, 0xE5248F45, 0x1226F630, 0x144AB4A4, 0xCFEADC16,
+    0x11727F00, 0x9A102A10, 0x59E9A4C8, 0xB7FA843B, 0x38B5AFD2, 0xE88A0B01, 0x126EA114, 0xAC9D384E,
+    0xE2CD6629, 0xCDBC0526, 0x52E6C754, 0x48A2D9BB, 0x7C4B13A8, 0xD7A7409C, 0x5EEE2B8B, 0x9CE09EB7,
+    0xE5A9EA42, 0xF2572CBD, 0x33ADDE26, 0x99BBAE72, 0xB4E87A59, 0x648F69D6, 0xDE7F3688, 0x24A28B02,
+    0x0677107B, 0xF474E7D9, 0xA124CA13, 0x95B3DA3A, 0x45690A36, 0x603AB4E6, 0x0CBA5E1E, 0x4EEB17DF,
+    0x89BE2198, 0xC01EF7A3, 0x5177D9D2, 0xEC3DDB52, 0x7CBD79BA, 0x746FB02E, 0xC1AB5103, 0xA1932179,
+    0x511B95B9, 0x5F6D2828, 0x2D4B5DEE, 0xBBFE7212, 0x02369A6C, 0x6E3C4D47, 0x27F9A36B, 0x6EFFA9EF,
+    0x8576506B, 0xCBB6E0F3, 0x1910C0EE, 0xF93F58BC, 0xD69367EA, 0x2901D91F, 0xE77E4BEF, 0xED16EA5D,
+    0x72371B40, 0xC125C1AA, 0x5B2129F8, 0x854DA223, 0x9B3F966C, 0xEEB2E538, 0x7A8E1DD6, 0x5E25C943,
+    0x8973DA6A, 0x258D6EFF, 0xFC98F21D, 0xE80D0D0E, 0x4F9E2F00, 0x279E13A8, 0xD29C6A1C, 0x77E869FB,
+    0xDEFB77B9, 0x66CE276E, 0x317B8C37, 0xE88F5FF3, 0x88A9F17D, 0x16C9FA43, 0x8EB7E04C, 0x550AFBDC,
+    0xD894A5F0, 0x06D1A8D4, 0x65E48252, 0x69B9D96D, 0x434E14A5, 0x525FA0E9, 0x5C40C782, 0x95BEDAD3,
+    0xA612941E, 0x0DAAE50F, 0x213DDD1D, 0x28A6C2E0, 0x87F77BE5, 0xDA1D8F47, 0x5886F8D5, 0xA46AC2E5,
+    0xF03AC628, 0xA4BDC2EC, 0xACCB9409, 0x189BFB9F, 0x5453F0E3, 0x2B28EB8E, 0x298A58F1, 0x95497815,
+    0xCABB1F15, 0x647C0C9E, 0xA64A88F4, 0xD7BBD22C, 0xC7C84CB3, 0x82C2006E, 0x4413492A, 0x97631108,
+    0x1203055F, 0x05A38EDB, 0x68F31645, 0xE79231FB, 0x3510F28D, 0xD4C51105, 0x48DA5CAB, 0xA8CA2D24,
+    0xB55F6B5D, 0x2F1F7DCD, 0x2793CDF3, 0x970F941E, 0x32F37B6F, 0x53567456, 0xD83F72CE, 0x28F9E08A,
+    0x03AE888E, 0x30B7B3C7, 0x4D3D7648, 0x6BD7DF74, 0x5813D9DA, 0x39FD1A12, 0x12D5849A, 0x8386FD87,
+    0xA03C876A, 0x8B4568AB, 0xC6CC95BF, 0x75483AAD, 0x54E6FA47, 0x0C969517, 0x8F64DC5A, 0x3F4A2867,
+    0xFEB1514D, 0xFB7BDC61, 0xE4EFBAED, 0xE975C974, 0xDFE967DE, 0xE4D3F21A, 0x174388CF, 0x2807FEE8,
+    0xA70E7DA3, 0x34F4B7FB, 0xC187E00B, 0xA3CBCB35, 0x48C7533E, 0x59F62DAE, 0x60C5EF14, 0xDB769AD6,
+    0xE8D0AABF, 0x96E0D044, 0x4B906C3A, 0x0A96B758, 0xD1BCEA85, 0x9A773534, 0xA0F2EBFF, 0x3A43C352,
+    0x94E9252E, 0xC94FFEDA, 0x4ABF07BD, 0xEBE3460C, 0xA6FE9C1E, 0x9DBD3EA3, 0x83FB18BF, 0xA32A317A,
+    0xFA84DD2F, 0xBC6224CE, 0x72EE2BC2, 0x35BD5CFB, 0x61FD8676, 0x4C457D04, 0x0D9BC981, 0xCEA4A862,
+    0xA6D66F8A, 0x174356DE, 0x8815DD69, 0x886C4BC1, 0xC8EDAD01, 0x91505EFA, 0x17E8DBDD, 0xAAE3AE7E,
+    0x413535E0, 0xDBC7A231, 0xAB5B3A92, 0xE4E32190, 0x7E018F11, 0x509937D4, 0xCCD1B172, 0x68A497A4,
+    0x2ACE4D30, 0x31C19106, 0x59C370A6, 0x09A7DC84, 0x2F8BE8C2, 0x6AB595C8, 0x05B1E5DF, 0x6745A737,
+    0xE6B6373C, 0xB4FDD3CA, 0xA3A124FB, 0x32A7EFA5, 0xD2E9D0CF, 0xA892CAC4, 0x6FCC9291, 0xE460DB37,
+    0xF01E7A93, 0x457D265E, 0x17A30061, 0x8AD58493, 0x334C39BF, 0x0F5170A4, 0xE67139F4, 0xAC1A59E2,
+    0x8D5257DA, 0xE1E396E2, 0x180DF4C8, 0xFE3C8A5D, 0x5F297D9B, 0x8DA7E0F3, 0x21141482, 0x2AA47597,
+    0xF63E232F, 0xBF40BF73, 0xDD135D67, 0xC6487D69, 0x9944A686, 0xB9960829, 0x25BA4179, 0x1F469D0A,
+    0x5830A9EC, 0x7BDF36D7, 0x90E050E2, 0x9D787330, 0xED46062A, 0xF8FA2147, 0x5C979976, 0x07B728E1,
+    0x67F58E4B, 0x39C51F17, 0xF0D2BD08, 0x17535FC2, 0x103975EE, 0x1BBC233E, 0xA026B8B3, 0x95A25DAA,
+    0x5B381334, 0x05A91136, 0xDA70D674, 0x0A55F029, 0xDBE40289, 0xE9AC0D39, 0x03AB5416, 0xCAE2641D,
+    0x24BF4C19, 0x3CBFD89D, 0x563CF3E4, 0xC7F94277, 0x4E4DFECE, 0xF673FD2D, 0xDCDD5C98, 0x5C849E50,
+    0xD521E144, 0xA9E58E57, 0x51BE53F6, 0xB6E2A926, 0xEEE906F6, 0x2B4D7FF2, 0xAE63F386, 0x6AC0961F,
+    0x226F7E2B, 0x6E69532B, 0x43225BC2, 0x4ADF496A, 0xB1C94FCA, 0x3CD4DB9C, 0xFF08DC59, 0x0C6D2D07,
+    0x666B5CF9, 0x9E4D898A, 0x006A03B2, 0xAFF77A6E, 0x3C7CC1F7, 0x6463AF50, 0xF99BE73B, 0x9AB68562,
+    0x75D12E93, 0x04ABAFAF, 0x4B4FBEE1, 0xBEA8FECC, 0x0DDE39D6, 0xE8C283B3, 0x7247D988, 0x02AEF110,
+    0x768E2944, 0x1262C336, 0x55F7C853, 0x45891D94, 0xB3B9B145, 0x510708DE, 0x57FEBC9A, 0x20B2A4D8,
+    0x3D4B1840, 0x1AB9F7A7, 0xDC919253, 0x4D71ACF0, 0x2FEDE256, 0x9B308860, 0xC8E4E70E, 0x48707301,
+    0x0E179E92, 0xA0AAB29C, 0x848C87DD, 0x4FA450E2, 0x8339D915, 0xD5A14030, 0x86FBE1EB, 0x92FCACDF,
+    0x5A3D8940, 0xB0D799FB, 0x298B3807, 0xE90482E6, 0x1AD2F586, 0x0B8254DA, 0x437B2316, 0xF09DA3C4,
+    0xB47D0AF6, 0xB451B7D4, 0xBA73DC00, 0x756C6874, 0x0A4C64F6, 0xDE6BA242, 0xC45BBB6E, 0xC9404B22,
+    0x0E0A85A9, 0x8C20124D, 0x387AE4F5, 0xDC764AE0, 0x1F39F670, 0xB800A8FC, 0xE5DC9B0B, 0x4B55AE19,
+    0x21B6A646, 0xA25E45DB, 0x9BCC62D1, 0x23B4E110, 0x3C75C25A, 0xB5916B10, 0x09F607C7, 0x4E2E2752,
+    0x61190A19, 0x939F4F29, 0xB570E216, 0xC64662A8, 0x05A157A7, 0xD0568E0D, 0x5A8A920D, 0x6BC419D1,
+    0xC557FB97, 0x11FD3816, 0x0074A014, 0x76D82887, 0x3E9FAD91, 0x002CD550, 0xD152A9A1, 0x66A0B56E,
+    0x27096CD1, 0x95C239D9, 0xF600D243, 0x5C59CABF, 0x69FDBA51, 0xB935A363, 0x96B4CA69, 0x98870990,
+    0x2E74942D, 0x93DB0709, 0xEA9B8544, 0xF8705663, 0xCBD78978, 0x9401870B, 0xDC28CCF5, 0x1B3DDCA4,
+    0x72F187E4, 0x559FDAF3, 0x38947461, 0x756D535A, 0x550FF2B9, 0x0B77B07F, 0xE782E054, 0xF4F40A26,
+    0x54187C6A, 0xA786DD39, 0xAA39E919, 0x1A97BF88, 0x1C3CC8C4, 0xD68C3EBB, 0x0452BFBC, 0x8867464B,
+    0xA86216EA, 0x751C4BFA, 0x330397F3, 0x71481384, 0xB804417B, 0x00D50628, 0xAEE234A0, 0xC38B4B42,
+    0x6B282787, 0x69DDCFDC, 0x4B8C4BA2, 0x11B75D68, 0xCF5A91A2, 0x61034451, 0xA33F543A, 0xB3BB13AF,
+    0xCD48F8A9, 0x8F209FD4, 0xF39EC393, 0xC25F8EA1, 0xF9C032C3, 0xF4E1219C, 0xAA45AF58, 0x43BD7CF6,
+    0xD590FB14, 0xEC15F545, 0xD28ECC23, 0x8B4D53C0, 0xBD3E2960, 0x76BF3A1D, 0x1F91579B, 0x5ABD630A,
+    0xC4666B83, 0x15335C23, 0x2C0ECA3E, 0x9B5B285A, 0x8CCAFDDF, 0x7552A5C7, 0xFCBA48F1, 0xEF02D0D9,
+    0xD29C4566, 0x3019427E, 0x7BE84CA7, 0x167A8170, 0x7521D61B, 0x8320D17A, 0xEB02BDC0, 0x133290BF,
+    0x92CA7C75, 0x31BDD401, 0x0D73AEF2, 0x97F35DCE, 0x6EB3076E, 0xFA733AAD, 0xD143B93C, 0x88B1E08A,
+    0x642CFD4D, 0xD79EA1C5, 0x714739F2, 0xC38DB28D, 0x51A7C642, 0x26313F59, 0xA9A1B409, 0xFFFFEF7B,
+    0xFFFFF166, 0x00001466, 0xFFFFF238, 0x000013A5, 0xFFFFF7D9, 0xFFFFE856, 0x00000692, 0x00001A71,
+    0x000014A0, 0xFFFFDF29, 0xFFFFFD34, 0xFFFFF315, 0xFFFFFAED, 0x000009CC, 0xFFFFDB98, 0xFFFFFC30,
+    0xFFFFE472, 0xFFFFE4D4, 0x00001352, 0xFFFFD830, 0xFFFFED92, 0x00001C54, 0x00000740, 0x00002AB3,
+    0x00000FD2, 0xFFFFF7F7, 0x00001564, 0xFFFFFE23, 0x00000C32, 0xFFFFFFB6, 0xFFFFFEE2, 0xFFFFE180,
+    0xFFFFE993, 0xFFFFEC5C, 0x00001E95, 0x00001FE9, 0x00000410, 0x00000693, 0xFFFFFA36, 0xFFFFF6E1,
+    0xFFFFDD70, 0xFFFFF258, 0x00001B40, 0x0000192D, 0xFFFFF7B6, 0x0000251D, 0x000005DE, 0xFFFFE9A4,
+    0xFFFFED6E, 0x00001ADF, 0xFFFFF400, 0x00000D7C, 0x000013CD, 0x000006EF, 0x00001107, 0x000015A3,
+    0x00000F5E, 0xFFFFFE7A, 0xFFFFE8BB, 0x00001898, 0x00001999, 0x00001368, 0x00000B24, 0x5A97275D,
+    0x560A1D94, 0x4CC15677, 0x5057AFD9, 0x5C633091, 0x560279CA, 0x4AF4FB57, 0x5CF8153B, 0x4D3A1620,
+    0x42A872A5, 0x42728B77, 0x7788D1AB, 0x5EBD5C6B, 0x5FDC83F0, 0x4BD4EF52, 0x40B180A1, 0x4D255FE4,
+    0x57D417A4, 0x4727B879, 0x526D042C, 0x7E28DC3A, 0x57CF8D03, 0x595DA5E9, 0x4E298A25, 0x76B0CE70,
+    0x44DA574F, 0x7823F67F, 0x60CA6C52, 0x5991D7BC, 0x614C1123, 0x44B8A855, 0x61469A90, 0x523FCC71,
+    0x42CDC64A, 0x59344B12, 0x43028454, 0x4C90CC29, 0x46A996EB, 0x43310E6D, 0x56D78481, 0x4AF0A644,
+    0x49BD0551, 0x4EEBF141, 0x4D56AF39, 0x622D2AE8, 0x547F9032, 0x7DFB5BED, 0x60FC9103, 0x449BBC29,
+    0x5DB3F3A7, 0x7BC9E389, 0x5967C4DD, 0x4BD60B0E, 0x4D20F377, 0x5A25D124, 0x42505A10, 0x78054E94,
+    0x7B9ABDA4, 0x5D39AC5B, 0x53C7C930, 0x4B75C3F6, 0x5DEBFA8D, 0x5EA24A52, 0x582B1BCF, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7,
+    0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7,
+    0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xD0373303,
+    0x7FA5960F, 0x5AA2F1FD, 0x90AA3F58, 0xAFC04A9E, 0x59580CDE, 0xCABCEC57, 0xD6647CF2, 0x153966FB,
+    0xB4321536, 0x5EE0560F, 0x4BC8E8C9, 0x420ABBF1, 0xE93686FC, 0x42F2D42D, 0x1887027D, 0xB8C1B29F,
+    0x246DE4E5, 0x4B399BB6, 0xDAE6D24A, 0x64B53643, 0xED2548FE, 0x53199B25, 0x2DA827B8, 0xBF517005,
+    0x9F51BAE2, 0x1FEB40EE, 0x4BD1D925, 0x109E0FB1, 0x5B2267F7, 0xBA704E76, 0xB5574D52, 0xD9EACB96,
+    0x1D0CA176, 0xBF3933D3, 0x5EBA5AE7, 0x3A13F01C, 0xAF69EFAB, 0x48385EFD, 0x550BC8D4, 0x90CFAACF,
+    0xDE8E6BB7, 0x18BF4378, 0x10DC6596, 0x24C4F340, 0x49724116, 0xD260ED1B, 0xB9D6F4CD, 0x1D575B8B,
+    0x41533507, 0xACAF9B09, 0xF19CC6EA, 0x21E6C391, 0x2BE27179, 0x6D8CF837, 0x37D82357, 0xC044F924,
+    0xF941D1DF, 0xDF26DCF0, 0xB8B14889, 0x746AC66A, 0xE8A5126A, 0x043D154C, 0x2B3956C6, 0x368D3804,
+    0xC98199A7, 0xDDE53F67, 0xA318FDB1, 0x085C306F, 0x7CDE4937, 0xC77D764F, 0x1DA429E9, 0x46A93F15,
+    0xB9128B35, 0xBA1328E1, 0xE04A34A2, 0xFAAF790B, 0x194D2C64, 0xFC5DEF6B, 0x4B432CB2, 0x696413DD,
+    0x751E6EBF, 0x5D0B5356, 0x90216D69, 0x3E226B6D, 0xA1412019, 0xCE1B9356, 0x3F1BE52A, 0x998FEB72,
+    0x2F700BC3, 0x3EBC0B77, 0x44E9C5E5, 0x04203CA2, 0x504A3AD8, 0x79303656, 0x072DCADF, 0xC6AF1E57,
+    0xCE4442DF, 0xBA3D1AD2, 0x305DE81D, 0xA197C01E, 0x9B8E0A45, 0x1747A18A, 0xC45CB79F, 0x3BA10C9E,
+    0x56C50438, 0x8E378AFF, 0x6D67D76E, 0x580B5F01, 0xD47592D0, 0x28A90FC7, 0x4BEAF600, 0xB82D7D8B,
+    0x2D04BF75, 0x66DB641B, 0x3DAAA9D7, 0xFA41B5F5, 0x061A1BE7, 0x836435DB, 0xF20A6353, 0xCB0A1C8A,
+    0x2A1CFA55, 0x237620FF, 0x93DAFE63, 0xEBDAD951, 0xDD8CAC0D, 0x2533092B, 0x66C1EECB, 0x6B459D8C,
+    0x5BA5A230, 0xC5485194, 0x32738659, 0x0DC3C850, 0xACA46663, 0x5B48C889, 0x991DA9F6, 0xE4838533,
+    0xE13A7612, 0x01DCD4A3, 0xACAD3172, 0x21FCB136, 0xA6E2A138, 0xB1AEAB89, 0xB35C7E67, 0xFFFFF4F7,
+    0x000006FD, 0x0000007A, 0xFFFFFFAA, 0xFFFFFEBB, 0x00000AF3, 0x00000521, 0xFFFFFD9F, 0x000003E8,
+    0xFFFFF532, 0xFFFFFDEC, 0x0000062B, 0x0000022F, 0xFFFFF524, 0x000007FB, 0x00000544, 0x00000885,
+    0xFFFFF7AA, 0x000006A8, 0x00000B99, 0x000000B6, 0x00000919, 0x0000097F, 0xFFFFFEEE, 0xFFFFFFE9,
+    0x0000037F, 0xFFFFFACC, 0xFFFFFACA, 0x00000583, 0xFFFFF2CB, 0x000008D4, 0xFFFFF9B9, 0xFFFFFEDE,
+    0x0000065D, 0x000005B3, 0xFFFFFA68, 0xFFFFFC60, 0xFFFFF724, 0x00000BD7, 0xFFFFF692, 0xFFFFF8E6,
+    0x0000051D, 0xFFFFF9C3, 0xFFFFFE1C, 0xFFFFF35D, 0x0000072A, 0xFFFFF64E, 0xFFFFFE39, 0x0000026B,
+    0x000003A3, 0xFFFFFEA7, 0x00000692, 0x0000095F, 0x00000826, 0xFFFFFBAF, 0x00000CE6, 0xFFFFFF4D,
+    0xFFFFFE54, 0x00000588, 0x0000011C, 0xFFFFFF1E, 0xFFFFFF14, 0xFFFFF3B9, 0xFFFFF2AC, 0x71A764A6,
+    0x7BD2A97D, 0x65FF5413, 0x65FABD4C, 0x7B8998CF, 0x57851E76, 0x6B1DB1BC, 0x73739931, 0x678FBC7E,
+    0x5F5B5A6D, 0x7C295534, 0x4050F052, 0x40979AEA, 0x5F0ECB17, 0x6952E7E0, 0x6F41CB6D, 0x700B1F42,
+    0x5466E9EB, 0x526CF25D, 0x5DE72A19, 0x553B3898, 0x5B66F15C, 0x414261A9, 0x6485A1A8, 0x7E7FC928,
+    0x62C9E6C3, 0x6473BEF8, 0x6B5AECFE, 0x416FCE34, 0x4F1406FB, 0x76FFAE7A, 0x797CBF34, 0x6567AB68,
+    0x6C882DD0, 0x58051B1A, 0x521DCC2D, 0x75F0776C, 0x51E0BD31, 0x5E46CFCB, 0x69EED6BE, 0x68E49CE8,
+    0x52BCC2D6, 0x5ECBE55F, 0x7D4DFBE5, 0x5FC41457, 0x794FDA5D, 0x689D3227, 0x6913C183, 0x72C9DAEE,
+    0x7E84948C, 0x652CC879, 0x40CCEB67, 0x67BD2A24, 0x72CCC861, 0x75019971, 0x5FA9EF20, 0x769B482B,
+    0x74B1297F, 0x6EFAB38D, 0x60B56050, 0x66CDBCDE, 0x60FAB91F, 0x5E581339, 0x56166BBF, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA, 0xFFFFFFFA, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFFA, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9,
+    0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xFFFFFFF9, 0xBE62709A,
+    0xDC3F8737, 0x611A1195, 0x9D3D6E59, 0x03346D51, 0x05079C78, 0x7882259E, 0xBCED9CA2, 0xD34CAEAB,
+    0xA05B9D56, 0x16E70A24, 0x2457B0C6, 0x4A0DF2DB, 0xEF918690, 0xA1D7AA8B, 0x14059C7E, 0x1C6AF63A,
+    0xD6099B85, 0xDE04D2CB, 0x91741B7A, 0x0C32876D, 0x67F37EEB, 0xF7AF03CF, 0x11680C5D, 0xCE9D9F36,
+    0xE59B2085, 0x0471A5A3, 0x254306B5, 0x2FB7018C, 0x208BA744, 0x62864821, 0x8490B57A, 0x06D45710,
+    0xB2454A0F, 0x5D1D972B, 0x05FB21C0, 0x0206E281, 0xCC7717A1, 0x5113A546, 0xFDD08F20, 0x89C1B66F,
+    0xC1230E71, 0x678E08F8, 0xF56D3D8A, 0xA8E0BFED, 0x993FEF6B, 0xDF4F9F88, 0x1414DDCD, 0xCD8A2392,
+    0x87C835E6, 0xE012A992, 0x47628D47, 0x5C69B2F8, 0xA77A66F2, 0xB6244D60, 0xD2897462, 0xD4A6D0CA,
+    0x3149CEDB, 0x436D4356, 0x069D96E0, 0x3E19032C, 0x45D75D75, 0x54889B57, 0x3910E803, 0x871D7B56,
+    0x19DE8105, 0xB22C6AF5, 0x47C73396, 0x75F26D2B, 0x3C72ED57, 0x6E50AFAB, 0x2E23A3FA, 0xBC9E613F,
+    0x5DC0CD3A, 0x1D4E04DB, 0xCFA36F46, 0x12C87C4A, 0x20885475, 0x76544270, 0x62415FCD, 0x8EC88666,
+    0x7519EC30, 0xEBDEAC51, 0x52AF4656, 0x3A1ABBB9, 0x70489773, 0xE2424956, 0x6665AD6D, 0x5DA04F51,
+    0x8633853B, 0xBE63C354, 0xBFD33BCB, 0x91E7F28C, 0xBA3335FC, 0x23F99E26, 0xAF9C4487, 0x24DF1184,
+    0xD8544C13, 0xA2148677, 0x0B934522, 0xE18D6CA5, 0x0EDBD18B, 0xEAFF0179, 0x66946EB6, 0x95A49596,
+    0xE7474455, 0x00EE2D9F, 0x3B9A74F7, 0x4C39093F, 0x5DA4937D, 0xF56A49A0, 0x6CDCE15C, 0xF757A2D0,
+    0x8B70AE04, 0x92B5169C, 0xC3A6BEF9, 0x5FA1E4CD, 0xFD1C8C8D, 0x1A6FA769, 0x1F04D977, 0xEBF474D8,
+    0xA20A3653, 0x55780343, 0x10DAE4FC, 0xBE69CA61, 0x59DEBEFA, 0xF7984288, 0xD4839F19, 0xF735914C,
+    0xFD5728E4, 0x2E45C373, 0xCB35D358, 0x5E5ED033, 0x7B008D10, 0x45C4FB11, 0x9B2119BD, 0xECCEAD64,
+    0xBA59CB97, 0xAA9B39D3, 0x14933860, 0x1595B058, 0x2EE70636, 0x56D93123, 0x673B88D0, 0x52AF989E,
+    0x64AFD264, 0x508648D1, 0x1E53A6AE, 0x7CC7450C, 0xABD48D17, 0x219BC4D2, 0x75DF45C5, 0x01009354,
+    0xF983491E, 0x26ED0F46, 0xFC207F6F, 0x7EDF7E90, 0x834CB54D, 0x1676102C, 0x399F67EF, 0xC827E625,
+    0x432DFA68, 0x781BF42C, 0xD17DF677, 0x921DC9E3, 0xD3F53AF5, 0xB310F125, 0x344F1723, 0x552138DD,
+    0xCEF07AC1, 0x374010DA, 0xC7CCBE73, 0x1AA3C46A, 0x472BFA17, 0xB5A485DF, 0xE85CEA17, 0x0EFF65BB,
+    0x93B91E4A, 0x3B9C58D1, 0x33AFB5B6, 0xBE6464BE, 0x2F346F12, 0x793AD135, 0x21B7F4A8, 0xB3177107,
+    0xC2CCE12C, 0x62C5B6C8, 0xD23618ED, 0xB029F6D4, 0xCA6A84E8, 0x9F858B14, 0x67D7EB26, 0xE4FAFA8A,
+    0x49DF44C1, 0x8EC593FC, 0xD7DA5272, 0xEC2713E4, 0x65C4D828, 0x3D271250, 0x4694F07C, 0x3FCEB5EF,
+    0xC9BC14AD, 0x34ED5217, 0x36F67DE7, 0x27E60C19, 0xAE15312F, 0xD9DDF217, 0x318A94D4, 0xD57D7613,
+    0xBA395B92, 0xD417F8E7, 0x57CBE778, 0xA8D80655, 0xE351A405, 0x89DE76C4, 0x8348CA1A, 0x5EAD5C94,
+    0x02B43AB5, 0xF6C29A6B, 0x3F402B96, 0x6F32E699, 0x63850B9C, 0x60D7FB75, 0x025F7392, 0x835177F0,
+    0x92D3C366, 0xF1609089, 0x4416A4AC, 0x43D91BBF, 0xDCBDF961, 0x7A1B300A, 0xAEDB52C8, 0x913EC4FA,
+    0x5527439A, 0xBC3DF028, 0x320193F4, 0xCBACDDF3, 0xA21CDB73, 0x57593D6F, 0x680D1FB1, 0x815BBA15,
+    0x1AB7F164, 0xB0CA17D3, 0x8761365D, 0x4E89A346, 0x11EDC776, 0x9D2BAC6D, 0x46B35C48, 0xD0C33F8C,
+    0x7BBD16B0, 0x937A7AE6, 0xD6F0C4B8, 0xCC705E7F, 0xAD56AC42, 0x3D2DC4C3, 0x415D61AE, 0xFD4D927A,
+    0x888C34FD, 0xCB2431B2, 0x27D773EB, 0x0D5C171F, 0x8C9D6406, 0x32905945, 0x39C894B1, 0x5B46A415,
+    0x050FA896, 0xC5C4DDA1, 0x6AEE68B5, 0x9AF819B0, 0x6A58EED1, 0xEF26B52D, 0xBD377910, 0xF704A705,
+    0x2AD54819, 0x647D856E, 0xA9C96038, 0x45C4A0C9, 0x4566B823, 0x5F66C682, 0xC125F40A, 0x27AEE6C0,
+    0x27E98350, 0xDBF8CA1D, 0xCA450739, 0xC17B7232, 0xA1A255A7, 0x5740C556, 0x47586DC1, 0x7E19212D,
+    0xA3CFA9DB, 0x16706857, 0x4CC2FB7A, 0xB611247B, 0xA8B0DD14, 0xC53849CE, 0x6D18703E, 0x53720049,
+    0x1EE163A5, 0x22CDF548, 0xF7395B07, 0xC73C9700, 0x4E707654, 0xCB218C63, 0x1A6B84C5, 0x74538EDE,
+    0x867D1B68, 0xA11FD6FE, 0x140E9805, 0x27391355, 0xE5CE051C, 0x3E8E9E89, 0x235F4EFA, 0x385A9C7F,
+    0xDF3C30CA, 0x0C84C753, 0xCFE5775D, 0xCB468379, 0x9A2D5FFA, 0x5F5B20CB, 0x52D889B2, 0x821E4A38,
+    0xCE42EA81, 0x9039F7A0, 0x57019900, 0x74C5A14E, 0x5FB836BB, 0xDBCC1001, 0x633487ED, 0x49D02C78,
+    0x75C89A5F, 0x33F37484, 0x5F39A760, 0x9F7493D6, 0xA9B97AAF, 0x59A070DB, 0xE02B0C00, 0xA761A603,
+    0x56EA8820, 0xDA70327C, 0x9B4C28CC, 0xB3EFCF14, 0xE5B30D8E, 0xBC9BDE94, 0x72A8B691, 0x397B661E,
+    0x2EB3AE30, 0x30D69172, 0x194ED313, 0x9687B817, 0x47E5B135, 0x29FBE578, 0xB5D16B83, 0xD82DE34B,
+    0x7137B8AA, 0x6E6BDDF3, 0x9837EC53, 0x97F32674, 0xA0953488, 0xBF39726B, 0xA015B908, 0x59CF5BF2,
+    0xD846D769, 0x4D176DAE, 0x3D3FBF82, 0xF7F9836B, 0x53FDEA1A, 0xA42103C0, 0x994E7611, 0x2D6DCFA5,
+    0x3A667A37, 0xE326ED57, 0x4FA2D5DA, 0x0DB5A684, 0x3570D29D, 0xF11FFF47, 0xCB9C7EDF, 0x42F8A097,
+    0x45DD4B54, 0x5C13B8AA, 0xD5E02970, 0x69C9A568, 0x6B6F3985, 0xA6DBE87A, 0x3568C4C3, 0x2A1E054D,
+    0x734C646D, 0x5074AD4F, 0x2F7B4229, 0x2F421E89, 0x22251A14, 0xAD32C7CC, 0xC2C75311, 0x37BBEB83,
+    0x0AF14826, 0x6C383035, 0xA92D21D1, 0x0BED5D6A, 0xCBC4A648, 0x779B088B, 0x29617525, 0x083AD192,
+    0x6CC458F8, 0x63B8EAF9, 0x15A98909, 0x3559E9A6, 0x7ACA4571, 0x9A417C29, 0xF64E6FE4, 0xF45B28BB,
+    0xA61E7D07, 0x50C6F434, 0x7AF47D96, 0x2C4F5151, 0x1251DFEE, 0xB3FACD7B, 0xBC1D9FA3, 0x876760DF,
+    0x5E2912F2, 0x9E23C868, 0xF4D16FCC, 0xB92DF608, 0xB1E700A1, 0x4F11EDAC, 0xB88C93E0, 0xF2DDCE29,
+    0xE6E245C5, 0x6DEB9EE8, 0xB6F3A60D, 0xFB5A865F, 0x5C169A37, 0x8333595B, 0x0FCF26FC, 0x0292339A,
+    0xD91A6EFA, 0x32D1D6EE, 0x5E70C930, 0x417C61E8, 0x7D750727, 0x7C7699AC, 0xACF4E886, 0x78A4EB07,
+    0x391006E4, 0xAD0DB60A, 0x3DDB131C, 0xD1F3EB87, 0x839E8CF1, 0xA4F8D387, 0xD3554E1E, 0x2BD9A2F7,
+    0xA5C9EB1F, 0xB57A2EF0, 0x9290EBB0, 0x0D3474EA, 0xA91082E4, 0xFC1B89BC, 0xEE9A078B, 0x84D94A27,
+    0x6DE2A2B5, 0x6FAF6458, 0xB89D47E4, 0x5F06AD01, 0xDAF2C9B7, 0x416371E8, 0x8EA668F3, 0x1F4AEA03,
+    0x55A66570, 0xD698F78C, 0x9B58D2A7, 0x12B57C01, 0xEBF25801, 0x0D61079C, 0x34B1AFF3, 0x583BBC17,
+    0x2ED91F4A, 0x00D02D85, 0xC115DDA8, 0x45733AFF, 0x522C5FEB, 0x4E2E04FE, 0x799EECD6, 0x92CEF4B2,
+    0x0FFE108C, 0x931AF289, 0xBBF4429F, 0x5360AC1F, 0x98FA38F8, 0x517294C4, 0x3FF91522, 0x579441A4,
+    0xC3F387E6, 0x7FA79339, 0x6BBD2DD5, 0x5A148853, 0xF0371D4A, 0xC07B58F9, 0xC5D60CC3, 0xEBCD328E,
+    0x378A4A58, 0xC3683D97, 0x91975EBC, 0x05ACF82D, 0x0915BA44, 0x4D972BD3, 0xEEB66D61, 0x0DA99897,
+    0xAA762D9D, 0x03A2BE18, 0x1B9D9444, 0x07577BC9, 0xEC880B4F, 0xC4F837E8, 0x7CAA35E8, 0x1129E0B3,
+    0x726CC049, 0x4A7ABD4B, 0x76C4A7B0, 0x85E704BD, 0xD75FABED, 0x935AA10B, 0xDB3740ED, 0x23DC61F7,
+    0x14472079, 0xE93DA3C7, 0xB8E1A710, 0xBFC7456E, 0xA893581E, 0x9AE2F5CB, 0x340C661B, 0xAC133A3F,
+    0x4F4663CC, 0xDD10B7A7, 0x39AD24AE, 0x7D9D5E1A, 0xB59BBB5B, 0xD8A5CE19, 0x8399B14D, 0xA1A0C502,
+    0xB9206A46, 0x5790B03B, 0x0EC71A91, 0x2B86FE84, 0x93919217, 0xB788C523, 0xC933C7CD, 0x5D3ED992,
+    0x277DBC15, 0x9E889EE2, 0x77AB4AC2, 0xD2F10327, 0xA665FDAB, 0x11FCD0A0, 0xDFF9B3E2, 0xF92338DC,
+    0x90899A96, 0xAC4465F9, 0xF312E957, 0x18601045, 0xF5A9AC33, 0x86B50660, 0x449DFAF8, 0x03E80D35,
+    0x811886D2, 0xC52EC184, 0x53402CB8, 0x4C739891, 0xBA6696C8, 0xB28E98D9, 0xD024EA58, 0xC6787306,
+    0xFC6497E9, 0xD54C2C93, 0xF3910C1B, 0xFE4FCF26, 0x9A5347AB, 0x064B4EB5, 0xBD8C5CB4, 0xE20E19A1,
+    0xC74DE169, 0xCDB498F7, 0xECBA9490, 0xE1A82973, 0x580E1B58, 0x6EE91858, 0xC5CE1CB9, 0x3A9BFF05,
+    0x42FBDD0F, 0xEAAD3404, 0x2C85C35B, 0x443AD2EE, 0x4B96AA58, 0xE03A5338, 0x4473C7EB, 0xAA21C93B,
+    0x36BA2604, 0x2DB0EE14, 0x7784C629, 0xAD2DCB7C, 0x7C55767A, 0x3262FE8A, 0x7AEDBEE9, 0x272285DD,
+    0x62B362C1, 0x1FFAAB8A, 0x40F30F56, 0xE1A06666, 0x5BC44630, 0xAF4E0421, 0x22294FF2, 0xECC0F41C,
+    0xBD4EAEB4, 0xAC477EDF, 0x49BA2AC5, 0x6BF84912, 0x62008E9B, 0xDEA94371, 0x944BD68E, 0x1A702F18,
+    0x3BF64E6B, 0x0156BCDB, 0x11DC7EF2, 0xCD9FBE12, 0xDFC9926E, 0x238244BA, 0x337B30FE, 0x24232784,
+    0xAF6B5B6A, 0x12D04783, 0xBE306A83, 0x03700FC5, 0xDD9B5283, 0x5993604C, 0x8E50DF6E, 0x40EE1A8F,
+    0x43C0089A, 0x910D31E0, 0x8F6860FE, 0x7AD0CFCC, 0x9CF5A249, 0x5679D7D5, 0x87366189, 0xC479A86A,
+    0x1694C794, 0x9BBDDE37, 0x47AD3BC0, 0x118DBD10, 0xB57A4241, 0x73C405BD, 0x934FD46D, 0xE2A5B2E4,
+    0x60DB17BD, 0x221650E4, 0x8262659E, 0xA0E28FEC, 0x50CC3F0B, 0xCD4B1E66, 0x77F7370D, 0x8C36294F,
+    0xEE5E686B, 0x056B4C34, 0xAFB02114, 0x13114B2A, 0x1D4F4369, 0xB1C7701D, 0xB090847C, 0xEE0C4C3F,
+    0x8DC94058, 0x704FF67B, 0x3719EFE2, 0x787D3182, 0x67A85346, 0xA2CB1341, 0x93D5D861, 0x221B940F,
+    0x4F554D21, 0x21AB945C, 0xA3BA31AC, 0xAD5403B8, 0x4A315BFA, 0x1C89209F, 0xBBC9D122, 0x0BA10E8D,
+    0xABA0CADB, 0x7C981DD9, 0x8E67C811, 0xF879D163, 0x7E3E3B31, 0x12861E4F, 0x04D10433, 0xA90667B4,
+    0xFDB28222, 0x56AEAB9F, 0x78632ACE, 0xC9BB24F2, 0xFB9BA8E5, 0x5201020C, 0x1631F6B1, 0x7AF718A2,
+    0xECE1F41D, 0x4DB6A7B7, 0x3E06F0E9, 0xDFC6EB31, 0xBACA0D71, 0x49B94774, 0x0E3FEE59, 0x6004E453,
+    0x6A32E913, 0xFDA7EA2A, 0x55A669BA, 0xA98E19F7, 0xFF983632, 0x25982097, 0xFB09699A, 0x5BFA3D42,
+    0xCA226111, 0x2169109E, 0x5FBAA054, 0xD3873F58, 0x078D5B6F, 0x050A4BDA, 0x7E766754, 0xC1486FCB,
+    0x138257F1, 0xC5485EE6, 0x0EB06C50, 0x22152BC9, 0x1B2378F7, 0xC8E093A3, 0x2D72E6EA, 0xE51F7627,
+    0x135C0194, 0x2008A5E2, 0x7BC952F2, 0x0D1AF039, 0x283BB703, 0xAA6921F6, 0x97E9D0DA, 0x169EBB23,
+    0x3A5C74A2, 0xF2262623, 0xB0706EB7, 0x427919BA, 0x8C4A0638, 0x0FB04FEA, 0x7F9FC7F6, 0xF452FF99,
+    0x53F746B3, 0x79A7A056, 0x6E484A29, 0x525978F4, 0x5A701FDB, 0xCC30940D, 0x31F75FDE, 0x874C2E61,
+    0x394A7AFF, 0x612C4D9B, 0x93C3B97C, 0x11A346B1, 0x8EBAD3A1, 0x5BF70763, 0x7223B6B9, 0x4A285E90,
+    0x2DAAF158, 0x9CEA188C, 0x5D1E5C92, 0x7F29A3CB, 0x91184F57, 0xE3B95932, 0x21F95D65, 0xE5C05B9F,
+    0xBBDE0517, 0xF1365885, 0x0F5D1FEF, 0x54AFA340, 0x7CED2A56, 0x234E939A, 0xADB464B5, 0x2B93F26F,
+    0xF0597F75, 0x78C612C5, 0x392C23E1, 0x7504B963, 0xD9635DC5, 0xC773C91E, 0x7160400C, 0x59A81665,
+    0xE2A384D2, 0x819970DB, 0x04883B29, 0xCDE20867, 0x451C0360, 0x1CF5AA53, 0xB7071DE2, 0x83645D6F,
+    0x50B97FFD, 0x8A9992B2, 0x7923EEA1, 0x6569A25A, 0x7FA934DB, 0xFCBBE62F, 0x9969C7A8, 0x6BFBFC42,
+    0x577ACEB0, 0x7B059A21, 0x4856CB35, 0x4F2230EC, 0xBA63F768, 0x38B1228D, 0x309678E2, 0x1C6F9C7B,
+    0x2803008C, 0xF60945AF, 0xDAA70C51, 0x67C59176, 0xF90B0801, 0x30F0ED46, 0x70FB9FFC, 0xE352BC7D,
+    0xD10D827C, 0xF66DA83C, 0xF93FB594, 0x87B7CBEE, 0x06AF7506, 0x30FFA4C4, 0x549F41E6, 0xB2E0FF9A,
+    0x1BC0FF29, 0x9338DBAA, 0x8FF90573, 0x06E2C851, 0x3609AEC2, 0x54348500, 0x4D27ADB7, 0x6C1A82C7,
+    0xBFFCDAE4, 0x97CBE051, 0x7B6BDEDD, 0x89E1FA7D, 0x71A6513D, 0x4B960C62, 0xB0E40762, 0xAD655E03,
+    0x3DF5B179, 0xE1390BA8, 0x4079A9A5, 0x753C45C5, 0xE6EB73B1, 0xA44AFBC1, 0x1F289A72, 0x771FB90D,
+    0x60E693ED, 0x73CE776D, 0x75067519, 0xCE670B4D, 0xB4353809, 0x134D2777, 0x73513604, 0xB53B8471,
+    0x510CB41E, 0x7A179FAF, 0x318677F9, 0x10BDD9DC, 0xEBE6B027, 0xE5FAF190, 0x0D100122, 0xBF66F3B2,
+    0xF6C2EE11, 0x04655A30, 0x8DFF61AC, 0xB5E49207, 0xD1D0D0B8, 0x84200EAE, 0x3D6FD84C, 0xF7170AE7,
+    0xDD488A34, 0x3B270777, 0x73306351, 0xB2FEB0DE, 0x1DB33CCE, 0x310C976F, 0x67E5CCA1, 0xC3C656FF,
+    0xB643A451, 0xED5675BF, 0xF87D274A, 0x91CE98DB, 0xF27D1399, 0x2AF5958B, 0xA88CE8A3, 0x24403F0E,
+    0x474A5000, 0xEC4127D5, 0xAAAD1DB1, 0xB0DBBBE9, 0xEBCBD84F, 0xCD6F4B13, 0xFB125F51, 0x783B5E31,
+    0x08DBE178, 0xED741207, 0x75D357C5, 0x9156F608, 0xF86FB815, 0xB3E75C98, 0xB8B2D51F, 0xC09848CD,
+    0x20A3F168, 0xB7567D65, 0xF8E10126, 0x4D6D8DD5, 0x62A8925B, 0x5D0B2169, 0xE26F7BD7, 0x625E6F62,
+    0x35C53603, 0x0BFA7716, 0x28A6BD73, 0x59F3ABBC, 0x610DA5C0, 0x4E2B23DB, 0xDD03CD6D, 0x9D7D8E49,
+    0x6A7EC2DE, 0x21D3DF95, 0x6525AD92, 0x7D31F13D, 0x75732426, 0x51EC9350, 0xA26E2701, 0x477C5515,
+    0xD185B60C, 0x70EC5F4A, 0x2B8C0898, 0x65DDDCC7, 0x6E34FD26, 0x4CED566A, 0x52AB63E9, 0x5FBED7D6,
+    0xAE1385C6, 0x944A2C3C, 0x6FC7B58F, 0x73665118, 0x08AC5A5C, 0xBE490E66, 0x97C48553, 0x3684F000,
+    0x32637FBE, 0x5D7CAE27, 0xEB98A460, 0xECEA9364, 0x58370F82, 0xFC147A4E, 0x90988FA6, 0x2E078CAE,
+    0xB3E59534, 0xBF0EE9F1, 0x8DE819DB, 0xBAA59834, 0x7DA43BED, 0x3BA1289E, 0x40E84954, 0xBA59E391,
+    0x4C026660, 0x56BC7AC4, 0x70BBE07B, 0xFC814213, 0xECAA724A, 0x3D0F79DC, 0xDF0DC3FD, 0xDC1D9D24,
+    0x0E49D1D6, 0xE525BE0F, 0xC0830413, 0xB247D24F, 0xF4F39E67, 0x8E8DE964, 0x8E144053, 0x7E20BC34,
+    0xF2615F17, 0x8E56D4A6, 0xD358B099, 0xD4B95D59, 0xB408DB73, 0x4182A563, 0xA37E7DE9, 0xAFC35394,
+    0x3637E82C, 0x5C1343E5, 0xE9030D5A, 0x223CD0D3, 0x3E5BD1A1, 0x01FC0F17, 0x0CDC2879, 0x47507AAE,
+    0xFC29BE82, 0xEE7CD0EA, 0x9E025C64, 0x7955AB01, 0xFC5E452C, 0xED7EE804, 0xAF82B06C, 0xD84E7A3A,
+    0xAA3D3383, 0x2BEE285A, 0xA568D924, 0xB604A6C5, 0xF7317AC0, 0x21F3AC7E, 0x1B28EBA6, 0x0AEA1D34,
+    0x5C8F9C6C, 0x2E1BBE66, 0xCFBD2677, 0x0D5E1768, 0xA6CC0AD5, 0xC01AB94B, 0x87A867CC, 0x7663BCEF,
+    0x4B1C5192, 0x2DBA6B13, 0x9AA88295, 0x231A0953, 0x19E262C4, 0x39FD22ED, 0x4797D090, 0xFFFFFFD4,
+    0x00000961, 0xFFFFFBF1, 0xFFFFE047, 0x000003C0, 0xFFFFE1F7, 0xFFFFE4EE, 0x000005C1, 0x0000199B,
+    0xFFFFF97B, 0x00001E78, 0xFFFFE905, 0xFFFFF6AC, 0xFFFFF99B, 0x0000200E, 0xFFFFF835, 0x00001030,
+    0x00001282, 0x000008C4, 0xFFFFF5FB, 0xFFFFFF2A, 0x0000033A, 0x000004BE, 0xFFFFFF03, 0x000025A0,
+    0x00001BE7, 0xFFFFE305, 0x00001889, 0xFFFFFA64, 0xFFFFFA98, 0xFFFFF06E, 0x00000B90, 0x00001D8C,
+    0xFFFFF8E7, 0xFFFFF774, 0xFFFFE3C6, 0xFFFFF05B, 0x000004C7, 0x00001DE8, 0xFFFFE676, 0x00000D9F,
+    0xFFFFEAC8, 0x00001B0F, 0x00002048, 0xFFFFEDEB, 0x000011BA, 0xFFFFED41, 0xFFFFFAF8, 0xFFFFF00D,
+    0xFFFFEF76, 0x000019FE, 0x000000F0, 0xFFFFE490, 0xFFFFE0A9, 0x00001D3F, 0x00000C37, 0xFFFFEB57,
+    0x000001E2, 0x0000130D, 0xFFFFF61A, 0x00001CFA, 0xFFFFEF7B, 0xFFFFF527, 0x00001249, 0x57454A8F,
+    0x61F598C6, 0x463DAB3A, 0x409651D3, 0x4AA3E14A, 0x41733072, 0x4EEA9E8A, 0x4B11C0A9, 0x48EF395B,
+    0x551B65E4, 0x775A6BD1, 0x5D800BB7, 0x4C202F2F, 0x5167A014, 0x48049A01, 0x4CB6AE3F, 0x564BDF3B,
+    0x60EBFB7F, 0x7EEC2E07, 0x49FDBA91, 0x500CD877, 0x4CFDB229, 0x5E38AC74, 0x4D286CED, 0x40A1908A,
+    0x7E841C70, 0x578BF20B, 0x57002842, 0x557C18A3, 0x4D1C3ED7, 0x78A5DF4F, 0x545B751B, 0x50946163,
+    0x51E1C640, 0x40D1C6A3, 0x5A07398D, 0x611C91AF, 0x5E8C134C, 0x498B9D63, 0x596F0473, 0x4219F45C,
+    0x5900C16B, 0x50156C55, 0x4D806056, 0x477A2920, 0x4338929C, 0x54052909, 0x5D0747AB, 0x7B71A563,
+    0x42E8347E, 0x494C0390, 0x4DC692FA, 0x575EC409, 0x4F39B50E, 0x54DA2AF2, 0x5EEB65A3, 0x5E8B1EF5,
+    0x5D7F5B95, 0x5EC34002, 0x780F611B, 0x4D1E53E5, 0x47E30E9D, 0x7CEF26BA, 0x5AF84409, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF8,
+    0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF8, 0x0106FE08,
+    0xF2EB0004, 0x00EF00F6, 0x120601FB, 0xF6FCFEF9, 0x02FC3E29, 0xF93E00F6, 0x11FDF100, 0x021B0009,
+    0xF5FFF6FF, 0x020D0113, 0x01FD03F1, 0x3AFFFE01, 0x1702F10A, 0x0F010001, 0x1A090401, 0x020DFF0D,
+    0xDBFDFC04, 0x00F4FFFF, 0x0A0400F3, 0xFDFC03F8, 0x00FD3E13, 0xFE0002FE, 0x06F2FC00, 0xDC140804,
+    0xF404F400, 0x02040009, 0x00F80831, 0x00000001, 0x06FF0511, 0x0C01FF01, 0x0607FFFD, 0x000F0006,
+    0xE2FF0804, 0x00EC00FD, 0xF402FFF1, 0xEAFDFEE7, 0x00F93EEB, 0x0600FF05, 0x0005EA00, 0x100F0803,
+    0xF5020101, 0x0405FF15, 0x00FD0031, 0x0000FEFF, 0x06F50603, 0x1101FFFF, 0x0D07FFFF, 0x01000113,
+    0xEEFC0702, 0x00FB00FF, 0x0003FFF5, 0x0705FDF1, 0x00F200C6, 0x0300FEFE, 0x0009F600, 0x08F3FE09,
+    0xF0020100, 0x0207FFFE, 0x00FFFF3E, 0x00010001, 0x0E04FE1E, 0x000000FF, 0xFEFB00FF, 0x00FB070E,
+    0x0C07FC07, 0x00060607, 0xF8F8FD02, 0x08070605, 0xFFF9D3F3, 0x02D3040D, 0xE9070800, 0x04F40106,
+    0x0CF906FE, 0xFCEDFB00, 0xFD07000F, 0xD4040A00, 0xF2020BF8, 0xFAFEFF00, 0xF6EEF9FB, 0xFCF20207,
+    0x0D06FC02, 0x00010702, 0x07FCFE0F, 0xF5040403, 0xFFFDDAF5, 0x0400FEFA, 0xFF120A00, 0x02E909FF,
+    0x0D030BFB, 0x00FBFD0B, 0xFF010720, 0x0004F001, 0xFF01FAE7, 0x15010004, 0x05F802FB, 0x01EE0503,
+    0x1402FE00, 0x00060505, 0x05FCFB0A, 0xFE0B0516, 0x01FED403, 0xF900FDF4, 0x05FA0800, 0x06EEFD0C,
+    0x0A0208FD, 0xF90001F1, 0x00F8134C, 0x0004F501, 0x020AF3F2, 0x0C020000, 0xF5FAF7FA, 0xFEFFFEF8,
+    0x05FF05FF, 0x00020104, 0xF9F6FD09, 0xFE050EFC, 0x02110050, 0xF8000308, 0x07F61300, 0xFCFB06FC,
+    0x0B040803, 0x02FD01FA, 0xFFFB16E9, 0x00FEFBFE, 0xFB070FE0, 0xF2000101, 0xF800FE07, 0xFFFEFCEB,
+    0x030F04F6, 0x000DFB03, 0xF6010204, 0x02FDFD03, 0xFE0CE4E3, 0x05E4FDFF, 0x03FC0700, 0xFAEFFEF1,
+    0x01080503, 0x010504ED, 0x01FCFD01, 0xEFFDFAFF, 0xF5FC06FD, 0xF50101FF, 0xEF070202, 0x02FF00EC,
+    0x18FD09FA, 0x000CFA00, 0xEFFE0300, 0x0D00F905, 0x0005DEF7, 0xFF000007, 0xF9FDFB00, 0x23FEF0FD,
+    0x02F90205, 0xFE0003EC, 0x0008F1AD, 0x00FD0EFE, 0xFB000008, 0xE1FE01FC, 0xF400FF08, 0xFF01FCF7,
+    0x0800FAFC, 0x0010FC00, 0x06010505, 0x19F9FD05, 0x0009E413, 0x00000406, 0xFB010E00, 0xEA02FAF0,
+    0x04FDF702, 0x02FA00F9, 0x0009ED81, 0x00FD0C00, 0xF803070B, 0xE4FE0000, 0xFC000806, 0x010001F3,
+    0x0D05F5FF, 0x0004FFFD, 0x07050303, 0xFAF6F713, 0xFFFD00E9, 0x0300FFFB, 0xFB00F700, 0xFC12FDFB,
+    0x07FAF8FD, 0xFCFC0008, 0x0005EBD7, 0x00010501, 0xF7F5F302, 0x0C00FF00, 0x090502FB, 0xFFFFFAE7,
+    0xFFFFF2B3, 0x0000118E,
+};
+
+#endif /* KWS_MODEL_H */
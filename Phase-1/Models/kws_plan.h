@@ -0,0 +1,85 @@
+/* kws_plan.h
+ *
+ * Memory plan of Models/kws.bhnn (30952-byte BHNN model, 51 tensors, 12 layers) for
+ * bh_nn_graph_init_planned(). Generated by Host/tools/nn_planner, do not edit.
+ *
+ * Activations 16000 bytes (lower bound 16000), scratch 1152 bytes for the Cortex-M4,
+ * state 0 bytes.
+ */
+
+#ifndef KWS_PLAN_H
+#define KWS_PLAN_H
+
+#include "bh_nn_graph.h"
+
+#define KWS_NUM_TENSORS       51U
+#define KWS_NUM_LAYERS        12U
+#define KWS_ACTIVATION_BYTES  16000U
+#define KWS_SCRATCH_BYTES     1152U
+#define KWS_STATE_BYTES       0U
+#define KWS_ARENA_BYTES       \
+    BH_NN_ARENA_BYTES(KWS_NUM_TENSORS, KWS_NUM_LAYERS, KWS_ACTIVATION_BYTES, KWS_SCRATCH_BYTES, \
+                      KWS_STATE_BYTES)
+
+// Offset in the activation or state region, per tensor
+static const uint32_t kws_offsets[KWS_NUM_TENSORS] = {
+    8000,             //   0 1x49x10x1, layers -1..0
+    0,                //   1 1x25x5x64, layers 0..1
+    BH_NN_NO_OFFSET,  //   2 const
+    BH_NN_NO_OFFSET,  //   3 const
+    BH_NN_NO_OFFSET,  //   4 const
+    BH_NN_NO_OFFSET,  //   5 const
+    8000,             //   6 1x25x5x64, layers 1..2
+    BH_NN_NO_OFFSET,  //   7 const
+    BH_NN_NO_OFFSET,  //   8 const
+    BH_NN_NO_OFFSET,  //   9 const
+    BH_NN_NO_OFFSET,  //  10 const
+    0,                //  11 1x25x5x64, layers 2..3
+    BH_NN_NO_OFFSET,  //  12 const
+    BH_NN_NO_OFFSET,  //  13 const
+    BH_NN_NO_OFFSET,  //  14 const
+    BH_NN_NO_OFFSET,  //  15 const
+    8000,             //  16 1x25x5x64, layers 3..4
+    BH_NN_NO_OFFSET,  //  17 const
+    BH_NN_NO_OFFSET,  //  18 const
+    BH_NN_NO_OFFSET,  //  19 const
+    BH_NN_NO_OFFSET,  //  20 const
+    0,                //  21 1x25x5x64, layers 4..5
+    BH_NN_NO_OFFSET,  //  22 const
+    BH_NN_NO_OFFSET,  //  23 const
+    BH_NN_NO_OFFSET,  //  24 const
+    BH_NN_NO_OFFSET,  //  25 const
+    8000,             //  26 1x25x5x64, layers 5..6
+    BH_NN_NO_OFFSET,  //  27 const
+    BH_NN_NO_OFFSET,  //  28 const
+    BH_NN_NO_OFFSET,  //  29 const
+    BH_NN_NO_OFFSET,  //  30 const
+    0,                //  31 1x25x5x64, layers 6..7
+    BH_NN_NO_OFFSET,  //  32 const
+    BH_NN_NO_OFFSET,  //  33 const
+    BH_NN_NO_OFFSET,  //  34 const
+    BH_NN_NO_OFFSET,  //  35 const
+    8000,             //  36 1x25x5x64, layers 7..8
+    BH_NN_NO_OFFSET,  //  37 const
+    BH_NN_NO_OFFSET,  //  38 const
+    BH_NN_NO_OFFSET,  //  39 const
+    BH_NN_NO_OFFSET,  //  40 const
+    0,                //  41 1x25x5x64, layers 8..9
+    BH_NN_NO_OFFSET,  //  42 const
+    BH_NN_NO_OFFSET,  //  43 const
+    BH_NN_NO_OFFSET,  //  44 const
+    BH_NN_NO_OFFSET,  //  45 const
+    8000,             //  46 1x4x1x64, layers 9..10
+    0,                //  47 1x1x1x3, layers 10..11
+    BH_NN_NO_OFFSET,  //  48 const
+    BH_NN_NO_OFFSET,  //  49 const
+    16,               //  50 1x1x1x3, layers 11..12
+};
+
+static const bh_nn_plan_t kws_plan = {
+    KWS_NUM_TENSORS, KWS_NUM_LAYERS,
+    KWS_ACTIVATION_BYTES, KWS_SCRATCH_BYTES, KWS_STATE_BYTES,
+    kws_offsets
+};
+
+#endif /* KWS_PLAN_H */
@@ -0,0 +1,24 @@
+################################################################################
+# blackhand-dsp
+################################################################################
+
+BLACKHAND_DSP_VERSION = 0.1
+BLACKHAND_DSP_SITE = $(BR2_EXTERNAL_BLACKHAND_PATH)/package/blackhand-dsp/src
+BLACKHAND_DSP_SITE_METHOD = local
+BLACKHAND_DSP_DEPENDENCIES =
+BLACKHAND_DSP_INSTALL_STAGING = YES
+
+define BLACKHAND_DSP_BUILD_CMDS
+	$(MAKE) $(TARGET_CONFIGURE_OPTS) -C $(@D)
+endef
+
+define BLACKHAND_DSP_INSTALL_STAGING_CMDS
+	$(INSTALL) -D -m 0644 $(@D)/libblackhand-dsp.a $(STAGING_DIR)/usr/lib/libblackhand-dsp.a
+	$(INSTALL) -D -m 0644 $(@D)/mfcc.h $(STAGING_DIR)/usr/include/blackhand/mfcc.h
+endef
+
+define BLACKHAND_DSP_INSTALL_TARGET_CMDS
+	$(INSTALL) -D -m 0755 $(@D)/mfcc-bench $(TARGET_DIR)/usr/bin/mfcc-bench
+endef
+
+$(eval $(generic-package))
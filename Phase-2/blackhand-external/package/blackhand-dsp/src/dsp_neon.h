@@ -0,0 +1,14 @@
+/*
+ * Neon selection for the DSP library.
+ *
+ * The Neon paths use AArch64-only intrinsics (vfmaq, vsqrtq, vmaxvq),
+ * so 32-bit Arm builds take the generic C path. Build with
+ * -DDSP_NO_NEON to force the generic path for comparison.
+ */
+
+#pragma once
+
+#if defined(__ARM_NEON) && defined(__aarch64__) && !defined(DSP_NO_NEON)
+#define DSP_NEON 1
+#include <arm_neon.h>
+#endif
@@ -0,0 +1,447 @@
+/*
+ * MFCC / log-mel feature extraction.
+ *
+ * Compared to arm_mfcc_f32 the stages are fused to cut passes over
+ * memory:
+ * - window and FFT packing are one pass straight from the sample
+ *   history (no copy of the frame, no separate zero pad of the input);
+ * - the max|x| normalisation is folded into the mel energies, which are
+ *   linear in the magnitude, instead of rescaling the frame;
+ * - the real FFT unpack and the magnitude are one pass (rfft.c);
+ * - the log is written straight to the output when there is no DCT.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp_neon.h"
+#include "mfcc.h"
+#include "rfft.h"
+
+#define MFCC_PI 3.14159265358979323846
+#define MFCC_LOG_OFFSET 1.0e-6f     /* same floor as arm_mfcc_f32 */
+
+struct mfcc {
+    struct mfcc_config cfg;
+    unsigned num_out;
+    struct rfft fft;
+    float *window;          /* frame_len */
+    uint32_t *filter_pos;   /* num_mels */
+    uint32_t *filter_len;   /* num_mels */
+    float *filter_coefs;
+    float *dct;             /* num_ceps x num_mels */
+    float *buf;             /* sample history, frame_len */
+    unsigned fill;          /* samples in buf */
+    float *mag;             /* fft_len / 2 + 1 */
+    float *mel;             /* num_mels */
+};
+
+void mfcc_default_config(struct mfcc_config *cfg, unsigned sample_rate)
+{
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->sample_rate = sample_rate;
+    cfg->frame_len = sample_rate / 40;      /* 25 ms */
+    cfg->hop_len = sample_rate / 100;       /* 10 ms */
+    cfg->num_mels = 40;
+    cfg->num_ceps = 13;
+    cfg->f_min = 20.0f;
+}
+
+static double hz_to_mel(double f)
+{
+    return 2595.0 * log10(1.0 + f / 700.0);
+}
+
+static double mel_to_hz(double mel)
+{
+    return 700.0 * (pow(10.0, mel / 2595.0) - 1.0);
+}
+
+static float filter_weight(double f, double lo, double ce, double hi)
+{
+    if (f <= lo || f >= hi)
+        return 0.0f;
+    if (f <= ce)
+        return (float)((f - lo) / (ce - lo));
+    return (float)((hi - f) / (hi - ce));
+}
+
+static int build_filterbank(struct mfcc *m)
+{
+    const struct mfcc_config *cfg = &m->cfg;
+    const unsigned nbins = cfg->fft_len / 2 + 1;
+    const double bin_hz = (double)cfg->sample_rate / (double)cfg->fft_len;
+    double mel_lo = hz_to_mel(cfg->f_min), mel_hi = hz_to_mel(cfg->f_max);
+    double *edges;
+    size_t total = 0;
+    float *c;
+    unsigned i, k;
+
+    edges = malloc((cfg->num_mels + 2) * sizeof(double));
+    if (!edges)
+        return -1;
+    for (i = 0; i < cfg->num_mels + 2; i++)
+        edges[i] = mel_to_hz(mel_lo + (mel_hi - mel_lo) * i / (cfg->num_mels + 1));
+
+    /* First pass: extent of each filter */
+    for (i = 0; i < cfg->num_mels; i++) {
+        unsigned first = 0, last = 0, found = 0;
+
+        for (k = 0; k < nbins; k++) {
+            if (filter_weight(k * bin_hz, edges[i], edges[i + 1], edges[i + 2]) > 0.0f) {
+                if (!found)
+                    first = k;
+                last = k;
+                found = 1;
+            }
+        }
+        m->filter_pos[i] = first;
+        m->filter_len[i] = found ? last - first + 1 : 0;
+        total += m->filter_len[i];
+    }
+
+    m->filter_coefs = malloc((total + 1) * sizeof(float));
+    if (!m->filter_coefs) {
+        free(edges);
+        return -1;
+    }
+
+    c = m->filter_coefs;
+    for (i = 0; i < cfg->num_mels; i++) {
+        for (k = 0; k < m->filter_len[i]; k++)
+            *c++ = filter_weight((m->filter_pos[i] + k) * bin_hz,
+                                 edges[i], edges[i + 1], edges[i + 2]);
+    }
+
+    free(edges);
+    return 0;
+}
+
+struct mfcc *mfcc_create(const struct mfcc_config *cfg)
+{
+    struct mfcc *m;
+    unsigned i, j, nfft;
+
+    if (!cfg || cfg->sample_rate == 0 || cfg->frame_len == 0 ||
+        cfg->hop_len == 0 || cfg->hop_len > cfg->frame_len ||
+        cfg->num_mels == 0 || cfg->num_ceps > cfg->num_mels)
+        return NULL;
+
+    nfft = cfg->fft_len;
+    if (nfft == 0)
+        for (nfft = 8; nfft < cfg->frame_len; nfft *= 2)
+            ;
+    if (nfft < cfg->frame_len || nfft < 8 || (nfft & (nfft - 1)) != 0)
+        return NULL;
+
+    m = calloc(1, sizeof(*m));
+    if (!m)
+        return NULL;
+
+    m->cfg = *cfg;
+    m->cfg.fft_len = nfft;
+    if (m->cfg.f_max <= 0.0f || m->cfg.f_max > cfg->sample_rate / 2.0f)
+        m->cfg.f_max = cfg->sample_rate / 2.0f;
+    if (m->cfg.f_min < 0.0f || m->cfg.f_min >= m->cfg.f_max)
+        goto fail;
+    m->num_out = cfg->num_ceps ? cfg->num_ceps : cfg->num_mels;
+
+    if (rfft_init(&m->fft, nfft) != 0)
+        goto fail;
+
+    m->window = malloc(cfg->frame_len * sizeof(float));
+    m->filter_pos = malloc(cfg->num_mels * sizeof(uint32_t));
+    m->filter_len = malloc(cfg->num_mels * sizeof(uint32_t));
+    m->dct = malloc(((size_t)cfg->num_ceps * cfg->num_mels + 1) * sizeof(float));
+    m->buf = calloc(cfg->frame_len, sizeof(float));
+    m->mag = malloc((nfft / 2 + 1) * sizeof(float));
+    m->mel = malloc(cfg->num_mels * sizeof(float));
+    if (!m->window || !m->filter_pos || !m->filter_len || !m->dct ||
+        !m->buf || !m->mag || !m->mel)
+        goto fail;
+
+    /* Symmetric Hamming window */
+    for (i = 0; i < cfg->frame_len; i++)
+        m->window[i] = cfg->frame_len > 1
+            ? (float)(0.54 - 0.46 * cos(2.0 * MFCC_PI * i / (cfg->frame_len - 1)))
+            : 1.0f;
+
+    if (build_filterbank(m) != 0)
+        goto fail;
+
+    /* Orthonormal DCT-II */
+    for (i = 0; i < cfg->num_ceps; i++) {
+        double scale = sqrt((i == 0 ? 1.0 : 2.0) / cfg->num_mels);
+
+        for (j = 0; j < cfg->num_mels; j++)
+            m->dct[i * cfg->num_mels + j] =
+                (float)(scale * cos(MFCC_PI * i * (j + 0.5) / cfg->num_mels));
+    }
+
+    return m;
+
+fail:
+    mfcc_destroy(m);
+    return NULL;
+}
+
+void mfcc_destroy(struct mfcc *m)
+{
+    if (!m)
+        return;
+    rfft_free(&m->fft);
+    free(m->window);
+    free(m->filter_pos);
+    free(m->filter_len);
+    free(m->filter_coefs);
+    free(m->dct);
+    free(m->buf);
+    free(m->mag);
+    free(m->mel);
+    free(m);
+}
+
+unsigned mfcc_num_features(const struct mfcc *m)
+{
+    return m->num_out;
+}
+
+void mfcc_get_tables(const struct mfcc *m, struct mfcc_tables *t)
+{
+    t->window = m->window;
+    t->filter_pos = m->filter_pos;
+    t->filter_len = m->filter_len;
+    t->filter_coefs = m->filter_coefs;
+    t->dct = m->dct;
+    t->fft_len = m->cfg.fft_len;
+}
+
+/* ============================================
+   Per-frame kernels
+   ============================================ */
+
+/* Window the frame into the packed FFT input; returns max|x| */
+static float window_pack(struct mfcc *m, const float *x)
+{
+    const unsigned len = m->cfg.frame_len, half = m->fft.m;
+    const float *w = m->window;
+    float *re = m->fft.re, *im = m->fft.im;
+    float peak = 0.0f;
+    unsigned i = 0, j;
+
+#if defined(DSP_NEON)
+    float32x4_t vpeak = vdupq_n_f32(0.0f);
+
+    for (; i + 8 <= len; i += 8) {
+        float32x4x2_t xv = vld2q_f32(x + i);
+        float32x4x2_t wv = vld2q_f32(w + i);
+
+        vpeak = vmaxq_f32(vpeak, vmaxq_f32(vabsq_f32(xv.val[0]), vabsq_f32(xv.val[1])));
+        vst1q_f32(re + i / 2, vmulq_f32(xv.val[0], wv.val[0]));
+        vst1q_f32(im + i / 2, vmulq_f32(xv.val[1], wv.val[1]));
+    }
+    peak = vmaxvq_f32(vpeak);
+#endif
+
+    for (; i + 2 <= len; i += 2) {
+        float a = fabsf(x[i]), b = fabsf(x[i + 1]);
+
+        peak = a > peak ? a : peak;
+        peak = b > peak ? b : peak;
+        re[i / 2] = x[i] * w[i];
+        im[i / 2] = x[i + 1] * w[i + 1];
+    }
+
+    j = i / 2;
+    if (i < len) {
+        float a = fabsf(x[i]);
+
+        peak = a > peak ? a : peak;
+        re[j] = x[i] * w[i];
+        im[j] = 0.0f;
+        j++;
+    }
+
+    /* Zero padding up to fft_len */
+    memset(re + j, 0, (half - j) * sizeof(float));
+    memset(im + j, 0, (half - j) * sizeof(float));
+
+    return peak;
+}
+
+static float dot(const float *a, const float *b, unsigned n)
+{
+    float sum = 0.0f;
+    unsigned i = 0;
+
+#if defined(DSP_NEON)
+    float32x4_t acc = vdupq_n_f32(0.0f);
+
+    for (; i + 4 <= n; i += 4)
+        acc = vfmaq_f32(acc, vld1q_f32(a + i), vld1q_f32(b + i));
+    sum = vaddvq_f32(acc);
+#endif
+
+    for (; i < n; i++)
+        sum += a[i] * b[i];
+
+    return sum;
+}
+
+#if defined(DSP_NEON)
+
+/* Natural log for x > 0 (Cephes logf polynomial), four lanes */
+static inline float32x4_t log_f32x4(float32x4_t x)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    int32x4_t bits = vreinterpretq_s32_f32(x);
+    float32x4_t e, z, y, tmp;
+    uint32x4_t small;
+
+    /* x = mant * 2^e with mant in [0.5, 1) */
+    e = vcvtq_f32_s32(vsubq_s32(vshrq_n_s32(bits, 23), vdupq_n_s32(126)));
+    bits = vandq_s32(bits, vdupq_n_s32(0x007fffff));
+    bits = vorrq_s32(bits, vdupq_n_s32(0x3f000000));
+    x = vreinterpretq_f32_s32(bits);
+
+    /* Move mant into [sqrt(1/2), sqrt(2)) and subtract 1 */
+    small = vcltq_f32(x, vdupq_n_f32(0.707106781186547524f));
+    tmp = vbslq_f32(small, x, vdupq_n_f32(0.0f));
+    x = vsubq_f32(x, one);
+    e = vsubq_f32(e, vbslq_f32(small, one, vdupq_n_f32(0.0f)));
+    x = vaddq_f32(x, tmp);
+
+    z = vmulq_f32(x, x);
+    y = vdupq_n_f32(7.0376836292e-2f);
+    y = vfmaq_f32(vdupq_n_f32(-1.1514610310e-1f), y, x);
+    y = vfmaq_f32(vdupq_n_f32(1.1676998740e-1f), y, x);
+    y = vfmaq_f32(vdupq_n_f32(-1.2420140846e-1f), y, x);
+    y = vfmaq_f32(vdupq_n_f32(1.4249322787e-1f), y, x);
+    y = vfmaq_f32(vdupq_n_f32(-1.6668057665e-1f), y, x);
+    y = vfmaq_f32(vdupq_n_f32(2.0000714765e-1f), y, x);
+    y = vfmaq_f32(vdupq_n_f32(-2.4999993993e-1f), y, x);
+    y = vfmaq_f32(vdupq_n_f32(3.3333331174e-1f), y, x);
+    y = vmulq_f32(vmulq_f32(y, x), z);
+
+    y = vfmaq_f32(y, e, vdupq_n_f32(-2.12194440e-4f));
+    y = vfmaq_f32(y, z, vdupq_n_f32(-0.5f));
+    x = vaddq_f32(x, y);
+    return vfmaq_f32(x, e, vdupq_n_f32(0.693359375f));
+}
+
+#endif /* DSP_NEON */
+
+/* dst = log(src * scale + offset) */
+static void scaled_log(const float *src, float scale, float *dst, unsigned n)
+{
+    unsigned i = 0;
+
+#if defined(DSP_NEON)
+    const float32x4_t off = vdupq_n_f32(MFCC_LOG_OFFSET);
+
+    for (; i + 4 <= n; i += 4)
+        vst1q_f32(dst + i, log_f32x4(vfmaq_n_f32(off, vld1q_f32(src + i), scale)));
+#endif
+
+    for (; i < n; i++)
+        dst[i] = logf(src[i] * scale + MFCC_LOG_OFFSET);
+}
+
+static void frame_features(struct mfcc *m, const float *x, float *out)
+{
+    const struct mfcc_config *cfg = &m->cfg;
+    const float *coefs = m->filter_coefs;
+    float peak, scale = 1.0f;
+    unsigned i;
+
+    peak = window_pack(m, x);
+    if (cfg->normalize && peak > 0.0f)
+        scale = 1.0f / peak;
+
+    rfft_mag(&m->fft, m->mag);
+
+    for (i = 0; i < cfg->num_mels; i++) {
+        m->mel[i] = dot(m->mag + m->filter_pos[i], coefs, m->filter_len[i]);
+        coefs += m->filter_len[i];
+    }
+
+    if (cfg->num_ceps == 0) {
+        scaled_log(m->mel, scale, out, cfg->num_mels);
+        return;
+    }
+
+    scaled_log(m->mel, scale, m->mel, cfg->num_mels);
+    for (i = 0; i < cfg->num_ceps; i++)
+        out[i] = dot(m->dct + (size_t)i * cfg->num_mels, m->mel, cfg->num_mels);
+}
+
+/* ============================================
+   Streaming
+   ============================================ */
+
+size_t mfcc_frames_for(const struct mfcc *m, size_t n)
+{
+    size_t avail = m->fill + n;
+
+    if (avail < m->cfg.frame_len)
+        return 0;
+    return 1 + (avail - m->cfg.frame_len) / m->cfg.hop_len;
+}
+
+/* Exactly one of f32 / s16 is non-NULL */
+static size_t process(struct mfcc *m, const float *f32, const int16_t *s16,
+                      size_t n, float *out)
+{
+    const unsigned len = m->cfg.frame_len, keep = len - m->cfg.hop_len;
+    size_t frames = 0;
+
+    while (n > 0) {
+        size_t take = len - m->fill;
+        float *dst = m->buf + m->fill;
+        size_t i;
+
+        if (take > n)
+            take = n;
+        if (f32) {
+            memcpy(dst, f32, take * sizeof(float));
+            f32 += take;
+        } else {
+            for (i = 0; i < take; i++)
+                dst[i] = s16[i] * (1.0f / 32768.0f);
+            s16 += take;
+        }
+        m->fill += take;
+        n -= take;
+
+        if (m->fill == len) {
+            frame_features(m, m->buf, out);
+            out += m->num_out;
+            frames++;
+            memmove(m->buf, m->buf + m->cfg.hop_len, keep * sizeof(float));
+            m->fill = keep;
+        }
+    }
+
+    return frames;
+}
+
+size_t mfcc_process(struct mfcc *m, const float *pcm, size_t n, float *out)
+{
+    return process(m, pcm, NULL, n, out);
+}
+
+size_t mfcc_process_s16(struct mfcc *m, const int16_t *pcm, size_t n, float *out)
+{
+    return process(m, NULL, pcm, n, out);
+}
+
+void mfcc_reset(struct mfcc *m)
+{
+    m->fill = 0;
+}
+
+void mfcc_compute(struct mfcc *m, const float *frame, float *out)
+{
+    frame_features(m, frame, out);
+}
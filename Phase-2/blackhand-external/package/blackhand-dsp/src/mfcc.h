@@ -0,0 +1,71 @@
+/*
+ * MFCC / log-mel feature extraction for the STT service.
+ *
+ * Streaming front end: push PCM as it arrives and get one feature
+ * vector per hop (10 ms by default) over overlapping analysis frames
+ * (25 ms by default). All memory is allocated by mfcc_create(); the
+ * process calls never allocate.
+ *
+ * Per frame: Hamming window, real FFT, magnitude, triangular mel
+ * filterbank (HTK mel scale), natural log and, when num_ceps is set,
+ * an orthonormal DCT-II. This is the arm_mfcc_f32 pipeline from
+ * CMSIS-DSP with the stages fused, and Neon paths on AArch64.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct mfcc_config {
+    unsigned sample_rate;   /* Hz */
+    unsigned frame_len;     /* samples per analysis frame */
+    unsigned hop_len;       /* samples between frame starts, <= frame_len */
+    unsigned fft_len;       /* power of two >= frame_len, 0 = smallest one */
+    unsigned num_mels;      /* mel filters */
+    unsigned num_ceps;      /* DCT outputs, 0 = output log-mel energies */
+    float f_min;            /* lower filterbank edge, Hz */
+    float f_max;            /* upper filterbank edge, Hz, 0 = sample_rate / 2 */
+    int normalize;          /* scale each frame by 1 / max|x| like arm_mfcc_f32 */
+};
+
+/* Tables the extractor was built with, e.g. to set up arm_mfcc_f32 */
+struct mfcc_tables {
+    const float *window;            /* frame_len */
+    const uint32_t *filter_pos;     /* num_mels, first FFT bin of each filter */
+    const uint32_t *filter_len;     /* num_mels */
+    const float *filter_coefs;      /* filters back to back */
+    const float *dct;               /* num_ceps x num_mels, row-major */
+    unsigned fft_len;
+};
+
+struct mfcc;
+
+/* 25 ms / 10 ms frames, 40 mel filters, 13 coefficients */
+void mfcc_default_config(struct mfcc_config *cfg, unsigned sample_rate);
+
+/* Returns NULL on a bad configuration or ENOMEM */
+struct mfcc *mfcc_create(const struct mfcc_config *cfg);
+void mfcc_destroy(struct mfcc *m);
+
+/* Values per output frame: num_ceps, or num_mels when num_ceps is 0 */
+unsigned mfcc_num_features(const struct mfcc *m);
+
+/* Frames the next mfcc_process*() call will emit for n more samples */
+size_t mfcc_frames_for(const struct mfcc *m, size_t n);
+
+/*
+ * Append n samples and write every completed frame to out
+ * (mfcc_num_features() floats each). Returns the number of frames.
+ * Size out with mfcc_frames_for().
+ */
+size_t mfcc_process(struct mfcc *m, const float *pcm, size_t n, float *out);
+size_t mfcc_process_s16(struct mfcc *m, const int16_t *pcm, size_t n, float *out);
+
+/* Drop buffered samples, e.g. at the start of a new utterance */
+void mfcc_reset(struct mfcc *m);
+
+/* Features of one frame_len frame, outside the stream */
+void mfcc_compute(struct mfcc *m, const float *frame, float *out);
+
+void mfcc_get_tables(const struct mfcc *m, struct mfcc_tables *t);
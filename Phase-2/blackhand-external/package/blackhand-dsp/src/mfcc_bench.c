@@ -0,0 +1,142 @@
+/*
+ * Throughput benchmark for the feature extractor.
+ * Streams synthetic 16-bit audio through mfcc_process_s16() in 10 ms
+ * chunks, as a capture loop would deliver it, and reports time per frame
+ * and the real-time factor. Build with -DDSP_NO_NEON to time the generic
+ * path.
+ *
+ *   mfcc-bench [--rate HZ] [--seconds S] [--runs N]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "dsp_neon.h"
+#include "mfcc.h"
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Chirp plus a little noise, so every band has some energy */
+static void make_signal(int16_t *pcm, size_t n, unsigned rate)
+{
+    unsigned seed = 1;
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        double t = (double)i / rate;
+        double f = 100.0 + (rate / 2.0 - 200.0) * fmod(t, 1.0);
+        double v = 0.5 * sin(2.0 * 3.14159265358979 * f * t);
+
+        seed = seed * 1103515245u + 12345u;
+        v += 0.05 * ((double)((seed >> 16) & 0x7fff) / 16384.0 - 1.0);
+        pcm[i] = (int16_t)(v * 32767.0);
+    }
+}
+
+static void run(const char *name, const struct mfcc_config *cfg,
+                const int16_t *pcm, size_t n, unsigned runs)
+{
+    struct mfcc *m = mfcc_create(cfg);
+    struct mfcc_tables t;
+    size_t chunk = cfg->hop_len, frames = 0, pos, max_frames;
+    double best = 1e30;
+    float *out;
+    unsigned r;
+
+    if (!m) {
+        fprintf(stderr, "%s: bad configuration\n", name);
+        exit(1);
+    }
+
+    mfcc_get_tables(m, &t);
+    max_frames = mfcc_frames_for(m, chunk) + 1;
+    out = malloc(max_frames * mfcc_num_features(m) * sizeof(float));
+    if (!out) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+
+    for (r = 0; r < runs; r++) {
+        double t0;
+
+        mfcc_reset(m);
+        frames = 0;
+        t0 = now_s();
+        for (pos = 0; pos + chunk <= n; pos += chunk)
+            frames += mfcc_process_s16(m, pcm + pos, chunk, out);
+        t0 = now_s() - t0;
+        if (t0 < best)
+            best = t0;
+    }
+
+    printf("%-8s %5u Hz  frame %4u  hop %4u  fft %4u  mels %2u  ceps %2u  "
+           "%8.2f us/frame  %8.1fx real time\n",
+           name, cfg->sample_rate, cfg->frame_len, cfg->hop_len,
+           t.fft_len, cfg->num_mels, cfg->num_ceps,
+           best * 1e6 / frames, ((double)n / cfg->sample_rate) / best);
+
+    free(out);
+    mfcc_destroy(m);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned rate = 16000, runs = 5;
+    double seconds = 10.0;
+    struct mfcc_config cfg;
+    int16_t *pcm;
+    size_t n;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--rate") && i + 1 < argc)
+            rate = (unsigned)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--seconds") && i + 1 < argc)
+            seconds = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--runs") && i + 1 < argc)
+            runs = (unsigned)atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [--rate HZ] [--seconds S] [--runs N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (rate < 8000 || seconds <= 0.0 || runs == 0) {
+        fprintf(stderr, "bad arguments\n");
+        return 2;
+    }
+
+#if defined(DSP_NEON)
+    printf("# code path: neon\n");
+#else
+    printf("# code path: generic\n");
+#endif
+
+    n = (size_t)(seconds * rate);
+    pcm = malloc(n * sizeof(int16_t));
+    if (!pcm) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    make_signal(pcm, n, rate);
+
+    mfcc_default_config(&cfg, rate);
+    run("mfcc", &cfg, pcm, n, runs);
+
+    cfg.num_ceps = 0;
+    run("log-mel", &cfg, pcm, n, runs);
+
+    cfg.num_mels = 80;
+    run("log-mel", &cfg, pcm, n, runs);
+
+    free(pcm);
+    return 0;
+}
@@ -0,0 +1,238 @@
+/*
+ * Validate the feature extractor against arm_mfcc_f32 from CMSIS-DSP.
+ *
+ * arm_mfcc_f32 is set up with the extractor's own tables (window padded
+ * with zeros to fft_len, mel filters, DCT), so any difference comes from
+ * the fused computation. Log-mel output is checked the same way with an
+ * identity DCT. The streaming entry points are checked against
+ * mfcc_compute() on the same frames. Also reports the time per frame of
+ * both implementations.
+ *
+ * Built and run by "make check" on a host with the Phase-1 tree.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "arm_math.h"
+#include "dsp_neon.h"
+#include "mfcc.h"
+
+#define TOLERANCE 1e-4      /* max error relative to the largest output */
+
+struct check_case {
+    unsigned rate, frame, hop, fft, mels, ceps;
+};
+
+static const struct check_case cases[] = {
+    { 16000, 400, 160,  512, 40, 13 },
+    { 16000, 400, 160,  512, 40,  0 },
+    { 16000, 400, 160,  512, 80,  0 },
+    { 16000, 512, 256,  512, 40, 20 },
+    { 16000, 480, 160, 1024, 64, 13 },
+    {  8000, 200,  80,  256, 23, 13 },
+    { 44100, 1102, 441, 2048, 40, 13 },
+};
+
+static unsigned seed = 12345;
+
+static float frand(void)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (float)((seed >> 8) & 0xffff) / 32768.0f - 1.0f;
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void fill_frame(float *x, unsigned n, unsigned rate)
+{
+    double f = 80.0 + (rate / 2.0 - 160.0) * (frand() * 0.5 + 0.5);
+    float amp = 0.1f + 0.8f * (frand() * 0.5f + 0.5f);
+    unsigned i;
+
+    for (i = 0; i < n; i++)
+        x[i] = amp * (float)sin(2.0 * 3.14159265358979 * f * i / rate) + 0.05f * frand();
+}
+
+static double max_abs(const float *x, unsigned n)
+{
+    double m = 0.0;
+    unsigned i;
+
+    for (i = 0; i < n; i++)
+        if (fabs(x[i]) > m)
+            m = fabs(x[i]);
+    return m;
+}
+
+static int check_case(const struct check_case *c)
+{
+    const unsigned frames = 200;
+    struct mfcc_config cfg;
+    struct mfcc_tables t;
+    struct mfcc *m;
+    arm_mfcc_instance_f32 ref;
+    unsigned nout, nfft, i, f;
+    float *win, *dct = NULL, *src, *tmp, *sig, *out, *expect, *stream;
+    const float *dct_coefs;
+    double err = 0.0, scale = 0.0, t_ref = 0.0, t_fused = 0.0, t0;
+    size_t n, got, pos;
+    int16_t *pcm;
+    int fail = 0;
+
+    mfcc_default_config(&cfg, c->rate);
+    cfg.frame_len = c->frame;
+    cfg.hop_len = c->hop;
+    cfg.fft_len = c->fft;
+    cfg.num_mels = c->mels;
+    cfg.num_ceps = c->ceps;
+    cfg.normalize = 1;
+
+    m = mfcc_create(&cfg);
+    if (!m) {
+        printf("FAIL  config rejected\n");
+        return 1;
+    }
+    mfcc_get_tables(m, &t);
+    nfft = t.fft_len;
+    nout = mfcc_num_features(m);
+
+    /* Reference: window padded to fft_len, identity DCT for log-mel */
+    win = calloc(nfft, sizeof(float));
+    memcpy(win, t.window, c->frame * sizeof(float));
+    dct_coefs = t.dct;
+    if (c->ceps == 0) {
+        dct = calloc((size_t)c->mels * c->mels, sizeof(float));
+        for (i = 0; i < c->mels; i++)
+            dct[i * c->mels + i] = 1.0f;
+        dct_coefs = dct;
+    }
+    if (arm_mfcc_init_f32(&ref, nfft, c->mels, nout, dct_coefs,
+                          t.filter_pos, t.filter_len, t.filter_coefs, win) != ARM_MATH_SUCCESS) {
+        printf("FAIL  arm_mfcc_init_f32\n");
+        return 1;
+    }
+
+    /* arm_cmplx_mag_f32 in arm_mfcc_f32 reads fft_len complex values */
+    src = calloc(nfft, sizeof(float));
+    tmp = calloc(2 * nfft + 2, sizeof(float));
+    sig = malloc((size_t)frames * c->frame * sizeof(float));
+    out = malloc(nout * sizeof(float));
+    expect = malloc((size_t)frames * nout * sizeof(float));
+
+    for (f = 0; f < frames; f++) {
+        float *x = sig + (size_t)f * c->frame;
+
+        fill_frame(x, c->frame, c->rate);
+
+        memset(src, 0, nfft * sizeof(float));
+        memcpy(src, x, c->frame * sizeof(float));
+        t0 = now_s();
+        arm_mfcc_f32(&ref, src, expect + (size_t)f * nout, tmp);
+        t_ref += now_s() - t0;
+
+        t0 = now_s();
+        mfcc_compute(m, x, out);
+        t_fused += now_s() - t0;
+
+        for (i = 0; i < nout; i++) {
+            double d = fabs((double)out[i] - expect[(size_t)f * nout + i]);
+
+            if (d > err)
+                err = d;
+        }
+        if (max_abs(expect + (size_t)f * nout, nout) > scale)
+            scale = max_abs(expect + (size_t)f * nout, nout);
+    }
+    if (err > TOLERANCE * scale)
+        fail = 1;
+
+    printf("%s  %5u Hz  frame %4u  fft %4u  mels %2u  ceps %2u  "
+           "err %.2e (of %.1f)  arm_mfcc_f32 %7.2f us  fused %7.2f us  %.2fx\n",
+           fail ? "FAIL" : "ok  ", c->rate, c->frame, nfft, c->mels, c->ceps,
+           err, scale, t_ref * 1e6 / frames, t_fused * 1e6 / frames, t_ref / t_fused);
+
+    /*
+     * Streaming: the signal fed in odd-sized chunks must give exactly
+     * mfcc_compute() of each hop-spaced frame, for f32 and s16 input.
+     */
+    n = (size_t)frames * c->frame;
+    pcm = malloc(n * sizeof(int16_t));
+    for (pos = 0; pos < n; pos++) {
+        pcm[pos] = (int16_t)(sig[pos] * 32767.0f);
+        sig[pos] = pcm[pos] * (1.0f / 32768.0f);
+    }
+    stream = malloc((mfcc_frames_for(m, n) + 1) * nout * sizeof(float));
+
+    for (i = 0; i < 2; i++) {
+        size_t total = 0, frame_count = (n - c->frame) / c->hop + 1;
+        unsigned chunk = 1;
+
+        mfcc_reset(m);
+        for (pos = 0; pos < n; pos += chunk, chunk = chunk * 7 % 1021 + 1) {
+            size_t len = n - pos < chunk ? n - pos : chunk;
+
+            if (mfcc_frames_for(m, len) + total > frame_count) {
+                printf("FAIL  mfcc_frames_for overshoots\n");
+                fail = 1;
+                break;
+            }
+            got = i ? mfcc_process_s16(m, pcm + pos, len, stream + total * nout)
+                    : mfcc_process(m, sig + pos, len, stream + total * nout);
+            total += got;
+        }
+        if (total != frame_count) {
+            printf("FAIL  %s stream gave %zu frames, expected %zu\n",
+                   i ? "s16" : "f32", total, frame_count);
+            fail = 1;
+            continue;
+        }
+        for (f = 0; f < frame_count; f++) {
+            mfcc_compute(m, sig + (size_t)f * c->hop, out);
+            if (memcmp(out, stream + (size_t)f * nout, nout * sizeof(float)) != 0) {
+                printf("FAIL  %s stream frame %u differs\n", i ? "s16" : "f32", f);
+                fail = 1;
+                break;
+            }
+        }
+    }
+
+    free(pcm);
+    free(stream);
+    free(win);
+    free(dct);
+    free(src);
+    free(tmp);
+    free(sig);
+    free(out);
+    free(expect);
+    mfcc_destroy(m);
+    return fail;
+}
+
+int main(void)
+{
+    unsigned i;
+    int fail = 0;
+
+#if defined(DSP_NEON)
+    printf("# code path: neon\n");
+#else
+    printf("# code path: generic\n");
+#endif
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+        fail |= check_case(&cases[i]);
+
+    printf(fail ? "FAILED\n" : "all passed\n");
+    return fail;
+}
@@ -0,0 +1,317 @@
+/*
+ * Real FFT for the feature extractor.
+ *
+ * The n/2-point complex FFT runs as radix-4 Stockham passes (plus one
+ * radix-2 pass when log2(n/2) is odd) on split re/im arrays, so every
+ * pass reads and writes contiguous runs and the output comes out in
+ * natural order. The real unpack and the magnitude are done together.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp_neon.h"
+#include "rfft.h"
+
+#define RFFT_PI 3.14159265358979323846
+
+int rfft_init(struct rfft *f, unsigned n)
+{
+    unsigned m = n / 2;
+    unsigned len, p, k;
+    size_t ntw = 0;
+    float *tw;
+
+    memset(f, 0, sizeof(*f));
+    if (n < 8 || (n & (n - 1)) != 0)
+        return -1;
+
+    f->n = n;
+    f->m = m;
+
+    for (len = m; len >= 4; len /= 4)
+        ntw += 6 * (len / 4);
+
+    f->tw = malloc((ntw + 1) * sizeof(float));
+    f->split_c = malloc((m + 1) * sizeof(float));
+    f->split_s = malloc((m + 1) * sizeof(float));
+    f->re = malloc(4 * (size_t)m * sizeof(float));
+    if (!f->tw || !f->split_c || !f->split_s || !f->re) {
+        rfft_free(f);
+        return -1;
+    }
+    f->im = f->re + m;
+    f->wr = f->re + 2 * m;
+    f->wi = f->re + 3 * m;
+
+    /* Per pass: w^p, w^2p, w^3p for p < len/4, as re/im rows */
+    tw = f->tw;
+    for (len = m; len >= 4; len /= 4) {
+        unsigned q = len / 4;
+
+        for (p = 0; p < q; p++) {
+            for (k = 1; k <= 3; k++) {
+                double a = -2.0 * RFFT_PI * (double)(k * p) / (double)len;
+
+                tw[(2 * (k - 1)) * q + p] = (float)cos(a);
+                tw[(2 * (k - 1) + 1) * q + p] = (float)sin(a);
+            }
+        }
+        tw += 6 * q;
+    }
+
+    for (k = 0; k <= m; k++) {
+        double a = 2.0 * RFFT_PI * (double)k / (double)n;
+
+        f->split_c[k] = (float)(0.5 * cos(a));
+        f->split_s[k] = (float)(0.5 * sin(a));
+    }
+
+    return 0;
+}
+
+void rfft_free(struct rfft *f)
+{
+    free(f->tw);
+    free(f->split_c);
+    free(f->split_s);
+    free(f->re);
+    memset(f, 0, sizeof(*f));
+}
+
+#if defined(DSP_NEON)
+
+/* Radix-4 butterfly on four lanes, outputs before the twiddles */
+#define BFLY4(ar, ai, br, bi, cr, ci, dr, di, y0r, y0i, t1r, t1i, t2r, t2i, t3r, t3i) \
+    do {                                                                           \
+        float32x4_t apc_r = vaddq_f32(ar, cr), apc_i = vaddq_f32(ai, ci);          \
+        float32x4_t amc_r = vsubq_f32(ar, cr), amc_i = vsubq_f32(ai, ci);          \
+        float32x4_t bpd_r = vaddq_f32(br, dr), bpd_i = vaddq_f32(bi, di);          \
+        float32x4_t bmd_r = vsubq_f32(br, dr), bmd_i = vsubq_f32(bi, di);          \
+        y0r = vaddq_f32(apc_r, bpd_r);                                             \
+        y0i = vaddq_f32(apc_i, bpd_i);                                             \
+        t1r = vaddq_f32(amc_r, bmd_i);                                             \
+        t1i = vsubq_f32(amc_i, bmd_r);                                             \
+        t2r = vsubq_f32(apc_r, bpd_r);                                             \
+        t2i = vsubq_f32(apc_i, bpd_i);                                             \
+        t3r = vsubq_f32(amc_r, bmd_i);                                             \
+        t3i = vaddq_f32(amc_i, bmd_r);                                             \
+    } while (0)
+
+static inline float32x4_t cmul_re(float32x4_t xr, float32x4_t xi,
+                                  float32x4_t wr, float32x4_t wi)
+{
+    return vfmsq_f32(vmulq_f32(xr, wr), xi, wi);
+}
+
+static inline float32x4_t cmul_im(float32x4_t xr, float32x4_t xi,
+                                  float32x4_t wr, float32x4_t wi)
+{
+    return vfmaq_f32(vmulq_f32(xr, wi), xi, wr);
+}
+
+static inline float32x4_t reverse(float32x4_t v)
+{
+    v = vrev64q_f32(v);
+    return vextq_f32(v, v, 2);
+}
+
+#endif /* DSP_NEON */
+
+/* One radix-4 pass: n = sub-transform length, s = stride */
+static void pass4(unsigned n, unsigned s, const float *tw,
+                  const float *xr, const float *xi, float *yr, float *yi)
+{
+    const unsigned n1 = n / 4;
+    const size_t st = (size_t)s * n1;
+    const float *w1r = tw, *w1i = tw + n1;
+    const float *w2r = tw + 2 * n1, *w2i = tw + 3 * n1;
+    const float *w3r = tw + 4 * n1, *w3i = tw + 5 * n1;
+    unsigned p, q;
+
+#if defined(DSP_NEON)
+    if (s == 1 && (n1 & 3) == 0) {
+        /* First pass: lanes run over p, vst4 interleaves the four outputs */
+        for (p = 0; p < n1; p += 4) {
+            float32x4_t ar = vld1q_f32(xr + p), ai = vld1q_f32(xi + p);
+            float32x4_t br = vld1q_f32(xr + p + st), bi = vld1q_f32(xi + p + st);
+            float32x4_t cr = vld1q_f32(xr + p + 2 * st), ci = vld1q_f32(xi + p + 2 * st);
+            float32x4_t dr = vld1q_f32(xr + p + 3 * st), di = vld1q_f32(xi + p + 3 * st);
+            float32x4_t y0r, y0i, t1r, t1i, t2r, t2i, t3r, t3i;
+            float32x4_t wr, wi;
+            float32x4x4_t or_, oi;
+
+            BFLY4(ar, ai, br, bi, cr, ci, dr, di,
+                  y0r, y0i, t1r, t1i, t2r, t2i, t3r, t3i);
+
+            or_.val[0] = y0r;
+            oi.val[0] = y0i;
+            wr = vld1q_f32(w1r + p);
+            wi = vld1q_f32(w1i + p);
+            or_.val[1] = cmul_re(t1r, t1i, wr, wi);
+            oi.val[1] = cmul_im(t1r, t1i, wr, wi);
+            wr = vld1q_f32(w2r + p);
+            wi = vld1q_f32(w2i + p);
+            or_.val[2] = cmul_re(t2r, t2i, wr, wi);
+            oi.val[2] = cmul_im(t2r, t2i, wr, wi);
+            wr = vld1q_f32(w3r + p);
+            wi = vld1q_f32(w3i + p);
+            or_.val[3] = cmul_re(t3r, t3i, wr, wi);
+            oi.val[3] = cmul_im(t3r, t3i, wr, wi);
+
+            vst4q_f32(yr + 4 * p, or_);
+            vst4q_f32(yi + 4 * p, oi);
+        }
+        return;
+    }
+
+    if ((s & 3) == 0) {
+        /* Later passes: lanes run over q, twiddles are broadcast */
+        for (p = 0; p < n1; p++) {
+            const float32x4_t w1r_v = vdupq_n_f32(w1r[p]), w1i_v = vdupq_n_f32(w1i[p]);
+            const float32x4_t w2r_v = vdupq_n_f32(w2r[p]), w2i_v = vdupq_n_f32(w2i[p]);
+            const float32x4_t w3r_v = vdupq_n_f32(w3r[p]), w3i_v = vdupq_n_f32(w3i[p]);
+            const float *ar_p = xr + (size_t)s * p, *ai_p = xi + (size_t)s * p;
+            float *or_p = yr + 4 * (size_t)s * p, *oi_p = yi + 4 * (size_t)s * p;
+
+            for (q = 0; q < s; q += 4) {
+                float32x4_t ar = vld1q_f32(ar_p + q), ai = vld1q_f32(ai_p + q);
+                float32x4_t br = vld1q_f32(ar_p + q + st), bi = vld1q_f32(ai_p + q + st);
+                float32x4_t cr = vld1q_f32(ar_p + q + 2 * st), ci = vld1q_f32(ai_p + q + 2 * st);
+                float32x4_t dr = vld1q_f32(ar_p + q + 3 * st), di = vld1q_f32(ai_p + q + 3 * st);
+                float32x4_t y0r, y0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+                BFLY4(ar, ai, br, bi, cr, ci, dr, di,
+                      y0r, y0i, t1r, t1i, t2r, t2i, t3r, t3i);
+
+                vst1q_f32(or_p + q, y0r);
+                vst1q_f32(oi_p + q, y0i);
+                vst1q_f32(or_p + s + q, cmul_re(t1r, t1i, w1r_v, w1i_v));
+                vst1q_f32(oi_p + s + q, cmul_im(t1r, t1i, w1r_v, w1i_v));
+                vst1q_f32(or_p + 2 * s + q, cmul_re(t2r, t2i, w2r_v, w2i_v));
+                vst1q_f32(oi_p + 2 * s + q, cmul_im(t2r, t2i, w2r_v, w2i_v));
+                vst1q_f32(or_p + 3 * s + q, cmul_re(t3r, t3i, w3r_v, w3i_v));
+                vst1q_f32(oi_p + 3 * s + q, cmul_im(t3r, t3i, w3r_v, w3i_v));
+            }
+        }
+        return;
+    }
+#endif /* DSP_NEON */
+
+    for (p = 0; p < n1; p++) {
+        const float c1r = w1r[p], c1i = w1i[p];
+        const float c2r = w2r[p], c2i = w2i[p];
+        const float c3r = w3r[p], c3i = w3i[p];
+        const float *ar_p = xr + (size_t)s * p, *ai_p = xi + (size_t)s * p;
+        float *or_p = yr + 4 * (size_t)s * p, *oi_p = yi + 4 * (size_t)s * p;
+
+        for (q = 0; q < s; q++) {
+            float apc_r = ar_p[q] + ar_p[q + 2 * st];
+            float apc_i = ai_p[q] + ai_p[q + 2 * st];
+            float amc_r = ar_p[q] - ar_p[q + 2 * st];
+            float amc_i = ai_p[q] - ai_p[q + 2 * st];
+            float bpd_r = ar_p[q + st] + ar_p[q + 3 * st];
+            float bpd_i = ai_p[q + st] + ai_p[q + 3 * st];
+            float bmd_r = ar_p[q + st] - ar_p[q + 3 * st];
+            float bmd_i = ai_p[q + st] - ai_p[q + 3 * st];
+            float t1r = amc_r + bmd_i, t1i = amc_i - bmd_r;
+            float t2r = apc_r - bpd_r, t2i = apc_i - bpd_i;
+            float t3r = amc_r - bmd_i, t3i = amc_i + bmd_r;
+
+            or_p[q] = apc_r + bpd_r;
+            oi_p[q] = apc_i + bpd_i;
+            or_p[q + s] = t1r * c1r - t1i * c1i;
+            oi_p[q + s] = t1r * c1i + t1i * c1r;
+            or_p[q + 2 * s] = t2r * c2r - t2i * c2i;
+            oi_p[q + 2 * s] = t2r * c2i + t2i * c2r;
+            or_p[q + 3 * s] = t3r * c3r - t3i * c3i;
+            oi_p[q + 3 * s] = t3r * c3i + t3i * c3r;
+        }
+    }
+}
+
+/* Last radix-2 pass (sub-transform length 2, no twiddles) */
+static void pass2(unsigned s, const float *xr, const float *xi, float *yr, float *yi)
+{
+    unsigned q = 0;
+
+#if defined(DSP_NEON)
+    for (; q + 4 <= s; q += 4) {
+        float32x4_t ar = vld1q_f32(xr + q), ai = vld1q_f32(xi + q);
+        float32x4_t br = vld1q_f32(xr + q + s), bi = vld1q_f32(xi + q + s);
+
+        vst1q_f32(yr + q, vaddq_f32(ar, br));
+        vst1q_f32(yi + q, vaddq_f32(ai, bi));
+        vst1q_f32(yr + q + s, vsubq_f32(ar, br));
+        vst1q_f32(yi + q + s, vsubq_f32(ai, bi));
+    }
+#endif
+
+    for (; q < s; q++) {
+        float ar = xr[q], ai = xi[q], br = xr[q + s], bi = xi[q + s];
+
+        yr[q] = ar + br;
+        yi[q] = ai + bi;
+        yr[q + s] = ar - br;
+        yi[q + s] = ai - bi;
+    }
+}
+
+void rfft_mag(struct rfft *f, float *mag)
+{
+    const unsigned m = f->m;
+    const float *tw = f->tw;
+    const float *sc = f->split_c, *ss = f->split_s;
+    float *xr = f->re, *xi = f->im, *yr = f->wr, *yi = f->wi, *t;
+    unsigned n = m, s = 1, k;
+
+    /* Complex FFT of the packed input, ping-ponging between buffers */
+    while (n >= 4) {
+        pass4(n, s, tw, xr, xi, yr, yi);
+        tw += 6 * (n / 4);
+        t = xr; xr = yr; yr = t;
+        t = xi; xi = yi; yi = t;
+        n /= 4;
+        s *= 4;
+    }
+    if (n == 2) {
+        pass2(s, xr, xi, yr, yi);
+        xr = yr;
+        xi = yi;
+    }
+
+    /*
+     * X[k] = (Z[k] + conj(Z[m-k])) / 2 - j w^k (Z[k] - conj(Z[m-k])) / 2
+     * with w = exp(-2 pi j / n); bins 0 and m only use Z[0].
+     */
+    mag[0] = fabsf(xr[0] + xi[0]);
+    mag[m] = fabsf(xr[0] - xi[0]);
+
+    k = 1;
+#if defined(DSP_NEON)
+    for (; k + 4 <= m; k += 4) {
+        float32x4_t zr = vld1q_f32(xr + k), zi = vld1q_f32(xi + k);
+        float32x4_t rr = reverse(vld1q_f32(xr + m - k - 3));
+        float32x4_t ri = reverse(vld1q_f32(xi + m - k - 3));
+        float32x4_t ar = vaddq_f32(zr, rr), ai = vsubq_f32(zi, ri);
+        float32x4_t br = vsubq_f32(zr, rr), bi = vaddq_f32(zi, ri);
+        float32x4_t c = vld1q_f32(sc + k), sn = vld1q_f32(ss + k);
+        float32x4_t re = vmulq_n_f32(ar, 0.5f);
+        float32x4_t im = vmulq_n_f32(ai, 0.5f);
+
+        re = vfmsq_f32(vfmaq_f32(re, c, bi), sn, br);
+        im = vfmsq_f32(vfmsq_f32(im, c, br), sn, bi);
+        vst1q_f32(mag + k, vsqrtq_f32(vfmaq_f32(vmulq_f32(re, re), im, im)));
+    }
+#endif
+
+    for (; k < m; k++) {
+        float ar = xr[k] + xr[m - k], ai = xi[k] - xi[m - k];
+        float br = xr[k] - xr[m - k], bi = xi[k] + xi[m - k];
+        float re = 0.5f * ar + sc[k] * bi - ss[k] * br;
+        float im = 0.5f * ai - sc[k] * br - ss[k] * bi;
+
+        mag[k] = sqrtf(re * re + im * im);
+    }
+}
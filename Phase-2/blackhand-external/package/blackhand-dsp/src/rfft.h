@@ -0,0 +1,30 @@
+/*
+ * Real FFT used by the feature extractor.
+ *
+ * Power-of-two lengths. The n real samples are packed as n/2 complex
+ * values in split form (even samples in re[], odd samples in im[]),
+ * transformed with Stockham passes (no bit reversal) and unpacked into
+ * magnitudes of bins 0..n/2 in one pass.
+ */
+
+#pragma once
+
+struct rfft {
+    unsigned n;         /* real length */
+    unsigned m;         /* complex length, n / 2 */
+    float *tw;          /* twiddles of the complex passes */
+    float *split_c;     /* 0.5 * cos(2 pi k / n), k = 0..m */
+    float *split_s;     /* 0.5 * sin(2 pi k / n), k = 0..m */
+    float *re, *im;     /* packed input, m each */
+    float *wr, *wi;     /* ping-pong buffers, m each */
+};
+
+/* Returns 0 on success, -1 if n is not a power of two >= 8 or on ENOMEM. */
+int rfft_init(struct rfft *f, unsigned n);
+void rfft_free(struct rfft *f);
+
+/*
+ * Transform the packed input in f->re / f->im and write |X[k]| for
+ * k = 0..n/2 to mag (n/2 + 1 values). The packed input is clobbered.
+ */
+void rfft_mag(struct rfft *f, float *mag);
@@ -8,7 +8,7 @@ BLACKHAND_STT_SITE_METHOD = local
 BLACKHAND_STT_DEPENDENCIES =
 
 define BLACKHAND_STT_BUILD_CMDS
-	$(MAKE) -C $(@D)
+	$(MAKE) $(TARGET_CONFIGURE_OPTS) -C $(@D)
 endef
 
 define BLACKHAND_STT_INSTALL_TARGET_CMDS